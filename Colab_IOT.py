@@ -346,6 +346,14 @@ labels = df['next_Solar [kW]']
 scaler = StandardScaler()
 X_scaled = scaler.fit_transform(features)
 
+# Salvo media e deviazione standard: tools/eml_codegen.py --scaler le ingloba nel layer 0,
+# cosi' il firmware puo' passare le feature grezze al modello
+import json
+# scaler_path = 'prediction_next_diff_scaler.json'
+scaler_path = 'prediction_next_solar_scaler.json'
+with open(scaler_path, 'w') as f:
+    json.dump({'mean': scaler.mean_.tolist(), 'scale': scaler.scale_.tolist()}, f)
+
 # Train/test split
 X_train, X_test, y_train, y_test = train_test_split(X_scaled, labels, test_size=0.2, random_state=42)
 
@@ -369,6 +377,48 @@ history = model.fit(X_train, y_train, epochs=30, validation_split=0.2, verbose=1
 loss, mae = model.evaluate(X_test, y_test)
 print(f"\n Test MAE: {mae:.4f}")
 
+
+# ------------- PRUNING PER MAGNITUDINE (opzionale) ---------------
+# Azzera i pesi piu' piccoli dei layer nascosti (48/80 neuroni, non il primo e l'uscita)
+# aumentando la sparsita' a passi, con fine-tuning a maschere fisse dopo ogni passo.
+# Si tiene la sparsita' piu' alta con MAE di test entro MAX_MAE_LOSS rispetto al modello denso.
+# I pesi azzerati finiscono nell'header emlearn, tools/eml_sparse.py li converte in CSR.
+import tensorflow as tf
+
+MAX_MAE_LOSS = 0.10   # perdita di MAE accettata (10%)
+prune_layers = [l for l in model.layers if isinstance(l, Dense)][1:-1]
+
+def apply_masks(masks):
+    for layer, mask in zip(prune_layers, masks):
+        w, b = layer.get_weights()
+        layer.set_weights([w * mask, b])
+
+class KeepMasks(tf.keras.callbacks.Callback):
+    def __init__(self, masks):
+        super().__init__()
+        self.masks = masks
+    def on_train_batch_end(self, batch, logs=None):
+        apply_masks(self.masks)
+
+dense_mae = mae
+best = (0.0, model.get_weights(), mae)
+for sparsity in [0.5, 0.6, 0.7, 0.8]:
+    masks = []
+    for layer in prune_layers:
+        w = layer.get_weights()[0]
+        masks.append((np.abs(w) > np.percentile(np.abs(w), sparsity * 100)).astype(np.float32))
+    apply_masks(masks)
+    model.fit(X_train, y_train, epochs=10, validation_split=0.2, verbose=0, callbacks=[KeepMasks(masks)])
+    _, pruned_mae = model.evaluate(X_test, y_test, verbose=0)
+    print(f"Sparsita' {sparsity:.0%}: Test MAE {pruned_mae:.4f} (denso {dense_mae:.4f})")
+    if pruned_mae > dense_mae * (1 + MAX_MAE_LOSS):
+        break
+    best = (sparsity, model.get_weights(), pruned_mae)
+
+model.set_weights(best[1])
+mae = best[2]
+print(f"Modello potato al {best[0]:.0%}: Test MAE {mae:.4f}, perdita {(mae / dense_mae - 1):.1%}")
+
 # Predizione
 y_pred = model.predict(X_test).flatten()
 
@@ -407,4 +457,105 @@ cmodel = emlearn.convert(model, method='inline')
 # cmodel.save(file=path, name='prediction_next_diff')
 cmodel.save(file=path, name='prediction_next_solar')
 
-print('Wrote model to', path)
\ No newline at end of file
+print('Wrote model to', path)
+
+
+# ------------- MODELLO MULTI-ORIZZONTE (prossime 24 ore) ---------------
+# Stesso tronco 48-80-80-32-80-48 con 24 uscite: consumo previsto per ciascuna delle
+# prossime 24 ore, calcolato dall'edge con una sola inferenza (PREDICTION_CONF_FORECAST)
+# ed esposto su /res_forecast, che il server usa per pianificare la furnace.
+# Lo scaler viene inglobato nel primo layer prima dell'esportazione: il firmware
+# passa le feature grezze.
+
+HORIZON = 24
+STEPS_PER_HOUR = 1   # righe del dataset aggregato per ogni ora
+
+df = pd.read_csv('/content/drive/MyDrive/nuovi_sub/dataset_aggr_consumo.csv')
+
+fc_features = df[['Difference [kW]', 'Mese', 'Ora', 'temperature', 'humidity']]
+fc_labels = pd.concat([df['Difference [kW]'].shift(-h * STEPS_PER_HOUR).rename(f'+{h}h')
+                       for h in range(1, HORIZON + 1)], axis=1)
+valid = fc_labels.notna().all(axis=1)
+fc_features, fc_labels = fc_features[valid], fc_labels[valid]
+
+fc_scaler = StandardScaler()
+Xf = fc_scaler.fit_transform(fc_features)
+Xf_train, Xf_test, yf_train, yf_test = train_test_split(Xf, fc_labels.values, test_size=0.2, random_state=42)
+
+fc_model = Sequential()
+fc_model.add(Dense(units=48, activation='relu', input_shape=(Xf_train.shape[1],)))
+fc_model.add(Dense(units=80, activation='relu'))
+fc_model.add(Dense(units=80, activation='relu'))
+fc_model.add(Dense(units=32, activation='relu'))
+fc_model.add(Dense(units=80, activation='relu'))
+fc_model.add(Dense(units=48, activation='relu'))
+fc_model.add(Dropout(0.2))
+fc_model.add(Dense(HORIZON))
+
+fc_model.compile(optimizer=Adam(), loss='mse', metrics=['mae'])
+fc_model.fit(Xf_train, yf_train, epochs=30, validation_split=0.2, verbose=1)
+
+_, fc_mae = fc_model.evaluate(Xf_test, yf_test)
+fc_mae_h = np.abs(fc_model.predict(Xf_test) - yf_test).mean(axis=0)
+print(f"\n Test MAE forecast: {fc_mae:.4f} (+1h {fc_mae_h[0]:.4f}, +24h {fc_mae_h[-1]:.4f})")
+
+# Scaler nel primo layer: W' = W / scale, b' = b - (mean / scale) @ W
+first = fc_model.layers[0]
+w, b = first.get_weights()
+first.set_weights([(w / fc_scaler.scale_[:, None]).astype(np.float32),
+                   (b - (fc_scaler.mean_ / fc_scaler.scale_) @ w).astype(np.float32)])
+
+path = 'prediction_forecast_power.h'
+cmodel = emlearn.convert(fc_model, method='inline')
+cmodel.save(file=path, name='prediction_forecast_power')
+
+
+
+# ------------- MODELLO FUSO next_solar + next_power ---------------
+# Un solo tronco 48-80-80-32-80-48 con due uscite, eseguito dall'edge che riceve sia
+# il campione del roof sia quello del power node (PREDICTION_CONF_FUSED 1 su edge e roof):
+# MAC e flash della previsione si dimezzano e il roof non porta piu' prediction_next_solar.h.
+# Ordine di ingressi e uscite fissato dal firmware (predict_next_power() in coap-edge.c).
+
+df = pd.read_csv('/content/drive/MyDrive/nuovi_sub/dataset_aggr_consumo.csv')
+
+fu_features = df[['Solar [kW]', 'Difference [kW]', 'Mese', 'Ora', 'temperature', 'humidity']]
+fu_labels = df[['next_Solar [kW]', 'next_Difference [kW]']]
+valid = fu_labels.notna().all(axis=1)
+fu_features, fu_labels = fu_features[valid], fu_labels[valid]
+
+fu_scaler = StandardScaler()
+Xu = fu_scaler.fit_transform(fu_features)
+Xu_train, Xu_test, yu_train, yu_test = train_test_split(Xu, fu_labels.values, test_size=0.2, random_state=42)
+
+# Le due uscite hanno range molto diversi (solare 0..75 kW, consumo fino a 250 kW):
+# la loss pesa ciascuna uscita sulla propria varianza
+fu_std = yu_train.std(axis=0)
+def scaled_mse(y_true, y_pred):
+    return tf.reduce_mean(tf.square((y_true - y_pred) / fu_std))
+
+fu_model = Sequential()
+fu_model.add(Dense(units=48, activation='relu', input_shape=(Xu_train.shape[1],)))
+fu_model.add(Dense(units=80, activation='relu'))
+fu_model.add(Dense(units=80, activation='relu'))
+fu_model.add(Dense(units=32, activation='relu'))
+fu_model.add(Dense(units=80, activation='relu'))
+fu_model.add(Dense(units=48, activation='relu'))
+fu_model.add(Dropout(0.2))
+fu_model.add(Dense(2))
+
+fu_model.compile(optimizer=Adam(), loss=scaled_mse, metrics=['mae'])
+fu_model.fit(Xu_train, yu_train, epochs=30, validation_split=0.2, verbose=1)
+
+fu_mae = np.abs(fu_model.predict(Xu_test) - yu_test).mean(axis=0)
+print(f"\n Test MAE fuso: next_Solar {fu_mae[0]:.4f}, next_Difference {fu_mae[1]:.4f}")
+
+# Scaler nel primo layer: W' = W / scale, b' = b - (mean / scale) @ W
+first = fu_model.layers[0]
+w, b = first.get_weights()
+first.set_weights([(w / fu_scaler.scale_[:, None]).astype(np.float32),
+                   (b - (fu_scaler.mean_ / fu_scaler.scale_) @ w).astype(np.float32)])
+
+path = 'prediction_fused.h'
+cmodel = emlearn.convert(fu_model, method='inline')
+cmodel.save(file=path, name='prediction_fused')
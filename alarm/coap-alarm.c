@@ -7,23 +7,15 @@
 #include <string.h>
 #include <stdlib.h>
 #include "os/dev/leds.h"
-#include "net/netstack.h"
-#include "net/routing/routing.h"
-#include "net/ipv6/uiplib.h"
 #include "lib/random.h"
+#include "coap_group.h"
+#include "node_runtime.h"
 
 #define LOG_MODULE "NodeAlarm"
 #define LOG_LEVEL LOG_LEVEL_INFO
 
-#define SERVER_EP "coap://[fd00::1]:5683"
-
-static coap_endpoint_t server_ep;
-static coap_message_t request[1];
-static struct etimer wait_timer; // Timer per ricerca root iniziale
 extern int alarm_state; // Valore della risorsa res_alarm
 
-static char json_buf[64];
-
 PROCESS(node_alarm_process, "Alarm Actuator Node");
 AUTOSTART_PROCESSES(&node_alarm_process);
 
@@ -50,26 +42,23 @@ void set_alarm(int new_state) {
     }
 }
 
-// Funzione di callback per gestire la risposta dal server
-void response_handler(coap_message_t *response){
-
-   if (response == NULL) {
-    LOG_INFO("Timeout dal server\n");
-    return;
+#if COAP_GROUP
+// Comando di gruppo dell'edge (node/coap_group.h): qui conta solo alarm_state.
+// La notifica observe fa da conferma, anche a stato invariato se l'edge la chiede
+static void group_command(const msg_group_t *m) {
+  if(m->alarm_state != alarm_state) {
+    LOG_INFO("Comando di gruppo, cambio stato: %d -> %d\n", alarm_state, (int)m->alarm_state);
+    set_alarm(m->alarm_state);
+    alarm_state = m->alarm_state;
+    coap_notify_observers(&res_alarm);
+  } else if(m->ack & COAP_GROUP_ALARM) {
+    coap_notify_observers(&res_alarm);
   }
-
-  // Stampa e controlla codice CoAP (es. 2.05, 4.04, ecc.)
-  uint8_t class = response->code >> 5;
-  uint8_t detail = response->code & 0x1F;
-  LOG_INFO("Codice risposta: %u.%02u\n", class, detail);
 }
+#endif
 
 PROCESS_THREAD(node_alarm_process, ev, data)
 {
-  static uip_ipaddr_t dest_ipaddr;
-  char ipstr[64]; // temp ip root e server
-  char endpoint[128]; // indirizzo server root
-
   PROCESS_BEGIN();
 
   coap_engine_init();
@@ -79,46 +68,22 @@ PROCESS_THREAD(node_alarm_process, ev, data)
   // Inizializzo risorse del nodo
   res_alarm.flags |= IS_OBSERVABLE;
   coap_activate_resource(&res_alarm, "res_alarm");
+#if COAP_GROUP
+  coap_group_join(group_command);
+#endif
 
-  // Ricerca del nodo root
-  etimer_set(&wait_timer, CLOCK_SECOND);
-  while(!NETSTACK_ROUTING.node_is_reachable() ||
-      !NETSTACK_ROUTING.get_root_ipaddr(&dest_ipaddr)) {
-  LOG_INFO("In attesa del root...\n");
-  leds_toggle(LEDS_RED);
-  PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&wait_timer));
-  etimer_reset(&wait_timer);
-  }
-  
-  leds_off(LEDS_RED);
-  
-  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &dest_ipaddr);
-  snprintf(endpoint, sizeof(endpoint), "coap://[%s]:5683", ipstr);
-  LOG_INFO("Root trovato: %s\n", endpoint);
-
-  coap_endpoint_parse(SERVER_EP, strlen(SERVER_EP), &server_ep);
+  // Root e registrazione in node_runtime_process (node/node_runtime.h), con backoff
+  // sui fallimenti: intanto i comandi sono gia' serviti
+  node_runtime_start("{\"id\":\"nodoAlarm\", \"resources\":[\"/res_alarm\"]}", NULL, 0);
 
-
-   // === 1. REGISTRAZIONE RISORSE ===
-  snprintf(json_buf, sizeof(json_buf),
-           "{\"id\":\"nodoAlarm\", \"resources\":[\"/res_alarm\"]}");
-  
-  coap_init_message(request, COAP_TYPE_CON, COAP_POST, coap_get_mid());
-  coap_set_header_uri_path(request, "register");
-  coap_set_payload(request, (uint8_t *)json_buf, strlen(json_buf));
-
-  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &server_ep.ipaddr);
-  LOG_INFO("-> Invio a CoaP server IP: [%s], porta: %u\n", ipstr, uip_ntohs(server_ep.port));
-
-  COAP_BLOCKING_REQUEST(&server_ep, request, response_handler);
-  LOG_INFO("Registrazione completata\n");
-
-  leds_on(LEDS_BLUE);
-
-  // === 2. CICLO INFINITO ===
+  // === CICLO INFINITO ===
   while(1) {
     PROCESS_WAIT_EVENT();
     LOG_INFO("Evento ricevuto: %u\n", ev);
+
+    if(ev == ev_runtime_registered) {
+      leds_on(LEDS_BLUE);
+    }
   }
 
   PROCESS_END();
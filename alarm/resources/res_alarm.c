@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "sys/log.h"
+#include "msg_codec.h"
 
 
 #define LOG_MODULE "RES_ALARM"
@@ -14,10 +15,15 @@ extern void set_alarm(int new_state);
 static int parse = 0; // flag per controllare il parsing
 extern coap_resource_t res_alarm;
 
-static int parse_alarm(const char *json_str, int *new_state){
-  int matched = sscanf(json_str, "{\"alarm_state\": %d}", new_state); // Prova a fare il parsing del JSON ricevuto cercando il campo "alarm_state"
-  LOG_INFO("Ho fatto parsing, matched = %d\n", matched);
-  return (matched == 1);  // ritorna 1 se è andato bene
+static int parse_alarm(const uint8_t *payload, uint16_t len, int *new_state){
+  msg_alarm_t m;
+  int r = msg_alarm_decode(payload, len, &m); // Parsing del JSON ricevuto cercando il campo "alarm_state" (0-3, verificato dallo schema)
+  LOG_INFO("Ho fatto parsing, esito = %d\n", r);
+  if(r != MSG_OK) {
+    return 0;
+  }
+  *new_state = m.alarm_state;
+  return 1;  // ritorna 1 se è andato bene
 }
 
 // GET
@@ -32,12 +38,13 @@ static void res_alarm_get_handler(coap_message_t *request, coap_message_t *respo
 // PUT
 static void res_alarm_put_handler(coap_message_t *request, coap_message_t *response,
                       uint8_t *buffer, uint16_t preferred_size, int32_t *offset) {
-  size_t len = coap_get_payload(request, (const uint8_t **)&buffer);
+  const uint8_t *payload = NULL;
+  size_t len = coap_get_payload(request, &payload);
 
     if(len > 0) {
         int new_state;
-        parse = parse_alarm((const char *)buffer, &new_state); // Fa parsing
-        if(parse && new_state >= 0 && new_state <= 3){
+        parse = parse_alarm(payload, len, &new_state); // Fa parsing
+        if(parse){
           LOG_INFO("[RES_ALARM] Ricevuto PUT su /res_alarm: %d\n", new_state);
 
           // Solo se lo stato è cambiato cambia led e notifica observers
@@ -51,7 +58,7 @@ static void res_alarm_put_handler(coap_message_t *request, coap_message_t *respo
         
         coap_set_status_code(response, CHANGED_2_04);
         } else {
-        LOG_WARN("[RES_ALARM] Payload non valido: %s\n", buffer);
+        LOG_WARN("[RES_ALARM] Payload non valido: %.*s\n", (int)len, (const char *)payload);
         coap_set_status_code(response, BAD_REQUEST_4_00);
         }
     } else {
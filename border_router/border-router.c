@@ -30,43 +30,23 @@
 #include "contiki.h"
 #include "net/routing/routing.h"
 #include "net/netstack.h"
-#include "net/ipv6/simple-udp.h"
 #include "os/dev/leds.h"
+#if MAC_CONF_WITH_TSCH
+#include "net/mac/tsch/tsch.h"
+#endif
+#if BR_CACHE_CONF_ENABLED
+#include "res_cache.h"
+#endif
 
 #include "sys/log.h"
 #define LOG_MODULE "App"
 #define LOG_LEVEL LOG_LEVEL_INFO
 
-#define WITH_SERVER_REPLY  1
-#define UDP_CLIENT_PORT    8765
-#define UDP_SERVER_PORT    5678
+PROCESS(border_router_process, "Border router");
+AUTOSTART_PROCESSES(&border_router_process);
 
-static struct simple_udp_connection udp_conn;
-
-PROCESS(udp_server_process, "UDP server");
-AUTOSTART_PROCESSES(&udp_server_process);
-
-/*---------------------------------------------------------------------------*/
-static void
-udp_rx_callback(struct simple_udp_connection *c,
-         const uip_ipaddr_t *sender_addr,
-         uint16_t sender_port,
-         const uip_ipaddr_t *receiver_addr,
-         uint16_t receiver_port,
-         const uint8_t *data,
-         uint16_t datalen)
-{
-  LOG_INFO("Received request '%.*s' from ", datalen, (char *) data);
-  LOG_INFO_6ADDR(sender_addr);
-  LOG_INFO_("\n");
-#if WITH_SERVER_REPLY
-  /* send back the same string to the client as an echo reply */
-  LOG_INFO("Sending response.\n");
-  simple_udp_sendto(&udp_conn, data, datalen, sender_addr);
-#endif /* WITH_SERVER_REPLY */
-}
 /*---------------------------------------------------------------------------*/
-PROCESS_THREAD(udp_server_process, ev, data)
+PROCESS_THREAD(border_router_process, ev, data)
 {
   PROCESS_BEGIN();
   
@@ -78,13 +58,18 @@ PROCESS_THREAD(udp_server_process, ev, data)
   LOG_INFO("Contiki-NG Border Router started\n");
   /* Initialize DAG root */
   NETSTACK_ROUTING.root_start();
+#if MAC_CONF_WITH_TSCH
+  // Con make TSCH=1 il root e' anche il coordinatore che diffonde gli EB
+  tsch_set_coordinator(1);
+#endif
 
   // Accendi il LED verde per indicare che il router è attivo
   leds_toggle(LEDS_GREEN);
 
-  /* Initialize UDP connection */
-  simple_udp_register(&udp_conn, UDP_SERVER_PORT, NULL,
-                      UDP_CLIENT_PORT, udp_rx_callback);
+#if BR_CACHE_CONF_ENABLED
+  // Cache di /register e /lookup per i nodi (resources/res_cache.h)
+  process_start(&cache_process, NULL);
+#endif
 
   PROCESS_END();
 }
@@ -41,18 +41,27 @@
 
 #define LOG_LEVEL_APP LOG_LEVEL_DBG
 
+/* La cache (resources/res_cache.h) inoltra le register dei nodi cosi' come
+ * arrivano, con l'IP del nodo in ?ip=, e serve le lookup a blocchi: stessi
+ * blocchi dei nodi. Il buffer resta piu' grande per ricevere dal server le
+ * risposte alle lookup multiple in un solo datagramma, e serve una
+ * transazione per ogni richiesta in inoltro oltre all'orario */
 #undef REST_MAX_CHUNK_SIZE
 #define REST_MAX_CHUNK_SIZE 128
 
 #undef COAP_MAX_OPEN_TRANSACTIONS
-#define COAP_MAX_OPEN_TRANSACTIONS 4
+#define COAP_MAX_OPEN_TRANSACTIONS 8
 
 #undef NBR_TABLE_CONF_MAX_NEIGHBORS
 #define NBR_TABLE_CONF_MAX_NEIGHBORS     10
 #undef UIP_CONF_MAX_ROUTES
 #define UIP_CONF_MAX_ROUTES   10
 #undef UIP_CONF_BUFFER_SIZE
-#define UIP_CONF_BUFFER_SIZE    240
+#define UIP_CONF_BUFFER_SIZE    400
+
+/* Cache di /lookup: validita' delle risposte (s), meno del lifetime del server */
+#define BR_CACHE_CONF_TTL 300
+#define BR_CACHE_CONF_ENTRIES 4
 
 /* Abilita block-wise transfer
 #define COAP_OBSERVE_CLIENT 1
@@ -60,4 +69,15 @@
 #define COAP_MAX_CHUNK_SIZE REST_MAX_CHUNK_SIZE
 */
 
+/* Attuazione di gruppo (node/coap_group.h), con make GROUP=1: il nodo inoltra
+ * con MPL i comandi multicast dell'edge verso gli attuatori */
+#if COAP_GROUP_CONF_ENABLED
+#define UIP_MCAST6_CONF_ENGINE UIP_MCAST6_ENGINE_MPL
+#endif
+
+/* Profilo TSCH, con make TSCH=1 (node/tsch_app.h): il root non ha pari
+ * applicativi, solo gli slotframe EB e comune */
+#define ORCHESTRA_CONF_RULES { &eb_per_time_source, &default_common }
+#include "../node/tsch_app_conf.h"
+
 #endif /* PROJECT_CONF_H_ */
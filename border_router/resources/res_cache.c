@@ -0,0 +1,512 @@
+// === /register e /lookup serviti dal root RPL con una cache del server (res_cache.h) ===
+#include "contiki.h"
+#include "coap-engine.h"
+#include "coap-callback-api.h"
+#include "net/ipv6/uiplib.h"
+#include "lib/crc16.h"
+#include "sys/ctimer.h"
+#include "sys/log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "msg_codec.h"
+#include "res_cache.h"
+
+#define LOG_MODULE "Cache"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+/* Una voce per nodo: la query "res=/a,/b,..." con tutte le sue destinazioni e la
+ * risposta del server in JSON compatto (circa 240 byte per le cinque dell'edge) */
+#define QUERY_SIZE 80
+#define ANSWER_SIZE 256
+#define FORWARD_SIZE (REST_MAX_CHUNK_SIZE + 1)
+#define PENDING_TIMEOUT 120           /* s, voce in attesa del server */
+#define ANSWER_HOLD 30                /* s, esito di una register in attesa del nodo */
+#define TIME_RETRY 10                 /* s, orario non ancora sincronizzato */
+#define RETRY_INTERVAL (CLOCK_SECOND / 4)
+
+// Risposta del server a una query di /lookup. code 0 = richiesta al server in corso
+typedef struct cache_entry {
+  char query[QUERY_SIZE];     /* es. "res=/res_data", vuota = voce libera */
+  char answer[ANSWER_SIZE];
+  uint16_t len;
+  uint8_t code;
+  uint16_t format;
+  unsigned long expires;      /* clock_seconds() */
+} cache_entry_t;
+
+// Ultima registrazione vista per nodo, per riconoscere i rinnovi
+typedef struct cache_node {
+  uip_ipaddr_t ip;
+  uint16_t crc;
+  uint8_t used;
+} cache_node_t;
+
+#define FORWARD_FREE     0
+#define FORWARD_QUEUED   1
+#define FORWARD_INFLIGHT 2
+#define FORWARD_ANSWERED 3            /* register: esito del server, per il prossimo tentativo del nodo */
+
+// Richiesta da inoltrare al server. state in testa: il callback risale allo slot
+typedef struct forward {
+  coap_callback_request_state_t state;
+  coap_message_t request[1];
+  uint8_t status;
+  uint8_t method;             /* COAP_POST = register, COAP_GET = lookup */
+  uip_ipaddr_t node;          /* chi si registra */
+  uint16_t crc;               /* del payload ricevuto dal nodo */
+  uint8_t code;               /* register: risposta del server, 5.04 se non e' arrivata */
+  unsigned long answered;     /* clock_seconds() dell'esito */
+  char query[QUERY_SIZE];     /* register: "ip=" e l'IP del nodo */
+  char data[FORWARD_SIZE];    /* payload della register */
+  uint16_t len;
+} forward_t;
+
+static cache_entry_t cache[BR_CACHE_ENTRIES];
+static cache_node_t nodes[BR_CACHE_NODES];
+static uint8_t next_node;
+static forward_t forwards[BR_CACHE_PENDING];
+static coap_endpoint_t server_ep;
+static struct ctimer retry_timer;
+static unsigned long hits, misses;
+
+static unsigned long epoch_base;      /* epoch del server meno clock_seconds(), 0 = non sincronizzato */
+static coap_callback_request_state_t time_state;
+static coap_message_t time_request[1];
+static uint8_t time_busy;
+
+PROCESS(cache_process, "CoAP cache");
+
+static void register_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset);
+static void register_post_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset);
+static void lookup_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset);
+
+RESOURCE(res_register,
+     "title=\"Register (cache)\";rt=\"application/json\"",
+     register_get_handler,
+     register_post_handler,
+     NULL,
+     NULL);
+
+RESOURCE(res_lookup,
+     "title=\"Lookup (cache)\";rt=\"application/json\"",
+     lookup_get_handler,
+     NULL,
+     NULL,
+     NULL);
+
+// Il nodo ritenta con il suo backoff: nel frattempo risponde il server
+static void unavailable(coap_message_t *response) {
+  coap_set_status_code(response, SERVICE_UNAVAILABLE_5_03);
+  coap_set_header_max_age(response, 1);
+}
+
+// Slot libero; l'esito di una register che il nodo non e' tornato a chiedere si libera dopo ANSWER_HOLD
+static forward_t *forward_alloc(void) {
+  uint8_t i;
+
+  for(i = 0; i < BR_CACHE_PENDING; i++) {
+    if(forwards[i].status == FORWARD_ANSWERED && clock_seconds() - forwards[i].answered > ANSWER_HOLD) {
+      forwards[i].status = FORWARD_FREE;
+    }
+    if(forwards[i].status == FORWARD_FREE) {
+      return &forwards[i];
+    }
+  }
+  return NULL;
+}
+
+// Register dello stesso nodo con lo stesso payload, in inoltro o con l'esito del server
+static forward_t *forward_find(const uip_ipaddr_t *node, uint16_t crc) {
+  uint8_t i;
+
+  for(i = 0; i < BR_CACHE_PENDING; i++) {
+    if(forwards[i].status != FORWARD_FREE && forwards[i].method == COAP_POST && forwards[i].crc == crc &&
+       uip_ipaddr_cmp(&forwards[i].node, node)) {
+      return &forwards[i];
+    }
+  }
+  return NULL;
+}
+
+// Voce della query, NULL se assente o scaduta (che si libera)
+static cache_entry_t *cache_find(const char *query) {
+  uint8_t i;
+
+  for(i = 0; i < BR_CACHE_ENTRIES; i++) {
+    if(cache[i].query[0] && strcmp(cache[i].query, query) == 0) {
+      if(cache[i].expires <= clock_seconds()) {
+        cache[i].query[0] = '\0';
+        return NULL;
+      }
+      return &cache[i];
+    }
+  }
+  return NULL;
+}
+
+// Voce libera, altrimenti quella che scade prima; le voci in corso non si toccano
+static cache_entry_t *cache_alloc(void) {
+  cache_entry_t *e = NULL;
+  uint8_t i;
+
+  for(i = 0; i < BR_CACHE_ENTRIES; i++) {
+    if(!cache[i].query[0]) {
+      return &cache[i];
+    }
+    if((cache[i].code || cache[i].expires <= clock_seconds()) && (e == NULL || cache[i].expires < e->expires)) {
+      e = &cache[i];
+    }
+  }
+  return e;
+}
+
+static cache_entry_t *cache_pending(const char *query) {
+  cache_entry_t *e = cache_find(query);
+
+  return e != NULL && e->code == 0 ? e : NULL;
+}
+
+// La voce cerca una risorsa nominata dalla registrazione o risponde con l'IP del nodo
+static int cache_affected(const cache_entry_t *e, const char *registration, const char *quoted_ip) {
+  char path[QUERY_SIZE + 2];
+  const char *p = strchr(e->query, '=');
+  const char *end;
+
+  if(e->code && strstr(e->answer, quoted_ip) != NULL) {
+    return 1;
+  }
+  for(p = p ? p + 1 : e->query; *p; p = *end ? end + 1 : end) {
+    end = strchr(p, ',');
+    if(end == NULL) {
+      end = p + strlen(p);
+    }
+    if(end > p) {
+      snprintf(path, sizeof(path), "\"%.*s\"", (int)(end - p), p);
+      if(strstr(registration, path) != NULL) {
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+// Registrazione confermata dal server: se e' nuova o cambiata invalida le voci coinvolte
+static void registration_confirmed(forward_t *f) {
+  char quoted_ip[UIPLIB_IPV6_MAX_STR_LEN + 2];
+  cache_node_t *n = NULL;
+  uint8_t i, dropped = 0;
+
+  for(i = 0; i < BR_CACHE_NODES; i++) {
+    if(nodes[i].used && uip_ipaddr_cmp(&nodes[i].ip, &f->node)) {
+      n = &nodes[i];
+      break;
+    }
+  }
+  if(n != NULL && n->crc == f->crc) {
+    return;
+  }
+  if(n == NULL) {
+    n = &nodes[next_node];
+    next_node = (next_node + 1) % BR_CACHE_NODES;
+  }
+  uip_ipaddr_copy(&n->ip, &f->node);
+  n->crc = f->crc;
+  n->used = 1;
+
+  quoted_ip[0] = '"';
+  uiplib_ipaddr_snprint(quoted_ip + 1, sizeof(quoted_ip) - 2, &f->node);
+  strcat(quoted_ip, "\"");
+  for(i = 0; i < BR_CACHE_ENTRIES; i++) {
+    if(cache[i].query[0] && cache_affected(&cache[i], f->data, quoted_ip)) {
+      cache[i].query[0] = '\0';
+      dropped++;
+    }
+  }
+  LOG_INFO("Registrazione nuova da %s: %u voci invalidate\n", quoted_ip, dropped);
+}
+
+// Risposta del server a una lookup: completa la voce, se non e' stata invalidata nel frattempo
+static void lookup_answer(forward_t *f, coap_message_t *response) {
+  cache_entry_t *e = cache_pending(f->query);
+  const uint8_t *chunk;
+  unsigned int format = APPLICATION_JSON;
+  int len;
+
+  if(e == NULL) {
+    return;
+  }
+  len = coap_get_payload(response, &chunk);
+  if((response->code != CONTENT_2_05 && response->code != NOT_FOUND_4_04) || len >= ANSWER_SIZE) {
+    LOG_WARN("%s: risposta %u.%02u non salvata\n", f->query, response->code >> 5, response->code & 0x1F);
+    e->query[0] = '\0';
+    return;
+  }
+  coap_get_header_content_format(response, &format);
+  memcpy(e->answer, chunk, len);
+  e->answer[len] = '\0';
+  e->len = len;
+  e->format = format;
+  e->code = response->code;
+  e->expires = clock_seconds() + (response->code == CONTENT_2_05 ? BR_CACHE_TTL : BR_CACHE_NEG_TTL);
+  LOG_INFO("%s in cache: %.*s\n", f->query, len, e->answer);
+}
+
+static void forward_callback(coap_callback_request_state_t *state) {
+  forward_t *f = (forward_t *)state;
+  coap_message_t *response = state->state.response;
+  cache_entry_t *e;
+
+  switch(state->state.status) {
+  case COAP_REQUEST_STATUS_MORE:
+    return;
+  case COAP_REQUEST_STATUS_RESPONSE:
+    if(f->method == COAP_GET) {
+      lookup_answer(f, response);
+    } else if((response->code >> 5) == 2) {
+      f->code = CHANGED_2_04;
+      registration_confirmed(f);
+    } else {
+      f->code = response->code;
+      LOG_WARN("Register rifiutata dal server: %u.%02u\n", response->code >> 5, response->code & 0x1F);
+    }
+    return;
+  case COAP_REQUEST_STATUS_FINISHED:
+    break;
+  default:
+    LOG_WARN("Nessuna risposta dal server per %s\n", f->method == COAP_GET ? f->query : "/register");
+    if(f->method == COAP_GET && (e = cache_pending(f->query)) != NULL) {
+      e->query[0] = '\0';
+    }
+    break;
+  }
+  // L'esito della register resta al nodo, che lo riceve al prossimo tentativo
+  if(f->method == COAP_POST) {
+    f->status = FORWARD_ANSWERED;
+    f->answered = clock_seconds();
+  } else {
+    f->status = FORWARD_FREE;
+  }
+  process_poll(&cache_process);
+}
+
+static void retry(void *ptr) {
+  process_poll(&cache_process);
+}
+
+// Inoltra le richieste accodate dai gestori, fuori dall'elaborazione del pacchetto ricevuto
+static void dispatch(void) {
+  forward_t *f;
+  uint8_t i;
+
+  for(i = 0; i < BR_CACHE_PENDING; i++) {
+    f = &forwards[i];
+    if(f->status != FORWARD_QUEUED) {
+      continue;
+    }
+    coap_init_message(f->request, COAP_TYPE_CON, f->method, coap_get_mid());
+    if(f->method == COAP_GET) {
+      coap_set_header_uri_path(f->request, "lookup");
+      coap_set_header_uri_query(f->request, f->query);
+    } else {
+      coap_set_header_uri_path(f->request, "register");
+      coap_set_header_uri_query(f->request, f->query);
+      coap_set_header_content_format(f->request, APPLICATION_JSON);
+      coap_set_payload(f->request, f->data, f->len);
+    }
+    if(!coap_send_request(&f->state, &server_ep, f->request, forward_callback)) {
+      // Transazioni del motore CoAP esaurite: si riprova dopo
+      ctimer_set(&retry_timer, RETRY_INTERVAL, retry, NULL);
+      return;
+    }
+    f->status = FORWARD_INFLIGHT;
+  }
+}
+
+static void time_callback(coap_callback_request_state_t *state) {
+  coap_message_t *response = state->state.response;
+  const uint8_t *chunk;
+  msg_timestamp_t m;
+  char ts[16];
+  int len;
+
+  switch(state->state.status) {
+  case COAP_REQUEST_STATUS_MORE:
+    return;
+  case COAP_REQUEST_STATUS_RESPONSE:
+    len = coap_get_payload(response, &chunk);
+    if(response->code == CONTENT_2_05 && len > 0 && msg_timestamp_decode(chunk, len, &m) == MSG_OK &&
+       msg_str_copy(&m.timestamp, ts, sizeof(ts))) {
+      epoch_base = strtoul(ts, NULL, 10) - clock_seconds();
+      LOG_INFO("Orario del server: %s\n", ts);
+    } else {
+      LOG_WARN("Orario non valido dal server\n");
+    }
+    return;
+  case COAP_REQUEST_STATUS_FINISHED:
+    break;
+  default:
+    LOG_WARN("Orario: nessuna risposta dal server\n");
+    break;
+  }
+  time_busy = 0;
+}
+
+static void time_sync(void) {
+  if(time_busy) {
+    return;
+  }
+  coap_init_message(time_request, COAP_TYPE_CON, COAP_GET, coap_get_mid());
+  coap_set_header_uri_path(time_request, "register");
+  time_busy = coap_send_request(&time_state, &server_ep, time_request, time_callback);
+}
+
+// GET /register: orario del server, senza attraversare lo SLIP
+static void register_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset) {
+  int len;
+
+  if(!epoch_base) {
+    unavailable(response);
+    return;
+  }
+  len = snprintf((char *)buffer, preferred_size, "{\"timestamp\":\"%lu\"}", epoch_base + clock_seconds());
+  coap_set_header_content_format(response, APPLICATION_JSON);
+  coap_set_payload(response, buffer, len);
+}
+
+// POST /register: inoltrata al server con l'IP del nodo, che il server non vede dietro al root.
+// 5.03 finche' il server non ha risposto; il tentativo successivo del nodo riceve l'esito
+// (2.04, l'errore del server o 5.04 se il server non risponde)
+static void register_post_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset) {
+  const coap_endpoint_t *src = coap_get_src_endpoint(request);
+  const uint8_t *payload;
+  forward_t *f;
+  uint16_t crc;
+  int len = coap_get_payload(request, &payload);
+
+  if(src == NULL || len < 3 || payload[0] != '{') {
+    coap_set_status_code(response, BAD_REQUEST_4_00);
+    return;
+  }
+  if(len >= FORWARD_SIZE) {
+    coap_set_status_code(response, REQUEST_ENTITY_TOO_LARGE_4_13);
+    return;
+  }
+  crc = crc16_data(payload, len, 0);
+  if((f = forward_find(&src->ipaddr, crc)) != NULL) {
+    if(f->status != FORWARD_ANSWERED) {
+      unavailable(response);
+      return;
+    }
+    coap_set_status_code(response, f->code);
+    f->status = FORWARD_FREE;
+    return;
+  }
+  if((f = forward_alloc()) == NULL) {
+    unavailable(response);
+    return;
+  }
+  memcpy(f->data, payload, len);
+  f->data[len] = '\0';
+  f->len = len;
+  strcpy(f->query, "ip=");
+  uiplib_ipaddr_snprint(f->query + 3, sizeof(f->query) - 3, &src->ipaddr);
+  f->method = COAP_POST;
+  f->crc = crc;
+  f->code = GATEWAY_TIMEOUT_5_04;
+  uip_ipaddr_copy(&f->node, &src->ipaddr);
+  f->status = FORWARD_QUEUED;
+  process_poll(&cache_process);
+  unavailable(response);
+}
+
+// GET /lookup?res=...: dalla cache, a blocchi se la risposta supera preferred_size,
+// altrimenti richiesta al server e 5.03 al nodo
+static void lookup_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset) {
+  int32_t start = offset ? *offset : 0;
+  int32_t chunk;
+  const char *query;
+  char key[QUERY_SIZE];
+  cache_entry_t *e;
+  forward_t *f;
+  int len = coap_get_header_uri_query(request, &query);
+
+  if(len <= 0 || len >= QUERY_SIZE) {
+    coap_set_status_code(response, BAD_REQUEST_4_00);
+    return;
+  }
+  memcpy(key, query, len);
+  key[len] = '\0';
+
+  e = cache_find(key);
+  if(e != NULL && e->code) {
+    if(e->len > 0 && start >= e->len) {
+      coap_set_status_code(response, BAD_OPTION_4_02);
+      return;
+    }
+    if(start == 0) {
+      hits++;
+    }
+    coap_set_status_code(response, e->code);
+    coap_set_header_max_age(response, e->expires - clock_seconds());
+    if(e->len > 0) {
+      chunk = e->len - start < preferred_size ? e->len - start : preferred_size;
+      memcpy(buffer, e->answer + start, chunk);
+      coap_set_header_content_format(response, e->format);
+      coap_set_payload(response, buffer, chunk);
+      if(offset) {
+        *offset = start + chunk < e->len ? start + chunk : -1;
+      }
+    }
+    return;
+  }
+  if(e == NULL) {
+    misses++;
+    if((f = forward_alloc()) == NULL || (e = cache_alloc()) == NULL) {
+      unavailable(response);
+      return;
+    }
+    memcpy(e->query, key, len + 1);
+    e->code = 0;
+    e->len = 0;
+    e->expires = clock_seconds() + PENDING_TIMEOUT;
+    memcpy(f->query, key, len + 1);
+    f->method = COAP_GET;
+    f->status = FORWARD_QUEUED;
+    process_poll(&cache_process);
+  }
+  unavailable(response);
+}
+
+PROCESS_THREAD(cache_process, ev, data)
+{
+  static struct etimer timer;
+
+  PROCESS_BEGIN();
+
+  coap_endpoint_parse(BR_CACHE_SERVER, strlen(BR_CACHE_SERVER), &server_ep);
+  coap_activate_resource(&res_register, "register");
+  coap_activate_resource(&res_lookup, "lookup");
+  LOG_INFO("Cache di /register e /lookup attiva (TTL %u s)\n", BR_CACHE_TTL);
+
+  // Orario del server: primo tentativo quando il prefisso SLIP e' configurato
+  etimer_set(&timer, TIME_RETRY * CLOCK_SECOND);
+  while(1) {
+    PROCESS_WAIT_EVENT();
+    if(ev == PROCESS_EVENT_POLL) {
+      dispatch();
+    } else if(ev == PROCESS_EVENT_TIMER && data == &timer) {
+      time_sync();
+      etimer_set(&timer, (clock_time_t)(epoch_base ? BR_CACHE_TIME_REFRESH : TIME_RETRY) * CLOCK_SECOND);
+      LOG_DBG("Lookup: %lu dalla cache, %lu dal server\n", hits, misses);
+    }
+  }
+
+  PROCESS_END();
+}
@@ -0,0 +1,77 @@
+/*
+ * Cache CoAP sul border router (attiva di default, make CACHE=0 la toglie):
+ * il root RPL serve /register e /lookup ai nodi al posto del server, cosi'
+ * il boot dei nodi non attraversa il collegamento SLIP verso fd00::1.
+ *
+ *  - GET /lookup: risposta dalla cache, valida BR_CACHE_TTL secondi (i 4.04
+ *    BR_CACHE_NEG_TTL), a blocchi se supera REST_MAX_CHUNK_SIZE. Se manca il root la chiede al server e risponde
+ *    intanto 5.03 con Max-Age 1: il nodo ritenta con il suo backoff e trova
+ *    la risposta in cache.
+ *  - GET /register: orario del server tenuto dal root, sincronizzato
+ *    all'avvio e ogni BR_CACHE_TIME_REFRESH secondi (5.03 finche' manca).
+ *  - POST /register: inoltro al server con l'IP del nodo in ?ip= e
+ *    5.03 finche' il server non risponde. Il tentativo successivo del nodo
+ *    riceve l'esito: 2.04, l'errore del server o 5.04 se il server non ha
+ *    risposto. Quando il server conferma una registrazione
+ *    nuova o cambiata (crc16 del payload), le voci con le sue risorse o il
+ *    suo IP si invalidano; i semplici rinnovi non toccano la cache.
+ */
+#ifndef RES_CACHE_H_
+#define RES_CACHE_H_
+
+#include "contiki.h"
+
+#ifdef BR_CACHE_CONF_ENABLED
+#define BR_CACHE_ENABLED BR_CACHE_CONF_ENABLED
+#else
+#define BR_CACHE_ENABLED 0
+#endif
+
+#ifdef BR_CACHE_CONF_SERVER
+#define BR_CACHE_SERVER BR_CACHE_CONF_SERVER
+#else
+#define BR_CACHE_SERVER "coap://[fd00::1]:5683"
+#endif
+
+/* Validita' delle lookup in cache (s): meno del lifetime delle registrazioni (600 s) */
+#ifdef BR_CACHE_CONF_TTL
+#define BR_CACHE_TTL BR_CACHE_CONF_TTL
+#else
+#define BR_CACHE_TTL 300
+#endif
+#ifdef BR_CACHE_CONF_NEG_TTL
+#define BR_CACHE_NEG_TTL BR_CACHE_CONF_NEG_TTL
+#else
+#define BR_CACHE_NEG_TTL 10
+#endif
+
+/* Risincronizzazione dell'orario del server (s) */
+#ifdef BR_CACHE_CONF_TIME_REFRESH
+#define BR_CACHE_TIME_REFRESH BR_CACHE_CONF_TIME_REFRESH
+#else
+#define BR_CACHE_TIME_REFRESH 3600
+#endif
+
+/* Voci di lookup, richieste in inoltro al server e nodi registrati ricordati.
+ * Ogni nodo chiede tutte le sue destinazioni con una sola query: basta una
+ * voce per tipo di nodo (edge, roof, power) */
+#ifdef BR_CACHE_CONF_ENTRIES
+#define BR_CACHE_ENTRIES BR_CACHE_CONF_ENTRIES
+#else
+#define BR_CACHE_ENTRIES 4
+#endif
+#ifdef BR_CACHE_CONF_PENDING
+#define BR_CACHE_PENDING BR_CACHE_CONF_PENDING
+#else
+#define BR_CACHE_PENDING 4
+#endif
+#ifdef BR_CACHE_CONF_NODES
+#define BR_CACHE_NODES BR_CACHE_CONF_NODES
+#else
+#define BR_CACHE_NODES 16
+#endif
+
+/* Attiva /register e /lookup e sincronizza l'orario */
+PROCESS_NAME(cache_process);
+
+#endif /* RES_CACHE_H_ */
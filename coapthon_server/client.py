@@ -1,8 +1,10 @@
 import json
+from coapthon import defines
 from coapthon.client.helperclient import HelperClient
 
 SERVER_IP = "fd00::1"
 SERVER_PORT = 5683
+MODEL_BLOCK_SIZE = 64  # blocchi Block1 dell'upload modelli (<= REST_MAX_CHUNK_SIZE dei nodi)
 
 
 # Funzioni per interagire con il server CoAP
@@ -33,6 +35,26 @@ def send_put(ip, resource, payload):
     else:
         print("Nessuna risposta")
 
+# Funzione per caricare un blob di tools/model_blob.py su /model/<nome> con PUT block-wise
+def upload_model(ip, resource, blob):
+    print(f"[PUT] Upload di {len(blob)} byte su {resource} del nodo [{ip}], blocchi da {MODEL_BLOCK_SIZE}")
+    client = HelperClient(server=(ip, SERVER_PORT))
+    try:
+        request = client.mk_request(defines.Codes.PUT, resource)
+        request.content_type = defines.Content_types["application/octet-stream"]
+        request.payload = blob
+        request.block1 = (0, 1, MODEL_BLOCK_SIZE)  # il block layer di CoAPthon invia i blocchi successivi
+        response = client.send_request(request, timeout=60)
+    finally:
+        client.stop()
+
+    # 2.04 solo dopo l'ultimo blocco, con il blob verificato dal nodo
+    if response:
+        print("Risposta:", response.code)
+        return response.code == defines.Codes.CHANGED.number
+    print("Nessuna risposta")
+    return False
+
 # Funzione per inviare una richiesta GET 
 def coap_get(ip: str, resource: str):
     client = HelperClient(server=(ip, SERVER_PORT))
@@ -42,6 +64,26 @@ def coap_get(ip: str, resource: str):
         client.stop()
     return resp.payload if resp else None
 
+# Funzione per stampare il profilo dell'inferenza di un nodo (/res_prof, tick convertiti in us)
+def print_profile(ip):
+    payload = coap_get(ip, "res_prof")
+    if not payload:
+        print("Nessun profilo (nodo senza MLP_PROF_CONF_ENABLED?)")
+        return
+    try:
+        data = json.loads(payload)
+    except Exception as e:
+        print("Errore parsing JSON:", e)
+        return
+
+    hz, ehz = data.pop("hz"), data.pop("ehz")
+    us = lambda t, f=hz: round(t * 1e6 / f) if f else "-"
+    for name, prof in data.items():
+        print(f"\n{name}: {prof['n']} inferenze (us: min / media / max / p99 / cpu media)")
+        rows = [("totale", prof["tot"])] + [(f"layer {i}", s) for i, s in enumerate(prof["l"])]
+        for label, (mn, avg, mx, p99, cpu) in rows:
+            print(f"  {label:8} {us(mn):>7} {us(avg):>7} {us(mx):>7} {us(p99):>7} {us(cpu, ehz):>7}")
+
 # Funzioni per ottenere informazioni sullo stato della furnace
 def get_furnace_state():
     ip = lookup_resource("/res_furnace")
@@ -109,6 +151,9 @@ def main():
         print("8. Modifica minima accensione giornaliera")
         print("9. Imposta orario di carico")
         print("10. Info System")
+        print("11. Aggiorna modello (next_power, next_solar, fused)")
+        print("12. Profilo inferenza di un nodo")
+        print("13. Telemetria a batch dell'edge")
         print("0. Esci")
 
         scelta = input("Seleziona comando: ").strip()
@@ -235,6 +280,62 @@ def main():
                 print("Starvation → ? (no data)")
 
             print("\n====================")
+
+        elif scelta == "11":
+            name = input("Modello (next_power, next_solar, fused): ").strip()
+            resource = f"model/{name}"
+            ip = lookup_resource(f"/{resource}")
+            if not ip:
+                print("Nessun nodo espone", resource)
+                continue
+            try:
+                with open(input("File del blob: ").strip(), "rb") as f:
+                    blob = f.read()
+            except OSError as e:
+                print("File non leggibile:", e)
+                continue
+            if upload_model(ip, resource, blob):
+                # Il nodo attiva il modello alla prossima inferenza
+                print("Stato modello:", coap_get(ip, resource))
+            else:
+                print("Upload rifiutato (versione non successiva, forma o crc non validi)")
+
+        elif scelta == "12":
+            # Default: l'edge, trovato tramite /res_threshold; per il roof indicare l'IP
+            ip = input("IP del nodo (invio = edge): ").strip() or lookup_resource("/res_threshold")
+            if not ip:
+                print("Nodo edge non trovato.")
+                continue
+            print_profile(ip)
+
+        elif scelta == "13":
+            ip = lookup_resource("/res_batch")
+            if not ip:
+                print("Nodo edge non trovato.")
+                continue
+            stato = coap_get(ip, "res_batch")
+            print("Stato batch:", stato)
+            try:
+                s = json.loads(stato)
+                if s.get("jin"):
+                    # Journal su flash (edge compilato con make JOURNAL=1)
+                    print(f"Journal: {s['jdepth']} record da recuperare, {s['jin']} scritti, "
+                          f"{s['jout']} recuperati, {s['jlost']} scartati, recupero a {s['jrate']} record/min")
+            except (TypeError, ValueError):
+                pass
+            # Invio = valore invariato; size 1 = un POST per ciclo su /res_data e /res_prediction
+            update = {}
+            for key, label in (("size", "Record per invio (1-16)"), ("delay", "Attesa massima in secondi (1-3600)")):
+                value = input(f"{label}, invio = invariato: ").strip()
+                if value:
+                    try:
+                        update[key] = int(value)
+                    except ValueError:
+                        print("Valore non valido.")
+                        update = None
+                        break
+            if update:
+                send_put(ip, "res_batch", update)
         else:
             print("Comando non riconosciuto.")
 
@@ -7,8 +7,9 @@ class Database:
     def __init__(self):
         return
 
-    # Esegue il reset del database, creando un nuovo database chiamato "iot"
-    def reset_database(self):
+    # Esegue il reset del database "iot": le tabelle delle misure ripartono vuote, quelle in keep
+    # (la resource directory) restano e vengono ricaricate dal server all'avvio
+    def reset_database(self, keep=("nodes",)):
         
         # Crea una connessione al database MySQL
         connection = pymysql.connect(
@@ -18,10 +19,12 @@ class Database:
             cursorclass=pymysql.cursors.DictCursor
         )
         with connection.cursor() as cursor:
-            cursor.execute("DROP DATABASE IF EXISTS iot")
-            print("Database 'iot' eliminato.")
-            cursor.execute("CREATE DATABASE iot")
-            print("Database 'iot' creato.")
+            cursor.execute("CREATE DATABASE IF NOT EXISTS iot")
+            cursor.execute("SELECT table_name AS name FROM information_schema.tables WHERE table_schema = 'iot'")
+            for row in cursor.fetchall():
+                if row["name"] not in keep:
+                    cursor.execute("DROP TABLE iot.`%s`" % row["name"])
+            print("Database 'iot' azzerato, tabelle mantenute:", ", ".join(keep))
             connection.commit()
         connection.close()
 
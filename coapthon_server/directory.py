@@ -0,0 +1,124 @@
+# Resource directory in memoria per /register e /lookup: indice per risorsa e per nodo,
+# quindi lookup in tempo costante anche con centinaia di nodi, e registrazioni con
+# lifetime che scadono se il nodo non le rinnova con una nuova POST /register.
+import heapq
+import threading
+import time
+from collections import OrderedDict
+
+DEFAULT_LIFETIME = 600  # secondi, se la registrazione non porta "lt" (i nodi rinnovano ogni 300 s)
+MIN_LIFETIME = 60
+MAX_LIFETIME = 86400
+
+
+class ResourceDirectory:
+    def __init__(self, on_change=None, clock=time.monotonic):
+        self.on_change = on_change  # on_change(aggiunte, rimosse): righe (node_id, ip, risorsa, ct) e (ip, risorsa)
+        self._clock = clock
+        self._lock = threading.Lock()
+        self._nodes = {}        # ip -> {"id", "ip", "resources": {risorsa: ct}, "expires"}
+        self._by_resource = {}  # risorsa -> OrderedDict ip -> None, il nodo registrato per ultimo in fondo
+        self._expiry = []       # heap (scadenza, ip); le voci superate da un rinnovo si ignorano
+
+    @staticmethod
+    def clamp_lifetime(lt):
+        if lt is None:
+            return DEFAULT_LIFETIME
+        return max(MIN_LIFETIME, min(MAX_LIFETIME, int(lt)))
+
+    # Registra o rinnova il nodo ip. resources: {risorsa: ct}, ct None = solo JSON.
+    # lifetime None = non scade (risorse del server)
+    def register(self, node_id, ip, resources, lifetime=DEFAULT_LIFETIME):
+        with self._lock:
+            now = self._clock()
+            removed = self._sweep(now)
+            old = self._nodes.get(ip)
+            old_res = old["resources"] if old else {}
+            expires = None if lifetime is None else now + lifetime
+
+            added = [(node_id, ip, res, ct) for res, ct in resources.items()
+                     if res not in old_res or old_res[res] != ct or old["id"] != node_id]
+            for res in old_res:
+                if res not in resources:
+                    self._unindex(res, ip)
+                    removed.append((ip, res))
+
+            self._nodes[ip] = {"id": node_id, "ip": ip, "resources": dict(resources), "expires": expires}
+            for res in resources:
+                index = self._by_resource.setdefault(res, OrderedDict())
+                index[ip] = None
+                index.move_to_end(ip)
+            if expires is not None:
+                heapq.heappush(self._expiry, (expires, ip))
+            refreshed = old is not None
+        self._notify(added, removed)
+        return refreshed
+
+    # Righe salvate (node_id, ip, risorsa, ct) ricaricate all'avvio. I nodi non gia' presenti
+    # ripartono con un lifetime pieno: se non rinnovano entro lifetime scadono come gli altri
+    def load(self, rows, lifetime=DEFAULT_LIFETIME):
+        saved = {}
+        for node_id, ip, res, ct in rows:
+            saved.setdefault(ip, (node_id, {}))[1][res] = ct
+        with self._lock:
+            saved = {ip: node for ip, node in saved.items() if ip not in self._nodes}
+        for ip, (node_id, resources) in saved.items():
+            self.register(node_id, ip, resources, lifetime)
+        return len(saved)
+
+    # Nodo vivo che espone res (il registrato per ultimo): {"ip", "ct"} oppure None
+    def lookup(self, res):
+        return self.lookup_many([res])[res]
+
+    # Una risposta per piu' risorse: {risorsa: {"ip", "ct"} oppure None}
+    def lookup_many(self, resources):
+        with self._lock:
+            removed = self._sweep(self._clock())
+            found = {}
+            for res in resources:
+                index = self._by_resource.get(res)
+                if not index:
+                    found[res] = None
+                    continue
+                ip = next(reversed(index))
+                found[res] = {"ip": ip, "ct": self._nodes[ip]["resources"][res]}
+        self._notify([], removed)
+        return found
+
+    # Righe correnti, per il salvataggio iniziale
+    def rows(self):
+        with self._lock:
+            return [(n["id"], ip, res, ct) for ip, n in self._nodes.items() for res, ct in n["resources"].items()]
+
+    def stats(self):
+        with self._lock:
+            return {"nodes": len(self._nodes), "resources": len(self._by_resource)}
+
+    # Rimuove i nodi scaduti, in ordine di scadenza: costo proporzionale ai soli scaduti
+    def _sweep(self, now):
+        removed = []
+        while self._expiry and self._expiry[0][0] <= now:
+            expires, ip = heapq.heappop(self._expiry)
+            node = self._nodes.get(ip)
+            if node is None or node["expires"] != expires:
+                continue  # rinnovato dopo questa voce
+            print(f"[RD] Registrazione di {node['id']} [{ip}] scaduta")
+            for res in node["resources"]:
+                self._unindex(res, ip)
+                removed.append((ip, res))
+            del self._nodes[ip]
+        return removed
+
+    def _unindex(self, res, ip):
+        index = self._by_resource.get(res)
+        if index is not None:
+            index.pop(ip, None)
+            if not index:
+                del self._by_resource[res]
+
+    def _notify(self, added, removed):
+        if self.on_change and (added or removed):
+            try:
+                self.on_change(added, removed)
+            except Exception as e:
+                print("[RD ERROR - persistenza]", e)
@@ -0,0 +1,72 @@
+# Decoder SenML-CBOR (RFC 8428, Content-Format 112) per i messaggi inviati dai nodi
+# in formato binario (msg/msg_cbor.c): solo il sottoinsieme di CBOR che serve,
+# senza dipendenze esterne.
+import struct
+
+CONTENT_FORMAT = 112
+
+# Etichette SenML-CBOR
+BN, BT, BV, N, V = -2, -3, -5, 0, 2
+
+
+class _Reader:
+    def __init__(self, raw):
+        self.raw = bytes(raw)
+        self.pos = 0
+
+    def take(self, n):
+        if self.pos + n > len(self.raw):
+            raise ValueError("CBOR troncato")
+        chunk = self.raw[self.pos:self.pos + n]
+        self.pos += n
+        return chunk
+
+    def item(self):
+        head = self.take(1)[0]
+        major, info = head >> 5, head & 0x1f
+        if info < 24:
+            arg = info
+        elif info <= 27:
+            raw = self.take(1 << (info - 24))
+            if major == 7:
+                return {25: lambda b: struct.unpack(">e", b)[0],
+                        26: lambda b: struct.unpack(">f", b)[0],
+                        27: lambda b: struct.unpack(">d", b)[0]}.get(info, lambda b: b[0])(raw)
+            arg = int.from_bytes(raw, "big")
+        else:
+            raise ValueError("lunghezze indefinite non supportate")
+
+        if major == 0:
+            return arg
+        if major == 1:
+            return -1 - arg
+        if major == 2:
+            return self.take(arg)
+        if major == 3:
+            return self.take(arg).decode("utf-8")
+        if major == 4:
+            return [self.item() for _ in range(arg)]
+        if major == 5:
+            return dict((self.item(), self.item()) for _ in range(arg))
+        if major == 6:
+            return self.item()  # tag ignorato
+        return {20: False, 21: True, 22: None}.get(arg)
+
+
+def decode(raw):
+    '''Record SenML -> (dizionario nome: valore, base time o None).
+
+    I nomi sono quelli dei record, senza base name; bv viene sommato ai valori.
+    '''
+    records = _Reader(raw).item()
+    if not isinstance(records, list):
+        raise ValueError("SenML: atteso un array di record")
+    values, bt, bv = {}, None, 0
+    for rec in records:
+        if not isinstance(rec, dict):
+            raise ValueError("SenML: record non valido")
+        bt = rec.get(BT, bt)
+        bv = rec.get(BV, bv)
+        if N in rec and V in rec:
+            values[rec[N]] = rec[V] + bv
+    return values, bt
@@ -9,12 +9,14 @@ from database.db import Database
 from datetime import datetime, timezone
 import json
 import math
+import senml
+from directory import ResourceDirectory
 
 DB = Database()     # istanza del database, per evitare di ricrearlo ogni volta
 
 
-# Struttura in memoria per registrazioni
-registered_nodes = []  # lista di dizionari con chiavi: id, ip, resource
+# Resource directory in memoria per /register e /lookup (directory.py), salvata su MySQL a ogni modifica
+directory = ResourceDirectory()
 
 # Variabili per il controllo della furnace
 history_vector = [0]*24 # Vettore per tenere traccia dello stato della furnace nelle ultime 24 ore
@@ -26,21 +28,21 @@ max_reached = 0  # Flag per indicare se il massimo di ore accese è stato raggiu
 
 # Observable var
 furnace_status = None
+forecast_vector = None  # Consumo previsto dall'edge per le 24 ore successive a forecast_hour (/res_forecast)
+forecast_hour = None
+solar_forecast = [0] * 24  # Produzione prevista per ora del giorno: nextSolar dell'ultimo campione dell'ora precedente
+last_data = None  # (time_sec, ora) dell'ultimo /res_data, per abbinare il /res_prediction dello stesso campione
 ctrl_prediction = 1
 last_edge_ctrl = 1  # Stato del controllo automatico della furnace prima di disabilitarlo
 
 
-# Inserisco /res_data e /res_prediction come risorse disponibili
-registered_nodes.append({
-    "id": "server",
-    "ip": "fd00::1",
-    "resource": "/res_data"
-})
-registered_nodes.append({
-    "id": "server",
-    "ip": "fd00::1",
-    "resource": "/res_prediction"
-})
+# Risorse del server, senza scadenza
+# ct: Content-Format binario accettato oltre al JSON, restituito dalla lookup
+directory.register("server", "fd00::1", {
+    "/res_data": senml.CONTENT_FORMAT,
+    "/res_prediction": senml.CONTENT_FORMAT,
+    "/res_bulk": None
+}, lifetime=None)
 
 # === /res_data ===
 class ResData(Resource):
@@ -51,36 +53,40 @@ class ResData(Resource):
         conn = self.db.connect_db()
         cursor = conn.cursor()
 
-        # la tabella viene creata una sola volta nel costruttore
+        # la tabella viene creata una sola volta nel costruttore. Un record per istante:
+        # i batch ripetuti dopo una risposta persa non duplicano le righe (INSERT IGNORE)
         cursor.execute('''
             CREATE TABLE IF NOT EXISTS res_data (
                 id INT AUTO_INCREMENT PRIMARY KEY,
                 time_sec BIGINT UNSIGNED,
                 solar FLOAT, mese INT, ora INT,
-                temperature FLOAT, humidity FLOAT, power FLOAT
+                temperature FLOAT, humidity FLOAT, power FLOAT,
+                UNIQUE KEY time_sec (time_sec)
             )
         ''')
         conn.commit()
         
     # Metodo che gestisce le richieste POST alla risorsa /res_data: riceve i dati dal nodo, li salva nel database e aggiorna il controllo anti-starvation della furnace.
     def render_POST(self, request):
+        global last_data
         
         try:
-            data = json.loads(request.payload)
-            print("[/res_data] Dati ricevuti")
+            data = read_payload(request)
+            print("[/res_data] Dati ricevuti (%s)" % payload_info(request))
             # print("[/res_data] Ricevuto:", data)
 
             # Inserimento dati nel database
             conn = self.db.connect_db()
             cursor = conn.cursor()
             cursor.execute('''
-                INSERT INTO res_data (time_sec, solar, mese, ora, temperature, humidity, power)
+                INSERT IGNORE INTO res_data (time_sec, solar, mese, ora, temperature, humidity, power)
                 VALUES (%s, %s, %s, %s, %s, %s, %s)
             ''', (
                 to_epoch_seconds(data["ts"]), data["sol"], data["mese"], data["ora"],
                 data["temp"], data["hum"], data["pow"]
             ))
             conn.commit()
+            last_data = (to_epoch_seconds(data["ts"]), data["ora"])
 
             # Controllo per evitare la starvation della furnace
             avoid_starvation(data["ora"])
@@ -114,7 +120,8 @@ class ResPrediction(Resource):
                 id INT AUTO_INCREMENT PRIMARY KEY,
                 time_sec BIGINT UNSIGNED,
                 next_power FLOAT, next_solar FLOAT,
-                missing INT
+                missing INT,
+                UNIQUE KEY time_sec (time_sec)
             )
         ''')
         conn.commit()
@@ -123,20 +130,23 @@ class ResPrediction(Resource):
     def render_POST(self, request):
         
         try:
-            data = json.loads(request.payload)
-            print("[/res_prediction] Dati ricevuti")
+            data = read_payload(request)
+            print("[/res_prediction] Dati ricevuti (%s)" % payload_info(request))
             # print("[/res_prediction] Ricevuto:", data)
 
             # Inserimento dati nel database
             conn = self.db.connect_db()
             cursor = conn.cursor()
             cursor.execute('''
-                INSERT INTO res_prediction (time_sec, next_power, next_solar, missing)
+                INSERT IGNORE INTO res_prediction (time_sec, next_power, next_solar, missing)
                 VALUES (%s, %s, %s, %s)
             ''', (
                 to_epoch_seconds(data["ts"]), data["nPow"], data["nSol"], data["miss"]
             ))
             conn.commit()
+            # L'edge invia /res_data e poi /res_prediction con lo stesso ts
+            if last_data is not None and last_data[0] == to_epoch_seconds(data["ts"]):
+                note_solar(last_data[1], data["nSol"])
 
             self.payload = "OK"
         except Exception as e:
@@ -151,6 +161,76 @@ class ResPrediction(Resource):
                 except Exception: pass
         return self
 
+# === /res_bulk ===
+# Colonne delle righe del batch dell'edge (edge/resources/res_batch.h): t e' relativo a bt
+BULK_COLUMNS = ("t", "sol", "mese", "ora", "temp", "hum", "pow", "nPow", "nSol", "miss")
+
+class ResBulk(Resource):
+    def __init__(self, name="res_bulk", coap_server=None):
+        super(ResBulk, self).__init__(name, coap_server)
+        self.payload = "{}"
+        self.db = DB
+
+    # Gestisce POST su /res_bulk: tutti i record del batch in res_data e res_prediction con una sola transazione.
+    # Un batch ripetuto (risposta persa) non duplica le righe: time_sec e' unico e l'insert ignora i doppioni.
+    # I batch di recupero dal journal ("replay":1) portano dati vecchi e non passano dalla logica di controllo
+    def render_POST(self, request):
+        conn = cursor = None
+        newest = None
+        try:
+            data = json.loads(request.payload)
+            bt = to_epoch_seconds(data["bt"])
+            replay = bool(data.get("replay", 0))
+            rows = [dict(zip(BULK_COLUMNS, row)) for row in data["rows"]]
+            if not rows or any(len(r) != len(BULK_COLUMNS) for r in rows):
+                raise ValueError("righe del batch non valide")
+            print("[/res_bulk] %s ricevuto: %d record, %s" % ("Recupero" if replay else "Batch", len(rows),
+                                                              payload_info(request)))
+
+            conn = self.db.connect_db()
+            cursor = conn.cursor()
+            cursor.executemany('''
+                INSERT IGNORE INTO res_data (time_sec, solar, mese, ora, temperature, humidity, power)
+                VALUES (%s, %s, %s, %s, %s, %s, %s)
+            ''', [(bt + r["t"], r["sol"], r["mese"], r["ora"], r["temp"], r["hum"], r["pow"]) for r in rows])
+            cursor.executemany('''
+                INSERT IGNORE INTO res_prediction (time_sec, next_power, next_solar, missing)
+                VALUES (%s, %s, %s, %s)
+            ''', [(bt + r["t"], r["nPow"], r["nSol"], r["miss"]) for r in rows])
+            conn.commit()
+            if not replay:
+                newest = max(rows, key=lambda r: r["t"])
+                for r in sorted(rows, key=lambda r: r["t"]):
+                    note_solar(r["ora"], r["nSol"])
+
+            self.code = defines.Codes.CHANGED.number
+            self.payload = "OK"
+        except Exception as e:
+            print("[ERROR /res_bulk]", e)
+            if conn and conn.open:
+                try: conn.rollback()
+                except Exception: pass
+            self.code = defines.Codes.BAD_REQUEST.number if isinstance(e, (ValueError, KeyError, TypeError)) \
+                else defines.Codes.INTERNAL_SERVER_ERROR.number
+            self.payload = "ERROR"
+        finally:
+            if cursor:
+                try: cursor.close()
+                except Exception: pass
+            if conn and conn.open:
+                try: conn.close()
+                except Exception: pass
+
+        # Anti-starvation una volta per batch, sull'ora del record piu' recente, dopo il commit: un suo
+        # errore non cambia la risposta 2.04, altrimenti l'edge reinvierebbe righe gia' salvate
+        if newest is not None:
+            try:
+                avoid_starvation(newest["ora"])
+            except Exception as e:
+                print("[ERROR /res_bulk anti-starvation]", e)
+        return self
+
+
 # === /register ===
 class RegisterResource(Resource):
     def __init__(self, name="register", coap_server=None):
@@ -160,24 +240,51 @@ class RegisterResource(Resource):
         conn = self.db.connect_db()
         cursor = conn.cursor()
 
-        # creazione tabella spostata nel costruttore
+        # creazione tabella spostata nel costruttore: una riga per (nodo, risorsa)
         cursor.execute('''
             CREATE TABLE IF NOT EXISTS nodes (
                         id INT AUTO_INCREMENT PRIMARY KEY,
                         node_id VARCHAR(64) NOT NULL,
                         node_ip VARCHAR(64) NOT NULL,
-                        resource VARCHAR(64) NULL
+                        resource VARCHAR(64) NULL,
+                        ct INT NULL,
+                        UNIQUE KEY node_resource (node_ip, resource)
             )
         ''')
-
-        # inserisci le due risorse iniziali
-        resources = ["/res_data", "/res_prediction"]
-        for res in resources:
-            cursor.execute(
-                "INSERT INTO nodes (node_id, node_ip, resource) VALUES (%s, %s, %s)",
-                ("server", "fd00::1", res)
-            )
         conn.commit()
+        cursor.execute("SELECT node_id, node_ip, resource, ct FROM nodes")
+        saved = [(r["node_id"], r["node_ip"], r["resource"], r["ct"]) for r in cursor.fetchall()]
+        conn.close()
+
+        # Nodi registrati prima del riavvio: di nuovo nelle lookup, con un lifetime pieno per rinnovare
+        loaded = directory.load(saved)
+        if loaded:
+            print(f"[RD] {loaded} nodi ricaricati dalla tabella nodes")
+
+        # Da qui la tabella segue la directory: solo le righe aggiunte, cambiate o scadute.
+        # All'avvio si salvano solo le differenze, cioe' le risorse del server se sono cambiate
+        directory.on_change = self.persist
+        current = directory.rows()
+        keys = {(ip, res) for _, ip, res, _ in current}
+        self.persist([r for r in current if r not in saved],
+                     [(ip, res) for _, ip, res, _ in saved if (ip, res) not in keys])
+
+    # Salvataggio incrementale della directory: upsert delle righe nuove, delete di quelle rimosse
+    def persist(self, added, removed):
+        conn = self.db.connect_db()
+        try:
+            with conn.cursor() as cursor:
+                if added:
+                    cursor.executemany('''
+                        INSERT INTO nodes (node_id, node_ip, resource, ct)
+                        VALUES (%s, %s, %s, %s)
+                        ON DUPLICATE KEY UPDATE node_id = VALUES(node_id), ct = VALUES(ct)
+                    ''', added)
+                if removed:
+                    cursor.executemany("DELETE FROM nodes WHERE node_ip = %s AND resource = %s", removed)
+            conn.commit()
+        finally:
+            conn.close()
 
     # Gestisce le richieste POST su /register per registrare un nodo nel db e nella memoria
     def render_POST(self, request):
@@ -193,53 +300,36 @@ class RegisterResource(Resource):
                 self.payload = ""
                 return self
 
+            # Register inoltrata dalla cache del border router: l'IP del nodo e' in ?ip=
             ip = request.source[0]
+            for param in (request.uri_query or "").split("&"):
+                if param.startswith("ip=") and len(param) > 3:
+                    ip = param[3:]
             resources = data.get("resources", [])
-
-            if not isinstance(resources, list):
+            # Formato binario accettato: "cbor" elenca le risorse che accettano anche
+            # SenML-CBOR, oltre a quelle in "resources"; un "ct" numerico vale per tutte
+            # le risorse (registrazioni dei nodi precedenti)
+            cbor = data.get("cbor", [])
+            ct = data.get("ct")
+
+            if not isinstance(resources, list) or not isinstance(cbor, list) or \
+                    not isinstance(ct, (int, type(None))):
                 self.code = defines.Codes.BAD_REQUEST.number
                 self.payload = ""
                 return self
 
-            # Verifica se il nodo (IP) è già registrato
-            already_registered = any(entry["ip"] == ip for entry in registered_nodes)
-
-            # Se il nodo non è già registrato, lo aggiungo alla lista
-            if not already_registered:
-                if resources:
-                    for res in resources:
-                        registered_nodes.append({
-                            "id": node_id,
-                            "ip": ip,
-                            "resource": res
-                        })
-                        
-                else:
-                    registered_nodes.append({
-                        "id": node_id,
-                        "ip": ip,
-                        "resource": None
-                    })
-                print(f"[*] Nodo {node_id} registrato da IP {ip}")
-
-                # Inserimento nel database
-                conn = self.db.connect_db()
-                cursor = conn.cursor()
-                for res in resources:
-                    cursor.execute('''
-                            INSERT INTO nodes (node_id, node_ip, resource)
-                            VALUES (%s, %s, %s)
-                        ''', (
-                                node_id, ip, res
-                        ))
-                conn.commit()
-
+            # Prima registrazione o rinnovo: la directory scade dopo lt secondi senza rinnovo
+            lifetime = ResourceDirectory.clamp_lifetime(data.get("lt"))
+            cts = {res: ct for res in resources if res}
+            cts.update({res: senml.CONTENT_FORMAT for res in cbor if res})
+            refreshed = directory.register(node_id, ip, cts, lifetime)
+            if refreshed:
+                print(f"[*] Nodo {node_id} da IP {ip}: registrazione rinnovata per {lifetime} s")
             else:
-                print(f"[!] Nodo già registrato da IP {ip}, registrazione ignorata.")
-
-            print("[MEMORIA] Stato attuale:")
-            for entry in registered_nodes:
-                print("  -", entry)
+                print(f"[*] Nodo {node_id} registrato da IP {ip} per {lifetime} s")
+            print("[RD] Stato attuale:", directory.stats())
+            self.code = defines.Codes.CHANGED.number
+            self.payload = ""
         except json.JSONDecodeError:
             self.code = defines.Codes.BAD_REQUEST.number
             self.payload = ""
@@ -247,13 +337,6 @@ class RegisterResource(Resource):
             print("[ERROR /register]", e)
             self.code = defines.Codes.INTERNAL_SERVER_ERROR.number
             self.payload = ""
-        finally:
-            if cursor:
-                try: cursor.close()
-                except Exception: pass
-            if conn and conn.open:          # chiudi solo se davvero viva
-                try: conn.close()
-                except Exception: pass
         return self
     
     # Gestisce le richieste GET su /register per sincronizzare il timestamp
@@ -279,77 +362,52 @@ class LookupResource(Resource):
         self.payload = "{}"
         self.db = DB
         
-    # Gestisce le richieste GET su /lookup per cercare l'IP di una risorsa registrata
+    # Gestisce le richieste GET su /lookup per cercare l'IP di una risorsa registrata.
+    # ?res=/a restituisce {"ip", "ct"}; ?res=/a,/b,/c una sola risposta {"/a": {"ip", "ct"}, "/b": null, ...}
     def render_GET(self, request):
         try:
-            self.code = 0.00  # Inizializzo
+            resources = []
             query = request.uri_query
-            resource_requested = None
-
-            query = request.uri_query 
-            resource_requested = None
 
             if query:
                 for param in query.split("&"):
                     if param.startswith("res="):
-                        resource_requested = param.split("=", 1)[1]
+                        resources = [r.strip() for r in param.split("=", 1)[1].split(",") if r.strip()]
                         break
 
             # Se il parametro res è assente o vuoto
-            if resource_requested is None or resource_requested.strip() == "":
+            if not resources:
                 self.code = defines.Codes.BAD_REQUEST.number  # 4.00
                 self.payload = ""
                 print("[DEBUG] Risorsa richiesta non specificata")
                 return self
 
-            # Cerca la risorsa tra i nodi registrati
-            print(f"[DEBUG] Risorsa richiesta: {resource_requested}")
-            for entry in registered_nodes:
-                
-                if entry["resource"] == resource_requested:
-                    # Risorsa trovata, restituisci l'IP
-                    self.code = defines.Codes.CONTENT.number  # 2.05
-                    self.payload = json.dumps({
-                        "ip": entry["ip"]
-                    })
-                    print("[DEBUG] Risorsa trovata!")
-                    return self
-
-            # Cerca la risorsa tra i nodi registrati sul db
-            # conn = self.db.connect_db()
-            # cursor = conn.cursor()
-            # cursor.execute('''
-            #     SELECT node_ip FROM nodes WHERE resource = %s
-            # ''', (resource_requested,))
-            # result = cursor.fetchone()
-            
-            # print(f"[DEBUG] Risorsa richiesta: {resource_requested} | Risultato DB: {result}")
-
-            # if result:
-            #     self.code = defines.Codes.CONTENT.number  # 2.05
-            #     self.payload = json.dumps({
-            #         "ip": result[0]
-            #     })
-            #     print("[DEBUG] Risorsa trovata nel DB!")
-            # else:
-            #     # Risorsa non trovata
-            #     print("[DEBUG] Risorsa NON trovata nel DB")
-            #     self.code = defines.Codes.NOT_FOUND.number
-            #     self.payload = ""
-            
+            print(f"[DEBUG] Risorse richieste: {resources}")
+            found = directory.lookup_many(resources)
+            if not any(found.values()):
+                self.code = defines.Codes.NOT_FOUND.number  # 4.04
+                self.payload = ""
+                return self
+
+            self.code = defines.Codes.CONTENT.number  # 2.05
+            self.content_type = defines.Content_types["application/json"]
+            # JSON compatto: la risposta per tutte le destinazioni dell'edge sta nella cache del root (256 byte)
+            if len(resources) == 1:
+                self.payload = json.dumps(self.entry(found[resources[0]]), separators=(",", ":"))
+            else:
+                self.payload = json.dumps({res: self.entry(e) if e else None for res, e in found.items()},
+                                          separators=(",", ":"))
         except Exception as e:
             print("[ERROR /lookup]", e)
             self.code = defines.Codes.INTERNAL_SERVER_ERROR.number  # 5.00
             self.payload = ""
-        # finally:
-        #     if cursor:
-        #         try: cursor.close()
-        #         except Exception: pass
-        #     if conn and conn.open:          # chiudi solo se davvero viva
-        #         try: conn.close()
-        #         except Exception: pass
         return self
 
+    # ct solo se la risorsa accetta un formato binario
+    @staticmethod
+    def entry(found):
+        return {"ip": found["ip"], "ct": found["ct"]} if found["ct"] else {"ip": found["ip"]}
+
 # === /starving ===
 class StarvationResource(Resource):
     def __init__(self, name="StarvationResource", coap_server=None):
@@ -432,15 +490,14 @@ def watch_furnace_resource():
     print("[*] In attesa che /res_furnace venga registrata...")
 
     while True:
-        for entry in registered_nodes:
-            if entry["resource"] == "/res_furnace":
-                ip = entry["ip"]
-                print(f"[✓] Trovata /res_furnace su nodo [{ip}] Avvio osservazione")
-                observe_remote_furnace(ip)
-
-                # Avvio il logger per lo stato della furnace
-                threading.Thread(target=start_furnace_logger, daemon=True).start()
-                return
+        ip = get_ip("/res_furnace")
+        if ip:
+            print(f"[✓] Trovata /res_furnace su nodo [{ip}] Avvio osservazione")
+            observe_remote_furnace(ip)
+
+            # Avvio il logger per lo stato della furnace
+            threading.Thread(target=start_furnace_logger, daemon=True).start()
+            return
         time.sleep(2)  # Ricontrolla ogni 2 secondi
 
 # Funzione che avvia il logger per registrare lo stato della furnace periodicamente
@@ -525,16 +582,219 @@ def watch_threshold_resource():
     print("[*] In attesa che /res_threshold venga registrata...")
 
     while True:
-        for entry in registered_nodes:
-            if entry["resource"] == "/res_threshold":
-                ip = entry["ip"]
-                print(f"[✓] Trovata /res_threshold su nodo [{ip}] Avvio osservazione")
-                observe_remote_threshold(ip)
-                return  # termina il thread una volta avviata l’osservazione
+        ip = get_ip("/res_threshold")
+        if ip:
+            print(f"[✓] Trovata /res_threshold su nodo [{ip}] Avvio osservazione")
+            observe_remote_threshold(ip)
+            return  # termina il thread una volta avviata l’osservazione
         time.sleep(2)
 
 
 
+# Funzione di callback per le notifiche della risorsa /res_forecast
+def forecast_callback(response):
+    global forecast_vector, forecast_hour
+    payload = response.payload
+    if isinstance(payload, bytes):
+        payload = payload.decode("utf-8")
+
+    try:
+        data = json.loads(payload)
+
+        if "fc" in data and len(data["fc"]) == 24:
+            forecast_vector = [int(v) for v in data["fc"]]
+            forecast_hour = int(data["ora"])
+            print(f"[NOTIFICA] Forecast 24h dalle ore {forecast_hour}: {forecast_vector}")
+        else:
+            print("[!] JSON senza forecast a 24 ore:", data)
+
+    except Exception as e:
+        print("[!] Payload sconosciuto:", response.payload, "| errore:", e)
+
+
+# Funzione per iscriversi alla risorsa osservabile /res_forecast
+def observe_remote_forecast(ip):
+    print(f"[*] Mi iscrivo alla risorsa osservabile /res_forecast su nodo [{ip}]")
+    client = HelperClient(server=(ip, 5683))
+
+    request = Request()
+    request.code = defines.Codes.GET.number
+    request.uri_path = "res_forecast"
+    request.observe = 0  # 0 = registrazione
+    request.token = b'2424'
+    request.destination = (ip, 5683)
+
+    client.send_request(request, callback=forecast_callback)
+
+
+# Funzione che attende la registrazione della risorsa /res_forecast e avvia l'osservazione
+def watch_forecast_resource():
+    print("[*] In attesa che /res_forecast venga registrata...")
+
+    while True:
+        ip = get_ip("/res_forecast")
+        if ip:
+            print(f"[✓] Trovata /res_forecast su nodo [{ip}] Avvio osservazione")
+            observe_remote_forecast(ip)
+            return  # termina il thread una volta avviata l’osservazione
+        time.sleep(2)
+
+
+
+# Stadi della pipeline dell'edge serviti da /res_stats (node/pipe_stats.h), in ordine
+STATS_STAGES = ["parse", "pair", "infer", "decide", "actuate", "uplink", "loop"]
+ENERGY_FIELDS = ["cpu_ms", "lpm_ms", "deep_lpm_ms", "listen_ms", "tx_ms"]
+stats_last = None  # ultima lettura cumulativa di /res_stats, per la differenza con la successiva
+
+
+# Tabelle delle finestre di /res_stats: percentili per stadio (Grafana) e tempi Energest dell'edge
+def create_stats_tables():
+    with DB.connect_db() as conn, conn.cursor() as cur:
+        cur.execute("""
+            CREATE TABLE IF NOT EXISTS edge_stats (
+                id INT AUTO_INCREMENT PRIMARY KEY,
+                time_sec BIGINT UNSIGNED,
+                stage VARCHAR(16),
+                n INT,
+                mean_us BIGINT, p50_us BIGINT, p90_us BIGINT, p99_us BIGINT,
+                max_us BIGINT
+            )
+        """)
+        cur.execute("""
+            CREATE TABLE IF NOT EXISTS edge_energy (
+                id INT AUTO_INCREMENT PRIMARY KEY,
+                time_sec BIGINT UNSIGNED,
+                cpu_ms BIGINT, lpm_ms BIGINT, deep_lpm_ms BIGINT, listen_ms BIGINT, tx_ms BIGINT
+            )
+        """)
+        conn.commit()
+
+
+# Percentile pct di un istogramma a bucket fissi: estremo superiore del bucket in cui cade
+# (il massimo per l'ultimo bucket, che non ha limite)
+def hist_percentile(hist, bounds, pct, max_us):
+    total = sum(hist)
+    if total == 0:
+        return 0
+    need = math.ceil(total * pct / 100.0)
+    acc = 0
+    for i, count in enumerate(hist):
+        acc += count
+        if acc >= need:
+            return min(bounds[i], max_us) if i < len(bounds) else max_us
+    return max_us
+
+
+# Funzione di callback per le notifiche della risorsa /res_stats: i contatori sono cumulativi
+# dall'avvio dell'edge, nel database va la finestra tra due notifiche (intera dopo un riavvio)
+def stats_callback(response):
+    global stats_last
+    payload = response.payload
+    if isinstance(payload, bytes):
+        payload = payload.decode("utf-8")
+
+    try:
+        data = json.loads(payload)
+        bounds = data["ub"]
+        now = int(time.time())
+        prev = stats_last
+        if prev is not None and any(data[s][0] < prev[s][0] for s in STATS_STAGES if s in data and s in prev):
+            print("[STATS] Contatori azzerati, edge riavviato")
+            prev = None
+
+        rows = []
+        for stage in STATS_STAGES:
+            if stage not in data:
+                continue
+            n, total, max_us, hist = data[stage]
+            if prev is not None and stage in prev:
+                pn, ptotal, _, phist = prev[stage]
+                n, total = n - pn, (total - ptotal) % 2**32  # somma in us a 32 bit sul nodo
+                hist = [a - b for a, b in zip(hist, phist)]
+            if n <= 0:
+                continue
+            rows.append((now, stage, n, total // n, hist_percentile(hist, bounds, 50, max_us),
+                         hist_percentile(hist, bounds, 90, max_us), hist_percentile(hist, bounds, 99, max_us),
+                         max_us))
+
+        energy = data.get("e")
+        if energy is not None and prev is not None and "e" in prev:
+            energy = [a - b for a, b in zip(energy, prev["e"])]
+        stats_last = data
+
+        with DB.connect_db() as conn, conn.cursor() as cur:
+            if rows:
+                cur.executemany(
+                    "INSERT INTO edge_stats (time_sec, stage, n, mean_us, p50_us, p90_us, p99_us, max_us) "
+                    "VALUES (%s, %s, %s, %s, %s, %s, %s, %s)", rows)
+            if energy is not None:
+                cur.execute(
+                    "INSERT INTO edge_energy (time_sec, %s) VALUES (%%s, %s)"
+                    % (", ".join(ENERGY_FIELDS), ", ".join(["%s"] * len(ENERGY_FIELDS))),
+                    [now] + list(energy))
+            conn.commit()
+        for r in rows:
+            print(f"[STATS] {r[1]}: {r[2]} campioni, media {r[3]} us, p50 {r[4]} us, p99 {r[6]} us")
+
+    except Exception as e:
+        print("[!] Payload sconosciuto:", response.payload, "| errore:", e)
+
+
+# Funzione per iscriversi alla risorsa osservabile /res_stats
+def observe_remote_stats(ip):
+    print(f"[*] Mi iscrivo alla risorsa osservabile /res_stats su nodo [{ip}]")
+    client = HelperClient(server=(ip, 5683))
+
+    request = Request()
+    request.code = defines.Codes.GET.number
+    request.uri_path = "res_stats"
+    request.observe = 0  # 0 = registrazione
+    request.token = b'5151'
+    request.destination = (ip, 5683)
+
+    client.send_request(request, callback=stats_callback)
+
+
+# Funzione che attende la registrazione della risorsa /res_stats e avvia l'osservazione
+def watch_stats_resource():
+    print("[*] In attesa che /res_stats venga registrata...")
+    try:
+        create_stats_tables()
+    except Exception as e:
+        print("[STATS ERROR - init]", e)
+        return
+
+    while True:
+        ip = get_ip("/res_stats")
+        if ip:
+            print(f"[✓] Trovata /res_stats su nodo [{ip}] Avvio osservazione")
+            observe_remote_stats(ip)
+            return  # termina il thread una volta avviata l’osservazione
+        time.sleep(2)
+
+
+
+# Payload di /res_data e /res_prediction: JSON oppure SenML-CBOR secondo il Content-Format.
+# In SenML il timestamp arriva come base time (bt) e i nomi dei record sono le chiavi JSON
+def read_payload(request):
+    if request.content_type == senml.CONTENT_FORMAT:
+        raw = request.payload
+        if not isinstance(raw, bytes):
+            raw = raw.encode("utf-8")
+        data, bt = senml.decode(raw)
+        data["ts"] = bt
+        return data
+    return json.loads(request.payload)
+
+
+# Formato e dimensione del payload ricevuto, per confrontare JSON e SenML-CBOR
+def payload_info(request):
+    fmt = "SenML-CBOR" if request.content_type == senml.CONTENT_FORMAT else "JSON"
+    raw = request.payload
+    size = len(raw) if isinstance(raw, bytes) else len(raw.encode("utf-8"))
+    return "%s, %d byte" % (fmt, size)
+
+
 # Funzione per convertire un timestamp in secondi 
 def to_epoch_seconds(raw_ts):
     """
@@ -573,11 +833,8 @@ def to_epoch_seconds(raw_ts):
 
 # Funzione per ottenere l'IP di un nodo registrato in base alla risorsa richiesta
 def get_ip(resource_requested):
-    for entry in registered_nodes:
-        if entry["resource"] == resource_requested:
-            # Risorsa trovata, restituisci l'IP
-            return entry["ip"]
-    return None  # Risorsa non trovata
+    found = directory.lookup(resource_requested)
+    return found["ip"] if found else None  # None = risorsa non trovata o scaduta
 
 
 # Funzione per inviare un comando PUT al nodo specificato
@@ -594,6 +851,41 @@ def send_put(ip, resource, payload):
         print("Nessuna risposta")        
 
 
+# nextSolar calcolato all'ora `ora` e' la produzione prevista per l'ora successiva
+def note_solar(ora, next_solar):
+    solar_forecast[(int(ora) + 1) % 24] = next_solar
+
+
+# Funzione che sceglie l'ora di accensione della furnace per le ore mancanti al minimo
+def plan_turnon(current_hour, remain):
+    """
+    Senza forecast la furnace parte all'ultima ora utile (load_hour - remain).
+    Con il forecast dell'edge sceglie, tra l'ora corrente e load_hour, la finestra
+    di `remain` ore consecutive con la domanda netta prevista minima: consumo
+    previsto meno produzione prevista (stessa scala, come nella decisione dell'edge).
+    La produzione di ogni ora e' l'ultimo nextSolar ricevuto per quell'ora, quindi
+    oltre l'ora successiva e' quella prevista il giorno prima.
+    Ricalcolata ogni ora: quando resta solo l'ultima finestra utile viene scelta comunque.
+    """
+    latest = (((load_hour - remain)) % 24 + 24) % 24
+    hours_left = (load_hour - current_hour) % 24
+
+    if forecast_vector is None or remain <= 0 or hours_left < remain:
+        return latest
+
+    # forecast_vector[k] e' il consumo previsto alle ore forecast_hour + 1 + k, a cui si toglie la produzione prevista
+    def predicted(hour):
+        return forecast_vector[(hour - forecast_hour - 1) % 24] - solar_forecast[hour]
+
+    best_start, best_cost = None, None
+    for start in range(hours_left - remain + 1):
+        cost = sum(predicted((current_hour + start + k) % 24) for k in range(remain))
+        if best_cost is None or cost < best_cost:
+            best_start, best_cost = start, cost
+
+    return (current_hour + best_start) % 24
+
+
 # Funzione per evitare la starvation della furnace
 def avoid_starvation(current_hour):
     global history_vector, count_up_for, max_on, min_on, load_hour, max_reached, furnace_status, last_edge_ctrl, ctrl_prediction
@@ -645,7 +937,7 @@ def avoid_starvation(current_hour):
 
     else:
         # economy_window = [(load_hour + i) % 24 for i in range(3)]
-        must_turnon = (((load_hour - remain)) % 24 + 24) % 24  # Ora in cui la furnace deve essere accesa per raggiungere il minimo
+        must_turnon = plan_turnon(current_hour, remain)  # Ora in cui la furnace deve essere accesa per raggiungere il minimo
         if current_hour == must_turnon and total_on < min_on:
             # Accendi la furnace se è l'ora più economica e non è stata accesa abbastanza nelle ultime 24 ore. 
             # Avvio contatore, disabilito controllo automatico, accendo furnace
@@ -689,6 +981,7 @@ class CoAPServer(CoAP):
         db.reset_database()     
         self.add_resource("res_data/", ResData())
         self.add_resource("res_prediction/", ResPrediction())
+        self.add_resource("res_bulk/", ResBulk())
         self.add_resource("register/", RegisterResource())
         self.add_resource("lookup/", LookupResource())
         self.add_resource('starvation/', StarvationResource())
@@ -710,6 +1003,16 @@ if __name__ == '__main__':
     observer_thread_b.daemon = True
     observer_thread_b.start()
 
+    # Attende che la risorsa /res_forecast venga registrata (edge con PREDICTION_CONF_FORECAST) e avvia l'osservazione
+    observer_thread_c = threading.Thread(target=watch_forecast_resource)
+    observer_thread_c.daemon = True
+    observer_thread_c.start()
+
+    # Attende che la risorsa /res_stats venga registrata e salva le latenze della pipeline su MySQL
+    observer_thread_d = threading.Thread(target=watch_stats_resource)
+    observer_thread_d.daemon = True
+    observer_thread_d.start()
+
     try:
         # Server in ascolto
         server.listen(10)
@@ -0,0 +1,118 @@
+# === Resource directory (directory.py) ===
+# Registrazioni, rinnovi, scadenze con un orologio finto, lookup di piu' risorse
+# e ricarica delle righe salvate; poi latenza delle lookup e memoria per nodo con
+# 10, 100 e 500 nodi, che devono restare piatte al crescere dei nodi.
+#
+# Uso: python3 coapthon_server/test_directory.py
+import sys
+import time
+import tracemalloc
+
+from directory import ResourceDirectory
+
+errors = 0
+
+
+def check(cond, what):
+    global errors
+    if not cond:
+        print("ERRORE:", what)
+        errors += 1
+
+
+class Clock:
+    def __init__(self):
+        self.now = 1000.0
+
+    def __call__(self):
+        return self.now
+
+
+def functional():
+    clock = Clock()
+    changes = []
+    rd = ResourceDirectory(on_change=lambda a, r: changes.append((a, r)), clock=clock)
+
+    rd.register("server", "fd00::1", {"/res_data": 112, "/res_bulk": None}, lifetime=None)
+    check(not rd.register("nodoEdge", "fd00::2", {"/res_power": 112, "/res_roof": 112}, 600),
+          "prima registrazione vista come rinnovo")
+    check(rd.register("nodoEdge", "fd00::2", {"/res_power": 112, "/res_roof": 112}, 600),
+          "rinnovo visto come prima registrazione")
+    check(len(changes) == 2, "un rinnovo identico ha cambiato la tabella")
+
+    # Il registrato per ultimo vince; un rinnovo che toglie una risorsa la rimuove
+    rd.register("nodoEdge2", "fd00::3", {"/res_power": None}, 600)
+    check(rd.lookup("/res_power") == {"ip": "fd00::3", "ct": None}, "lookup del nodo registrato per ultimo")
+    rd.register("nodoEdge2", "fd00::3", {}, 600)
+    check(rd.lookup("/res_power") == {"ip": "fd00::2", "ct": 112}, "risorsa tolta da un rinnovo ancora trovata")
+
+    found = rd.lookup_many(["/res_data", "/res_alarm", "/res_roof"])
+    check(found == {"/res_data": {"ip": "fd00::1", "ct": 112}, "/res_alarm": None,
+                    "/res_roof": {"ip": "fd00::2", "ct": 112}}, "lookup di piu' risorse")
+
+    # Scadenza: il server non scade, il nodo non rinnovato si'
+    clock.now += 599
+    check(rd.lookup("/res_roof") is not None, "nodo scaduto prima del lifetime")
+    clock.now += 2
+    check(rd.lookup("/res_roof") is None, "nodo non rinnovato ancora trovato")
+    check(rd.lookup("/res_bulk") == {"ip": "fd00::1", "ct": None}, "risorsa del server scaduta")
+    check(("fd00::2", "/res_roof") in changes[-1][1], "scadenza non salvata")
+
+    # Ricarica all'avvio: le righe del server gia' presente si ignorano, gli altri nodi
+    # tornano nelle lookup con un lifetime pieno
+    rd2 = ResourceDirectory(clock=clock)
+    rd2.register("server", "fd00::1", {"/res_data": 112}, lifetime=None)
+    loaded = rd2.load(rows=[("server", "fd00::1", "/res_old", None),
+                            ("nodoEdge", "fd00::2", "/res_power", 112),
+                            ("nodoEdge", "fd00::2", "/res_roof", 112),
+                            ("nodeFurnace", "fd00::4", "/res_furnace", None)])
+    check(loaded == 2, "nodi ricaricati")
+    check(rd2.lookup("/res_old") is None, "righe del server ricaricate sopra quelle correnti")
+    check(rd2.lookup("/res_roof") == {"ip": "fd00::2", "ct": 112}, "nodo ricaricato non trovato")
+    clock.now += 601
+    check(rd2.lookup("/res_furnace") is None, "nodo ricaricato senza rinnovo non scaduto")
+    check(rd2.lookup("/res_data") is not None, "risorsa del server scaduta dopo la ricarica")
+
+
+# Directory con n nodi da 4 risorse, come l'edge, piu' le risorse condivise del server
+def populate(n):
+    rd = ResourceDirectory()
+    rd.register("server", "fd00::1", {"/res_data": 112, "/res_prediction": 112, "/res_bulk": None}, lifetime=None)
+    for i in range(n):
+        rd.register("nodo%d" % i, "fd00::%x" % (i + 2),
+                    {"/n%d/res_power" % i: 112, "/n%d/res_roof" % i: 112,
+                     "/n%d/res_threshold" % i: None, "/n%d/res_batch" % i: None}, 600)
+    return rd
+
+
+def lookup_us(rd, n, rounds=20000):
+    query = ["/res_data", "/res_prediction", "/n%d/res_threshold" % (n // 2), "/n%d/res_batch" % (n - 1),
+             "/res_missing"]
+    t0 = time.perf_counter()
+    for _ in range(rounds):
+        rd.lookup_many(query)
+    return (time.perf_counter() - t0) / rounds * 1e6
+
+
+def scaling():
+    results = {}
+    for n in (10, 100, 500):
+        tracemalloc.start()
+        base = tracemalloc.take_snapshot()
+        rd = populate(n)
+        used = sum(s.size_diff for s in tracemalloc.take_snapshot().compare_to(base, "filename"))
+        tracemalloc.stop()
+        us = min(lookup_us(rd, n) for _ in range(3))  # il migliore di tre, meno rumore
+        results[n] = (us, used / n)
+        print("%4d nodi: lookup di 5 risorse %.1f us, %.0f byte per nodo" % (n, us, used / n))
+
+    # Piatte: a 500 nodi al massimo 2 volte il tempo e 1.5 volte la memoria per nodo di 10/100
+    check(results[500][0] < 2 * results[10][0], "la lookup rallenta con il numero di nodi")
+    check(results[500][1] < 1.5 * results[100][1], "la memoria per nodo cresce con il numero di nodi")
+
+
+if __name__ == "__main__":
+    functional()
+    scaling()
+    print("Directory: %s" % ("ERRORI" if errors else "ok"))
+    sys.exit(errors != 0)
@@ -4,38 +4,157 @@
 #include "coap-blocking-api.h"
 #include "sys/log.h"
 #include "sys/etimer.h"
+#include "sys/rtimer.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
 #include "os/dev/leds.h"
 #include "os/dev/button-hal.h"
-#include "net/netstack.h"
-#include "net/routing/routing.h"
-#include "net/ipv6/uiplib.h"
 #include "coap-observe-client.h"
-
+#include "msg_codec.h"
+#include "coap_queue.h"
+#include "res_batch.h"
+#include "journal.h"
+#include "sample_join.h"
+#include "report.h"
+#include "coap_group.h"
+#include "pipe_stats.h"
+#include "node_runtime.h"
+#include "sys/ctimer.h"
+
+#include "prediction_engine.h"
+#include "mlp_backend.h"
+#include "mlp_prof.h"
+// Il modello fuso e quello a 24 ore non hanno pesi addestrati nel repository:
+// vanno esportati da Colab_IOT.py e copiati in edge/ (vedi README)
+#if PREDICTION_FUSED && !__has_include("prediction_fused.h")
+#error "PREDICTION_CONF_FUSED richiede prediction_fused.h esportato dalla sezione MODELLO FUSO di Colab_IOT.py"
+#endif
+#if PREDICTION_FORECAST && !__has_include("prediction_forecast_power.h")
+#error "PREDICTION_CONF_FORECAST richiede prediction_forecast_power.h a 24 uscite esportato da Colab_IOT.py"
+#endif
+// prediction_step(layer, ...): un layer per chiamata, vedi inference_process
+#if PREDICTION_FUSED
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8
+#include "model_store.h"
+#include "prediction_fused_q8.h"
+#define prediction_step(l, f, n, out, len) mlp_q8_step(model_store_net(&prediction_fused_q8), (l), (f), (n), (out), (len))
+#define MODEL_PATH "model/fused"
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_GEN
+#include "prediction_fused_gen.h"
+#define prediction_step prediction_fused_gen_step
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_CSR
+#include "prediction_fused_csr.h"
+#define prediction_step(l, f, n, out, len) mlp_csr_step(&prediction_fused_csr, (l), (f), (n), (out), (len))
+#else
+#include "prediction_fused.h"
+#include "eml_net_step.h"
+#define prediction_step(l, f, n, out, len) eml_net_step(&prediction_fused, (l), (f), (n), (out), (len))
+#endif
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_Q8
+#include "mlp_q8_memo.h"
+#include "model_store.h"
+#include "prediction_next_power_q8.h"
+#if MLP_Q8_MEMO
+static mlp_q8_memo_t power_memo; // ingresso, layer 0 e risultato della previsione precedente
+#define prediction_step(l, f, n, out, len) mlp_q8_memo_step(model_store_net(&prediction_next_power_q8), &power_memo, (l), (f), (n), (out), (len))
+#define MEMO_LOG_EVERY 20
+#else
+#define prediction_step(l, f, n, out, len) mlp_q8_step(model_store_net(&prediction_next_power_q8), (l), (f), (n), (out), (len))
+#endif
+#define MODEL_PATH "model/next_power"
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_GEN
+#include "prediction_next_power_gen.h"
+#define prediction_step prediction_next_power_gen_step
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_CSR
+#include "prediction_next_power_csr.h"
+#define prediction_step(l, f, n, out, len) mlp_csr_step(&prediction_next_power_csr, (l), (f), (n), (out), (len))
+#else
 #include "prediction_next_power.h"
+#include "eml_net_step.h"
+#define prediction_step(l, f, n, out, len) eml_net_step(&prediction_next_power, (l), (f), (n), (out), (len))
+#endif
+#if PREDICTION_FORECAST
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8
+#include "prediction_forecast_power_q8.h"
+#define forecast_step(l, f, n, out, len) mlp_q8_step(&prediction_forecast_power_q8, (l), (f), (n), (out), (len))
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_GEN
+#include "prediction_forecast_power_gen.h"
+#define forecast_step prediction_forecast_power_gen_step
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_CSR
+#include "prediction_forecast_power_csr.h"
+#define forecast_step(l, f, n, out, len) mlp_csr_step(&prediction_forecast_power_csr, (l), (f), (n), (out), (len))
+#else
+#include "prediction_forecast_power.h"
+#include "eml_net_step.h"
+#define forecast_step(l, f, n, out, len) eml_net_step(&prediction_forecast_power, (l), (f), (n), (out), (len))
+#endif
+#define FORECAST_RES ",\"/res_forecast\""
+#else
+#define FORECAST_RES ""
+#endif
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 && MODEL_STORE
+#define MODEL_RES ",\"/" MODEL_PATH "\""
+#else
+#define MODEL_RES ""
+#endif
+#if PIPE_STATS
+#define STATS_RES ",\"/res_stats\""
+#else
+#define STATS_RES ""
+#endif
 
 #define LOG_MODULE "NodeEdge"
 #define LOG_LEVEL LOG_LEVEL_INFO
 
-#define SERVER_EP "coap://[fd00::1]"
 #define FEATURE_COUNT 5
-#define SEARCH_RES 4 // cambia in 5 con soglia
-
-static coap_endpoint_t server_ep, data_ep, pred_ep, furnace_ep, alarm_ep; // 
-static coap_endpoint_t *current_lookup_target = NULL; // puntatore alla destinazione corrente per lookup
-static coap_message_t request[1];
-static struct etimer missing_timer, wait_timer; // Timer per ricerca root iniziale e per gestione arrivo mancato dei dati
-static int timer_running = 0; // flag per sapere se il timer attesa dati è attivo
-static char target_ip[64] = "";  // ip del target trovato
+#define FUSED_FEATURE_COUNT 6 // solar, power, mese, ora, temperatura, umidita'
+#define FUSED_OUTPUTS 2 // nextSolar, nextPower
+#if PREDICTION_FUSED
+#define PREDICTION_FEATURES FUSED_FEATURE_COUNT
+#define PREDICTION_OUTPUTS FUSED_OUTPUTS
+#else
+#define PREDICTION_FEATURES FEATURE_COUNT
+#define PREDICTION_OUTPUTS 1
+#endif
+#define SEARCH_RES 5
+
+static coap_endpoint_t data_ep, pred_ep, furnace_ep, alarm_ep, bulk_ep; // nodi con le risorse cercate
 static char json_buf[180];
 static char timestamp[32];
-static char server_time[32]; // real time ricevuto dal server, sempre in formato UNIX epoch
-const char *res_list[] = {"/res_data", "/res_prediction","/res_furnace", "/res_alarm"}; // risorse da cercare 
-
-coap_endpoint_t *endpoints[] = {&data_ep, &pred_ep, &furnace_ep, &alarm_ep}; // ip dei nodi aventi le risorse cercate (da inizializzare)  
+// Content-Format usato verso ciascuna risorsa: SenML-CBOR se la lookup lo annuncia e MSG_SENML e' attivo
+static unsigned int endpoint_format[] = {APPLICATION_JSON, APPLICATION_JSON, APPLICATION_JSON, APPLICATION_JSON, APPLICATION_JSON};
+// Risorse cercate con /lookup da node_runtime_process (node/node_runtime.h): salvate su
+// flash, dopo un riavvio valgono subito e vengono riconvalidate in background
+static node_runtime_peer_t peers[SEARCH_RES] = {
+  { "/res_data", &data_ep, &endpoint_format[0], 0 },
+  { "/res_prediction", &pred_ep, &endpoint_format[1], 0 },
+  { "/res_furnace", &furnace_ep, &endpoint_format[2], 0 },
+  { "/res_alarm", &alarm_ep, &endpoint_format[3], 0 },
+  { "/res_bulk", &bulk_ep, &endpoint_format[4], 0 },
+};
+// /res_power e /res_roof accettano anche SenML-CBOR: vanno in "cbor" e non si ripetono
+// in "resources", cosi' la register resta in un blocco da REST_MAX_CHUNK_SIZE
+static const char registration[] =
+  "{\"id\":\"nodoEdge\",\"resources\":[\"/res_threshold\",\"/res_batch\"" FORECAST_RES MODEL_RES STATS_RES "],\"cbor\":[\"/res_power\",\"/res_roof\"]}";
+_Static_assert(sizeof(registration) - 1 <= REST_MAX_CHUNK_SIZE,
+               "register dell'edge oltre REST_MAX_CHUNK_SIZE: coap_set_payload la troncherebbe");
+static uint8_t registered = 0; // register confermata: le observe partono con la rete pronta
+
+// Telemetria a batch (resources/res_batch.h): upload in corso e scadenza del record piu' vecchio
+static char batch_buf[BATCH_BUF_SIZE(BATCH_MAX)];
+static int batch_len = 0;
+static int batch_busy = 0;
+static struct ctimer batch_timer;
+#if JOURNAL
+// Recupero del journal: record riletti dalla flash e loro upload, uno alla volta
+static batch_record_t replay_recs[JOURNAL_REPLAY_BATCH];
+static char replay_buf[BATCH_BUF_SIZE(JOURNAL_REPLAY_BATCH)];
+static int replay_len = 0;
+static uint8_t replay_n = 0;
+static struct ctimer replay_timer;
+#endif
 
 // Variabili per dati
 static int solar=0, temperature=0, humidity=0, power=1000;
@@ -43,9 +162,58 @@ static int mese = 1, ora = 0;
 static int nextSolar = 0;
 static int nextPower = 0;
 int missing = 0;
-int roof_updated = 0, power_updated = 0;   // Flags per aggiornamenti risorse
+#if PREDICTION_FORECAST
+int forecast_power[PREDICTION_FORECAST_HORIZON]; // consumo previsto per le prossime 24 ore (stessa scala di nextPower)
+int forecast_hour = -1; // ora del campione da cui e' partita la previsione
+#endif
+msg_roof_t roof_msg;   // Ultimi messaggi validi, serviti dai GET di /res_roof e /res_power
+msg_power_t power_msg;
 process_event_t ev_post_update; // Event per inviare i dati al server
-process_event_t start_missing_timer; // Event per avviare il timer di attesa dei dati mancanti
+
+// Allineamento di roof e power per istante di misura (node/sample_join.h): letture in attesa
+// del loro slot e scadenza della grace dello slot piu' vecchio
+#define JOIN_ROOF 0
+#define JOIN_POWER 1
+static msg_roof_t roof_window[SAMPLE_JOIN_WINDOW];
+static msg_power_t power_window[SAMPLE_JOIN_WINDOW];
+static uint16_t join_rx[SAMPLE_JOIN_SOURCES]; // sequenza locale per i sensori che non mandano seq
+static struct ctimer join_timer;
+static uint32_t slot_ts = 0; // istante di misura dell'ultimo slot partito (epoch)
+// Sensori a deadband (node/report.h): una sorgente in silenzio da meno di REPORT_MAX_SILENCE
+// (piu' la grace) non e' mancante, il suo ultimo valore e' ancora valido
+static clock_time_t join_last[SAMPLE_JOIN_SOURCES]; // arrivo dell'ultima lettura valida
+// Ora simulata del roof: ROOF_HOUR_SECONDS secondi per ora. Con il roof in silenzio ora e
+// mese avanzano dall'istante della sua ultima lettura (0 = restano fermi)
+#ifdef ROOF_CONF_HOUR_SECONDS
+#define ROOF_HOUR_SECONDS ROOF_CONF_HOUR_SECONDS
+#else
+#define ROOF_HOUR_SECONDS 15
+#endif
+static uint32_t roof_t = 0; // istante di misura del roof applicato (epoch)
+static int roof_ora = 0, roof_mese = 1;
+process_event_t ev_sample_ready; // Event per avviare l'inferenza sul campione completo
+
+// Inferenza a passi: i PUT salvano il campione e la rete gira in inference_process
+static int inference_pending = 0; // campione in attesa di inferenza
+static int inference_missing = 0; // 1 se lo slot e' partito incompleto, a grace scaduta
+static rtimer_clock_t inference_requested; // istante della richiesta, per la latenza totale
+static rtimer_clock_t inference_origin; // arrivo della prima lettura dello slot in attesa di inferenza
+static rtimer_clock_t sample_origin; // arrivo del campione dell'inferenza in corso, origine della latenza di attuazione
+// Stadi della pipeline (node/pipe_stats.h): prima lettura dello slot in corso e fine dell'ultima inferenza
+static rtimer_clock_t slot_rx, infer_done;
+static uint8_t slot_rx_valid = 0;
+
+// Latenze in tick rtimer: handler PUT e inferenza sono misurati separatamente
+static uint32_t handler_last = 0, handler_max = 0;
+static uint32_t infer_busy = 0, infer_slice_max = 0, infer_total = 0; // calcolo, slice piu' lunga, dalla richiesta
+static uint8_t infer_slices = 0;
+#define TICKS_TO_US(t) ((unsigned long)((uint64_t)(t) * 1000000 / RTIMER_SECOND))
+#if MLP_PROF
+static mlp_prof_t prof_pred; // tempi per layer, serviti su /res_prof
+#if PREDICTION_FORECAST
+static mlp_prof_t prof_fc;
+#endif
+#endif
 
 // Variabili per attuatori
 static int alarm_state = 0;
@@ -57,70 +225,213 @@ static int furnace_change = 0;
 extern int threshold_on;
 extern int threshold_off;
 extern int auto_furnace_ctrl; // Flag per controllo automatico della furnace
-
-// Iteratori
-int i;
-int attempts = 0;
+extern void threshold_restore(void); // soglie e controllo automatico salvati su flash
+extern void threshold_store(void);
 
 PROCESS(node_edge_process, "Node Edge - ML & Aggregator");
-AUTOSTART_PROCESSES(&node_edge_process);
+PROCESS(inference_process, "Node Edge - Inferenza");
+AUTOSTART_PROCESSES(&node_edge_process, &inference_process);
 
 // === Risorse CoAP ===
 extern coap_resource_t res_roof;
 extern coap_resource_t res_power;
 extern coap_resource_t res_threshold;
+#if PREDICTION_FORECAST
+extern coap_resource_t res_forecast;
+#endif
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 && MODEL_STORE
+extern coap_resource_t res_model;
+#endif
+#if MLP_PROF
+extern coap_resource_t res_prof;
+#endif
+extern coap_resource_t res_batch;
+#if PIPE_STATS
+extern coap_resource_t res_stats;
+#endif
+
+// Epoch dell'edge: orario del server ricevuto all'avvio piu' il tempo trascorso (uptime se non sincronizzato)
+static uint32_t edge_epoch(void) {
+  uint32_t now = node_runtime_epoch();
+  return now ? now : clock_seconds();
+}
+
+static void apply_roof(const msg_roof_t *m) {
+  solar = m->solar; mese = m->mese; ora = m->ora; temperature = m->temp; humidity = m->humid;
+#if !PREDICTION_FUSED
+  nextSolar = m->next_solar; // con il modello fuso nextSolar lo calcola l'edge
+#endif
+  roof_ora = m->ora; roof_mese = m->mese;
+  roof_t = (m->present & MSG_ROOF_T) && m->t > 0 ? (uint32_t)m->t : edge_epoch();
+}
+
+// Roof in silenzio: ora e mese all'istante ts, dall'ultima lettura (il roof cambia mese a mezzanotte)
+static void roof_advance(uint32_t ts) {
+  uint32_t h;
+  if(ROOF_HOUR_SECONDS == 0 || ts <= roof_t) {
+    return;
+  }
+  h = roof_ora + (ts - roof_t) / ROOF_HOUR_SECONDS;
+  ora = h % 24;
+  mese = (roof_mese - 1 + h / 24) % 12 + 1;
+}
 
-// === Funzione per generare timestamp ===
-void generate_timestamp(char *buffer, size_t len) {
-  clock_time_t now = clock_time();
-  unsigned long sec = now / CLOCK_SECOND;
-  snprintf(buffer, len, "%lu", sec);  // UNIX timestamp
+static int join_held(uint8_t src) {
+  return REPORT_ENABLED && join_last[src] != 0 &&
+         clock_time() - join_last[src] < (clock_time_t)(REPORT_MAX_SILENCE + SAMPLE_JOIN_GRACE) * CLOCK_SECOND;
+}
+
+static void apply_power(const msg_power_t *m) {
+  power = m->power;
+}
+
+// Lettura nella finestra del suo slot: senza t (sensore non sincronizzato) vale l'istante di arrivo.
+// Una lettura arrivata dopo la decisione del suo slot aggiorna solo l'ultimo valore noto
+static int join_add(uint8_t src, int32_t seq, int32_t t, int has_seq, int has_t) {
+  const sample_join_stats_t *s = sample_join_stats();
+  uint16_t lost = s->lost[src];
+  int idx = sample_join_add(src, has_seq ? (uint16_t)seq : join_rx[src], has_t && t > 0 ? (uint32_t)t : edge_epoch());
+  join_rx[src]++;
+  join_last[src] = clock_time();
+  if(idx >= 0 && !slot_rx_valid) {
+    slot_rx = RTIMER_NOW();
+    slot_rx_valid = 1;
+  }
+  // Con la telemetria NON dei sensori le perdite si vedono solo dai buchi nella sequenza
+  if(s->lost[src] != lost) {
+    LOG_WARN("Persi %u campioni %s: %u su %u dall'avvio\n", s->lost[src] - lost, src == JOIN_ROOF ? "roof" : "power",
+             s->lost[src], s->lost[src] + s->received[src]);
+  }
+  if(idx == SAMPLE_JOIN_LATE) {
+    LOG_WARN("Campione %s arrivato dopo il suo slot (%u in ritardo)\n", src == JOIN_ROOF ? "roof" : "power",
+             sample_join_stats()->late[src]);
+  } else if(idx == SAMPLE_JOIN_DUPLICATE) {
+    LOG_WARN("Campione %s duplicato (seq %ld)\n", src == JOIN_ROOF ? "roof" : "power", (long)seq);
+  }
+  return idx;
 }
 
 // === Funzioni di parsing dei dati ===
-int parse_roof(const char *json_str){
-    int matched = sscanf(json_str, "{\"solar\": %d, \"mese\": %d, \"ora\": %d, \"temp\": %d, \"humid\": %d, \"nextSolar\": %d}",
-        &solar, &mese, &ora, &temperature, &humidity, &nextSolar);
-    //LOG_INFO("Ho fatto parsing e matched = %d\n", matched);
-    return (matched == 6);  // ritorna 1 se è andato bene
+// Codec generati da msg/messages.json: una passata sul payload CoAP, chiavi in qualsiasi
+// ordine. Le variabili cambiano solo se il messaggio e' completo e valido
+int parse_roof(const uint8_t *payload, uint16_t len, unsigned int format){
+    msg_roof_t m;
+    int idx;
+    int r = format == MSG_CT_SENML_CBOR ? msg_roof_decode_senml(payload, len, &m) : msg_roof_decode(payload, len, &m);
+    if(r != MSG_OK) {
+      return 0;
+    }
+    roof_msg = m;
+    idx = join_add(JOIN_ROOF, m.seq, m.t, m.present & MSG_ROOF_SEQ, m.present & MSG_ROOF_T);
+    if(idx >= 0) {
+      roof_window[idx] = m; // usato quando il suo slot parte
+    } else if(idx == SAMPLE_JOIN_LATE) {
+      apply_roof(&m);
+    }
+    return 1;  // ritorna 1 se è andato bene
 }
 
-int parse_power(const char *json_str){
-  int matched = sscanf(json_str, "{\"power\": %d}", &power);
-  //LOG_INFO("Ho fatto parsing e matched = %d\n", matched);
-  return (matched == 1);  // ritorna 1 se è andato bene
+int parse_power(const uint8_t *payload, uint16_t len, unsigned int format){
+  msg_power_t m;
+  int idx;
+  int r = format == MSG_CT_SENML_CBOR ? msg_power_decode_senml(payload, len, &m) : msg_power_decode(payload, len, &m);
+  if(r != MSG_OK) {
+    return 0;
+  }
+  power_msg = m;
+  idx = join_add(JOIN_POWER, m.seq, m.t, m.present & MSG_POWER_SEQ, m.present & MSG_POWER_T);
+  if(idx >= 0) {
+    power_window[idx] = m;
+  } else if(idx == SAMPLE_JOIN_LATE) {
+    apply_power(&m);
+  }
+  return 1;  // ritorna 1 se è andato bene
+}
+
+// === Payload in uscita (msg/messages.json), scritti in json_buf senza snprintf ===
+// /res_data e /res_prediction nel formato scelto per la destinazione: ritornano la lunghezza
+static int encode_data(void) {
+  msg_data_t m = { { timestamp, strlen(timestamp) }, solar, mese, ora, temperature, humidity, power, 0 };
+  int len = endpoint_format[0] == MSG_CT_SENML_CBOR ? msg_data_encode_senml(&m, json_buf, sizeof(json_buf))
+                                                    : msg_data_encode(&m, json_buf, sizeof(json_buf));
+  return len > 0 ? len : 0;
+}
+
+static int encode_prediction(void) {
+  msg_prediction_t m = { { timestamp, strlen(timestamp) }, nextPower, nextSolar, missing, 0 };
+  int len = endpoint_format[1] == MSG_CT_SENML_CBOR ? msg_prediction_encode_senml(&m, json_buf, sizeof(json_buf))
+                                                    : msg_prediction_encode(&m, json_buf, sizeof(json_buf));
+  return len > 0 ? len : 0;
+}
+
+static void encode_alarm(void) {
+  msg_alarm_t m = { alarm_state, 0 };
+  msg_alarm_encode(&m, json_buf, sizeof(json_buf));
+}
+
+static void encode_furnace(void) {
+  msg_furnace_t m = { furnace_state, 0 };
+  msg_furnace_encode(&m, json_buf, sizeof(json_buf));
 }
 
 // === Modello ML ===
-int predict_next_power() {
+// Feature del campione corrente, copiate all'avvio dell'inferenza: un PUT che arriva
+// mentre la rete e' a meta' non modifica gli ingressi gia' in uso
+static void fill_inputs(float *inputs) {
+#if PREDICTION_FUSED
+  inputs[0] = (float)solar/1000;
+  inputs[1] = (float)power/100;
+  inputs[2] = (float)mese; inputs[3] = (float)ora; inputs[4] = (float)temperature; inputs[5] = (float)humidity;
+#else
+  inputs[0] = (float)power/100; // kW
+  inputs[1] = (float)mese; inputs[2] = (float)ora; inputs[3] = (float)temperature; inputs[4] = (float)humidity;
+#endif
+}
 
-  float powerkw = (float)power/100;
-  //LOG_INFO("Previsione power: power=%d, powerkw=%d\n", power, (int)powerkw);
+// Somma il tempo di calcolo di una slice (un layer) e tiene la piu' lunga
+static void account_slice(rtimer_clock_t start) {
+  uint32_t t = (uint32_t)(RTIMER_NOW() - start);
+  infer_busy += t;
+  infer_slices++;
+  if(t > infer_slice_max) {
+    infer_slice_max = t;
+  }
+}
 
-  // Dati per la previsione devono essere in float
-  float inputs[FEATURE_COUNT] = {powerkw, (float)mese, (float)ora, (float)temperature, (float)humidity};
-  float result = 0.0f;
-  
-  result = prediction_next_power_regress1(inputs, FEATURE_COUNT);
+// Chiamata dai PUT handler di /res_roof e /res_power prima di rispondere
+void put_handler_latency(rtimer_clock_t start) {
+  handler_last = (uint32_t)(RTIMER_NOW() - start);
+  PIPE_STATS_ADD(PIPE_PARSE, handler_last);
+  if(handler_last > handler_max) {
+    handler_max = handler_last;
+  }
+}
 
-  return result > 0 ? (int)result : 0;
+// Accoda l'inferenza: non blocca il chiamante, la rete gira in inference_process
+void request_inference(int m) {
+  rtimer_clock_t now = RTIMER_NOW();
+
+  if(!slot_rx_valid) {
+    slot_rx = now;
+  }
+  PIPE_STATS_ADD(PIPE_PAIR, now - slot_rx);
+  if(!inference_pending) {
+    inference_requested = now;
+    inference_origin = slot_rx;
+  }
+  slot_rx_valid = 0;
+  inference_pending = 1;
+  inference_missing = m;
+  process_post(&inference_process, ev_sample_ready, NULL);
 }
 
 // === Funzione per inviare i dati al server quando ho ricevuto sia da Roof Node che da Power Node ===
-void predict_and_send(int m){
+// nextPower (e nextSolar con il modello fuso) e' gia' stato calcolato da inference_process
+void decide_and_send(int m){
   missing = m;
-  nextPower = predict_next_power();
-  nextPower= nextPower * 2;
 
-  // Ottengo timestamp del dongle e lo sommo al real time per ottenere timestamp UNIX
-  generate_timestamp(timestamp, sizeof(timestamp));
-  unsigned long final_timestamp = strtoul(server_time, NULL, 10);
-  
-  unsigned long edge_timestamp = strtoul(timestamp, NULL, 10);
-  
-  final_timestamp += edge_timestamp; 
-  
-  snprintf(timestamp, sizeof(timestamp), "%lu", final_timestamp);
+  // Timestamp UNIX dello slot (istante di misura dei sensori), altrimenti quello dell'edge
+  snprintf(timestamp, sizeof(timestamp), "%lu", (unsigned long)(slot_ts ? slot_ts : edge_epoch()));
 
   //LOG_INFO("Prediction partita con m=%d\n", m);
   LOG_INFO("Prediction eseguita: nextPower=%d, nextSolar=%d, timestamp=%s\n", nextPower, nextSolar, timestamp);
@@ -165,19 +476,61 @@ void predict_and_send(int m){
   process_post(&node_edge_process, ev_post_update, NULL);
 }
 
-// Funzione per controllare se i dati sono stati aggiornati e avviare la regressione
+static void join_timeout(void *ptr);
+
+// Avvia la regressione appena uno slot ha roof e power, o quando scade la sua grace:
+// la sorgente mancante resta al valore precedente, con missing = 1 se non e' un sensore
+// a deadband ancora entro il silenzio massimo
 void try_regression() {
-  if (roof_updated && power_updated) {
-    predict_and_send(0);
-    roof_updated = 0;
-    power_updated = 0;
-    timer_running = 0;
-  } else if (!timer_running) {  // Avvio timer se mi mancano i dati
-    process_post(&node_edge_process, start_missing_timer, NULL);
-    timer_running = 1;
+  int8_t idx[SAMPLE_JOIN_SOURCES];
+  int r, last = SAMPLE_JOIN_NONE, miss = 0;
+  uint8_t src;
+  clock_time_t next;
+
+  while((r = sample_join_poll(idx, &slot_ts)) != SAMPLE_JOIN_NONE) {
+    if(idx[JOIN_ROOF] >= 0) {
+      apply_roof(&roof_window[idx[JOIN_ROOF]]);
+    }
+    if(idx[JOIN_POWER] >= 0) {
+      apply_power(&power_window[idx[JOIN_POWER]]);
+    }
+    if(r == SAMPLE_JOIN_PARTIAL) {
+      src = idx[JOIN_ROOF] < 0 ? JOIN_ROOF : JOIN_POWER;
+      if(src == JOIN_ROOF) {
+        roof_advance(slot_ts);
+      }
+      if(join_held(src)) {
+        LOG_DBG("Grace scaduta: %s invariato entro la deadband\n", src == JOIN_ROOF ? "roof" : "power");
+        miss = 0;
+      } else {
+        LOG_INFO("Grace scaduta: regressione senza il campione %s\n", src == JOIN_ROOF ? "roof" : "power");
+        miss = 1;
+      }
+    } else {
+      miss = 0;
+    }
+    last = r;
+  }
+  if(last != SAMPLE_JOIN_NONE) {
+    request_inference(miss);
   }
+
+  next = sample_join_next();
+  if(next > 0) {
+    ctimer_set(&join_timer, next, join_timeout, NULL);
+  } else {
+    ctimer_stop(&join_timer);
+  }
+}
+
+static void join_timeout(void *ptr) {
+  try_regression();
 }
 
+#if COAP_GROUP
+static void group_furnace_ack(void);
+#endif
+
 // === Handlers per le risorse osservabili ===
 void alarm_handler(coap_observee_t *obs,
                    void *notification,
@@ -190,13 +543,18 @@ void alarm_handler(coap_observee_t *obs,
 
   coap_message_t *response = (coap_message_t *)notification;
   const uint8_t *chunk = NULL;
-  int alarm_value = -1;
+  int32_t alarm_value = -1;
   int len = coap_get_payload(response, &chunk);
  
     if(chunk != NULL && len > 0) {
       LOG_INFO("[ALARM_HANDLER] Notifica ricevuta con valore: %.*s\n", len, (char *)chunk);
-      if(sscanf((const char *)chunk, "%d", &alarm_value) == 1) {
-        LOG_INFO("[ALARM_HANDLER] Modifico mio valore Alarm: %d\n", alarm_value);
+      if(msg_decode_int(chunk, len, &alarm_value) == MSG_OK) { // text/plain
+        LOG_INFO("[ALARM_HANDLER] Modifico mio valore Alarm: %d\n", (int)alarm_value);
+#if COAP_GROUP
+        if(alarm_value == alarm_state) {
+          coap_group_ack(COAP_GROUP_ALARM); // conferma del comando di gruppo
+        }
+#endif
         alarm_state = alarm_value;
       } else {
         LOG_WARN("[ALARM_HANDLER] Payload non valido: %.*s\n", len, (char *)chunk);
@@ -217,14 +575,19 @@ void furnace_handler(coap_observee_t *obs,
 
   coap_message_t *response = (coap_message_t *)notification;
   const uint8_t *chunk = NULL;
-  int furnace_value = -1;
+  msg_furnace_t m;
   int len = coap_get_payload(response, &chunk);
  
     if(chunk != NULL && len > 0) {
       LOG_INFO("[FURNACE_HANDLER] Notifica ricevuta con: %.*s\n", len, (char *)chunk);
-      if(sscanf((const char *)chunk, "{\"furnace_state\":%d}", &furnace_value) == 1) {
-        LOG_INFO("[FURNACE_HANDLER] Modifico mio valore Furnace: %d\n", furnace_value);
-        furnace_state = furnace_value;
+      if(msg_furnace_decode(chunk, len, &m) == MSG_OK) {
+        LOG_INFO("[FURNACE_HANDLER] Modifico mio valore Furnace: %d\n", (int)m.furnace_state);
+#if COAP_GROUP
+        if(m.furnace_state == furnace_state) {
+          group_furnace_ack();
+        }
+#endif
+        furnace_state = m.furnace_state;
       } else {
         LOG_WARN("[FURNACE_HANDLER] Payload non valido: %.*s\n", len, (char *)chunk);
       }
@@ -233,79 +596,243 @@ void furnace_handler(coap_observee_t *obs,
     }
 }
 
-// Handler che gestisce la risposta della richiesta di timestamp
-void timestamp_handler(coap_message_t *response) {
-  const uint8_t *chunk;
+// Fine di una richiesta della coda in uscita (node/coap_queue.h): ctx e' il formato
+// della destinazione, per il ritorno al JSON se il SenML-CBOR viene rifiutato
+static void send_done(coap_queue_item_t *q, coap_message_t *response) {
+  unsigned int *format = (unsigned int *)q->ctx;
 
-  if (response == NULL) {
-    LOG_WARN("Timeout durante la registrazione\n");
-    return;
+  if(response == NULL) {
+    LOG_WARN("Nessuna risposta da /%s (timeout o scartata)\n", q->path);
+  } else {
+    LOG_INFO("/%s: codice risposta %u.%02u\n", q->path, response->code >> 5, response->code & 0x1F);
+    if(format != NULL && *format == MSG_CT_SENML_CBOR && (response->code >> 5) >= 4) {
+      LOG_WARN("SenML-CBOR rifiutato da /%s, torno al JSON\n", q->path);
+      *format = APPLICATION_JSON;
+    }
+  }
+
+  // Stadi della pipeline: conferma degli attuatori (e ciclo completo dalla prima lettura) o invio al server
+  if(response != NULL && (response->code >> 5) == 2) {
+    if(q->prio == COAP_QUEUE_PRIO_ACTUATOR) {
+      PIPE_STATS_ADD(PIPE_ACTUATE, RTIMER_NOW() - q->queued);
+      PIPE_STATS_ADD(PIPE_LOOP, RTIMER_NOW() - q->origin);
+    } else {
+      PIPE_STATS_ADD(PIPE_UPLINK, RTIMER_NOW() - q->queued);
+    }
   }
 
-  // Stampo codice risposta
-  LOG_INFO("Codice risposta: %u.%02u\n",
-           (response->code >> 5), response->code & 0x1F);
+  // Latenza campione -> furnace attuata: dall'arrivo del campione all'ACK del PUT
+  if(response != NULL && q->ep == &furnace_ep) {
+    const coap_queue_lat_t *l = &coap_queue_stats()->lat[COAP_QUEUE_PRIO_ACTUATOR];
+    LOG_INFO("Latenza attuazione furnace: %lu us (media %lu us, max %lu us su %lu), attesa in coda max %lu us\n",
+             TICKS_TO_US(l->last), TICKS_TO_US(l->count ? l->sum / l->count : 0), TICKS_TO_US(l->max),
+             (unsigned long)l->count,
+             TICKS_TO_US(l->wait_max));
+  }
+
+  if(coap_queue_idle()) {
+    leds_off(LEDS_BLUE); // Spegnimento LED a coda vuota
+    leds_on(LEDS_GREEN);
+  }
+}
+
+// PUT unicast agli attuatori, con priorita' sulla telemetria in coda
+static void send_furnace(void) {
+  if(peers[2].state == NODE_RUNTIME_PEER_NONE) {
+    LOG_WARN("Furnace non ancora trovata, comando non inviato\n");
+    return;
+  }
+  LOG_INFO("MANDO a furnace: %d\n", furnace_state);
+  encode_furnace();
+  coap_queue_send(&furnace_ep, COAP_PUT, "res_furnace", APPLICATION_JSON, (uint8_t *)json_buf, strlen(json_buf),
+                  COAP_QUEUE_PRIO_ACTUATOR, COAP_QUEUE_REPLACE, sample_origin, send_done, NULL);
+}
 
-  // Errore client o server
-  if (response->code >= 128) {
-    LOG_WARN("Errore dal server: codice %u\n", response->code);
+static void send_alarm(void) {
+  if(peers[3].state == NODE_RUNTIME_PEER_NONE) {
+    LOG_WARN("Alarm non ancora trovato, comando non inviato\n");
     return;
   }
+  LOG_INFO("MANDO a alarm: %d\n", alarm_state);
+  encode_alarm();
+  coap_queue_send(&alarm_ep, COAP_PUT, "res_alarm", APPLICATION_JSON, (uint8_t *)json_buf, strlen(json_buf),
+                  COAP_QUEUE_PRIO_ACTUATOR, COAP_QUEUE_REPLACE, sample_origin, send_done, NULL);
+}
 
-  int len = coap_get_payload(response, &chunk);
-  //LOG_INFO("Risposta: %.*s\n", len, (char *)chunk);
+#if COAP_GROUP
+// === Attuazione di gruppo (node/coap_group.h) ===
+static uint16_t group_seq = 0;
+static rtimer_clock_t group_origin; // arrivo del campione del comando di gruppo in attesa
+static rtimer_clock_t group_queued; // invio del comando di gruppo
 
-  if (len > 0) {
-    sscanf((char *)chunk, "{\"timestamp\": \"%[^\"]", server_time); 
-    LOG_INFO("Timestamp ricevuto dal server: %s\n", server_time);
-  } else {
-    LOG_WARN("Payload inatteso nella register: %.*s\n", len, (char *)chunk);
+// Attuatori senza notifica entro COAP_GROUP_ACK_TIMEOUT: stesso stato in unicast
+static void group_timeout(uint8_t pending) {
+  if(pending & COAP_GROUP_FURNACE) {
+    send_furnace();
+  }
+  if(pending & COAP_GROUP_ALARM) {
+    send_alarm();
   }
 }
 
-// Handler che gestisce la risposta della lookup e aggiorna l'endpoint del target
-void handle_lookup_response(coap_message_t *response) {
-  const uint8_t *chunk;
+// Un solo PUT NON al gruppo con lo stato di tutti gli attuatori: members sono quelli cambiati,
+// di cui si attende la notifica
+static void group_send(uint8_t members) {
+  msg_group_t m = { furnace_state, alarm_state, group_seq++, members, 0 };
+  int len = msg_group_encode(&m, json_buf, sizeof(json_buf));
 
-  if (response == NULL) {
-    LOG_INFO("Timeout dal server\n");
+  LOG_INFO("MANDO al gruppo: furnace %d, alarm %d (conferma da 0x%02x)\n", furnace_state, alarm_state, members);
+  if(len < 0 || !coap_group_send("res_group", (uint8_t *)json_buf, len)) {
+    LOG_WARN("Invio al gruppo fallito\n");
+    group_timeout(members);
     return;
   }
+  group_origin = sample_origin;
+  group_queued = RTIMER_NOW();
+  coap_group_expect(members, group_timeout);
+}
+
+// Notifica della furnace con lo stato comandato: latenza campione -> furnace attuata, come in send_done
+static void group_furnace_ack(void) {
+  const coap_group_stats_t *s = coap_group_stats();
+  uint16_t acked = s->acked;
+
+  coap_group_ack(COAP_GROUP_FURNACE);
+  if(s->acked != acked) {
+    PIPE_STATS_ADD(PIPE_ACTUATE, RTIMER_NOW() - group_queued);
+    PIPE_STATS_ADD(PIPE_LOOP, RTIMER_NOW() - group_origin);
+    LOG_INFO("Latenza attuazione furnace (gruppo): %lu us, %u conferme e %u ritorni all'unicast su %u invii\n",
+             TICKS_TO_US(RTIMER_NOW() - group_origin), s->acked, s->fallback, s->sent);
+  }
+}
+#endif
 
-  // Stampo codice risposta
-  LOG_INFO("Codice risposta: %u.%02u\n",
-           (response->code >> 5), response->code & 0x1F);
+// === Telemetria a batch ===
+static void batch_flush(void);
 
-  // Errore client o server
-  if (response->code >= 128) {
-    LOG_WARN("Errore dal server: codice %u\n", response->code);
-    return;
+static void batch_timeout(void *ptr) {
+  batch_flush();
+}
+
+// POST su /res_bulk: in un solo messaggio fino a BATCH_BLOCK byte, altrimenti il blocco num
+static int bulk_send(const char *buf, int len, uint32_t num, rtimer_clock_t origin, coap_queue_done_t done) {
+  if(len <= BATCH_BLOCK) {
+    return coap_queue_send(&bulk_ep, COAP_POST, "res_bulk", APPLICATION_JSON, (const uint8_t *)buf, len,
+                           COAP_QUEUE_PRIO_TELEMETRY, 0, origin, done, NULL);
   }
+  return coap_queue_send_block(&bulk_ep, COAP_POST, "res_bulk", APPLICATION_JSON, (const uint8_t *)buf, len,
+                               num, BATCH_BLOCK, COAP_QUEUE_PRIO_TELEMETRY, origin, done, NULL);
+}
 
-  int len = coap_get_payload(response, &chunk);
-  //LOG_INFO("Risposta: %.*s\n", len, (char *)chunk);
+#if JOURNAL
+static void replay_next(void *ptr);
 
-  if (len >0 && strstr((char *)chunk, "fd00::") != NULL) {
-    sscanf((char *)chunk, "{\"ip\" : \"%[^\"]", target_ip);
-    LOG_INFO("Nodo target trovato: [%s]\n", target_ip);
+// Recupero confermato: record fuori dal journal e prossimo POST dopo JOURNAL_REPLAY_INTERVAL;
+// al primo errore si sospende fino alla prossima consegna dal ring
+static void replay_done(coap_queue_item_t *q, coap_message_t *response) {
+  if(response != NULL && response->code == CONTINUE_2_31 &&
+     bulk_send(replay_buf, replay_len, q->block_num + 1, q->origin, replay_done)) {
+    return;
+  }
+  if(response != NULL && (response->code >> 5) == 2 && response->code != CONTINUE_2_31) {
+    journal_ack(replay_n);
+    LOG_INFO("Recuperati %u record dal journal, %lu ancora da inviare\n", replay_n, (unsigned long)journal_depth());
+    if(journal_depth() > 0) {
+      ctimer_set(&replay_timer, (clock_time_t)JOURNAL_REPLAY_INTERVAL * CLOCK_SECOND, replay_next, NULL);
+    }
   } else {
-    //LOG_WARN("IP non trovato nella risposta\n");
+    LOG_WARN("Recupero del journal sospeso, %lu record da inviare\n", (unsigned long)journal_depth());
   }
+  replay_n = 0;
+  if(coap_queue_idle()) {
+    leds_off(LEDS_BLUE);
+    leds_on(LEDS_GREEN);
+  }
+}
 
+// Un POST su /res_bulk con i record piu' vecchi del journal
+static void replay_next(void *ptr) {
+  if(replay_n > 0 || journal_depth() == 0) {
+    return;
+  }
+  replay_n = journal_peek(replay_recs, JOURNAL_REPLAY_BATCH);
+  if(replay_n == 0) {
+    return;
+  }
+  replay_len = batch_encode_records(replay_recs, replay_n, replay_buf, sizeof(replay_buf));
+  if(replay_len <= 0 || !bulk_send(replay_buf, replay_len, 0, RTIMER_NOW(), replay_done)) {
+    replay_n = 0;
+  }
 }
 
-// Funzione di callback per gestire la risposta generica dal server
-void response_handler(coap_message_t *response){
+// Il server ha risposto: parte il recupero se il journal non e' vuoto
+static void replay_start(void) {
+  if(replay_n == 0 && journal_depth() > 0 && ctimer_expired(&replay_timer)) {
+    LOG_INFO("Server raggiungibile, recupero di %lu record dal journal\n", (unsigned long)journal_depth());
+    ctimer_set(&replay_timer, (clock_time_t)JOURNAL_REPLAY_INTERVAL * CLOCK_SECOND, replay_next, NULL);
+  }
+}
+#endif
 
-   if (response == NULL) {
-    LOG_INFO("Timeout dal server\n");
+// Blocco successivo dopo 2.31 Continue; a batch consegnato (2.xx) i record lasciano il ring,
+// altrimenti restano e si riprova alla prossima scadenza (con JOURNAL passano al journal)
+static void batch_done(coap_queue_item_t *q, coap_message_t *response) {
+  if(response != NULL && response->code == CONTINUE_2_31 &&
+     bulk_send(batch_buf, batch_len, q->block_num + 1, q->origin, batch_done)) {
     return;
   }
+  if(response != NULL && (response->code >> 5) == 2 && response->code != CONTINUE_2_31) {
+    LOG_INFO("Batch consegnato: %d byte\n", batch_len);
+    PIPE_STATS_ADD(PIPE_UPLINK, RTIMER_NOW() - q->queued);
+    batch_sent(1);
+#if JOURNAL
+    replay_start();
+#endif
+  } else {
+    LOG_WARN("Batch non consegnato, %u record restano in attesa\n", batch_pending());
+    batch_sent(0);
+  }
+  batch_busy = 0;
+  if(batch_pending() >= batch_size) {
+    batch_flush();
+  } else if(batch_pending() > 0) {
+    ctimer_set(&batch_timer, (clock_time_t)batch_delay * CLOCK_SECOND, batch_timeout, NULL);
+  }
+  if(coap_queue_idle()) {
+    leds_off(LEDS_BLUE);
+    leds_on(LEDS_GREEN);
+  }
+}
+
+// Un solo POST su /res_bulk con tutti i record in attesa, block-wise oltre BATCH_BLOCK byte.
+// Con /res_bulk ancora ignota i record restano nel ring fino a ev_runtime_ready/changed
+static void batch_flush(void) {
+  if(batch_busy || batch_pending() == 0 || !node_runtime_ready() || peers[4].state == NODE_RUNTIME_PEER_NONE) {
+    return;
+  }
+  ctimer_stop(&batch_timer);
+  batch_len = batch_encode(batch_buf, sizeof(batch_buf));
+  if(batch_len <= 0) {
+    batch_sent(0);
+    return;
+  }
+  LOG_INFO("Invio batch di %u record (%d byte)\n", batch_pending(), batch_len);
+  batch_busy = bulk_send(batch_buf, batch_len, 0, sample_origin, batch_done);
+  if(!batch_busy) {
+    batch_sent(0);
+  }
+}
+
+// Record del ciclo corrente nel ring: invio a batch_size record, altrimenti entro batch_delay secondi
+static void batch_collect(void) {
+  batch_record_t r = { strtoul(timestamp, NULL, 10), solar, power, nextPower, nextSolar,
+                       temperature, humidity, mese, ora, missing };
 
-  // Stampa e controlla codice CoAP (es. 2.05, 4.04, ecc.)
-  uint8_t class = response->code >> 5;
-  uint8_t detail = response->code & 0x1F;
-  LOG_INFO("Codice risposta: %u.%02u\n", class, detail);
+  if(batch_add(&r) >= batch_size) {
+    batch_flush();
+  } else if(ctimer_expired(&batch_timer)) {
+    ctimer_set(&batch_timer, (clock_time_t)batch_delay * CLOCK_SECOND, batch_timeout, NULL);
+  }
 }
 
 // Funzione per accendere o spegnere il led relativo al controllo automatico della furnace
@@ -317,196 +844,168 @@ void set_auto_ctrl(){
   }
 }
 
+// Observe di furnace e alarm: a rete pronta e destinazioni note, e di nuovo se la lookup le
+// sposta o trova un attuatore che al primo giro mancava
+static void observe_actuator(coap_endpoint_t *ep) {
+  if(ep == &alarm_ep && peers[3].state != NODE_RUNTIME_PEER_NONE) {
+    LOG_INFO("Iscrizione alla risorsa res_alarm...\n");
+    coap_obs_request_registration(&alarm_ep, "res_alarm", alarm_handler, NULL);
+  } else if(ep == &furnace_ep && peers[2].state != NODE_RUNTIME_PEER_NONE) {
+    LOG_INFO("Iscrizione alla risorsa res_furnace...\n");
+    coap_obs_request_registration(&furnace_ep, "res_furnace", furnace_handler, NULL);
+  }
+}
+
 
 // =========== PROCESS THREAD =============
 
 PROCESS_THREAD(node_edge_process, ev, data)
 {
-  static uip_ipaddr_t dest_ipaddr;
-  char ipstr[64]; // temp ip root e server
-  char endpoint[128]; // indirizzo server root
   button_hal_button_t *btn;
+  static int payload_len;
 
   PROCESS_BEGIN();
 
   coap_engine_init();
 
-  start_missing_timer = process_alloc_event();
   ev_post_update = process_alloc_event();
+  ev_sample_ready = process_alloc_event();
 
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_FLOAT
   printf("%p\n", eml_net_activation_function_strs); // This is needed to avoid compiler error (warnings == errors)
   printf("%p\n", eml_error_str); // This is needed to avoid compiler error (warnings == errors)
+#endif
+
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 || PREDICTION_ENGINE == PREDICTION_ENGINE_FLOAT
+  LOG_INFO("Backend MLP: %s\n", mlp_backend_name());
+#if MLP_SELFTEST
+  LOG_INFO("Selftest backend MLP: %d errori\n", mlp_backend_selftest());
+#endif
+#endif
+#if MSG_BENCH
+  msg_bench_run(); // costo del parsing per messaggio: sscanf precedente contro codec generati
+#endif
 
   leds_single_on(LEDS_YELLOW);
-
-  // Ricerca del nodo root
-  etimer_set(&wait_timer, CLOCK_SECOND);
-  while(!NETSTACK_ROUTING.node_is_reachable() ||
-      !NETSTACK_ROUTING.get_root_ipaddr(&dest_ipaddr)) {
-  LOG_INFO("In attesa del root...\n");
-  leds_toggle(LEDS_RED);
-  PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&wait_timer));
-  etimer_reset(&wait_timer);
-  }
-  
-  leds_off(LEDS_RED);
-
-  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &dest_ipaddr);
-  snprintf(endpoint, sizeof(endpoint), "coap://[%s]:5683", ipstr);
-  LOG_INFO("Root trovato: %s\n", endpoint);
-
-  coap_endpoint_parse(SERVER_EP, strlen(SERVER_EP), &server_ep);
+  threshold_restore(); // soglie dell'ultima configurazione, anche prima del server
+  set_auto_ctrl();
 
   // Inizializzo risorse del nodo
   coap_activate_resource(&res_power, "res_power");
   coap_activate_resource(&res_roof, "res_roof");
+  coap_activate_resource(&res_batch, "res_batch");
+#if PIPE_STATS
+  res_stats.flags |= IS_OBSERVABLE;
+  coap_activate_resource(&res_stats, "res_stats");
+#endif
 
   // Risorsa osservabile
   res_threshold.flags |= IS_OBSERVABLE;
   coap_activate_resource(&res_threshold, "res_threshold");
+#if PREDICTION_FORECAST
+  res_forecast.flags |= IS_OBSERVABLE;
+  coap_activate_resource(&res_forecast, "res_forecast");
+#endif
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 && MODEL_STORE
+  // Modello aggiornabile via CoAP block-wise, slot A/B su CFS
+  model_store_init(PREDICTION_FEATURES, PREDICTION_OUTPUTS);
+  coap_activate_resource(&res_model, MODEL_PATH);
+#endif
+#if JOURNAL
+  // Record non consegnati prima del riavvio: si recuperano alla prima consegna
+  journal_init(sizeof(batch_record_t));
+#endif
+#if MLP_PROF
+  mlp_prof_register(&prof_pred, PREDICTION_FUSED ? "fused" : "next_power");
+#if PREDICTION_FORECAST
+  mlp_prof_register(&prof_fc, "forecast");
+#endif
+  coap_activate_resource(&res_prof, "res_prof");
+#endif
   
 
-   // === 1. REGISTRAZIONE + REGISTRAZIONE RISORSE ===
-  snprintf(json_buf, sizeof(json_buf),
-           "{\"id\":\"nodoEdge\", \"resources\":[\"/res_power\",\"/res_roof\",\"/res_threshold\"]}");
-
-  coap_init_message(request, COAP_TYPE_CON, COAP_POST, coap_get_mid());
-  coap_set_header_uri_path(request, "register");
-  coap_set_payload(request, (uint8_t *)json_buf, strlen(json_buf));
-
-  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &server_ep.ipaddr);
-  LOG_INFO("-> Invio a CoAP server IP: [%s], porta: %u\n", ipstr, uip_ntohs(server_ep.port));
-
-  COAP_BLOCKING_REQUEST(&server_ep, request, response_handler);
-  LOG_INFO("Registrazione completata\n");
-
-  leds_on(LEDS_GREEN);
-
-  // Richiesta timestamp alla Register
-  coap_init_message(request, COAP_TYPE_CON, COAP_GET, coap_get_mid());
-  coap_set_header_uri_path(request, "register");
-      
-  LOG_INFO("Chiedo il timestamp attuale\n");
-  COAP_BLOCKING_REQUEST(&server_ep, request, timestamp_handler);
-
-  // === 2. LOOKUP per risorse ===
-  char endpoint_uri[128];
-  int found = 0;
-
-  for (i = 0; i < SEARCH_RES; i++) {
-    found = 0;
-    attempts = 0;
-
-    while (!found) {
-      memset(target_ip, 0, sizeof(target_ip));
-      current_lookup_target = endpoints[i];     // imposta destinazione della lookup corrente
-
-      coap_init_message(request, COAP_TYPE_CON, COAP_GET, coap_get_mid());
-      coap_set_header_uri_path(request, "lookup");
-      snprintf(json_buf, sizeof(json_buf), "res=%s", res_list[i]);
-      
-      LOG_INFO("Cerco Risorsa %s\n", json_buf);
-      coap_set_header_uri_query(request, json_buf);
-      //LOG_INFO("Prima della COAP e %s, con indice %d\n", res_list[i], i);
-
-      COAP_BLOCKING_REQUEST(&server_ep, request, handle_lookup_response);
-      //LOG_INFO("Dopo della COAP e %s\n", res_list[i]);
-
-      if (strlen(target_ip) > 0) {
-        // tolte perchè lo faccio nell' handle_lookup_response
-        snprintf(endpoint_uri, sizeof(endpoint_uri), "coap://[%s]", target_ip);
-        coap_endpoint_parse(endpoint_uri, strlen(endpoint_uri), endpoints[i]);
-        found = 1;
-      } else {
-        LOG_WARN("Lookup fallito per %s, tentativo %d\n", res_list[i], attempts + 1);
-        clock_wait(CLOCK_SECOND / 2); // 500ms
-        attempts++;
-      }
-    }
-
-    if (!found) {
-      LOG_INFO("Errore: lookup fallito per %s\n", res_list[i]);
-    }
-  }
+  // === REGISTRAZIONE E LOOKUP (node/node_runtime.h) ===
+  // Root, registrazione, orario e lookup in node_runtime_process, con backoff sui fallimenti:
+  // gli eventi ev_runtime_* arrivano nel ciclo, che intanto serve gia' sensori e bottone
+  node_runtime_start(registration, peers, SEARCH_RES);
 
-  // === 3. OBSERVE RESOURCE ===
-  LOG_INFO("Iscrizione alla risorsa res_alarm...\n");
-  coap_obs_request_registration(&alarm_ep, "res_alarm", alarm_handler, NULL);
-
-  LOG_INFO("Iscrizione alla risorsa res_furnace...\n");
-  coap_obs_request_registration(&furnace_ep, "res_furnace", furnace_handler, NULL);
-  
-  // === 4. CICLO INFINITO ===
+  // === CICLO INFINITO ===
   while(1) {
     PROCESS_WAIT_EVENT();
     //LOG_INFO("Evento ricevuto: %u\n", ev);
 
-    // Gestione evento dati mancanti, avvio timer
-    if(ev == start_missing_timer){
-      etimer_set(&missing_timer, CLOCK_SECOND * 15);  // timer di 14 secondi 
-      LOG_INFO("Timer partito: in attesa dell'altra risorsa...\n");
+    if(ev == ev_runtime_registered) {
+      leds_on(LEDS_GREEN);
+      registered = 1;
+      if(node_runtime_ready()) {
+        observe_actuator(&alarm_ep);
+        observe_actuator(&furnace_ep);
+      }
+    }
+    if(ev == ev_runtime_ready) {
+      LOG_INFO("Destinazioni pronte\n");
+      if(registered) {
+        observe_actuator(&alarm_ep);
+        observe_actuator(&furnace_ep);
+      }
+      batch_flush(); // record raccolti prima che le destinazioni fossero note
+    }
+    if(ev == ev_runtime_changed) {
+      observe_actuator(((node_runtime_peer_t *)data)->ep);
+      batch_flush();
     }
 
-    // Controllo se ci sono dati da inviare
-    if (ev == ev_post_update) {
+    // Senza destinazioni note (primo avvio, lookup in corso) il ciclo non ha dove inviare:
+    // il record va comunque nel ring (con JOURNAL anche nel journal) e parte con il primo
+    // batch a destinazioni pronte; i comandi agli attuatori restano in attesa
+    if (ev == ev_post_update && !node_runtime_ready()) {
+      LOG_WARN("Destinazioni non ancora note, invio rimandato\n");
+      batch_collect();
+    } else if (ev == ev_post_update) {
+      PIPE_STATS_ADD(PIPE_DECIDE, RTIMER_NOW() - infer_done);
       leds_off(LEDS_GREEN);
-      leds_on(LEDS_BLUE); // inizia a inviare
-
-      /* === POST DATA === */
-      LOG_INFO("Invio DATA e PREDICTION al server\n");
-      snprintf(json_buf, sizeof(json_buf),
-               "{\"ts\":\"%s\",\"sol\":%d,\"mese\":%d,\"ora\":%d,\"temp\":%d,\"hum\":%d,\"pow\":%d}", // gestire float
-               timestamp, solar, mese, ora, temperature, humidity, power);
-      coap_init_message(request, COAP_TYPE_CON, COAP_POST, coap_get_mid());
-      coap_set_header_uri_path(request, "res_data");
-      coap_set_payload(request, (uint8_t *)json_buf, strlen(json_buf));
-      COAP_BLOCKING_REQUEST(&data_ep, request, response_handler);
-
-      /* === POST PREDICTION === */
-      //LOG_INFO("Invio PREDICTION\n");
-      snprintf(json_buf, sizeof(json_buf),
-               "{\"ts\":\"%s\",\"nPow\":%d,\"nSol\":%d, \"miss\":%d}", // gestire float
-               timestamp, nextPower, nextSolar, missing);
-      coap_init_message(request, COAP_TYPE_CON, COAP_POST, coap_get_mid());
-      coap_set_header_uri_path(request, "res_prediction");
-      coap_set_payload(request, (uint8_t *)json_buf, strlen(json_buf));
-      COAP_BLOCKING_REQUEST(&pred_ep, request, response_handler);
-
-      /* === POST ALARM e FURNACE === */ //
-      if(alarm_change){
-        LOG_INFO("MANDO a alarm: %d\n", alarm_state);
-        snprintf(json_buf, sizeof(json_buf),
-                "{\"alarm_state\":%d}", alarm_state);
-        coap_init_message(request, COAP_TYPE_CON, COAP_PUT, coap_get_mid());
-        coap_set_header_uri_path(request, "res_alarm");
-        coap_set_payload(request, (uint8_t *)json_buf, strlen(json_buf));
-        COAP_BLOCKING_REQUEST(&alarm_ep, request, response_handler);
+      leds_on(LEDS_BLUE); // inizia a inviare, spento da send_done a coda vuota
+
+      // Richieste accodate senza bloccare il processo: i PUT agli attuatori hanno priorita'
+      // sulla telemetria e partono per primi anche se DATA e PREDICTION sono gia' in coda
+      /* === PUT FURNACE e ALARM === */
+#if COAP_GROUP
+      // Un solo frame multicast per tutti gli attuatori, conferme dalle notifiche observe
+      if(furnace_change || alarm_change) {
+        group_send((furnace_change ? COAP_GROUP_FURNACE : 0) | (alarm_change ? COAP_GROUP_ALARM : 0));
+        furnace_change = 0;
         alarm_change = 0;
       }
+#else
       if(furnace_change){
-        LOG_INFO("MANDO a furnace: %d\n", furnace_state);
-        snprintf(json_buf, sizeof(json_buf),
-                "{\"furnace_state\":%d}", furnace_state);
-        coap_init_message(request, COAP_TYPE_CON, COAP_PUT, coap_get_mid());
-        coap_set_header_uri_path(request, "res_furnace");
-        coap_set_payload(request, (uint8_t *)json_buf, strlen(json_buf));
-        COAP_BLOCKING_REQUEST(&furnace_ep, request, response_handler);
+        send_furnace();
         furnace_change = 0;
       }
-      leds_off(LEDS_BLUE); // Spegnimento LED dopo invio
-      leds_on(LEDS_GREEN);
-    }
-
-    // Gestione evento dati non ricevuti in tempo
-    if (ev == PROCESS_EVENT_TIMER && data == &missing_timer && timer_running) {
-      // Timer scaduto, forza regressione
-      LOG_INFO("Timeout raggiunto: regressione con dati precedenti\n");
-      predict_and_send(1); 
+      if(alarm_change){
+        send_alarm();
+        alarm_change = 0;
+      }
+#endif
 
-      // reset flags
-      roof_updated = 0;
-      power_updated = 0;
-      timer_running = 0;
+      /* === POST DATA e PREDICTION === */
+      if(batch_size > 1 || JOURNAL) {
+        // Un record nel ring, un solo POST su /res_bulk ogni batch_size cicli
+        // (con JOURNAL sempre, anche con batch_size 1, per non perdere i record non consegnati)
+        batch_collect();
+      } else {
+        LOG_INFO("Invio DATA e PREDICTION al server\n");
+        payload_len = encode_data();
+        coap_queue_send(&data_ep, COAP_POST, "res_data", endpoint_format[0], (uint8_t *)json_buf, payload_len,
+                        COAP_QUEUE_PRIO_TELEMETRY, 0, sample_origin, send_done, &endpoint_format[0]);
+        payload_len = encode_prediction();
+        coap_queue_send(&pred_ep, COAP_POST, "res_prediction", endpoint_format[1], (uint8_t *)json_buf, payload_len,
+                        COAP_QUEUE_PRIO_TELEMETRY, 0, sample_origin, send_done, &endpoint_format[1]);
+        batch_flush(); // record rimasti nel ring dopo aver disattivato il batch
+      }
+      if(coap_queue_idle()) {
+        leds_off(LEDS_BLUE);
+        leds_on(LEDS_GREEN);
+      }
     }
 
     // Bottone premuto per attivare/disattivare controllo automatico della furnace
@@ -520,6 +1019,7 @@ PROCESS_THREAD(node_edge_process, ev, data)
           auto_furnace_ctrl = 0;
           coap_notify_observers(&res_threshold); 
           set_auto_ctrl();
+          threshold_store();
         }
       } else{
       //LOG_INFO("Bottone premuto, auto control ON\n");
@@ -528,8 +1028,125 @@ PROCESS_THREAD(node_edge_process, ev, data)
           auto_furnace_ctrl = 1;
           coap_notify_observers(&res_threshold); 
           set_auto_ctrl();
+          threshold_store();
+        }
+      }
+    }
+  }
+
+  PROCESS_END();
+}
+
+// =========== INFERENZA A PASSI =============
+// Un layer per slice con PROCESS_PAUSE() tra uno e l'altro: gli handler CoAP, il
+// processo principale e lo stack di rete non aspettano la fine dell'intera rete.
+PROCESS_THREAD(inference_process, ev, data)
+{
+  static float inputs[PREDICTION_FEATURES];
+  static float outputs[PREDICTION_OUTPUTS];
+  static uint8_t layer;
+  static int32_t more;
+  static rtimer_clock_t t0;
+#if PREDICTION_FORECAST
+  static float fc_inputs[FEATURE_COUNT];
+  static float fc_outputs[PREDICTION_FORECAST_HORIZON];
+  static int fc_hour, h;
+#endif
+
+  PROCESS_BEGIN();
+
+  while(1) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == ev_sample_ready);
+
+    while(inference_pending) {
+      inference_pending = 0;
+      sample_origin = inference_origin;
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 && MODEL_STORE
+      // Nuovo modello verificato: lo scambio avviene solo tra due inferenze
+      if(model_store_swap_pending() && model_store_activate() == MODEL_STORE_OK) {
+#if MLP_Q8_MEMO && !PREDICTION_FUSED
+        mlp_q8_memo_invalidate(&power_memo);
+#endif
+      }
+#endif
+      fill_inputs(inputs);
+      infer_busy = 0;
+      infer_slice_max = 0;
+      infer_slices = 0;
+
+      layer = 0;
+      do {
+        t0 = RTIMER_NOW();
+        MLP_PROF_START(&prof_pred);
+        more = prediction_step(layer, inputs, PREDICTION_FEATURES, outputs, PREDICTION_OUTPUTS);
+        MLP_PROF_END(&prof_pred, layer, more);
+        account_slice(t0);
+        layer++;
+        if(more > 0) {
+          PROCESS_PAUSE();
+        }
+      } while(more > 0);
+      infer_total = (uint32_t)(RTIMER_NOW() - inference_requested);
+      PIPE_STATS_ADD(PIPE_INFER, infer_total);
+      infer_done = RTIMER_NOW();
+
+      if(more < 0) {
+        LOG_WARN("Modello non compatibile con %d ingressi e %d uscite\n", PREDICTION_FEATURES, PREDICTION_OUTPUTS);
+        continue;
+      }
+#if PREDICTION_FUSED
+      nextSolar = outputs[0] > 0 ? (int)(outputs[0] * 100) : 0; // stessa scala di predict_next_solar() del roof
+      nextPower = (outputs[1] > 0 ? (int)outputs[1] : 0) * 2;
+#else
+      nextPower = (outputs[0] > 0 ? (int)outputs[0] : 0) * 2;
+#endif
+
+      LOG_INFO("Latenza PUT handler: ultima %lu us, max %lu us\n",
+               TICKS_TO_US(handler_last), TICKS_TO_US(handler_max));
+      LOG_INFO("Latenza inferenza: %lu us di calcolo in %u slice (max %lu us), %lu us dalla richiesta\n",
+               TICKS_TO_US(infer_busy), infer_slices, TICKS_TO_US(infer_slice_max), TICKS_TO_US(infer_total));
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 && MLP_Q8_MEMO && !PREDICTION_FUSED
+      if(power_memo.stats.calls % MEMO_LOG_EVERY == 0) {
+        LOG_INFO("Memo MLP: %lu previsioni, hit %lu%% (%lu ingresso, %lu layer 0), %lu incrementali, %lu kMAC e %lu ms risparmiati\n",
+                 (unsigned long)power_memo.stats.calls, (unsigned long)mlp_q8_memo_hit_rate(&power_memo.stats),
+                 (unsigned long)power_memo.stats.hits, (unsigned long)power_memo.stats.l0_hits,
+                 (unsigned long)power_memo.stats.incremental, (unsigned long)(power_memo.stats.macs_saved / 1000),
+                 (unsigned long)mlp_q8_memo_ms_saved(&power_memo.stats));
+      }
+#endif
+
+      decide_and_send(inference_missing);
+
+#if PREDICTION_FORECAST
+      // Previsione delle prossime 24 ore: una sola inferenza sul tronco condiviso, una volta per ora,
+      // dopo l'invio cosi' non ritarda le decisioni su furnace e allarme
+      if(ora != forecast_hour) {
+        fc_hour = ora;
+        fc_inputs[0] = (float)power/100;
+        fc_inputs[1] = (float)mese; fc_inputs[2] = (float)ora; fc_inputs[3] = (float)temperature; fc_inputs[4] = (float)humidity;
+        layer = 0;
+        do {
+          MLP_PROF_START(&prof_fc);
+          more = forecast_step(layer, fc_inputs, FEATURE_COUNT, fc_outputs, PREDICTION_FORECAST_HORIZON);
+          MLP_PROF_END(&prof_fc, layer, more);
+          layer++;
+          if(more > 0) {
+            PROCESS_PAUSE();
+          }
+        } while(more > 0);
+
+        if(more < 0) {
+          LOG_WARN("Modello forecast non compatibile con %d uscite\n", PREDICTION_FORECAST_HORIZON);
+        } else {
+          for(h = 0; h < PREDICTION_FORECAST_HORIZON; h++) {
+            forecast_power[h] = (fc_outputs[h] > 0 ? (int)fc_outputs[h] : 0) * 2;
+          }
+          forecast_hour = fc_hour;
+          LOG_INFO("Forecast aggiornato alle ore %d: +1h=%d, +24h=%d\n", fc_hour, forecast_power[0], forecast_power[PREDICTION_FORECAST_HORIZON - 1]);
+          coap_notify_observers(&res_forecast);
         }
       }
+#endif
     }
   }
 
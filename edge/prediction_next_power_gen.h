@@ -0,0 +1,286 @@
+/* Generato da tools/eml_codegen.py a partire da edge/prediction_next_power.h */
+#include <stdint.h>
+#include <math.h>
+static const float prediction_next_power_gen_layer_0_biases[48] = { -0.095787f, 0.053528f, 0.079074f, 0.142708f, -0.179610f, 0.086134f, -0.018681f, 0.133128f, -0.086337f, 0.047642f, -0.107572f, -0.042752f, 0.054063f, 0.054483f, 0.093450f, -0.013526f, -0.089987f, 0.043884f, -0.003953f, -0.242456f, 0.152206f, -0.025819f, 0.000454f, 0.091491f, -0.085621f, -0.010688f, 0.037618f, 0.019357f, 0.040949f, -0.044883f, -0.092112f, 0.050006f, 0.040194f, 0.101586f, 0.147980f, -0.086410f, 0.028175f, -0.069260f, 0.013889f, 0.097322f, 0.158988f, 0.184755f, -0.043150f, -0.037077f, 0.136938f, 0.026867f, -0.074372f, 0.045473f };
+static const float prediction_next_power_gen_layer_0_weights[240] = { 0.065781f, -0.143148f, 0.496819f, -0.308597f, -0.096491f, 0.181835f, 0.117254f, 0.121287f, 0.008909f, 0.190424f, -0.043941f, 0.211267f, -0.716215f, 0.376560f, 0.060120f, -0.465290f, -0.097572f, -0.100594f, -0.068563f, 0.315461f, 0.111070f, -0.214640f, 0.320883f, 0.127430f, -0.385293f, 0.237669f, -0.220079f, 0.448137f, -0.112350f, 0.011567f, -0.361295f, -0.075680f, -0.164962f, 0.053621f, -0.125212f, -0.246386f, 0.131505f, -0.227447f, 0.062893f, 0.235671f, 0.024924f, 0.202520f, 0.119109f, 0.238828f, -0.298336f, 0.293463f, -0.246186f, -0.167021f, 0.049908f, 0.321761f, -0.222530f, 0.244967f, -0.107569f, 0.323870f, -0.224619f, 0.194627f, 0.233996f, -0.076797f, -0.164819f, 0.097780f, -0.254772f, 0.304897f, -0.277430f, -0.257295f, -0.140875f, -0.430739f, -0.244040f, 0.279318f, -0.141809f, 0.040507f, 0.116527f, 0.366036f, -0.242117f, 0.192848f, 0.064853f, -0.012071f, -0.120451f, -0.108123f, -0.491185f, 0.039036f, 0.022702f, 0.431071f, 0.401668f, -0.180136f, -0.275763f, 0.017717f, -0.012720f, -0.175148f, 0.138129f, 0.046087f, 0.153297f, 0.087906f, -0.000823f, -0.230681f, -0.219871f, 0.050798f, -0.001692f, -0.172207f, 0.227516f, -0.099134f, 0.229250f, 0.019303f, 0.260956f, 0.186876f, -0.099283f, 0.206882f, 0.098190f, 0.000873f, 0.217489f, -0.197653f, 0.117224f, 0.012953f, -0.178438f, 0.344891f, 0.038959f, 0.282869f, 0.155976f, 0.243061f, 0.137654f, 0.094570f, 0.115690f, -0.494467f, -0.175420f, -0.064693f, -0.033773f, -0.266064f, 0.372218f, 0.121391f, 0.144999f, -0.243115f, 0.105300f, -0.073294f, 0.367558f, 0.287058f, -0.173157f, 0.200857f, 0.254275f, -0.191134f, 0.286639f, -0.388374f, -0.515964f, 0.165244f, -0.014891f, 0.276939f, -0.043008f, 0.008923f, 0.217619f, 0.025710f, 0.200299f, 0.024123f, -0.373264f, -0.068599f, 0.236248f, 0.071344f, 0.336923f, 0.001855f, -0.221840f, -0.660433f, 0.318329f, 0.112553f, 0.226795f, -0.260059f, -0.363274f, 0.326556f, 0.206504f, 0.172647f, -0.097653f, 0.187823f, -0.147679f, -0.162700f, -0.253840f, -0.399879f, -0.080904f, 0.211170f, -0.000177f, -0.037040f, 0.232602f, -0.308539f, -0.175171f, -0.123437f, 0.041972f, -0.034855f, 0.273711f, 0.135960f, 0.187741f, -0.369653f, 0.075012f, -0.274245f, -0.220307f, -0.245722f, 0.232376f, 0.156707f, -0.411273f, 0.017647f, 0.145241f, 0.144922f, 0.092641f, 0.376455f, -0.146618f, 0.258865f, 0.234442f, -0.028676f, 0.028876f, -0.170578f, 0.044203f, -0.099372f, 0.390496f, -0.199390f, -0.226818f, 0.131972f, 0.076045f, -0.162639f, -0.342111f, 0.077437f, 0.185454f, 0.068312f, 0.156814f, 0.071822f, -0.080672f, 0.227562f, 0.062056f, -0.432417f, 0.262163f, 0.371167f, 0.132109f, 0.147218f, -0.318847f, -0.267695f, 0.118587f, -0.046702f, -0.476969f, 0.226081f, 0.282393f, -0.277314f, 0.001139f, 0.178915f, -0.341894f, -0.129244f, 0.065281f, -0.187463f };
+static const float prediction_next_power_gen_layer_1_biases[80] = { -0.024793f, -0.169388f, 0.114125f, 0.080763f, -0.052240f, 0.050198f, 0.096861f, 0.110294f, -0.052729f, 0.108880f, 0.090831f, -0.063472f, 0.051951f, 0.157290f, 0.066023f, -0.031220f, -0.003030f, 0.060180f, 0.083475f, 0.100617f, 0.032301f, 0.085242f, 0.052058f, -0.099221f, 0.036145f, -0.091583f, 0.029294f, 0.113120f, 0.012048f, 0.065801f, 0.046325f, 0.027140f, -0.124830f, 0.016537f, 0.076843f, 0.165679f, 0.158620f, 0.092802f, -0.112178f, 0.145313f, -0.062472f, 0.081619f, 0.051061f, -0.149050f, 0.161570f, 0.043876f, 0.067501f, 0.051616f, 0.080307f, -0.123881f, 0.145285f, 0.019371f, 0.135247f, 0.026443f, -0.048295f, 0.027025f, 0.020642f, 0.023577f, 0.028569f, 0.013324f, 0.083516f, 0.066111f, -0.104327f, 0.178449f, -0.043033f, 0.084655f, 0.045534f, 0.052976f, 0.068830f, -0.117568f, 0.133282f, 0.044711f, -0.111137f, -0.032005f, -0.125068f, -0.003953f, -0.294396f, 0.076432f, -0.035462f, 0.088825f };
+static const float prediction_next_power_gen_layer_1_weights[3840] = { 0.146662f, -0.032443f, 0.106828f, 0.069336f, -0.191938f, 0.144181f, 0.004794f, -0.214013f, 0.093242f, -0.163975f, -0.077603f, 0.118292f, -0.301930f, 0.062962f, -0.026763f, 0.177891f, -0.270760f, -0.206776f, 0.132828f, 0.158372f, -0.148283f, 0.008978f, -0.113745f, 0.045371f, 0.003635f, -0.229992f, -0.028120f, 0.102599f, -0.062805f, -0.040139f, 0.218273f, 0.116870f, -0.128858f, -0.087775f, -0.270312f, 0.042123f, 0.014480f, -0.289478f, 0.034329f, 0.264542f, -0.097253f, 0.132303f, -0.117234f, -0.113514f, -0.055658f, 0.029662f, 0.130030f, 0.059979f, 0.109606f, 0.033875f, 0.215510f, 0.014563f, -0.302828f, -0.056344f, -0.057750f, 0.034139f, -0.177754f, 0.014051f, 0.113163f, 0.076246f, -0.531933f, -0.083302f, 0.004404f, 0.000389f, -0.352235f, 0.045160f, -0.162048f, 0.207476f, -0.253218f, 0.100547f, -0.083242f, -0.094621f, 0.061002f, -0.662172f, -0.312183f, 0.193139f, -0.281106f, 0.136007f, -0.068338f, 0.127221f, -0.070426f, -0.013260f, -0.322209f, 0.191366f, -0.366453f, 0.027324f, -0.064695f, -0.575348f, -0.246748f, -0.189436f, 0.186321f, -0.012297f, -0.597372f, 0.179721f, -0.004858f, 0.210777f, -0.112570f, 0.011435f, 0.070897f, 0.071786f, 0.003334f, 0.007276f, 0.036985f, -0.231796f, -0.111998f, 0.142086f, -0.099059f, -0.068451f, -0.248623f, 0.020484f, 0.172104f, 0.060663f, -0.140317f, 0.005679f, -0.035205f, -0.146018f, -0.062019f, -0.033180f, -0.156287f, 0.046547f, 0.026326f, -0.124764f, 0.053661f, 0.159685f, 0.076359f, 0.145065f, -0.183061f, -0.281384f, 0.138059f, 0.228835f, -0.272853f, -0.175522f, -0.080884f, -0.275110f, 0.107768f, 0.236894f, 0.211711f, 0.022030f, 0.118597f, -0.207204f, 0.046271f, 0.146818f, 0.189339f, 0.013396f, 0.148515f, 0.197397f, -0.044128f, -0.260259f, 0.032449f, -0.056190f, 0.055007f, 0.120093f, 0.097350f, 0.002436f, 0.248169f, 0.087060f, -0.267895f, -0.159766f, -0.008390f, 0.203472f, 0.124591f, 0.150283f, -0.132429f, 0.230072f, 0.047241f, 0.001489f, -0.078025f, -0.019693f, -0.223085f, 0.030986f, -0.175926f, 0.165337f, -0.044533f, -0.019393f, 0.049063f, -0.174468f, -0.106869f, -0.129104f, -0.205743f, -0.019381f, -0.151399f, -0.105546f, 0.024117f, 0.057475f, 0.156328f, -0.205758f, 0.176534f, 0.115298f, 0.219504f, 0.177761f, -0.097573f, -0.053075f, 0.058205f, 0.232431f, -0.048367f, -0.362594f, 0.202189f, 0.182274f, -0.029258f, -0.149904f, 0.213698f, -0.145896f, -0.135256f, -0.192526f, 0.040565f, 0.100088f, -0.129827f, 0.032744f, -0.211525f, 0.195730f, 0.185763f, 0.203645f, -0.079182f, 0.171753f, 0.106756f, -0.026736f, -0.119112f, 0.056765f, -0.126865f, -0.108950f, -0.172559f, -0.128177f, 0.115195f, 0.109012f, 0.164697f, -0.226398f, -0.174185f, -0.085135f, -0.139520f, -0.006273f, -0.176488f, -0.208303f, -0.145905f, -0.017912f, -0.004641f, -0.131417f, -0.181726f, 0.068135f, -0.050447f, 0.180345f, -0.283317f, 0.074588f, 0.077912f, -0.025951f, 0.114235f, -0.107677f, -0.277624f, 0.167777f, 0.084611f, -0.092637f, -0.172878f, 0.122291f, -0.423060f, 0.008189f, -0.097810f, 0.006640f, -0.310627f, 0.151949f, 0.067769f, 0.194544f, 0.148547f, -0.084660f, -0.051555f, 0.063522f, -0.061157f, -0.155960f, -0.065294f, 0.189951f, -0.039475f, 0.117612f, 0.091302f, -0.034738f, 0.046674f, 0.116936f, -0.113801f, 0.044995f, 0.030820f, -0.096379f, -0.208354f, -0.091870f, -0.212959f, -0.171173f, -0.113550f, -0.136919f, 0.134899f, -0.136618f, 0.103263f, 0.013922f, -0.025147f, -0.193814f, -0.308902f, -0.180385f, -0.172866f, 0.192653f, -0.076153f, 0.155475f, 0.187597f, 0.155794f, -0.029701f, 0.161852f, 0.003517f, 0.210718f, -0.003970f, 0.105930f, -0.253415f, 0.110477f, 0.037453f, 0.256790f, 0.227460f, 0.096002f, -0.014110f, -0.026513f, -0.067711f, 0.088254f, -0.198445f, 0.182924f, -0.207861f, 0.173519f, -0.229184f, -0.091389f, 0.215511f, -0.087877f, -0.039499f, 0.088636f, -0.148778f, -0.238903f, 0.118460f, 0.167895f, 0.097985f, -0.173807f, -0.001825f, -0.116471f, -0.000937f, 0.013548f, -0.046901f, 0.153479f, 0.020721f, -0.057441f, 0.046648f, 0.002159f, 0.201070f, 0.128104f, -0.261645f, -0.027964f, 0.271119f, 0.196786f, -0.034247f, -0.089795f, -0.102607f, -0.132562f, 0.021267f, 0.154507f, 0.162804f, -0.094582f, 0.128688f, -0.069188f, 0.034062f, -0.035077f, 0.021414f, 0.193569f, 0.064584f, -0.176173f, 0.175533f, 0.171437f, -0.097122f, 0.119455f, -0.093865f, -0.024064f, 0.220250f, 0.231014f, -0.184935f, 0.007002f, 0.136198f, -0.337929f, 0.033577f, -0.171011f, -0.046248f, 0.004151f, -0.170056f, 0.162963f, -0.046720f, 0.167455f, 0.140214f, 0.072400f, -0.017426f, -0.151428f, -0.075947f, -0.028058f, -0.230770f, 0.025158f, -0.041092f, -0.160558f, -0.147141f, 0.005252f, 0.177816f, -0.086399f, -0.138943f, -0.116749f, 0.155130f, -0.171216f, 0.000265f, -0.196996f, -0.220902f, -0.173518f, -0.033999f, 0.007826f, -0.224016f, 0.147762f, -0.048769f, -0.124245f, 0.020860f, -0.107839f, -0.095692f, 0.003392f, -0.047615f, -0.154267f, 0.068595f, 0.152481f, -0.083427f, 0.158582f, 0.147199f, -0.088326f, 0.105231f, -0.126864f, 0.155506f, -0.044751f, 0.022636f, -0.166295f, -0.205302f, -0.230281f, -0.177898f, 0.107194f, -0.276023f, -0.003510f, -0.078145f, -0.007746f, -0.175725f, 0.103199f, 0.241008f, 0.118133f, 0.094112f, 0.172536f, 0.166376f, -0.049277f, 0.010550f, 0.088512f, -0.156801f, 0.273047f, -0.288036f, 0.203156f, 0.198195f, 0.171914f, -0.018964f, 0.217803f, 0.190993f, 0.136749f, -0.068620f, -0.081860f, 0.118309f, -0.188942f, 0.016464f, -0.164024f, -0.032421f, -0.169096f, -0.120161f, -0.146900f, -0.266971f, -0.270126f, -0.120052f, -0.214504f, 0.210939f, -0.199787f, 0.075621f, 0.064955f, -0.120208f, -0.080666f, -0.148061f, 0.108198f, -0.263855f, 0.096298f, -0.039111f, 0.089058f, 0.110205f, -0.074654f, -0.090744f, 0.127731f, -0.364343f, -0.178134f, -0.041939f, 0.093316f, 0.124711f, -0.113818f, -0.297559f, 0.052209f, 0.224772f, 0.237105f, -0.257269f, 0.148195f, 0.142947f, 0.028157f, 0.209568f, -0.027278f, 0.209788f, -0.120200f, 0.094233f, -0.436819f, -0.016059f, -0.032247f, -0.233302f, -0.133554f, 0.055913f, -0.217223f, 0.128114f, -0.145692f, -0.312284f, -0.030613f, -0.081263f, -0.320677f, 0.178134f, 0.135106f, 0.006906f, 0.053562f, -0.034931f, 0.157905f, 0.045515f, -0.026292f, -0.124516f, -0.082434f, -0.237676f, 0.050983f, 0.096357f, 0.196213f, -0.006336f, -0.056998f, 0.324767f, 0.118579f, 0.163017f, 0.102458f, -0.120616f, -0.193718f, 0.160549f, -0.279512f, -0.112057f, 0.014030f, -0.269215f, 0.205154f, 0.155615f, -0.178302f, 0.052403f, 0.043336f, -0.181391f, -0.067462f, 0.270277f, 0.061574f, -0.191487f, -0.045268f, -0.296136f, 0.068296f, -0.218024f, 0.297051f, -0.113455f, 0.061896f, -0.128390f, -0.019434f, -0.276348f, 0.209384f, -0.010535f, -0.340287f, 0.039179f, 0.126748f, 0.263801f, 0.090953f, -0.059553f, 0.014662f, -0.142276f, -0.053969f, 0.063875f, -0.213067f, -0.345449f, -0.364159f, -0.036833f, -0.162077f, -0.239194f, 0.100289f, -0.168202f, 0.008074f, 0.031822f, -0.030961f, 0.047162f, -0.014622f, -0.009132f, 0.121071f, -0.205666f, -0.070857f, -0.207559f, 0.025116f, 0.178249f, 0.039812f, 0.076167f, -0.033934f, -0.056382f, -0.292392f, 0.157287f, 0.078301f, -0.120302f, -0.073169f, -0.160281f, -0.380875f, 0.130530f, -0.040731f, -0.273590f, -0.034532f, 0.088649f, -0.170684f, 0.015152f, 0.168623f, 0.018887f, -0.066415f, 0.207264f, -0.231729f, 0.155503f, -0.047019f, -0.130781f, 0.086134f, -0.092672f, -0.092812f, -0.469997f, -0.367300f, 0.206483f, 0.149287f, -0.055927f, -0.120764f, -0.093199f, -0.063109f, -0.129140f, -0.141080f, -0.123797f, -0.121362f, -0.161994f, 0.301527f, -0.113262f, 0.237160f, -0.036006f, 0.033670f, -0.127640f, -0.004740f, 0.110232f, 0.212053f, 0.165992f, 0.016464f, 0.216680f, 0.016484f, -0.492307f, -0.037214f, -0.124582f, -0.275174f, -0.012961f, 0.057725f, 0.026509f, 0.195892f, -0.093854f, 0.110990f, 0.168146f, 0.078139f, 0.166875f, -0.115894f, -0.136495f, 0.150412f, 0.204706f, 0.131341f, -0.150501f, 0.147421f, 0.093505f, 0.094775f, 0.020760f, 0.012701f, 0.057598f, -0.074513f, -0.204482f, 0.170452f, -0.064154f, 0.036137f, 0.110134f, -0.179604f, -0.027762f, 0.024177f, -0.144723f, -0.213093f, -0.022856f, 0.208787f, -0.130266f, 0.038559f, -0.137369f, 0.135392f, 0.165174f, 0.146750f, 0.080618f, -0.283018f, 0.062306f, -0.132931f, 0.019339f, 0.115768f, -0.085438f, -0.222103f, -0.072234f, -0.001196f, 0.047115f, -0.237089f, -0.065932f, -0.053512f, 0.066922f, -0.206559f, -0.120147f, 0.076215f, -0.214808f, -0.108771f, 0.054528f, 0.141018f, -0.376711f, 0.210715f, -0.027404f, 0.034368f, 0.092974f, 0.100143f, -0.123621f, -0.189459f, 0.017120f, -0.175443f, -0.210862f, -0.046946f, -0.038415f, -0.030078f, -0.169108f, -0.165346f, -0.213691f, -0.006764f, 0.112262f, -0.016912f, -0.088592f, -0.031479f, -0.011918f, -0.209831f, 0.215637f, 0.033670f, -0.092331f, -0.079284f, 0.149862f, -0.203690f, -0.085210f, -0.196210f, -0.081904f, -0.145032f, -0.183988f, 0.001517f, -0.009281f, 0.037416f, 0.071715f, -0.148481f, -0.049018f, -0.226672f, 0.107504f, -0.011661f, -0.012468f, 0.065351f, -0.206153f, 0.158990f, -0.108562f, -0.032157f, 0.021368f, -0.020175f, 0.051865f, -0.041949f, -0.188705f, -0.014436f, 0.025860f, -0.096924f, -0.148709f, -0.156539f, 0.044807f, 0.018355f, -0.036505f, 0.000296f, -0.067187f, -0.120780f, 0.089833f, 0.177801f, -0.202368f, -0.163318f, -0.136092f, 0.001748f, -0.012849f, 0.171395f, -0.238225f, -0.087820f, 0.137502f, -0.009532f, -0.323363f, 0.166143f, 0.064035f, -0.054462f, 0.211049f, 0.022859f, -0.216362f, 0.114252f, -0.083719f, -0.263695f, 0.110379f, -0.202313f, 0.072087f, -0.204594f, 0.080329f, 0.054601f, 0.040326f, -0.158537f, 0.076712f, -0.173271f, 0.034583f, 0.014038f, -0.109528f, -0.258430f, 0.053288f, -0.181579f, 0.076940f, 0.107241f, 0.188667f, -0.029030f, -0.143478f, -0.039756f, -0.311210f, -0.110754f, 0.212446f, -0.270620f, 0.032837f, 0.116037f, -0.205655f, 0.022925f, 0.251429f, 0.110169f, 0.047010f, -0.099863f, -0.430086f, 0.175171f, -0.126253f, 0.225306f, -0.039510f, 0.087320f, 0.101508f, -0.063916f, -0.004622f, 0.025340f, -0.038890f, -0.096288f, 0.150080f, 0.068373f, -0.029743f, 0.011752f, -0.051857f, -0.173172f, 0.145806f, -0.162575f, -0.006775f, 0.190060f, -0.040229f, -0.168257f, -0.060447f, 0.007511f, -0.078733f, -0.244612f, -0.236657f, -0.042367f, -0.268656f, -0.003550f, -0.065385f, -0.148911f, 0.121968f, -0.049572f, 0.020766f, -0.090611f, 0.094280f, 0.340253f, -0.052307f, -0.023950f, 0.172128f, 0.116535f, 0.087050f, -0.046208f, 0.031013f, 0.114201f, -0.120847f, -0.137996f, 0.142368f, 0.212376f, -0.355251f, -0.149278f, -0.043679f, -0.286453f, 0.084893f, 0.106873f, -0.352249f, 0.187047f, -0.027868f, -0.022718f, 0.119706f, -0.025053f, 0.114017f, -0.060031f, -0.084082f, -0.218873f, 0.104215f, -0.178635f, 0.179594f, 0.125039f, -0.199322f, -0.039449f, -0.232665f, 0.004658f, 0.018556f, 0.019515f, -0.055822f, 0.043520f, -0.114543f, 0.113405f, 0.026178f, 0.072890f, 0.031185f, -0.158970f, 0.072707f, 0.099150f, 0.053618f, 0.164854f, 0.219983f, -0.045498f, 0.203984f, 0.110198f, 0.203675f, 0.196980f, -0.210598f, -0.144048f, 0.190210f, 0.257422f, -0.134076f, 0.228385f, 0.008029f, -0.188979f, 0.130667f, 0.151451f, -0.051882f, -0.249917f, 0.145599f, -0.121147f, 0.160466f, -0.184472f, 0.056557f, 0.065788f, -0.197368f, -0.213954f, 0.243480f, -0.173198f, -0.007098f, 0.082036f, -0.020581f, -0.042529f, -0.235792f, -0.379858f, -0.122256f, 0.194456f, 0.042515f, -0.288069f, 0.093494f, -0.061014f, 0.018364f, 0.038462f, -0.076899f, 0.070011f, -0.068398f, 0.190363f, -0.247441f, 0.008265f, -0.011854f, -0.121772f, 0.230389f, 0.208918f, 0.193339f, 0.216856f, -0.243771f, -0.134538f, 0.132288f, 0.213709f, -0.415695f, -0.073526f, -0.065005f, -0.244580f, 0.194826f, -0.032069f, -0.108101f, 0.216876f, -0.206311f, -0.125875f, -0.078475f, 0.127604f, -0.093363f, -0.079676f, 0.146019f, 0.132720f, -0.000979f, -0.080413f, 0.049167f, 0.198241f, 0.084318f, 0.026923f, -0.263636f, -0.451934f, -0.163679f, 0.212026f, -0.069600f, -0.065777f, 0.054490f, 0.055913f, 0.015746f, -0.021282f, 0.062158f, -0.118348f, -0.074980f, 0.259159f, -0.144419f, -0.015222f, -0.202079f, 0.180526f, 0.105097f, 0.118859f, 0.202297f, -0.011405f, -0.256160f, -0.009768f, 0.229604f, -0.181223f, -0.250399f, -0.017913f, 0.160425f, -0.576008f, 0.065413f, 0.184772f, -0.437982f, -0.099268f, 0.145207f, -0.269162f, -0.196124f, 0.224339f, 0.166608f, 0.209762f, -0.175364f, -0.018595f, 0.175646f, -0.014046f, -0.053359f, 0.069689f, -0.069127f, -0.088335f, -0.185053f, -0.009694f, 0.058864f, -0.003758f, -0.035605f, 0.025020f, 0.079857f, 0.175731f, 0.167988f, -0.123612f, -0.012361f, -0.046155f, 0.021513f, 0.088919f, -0.041412f, 0.119901f, 0.048608f, -0.148366f, 0.093978f, 0.047126f, -0.160694f, 0.188390f, -0.086258f, -0.095214f, -0.074633f, 0.164037f, -0.246034f, 0.200152f, 0.096284f, 0.032077f, 0.149197f, -0.025603f, -0.390135f, -0.084274f, 0.066163f, -0.285859f, -0.130393f, -0.061545f, -0.004767f, -0.029279f, -0.153422f, 0.161949f, 0.097260f, -0.045039f, -0.014219f, -0.041831f, 0.124667f, -0.086349f, -0.168568f, 0.373131f, 0.101190f, 0.179421f, 0.167021f, 0.070281f, -0.178526f, 0.003231f, -0.250424f, 0.071206f, -0.059005f, 0.225101f, -0.122640f, 0.269280f, 0.042314f, 0.045069f, -0.010777f, -0.161927f, -0.115885f, 0.200363f, 0.223627f, -0.238738f, -0.014760f, 0.096960f, -0.195058f, 0.219271f, 0.046513f, -0.015171f, -0.024175f, -0.126497f, 0.046557f, -0.134588f, -0.215696f, 0.130102f, -0.298892f, 0.253280f, -0.017739f, -0.224065f, 0.031614f, -0.193432f, -0.054020f, -0.046266f, -0.135959f, -0.168937f, 0.240629f, 0.009925f, -0.154267f, 0.073759f, -0.047204f, -0.439173f, -0.046198f, 0.070853f, -0.364253f, 0.059888f, 0.049429f, 0.184572f, 0.149154f, 0.155093f, 0.119770f, 0.016702f, 0.263041f, -0.116677f, 0.087509f, 0.104425f, -0.099331f, -0.011510f, 0.123190f, 0.058513f, 0.050136f, 0.214276f, -0.014396f, -0.245150f, 0.180034f, 0.064521f, -0.192740f, 0.133894f, -0.062366f, -0.152294f, -0.158691f, 0.156122f, -0.508451f, 0.126586f, 0.003378f, -0.240901f, -0.011492f, 0.206129f, 0.184995f, 0.091780f, 0.117784f, -0.101548f, 0.153170f, 0.052158f, -0.224000f, -0.100161f, -0.077443f, 0.021391f, -0.130722f, 0.011548f, 0.282145f, -0.217992f, -0.226399f, -0.048137f, -0.110591f, -0.366189f, 0.009539f, -0.001855f, 0.237464f, 0.294754f, -0.203476f, 0.428590f, -0.058497f, -0.021844f, 0.124785f, -0.352790f, 0.034382f, 0.151433f, 0.089934f, 0.068296f, -0.152696f, 0.081460f, 0.190633f, -0.127228f, 0.291246f, 0.295637f, 0.082808f, 0.111163f, -0.009157f, -0.078420f, -0.058276f, 0.104762f, 0.179572f, 0.181552f, -0.180973f, -0.248142f, -0.069502f, -0.199086f, 0.077055f, -0.170708f, 0.152133f, -0.335050f, 0.121246f, 0.026296f, -0.183046f, -0.162668f, -0.020319f, -0.133403f, 0.195787f, 0.049299f, -0.020223f, 0.129447f, -0.014905f, -0.182171f, -0.003733f, -0.024310f, -0.147350f, 0.009999f, 0.140524f, 0.161183f, 0.060404f, -0.097032f, -0.155168f, -0.138653f, 0.173351f, -0.053620f, 0.012999f, -0.127243f, -0.240924f, -0.179834f, 0.206745f, 0.191602f, -0.168486f, -0.022277f, -0.269712f, 0.020718f, 0.003275f, 0.181668f, -0.025155f, -0.271051f, -0.177855f, -0.229942f, -0.178431f, -0.034890f, -0.224018f, -0.231704f, 0.095265f, 0.018283f, -0.027144f, -0.018768f, -0.027795f, 0.053214f, -0.506963f, -0.068757f, -0.586207f, -0.306021f, -0.083278f, -0.017049f, 0.008759f, -0.062929f, -0.100051f, -0.126686f, -0.467151f, -0.181398f, 0.069720f, -0.298868f, 0.124921f, -0.203393f, -0.287732f, -0.015805f, -0.089404f, -0.168924f, 0.155775f, -0.085117f, 0.218679f, 0.114009f, -0.075358f, 0.170702f, 0.086232f, 0.225008f, -0.238341f, 0.065048f, -0.094685f, -0.420695f, 0.093108f, -0.003368f, -0.336616f, -0.270857f, -0.110512f, -0.279704f, 0.125917f, 0.092441f, 0.005908f, -0.526597f, 0.252610f, 0.017680f, 0.097332f, 0.057173f, -0.078569f, -0.048353f, -0.341797f, -0.225974f, -0.096113f, -0.357461f, 0.015260f, 0.165845f, -0.469267f, -0.376731f, -0.111799f, -0.129877f, -0.112015f, 0.079830f, -0.088898f, 0.042901f, 0.035264f, 0.022373f, -0.129193f, 0.145598f, 0.064060f, 0.097970f, -0.048959f, -0.073159f, 0.100712f, 0.229107f, -0.013802f, -0.042818f, -0.089055f, 0.098164f, -0.143834f, 0.167757f, 0.098401f, 0.025298f, 0.265046f, -0.187529f, -0.180898f, 0.044727f, 0.159193f, -0.115513f, 0.176905f, -0.171381f, -0.085945f, -0.503397f, -0.130621f, 0.127756f, 0.032336f, 0.082545f, 0.076589f, -0.061873f, -0.152501f, 0.178237f, -0.116117f, -0.308037f, -0.076173f, 0.009411f, -0.117629f, -0.292962f, -0.084802f, 0.087546f, 0.176649f, 0.035402f, -0.082792f, 0.104479f, -0.066024f, 0.146530f, -0.314305f, 0.131957f, 0.157252f, 0.079020f, -0.002711f, 0.140846f, 0.169613f, -0.021273f, -0.147346f, -0.222192f, -0.063031f, -0.084757f, -0.043745f, 0.060021f, 0.182161f, 0.014498f, 0.075066f, 0.070538f, -0.063663f, -0.094066f, 0.100208f, 0.052569f, 0.089125f, 0.194698f, 0.156698f, 0.050335f, 0.080391f, -0.023079f, -0.088255f, 0.137012f, 0.034120f, 0.050773f, -0.006732f, -0.107414f, -0.002431f, 0.022837f, 0.129942f, -0.203291f, 0.163222f, 0.020372f, -0.074504f, 0.203550f, -0.137971f, -0.260673f, 0.001325f, -0.231713f, -0.214667f, -0.091718f, -0.259431f, 0.158961f, -0.016903f, -0.065859f, -0.026569f, 0.093585f, -0.010783f, 0.218795f, 0.099706f, -0.147175f, -0.202574f, -0.135270f, -0.126364f, -0.054020f, -0.056280f, 0.211018f, -0.069615f, 0.192460f, -0.135710f, -0.102587f, -0.014293f, 0.197647f, 0.114571f, 0.062934f, -0.226733f, -0.084679f, -0.199752f, -0.175379f, 0.004690f, 0.248754f, -0.157980f, -0.091543f, 0.049423f, 0.018065f, 0.024069f, -0.404566f, -0.034898f, 0.087235f, 0.082120f, -0.017597f, -0.002748f, -0.031016f, 0.220606f, 0.078680f, -0.086749f, 0.031079f, -0.134518f, 0.060630f, 0.020395f, -0.192279f, -0.063223f, -0.135219f, 0.005597f, 0.205986f, 0.228258f, 0.180083f, -0.274228f, 0.002029f, -0.142138f, 0.135794f, -0.258923f, -0.067623f, -0.231490f, 0.004238f, 0.196129f, 0.205700f, -0.036785f, 0.126400f, -0.101963f, -0.241894f, -0.159776f, -0.148470f, -0.184097f, 0.111805f, -0.108829f, 0.100693f, 0.215630f, 0.155302f, -0.163983f, 0.000806f, -0.031250f, 0.073608f, 0.019634f, 0.360618f, 0.263122f, -0.001565f, -0.157868f, -0.071689f, 0.067010f, -0.386189f, 0.156664f, -0.065139f, 0.206487f, 0.242872f, -0.335827f, -0.238872f, -0.103914f, -0.186267f, 0.001747f, 0.299391f, -0.262513f, -0.456552f, -0.040757f, -0.192093f, -0.059424f, 0.061672f, -0.049034f, -0.133813f, 0.448062f, 0.200868f, 0.234404f, -0.448785f, 0.123591f, 0.089502f, 0.290100f, -0.049405f, 0.097083f, -0.073582f, -0.641206f, 0.054412f, -0.011235f, -0.114614f, -0.819146f, 0.017830f, 0.257484f, -0.188014f, 0.339908f, -0.166042f, 0.039842f, -0.033831f, -0.082011f, -0.061107f, 0.042668f, 0.142954f, -0.379380f, -0.085817f, 0.118964f, -0.033731f, 0.020214f, -0.118101f, -0.246841f, 0.091594f, -0.084483f, 0.103892f, -0.401242f, -0.022231f, -0.022065f, -0.068013f, -0.000843f, 0.071194f, -0.064167f, -0.139368f, -0.269445f, -0.348803f, -0.048623f, 0.118594f, -0.095987f, 0.092013f, -0.165339f, -0.353867f, 0.124970f, -0.014973f, -0.190551f, 0.145693f, -0.014312f, -0.215235f, 0.146479f, 0.075398f, 0.016009f, -0.033802f, 0.134612f, -0.027361f, 0.149827f, -0.112271f, 0.055500f, 0.127302f, -0.319663f, 0.267584f, -0.609144f, -0.460145f, -0.680594f, -0.086282f, 0.176956f, -0.405833f, -0.150484f, 0.084207f, -0.323260f, -0.080408f, 0.127426f, -0.053732f, 0.152811f, -0.000453f, -0.796589f, 0.033196f, -0.150571f, -0.133666f, -0.095560f, -0.051204f, 0.045851f, 0.139488f, -0.059379f, -0.087709f, -0.014567f, -0.159184f, 0.164666f, 0.048053f, 0.014596f, -0.593116f, 0.249071f, -0.124783f, -0.688613f, 0.015025f, 0.024636f, -0.061645f, 0.263939f, 0.036404f, 0.184698f, -0.359723f, 0.003483f, -0.017659f, 0.030503f, 0.054773f, -0.340553f, -0.088316f, -0.114325f, 0.100025f, -0.011354f, -0.126166f, -0.065484f, 0.112863f, -0.159899f, -0.040327f, 0.135955f, -0.113588f, 0.098762f, 0.190838f, -0.035270f, 0.022866f, -0.052800f, 0.151622f, 0.085999f, 0.097535f, 0.109044f, -0.115813f, 0.134148f, 0.182017f, -0.083768f, -0.012391f, -0.178625f, -0.095770f, -0.098522f, -0.047885f, -0.108495f, 0.089038f, -0.131642f, -0.106120f, 0.247323f, 0.145476f, 0.102034f, -0.003802f, -0.073332f, -0.210891f, -0.001926f, 0.137923f, -0.090075f, 0.036357f, -0.179179f, 0.016150f, 0.130370f, -0.146544f, -0.089029f, 0.052503f, -0.127108f, -0.289861f, 0.088562f, 0.180402f, -0.130597f, -0.174656f, -0.025954f, 0.017621f, 0.219256f, -0.124239f, -0.023206f, -0.060813f, -0.192866f, -0.239856f, 0.253292f, 0.175785f, -0.111247f, 0.016701f, 0.250911f, 0.168429f, -0.021024f, 0.014492f, -0.044797f, -0.301955f, 0.020731f, -0.084765f, -0.167238f, 0.025018f, 0.088198f, -0.069557f, 0.210809f, 0.114439f, 0.025354f, -0.027320f, 0.293595f, 0.162014f, -0.024883f, 0.021280f, 0.082953f, -0.167977f, -0.068366f, 0.151754f, -0.037461f, -0.094584f, -0.369253f, -0.045564f, -0.159064f, 0.222813f, 0.127982f, 0.065668f, -0.132022f, -0.172045f, -0.128861f, 0.006808f, -0.335758f, -0.024891f, -0.067232f, -0.117976f, 0.108468f, 0.133068f, -0.044709f, 0.119775f, 0.107096f, 0.306769f, -0.051442f, -0.026740f, 0.209978f, -0.030461f, 0.085207f, -0.038230f, -0.094917f, 0.073105f, -0.220722f, -0.256077f, 0.094728f, 0.027643f, -0.119721f, 0.067809f, -0.104810f, 0.020870f, 0.197451f, 0.020917f, -0.255344f, 0.074197f, 0.129037f, -0.222653f, 0.247149f, 0.204955f, 0.216674f, -0.011615f, -0.071693f, 0.121694f, 0.268203f, 0.157462f, -0.195955f, 0.134792f, 0.075520f, -0.170786f, -0.141998f, -0.144677f, 0.131687f, 0.198365f, 0.062250f, -0.083108f, 0.154090f, 0.024019f, 0.186014f, 0.096703f, -0.295754f, -0.116861f, 0.101938f, 0.079235f, 0.011602f, -0.201870f, 0.041631f, -0.062069f, -0.114229f, 0.093658f, -0.043254f, 0.022927f, -0.094514f, 0.011778f, -0.116897f, -0.111198f, -0.167088f, -0.005496f, 0.101519f, 0.036144f, -0.126222f, 0.181994f, -0.136343f, -0.188781f, 0.050205f, -0.107041f, -0.157244f, 0.091346f, -0.206351f, 0.115139f, -0.227917f, 0.139447f, 0.082724f, -0.080185f, 0.002680f, -0.129414f, -0.159200f, 0.212719f, -0.580154f, -0.107729f, 0.123640f, 0.079033f, -0.252522f, -0.076390f, 0.110353f, -0.126123f, -0.316233f, -0.028584f, -0.012526f, 0.208690f, 0.057297f, 0.045241f, -0.186703f, 0.210002f, -0.102003f, 0.205988f, 0.182863f, -0.158969f, 0.054102f, 0.170993f, -0.236855f, -0.044676f, 0.058186f, -0.054727f, -0.015812f, 0.161840f, -0.067952f, -0.400008f, -0.031263f, 0.030088f, -0.163022f, 0.025637f, -0.085093f, -0.834506f, -0.068377f, 0.152138f, 0.112324f, 0.117725f, -0.024123f, -0.014489f, -0.080212f, 0.099165f, -0.040947f, 0.026639f, 0.102813f, -0.091854f, 0.058358f, 0.050865f, 0.141912f, 0.281692f, -0.106915f, 0.119841f, -0.118866f, -0.233355f, 0.063764f, -0.124899f, -0.479429f, -0.047094f, -0.083959f, -0.207272f, -0.074698f, -0.178475f, 0.137456f, 0.156923f, 0.156535f, -0.043923f, -0.027776f, 0.123482f, 0.045143f, 0.115466f, -0.152985f, 0.092150f, -0.087249f, 0.038196f, -0.248865f, 0.106540f, -0.252808f, -0.111525f, -0.200178f, -0.021049f, 0.269662f, -0.083608f, -0.085854f, -0.011581f, 0.195200f, 0.093199f, 0.038784f, -0.112579f, 0.105865f, -0.139224f, 0.000218f, 0.065733f, -0.116863f, -0.034037f, -0.110916f, -0.298385f, -0.219706f, 0.061763f, -0.142839f, -0.352039f, 0.254931f, 0.102178f, -0.001268f, -0.124469f, -0.088902f, -0.085724f, -0.014988f, 0.234093f, 0.156918f, -0.084771f, 0.248586f, -0.142078f, -0.043007f, 0.059945f, 0.106495f, 0.101561f, -0.240896f, -0.040422f, 0.226544f, 0.072400f, -0.467590f, -0.049690f, -0.196236f, -0.304666f, 0.051984f, 0.023627f, -0.325382f, 0.091615f, 0.044249f, 0.029808f, 0.162387f, 0.082719f, 0.108254f, -0.204568f, 0.001006f, 0.168620f, 0.025544f, 0.227606f, 0.061458f, 0.197890f, -0.335506f, -0.057378f, -0.219608f, -0.356316f, -0.236711f, -0.096558f, -0.018668f, -0.386750f, 0.106899f, 0.184090f, 0.137783f, 0.047857f, -0.039544f, -0.438495f, 0.184614f, 0.317174f, 0.073448f, -0.149255f, -0.041038f, 0.065813f, 0.230553f, -0.072580f, -0.088301f, 0.199650f, -0.045150f, 0.205328f, -0.166744f, 0.079435f, -0.274143f, 0.019926f, 0.083336f, 0.059116f, -0.033806f, -0.141919f, -0.446533f, 0.319993f, 0.163889f, -0.106019f, -0.012357f, -0.032841f, 0.172869f, -0.099530f, -0.120976f, -0.141289f, -0.002032f, 0.070570f, 0.157399f, 0.054970f, 0.110609f, -0.198694f, 0.176965f, -0.209474f, -0.327018f, -0.399589f, -0.395208f, -0.059913f, -0.090760f, 0.075662f, 0.043887f, 0.040016f, -0.080720f, -0.650875f, -0.047765f, 0.362148f, -0.096583f, -0.026926f, 0.089236f, 0.017627f, -0.278313f, 0.066870f, -0.075504f, -0.107286f, 0.001699f, -0.554253f, -0.268190f, 0.207174f, -0.330533f, 0.044936f, -0.514297f, 0.317390f, 0.061777f, -0.180449f, -0.366177f, 0.335510f, -0.613947f, 0.075952f, 0.186815f, -0.526866f, -0.291717f, 0.008115f, 0.292314f, -0.360263f, -1.143932f, 0.049865f, -0.367190f, 0.077874f, -0.167289f, 0.056021f, -0.847580f, -0.131580f, 0.036903f, 0.119338f, -0.592091f, -0.203204f, 0.126747f, -0.007131f, -0.379351f, -0.087238f, -0.286775f, 0.094393f, -0.052587f, 0.058092f, 0.097530f, 0.076350f, -0.110010f, 0.244894f, 0.229950f, 0.195349f, 0.181613f, 0.081236f, -0.292745f, 0.135994f, 0.152002f, -0.152549f, -0.152451f, 0.061397f, 0.055576f, -0.725108f, -0.078233f, 0.104677f, -0.130898f, -0.353845f, -0.087998f, -0.200080f, 0.252089f, -0.114874f, 0.089702f, -0.068499f, 0.085674f, 0.054618f, 0.232876f, -0.101236f, 0.256453f, -0.129928f, 0.182834f, -0.050923f, -0.054737f, 0.009217f, -0.150443f, -0.067530f, -0.200841f, -0.169019f, 0.145608f, 0.076631f, 0.036834f, 0.118955f, 0.091998f, 0.038781f, -0.032796f, -0.029597f, -0.178399f, 0.193055f, 0.213436f, 0.145208f, 0.206129f, 0.086442f, 0.228446f, -0.131682f, 0.107423f, -0.212855f, 0.122603f, 0.016129f, -0.087145f, 0.118886f, -0.064634f, 0.104685f, 0.074301f, -0.144333f, -0.083986f, 0.143522f, -0.133052f, -0.076762f, -0.014950f, 0.202404f, 0.163058f, -0.083012f, 0.006058f, 0.158169f, -0.164372f, 0.141657f, -0.148824f, 0.036734f, -0.229722f, 0.194346f, 0.007064f, -0.186304f, -0.033863f, 0.107236f, -0.183138f, -0.005899f, -0.124532f, -0.028274f, 0.241421f, -0.069540f, 0.015837f, 0.208392f, 0.149220f, 0.149022f, 0.077756f, 0.060900f, 0.190162f, 0.057253f, -0.157939f, -0.123062f, -0.008044f, 0.221387f, 0.001888f, -0.075232f, -0.096796f, 0.262147f, -0.173930f, 0.239175f, 0.159954f, -0.173573f, 0.211429f, -0.083194f, -0.264973f, 0.144404f, -0.080977f, -0.118157f, -0.044720f, -0.105411f, 0.165691f, -0.106878f, -0.160744f, 0.102079f, 0.173355f, 0.087035f, -0.144276f, 0.081712f, 0.201247f, -0.182558f, -0.055858f, -0.160138f, -0.085539f, 0.138614f, -0.136230f, -0.130428f, -0.119342f, -0.069570f, 0.121285f, 0.185953f, -0.030700f, 0.034682f, 0.106852f, -0.004008f, 0.123187f, 0.182484f, 0.151384f, 0.055299f, 0.059083f, -0.037063f, 0.144091f, 0.140397f, -0.132053f, 0.162397f, -0.119228f, 0.052371f, -0.327726f, -0.119294f, -0.228777f, 0.100810f, 0.077620f, -0.109687f, -0.044148f, -0.189101f, 0.159877f, -0.161692f, -0.117629f, 0.048166f, -0.131163f, -0.159564f, -0.093198f, -0.154733f, 0.177260f, -0.128258f, 0.174093f, -0.046541f, -0.165566f, 0.132843f, -0.237601f, -0.302318f, -0.175289f, -0.020259f, -0.140790f, 0.058486f, 0.072417f, -0.051660f, 0.049247f, 0.147583f, 0.029204f, 0.109616f, -0.046870f, 0.156473f, 0.005889f, 0.013022f, 0.096961f, -0.124686f, -0.072552f, 0.114813f, 0.120080f, 0.178574f, 0.100124f, 0.066761f, 0.053484f, 0.258290f, -0.234514f, -0.082354f, -0.259722f, 0.042245f, 0.256971f, 0.203932f, -0.200340f, 0.022515f, 0.073267f, -0.341731f, 0.138711f, 0.188624f, 0.025899f, -0.039151f, -0.012193f, -0.135049f, -0.055015f, 0.173055f, 0.049252f, 0.203113f, -0.047703f, -0.235069f, -0.010522f, 0.148407f, -0.567772f, -0.373070f, -0.302702f, -0.027793f, -0.082427f, -0.021854f, 0.042290f, 0.179242f, -0.535619f, -0.277517f, 0.120927f, -0.155527f, -0.262817f, 0.054776f, -0.108336f, 0.274702f, -0.230965f, 0.091884f, 0.124506f, -0.128337f, -0.546289f, -0.591734f, -0.010021f, 0.195601f, -0.017158f, 0.040367f, -0.312462f, -0.011782f, 0.067419f, -0.324361f, -0.355390f, 0.010382f, -0.688658f, -0.328888f, 0.066043f, -0.626210f, -0.084769f, -0.082384f, 0.093172f, 0.020977f, -0.652885f, 0.186324f, -0.200591f, 0.038716f, -0.147943f, -0.027626f, -0.654687f, -0.187769f, -0.203084f, -0.027790f, -0.392240f, -0.156161f, -0.128648f, 0.182703f, 0.128891f, -0.091074f, 0.000412f, -0.039838f, 0.171031f, 0.197336f, 0.187293f, 0.168394f, -0.143016f, -0.130062f, -0.051201f, 0.150286f, -0.065918f, 0.196990f, -0.282212f, 0.065883f, -0.172598f, -0.171077f, -0.340064f, -0.081257f, -0.086705f, -0.459571f, 0.041913f, -0.039349f, -0.228582f, -0.034088f, 0.122867f, -0.206157f, 0.056848f, 0.143399f, 0.196302f, -0.131397f, 0.133878f, -0.158438f, -0.027335f, -0.095802f, 0.212599f, -0.235454f, -0.042141f, 0.078291f, -0.120719f, -0.261820f, -0.328595f, 0.101103f, -0.382018f, -0.157111f, -0.222501f, -0.054075f, 0.156798f, 0.220477f, 0.073390f, 0.056434f, 0.009500f, 0.077010f, -0.363760f, 0.181049f, -0.150230f, -0.187666f, -0.211227f, 0.001418f, 0.129082f, 0.081697f, -0.197991f, -0.070348f, -0.259128f, -0.062318f, -0.053437f, 0.041422f, -0.217170f, -0.008517f, 0.132684f, -0.180682f, -0.209279f, 0.011375f, 0.024866f, 0.050939f, 0.231523f, 0.098026f, -0.010819f, -0.201519f, 0.216178f, 0.131269f, -0.143493f, 0.183443f, -0.142236f, 0.024240f, 0.012071f, 0.240682f, -0.654759f, -0.002061f, 0.253122f, 0.283919f, -0.103570f, -0.085581f, -0.001506f, -0.072581f, -0.377777f, -0.131973f, 0.068876f, -0.117110f, 0.279064f, -0.069156f, -0.190772f, 0.279485f, -0.142808f, 0.040234f, 0.141033f, -0.049656f, 0.230910f, 0.001793f, -0.277731f, 0.103480f, 0.022145f, -0.123727f, -0.198917f, 0.276460f, 0.012026f, -0.798707f, -0.090598f, 0.270410f, -0.329531f, 0.043893f, -0.077945f, -0.686849f, 0.145739f, 0.057442f, -0.098243f, -0.029895f, 0.054495f, -0.101534f, 0.159608f, -0.034740f, 0.075186f, 0.012698f, 0.125770f, 0.051668f, -0.087304f, -0.115801f, -0.061514f, -0.106186f, -0.156623f, 0.126848f, -0.102067f, 0.073478f, 0.028086f, -0.095297f, -0.305949f, -0.135773f, -0.172831f, 0.141144f, -0.017481f, -0.110996f, 0.168985f, 0.037719f, 0.229343f, -0.138745f, 0.211729f, -0.140946f, 0.099766f, -0.083931f, -0.115222f, 0.020455f, -0.269037f, -0.029279f, -0.119361f, -0.228468f, 0.164585f, 0.120375f, -0.126846f, -0.044325f, 0.017375f, -0.024601f, 0.132189f, -0.158679f, -0.002145f, 0.016001f, 0.090093f, 0.006790f, 0.229210f, 0.187509f, -0.261510f, 0.076979f, -0.058472f, -0.076269f, 0.006981f, -0.439453f, -0.538140f, -0.145973f, -0.323438f, -0.345643f, -0.159165f, 0.258959f, 0.302667f, 0.269983f, -0.343026f, -0.406585f, -0.025934f, 0.260677f, -0.442450f, 0.177675f, 0.166866f, -0.175302f, -0.181699f, -0.117273f, 0.199511f, 0.087819f, -0.050528f, -0.206682f, -0.141850f, -0.017864f, -0.364562f, -0.121284f, 0.010376f, -0.037518f, -0.108993f, -0.077211f, -0.146787f, 0.148748f, 0.067126f, 0.036534f, 0.150147f, 0.306711f, 0.268110f, 0.012381f, -0.085290f, -0.031130f, -0.148843f, -0.078491f, 0.197645f, -0.075820f, -0.318955f, 0.091065f, -0.271980f, -0.076757f, -0.044086f, 0.159599f, -0.087092f, -0.040732f, -0.020608f, 0.062178f, 0.102274f, 0.118612f, -0.191944f, 0.082857f, -0.007711f, 0.143304f, -0.008613f, 0.166531f, 0.149365f, -0.082611f, -0.170599f, -0.065916f, 0.045648f, -0.181334f, -0.143195f, -0.192382f, 0.131839f, 0.120167f, 0.015274f, 0.044684f, -0.177083f, 0.058751f, -0.154332f, 0.015531f, -0.361384f, 0.055621f, -0.120154f, -0.288769f, 0.170462f, -0.048590f, -0.077370f, -0.184922f, 0.142251f, 0.053233f, 0.050698f, -0.002642f, 0.080121f, -0.026395f, -0.241020f, 0.012591f, 0.213353f, -0.167903f, -0.654969f, -0.120823f, -0.260532f, -0.197323f, -0.191275f, 0.217922f, 0.229324f, -0.055335f, -0.474775f, -0.151709f, 0.299647f, -0.699596f, -0.817246f, 0.209641f, -0.057609f, 0.238791f, 0.149899f, -0.068195f, 0.075727f, 0.067822f, -0.165617f, -0.173084f, -0.058971f, -0.147684f, 0.095625f, -0.032458f, -0.060166f, -0.087669f, -0.143665f, 0.113149f, -0.334211f, -0.056856f, 0.197258f, -0.224797f, 0.028537f, 0.177042f, -0.191695f, -0.404373f, 0.168419f, 0.148899f, -0.160974f, -0.043828f, -0.310203f, -0.140796f, 0.118156f, 0.116271f, -0.020461f, -0.231736f, 0.046573f, 0.135308f, -0.236486f, -0.343728f, 0.187110f, -0.000970f, -0.329992f, -0.096618f, 0.035137f, 0.091178f, -0.008843f, 0.265899f, -0.093715f, -0.146216f, 0.023977f, -0.121778f, 0.214719f, -0.161067f, 0.029638f, 0.118267f, -0.137142f, 0.003490f, -0.160784f, 0.213067f, -0.345372f, -0.090849f, -0.236074f, -0.191375f, -0.036828f, -0.075339f, -0.294871f, -0.077343f, 0.155043f, -0.013776f, 0.161501f, 0.059555f, -0.161844f, -0.164428f, 0.022525f, -0.114765f, 0.144950f, -0.123545f, 0.022513f, 0.098955f, 0.094313f, 0.112876f, -0.094796f, -0.356044f, -0.114753f, 0.245960f, 0.033271f, -0.209037f, -0.224996f, -0.121982f, 0.341703f, 0.256439f, -0.140182f, -0.037140f, -0.068238f, 0.196545f, -0.092349f, 0.044997f, 0.069907f, 0.103823f, -0.184305f, 0.176135f, -0.176522f, -0.203135f, -0.117426f, -0.009733f, -0.193361f, -0.074605f, -0.319205f, -0.193582f, -0.164623f, 0.191637f, 0.055191f, 0.012235f, -0.296326f, 0.188537f, -0.036433f, -0.079077f, 0.212101f, 0.172163f, 0.110474f, 0.075638f, 0.047002f, 0.189285f, 0.034776f, -0.146975f, -0.073816f, -0.100026f, -0.111399f, -0.239186f, -0.188567f, -0.141296f, 0.027115f, -0.217433f, 0.047558f, 0.078268f, -0.089269f, -0.054088f, -0.155093f, -0.175540f, -0.082546f, -0.198036f, -0.116364f, -0.044897f, -0.007378f, -0.125114f, 0.158051f, -0.072137f, 0.013412f, 0.077023f, 0.161719f, -0.061955f, -0.138467f, -0.069564f, 0.090828f, 0.105222f, -0.132709f, 0.046871f, -0.084382f, 0.075999f, -0.199411f, -0.045690f, -0.098303f, -0.153034f, 0.127512f, 0.009248f, -0.158903f, 0.011135f, 0.062139f, -0.296388f, 0.080240f, 0.074765f, 0.028486f, -0.090476f, 0.108286f, -0.020869f, -0.024887f, 0.167216f, -0.325296f, -0.060485f, 0.131032f, -0.095098f, 0.068936f, 0.027603f, -0.093918f, 0.143534f, -0.162563f, 0.118067f, 0.109795f, 0.085745f, 0.135073f, -0.095834f, 0.185570f, 0.000676f, -0.144322f, 0.087836f, -0.064035f, -0.087577f, 0.093063f, 0.072295f, 0.068190f, 0.166370f, 0.124414f, -0.077841f, -0.062571f, -0.104204f, -0.226504f, -0.077577f, 0.203338f, -0.025253f, -0.262192f, -0.128895f, 0.139947f, 0.039289f, -0.213222f, -0.105789f, 0.007505f, 0.195089f, -0.145471f, -0.142807f, -0.120960f, -0.083194f, -0.059601f, -0.060728f, 0.013452f, 0.168843f, -0.190696f, -0.133131f, 0.051937f, 0.212983f, -0.020050f, -0.098853f, 0.216599f, 0.203778f, -0.037040f, -0.101583f, -0.123893f, -0.174447f, -0.118428f, 0.190885f, -0.263832f, 0.164266f, 0.216631f, -0.124675f, -0.035687f, -0.113548f, 0.251399f, -0.057140f, 0.041211f, -0.248964f, 0.092931f, -0.075111f, -0.251217f, -0.025871f, 0.115918f, 0.081866f, 0.183411f, 0.086137f, -0.353225f, 0.164966f, 0.006065f, -0.189597f, 0.043984f, -0.004296f, -0.034503f, 0.187325f, 0.239300f, -0.004254f, 0.123985f, 0.008565f, -0.048620f, -0.043045f, 0.166091f, -0.156332f, -0.259193f, 0.096945f, -0.036839f, -0.062206f, 0.276652f, -0.080482f, -0.180311f, -0.125997f, -0.045622f, 0.178560f, -0.210124f, 0.144587f, -0.223859f, -0.105295f, -0.116520f, -0.196941f, 0.065897f, -0.204771f, -0.080889f, -0.050463f, 0.071589f, 0.041889f, -0.100290f, 0.081304f, 0.251074f, 0.207619f, 0.003805f, -0.102660f, -0.035926f, -0.254350f, 0.063228f, 0.102453f, 0.053872f, -0.231559f, -0.361855f, -0.079740f, 0.199416f, -0.134498f, -0.211664f, 0.089001f, 0.076549f, -0.131451f, 0.178259f, -0.265844f, 0.056926f, 0.029637f, -0.243931f, 0.029980f, -0.542889f, -0.136967f, -0.001175f, -0.040354f, -0.107724f, -0.032717f, -0.079006f, 0.084689f, -0.319535f, -0.204843f, -0.012509f, -0.019077f, -0.079898f, -0.016750f, -0.234284f, 0.203321f, -0.132588f, -0.187345f, 0.009439f, 0.156199f, -0.162987f, 0.214078f, -0.345134f, -0.213996f, -0.009734f, -0.111109f, -0.508649f, -0.114859f, 0.054106f, -0.185529f, -0.036635f, 0.110370f, 0.030748f, -0.102797f, 0.192359f, 0.072951f, 0.012885f, 0.171449f, 0.134072f, -0.174630f, -0.003963f, -0.131191f, -0.124582f, 0.185955f, -0.277975f, 0.133426f, 0.157233f, 0.200456f, 0.158557f, -0.397927f, -0.244114f, -0.161496f, -0.074843f, 0.118254f, 0.159234f, 0.245083f, -0.120009f, -0.043899f, 0.015571f, 0.093476f, -0.021324f, 0.183644f, -0.064534f, -0.163036f, -0.184858f, -0.018511f, 0.013907f, -0.162798f, -0.102962f, 0.065357f, -0.286535f, 0.026285f, 0.057086f, 0.047988f, -0.185296f, -0.045337f, -0.111210f, -0.048982f, -0.193754f, -0.000503f, -0.269860f, 0.278136f, 0.258470f, 0.129364f, -0.129131f, -0.096174f, 0.132958f, -0.015051f, -0.051316f, -0.054333f, -0.007329f, -0.098644f, -0.202311f, 0.192195f, -0.004687f, -0.185021f, 0.014514f, -0.257658f, 0.171291f, 0.121611f, -0.137487f, -0.063337f, 0.225656f, 0.133311f, -0.062306f, 0.013535f, -0.178591f, 0.019978f, 0.206386f, 0.227046f, -0.001292f, 0.142898f, 0.165106f, 0.151308f, 0.251073f, -0.028039f, 0.041935f, -0.013111f, -0.293099f, 0.134258f, -0.014117f, -0.071611f, -0.120245f, 0.272287f, 0.114103f, 0.109744f, -0.000770f, 0.029600f, -0.249595f, -0.124498f, -0.176358f, -0.294356f, -0.002709f, 0.113442f, -0.140160f, 0.192748f, 0.073195f, -0.142943f, -0.159605f, 0.240485f, -0.115445f, -0.005897f, -0.136569f, 0.009688f, -0.110885f, -0.349509f, -0.029362f, -0.155106f, -0.157289f, 0.113669f, 0.139246f, -0.148640f, 0.104172f, 0.126739f, -0.309561f, -0.009927f, -0.025990f, -0.467170f, -0.207586f, 0.066949f, -0.155764f, 0.315040f, -0.107769f, 0.127422f, 0.175569f, 0.184519f, -0.407954f, -0.040503f, -0.161459f, -0.034475f, -0.386319f, -0.090434f, 0.021219f, 0.050976f, 0.233076f, 0.051679f, -0.436756f, -0.151282f, 0.193392f, -0.295385f, 0.078170f, -0.100267f, -0.064557f, -0.442011f, 0.109712f, 0.120020f, 0.226826f, 0.025176f, -0.275166f, -0.046556f, -0.355422f, -0.025128f, -0.256182f, -0.243290f, -0.183949f, 0.055199f, -0.108124f, -0.277402f, 0.187623f, -0.180847f, 0.260260f, 0.131949f, -0.284384f, -0.017181f, 0.134775f, -0.084054f, 0.034390f, -0.017299f, 0.000357f, -0.100967f, -0.099354f, 0.110284f, 0.038866f, -0.142412f, -0.317433f, 0.019389f, -0.161088f, 0.264496f, -0.060414f, 0.140970f, -0.196618f, 0.039617f, 0.087363f, -0.074032f, -0.093903f, 0.140474f, 0.116121f, 0.142525f, 0.142962f, 0.155524f, 0.053035f, -0.336884f, -0.045730f, -0.165445f, -0.132193f, 0.247700f, -0.021624f, 0.253329f, 0.009738f, 0.188132f, -0.216888f, -0.332886f, -0.211649f, -0.172011f, -0.279105f, 0.064697f, 0.210985f, -0.166025f, -0.144017f, -0.007759f, 0.027568f, -0.312823f, 0.048912f, 0.210216f, 0.130069f, -0.009349f, 0.042016f, 0.158676f, 0.178706f, -0.158439f, -0.060504f, 0.026862f, -0.153671f, -0.323247f, 0.206101f, 0.203884f, -0.223845f, -0.094489f, 0.087990f, -0.025926f, 0.156259f, -0.092864f, -0.486196f, 0.023646f, -0.055880f, -0.296942f, -0.086742f, 0.153423f, 0.060079f, -0.091048f, -0.029978f, 0.070194f, -0.126997f, 0.268051f, 0.088679f, -0.012254f, -0.206700f, 0.057350f, 0.081719f, 0.125693f, -0.049007f, -0.040889f, -0.018991f, -0.057674f, -0.228576f, -0.028868f, 0.181810f, 0.130381f, 0.132239f, -0.073835f, -0.148948f, 0.252035f, -0.209798f, 0.014703f, -0.004836f, 0.127392f, 0.081445f, 0.154755f, 0.009689f, -0.216554f, -0.313915f, 0.109846f, 0.085947f, -0.053696f, -0.009021f, -0.217513f, 0.078176f, -0.146621f, -0.024146f, -0.034251f, -0.159070f, 0.242714f, -0.224675f, 0.054516f, 0.219083f, -0.089843f, -0.266912f, 0.163754f, -0.126459f, -0.107093f, 0.065345f, -0.027620f, -0.305575f, -0.014505f, -0.158865f, -0.142482f, -0.165613f, 0.104808f, -0.035853f, 0.074034f, 0.030673f, 0.042214f, 0.119234f, -0.168233f, -0.631035f, 0.087247f, -0.202359f, 0.205784f, 0.157691f, 0.222658f, -0.391144f, -0.104608f, 0.024868f, 0.029120f, -0.057880f, 0.006844f, 0.079265f, 0.064602f, -0.207122f, -0.140360f, -0.044609f, -0.018927f, -0.328349f, -0.147453f, 0.015220f, -0.436469f, 0.014037f, 0.049138f, 0.032811f, -0.091794f, -0.038665f, -0.292939f, 0.218668f, -0.013404f, -0.009557f, 0.177091f, -0.102329f, 0.147744f, 0.291290f, -0.100355f, -0.230708f, 0.072685f, -0.146669f, 0.036526f, -0.022142f, -0.378919f, -0.046180f, 0.116987f, -0.216400f, -0.204993f, -0.084811f, 0.032613f, -0.045715f, 0.054595f, 0.067850f, -0.231226f, -0.161555f, 0.058863f, 0.006155f, 0.030949f, -0.104697f, -0.055130f, 0.029820f, 0.198778f, -0.163153f, -0.184712f, -0.258327f, 0.169872f, -0.132295f, 0.208006f, -0.271449f, 0.178584f, -0.186267f, -0.221092f, 0.085704f, -0.036869f, -0.299492f, 0.008039f, 0.097087f, 0.037961f, 0.216008f, -0.151578f, -0.065926f, 0.056310f, -0.114647f, -0.095619f, 0.093970f, 0.023287f, 0.134926f, 0.102346f, -0.208159f, -0.131728f, 0.171528f, 0.197040f, 0.051335f, 0.190336f, 0.086633f, -0.032204f, -0.123115f, -0.203349f, 0.217047f, -0.243060f, -0.184747f, -0.078771f, -0.120701f, -0.199390f, -0.125986f, -0.045197f, 0.104524f, 0.108215f, -0.020460f, -0.080324f, 0.137970f, -0.135794f, 0.121936f, 0.075618f, 0.010167f, -0.000554f, 0.167338f, -0.034991f, 0.084395f, -0.099280f, -0.126917f, -0.245368f, 0.005097f, 0.055876f, 0.000248f, -0.232217f, -0.071864f, 0.109909f, -0.003658f, -0.044453f, -0.212314f, 0.026484f, 0.131669f, 0.063424f, 0.041577f, -0.146724f, 0.032763f, 0.066364f, -0.195309f, -0.237605f, 0.144308f, -0.157998f, -0.323499f, -0.239422f, -0.125322f, -0.014304f, -0.191516f, -0.246195f, -0.204775f, 0.185241f, -0.100628f, -0.013183f, -0.280069f, 0.113299f, 0.099010f, -0.224012f, -0.142618f, -0.107194f, 0.133638f, 0.129731f, -0.137526f, -0.253983f, 0.133742f, 0.178636f, -0.272776f, -0.030377f, -0.021573f, -0.184081f, 0.011018f, -0.257869f, -0.018270f, -0.147269f, 0.035690f, -0.349318f, -0.211474f, -0.084663f, 0.099099f, -0.178954f, 0.181950f, -0.042796f, 0.118555f, -0.259434f, 0.053785f, 0.068775f, -0.336996f, 0.184396f, 0.181532f, 0.026993f, 0.002994f, 0.051252f, -0.252199f, -0.129941f, 0.236285f, -0.258092f, 0.354045f, -0.089155f, -0.157200f, 0.053918f, -0.085864f, 0.180051f, 0.019961f, 0.164185f, -0.308117f, 0.022887f, 0.204747f, 0.227816f, 0.022092f, -0.109069f, -0.458596f, 0.109231f, 0.205499f, -0.103539f, 0.305710f, 0.099549f, 0.112815f, 0.120542f, -0.089592f, -0.123277f, 0.034697f, 0.079189f, -0.162446f, 0.200202f, -0.208953f, -0.225776f, -0.118420f, -0.223937f, 0.064829f, 0.138480f, 0.199521f, -0.264278f, -0.060697f, -0.194676f, 0.204631f, -0.180152f, -0.090396f, 0.058235f, 0.059593f, -0.155068f, -0.200706f, 0.116314f, -0.083433f, 0.031274f, 0.102898f, 0.178877f, 0.159601f, -0.174334f, -0.166249f, -0.018882f, -0.159277f, -0.007449f, 0.045724f, 0.062577f, -0.104827f, 0.139856f, 0.058272f, 0.158434f, -0.196637f, 0.087378f, -0.082530f, -0.141010f, -0.177300f, -0.131965f, 0.006779f, -0.027579f, 0.043672f, 0.188119f, 0.017461f, -0.078285f, -0.224188f, 0.037586f, -0.041718f, -0.081260f, 0.175272f, -0.051222f, -0.133178f, -0.130550f, -0.175082f, -0.047752f, -0.125052f, 0.245542f, 0.037471f, 0.232524f, -0.191704f, -0.488942f, 0.234477f, 0.101853f, 0.030362f, -0.356823f, 0.025556f, -0.083826f, -0.042511f, 0.144692f, -0.090861f, -0.684951f, -0.226612f, -0.272773f, 0.043097f, -0.076841f, 0.054355f, -0.228615f, 0.021894f, 0.125399f, -0.239638f, 0.249176f, -0.138152f, -0.242549f, 0.031777f, -0.176195f, 0.158744f, 0.223654f, -0.252634f, -0.174877f, -0.296542f, 0.028168f, -0.172047f, -0.584655f, 0.078253f, -0.316349f, -0.002127f, 0.074139f, 0.006955f, -0.365832f, -0.376752f, 0.101175f, -0.067548f, -0.174057f, 0.020085f, 0.135840f, 0.020903f, 0.028428f, -0.427319f, -0.403812f, -0.129490f, -0.047339f, 0.176213f, -0.186588f, -0.100423f, -0.164674f, -0.419462f, -0.179871f, -0.086544f, 0.272497f, 0.196752f, -0.042583f, -0.418473f, -0.011799f, -0.012203f, 0.027355f, 0.186404f, 0.153973f, 0.107002f, 0.151680f, -0.071412f, -0.147001f, -0.077038f, 0.026977f, -0.309528f, -0.210219f, -0.095946f, -0.165219f, -0.064942f, -0.001922f, -0.157163f, 0.040553f, -0.016397f, 0.110023f, 0.000674f, 0.104333f, -0.209799f, -0.093857f, -0.079648f, -0.021692f, 0.257077f, -0.084674f, -0.276408f, 0.256328f, -0.176646f, -0.128383f, 0.001069f, -0.010161f, 0.076898f, 0.041332f, 0.162215f, -0.003755f, -0.202444f, 0.055524f, 0.240307f, -0.062683f, 0.124235f, 0.029213f, 0.028074f, -0.077059f, 0.164325f, 0.071096f, -0.054809f, -0.038999f, 0.121371f, -0.011803f, -0.049905f, 0.094890f, -0.003946f, 0.244639f, 0.071191f, -0.181265f, -0.070693f, 0.062036f, -0.106689f, -0.254336f, 0.036442f, -0.029833f, -0.300214f, 0.058495f, -0.090623f, 0.057909f, 0.136926f, 0.052996f, -0.159228f, -0.248984f, 0.060302f, -0.115180f, -0.243699f, -0.081887f, -0.107414f, -0.313609f, -0.050009f, -0.167739f, -0.298140f, -0.076458f, -0.027851f, 0.212140f, -0.260626f, -0.079289f, 0.143069f, -0.029535f, -0.028865f, 0.066558f, -0.104221f, 0.270413f, -0.157755f, -0.148130f, -0.121885f, 0.167425f, -0.022231f, 0.202045f, -0.147930f, 0.170102f, 0.062316f, -0.089310f, -0.204877f, -0.281994f, -0.096002f, 0.050092f, -0.274351f, -0.058231f, -0.163190f, 0.067350f, 0.240965f, -0.066488f, 0.029013f, 0.255732f, 0.255750f, -0.254054f, 0.004373f, -0.128403f, -0.023918f, -0.304081f, 0.006988f, 0.168046f, 0.125430f, 0.066329f, -0.138290f, 0.118671f };
+static const float prediction_next_power_gen_layer_2_biases[80] = { 0.030569f, -0.206233f, 0.162197f, -0.104788f, -0.040411f, 0.139832f, 0.057256f, 0.023050f, 0.102242f, 0.148996f, -0.105929f, 0.013154f, 0.092338f, -0.016979f, 0.077422f, 0.184525f, -0.009369f, 0.091083f, -0.017221f, 0.104148f, 0.009453f, -0.032879f, 0.141129f, -0.041766f, 0.197497f, 0.131571f, 0.157563f, 0.081000f, -0.039822f, 0.165223f, -0.009092f, 0.124816f, 0.148317f, 0.122245f, 0.119666f, -0.060304f, -0.022877f, 0.141084f, 0.166017f, 0.160242f, 0.125652f, -0.074810f, -0.188954f, 0.161109f, 0.124741f, 0.133523f, 0.116392f, -0.059085f, 0.040470f, 0.164575f, -0.005440f, 0.140513f, 0.239706f, 0.133709f, 0.122969f, 0.057822f, 0.157615f, 0.153160f, 0.051399f, 0.121496f, 0.158081f, -0.057814f, 0.142706f, 0.096353f, 0.148655f, -0.060540f, 0.083384f, 0.007590f, -0.058250f, -0.013801f, 0.158545f, 0.050054f, 0.057036f, 0.133780f, 0.103615f, 0.139446f, -0.036462f, -0.103362f, 0.005840f, -0.045781f };
+static const float prediction_next_power_gen_layer_2_weights[6400] = { -0.143579f, 0.257500f, 0.152853f, -0.094834f, -0.194887f, -0.078699f, 0.022706f, -0.148972f, -0.174990f, 0.097592f, -0.146840f, -0.149030f, -0.176689f, -0.162882f, -0.161533f, 0.108032f, 0.046187f, 0.034197f, 0.061507f, 0.077988f, -0.090270f, -0.170005f, -0.188647f, 0.073967f, -0.004940f, -0.107134f, -0.009973f, 0.273833f, 0.005128f, 0.083567f, 0.168891f, -0.110448f, -0.195815f, -0.146288f, 0.136468f, -0.096114f, 0.001939f, 0.037860f, -0.095576f, -0.048631f, -0.108380f, 0.026810f, 0.014728f, 0.573281f, 0.194126f, -0.020588f, 0.058697f, -0.059140f, 0.110267f, 0.190357f, 0.081702f, 0.014525f, 0.027401f, 0.101647f, -0.120750f, 0.118517f, 0.169502f, 0.145268f, -0.303330f, -0.130826f, -0.151619f, -0.101607f, 0.118072f, 0.084514f, -0.002230f, -0.197766f, 0.250561f, -0.015465f, -0.071252f, -0.005998f, 0.194275f, -0.041994f, -0.363840f, 0.012360f, -0.168194f, -0.215825f, -0.274017f, 0.057006f, -0.126063f, -0.125392f, 0.148958f, 0.087345f, -0.149391f, 0.041066f, -0.021357f, -0.077954f, -0.125043f, -0.010101f, -0.045137f, 0.026731f, 0.121842f, -0.102562f, 0.138067f, 0.074771f, 0.038852f, 0.177284f, -0.087983f, -0.007018f, 0.165877f, 0.067982f, -0.016323f, 0.196065f, -0.063998f, 0.249996f, 0.016646f, 0.136397f, 0.090311f, -0.011894f, -0.100016f, -0.090508f, -0.038765f, -0.142965f, -0.109548f, -0.179578f, 0.006615f, 0.028801f, -0.055697f, -0.100112f, 0.133615f, 0.175722f, -0.019381f, -0.001328f, 0.017352f, 0.019295f, -0.096878f, 0.080257f, 0.111763f, -0.058171f, -0.179877f, -0.280784f, 0.019451f, -0.095322f, -0.001905f, 0.132129f, -0.069936f, 0.005966f, -0.017103f, -0.022335f, -0.082439f, -0.086879f, 0.115764f, 0.053405f, 0.184382f, 0.026070f, -0.018351f, -0.005239f, 0.121632f, -0.244670f, -0.150074f, -0.142989f, 0.065167f, 0.023206f, 0.135399f, -0.179720f, 0.098035f, -0.162267f, 0.102660f, 0.012858f, -0.089361f, 0.132963f, 0.247142f, 0.089233f, 0.065863f, -0.146569f, 0.115436f, 0.111720f, 0.074732f, -0.041830f, -0.156370f, -0.125825f, -0.062596f, 0.182758f, 0.175490f, 0.179334f, -0.176396f, 0.159332f, -0.010456f, 0.170946f, 0.133916f, -0.040053f, 0.199591f, 0.152556f, -0.077956f, 0.074740f, -0.076172f, -0.050492f, 0.172788f, 0.055862f, 0.064098f, -0.128299f, -0.003883f, 0.095122f, -0.318425f, -0.013676f, 0.450715f, 0.104057f, 0.133192f, -0.140616f, 0.069165f, -0.023309f, 0.174961f, 0.032734f, -0.003079f, 0.593265f, 0.040439f, 0.165521f, 0.210966f, -0.001273f, -0.080944f, 0.328299f, 0.042205f, 0.236557f, 0.207367f, -0.110647f, 0.321359f, -0.080134f, 0.115223f, 0.010358f, -0.094502f, -0.016800f, 0.175280f, 0.230635f, 0.105629f, -0.095373f, 0.158362f, 0.215569f, 0.155775f, -0.051506f, 0.146688f, -0.034789f, 0.214291f, 0.187199f, 0.136524f, 0.167105f, -0.223581f, -0.111180f, -0.421766f, 0.216460f, 0.114289f, 0.010665f, -0.191838f, 0.024802f, -0.045683f, 0.142177f, -0.062236f, 0.116502f, 0.029555f, -0.216463f, -0.053627f, 0.052352f, 0.157794f, -0.118280f, -0.128876f, -0.078030f, -0.138392f, 0.014589f, -0.116947f, 0.094935f, 0.138532f, -0.169683f, 0.021976f, -0.038776f, 0.074255f, 0.097035f, 0.112645f, -0.372736f, 0.008588f, 0.056441f, 0.045501f, 0.133991f, -0.169816f, -0.197431f, -0.113680f, -0.141548f, 0.272353f, 0.072137f, 0.000792f, -0.179678f, 0.077081f, -0.066852f, -0.183380f, -0.038783f, -0.073990f, 0.110453f, -0.203485f, -0.040862f, 0.084156f, 0.004261f, 0.010906f, 0.222210f, 0.018101f, -0.068085f, 0.048248f, -0.180184f, 0.017895f, 0.132696f, -0.031811f, 0.028301f, -0.090861f, 0.120636f, -0.172249f, 0.132189f, 0.104002f, -0.154207f, -0.066621f, -0.051394f, 0.130393f, -0.117078f, -0.159413f, -0.079005f, -0.168319f, -0.159559f, -0.182975f, 0.083110f, -0.154483f, -0.057894f, -0.021852f, 0.001138f, 0.062236f, 0.103829f, 0.059617f, -0.110814f, -0.003390f, -0.086384f, 0.017476f, 0.017636f, -0.018095f, -0.180208f, 0.149882f, -0.199789f, -0.165604f, 0.055394f, -0.132100f, -0.170576f, 0.108372f, -0.049163f, 0.162671f, -0.153194f, 0.000103f, -0.085940f, 0.046387f, -0.010257f, 0.011271f, -0.097488f, -0.110623f, -0.083569f, -0.067149f, 0.017209f, 0.054850f, -0.005927f, 0.012553f, -0.060974f, 0.026953f, -0.003355f, 0.110649f, -0.108661f, -0.103606f, 0.147602f, 0.102423f, -0.222833f, 0.147113f, 0.015785f, 0.007787f, -0.181304f, 0.002741f, -0.062043f, 0.055362f, 0.127157f, -0.065376f, 0.142021f, -0.149298f, -0.201127f, -0.198246f, 0.131559f, -0.023970f, -0.000141f, 0.104496f, -0.005359f, -0.183438f, -0.085669f, 0.099554f, -0.070931f, 0.097252f, -0.182477f, -0.061470f, -0.188007f, -0.004078f, 0.120896f, 0.113817f, 0.062336f, -0.139624f, -0.045695f, 0.106124f, 0.107683f, 0.091837f, 0.109265f, -0.182633f, -0.173827f, 0.060340f, -0.123775f, 0.106480f, 0.125544f, 0.092128f, 0.120152f, -0.221778f, 0.048603f, -0.008686f, 0.130271f, -0.043503f, 0.113851f, 0.163197f, 0.145476f, -0.003976f, -0.034662f, 0.053942f, 0.163025f, -0.069746f, 0.139537f, -0.045734f, 0.207734f, 0.184591f, 0.027607f, -0.093826f, -0.193670f, 0.159573f, -0.123649f, -0.153811f, 0.202220f, 0.038845f, 0.044934f, 0.039028f, -0.079519f, -0.128196f, 0.210009f, 0.186242f, 0.011395f, -0.091599f, 0.103713f, -0.110271f, 0.146042f, 0.124476f, 0.192947f, 0.209718f, 0.254808f, 0.078792f, 0.135259f, 0.056108f, 0.146574f, 0.123841f, 0.332928f, 0.169032f, -0.057003f, 0.129149f, 0.108363f, 0.104322f, -0.186402f, 0.324239f, -0.155623f, 0.170442f, -0.032174f, 0.023367f, -0.006089f, -0.173554f, -0.142625f, 0.033724f, 0.191443f, 0.246695f, -0.125919f, 0.078742f, 0.104693f, 0.108810f, 0.106082f, 0.051570f, 0.007654f, -0.137579f, 0.013586f, -0.206344f, 0.006283f, -0.093972f, 0.017336f, -0.066990f, 0.049785f, -0.069091f, -0.139974f, 0.080685f, -0.028372f, 0.104008f, -0.163998f, 0.194951f, -0.016730f, -0.109231f, -0.002069f, 0.053822f, 0.141964f, 0.145438f, 0.114651f, -0.007866f, -0.109616f, 0.220390f, -0.121115f, -0.029535f, 0.188741f, -0.002727f, -0.069995f, 0.002142f, -0.260898f, 0.136242f, 0.226002f, -0.140794f, 0.014989f, 0.060345f, 0.095464f, -0.143351f, -0.122340f, 0.262654f, -0.078810f, -0.159873f, -0.097301f, -0.163281f, 0.082104f, 0.074809f, 0.148709f, 0.108022f, 0.318017f, -0.100870f, 0.035431f, -0.057735f, -0.155121f, -0.151400f, -0.172050f, -0.145156f, 0.064842f, 0.017147f, -0.054396f, 0.008226f, -0.067747f, 0.336998f, -0.024843f, 0.245276f, 0.190453f, -0.094642f, 0.188331f, -0.102533f, 0.196106f, 0.114010f, 0.182443f, 0.004892f, -0.106391f, 0.058552f, -0.066645f, 0.003777f, -0.106900f, -0.027523f, 0.039004f, -0.370759f, -0.133493f, -0.276781f, 0.202276f, -0.055072f, -0.172317f, 0.014791f, 0.096808f, 0.270231f, -0.311011f, 0.187897f, -0.122818f, -0.165525f, 0.120215f, -0.132909f, -0.206405f, -0.170844f, -0.408012f, -0.018343f, 0.210988f, 0.380382f, 0.167174f, -0.005347f, -0.046902f, -0.378772f, -0.192176f, 0.036507f, -0.427371f, -0.090925f, 0.085947f, 0.012232f, -0.259257f, 0.161332f, -0.157638f, 0.036943f, -0.016221f, -0.349788f, 0.150127f, 0.281141f, -0.325966f, -0.026121f, 0.020969f, -0.239078f, -0.316274f, -0.109654f, -0.055304f, -0.080670f, -0.258025f, -0.046605f, -0.062884f, -0.319350f, -0.066645f, -0.162903f, -0.125638f, 0.010897f, 0.104363f, 0.149135f, 0.087325f, -0.042870f, -0.113893f, -0.178964f, 0.058241f, 0.042031f, 0.013648f, 0.122900f, -0.273414f, 0.387561f, -0.283987f, 0.229456f, 0.034893f, 0.120481f, 0.037767f, 0.026241f, -0.078678f, 0.180924f, -0.221764f, -0.106358f, -0.001783f, -0.270415f, -0.144058f, -0.265155f, -0.240055f, -0.167674f, 0.137329f, 0.097182f, -0.137701f, -0.019485f, -0.219684f, 0.163096f, 0.159162f, 0.172434f, -0.101432f, 0.081100f, -0.165878f, 0.028069f, -0.024026f, -0.159250f, -0.041167f, 0.114299f, 0.025293f, 0.103122f, 0.055875f, 0.053801f, -0.146885f, 0.033711f, -0.112227f, 0.009401f, 0.196047f, 0.115174f, 0.067302f, 0.050353f, 0.129567f, 0.155023f, 0.259638f, 0.109237f, -0.000553f, -0.105735f, -0.154289f, -0.020647f, -0.017307f, 0.348216f, -0.146948f, -0.203655f, 0.184530f, -0.193454f, 0.147065f, -0.160028f, 0.149697f, 0.022712f, 0.179646f, -0.124883f, -0.200645f, -0.144553f, -0.119723f, 0.123414f, -0.112867f, 0.135497f, -0.123298f, 0.063559f, -0.000303f, 0.062577f, -0.139997f, 0.078654f, -0.135297f, 0.055656f, 0.047409f, -0.069074f, -0.124018f, -0.269815f, -0.130868f, 0.005930f, 0.126443f, -0.124398f, -0.129434f, -0.019314f, -0.193700f, 0.023556f, 0.034726f, 0.065119f, 0.055102f, -0.041441f, -0.196034f, -0.429657f, 0.108676f, 0.064979f, -0.106681f, 0.170539f, 0.118082f, -0.136973f, 0.105918f, -0.036945f, -0.177424f, 0.183461f, 0.006728f, 0.039566f, 0.069384f, 0.132040f, 0.117534f, 0.237577f, -0.123960f, -0.160438f, 0.191086f, -0.052819f, -0.050725f, 0.000227f, 0.066832f, 0.221185f, 0.229030f, 0.071870f, -0.100989f, 0.215422f, 0.018730f, -0.120019f, 0.088446f, -0.105644f, 0.128802f, -0.141190f, -0.117653f, -0.051664f, -0.004880f, 0.285761f, 0.142924f, 0.165065f, -0.026914f, -0.068694f, 0.105883f, 0.040017f, 0.113449f, 0.218203f, 0.253829f, -0.031957f, 0.003749f, 0.064813f, -0.113120f, -0.126530f, 0.306853f, -0.077628f, -0.019927f, 0.273437f, -0.014869f, -0.008050f, 0.054397f, 0.029792f, 0.175296f, -0.026025f, -0.088684f, 0.022857f, 0.159537f, -0.031628f, -0.135935f, -0.029026f, -0.000725f, 0.260345f, 0.031012f, 0.048580f, 0.080286f, -0.050194f, -0.006952f, 0.105607f, 0.206615f, -0.284193f, 0.020779f, -0.407274f, 0.174018f, 0.078321f, -0.144241f, -0.209993f, 0.011628f, 0.112803f, -0.092205f, -0.255242f, -0.150780f, -0.004169f, -0.244036f, 0.004032f, 0.167677f, 0.206666f, -0.177605f, -0.237584f, 0.040569f, -0.101267f, 0.170888f, 0.158508f, -0.159364f, -0.103596f, -0.120720f, 0.097008f, -0.070310f, 0.153222f, -0.158805f, -0.161688f, -0.086835f, 0.030591f, 0.103260f, 0.095988f, 0.132485f, 0.044471f, -0.217916f, -0.039073f, -0.015991f, 0.354344f, 0.171500f, -0.334640f, 0.179427f, 0.102102f, 0.146608f, -0.276904f, -0.021800f, 0.117658f, -0.236102f, 0.008492f, -0.182629f, 0.004845f, 0.063983f, -0.036692f, -0.268427f, 0.223531f, 0.286124f, 0.055639f, -0.132055f, 0.254689f, 0.031296f, 0.092768f, -0.014942f, -0.146384f, -0.199484f, 0.013783f, -0.152028f, -0.084380f, 0.083135f, 0.001623f, -0.169740f, -0.135480f, 0.142414f, -0.078931f, 0.003546f, 0.175929f, 0.161247f, 0.096741f, -0.333481f, -0.073640f, -0.086243f, -0.452313f, 0.091347f, 0.053707f, 0.040798f, 0.023601f, 0.341538f, -0.109200f, -0.052917f, 0.054989f, -0.035985f, 0.157516f, -0.128527f, -0.155745f, -0.025950f, 0.036366f, 0.141439f, -0.068760f, 0.068978f, -0.200553f, -0.137544f, 0.018208f, 0.000824f, -0.139912f, 0.039907f, 0.195544f, 0.014064f, -0.135295f, -0.261376f, 0.092404f, 0.036149f, 0.105992f, 0.081351f, 0.074883f, 0.102769f, -0.057008f, -0.191643f, -0.271902f, -0.070355f, 0.344940f, -0.047518f, -0.118798f, -0.091979f, 0.008529f, 0.008076f, 0.058525f, -0.060818f, 0.203791f, 0.274030f, -0.142213f, -0.107294f, -0.187345f, -0.176559f, -0.085610f, 0.454900f, -0.046561f, -0.031304f, 0.245666f, 0.031770f, 0.086024f, 0.163662f, 0.356243f, -0.057198f, 0.153072f, -0.077928f, -0.046782f, 0.162350f, -0.221627f, 0.030700f, 0.166462f, -0.072559f, 0.169510f, -0.150735f, -0.197369f, 0.169839f, 0.041612f, 0.053878f, 0.014564f, -0.018409f, -0.072613f, -0.023324f, -0.481224f, 0.098386f, -0.078800f, -0.142778f, -0.179938f, 0.014212f, 0.012970f, -0.122513f, 0.145757f, -0.139081f, -0.217174f, 0.018465f, -0.068237f, -0.181092f, -0.069345f, 0.174904f, 0.090014f, -0.027967f, -0.180735f, -0.084403f, -0.012933f, 0.161981f, -0.190293f, 0.074514f, -0.101665f, -0.162913f, -0.101846f, -0.034497f, 0.116525f, -0.084401f, -0.110370f, -0.019678f, 0.145241f, -0.022069f, -0.004969f, -0.137307f, -0.352254f, 0.098624f, 0.213929f, -0.048163f, -0.047604f, -0.184328f, -0.052008f, 0.064004f, 0.197036f, -0.060533f, 0.135509f, 0.528082f, 0.142855f, -0.027844f, -0.183822f, -0.056128f, -0.155697f, 0.317291f, -0.214188f, -0.169005f, -0.085470f, 0.047835f, -0.129920f, -0.058083f, -0.031082f, -0.102726f, -0.132513f, 0.154012f, 0.099371f, 0.081575f, -0.036429f, 0.187171f, 0.106986f, 0.159786f, 0.255852f, 0.046968f, -0.075469f, 0.206251f, -0.118306f, -0.148435f, 0.168837f, 0.066886f, 0.060781f, 0.189827f, -0.094892f, 0.082517f, 0.008518f, -0.167152f, -0.219158f, -0.234288f, 0.059338f, 0.025799f, -0.208357f, 0.188125f, -0.144322f, -0.119959f, 0.005780f, -0.039813f, -0.108094f, 0.008917f, 0.013128f, -0.163997f, -0.012746f, -0.093317f, 0.000391f, 0.177649f, 0.180209f, 0.006457f, -0.168682f, -0.218203f, 0.178275f, -0.140915f, 0.160987f, 0.082410f, -0.147221f, 0.111638f, -0.057803f, -0.104940f, 0.147411f, -0.099921f, -0.007968f, -0.016171f, -0.035380f, 0.176241f, -0.364365f, 0.136404f, -0.163888f, -0.149376f, 0.066816f, 0.058419f, 0.137049f, -0.185494f, -0.244200f, 0.167813f, -0.076669f, 0.055503f, -0.173630f, -0.046475f, 0.044825f, 0.047185f, -0.043954f, 0.003829f, 0.074703f, -0.142026f, 0.209709f, 0.067139f, -0.169095f, 0.175961f, -0.043290f, 0.041183f, 0.027217f, 0.076889f, -0.113659f, 0.058649f, -0.014513f, 0.089916f, -0.161395f, -0.068271f, -0.177472f, -0.139772f, -0.109353f, -0.026256f, 0.092952f, -0.139261f, 0.059882f, 0.077687f, -0.052996f, -0.027578f, 0.177200f, -0.048602f, 0.154648f, 0.220862f, 0.180893f, 0.213555f, 0.185782f, -0.127782f, 0.015644f, -0.297295f, -0.048656f, -0.662296f, 0.065830f, 0.055872f, 0.251006f, 0.158469f, 0.028484f, 0.068626f, -0.087842f, -0.106034f, 0.189313f, -0.038272f, -0.003256f, 0.150352f, 0.011994f, 0.037890f, 0.171668f, -0.138988f, -0.128533f, 0.243908f, -0.283951f, -0.111204f, -0.038762f, 0.083975f, -0.119068f, 0.023713f, -0.428967f, 0.082826f, -0.122007f, 0.105564f, -0.106614f, -0.136596f, 0.049912f, 0.035273f, -0.319921f, -0.099660f, -0.097970f, -0.074115f, 0.198384f, 0.042549f, 0.309513f, -0.148271f, -0.182579f, -0.042689f, -0.077118f, -0.067309f, -0.155740f, -0.057679f, 0.167339f, 0.095707f, -0.103099f, 0.108456f, 0.230490f, 0.052304f, 0.062843f, 0.135106f, -0.057509f, -0.149939f, 0.083270f, -0.231361f, 0.057570f, -0.033446f, 0.057977f, 0.076113f, -0.041164f, -0.144545f, 0.108904f, 0.194416f, 0.125502f, 0.038536f, 0.199144f, 0.404703f, -0.080639f, -0.012741f, -0.050179f, 0.012134f, -0.018022f, 0.194015f, -0.098806f, -0.105629f, -0.035722f, -0.016224f, 0.176662f, 0.265350f, -0.054840f, -0.001211f, -0.154492f, 0.011492f, 0.045284f, 0.224269f, -0.038947f, 0.019192f, 0.068289f, -0.160168f, 0.106019f, -0.267397f, -0.110567f, 0.277925f, 0.055405f, 0.156172f, -0.139001f, 0.185064f, -0.269921f, 0.246424f, 0.419129f, -0.089782f, 0.195306f, 0.145577f, -0.143594f, 0.163896f, -0.001414f, 0.040645f, 0.087266f, 0.430774f, 0.280402f, -0.023203f, 0.118331f, 0.092117f, 0.142284f, 0.156537f, 0.264053f, -0.024680f, 0.133555f, 0.167242f, 0.216685f, -0.113744f, 0.162669f, 0.016555f, 0.031093f, 0.092344f, 0.180127f, 0.227163f, -0.142191f, -0.033193f, 0.160208f, -0.017364f, 0.192278f, 0.080428f, -0.000064f, 0.142726f, 0.055446f, 0.160117f, -0.124384f, -0.037712f, -0.250886f, 0.104188f, -0.383165f, 0.140106f, -0.079092f, 0.126329f, 0.184304f, 0.105269f, -0.082305f, 0.186424f, -0.096179f, 0.036707f, -0.072846f, -0.200470f, -0.192526f, -0.421699f, -0.206503f, -0.270319f, 0.100935f, 0.198523f, 0.372821f, 0.062585f, -0.160080f, 0.064508f, -0.424515f, 0.105963f, -0.128499f, -0.356747f, 0.023992f, 0.229912f, -0.279778f, 0.005305f, 0.039357f, -0.196836f, 0.044946f, -0.402389f, -0.495913f, -0.162424f, 0.283176f, -0.497158f, 0.125753f, -0.138111f, -0.132072f, -0.427117f, -0.167827f, -0.117446f, 0.071040f, -0.258551f, 0.096080f, -0.282717f, -0.572396f, -0.284528f, -0.168240f, -0.216357f, -0.186634f, -0.057260f, -0.498082f, -0.118298f, -0.172447f, 0.023967f, 0.122610f, 0.038093f, 0.014127f, -0.273255f, -0.118971f, 0.144519f, 0.266708f, -0.143093f, 0.297170f, 0.135166f, 0.258318f, 0.125826f, 0.031489f, 0.020565f, 0.247732f, 0.041415f, 0.122702f, 0.020405f, 0.004372f, 0.048031f, 0.082414f, 0.012136f, 0.054350f, 0.175000f, 0.303043f, 0.117094f, 0.043195f, 0.152866f, -0.162922f, 0.056535f, -0.076677f, -0.031991f, 0.133287f, 0.089826f, -0.132215f, 0.111382f, -0.180040f, -0.023856f, 0.005826f, 0.120842f, 0.010083f, 0.062328f, 0.045628f, 0.136085f, 0.196717f, -0.055061f, -0.084426f, 0.165687f, -0.087319f, -0.318200f, 0.069395f, -0.359517f, -0.080769f, 0.270227f, 0.028364f, -0.079224f, -0.078269f, 0.133180f, -0.494971f, -0.084792f, 0.469088f, 0.087230f, -0.147851f, -0.099455f, 0.094573f, 0.014065f, 0.070834f, -0.107960f, 0.187448f, 0.334714f, -0.114742f, -0.044411f, -0.099778f, -0.162635f, 0.065306f, 0.239062f, 0.019367f, 0.180255f, 0.189252f, -0.105380f, 0.127736f, 0.023597f, 0.260671f, 0.157964f, 0.055890f, -0.032933f, -0.128654f, -0.203656f, -0.231460f, 0.155228f, -0.038473f, 0.093162f, -0.124794f, -0.049338f, 0.104560f, 0.032741f, 0.173506f, -0.148566f, 0.019715f, -0.099298f, -0.154276f, 0.123466f, -0.440083f, -0.079575f, 0.028020f, 0.047528f, -0.031319f, -0.029208f, -0.045261f, 0.130941f, -0.193396f, -0.058359f, 0.026487f, -0.195166f, -0.081548f, 0.131498f, -0.126059f, -0.210570f, -0.132286f, 0.033403f, -0.009952f, 0.038144f, -0.192353f, 0.138658f, 0.137512f, 0.073938f, 0.072882f, -0.004432f, -0.160845f, -0.226894f, 0.145564f, -0.142023f, -0.122221f, 0.139989f, 0.153222f, -0.210572f, -0.177878f, -0.148907f, -0.208591f, 0.096218f, 0.072101f, -0.079578f, -0.136213f, 0.069566f, -0.192070f, -0.034715f, 0.003373f, -0.000092f, 0.057182f, 0.011377f, -0.024865f, -0.220379f, 0.011779f, -0.051087f, 0.152124f, 0.036537f, 0.166199f, 0.055850f, -0.051924f, -0.183932f, -0.127533f, -0.073934f, 0.086152f, -0.056985f, 0.129113f, -0.042519f, 0.145014f, -0.069954f, -0.228262f, -0.185496f, 0.038710f, -0.073124f, 0.073331f, -0.134703f, 0.060478f, 0.011392f, -0.061616f, -0.006221f, 0.002623f, -0.120905f, -0.101013f, -0.188984f, -0.081330f, -0.148060f, 0.142503f, -0.081636f, -0.173514f, 0.053461f, -0.117826f, -0.110170f, 0.158426f, -0.042469f, -0.143410f, -0.136964f, -0.137888f, -0.064387f, -0.118051f, -0.162885f, 0.211366f, 0.025884f, -0.179839f, -0.112819f, -0.162843f, -0.088922f, -0.059246f, 0.006733f, 0.093311f, 0.179161f, 0.098875f, -0.014202f, 0.112529f, -0.032828f, 0.015963f, 0.039919f, 0.221204f, -0.161236f, 0.026403f, -0.165304f, -0.447851f, -0.080280f, 0.346545f, 0.153337f, 0.204949f, 0.197957f, 0.117872f, -0.018447f, -0.050307f, 0.210965f, -0.114856f, 0.348173f, 0.062059f, 0.155445f, -0.117523f, -0.154391f, 0.145379f, 0.252590f, -0.090752f, 0.205413f, 0.125406f, -0.101249f, 0.352350f, -0.118060f, 0.156851f, 0.176973f, -0.082618f, -0.121225f, -0.109406f, -0.110224f, 0.059069f, 0.183702f, 0.055350f, 0.161311f, 0.147952f, -0.135873f, -0.146447f, 0.012487f, 0.207793f, 0.021778f, -0.387583f, -0.117728f, -0.236726f, 0.162680f, -0.249313f, 0.032530f, 0.061839f, 0.164291f, 0.168153f, -0.052690f, 0.232748f, -0.107367f, 0.160668f, 0.054425f, 0.066177f, 0.094298f, -0.034894f, -0.037942f, -0.088146f, -0.110096f, 0.119598f, -0.244736f, 0.157844f, -0.185142f, 0.110109f, 0.116325f, -0.166913f, -0.059373f, -0.134801f, -0.187926f, 0.099564f, 0.185735f, -0.031654f, 0.031939f, 0.125756f, -0.013316f, 0.298208f, 0.075942f, 0.260550f, 0.061206f, 0.044371f, -0.013353f, -0.150996f, 0.048479f, -0.444168f, 0.166318f, -0.243093f, -0.133676f, -0.281553f, 0.133101f, 0.023328f, -0.218085f, -0.324347f, 0.038484f, -0.020958f, -0.209934f, 0.013251f, -0.304122f, -0.187094f, 0.121158f, -0.168722f, -0.017463f, 0.087676f, 0.209408f, 0.053295f, 0.098266f, -0.142030f, -0.078545f, -0.109558f, -0.038084f, -0.045027f, -0.305595f, -0.023509f, 0.199192f, 0.233451f, -0.049698f, -0.021437f, -0.075018f, 0.058762f, -0.057930f, -0.122690f, 0.106760f, 0.211291f, 0.015372f, -0.271148f, -0.148969f, 0.224120f, 0.234934f, -0.102726f, -0.145481f, -0.163205f, -0.140647f, -0.121949f, -0.188031f, -0.215786f, -0.147843f, -0.163268f, 0.158250f, -0.040490f, 0.072864f, 0.074520f, 0.108395f, 0.061472f, 0.068187f, -0.140587f, 0.066680f, -0.177507f, -0.030415f, -0.133603f, 0.102337f, -0.197307f, -0.120907f, -0.038115f, 0.027468f, -0.200504f, -0.102453f, -0.102237f, -0.087489f, -0.052422f, 0.076146f, -0.193526f, 0.136668f, 0.049369f, -0.168020f, -0.118814f, -0.148199f, 0.175391f, -0.170471f, -0.038799f, -0.127489f, -0.156790f, -0.048299f, 0.097775f, -0.115655f, 0.058664f, 0.027647f, 0.030425f, 0.000064f, 0.121496f, -0.147410f, -0.034152f, -0.150581f, 0.146444f, -0.138321f, -0.081036f, -0.134383f, -0.141656f, -0.187990f, 0.160436f, 0.136590f, -0.184385f, 0.053909f, 0.075130f, -0.094012f, -0.049554f, 0.139817f, 0.014850f, -0.054205f, -0.041614f, 0.040072f, 0.019799f, 0.032234f, -0.187257f, 0.051208f, -0.057403f, 0.013966f, 0.096328f, -0.028882f, 0.175872f, 0.377174f, 0.156081f, -0.068082f, -0.124867f, 0.188381f, 0.187165f, -0.091254f, -0.111851f, 0.173625f, 0.128506f, 0.003957f, 0.060942f, -0.057797f, 0.083196f, -0.071525f, 0.060112f, 0.011087f, 0.185454f, 0.088728f, -0.086172f, -0.010438f, -0.091623f, -0.228016f, 0.211407f, -0.243344f, 0.149560f, 0.118562f, -0.011664f, -0.030893f, 0.032869f, -0.017320f, -0.006309f, -0.085967f, 0.433488f, 0.172242f, 0.164711f, 0.103573f, 0.195377f, 0.239261f, -0.044777f, 0.079124f, 0.226559f, 0.250406f, 0.106726f, 0.108268f, 0.051957f, 0.115673f, 0.125276f, 0.344517f, -0.004469f, 0.137779f, 0.157667f, 0.048936f, 0.015240f, -0.101055f, 0.334025f, 0.073096f, 0.087366f, -0.067862f, 0.060659f, -0.127260f, 0.152972f, 0.155552f, -0.006498f, 0.038281f, 0.154870f, 0.096958f, -0.133877f, -0.039338f, 0.022665f, -0.025888f, -0.001560f, 0.158246f, 0.064907f, -0.027788f, -0.227541f, -0.023624f, -0.171464f, 0.127369f, 0.026643f, 0.120293f, -0.027238f, 0.064487f, 0.075203f, 0.113734f, 0.099514f, -0.193551f, 0.012542f, -0.417488f, -0.087467f, -0.366430f, 0.011478f, -0.186704f, 0.236247f, 0.065298f, -0.187116f, -0.032668f, -0.251012f, -0.140297f, -0.228297f, -0.203573f, -0.051321f, 0.246489f, -0.071475f, 0.209626f, -0.056562f, 0.093938f, -0.204242f, 0.009734f, -0.359915f, -0.431864f, 0.218169f, -0.462311f, -0.093503f, 0.000277f, -0.015835f, -0.237520f, -0.254186f, -0.329395f, 0.030742f, -0.377579f, 0.048358f, -0.026026f, -0.235344f, -0.297017f, -0.427248f, 0.066688f, -0.000461f, -0.175828f, -0.357144f, -0.177295f, -0.481102f, 0.046686f, -0.062245f, -0.130782f, 0.116613f, -0.266419f, -0.051728f, 0.006191f, 0.091250f, 0.073947f, -0.140486f, -0.077477f, -0.061001f, -0.108982f, -0.113681f, 0.132525f, 0.104798f, -0.347982f, -0.020779f, -0.193780f, -0.223824f, -0.192141f, 0.081310f, -0.157105f, -0.050999f, 0.073929f, 0.246739f, -0.059225f, -0.183183f, -0.357589f, 0.111809f, -0.023341f, -0.126754f, 0.080163f, 0.187476f, -0.061906f, -0.032844f, 0.005799f, 0.069156f, -0.369742f, 0.283884f, 0.153710f, 0.301691f, -0.128630f, 0.003989f, 0.014933f, -0.045580f, 0.150303f, -0.510920f, 0.048019f, -0.206534f, 0.092502f, -0.106445f, -0.194899f, -0.193632f, -0.076583f, -0.155310f, -0.250886f, -0.201288f, -0.039050f, -0.521830f, -0.239630f, 0.126348f, 0.090545f, 0.051315f, -0.219153f, -0.115101f, -0.066800f, -0.131648f, 0.087806f, 0.036564f, -0.319075f, -0.326115f, -0.412950f, -0.032889f, 0.098843f, -0.229641f, 0.020902f, -0.015448f, -0.162211f, -0.124069f, -0.106361f, 0.108939f, -0.007179f, -0.073771f, -0.283389f, 0.029555f, -0.199297f, 0.229116f, -0.266683f, -0.634083f, 0.231043f, -0.526407f, -0.088970f, 0.308026f, -0.243690f, -0.054366f, -0.276323f, 0.197060f, 0.057246f, 0.307580f, -0.131876f, 0.255754f, 0.235227f, 0.092003f, -0.028497f, -0.078572f, 0.185390f, 0.205817f, 0.016771f, 0.057035f, 0.130014f, 0.062369f, 0.132340f, -0.133099f, 0.107316f, -0.008944f, -0.167643f, 0.230250f, -0.012070f, 0.226121f, 0.237831f, 0.129182f, -0.031015f, 0.115449f, 0.199149f, 0.238627f, 0.056146f, 0.040376f, -0.026499f, -0.102072f, -0.141882f, 0.089132f, -0.023869f, 0.067965f, 0.038766f, 0.119932f, 0.064735f, 0.021193f, 0.078768f, -0.088229f, 0.071429f, 0.391749f, 0.063482f, -0.133158f, 0.115180f, 0.018369f, -0.058603f, 0.196288f, 0.212171f, -0.036653f, 0.328138f, 0.064084f, -0.035508f, -0.100611f, -0.041068f, 0.136371f, 0.329331f, 0.255249f, -0.035350f, 0.113635f, 0.001630f, 0.081645f, -0.032522f, 0.126422f, 0.142469f, 0.008317f, 0.040828f, 0.024743f, 0.077705f, 0.013045f, 0.033447f, 0.104471f, 0.062755f, 0.085945f, 0.165571f, -0.011085f, -0.086816f, 0.245364f, -0.090144f, -0.149086f, -0.092587f, -0.112713f, -0.048075f, -0.421614f, 0.197910f, -0.065434f, -0.066743f, -0.058657f, 0.060565f, 0.193004f, -0.082877f, 0.038808f, 0.085909f, 0.164763f, -0.029712f, 0.205373f, -0.032558f, -0.047697f, -0.029807f, 0.124239f, 0.190995f, -0.108836f, -0.149286f, 0.176525f, -0.148286f, 0.011605f, 0.050542f, 0.000733f, 0.032331f, 0.019260f, 0.060624f, 0.088602f, -0.106077f, 0.139868f, 0.023243f, 0.097349f, 0.034820f, -0.147007f, -0.095133f, -0.179580f, 0.066610f, 0.410664f, -0.047767f, 0.214375f, -0.062775f, 0.078594f, 0.190784f, -0.132439f, 0.217177f, 0.162390f, 0.392564f, 0.217378f, 0.046992f, 0.034155f, -0.000449f, 0.100341f, 0.264339f, 0.114248f, -0.050661f, 0.269474f, -0.090453f, 0.236294f, -0.096670f, 0.235655f, 0.114171f, 0.225324f, 0.173905f, 0.168102f, -0.121369f, -0.204841f, 0.041929f, -0.171494f, 0.036776f, 0.038296f, -0.027891f, 0.120134f, 0.111082f, 0.248257f, -0.109210f, 0.068491f, 0.167301f, -0.070900f, 0.025364f, -0.202837f, 0.201692f, -0.138866f, 0.096769f, 0.113796f, 0.315486f, 0.115678f, -0.054577f, 0.058257f, -0.067568f, -0.072604f, -0.144873f, -0.073473f, 0.076812f, 0.083177f, 0.130401f, -0.132798f, -0.063467f, 0.092691f, 0.022195f, -0.155669f, 0.089570f, -0.119684f, -0.070091f, -0.065959f, 0.084284f, 0.161386f, -0.316926f, 0.110154f, -0.436603f, 0.089333f, 0.073245f, -0.100805f, -0.182002f, 0.120317f, 0.083656f, -0.469600f, -0.121433f, 0.155362f, 0.005553f, -0.145375f, 0.090593f, -0.079843f, -0.154999f, -0.176975f, 0.043203f, 0.062058f, 0.292239f, 0.063395f, 0.158361f, 0.118282f, 0.035543f, 0.083490f, 0.258780f, 0.017039f, -0.062652f, 0.144890f, 0.148966f, -0.048012f, 0.148462f, 0.166953f, 0.098538f, 0.120926f, -0.193057f, -0.192954f, 0.161669f, -0.028549f, 0.201897f, -0.062355f, 0.117601f, 0.074067f, -0.027467f, 0.024301f, 0.183034f, 0.181276f, 0.136182f, 0.096576f, 0.078719f, -0.126076f, -0.009768f, -0.265767f, -0.073904f, 0.119334f, 0.141011f, 0.144890f, 0.065800f, -0.129022f, -0.196777f, -0.118266f, -0.013400f, 0.122056f, -0.240159f, -0.163871f, -0.247675f, -0.117808f, 0.114592f, 0.076780f, -0.102176f, -0.009590f, -0.128957f, -0.081765f, 0.029088f, 0.074201f, -0.145367f, 0.078694f, -0.130700f, 0.018312f, -0.121402f, 0.080208f, -0.094513f, -0.191872f, 0.162225f, -0.215507f, 0.053670f, 0.036867f, -0.056335f, -0.161743f, 0.079202f, -0.020907f, 0.147116f, -0.207336f, 0.085687f, -0.121752f, 0.103306f, 0.134145f, 0.084049f, -0.201497f, -0.152134f, 0.051400f, -0.087356f, 0.014759f, -0.053575f, 0.129427f, -0.127676f, 0.025920f, -0.113896f, -0.110049f, -0.141550f, -0.166816f, -0.142429f, 0.190032f, -0.202180f, -0.263323f, -0.136547f, 0.008111f, 0.109618f, -0.150801f, 0.148482f, 0.205839f, -0.167230f, 0.154271f, 0.124269f, -0.117038f, -0.104803f, -0.088874f, -0.097684f, -0.177695f, -0.049330f, -0.172689f, -0.068738f, 0.023092f, -0.162121f, -0.081681f, -0.165553f, 0.068285f, 0.083987f, 0.156308f, 0.047517f, 0.045286f, 0.119537f, -0.111497f, 0.128679f, 0.162777f, 0.220257f, -0.010189f, -0.177049f, 0.159061f, -0.004375f, 0.041728f, 0.145952f, -0.103448f, 0.131174f, 0.104731f, 0.189372f, 0.201505f, -0.109055f, -0.110849f, -0.090431f, 0.028194f, -0.122418f, -0.058102f, 0.255167f, 0.073236f, -0.141740f, -0.058192f, -0.101642f, -0.013626f, -0.032291f, 0.181486f, 0.217129f, 0.246706f, 0.087753f, 0.179207f, 0.119349f, 0.157597f, 0.176635f, 0.261246f, 0.489894f, 0.016906f, -0.030435f, -0.091390f, -0.108273f, 0.200683f, 0.213609f, 0.133674f, 0.106921f, 0.205467f, -0.044535f, 0.070510f, -0.157606f, 0.063752f, -0.072479f, 0.184011f, -0.121134f, -0.045225f, 0.099264f, -0.047463f, -0.057518f, 0.167175f, 0.045253f, -0.078575f, 0.113600f, -0.000538f, -0.152621f, 0.099286f, -0.025473f, -0.020577f, 0.225773f, -0.176274f, -0.122340f, -0.069615f, 0.097233f, -0.033912f, -0.105954f, -0.069850f, -0.128168f, 0.055001f, -0.012465f, -0.139295f, -0.144750f, -0.162221f, -0.155805f, 0.075392f, -0.091963f, 0.149566f, -0.156867f, -0.031838f, 0.183827f, -0.045926f, 0.017382f, 0.148851f, -0.134835f, -0.008006f, 0.108496f, -0.034969f, 0.183233f, 0.120184f, -0.069861f, -0.128459f, -0.186021f, 0.051568f, 0.067151f, -0.012145f, -0.032032f, 0.117932f, -0.040950f, -0.154076f, 0.035685f, -0.058546f, -0.074050f, -0.171948f, -0.176541f, 0.011830f, -0.148659f, -0.198665f, -0.127975f, 0.110626f, -0.023479f, 0.056238f, -0.045785f, 0.124221f, -0.124022f, 0.072372f, -0.078935f, -0.182106f, -0.037253f, -0.153359f, -0.119345f, 0.139756f, 0.194041f, -0.145121f, -0.068811f, -0.012298f, 0.036143f, -0.047286f, 0.161984f, 0.069910f, -0.059822f, 0.126231f, 0.146856f, -0.133367f, -0.044100f, -0.062446f, -0.104249f, -0.184190f, -0.020411f, 0.141969f, 0.156560f, 0.072814f, -0.164367f, -0.123959f, -0.148482f, -0.172542f, -0.047224f, 0.102141f, 0.048741f, -0.122310f, 0.124486f, 0.080423f, 0.031821f, -0.018167f, 0.211118f, 0.162449f, -0.103873f, 0.218485f, -0.026196f, -0.119725f, -0.034337f, -0.036592f, -0.033127f, -0.027704f, 0.064489f, -0.147850f, -0.045112f, 0.118508f, 0.162566f, 0.001043f, 0.012822f, 0.019745f, -0.163097f, 0.169477f, 0.102001f, -0.042378f, -0.023657f, 0.129636f, -0.088742f, -0.022916f, 0.112141f, 0.328157f, 0.146379f, -0.112190f, 0.034767f, 0.039668f, 0.020176f, 0.096948f, -0.048313f, 0.155856f, 0.465160f, 0.086098f, 0.045938f, 0.086479f, 0.118361f, -0.124303f, 0.485822f, -0.010822f, 0.095292f, 0.021125f, 0.149208f, 0.216991f, -0.081659f, 0.124264f, 0.140144f, 0.175250f, 0.017277f, -0.105843f, 0.008308f, -0.090165f, 0.210565f, 0.202883f, 0.130593f, -0.105851f, 0.193223f, -0.026704f, -0.058426f, -0.118747f, 0.084162f, 0.144044f, 0.177400f, -0.008361f, 0.128224f, -0.207844f, -0.008519f, 0.044172f, 0.025743f, 0.181876f, 0.230874f, -0.108860f, -0.043416f, -0.165702f, 0.204143f, 0.005787f, 0.204186f, 0.090180f, 0.095604f, -0.120201f, -0.174318f, -0.064404f, 0.146288f, 0.045731f, 0.219360f, 0.135652f, 0.079327f, -0.072990f, -0.059067f, 0.226070f, 0.043196f, -0.058817f, -0.082759f, 0.163977f, -0.192212f, 0.232858f, 0.208803f, 0.214279f, 0.040842f, -0.017209f, 0.016470f, -0.159385f, -0.047064f, 0.493758f, -0.045681f, 0.041169f, 0.176557f, -0.147893f, 0.056455f, 0.007450f, 0.164585f, 0.206847f, 0.544368f, 0.281085f, -0.052453f, 0.209424f, -0.131723f, 0.014313f, 0.454036f, -0.067653f, 0.095633f, 0.023381f, -0.127445f, 0.317156f, 0.047291f, 0.370705f, -0.141013f, 0.069752f, 0.025816f, 0.070876f, 0.084162f, 0.170065f, 0.039620f, 0.049626f, -0.067607f, -0.026201f, 0.209838f, -0.029492f, 0.006835f, 0.047792f, -0.106411f, 0.008899f, 0.075092f, -0.131203f, 0.095061f, -0.115052f, -0.098200f, 0.116119f, -0.020140f, 0.095060f, 0.147531f, 0.035088f, -0.045173f, -0.132218f, -0.121579f, -0.097946f, 0.058363f, -0.122440f, 0.088540f, -0.109635f, -0.144927f, -0.011385f, -0.138811f, 0.032416f, 0.167198f, 0.065019f, 0.171310f, 0.145272f, 0.226068f, -0.103321f, 0.160070f, -0.003458f, -0.090628f, 0.058716f, -0.306026f, 0.200676f, 0.249819f, 0.024117f, 0.035726f, -0.199383f, 0.110527f, -0.287486f, 0.049576f, 0.456507f, 0.014177f, 0.073320f, -0.072744f, 0.108003f, 0.257201f, -0.004082f, -0.026481f, 0.057997f, 0.516576f, 0.136541f, -0.172529f, 0.002734f, -0.138333f, 0.083176f, 0.233044f, -0.093733f, -0.102508f, 0.165929f, 0.008956f, 0.266656f, -0.021607f, 0.186284f, -0.107907f, 0.217015f, -0.078146f, -0.017390f, -0.139063f, -0.237555f, 0.071780f, -0.112521f, 0.164299f, 0.248048f, 0.124304f, 0.096458f, 0.160261f, -0.134896f, -0.095486f, -0.005445f, -0.124158f, -0.126073f, -0.199430f, -0.235054f, 0.007704f, -0.093890f, 0.195630f, 0.120602f, 0.263560f, -0.097986f, -0.054115f, 0.152928f, 0.059671f, -0.085140f, 0.010508f, 0.187507f, 0.173479f, -0.129899f, -0.185235f, 0.002098f, 0.037956f, -0.023218f, -0.039015f, -0.052159f, -0.091994f, 0.159109f, 0.164144f, 0.052728f, 0.057118f, 0.005544f, 0.050851f, -0.001089f, -0.267524f, -0.074971f, 0.264863f, 0.094058f, 0.032004f, 0.058212f, -0.038566f, -0.566666f, 0.011528f, 0.398911f, 0.044188f, 0.215172f, 0.047759f, -0.136187f, -0.097922f, -0.013584f, 0.168345f, 0.155092f, 0.372960f, -0.093172f, 0.143440f, 0.035986f, 0.172369f, 0.107126f, 0.416753f, -0.123995f, -0.007482f, 0.092811f, 0.143885f, 0.143042f, -0.040601f, 0.353160f, 0.014389f, -0.072426f, 0.131498f, 0.133990f, -0.164899f, -0.003565f, 0.132889f, -0.115811f, 0.088768f, 0.031073f, -0.140559f, -0.066628f, 0.148301f, -0.134157f, -0.167852f, -0.118284f, -0.125917f, -0.098788f, 0.064695f, -0.297812f, 0.157519f, 0.115284f, 0.083800f, 0.075416f, -0.089907f, -0.015641f, 0.035714f, 0.040400f, -0.162322f, 0.129084f, 0.053374f, 0.003106f, 0.010657f, -0.191382f, 0.081133f, 0.085850f, -0.028656f, -0.163727f, -0.147449f, 0.153816f, 0.166958f, 0.209956f, -0.026586f, 0.123871f, -0.124537f, -0.155345f, 0.182014f, -0.060249f, -0.320301f, -0.225938f, 0.168726f, 0.074383f, -0.173164f, 0.178421f, 0.155561f, -0.447520f, -0.145383f, 0.042575f, 0.164636f, 0.218784f, -0.132114f, -0.034023f, 0.035062f, -0.080275f, -0.004173f, 0.235570f, -0.325031f, -0.014583f, 0.093336f, -0.124524f, 0.019507f, -0.152757f, 0.052894f, -0.094192f, -0.028144f, -0.188228f, -0.040551f, -0.077061f, -0.161786f, -0.026994f, -0.156115f, 0.051468f, -0.244638f, -0.111383f, -0.221637f, -0.313373f, -0.054132f, -0.117911f, 0.021367f, -0.090313f, 0.077220f, -0.100908f, 0.121826f, -0.113032f, 0.259233f, -0.149575f, -0.099026f, -0.247731f, 0.088257f, -0.158602f, -0.065865f, 0.032752f, -0.024176f, 0.128586f, 0.047258f, -0.065383f, -0.139550f, 0.074921f, 0.035467f, 0.000564f, -0.146472f, 0.031646f, 0.090773f, -0.163490f, 0.189088f, 0.005043f, 0.036012f, -0.168287f, -0.023539f, -0.102970f, -0.051991f, 0.008880f, -0.117238f, -0.082726f, -0.034781f, 0.110950f, 0.093587f, 0.039055f, 0.182918f, -0.086348f, 0.168705f, -0.223481f, -0.087566f, 0.019224f, 0.099233f, -0.333444f, -0.116407f, 0.357068f, -0.107929f, -0.114701f, -0.018624f, -0.221191f, 0.128506f, -0.166101f, -0.160468f, -0.170708f, 0.142191f, 0.037287f, -0.045140f, 0.148267f, 0.063219f, 0.062538f, 0.063289f, 0.055819f, 0.040908f, -0.088198f, 0.142225f, 0.144982f, -0.066979f, 0.186277f, -0.165586f, 0.099174f, 0.054468f, -0.226116f, 0.058482f, -0.083597f, -0.074933f, -0.198012f, -0.121959f, 0.115399f, 0.061233f, -0.036383f, 0.249052f, 0.176775f, 0.083878f, -0.026867f, 0.080408f, -0.069413f, -0.033728f, -0.283337f, -0.048836f, -0.166443f, 0.090341f, -0.112091f, 0.213880f, -0.095414f, 0.174207f, 0.025135f, 0.064354f, -0.110820f, 0.132866f, -0.037278f, 0.000847f, -0.020409f, 0.051998f, -0.063462f, -0.005664f, -0.156151f, -0.062699f, -0.101027f, -0.004192f, 0.029825f, 0.166705f, 0.030237f, 0.106726f, 0.197989f, -0.059164f, 0.188880f, -0.183721f, -0.113014f, 0.292541f, 0.032236f, 0.150709f, -0.038133f, 0.054746f, -0.141634f, 0.067621f, 0.433983f, -0.110411f, 0.185163f, 0.133072f, 0.054209f, -0.011780f, -0.003399f, -0.004013f, 0.221974f, 0.253397f, 0.197647f, -0.132812f, 0.149508f, -0.017214f, -0.030938f, 0.170644f, -0.114717f, 0.102136f, -0.036069f, 0.027327f, 0.222684f, -0.112525f, 0.030182f, -0.100696f, -0.107728f, 0.179212f, -0.001054f, 0.126656f, 0.035836f, 0.025378f, -0.125760f, -0.072694f, 0.148872f, 0.121795f, 0.095720f, 0.073402f, 0.100602f, 0.108198f, -0.053440f, -0.118748f, -0.278721f, -0.073651f, -0.185611f, 0.254992f, -0.044359f, 0.029743f, 0.037244f, 0.314303f, 0.190932f, 0.187589f, -0.003812f, 0.146883f, 0.216260f, 0.203761f, 0.000381f, 0.159552f, -0.036607f, -0.002305f, 0.044965f, 0.066966f, 0.194017f, 0.112698f, 0.205387f, 0.185948f, 0.215326f, 0.175744f, -0.016082f, 0.182252f, 0.112296f, -0.161246f, 0.212657f, 0.012034f, 0.197316f, 0.279419f, -0.015142f, 0.029023f, -0.079489f, -0.033305f, -0.190780f, 0.154436f, 0.291998f, -0.158571f, 0.111330f, 0.088230f, -0.153611f, -0.077259f, -0.062853f, 0.103530f, -0.008001f, 0.310104f, 0.090914f, 0.028645f, 0.014733f, 0.121915f, -0.024742f, 0.145066f, 0.003726f, 0.137329f, 0.082286f, 0.159892f, 0.337581f, 0.048797f, 0.258062f, 0.106844f, 0.037959f, 0.120301f, 0.171140f, -0.151984f, -0.208999f, 0.052831f, 0.033006f, 0.111564f, -0.026213f, -0.006640f, 0.184621f, -0.110008f, -0.040603f, 0.132323f, -0.133880f, 0.047582f, -0.257968f, -0.096829f, -0.087076f, 0.036957f, 0.188047f, 0.008246f, 0.189913f, 0.055610f, 0.033455f, 0.143353f, 0.035109f, -0.032989f, -0.048822f, 0.135019f, 0.108258f, -0.107260f, 0.143745f, -0.114104f, 0.112038f, 0.104522f, 0.106694f, -0.110418f, 0.061950f, -0.033114f, 0.156628f, 0.097002f, 0.083104f, 0.063560f, 0.138033f, -0.016820f, -0.064018f, -0.000982f, -0.054403f, 0.281981f, 0.156589f, 0.174032f, 0.065910f, 0.014406f, 0.028585f, -0.012659f, 0.298484f, 0.123705f, 0.048557f, -0.073447f, 0.102633f, 0.208312f, 0.234867f, -0.103362f, 0.148340f, 0.336606f, -0.073713f, 0.007624f, 0.094629f, -0.039551f, -0.066901f, 0.207692f, 0.245732f, 0.006905f, 0.136240f, -0.041873f, 0.242443f, 0.030118f, 0.126556f, 0.098212f, 0.179069f, 0.087855f, -0.074064f, 0.204360f, -0.089876f, 0.095598f, -0.054187f, 0.082863f, 0.123388f, 0.124611f, 0.054490f, 0.074109f, -0.029888f, -0.012325f, -0.135402f, 0.089809f, -0.118417f, -0.111808f, -0.189929f, -0.084793f, -0.132995f, 0.022634f, -0.115131f, 0.024819f, -0.183397f, 0.034005f, 0.111960f, -0.194917f, -0.056694f, 0.042805f, 0.078834f, 0.090550f, 0.080117f, -0.003468f, 0.069421f, 0.149118f, 0.169941f, -0.096201f, -0.062803f, 0.079711f, -0.136411f, -0.157666f, -0.075972f, -0.006568f, 0.154235f, -0.101123f, -0.003124f, -0.270457f, 0.119007f, 0.278789f, -0.015196f, 0.042920f, 0.165557f, 0.129108f, -0.549756f, 0.108769f, 0.469777f, -0.103498f, 0.157748f, -0.034482f, -0.098542f, 0.227304f, -0.024460f, 0.001249f, -0.000466f, 0.345088f, 0.053718f, -0.029757f, 0.170998f, -0.050092f, 0.018831f, 0.211756f, 0.049029f, -0.062340f, 0.201566f, -0.001896f, 0.311314f, -0.059621f, 0.330494f, 0.085211f, 0.104473f, 0.079601f, 0.115529f, -0.056508f, -0.121943f, 0.057549f, 0.059002f, -0.031109f, 0.161532f, 0.063451f, 0.062334f, 0.110641f, -0.100438f, -0.108967f, -0.188310f, 0.035223f, 0.048682f, -0.009964f, -0.386421f, 0.122896f, 0.129134f, -0.040898f, 0.155658f, 0.115980f, -0.086767f, 0.161658f, 0.267148f, 0.205934f, 0.069964f, 0.196780f, -0.166695f, 0.000285f, 0.070602f, -0.038760f, -0.063549f, 0.119629f, 0.025468f, -0.148931f, 0.135679f, 0.085249f, -0.096061f, -0.118710f, -0.104541f, -0.064082f, 0.162345f, 0.173583f, -0.206205f, 0.125675f, 0.183360f, -0.184636f, -0.150234f, 0.098165f, 0.158712f, -0.048792f, 0.187545f, -0.151687f, -0.226038f, 0.183788f, -0.152495f, 0.004162f, -0.004188f, -0.014150f, -0.172883f, 0.031619f, -0.258936f, -0.136393f, -0.052418f, -0.104145f, 0.171002f, 0.052443f, -0.065123f, -0.106898f, 0.126662f, -0.099935f, -0.060696f, -0.075684f, -0.072494f, -0.040083f, -0.137592f, 0.150960f, -0.155552f, 0.005877f, -0.104209f, 0.149782f, 0.071589f, 0.027690f, -0.198052f, -0.142022f, -0.152931f, 0.070813f, -0.068668f, 0.008780f, -0.033189f, -0.192412f, 0.093238f, -0.114629f, -0.046873f, 0.042432f, -0.045921f, 0.071981f, 0.235751f, 0.160834f, 0.134907f, -0.080017f, 0.157984f, 0.214869f, -0.232610f, 0.005714f, -0.183225f, -0.049719f, -0.086730f, 0.018872f, -0.072984f, -0.095565f, 0.145711f, 0.106101f, -0.100830f, -0.060712f, 0.076564f, -0.137624f, 0.185069f, -0.133879f, 0.096311f, -0.094434f, 0.149854f, 0.197822f, 0.166338f, 0.194324f, 0.014865f, -0.036897f, 0.092017f, -0.159874f, 0.060702f, 0.149741f, 0.046271f, -0.112975f, -0.175665f, 0.005709f, -0.088890f, 0.034057f, -0.140534f, -0.062790f, 0.058016f, 0.136216f, 0.136918f, -0.246661f, -0.171883f, 0.064882f, -0.013579f, -0.009061f, -0.050900f, 0.078024f, 0.199847f, -0.013246f, -0.093881f, -0.177954f, -0.305220f, 0.097610f, -0.100874f, 0.139148f, -0.049510f, 0.098846f, -0.020294f, 0.078553f, 0.129034f, -0.125335f, 0.203141f, 0.106590f, 0.127273f, 0.077495f, 0.085420f, 0.193829f, -0.060633f, 0.223026f, 0.041988f, -0.055381f, 0.149096f, 0.017949f, 0.319575f, 0.214813f, 0.194518f, -0.192004f, -0.132681f, 0.180744f, 0.059696f, 0.050604f, 0.101502f, 0.111275f, 0.211409f, -0.120803f, 0.068726f, 0.086060f, 0.105908f, -0.138660f, 0.027329f, 0.164487f, -0.035194f, -0.040734f, -0.169329f, -0.116444f, -0.089269f, -0.059961f, 0.180266f, 0.089622f, 0.031758f, -0.125505f, 0.114943f, -0.060769f, -0.133981f, 0.307101f, 0.228369f, -0.061350f, -0.122552f, -0.085515f, -0.232870f, 0.036824f, 0.305067f, 0.210298f, -0.065390f, 0.175267f, 0.042721f, 0.129158f, -0.096563f, 0.200312f, 0.180161f, 0.458630f, 0.056207f, 0.010995f, -0.034748f, 0.072031f, 0.080259f, 0.504418f, 0.058744f, 0.070353f, 0.257975f, -0.038708f, 0.073367f, 0.002865f, 0.025777f, 0.064804f, -0.004054f, -0.070916f, 0.056418f, 0.014957f, -0.120680f, -0.094733f, 0.023160f, -0.025721f, -0.021907f, -0.034576f, -0.043905f, -0.083904f, 0.193226f, 0.063349f, 0.061015f, -0.117751f, -0.025085f, 0.167055f, -0.328052f, 0.046035f, -0.165518f, 0.034193f, 0.174177f, 0.228442f, 0.041528f, 0.069397f, 0.004980f, 0.017760f, 0.084140f, 0.119702f, -0.037424f, -0.170693f, 0.118629f, -0.057455f, -0.032352f, 0.250027f, 0.139521f, 0.191422f, 0.182133f, -0.058408f, 0.015463f, 0.160162f, 0.034427f, -0.021862f, 0.030409f, 0.115892f, 0.151352f, -0.106434f, 0.219146f, 0.020491f, 0.061388f, 0.059607f, 0.141861f, 0.075595f, -0.389931f, -0.129307f, 0.377344f, 0.141666f, 0.135961f, -0.070189f, 0.100369f, 0.235224f, 0.187341f, -0.079163f, -0.102962f, 0.391178f, -0.060066f, -0.123891f, -0.068713f, 0.100968f, 0.166139f, 0.303235f, -0.125574f, 0.019767f, 0.010172f, 0.057840f, 0.286119f, 0.155075f, 0.307893f, 0.157414f, -0.114026f, 0.145460f, -0.194318f, 0.036161f, -0.115715f, 0.160289f, 0.066609f, 0.093271f, 0.059208f, -0.122612f, 0.003437f, -0.049935f, -0.125731f, 0.072196f, -0.237908f, 0.178553f, -0.318591f, -0.185367f, -0.452873f, 0.239798f, 0.103123f, 0.134676f, 0.214193f, 0.381523f, 0.157639f, -0.099363f, 0.102369f, 0.121253f, -0.092343f, 0.099684f, -0.009019f, 0.191485f, 0.147549f, -0.164303f, -0.100704f, 0.180957f, 0.129260f, -0.065656f, -0.086234f, -0.000686f, -0.043204f, 0.018250f, -0.050675f, -0.096429f, 0.139435f, -0.114962f, 0.152076f, 0.011634f, -0.130034f, -0.010725f, 0.189489f, 0.097546f, 0.056030f, 0.094683f, -0.128682f, 0.028448f, 0.223196f, -0.012259f, 0.083422f, -0.021820f, -0.146478f, 0.124149f, -0.057065f, 0.079120f, 0.200057f, 0.518950f, 0.238725f, 0.146011f, 0.106009f, 0.046799f, -0.036715f, 0.254723f, 0.049594f, -0.136111f, 0.145358f, 0.069539f, 0.171641f, -0.141605f, 0.183981f, 0.122767f, -0.072973f, 0.051037f, 0.060133f, -0.154666f, 0.142592f, -0.105290f, -0.125179f, 0.048506f, 0.048131f, -0.134448f, -0.086998f, 0.105541f, 0.011901f, 0.057189f, 0.133333f, -0.101749f, -0.012159f, 0.011461f, -0.361483f, 0.102591f, 0.021517f, -0.091046f, -0.101155f, 0.246535f, -0.060605f, -0.074266f, -0.041565f, 0.096159f, 0.093153f, 0.025630f, 0.148850f, -0.052341f, -0.097639f, -0.144024f, 0.172970f, -0.040230f, 0.120215f, -0.051196f, 0.140083f, 0.177129f, -0.083210f, -0.082002f, 0.030529f, 0.216610f, -0.012645f, 0.036602f, 0.004273f, 0.055236f, -0.039471f, 0.138131f, -0.025756f, -0.020376f, -0.097617f, -0.071777f, -0.055965f, 0.145251f, 0.229675f, -0.105586f, 0.093164f, 0.168092f, -0.127046f, 0.087725f, 0.154769f, 0.051166f, 0.183338f, 0.264010f, 0.081340f, 0.059725f, -0.078239f, 0.110861f, 0.204855f, 0.475732f, 0.159167f, -0.010008f, 0.187469f, 0.049010f, 0.098267f, 0.155187f, 0.274671f, 0.151903f, 0.082362f, -0.157810f, 0.134693f, 0.042803f, -0.140989f, 0.175833f, -0.040395f, 0.192692f, 0.244021f, -0.113850f, 0.021447f, -0.170410f, -0.104611f, 0.114936f, 0.126559f, 0.093146f, -0.114610f, -0.090308f, -0.087031f, 0.133350f, 0.069497f, 0.029550f, -0.106137f, -0.117592f, -0.043062f, -0.015827f, -0.146765f, -0.115082f, -0.115798f, 0.153444f, 0.165802f, 0.285955f, 0.101574f, -0.177881f, -0.041039f, -0.235979f, 0.044987f, 0.088076f, -0.117645f, -0.087322f, -0.160026f, -0.040115f, 0.000520f, -0.154353f, 0.084955f, 0.006471f, 0.133940f, -0.020480f, 0.159387f, 0.047094f, -0.112550f, -0.136968f, -0.027407f, -0.117793f, -0.169740f, -0.081792f, -0.131048f, -0.056362f, -0.025864f, -0.055368f, -0.173524f, 0.090591f, -0.224424f, -0.125117f, 0.083581f, 0.206801f, 0.063254f, 0.060826f, -0.121951f, -0.010960f, 0.106480f, 0.043414f, -0.212016f, 0.106580f, 0.180805f, 0.026406f, 0.198257f, 0.049020f, -0.025590f, -0.040592f, 0.203893f, -0.170480f, -0.024375f, -0.065989f, 0.050979f, -0.115079f, -0.196475f, 0.013154f, -0.061037f, -0.073309f, -0.096123f, 0.036180f, 0.004265f, -0.106613f, -0.016360f, -0.017698f, -0.166986f, 0.104002f, -0.070498f, 0.007233f, -0.180749f, 0.175657f, 0.110255f, -0.154903f, -0.012968f, -0.093868f, 0.190441f, -0.007589f, -0.127242f, -0.028913f, 0.039637f, -0.560615f, -0.061545f, -0.206381f, -0.198952f, -0.065112f, 0.171305f, 0.171200f, 0.143406f, -0.157280f, -0.480174f, -0.220058f, -0.049195f, -0.417078f, -0.028562f, 0.162334f, -0.119669f, 0.174001f, 0.159436f, 0.062831f, -0.113837f, -0.236520f, -0.208586f, 0.193864f, 0.108863f, -0.267593f, 0.118145f, -0.325837f, -0.223082f, -0.489889f, -0.020966f, -0.238373f, -0.324229f, -0.304321f, 0.011529f, 0.059896f, -0.483230f, -0.291767f, -0.215949f, -0.237055f, -0.254418f, -0.191395f, -0.401044f, 0.087275f, -0.015557f, 0.072006f, 0.073814f, 0.053168f, 0.009661f, 0.051882f, -0.301185f, -0.102862f, 0.182812f, -0.087629f, 0.213456f, -0.274249f, 0.150430f, -0.029638f, -0.080699f, -0.075730f, 0.102048f, -0.390234f, 0.209334f, 0.055084f, 0.127567f, 0.050109f, -0.238339f, -0.337261f, -0.079266f, 0.230700f, 0.169508f, 0.079299f, 0.071133f, 0.060669f, 0.213588f, 0.219777f, -0.160404f, 0.044532f, 0.076848f, 0.081364f, -0.159457f, -0.060520f, 0.148741f, 0.157267f, 0.225555f, -0.089156f, 0.114511f, -0.158881f, 0.044267f, -0.026039f, -0.027674f, 0.052451f, 0.186271f, 0.159739f, 0.186174f, -0.062511f, -0.100072f, -0.160400f, 0.187004f, 0.047426f, -0.004865f, -0.002483f, -0.107167f, 0.081258f, 0.083652f, 0.002548f, 0.382858f, 0.113399f, -0.124955f, 0.140441f, -0.081076f, 0.051106f, -0.132539f, 0.132676f, 0.024483f, 0.517453f, 0.036321f, 0.163354f, 0.216688f, 0.212457f, 0.076529f, 0.458121f, 0.039298f, 0.158370f, 0.285299f, 0.204729f, 0.135846f, -0.019707f, 0.408107f, -0.013222f, 0.112118f, 0.166594f, 0.023626f, 0.035801f, -0.196256f, 0.227037f, -0.024632f, 0.054536f, 0.247592f, -0.063452f, -0.138239f, 0.025581f, 0.187069f, 0.174446f, 0.112390f, -0.072534f, -0.195155f, -0.045335f, -0.194081f, 0.039930f, 0.209863f, -0.000743f, 0.179048f, -0.091183f, 0.021075f, -0.334579f, 0.114715f, 0.001392f, -0.275870f, -0.195987f, -0.081598f, 0.038043f, -0.277169f, -0.111645f, 0.000248f, 0.194146f, -0.014995f, -0.174822f, -0.151126f, -0.146093f, -0.320089f, -0.234491f, 0.041356f, -0.233472f, -0.000412f, -0.288887f, 0.160760f, -0.220565f, 0.135754f, 0.003375f, 0.161415f, 0.040943f, -0.104683f, -0.063226f, 0.125173f, 0.010768f, -0.103663f, -0.373853f, 0.105457f, -0.135979f, -0.125783f, 0.242555f, -0.237460f, -0.032944f, -0.251113f, 0.146552f, -0.178454f, -0.113434f, -0.095561f, 0.033529f, -0.216711f, -0.006678f, -0.202814f, -0.142751f, 0.126290f, -0.254439f, -0.094192f, 0.070279f, -0.000417f, 0.021277f, 0.154880f, 0.047388f, 0.086171f, -0.080816f, 0.126917f, -0.217090f, -0.367747f, -0.005442f, -0.007275f, -0.010513f, 0.062118f, 0.172318f, -0.186293f, -0.238811f, -0.112617f, 0.068743f, -0.249257f, -0.071232f, 0.159434f, -0.209867f, -0.079653f, -0.040009f, 0.071665f, 0.015075f, 0.107929f, 0.197859f, -0.054327f, -0.154328f, -0.016871f, -0.018406f, 0.025200f, -0.035765f, 0.206836f, 0.170451f, -0.132371f, -0.087195f, -0.072252f, 0.108217f, -0.059289f, 0.120240f, -0.005712f, -0.160083f, 0.111630f, -0.124836f, -0.142460f, -0.100807f, 0.163554f, -0.078406f, 0.229870f, 0.224962f, 0.082795f, 0.165743f, -0.122390f, 0.188883f, -0.349948f, -0.039704f, 0.275213f, 0.071505f, -0.026065f, 0.058162f, 0.095864f, -0.035697f, 0.125089f, 0.187127f, 0.099389f, 0.366059f, 0.097714f, 0.020342f, -0.053780f, 0.083740f, 0.099048f, 0.194238f, -0.075068f, -0.047460f, 0.011589f, -0.124938f, 0.003337f, 0.129373f, 0.157793f, -0.111942f, 0.145219f, 0.031133f, -0.028550f, 0.179765f, 0.154152f, 0.205996f, -0.111576f, 0.171222f, 0.222302f, 0.068563f, 0.121822f, -0.167686f, 0.067891f, -0.131115f, -0.046311f, -0.047699f, -0.282235f, -0.193646f, -0.095355f, 0.100284f, -0.061427f, 0.147117f, -0.213808f, 0.109150f, -0.166724f, 0.019901f, -0.053042f, 0.095870f, -0.018317f, 0.057868f, 0.100421f, 0.102006f, -0.089455f, -0.512508f, -0.051440f, 0.196213f, 0.113301f, 0.004095f, -0.003172f, -0.017772f, 0.022800f, 0.026650f, -0.183506f, -0.286014f, -0.194112f, 0.389141f, -0.114244f, -0.275576f, -0.026953f, 0.163969f, 0.143950f, -0.159610f, -0.368075f, -0.079331f, -0.779822f, -0.117575f, 0.174940f, 0.078668f, 0.055855f, -0.332185f, -0.087257f, -0.226382f, -0.051444f, -0.130605f, -0.076544f, 0.131703f, -0.032851f, -0.246811f, -0.201766f, 0.122858f, -0.085615f, -0.010775f, -0.037913f, -0.338440f, -0.141574f, -0.154155f, -0.035614f, -0.157225f, 0.104066f, 0.043993f, -0.197558f, 0.172096f, 0.191544f, -0.231924f, -0.544117f, 0.403170f, -0.073465f, -0.003404f, -0.036714f, -0.117322f, -0.114608f, -0.363305f, 0.324744f, 0.201867f, 0.298086f, 0.144449f, 0.123614f, 0.129767f, -0.126407f, -0.170507f, -0.214781f, 0.051899f, -0.047671f, 0.384289f, -0.104000f, 0.136349f, -0.102966f, 0.153641f, -0.128920f, -0.000678f, 0.133107f, -0.000809f, 0.112107f, -0.041243f, -0.107903f, 0.053344f, -0.072319f, 0.113389f, -0.054568f, -0.040056f, -0.119063f, -0.005596f, -0.120380f, -0.053822f, 0.029313f, 0.098611f, 0.236433f, -0.244863f, 0.071526f, 0.366122f, -0.045942f, -0.121568f, 0.135223f, 0.103995f, -0.557475f, 0.234055f, 0.346786f, 0.111481f, 0.027367f, -0.017452f, 0.166374f, 0.225747f, -0.165778f, 0.179439f, -0.123482f, 0.259412f, -0.068895f, 0.127243f, -0.103178f, -0.043270f, -0.040894f, 0.315434f, 0.095072f, 0.144459f, -0.048376f, 0.192757f, -0.016781f, -0.171684f, 0.309013f, 0.030630f, 0.061788f, 0.060561f, -0.103491f, 0.019084f, -0.340769f, 0.022006f, -0.061219f, -0.072515f, -0.095214f, -0.019839f, 0.130216f, 0.045029f, -0.075230f, 0.120103f, -0.025184f, -0.136308f, -0.049206f, 0.043557f, -0.403544f, 0.034558f, 0.121237f, 0.115698f, 0.097709f, 0.139879f, -0.060030f, -0.028792f, 0.068565f, 0.053767f, 0.197655f, 0.146595f, 0.131119f, 0.144933f, -0.039303f, 0.104183f, 0.209572f, -0.023279f, 0.153737f, -0.081112f, -0.081047f, 0.156165f, 0.209261f, 0.179444f, 0.090246f, -0.059518f, 0.083264f, -0.203217f, 0.045024f, -0.134262f, 0.205514f, 0.231087f, -0.068509f, -0.171907f, 0.016072f, -0.034064f, -0.030231f, 0.130295f, 0.166340f, 0.125511f, -0.111035f, 0.157252f, -0.045752f, 0.064514f, 0.126774f, -0.057910f, -0.021323f, 0.410418f, 0.240463f, -0.104631f, 0.148412f, 0.151298f, -0.073712f, 0.424717f, 0.227562f, 0.044651f, 0.275672f, -0.000446f, 0.225610f, 0.180883f, 0.182127f, 0.075260f, 0.175107f, 0.130231f, -0.090020f, 0.139694f, 0.121760f, -0.084954f, 0.169050f, -0.056278f, 0.167464f, -0.109872f, 0.229164f, -0.091142f, -0.071649f, -0.121702f, -0.129687f, 0.057298f, -0.139284f, 0.012285f, -0.134371f, 0.000386f, -0.190570f, -0.159336f, -0.159336f, 0.150382f, -0.099306f, -0.119983f, 0.137824f, -0.037302f, 0.019850f, 0.150736f, 0.098596f, -0.203748f, -0.177565f, 0.097503f, 0.043235f, -0.076813f, 0.076156f, -0.130258f, -0.165543f, -0.029693f, 0.001099f, -0.023671f, 0.055347f, 0.057807f, -0.113568f, 0.119025f, 0.001433f, -0.127066f, 0.079560f, 0.161622f, 0.041586f, 0.147647f, -0.031941f, 0.080034f, -0.447332f, -0.060940f, 0.338129f, 0.000728f, 0.031939f, 0.039391f, -0.192893f, 0.123637f, -0.223974f, 0.170491f, -0.136126f, 0.542822f, 0.035404f, 0.030621f, -0.090365f, -0.148023f, -0.054566f, 0.149535f, 0.170196f, -0.132344f, 0.235286f, -0.168151f, 0.115611f, 0.014557f, 0.198076f, -0.156333f, -0.023909f, 0.018295f, -0.208152f, -0.005624f, -0.232184f, -0.051761f, -0.143423f, 0.055558f, 0.177800f, -0.168759f, 0.070610f, 0.111954f, 0.004103f, 0.044581f, -0.299491f, -0.088744f, -0.255173f, 0.119195f, -0.443081f, 0.053989f, 0.026800f, 0.060487f, 0.111307f, 0.380860f, -0.008582f, -0.134817f, -0.033977f, 0.137393f, 0.108620f, -0.042795f, 0.119892f, 0.068353f, -0.054921f, 0.123759f, -0.056497f, 0.075651f, -0.045787f, -0.099410f, -0.005059f, 0.034111f, -0.131186f, 0.060469f, -0.101387f, 0.257053f, -0.063021f, -0.111697f, -0.081911f, -0.092244f, 0.225860f, 0.058401f, -0.050013f, 0.033392f, 0.174250f, -0.052560f, -0.241160f, -0.033821f, 0.235647f, 0.054307f, 0.234780f, 0.242293f, 0.102844f, 0.045092f, -0.027119f, 0.156508f, -0.115601f, 0.357793f, 0.030706f, 0.143545f, 0.040410f, 0.208847f, 0.067788f, 0.151594f, 0.151210f, 0.228932f, -0.012241f, 0.015826f, 0.295738f, 0.085561f, 0.300640f, 0.107403f, 0.233132f, 0.026864f, 0.105273f, -0.072401f, 0.001903f, -0.055886f, 0.137236f, 0.130815f, -0.016838f, 0.078170f, 0.238084f, -0.141821f, -0.039018f, -0.005357f, 0.089240f, -0.114326f, -0.192382f, 0.024291f, -0.080070f, 0.234052f, 0.042778f, 0.165421f, -0.093085f, 0.162880f, -0.060935f, 0.191831f, 0.134432f, 0.160148f, 0.112015f, 0.123210f, 0.206239f, 0.028277f, 0.198990f, -0.192517f, 0.199278f, -0.044907f, 0.018758f, -0.114981f, 0.086677f, 0.045324f, 0.022443f, 0.069026f, 0.034008f, 0.138115f, 0.039245f, 0.041164f, 0.172870f, 0.033863f, -0.018583f, 0.291730f, -0.006086f, 0.029484f, -0.111187f, 0.144590f, -0.126665f, -0.064058f, 0.309687f, -0.051178f, -0.064725f, -0.060019f, 0.179990f, -0.054581f, 0.103198f, 0.107660f, 0.046874f, 0.469639f, 0.000976f, -0.143410f, -0.006499f, 0.056488f, 0.144848f, 0.448579f, -0.085992f, -0.098230f, 0.175673f, 0.044666f, 0.081180f, -0.016121f, 0.265416f, 0.210028f, -0.122977f, -0.101348f, -0.145775f, 0.085972f, 0.070307f, -0.099737f, -0.041940f, 0.158135f, 0.118538f, 0.127277f, 0.055631f, 0.029096f, -0.094964f, 0.109678f, -0.065888f, -0.036669f, -0.230365f, -0.083173f, -0.265557f, 0.099162f, -0.066828f, -0.079664f, -0.086741f, 0.052776f, 0.009806f, 0.022825f, -0.082274f, 0.062527f, 0.014436f, 0.004193f, 0.024297f, -0.138852f, -0.038474f, -0.085046f, 0.001778f, 0.161942f, 0.053277f, 0.141434f, -0.126093f, -0.092112f, -0.005110f, 0.016001f, 0.058403f, 0.224462f, -0.066202f, -0.057906f, -0.005543f, -0.186247f, -0.033808f, 0.121423f, -0.143018f, 0.125576f, 0.142362f, -0.008457f, -0.424557f, -0.039476f, 0.398206f, 0.061467f, -0.133150f, -0.110119f, -0.111233f, 0.048115f, -0.158749f, 0.055966f, -0.155471f, 0.536086f, -0.133862f, 0.111583f, -0.074940f, -0.184953f, -0.123983f, 0.136652f, 0.038429f, -0.032914f, 0.148385f, -0.061876f, 0.007063f, 0.091692f, 0.340360f, -0.105945f, 0.011037f, -0.103754f, -0.164208f, 0.165844f, -0.070894f, 0.195227f, -0.055754f, 0.057812f, -0.081000f, 0.008705f, 0.182368f, 0.230192f, -0.088167f, 0.065220f, -0.358421f, -0.036597f, -0.413386f, 0.049443f, -0.291419f, 0.029265f, -0.131131f, -0.094864f, 0.081538f, 0.006710f, 0.026358f, 0.063848f, 0.082310f, -0.038909f, -0.054466f, 0.138820f, -0.147883f, 0.162383f, 0.102221f, -0.188806f, -0.091674f, 0.196018f, -0.199139f, -0.034824f, -0.123254f, -0.075254f, -0.145965f, 0.128102f, -0.005467f, -0.118759f, 0.169257f, -0.266841f, -0.069450f, -0.123917f, -0.045374f, 0.141098f, -0.115446f, 0.071569f, 0.179305f, -0.144516f, -0.036994f, 0.156777f, 0.342445f, -0.101254f, 0.034613f, 0.163942f, -0.142006f, 0.018530f, 0.107271f, -0.051815f, 0.163955f, 0.212305f, 0.239908f, 0.127397f, 0.035002f, 0.126268f, -0.048850f, 0.152731f, 0.197288f, -0.047858f, 0.060060f, -0.020875f, 0.301930f, 0.115679f, 0.399537f, -0.022063f, 0.164142f, -0.122077f, -0.104895f, -0.081161f, -0.026351f, 0.145363f, 0.111625f, 0.193518f, 0.025115f, 0.180813f, 0.106648f, -0.076325f, 0.206291f, -0.091070f, 0.123114f, 0.152357f, -0.266772f, -0.069877f, -0.165940f, 0.248253f, 0.099621f, 0.077686f, -0.065050f, 0.151390f, 0.127706f, 0.184264f, 0.037188f, 0.189978f, -0.049043f, 0.205085f, -0.145861f, -0.159011f, 0.122597f, 0.101277f, 0.070583f, 0.226317f, -0.152065f, -0.117095f, 0.186013f, 0.137370f, -0.022452f, -0.034984f, 0.004762f, 0.184968f, 0.155991f, -0.042686f, 0.158841f, 0.091533f, 0.200612f, 0.204208f, 0.230998f, 0.176826f, 0.183870f, -0.041126f, -0.056813f, -0.004930f, 0.209848f, 0.202886f, -0.090059f, -0.111069f, -0.119595f, -0.097035f, -0.061339f, -0.063240f, 0.019300f, 0.505761f, 0.216624f, -0.109250f, -0.034009f, -0.109211f, 0.070097f, 0.122000f, -0.015304f, -0.004048f, 0.310856f, 0.201455f, 0.247519f, 0.168053f, 0.299247f, 0.122174f, 0.160575f, 0.202825f, -0.098445f, -0.079264f, -0.093772f, -0.130035f, -0.172154f, -0.079472f, 0.228120f, 0.185008f, 0.118458f, -0.139520f, 0.252967f, 0.033645f, 0.164035f, 0.021007f, -0.181188f, -0.070375f, -0.328682f, 0.220690f, 0.008067f, 0.027902f, -0.081209f, 0.080130f, 0.132167f, -0.060776f, -0.151734f, -0.171543f, -0.051067f, -0.183214f, 0.182450f, -0.250023f, -0.104294f, -0.066286f, -0.069675f, -0.142064f, -0.005090f, 0.055544f, 0.157231f, -0.149516f, 0.119384f, -0.118504f, 0.106031f, -0.153652f, -0.171360f, -0.134895f, -0.144453f, -0.113391f, 0.051495f, -0.013682f, -0.107818f, 0.045569f, 0.103563f, -0.215669f, -0.177098f, -0.066039f, -0.072777f, -0.188592f, -0.058111f, -0.119960f, 0.161846f, -0.005164f, 0.036012f, -0.175989f, 0.004134f, 0.115307f, -0.054909f, -0.110365f, -0.020922f, -0.122622f, -0.013772f, 0.076919f, 0.112405f, -0.002522f, -0.005949f, -0.222297f, 0.114129f, -0.134014f, 0.153980f, -0.016676f, -0.108236f, 0.163940f, 0.080780f, 0.036236f, -0.150531f, -0.010455f, 0.015744f, -0.026185f, -0.069480f, -0.208254f, 0.085163f, 0.220118f, -0.157338f, -0.192014f, 0.152595f, -0.086509f, 0.221077f, -0.027134f, -0.161195f, 0.051584f, 0.052377f, -0.195728f, -0.059237f, 0.048233f, 0.123317f, -0.146758f, 0.107494f, -0.084169f, 0.235387f, 0.021587f, 0.027892f, 0.068353f, 0.223344f, 0.071126f, 0.016198f, 0.103309f, 0.185409f, -0.038212f, -0.112989f, 0.011239f, 0.006122f, 0.215307f, 0.156380f, -0.094946f, -0.016100f, -0.067877f, -0.042025f, -0.362976f, -0.051372f, 0.010744f, 0.164811f, 0.063027f, -0.101654f, 0.013909f, -0.366138f, -0.016627f, 0.169966f, 0.083410f, 0.109167f, 0.153313f, 0.068741f, 0.006539f, -0.092945f, 0.016175f, 0.056066f, 0.348385f, -0.017626f, -0.013591f, -0.062671f, 0.101505f, 0.139666f, 0.322033f, 0.170773f, -0.004689f, 0.098860f, -0.139619f, 0.221534f, 0.082562f, 0.087783f, 0.219360f, -0.084515f, -0.096774f, 0.028976f, 0.191468f, -0.049875f, -0.012035f, 0.185431f, -0.146530f, 0.243810f, 0.215477f, 0.142495f, 0.104255f, 0.014435f, -0.014048f, -0.035113f, -0.152734f, -0.146330f, 0.163167f, -0.418291f, 0.096336f, -0.056512f, 0.142678f, 0.014934f, 0.176532f, -0.051742f, 0.137342f, 0.100548f, 0.176324f, 0.034735f, 0.045183f, 0.158020f, -0.131597f, 0.193950f, -0.099543f, 0.190751f, 0.188783f, 0.113029f, 0.015833f, -0.065792f, 0.130235f, 0.092021f, 0.177700f, 0.097342f, 0.028302f, 0.149911f, -0.026093f, -0.095088f, -0.103950f, 0.196322f, -0.010760f, 0.076287f, -0.126885f, 0.122678f, 0.155552f, 0.023495f, 0.063794f, 0.330864f, 0.001380f, 0.011500f, -0.161525f, 0.062239f, -0.044357f, -0.131316f, 0.087419f, -0.098574f, 0.201611f, 0.231680f, -0.172165f, 0.179331f, 0.013037f, 0.169137f, 0.156852f, 0.154315f, -0.057760f, -0.067027f, 0.099365f, 0.256024f, 0.014010f, 0.063504f, 0.057475f, 0.144516f, 0.096921f, -0.186438f, -0.069834f, -0.098935f, 0.200443f, -0.115157f, 0.009500f, -0.124678f, -0.044909f, 0.110905f, -0.073656f, 0.103981f, 0.095712f, 0.032914f, -0.082482f, -0.081728f, -0.048267f, -0.282613f, -0.018538f, -0.002380f, 0.137714f, -0.131815f, 0.287594f, 0.213043f, -0.079925f, -0.033713f, 0.134267f, -0.007691f, 0.147419f, -0.052805f, 0.129437f, 0.202537f, 0.148971f, -0.091053f, 0.002978f, 0.075568f, 0.145739f, 0.168795f, 0.176681f, -0.079861f, 0.079453f, 0.230760f, 0.228335f, -0.033109f, 0.025252f, -0.068237f, 0.001062f, -0.091127f, 0.042512f, -0.095286f, 0.103861f, 0.135424f, -0.096142f, -0.197023f, -0.020782f, 0.503278f, 0.143640f, 0.116165f, 0.213124f, 0.208574f, 0.078189f, 0.197341f, -0.138147f, 0.095296f, 0.446850f, 0.147212f, -0.124765f, 0.020486f, -0.059414f, 0.161295f, 0.360776f, 0.208203f, 0.241212f, 0.022949f, 0.141795f, 0.059724f, -0.099536f, 0.084400f, -0.126822f, 0.194038f, 0.114309f, 0.167381f, 0.104788f, -0.092082f, -0.069794f, -0.108291f, 0.082928f, 0.065500f, 0.157782f, 0.020125f, 0.178215f, 0.196082f, 0.103835f, -0.030772f, -0.054850f, -0.263295f, -0.195055f, -0.278096f, 0.229049f, 0.151963f, 0.175189f, 0.137102f, -0.108449f, -0.088390f, -0.171091f, -0.051707f, -0.170222f, 0.103033f, -0.181266f, 0.024965f, 0.074107f, 0.102040f, 0.085102f, -0.170924f, -0.021638f, -0.037293f, 0.058812f, 0.021663f, -0.114492f, 0.019945f, 0.150181f, 0.089928f, 0.143412f, -0.112317f, 0.102335f, -0.064227f, -0.075401f, 0.000942f, 0.098943f, -0.079067f, -0.201940f, -0.328530f, 0.057583f, -0.083648f, 0.141770f, -0.190146f, 0.151875f, -0.095783f, -0.088208f, -0.099696f, -0.026545f, -0.001297f, 0.050885f, 0.021219f, -0.173786f, 0.061336f, -0.084596f, -0.228425f, -0.132351f, 0.024121f, 0.051513f, 0.039315f, -0.067437f, -0.137388f, -0.140822f, -0.163677f, -0.128715f, -0.056971f, -0.035387f, -0.222449f, -0.142764f, -0.213683f, -0.009715f, 0.078467f, -0.011231f, 0.151735f, 0.095889f, 0.152209f, 0.056545f, -0.154722f, -0.145043f, 0.074212f, -0.193020f, 0.154218f, -0.078202f, -0.106588f, 0.000432f, -0.191103f, 0.082822f, -0.007959f, -0.132474f, -0.072601f, 0.148791f, 0.122304f, 0.002085f, -0.087678f, 0.097082f, -0.008372f, 0.168239f, 0.029503f, -0.003298f, -0.136404f, 0.119462f, -0.038102f, 0.067492f, 0.111428f, -0.075925f, 0.108777f, 0.083087f, 0.004236f, 0.170113f, 0.057777f, -0.101125f, -0.170298f, -0.204039f, -0.016561f, -0.110556f, 0.014886f, 0.208410f, 0.138172f, -0.163295f, -0.089077f, 0.153604f, -0.436601f, 0.011133f, 0.443488f, 0.042833f, 0.097722f, -0.173666f, 0.010104f, 0.172774f, 0.138649f, 0.002178f, 0.224298f, 0.233169f, 0.240586f, 0.120765f, 0.176425f, 0.094211f, -0.134503f, 0.230836f, 0.087578f, -0.114452f, -0.053642f, -0.014067f, 0.224500f, 0.076573f, 0.251967f, -0.187163f, 0.177771f, 0.107050f, -0.203392f, 0.011664f, -0.229644f, 0.175319f, -0.164746f, -0.136603f, -0.018904f, 0.191737f, -0.010377f, 0.164042f, 0.048796f, -0.012664f, -0.134171f, 0.060109f, -0.012898f, 0.112315f, -0.164264f, -0.088496f, 0.165039f, 0.150451f, -0.203220f, -0.219452f, -0.004738f, -0.168686f, -0.124319f, 0.120064f, -0.076757f, -0.086575f, -0.150222f, -0.200459f, 0.134295f, -0.218220f, -0.165623f, 0.015186f, -0.053692f, 0.166807f, 0.100010f, 0.102680f, -0.168545f, -0.110910f, -0.124615f, 0.028473f, 0.001430f, -0.222824f, 0.049279f, -0.229065f, 0.047841f, -0.183212f, -0.146242f, -0.060607f, -0.222844f, -0.134688f, 0.066627f, -0.017724f, 0.100868f, -0.087898f, -0.066040f, -0.174820f, -0.008092f, -0.164036f, -0.023489f, 0.067127f, -0.037343f, 0.093842f, 0.041488f, 0.054088f, 0.180967f, -0.193262f, -0.014688f, -0.078626f, 0.053565f, -0.140860f, -0.084751f, -0.195784f, -0.005476f, -0.175956f, 0.129428f, 0.119469f, 0.107134f, 0.030387f, -0.100705f, 0.146188f, -0.218623f, 0.018115f, 0.048234f, -0.214064f, -0.139954f, -0.185261f, 0.075271f, 0.005343f, 0.079852f, 0.091392f, 0.151796f, 0.155195f, -0.041436f, -0.155903f, -0.145166f, -0.075598f, -0.122101f, -0.049478f, 0.103696f, -0.170116f, -0.251266f, 0.100188f, 0.246385f, 0.146975f, -0.201326f, -0.155950f, -0.090659f, -0.415477f, 0.041387f, -0.155655f, 0.114234f, 0.019775f, 0.129106f, -0.180134f, -0.172401f, -0.066405f, -0.041297f, -0.062292f, -0.079589f, -0.133172f, -0.081218f, 0.165306f, -0.214370f, 0.144350f, -0.038926f, 0.182408f, -0.081634f, -0.390295f, -0.449504f, 0.189890f, 0.165759f, -0.228859f, -0.050546f, 0.033090f, 0.208992f, -0.112847f, -0.197190f, -0.250703f, 0.057273f, -0.134075f, 0.059808f, 0.113765f, -0.526686f, -0.173151f, -0.293193f, -0.406665f, -0.067325f, 0.096335f, -0.138149f, 0.073450f, -0.274529f, -0.041132f, -0.148150f, -0.263811f, 0.009005f, -0.233716f, -0.055725f, -0.001446f, 0.242902f, -0.208837f, 0.100425f, -0.060760f, -0.274495f, -0.306466f, -0.096670f, 0.081281f, -0.108921f, 0.332200f, 0.268198f, -0.096073f, 0.144338f, -0.120206f, 0.137017f, 0.048497f, 0.181926f, 0.263689f, 0.451251f, -0.066361f, -0.141767f, 0.329041f, -0.188899f, -0.074696f, 0.114306f, -0.137880f, -0.111683f, 0.055704f, 0.156410f, 0.163572f, 0.014705f, 0.054688f, -0.025897f, -0.144835f, -0.077186f, -0.094395f, -0.124864f, -0.022019f, 0.083602f, 0.032521f, 0.069258f, 0.145790f, 0.087293f, 0.105368f, -0.127798f, 0.142754f, -0.027090f, 0.341174f, -0.069716f, 0.031278f, 0.153487f, 0.106971f, -0.222024f, 0.169382f, 0.237849f, -0.145404f, 0.064090f, -0.213477f, -0.261570f, 0.112447f, -0.231499f, 0.173194f, 0.115872f, 0.563732f, 0.076949f, -0.028792f, 0.156616f, -0.023072f, -0.087858f, 0.448984f, -0.003888f, 0.040046f, 0.165091f, -0.175869f, 0.136091f, 0.028655f, 0.183573f, 0.105650f, -0.244598f, -0.155155f, 0.070127f, -0.034497f, 0.106958f, -0.159148f, -0.116307f, 0.001012f, -0.062999f, 0.142085f, 0.044210f, 0.049784f, -0.103822f, 0.140195f, -0.419424f, 0.134079f, -0.501457f, -0.184397f, -0.346534f, -0.064456f, 0.051471f, 0.128899f, -0.126259f, 0.320192f, 0.023348f, 0.041161f, -0.134657f, -0.149799f, -0.029127f, 0.181812f, -0.069836f, 0.180512f, 0.121770f, -0.030241f, -0.081739f, 0.088290f, 0.160553f, -0.011201f, 0.092695f, 0.009054f, 0.201198f, -0.059307f, 0.059798f, 0.051107f, -0.042865f, 0.045488f, 0.128644f, -0.246213f, -0.032264f, 0.088721f, 0.178131f, 0.103321f, 0.010194f, 0.223917f, -0.407750f, 0.080848f, 0.404262f, 0.059576f, -0.078605f, -0.082345f, 0.150257f, -0.075683f, 0.098182f, 0.136517f, -0.066851f, 0.355354f, -0.036614f, 0.066361f, 0.179060f, -0.100927f, 0.163629f, 0.315794f, 0.062215f, 0.034819f, 0.109751f, -0.005149f, 0.137494f, 0.006139f, 0.341849f, -0.084374f, 0.012977f, -0.013321f, 0.171380f, 0.151979f, -0.186327f, 0.199327f, 0.106996f, 0.066270f, 0.217527f, 0.196169f, -0.049900f, 0.102820f, 0.037247f, -0.125418f, 0.110528f, -0.044938f, -0.242238f, 0.167304f, -0.251307f, 0.191943f, -0.036662f, 0.213733f, -0.238726f, 0.110492f, 0.056510f, -0.139731f, 0.042553f, 0.114778f, -0.016546f, -0.059783f, 0.059587f, -0.117950f, -0.146113f, -0.028926f, -0.066174f, 0.109382f, 0.126338f, 0.177252f, 0.167895f, 0.008497f, 0.107933f, -0.162150f, 0.019572f, 0.065006f, 0.023120f, -0.004184f, -0.117200f, 0.017234f, -0.006280f, 0.277062f, -0.102411f, -0.064930f, -0.076990f, 0.054021f, -0.252455f, 0.184346f, 0.499572f, -0.031076f, -0.089352f, -0.128914f, -0.210053f, 0.218746f, 0.085496f, -0.008671f, 0.100304f, 0.415999f, -0.014268f, -0.070014f, -0.178317f, -0.184613f, 0.171492f, 0.166615f, -0.165818f, 0.155378f, -0.018220f, -0.137049f, 0.043394f, -0.039433f, 0.243811f, 0.073117f, -0.071043f, 0.093469f, 0.029658f, 0.102351f, 0.048471f, -0.148969f, -0.084878f, 0.007677f, -0.029664f, 0.121672f, 0.048465f, -0.214873f, -0.076082f, 0.106843f, 0.051440f, 0.101076f, -0.088698f, -0.064132f, -0.257842f, 0.236102f, 0.116770f, 0.110251f, 0.085704f, 0.346227f, -0.014244f, -0.134669f, 0.184006f, -0.083612f, 0.171846f, -0.206149f, 0.122517f, -0.028900f, -0.008354f, -0.141544f, 0.078449f, -0.135115f, -0.064588f, -0.064242f, -0.191321f, -0.042288f, 0.003665f, 0.103990f, 0.067864f, 0.098256f, 0.135329f, -0.243627f, 0.173653f, -0.025680f, -0.167501f, 0.096571f, -0.111665f, 0.090466f, -0.005598f, 0.076074f, -0.010995f, 0.035285f, 0.428118f, -0.130184f, 0.092294f, -0.065173f, -0.075308f, -0.007986f, -0.168568f, 0.060058f, -0.149618f, 0.136857f, 0.048135f, -0.143102f, -0.003975f, -0.033599f, -0.170601f, 0.395357f, -0.088930f, 0.011674f, -0.038711f, -0.183091f, 0.278720f, 0.100125f, 0.199617f, 0.087280f, 0.197016f, -0.191567f, 0.046272f, -0.012885f, 0.027072f, -0.047465f, 0.060573f, -0.106965f, -0.058241f, -0.030824f, -0.078925f, -0.090669f, 0.026230f, 0.043617f, 0.046554f, 0.029710f, -0.163856f, -0.151421f, -0.467120f, -0.081108f, -0.031978f, -0.058157f, 0.080542f, 0.276975f, 0.017678f, 0.177488f, -0.166784f, -0.104483f, 0.033612f, -0.058936f, 0.004156f, 0.184816f, -0.109433f, 0.005267f, -0.121951f, 0.116060f, 0.039883f, 0.088838f, -0.095436f, -0.115680f, 0.147466f, 0.036548f, 0.175842f, 0.144870f, -0.189179f, -0.065703f, 0.151671f, -0.278280f, 0.192644f, 0.166975f, -0.090530f, -0.010511f, -0.117823f, 0.198242f, -0.501433f, -0.085924f, 0.395053f, 0.134895f, 0.240641f, 0.107567f, -0.000837f, -0.016974f, -0.023194f, -0.121368f, -0.001979f, 0.372818f, 0.076249f, 0.035659f, -0.167317f, -0.050559f, -0.030452f, 0.266877f, -0.126801f, 0.020012f, 0.114064f, -0.146371f, 0.025421f, 0.070391f, 0.056201f, -0.038754f, -0.112667f, 0.058805f, -0.159401f, 0.019010f, -0.119942f, 0.221575f, -0.135712f, 0.137478f, -0.022630f, 0.188211f, 0.196057f, -0.028456f, 0.100052f, 0.148604f, 0.080833f, -0.155491f, -0.331918f, 0.023511f, -0.447906f, -0.070934f, -0.012793f, -0.051154f, 0.032337f, 0.230305f, 0.003656f, 0.173184f, -0.015968f, -0.170052f, 0.097256f, 0.115726f, 0.147223f, -0.025833f, -0.149213f, -0.055126f, 0.217607f, -0.135225f, -0.048446f, -0.030279f, -0.135684f, -0.085183f, 0.164833f, -0.026031f, 0.106523f, 0.151795f, 0.037366f, -0.045066f, -0.051236f, -0.235782f, 0.008794f, 0.272418f, 0.082931f, 0.104312f, -0.093193f, -0.140240f, -0.346520f, 0.082183f, 0.330996f, -0.184558f, -0.058031f, 0.002800f, 0.055956f, -0.085235f, -0.057152f, 0.047847f, 0.026550f, 0.405710f, -0.017641f, 0.119283f, 0.010013f, -0.143620f, 0.084396f, 0.413099f, 0.224422f, -0.026823f, 0.023011f, -0.166841f, 0.035701f, 0.101308f, 0.063304f, -0.123115f, 0.218808f, -0.064867f, -0.150512f, 0.133013f, -0.185001f, -0.152697f, 0.042818f, -0.011733f, 0.122075f, 0.160683f, 0.047710f, -0.008781f, -0.066429f, 0.152002f, -0.088960f, 0.144228f, -0.338289f, 0.103380f, -0.434143f, -0.045715f, 0.113386f, -0.154746f, -0.130326f, 0.385921f, 0.184375f, -0.046419f, 0.077112f, 0.126570f, 0.190802f, 0.065827f, -0.027294f, 0.061243f, 0.066656f, -0.075048f, -0.005758f, -0.123799f, -0.099937f, 0.026823f, 0.135602f, 0.190503f, 0.001918f, -0.154422f, -0.055932f, 0.154650f, 0.201591f, -0.101592f, -0.009418f, -0.123911f, -0.113977f, 0.207646f, 0.052018f, 0.103695f, -0.087105f, 0.179482f, -0.107665f, 0.006535f, 0.437125f, 0.050422f, 0.052714f, 0.202518f, -0.171679f, 0.075502f, -0.102346f, 0.043140f, 0.020650f, 0.560051f, 0.250924f, 0.012299f, 0.060041f, 0.075417f, 0.017774f, 0.323206f, 0.227268f, 0.189090f, 0.113673f, 0.094298f, 0.233986f, 0.103222f, 0.159313f, -0.082687f, -0.067034f, 0.045764f, 0.018208f, 0.145968f, 0.016466f, 0.087415f, 0.055426f, -0.161752f, 0.072480f, -0.077543f, 0.212633f, -0.151576f, 0.143523f, 0.059040f, -0.047024f, -0.064499f, 0.045955f, 0.125661f, -0.429982f, 0.155135f, 0.087326f, -0.150546f, -0.033310f, 0.099651f, 0.051372f, 0.060011f, -0.123324f, -0.057672f, -0.113496f, -0.181396f, -0.046259f, -0.149891f, 0.074654f, 0.047344f, -0.131833f, -0.141679f, 0.186978f, -0.165092f, 0.152731f, 0.099568f, -0.148853f, 0.073123f, 0.109746f, -0.110081f, 0.003274f, 0.043255f, -0.120881f, -0.117267f, 0.163118f, 0.043924f, -0.010367f, -0.100527f, 0.153846f, -0.144724f, -0.139316f, 0.063107f, 0.043023f, -0.069427f, -0.146828f, -0.000763f, -0.140246f, 0.043386f, -0.164733f, 0.130796f, 0.045627f, -0.163055f, -0.159359f, -0.126550f, -0.117953f, -0.173374f, -0.035702f, 0.021793f, 0.088626f, 0.097748f, 0.007309f, 0.087466f, -0.069723f, -0.205270f, -0.156310f, 0.002140f, 0.093151f, 0.015408f, 0.055942f, -0.096010f, -0.116467f, 0.007756f, -0.018355f, -0.089671f, -0.076022f, -0.092073f, 0.072939f, -0.170339f, -0.027371f, -0.135475f, 0.012269f, -0.051621f, -0.161004f, 0.096092f, -0.136268f, 0.028159f, 0.079681f, -0.040411f, -0.080915f, -0.197077f, -0.048626f, 0.293297f, 0.036959f, 0.082564f, -0.082091f, -0.031965f, 0.149864f, 0.020785f, -0.093120f, -0.032322f, -0.145115f, -0.159829f, 0.159297f, 0.072936f, 0.015678f, 0.078240f, 0.063483f, 0.021413f, 0.048790f, 0.014501f, 0.012005f, 0.189809f, -0.006700f, 0.222541f, -0.181290f, -0.165718f, 0.081443f, 0.055912f, 0.224150f, 0.108332f, 0.195067f, -0.028874f, -0.312339f, 0.013480f, 0.022287f, 0.217815f, 0.102067f, -0.041249f, 0.204278f, -0.081896f, -0.113305f, -0.372508f, 0.095418f, -0.061675f, 0.240537f, 0.281544f, 0.109861f, 0.038074f, 0.129402f, 0.033467f, -0.085330f, 0.245228f, -0.294583f, -0.146038f, -0.177090f, -0.017637f, -0.253295f, -0.082965f, -0.063141f, 0.110009f, 0.065945f, 0.065030f, 0.194841f, -0.067590f, -0.024951f, 0.201010f, -0.043617f, -0.079346f, 0.108759f, -0.068382f, 0.183604f, 0.105405f, 0.189882f, 0.163939f, 0.186732f, -0.145765f, 0.034788f, 0.024217f, 0.033427f, 0.362855f, -0.179720f, 0.101023f, -0.057221f, 0.144254f, 0.024277f, -0.116722f, 0.109616f, -0.123847f, 0.165290f, -0.139477f, 0.138393f, 0.084945f, -0.111894f, 0.219691f, -0.068727f, -0.111243f, -0.055078f, 0.088269f, -0.056867f, 0.076589f, 0.005640f, 0.091845f, -0.041250f, 0.252995f, 0.196240f, 0.033475f, 0.087710f, -0.073457f, -0.247303f, -0.036306f, 0.103842f, 0.153574f, 0.379463f, -0.138426f, -0.052311f, 0.115228f, -0.065001f, 0.149606f, -0.049597f, 0.096188f, -0.112552f, 0.283373f, 0.093919f, 0.056302f, 0.119793f, 0.141385f, -0.107203f, 0.336955f, 0.050519f, -0.018841f, 0.166398f, -0.169223f, 0.277014f, -0.034491f, 0.268356f, 0.164496f, 0.081325f, 0.122854f, -0.190866f, -0.075499f, 0.227919f, 0.062033f, 0.008624f, -0.117133f, 0.098078f, -0.061329f, 0.159891f, 0.216022f, -0.121638f, -0.179921f, -0.289956f, 0.015632f, -0.193625f, -0.033656f, -0.404530f, -0.026618f, -0.041295f, -0.008239f, -0.130279f, 0.014333f, -0.058086f, 0.092477f, 0.080153f, -0.115769f, -0.180494f, 0.085932f, -0.170878f, -0.088245f, -0.142071f, -0.063035f, -0.082968f, -0.191573f, 0.133306f, 0.045627f, -0.050703f, 0.018724f, 0.025028f, -0.151280f, 0.032238f, 0.167409f, 0.102781f, -0.009899f, 0.085128f, 0.017317f, 0.082907f, 0.171556f, 0.023697f, -0.128946f, 0.090712f, -0.047485f, -0.125824f, -0.098927f, 0.048079f, -0.177072f, -0.066867f, -0.099420f, 0.032851f, -0.149192f, -0.051177f, -0.190017f, 0.076512f, 0.147565f, 0.061062f, -0.124378f, -0.002470f, 0.036650f, -0.175165f, 0.058250f, -0.157201f, -0.023976f, -0.038037f, -0.101970f, 0.158468f, -0.067693f, -0.090016f, -0.014064f, 0.108226f, -0.171126f, 0.001353f, 0.089076f, -0.193441f, -0.041720f, -0.009194f, -0.081308f, 0.052549f, -0.084336f, -0.082387f, -0.143315f, -0.176254f, 0.132722f, 0.044469f, -0.131885f, -0.001938f, 0.057435f, 0.039830f, 0.159045f, -0.036692f, 0.112676f };
+static const float prediction_next_power_gen_layer_3_biases[32] = { 0.144243f, 0.099540f, 0.009376f, 0.202825f, 0.105431f, 0.163441f, 0.190308f, 0.012923f, -0.046849f, 0.155649f, -0.001726f, 0.046808f, -0.036892f, 0.185759f, 0.128130f, -0.058086f, 0.162296f, 0.177531f, 0.192193f, -0.034980f, 0.212723f, 0.196737f, -0.024669f, 0.175592f, 0.205689f, 0.012568f, -0.133188f, -0.038397f, 0.015991f, 0.202508f, 0.010038f, 0.146111f };
+static const float prediction_next_power_gen_layer_3_weights[2560] = { 0.018332f, -0.115414f, 0.047287f, 0.130183f, 0.240114f, 0.089302f, -0.086748f, -0.560702f, -0.193586f, -0.111467f, -0.118212f, 0.105320f, 0.053487f, 0.111789f, 0.068731f, 0.137395f, -0.117225f, -0.084238f, 0.068927f, 0.102899f, 0.000665f, -0.115042f, -0.106428f, -0.177010f, 0.550369f, 0.129203f, -0.149000f, 0.194655f, 0.032271f, 0.242178f, -0.051812f, 0.183802f, 0.134493f, -0.089137f, 0.105915f, -0.179090f, -0.117070f, -0.128814f, -0.144343f, 0.179504f, -0.045922f, 0.074110f, -0.080357f, -0.013203f, 0.174625f, 0.071994f, -0.037296f, 0.200117f, -0.336282f, -0.169270f, -0.011612f, -0.074382f, 0.334562f, -0.112130f, -0.074516f, 0.174821f, -0.008191f, 0.126974f, 0.010236f, 0.109763f, 0.034114f, 0.112585f, 0.254487f, -0.006215f, 0.131691f, 0.111914f, 0.000255f, -0.122013f, -0.171577f, 0.271924f, -0.152239f, -0.016876f, -0.131226f, 0.149692f, 0.264334f, -0.034627f, -0.003816f, -0.176790f, 0.106635f, 0.227145f, -0.126256f, -0.074331f, -0.231580f, 0.128985f, -0.087621f, -0.015092f, -0.145380f, -0.514864f, -0.023057f, -0.090675f, -0.101212f, 0.054916f, 0.015626f, 0.018127f, -0.002338f, -0.085208f, -0.093923f, 0.166208f, 0.195041f, -0.105529f, -0.154806f, -0.182926f, 0.161440f, -0.247351f, 0.356080f, 0.096299f, 0.120110f, 0.066125f, 0.144597f, 0.157116f, -0.072815f, -0.000284f, 0.048690f, 0.056319f, -0.183945f, 0.052543f, 0.116673f, -0.237876f, 0.161253f, -0.212344f, 0.102197f, 0.196127f, 0.120782f, 0.020106f, 0.176795f, -0.008504f, 0.084967f, -0.106786f, -0.427905f, -0.212609f, -0.348761f, -0.105987f, 0.471331f, 0.056905f, 0.123700f, 0.204965f, 0.113049f, -0.130459f, -0.122868f, 0.101965f, -0.005615f, 0.140955f, -0.178296f, 0.058500f, -0.026654f, 0.169946f, -0.179938f, -0.150606f, -0.038486f, 0.156431f, 0.185497f, -0.046466f, 0.185299f, 0.062985f, -0.000908f, 0.184617f, -0.081776f, -0.059353f, 0.096768f, 0.181008f, -0.148232f, 0.039272f, -0.214138f, 0.004059f, -0.023125f, -0.143920f, -0.014477f, -0.057679f, 0.129236f, -0.029696f, 0.228609f, 0.183707f, 0.102307f, -0.077911f, 0.185297f, -0.110103f, -0.219622f, 0.027750f, -0.032435f, 0.177534f, -0.285056f, -0.018794f, -0.070427f, -0.112943f, -0.300733f, 0.171734f, -0.233287f, -0.097638f, -0.042142f, 0.001126f, 0.207590f, 0.036546f, 0.073473f, -0.164309f, 0.050236f, -0.236004f, -0.063987f, 0.037580f, -0.091339f, 0.205542f, -0.074215f, 0.139288f, -0.219231f, 0.259220f, 0.116013f, 0.193539f, 0.113570f, -0.044168f, -0.331748f, -0.148805f, -0.264695f, -0.102219f, -0.137977f, 0.052707f, 0.114833f, 0.181754f, 0.096773f, -0.035235f, 0.149898f, 0.173115f, 0.218519f, -0.139847f, -0.145618f, -0.096457f, 0.024162f, -0.019472f, 0.148480f, 0.088321f, -0.112637f, -0.199039f, 0.219002f, 0.112048f, 0.199214f, -0.003171f, -0.114886f, 0.151858f, -0.168792f, 0.127101f, 0.196813f, -0.093527f, 0.161128f, -0.068656f, 0.296298f, 0.121248f, 0.052209f, -0.167435f, 0.132664f, -0.240624f, 0.100168f, 0.120289f, -0.041716f, 0.043663f, 0.275579f, 0.029332f, 0.173428f, 0.269967f, -0.160972f, 0.019025f, 0.083326f, 0.246290f, 0.026093f, 0.049067f, 0.282996f, -0.246490f, 0.410581f, 0.191621f, 0.295955f, 0.057671f, -0.060365f, 0.239686f, -0.024471f, 0.226814f, 0.133524f, 0.210190f, 0.063061f, -0.016134f, -0.123775f, 0.220447f, 0.215351f, -0.077862f, -0.138971f, -0.074320f, -0.165483f, 0.252039f, 0.254085f, 0.251297f, 0.056958f, 0.137173f, -0.151890f, 0.252711f, -0.405240f, 0.040288f, 0.203049f, 0.025902f, 0.152030f, -0.055153f, 0.205736f, 0.111120f, -0.094243f, 0.277100f, 0.192964f, 0.112847f, 0.045027f, 0.274696f, -0.121730f, -0.092621f, 0.187038f, -0.034786f, 0.052145f, -0.055315f, 0.230238f, 0.073511f, 0.266757f, 0.153844f, 0.044189f, -0.137814f, -0.113654f, -0.239601f, 0.036763f, 0.216744f, 0.085539f, -0.046791f, 0.154737f, 0.055549f, 0.011736f, 0.175295f, 0.199505f, -0.368686f, -0.226928f, 0.224923f, 0.177377f, 0.193246f, 0.109620f, -0.104563f, 0.234731f, -0.145182f, -0.372584f, 0.177584f, 0.004189f, -0.064292f, -0.128123f, -0.192041f, 0.130346f, -0.276898f, 0.097142f, 0.023414f, 0.009669f, -0.023541f, 0.211766f, -0.117136f, -0.076694f, 0.228223f, 0.139568f, 0.237790f, -0.060588f, 0.210927f, -0.134662f, -0.138507f, -0.012465f, 0.085260f, 0.140863f, -0.281816f, 0.087164f, -0.030574f, -0.211415f, -0.181275f, -0.035667f, -0.040673f, -0.111064f, 0.119500f, -0.078223f, 0.082926f, 0.436160f, -0.106852f, -0.186041f, -0.032896f, 0.175919f, -0.066756f, -0.025036f, 0.228957f, -0.126302f, -0.013393f, -0.135164f, 0.061094f, -0.081911f, -0.044957f, 0.062277f, 0.058641f, -0.192899f, 0.045090f, -0.209470f, -0.046128f, 0.244151f, -0.002610f, 0.153159f, 0.100446f, 0.053174f, -0.001224f, -0.210707f, -0.208417f, -0.011748f, 0.071595f, -0.117272f, 0.030605f, -0.187765f, -0.039742f, -0.133186f, -0.667993f, 0.108048f, 0.147313f, 0.018255f, 0.190888f, -0.065537f, -0.073701f, -0.056964f, 0.208348f, -0.260620f, 0.013242f, 0.140212f, 0.188048f, -0.124857f, 0.013224f, 0.110570f, -0.405564f, 0.204793f, -0.050160f, 0.136333f, 0.150919f, -0.184900f, 0.072829f, 0.155258f, 0.123800f, -0.042093f, 0.165673f, -0.023261f, 0.033143f, -0.038103f, 0.175248f, 0.158290f, 0.212245f, 0.163070f, 0.031917f, -0.084012f, 0.131351f, -0.111876f, 0.023828f, -0.124802f, 0.155024f, -0.245032f, -0.203701f, -0.141352f, 0.235939f, 0.180606f, -0.018855f, -0.208921f, 0.236112f, 0.147615f, -0.137661f, 0.046085f, 0.093803f, 0.234124f, -0.100697f, -0.142436f, -0.199420f, 0.142248f, 0.165920f, -0.188302f, 0.197085f, -0.171222f, 0.003368f, -0.029894f, 0.130237f, -0.036966f, 0.248981f, 0.233303f, 0.190901f, -0.179838f, -0.256933f, 0.099556f, 0.030024f, -0.105034f, -0.104982f, 0.141924f, -0.107409f, -0.190860f, 0.247365f, -0.020110f, -0.459867f, 0.067637f, -0.030437f, 0.207716f, -0.070372f, 0.052297f, 0.002895f, -0.194042f, -0.023406f, 0.047631f, 0.014562f, -0.167269f, 0.198177f, -0.217749f, 0.052521f, 0.123788f, 0.063600f, 0.417505f, 0.182429f, 0.236155f, -0.037163f, 0.121263f, 0.152667f, -0.045003f, 0.233992f, 0.212698f, 0.256174f, 0.182213f, -0.172657f, -0.068656f, 0.055437f, 0.009444f, 0.015498f, -0.147702f, 0.084442f, 0.060035f, 0.278455f, 0.052649f, 0.119300f, 0.183161f, 0.124119f, -0.111071f, 0.049740f, -0.416346f, 0.041561f, 0.437646f, 0.094822f, 0.279558f, -0.014445f, 0.218025f, 0.111784f, 0.167033f, 0.272979f, 0.144835f, -0.159202f, 0.132690f, 0.009776f, 0.230635f, -0.040348f, 0.186444f, -0.006145f, -0.307203f, 0.056131f, 0.227854f, 0.096496f, 0.009457f, 0.031388f, 0.073718f, 0.190029f, -0.183762f, 0.107988f, -0.008191f, -0.080382f, -0.142314f, -0.282700f, -0.068015f, -0.105722f, 0.031650f, -0.076890f, 0.242638f, 0.169315f, 0.179818f, 0.068709f, -0.137161f, -0.088894f, 0.146020f, -0.141331f, 0.055435f, -0.103229f, 0.441543f, -0.222452f, 0.099115f, -0.204233f, -0.249336f, -0.229072f, -0.171971f, 0.363925f, 0.052345f, 0.158533f, -0.049755f, 0.034437f, -0.162223f, -0.045961f, -0.155322f, -0.065812f, -0.040257f, 0.190820f, -0.146876f, -0.107041f, -0.290742f, -0.112424f, 0.160781f, -0.184537f, 0.174792f, -0.184455f, 0.160830f, -0.144781f, 0.121590f, -0.008875f, -0.176536f, -0.021189f, 0.298921f, 0.109273f, 0.235642f, 0.049219f, 0.175743f, -0.267046f, -0.173809f, -0.061080f, -0.104427f, 0.082596f, -0.062061f, -0.202725f, 0.183266f, -0.216658f, -0.202502f, -0.130933f, 0.062326f, -0.177873f, -0.131502f, 0.136229f, 0.133835f, -0.264341f, 0.016319f, -0.135821f, -0.093082f, -0.105148f, 0.014850f, -0.035612f, -0.075206f, -0.062263f, -0.203472f, -0.066065f, 0.084892f, -0.116547f, -0.144786f, -0.144341f, 0.034472f, -0.049286f, -0.142392f, 0.282192f, 0.009044f, -0.228650f, 0.169063f, 0.117038f, -0.130083f, -0.064384f, 0.320022f, 0.126589f, 0.297899f, -0.084425f, 0.128646f, -0.056535f, -0.182959f, -0.157212f, 0.077139f, 0.451692f, 0.082740f, -0.275220f, 0.136918f, -0.116180f, -0.055744f, 0.146768f, -0.094286f, 0.076867f, 0.164359f, 0.065757f, -0.143308f, -0.296455f, 0.126494f, 0.056954f, 0.097769f, -0.059561f, 0.007839f, 0.103444f, 0.017664f, 0.157836f, 0.132306f, 0.083970f, -0.220530f, -0.008735f, 0.443559f, 0.004004f, 0.368400f, 0.007078f, -0.040280f, 0.127678f, -0.109719f, 0.183737f, -0.016090f, 0.082575f, -0.005933f, -0.205749f, -0.223188f, -0.091686f, 0.017545f, -0.031501f, 0.091690f, 0.165323f, 0.055600f, -0.012649f, 0.088084f, -0.135615f, -0.067768f, 0.203359f, -0.069770f, -0.206226f, -0.188641f, -0.245854f, 0.156580f, -0.266894f, -0.225051f, -0.082231f, 0.171023f, -0.091815f, -0.055334f, -0.029055f, -0.207814f, -0.007397f, -0.071094f, -0.134274f, 0.199652f, 0.037935f, 0.103046f, 0.185692f, 0.275228f, -0.173992f, 0.101128f, -0.065823f, -0.083575f, 0.228171f, 0.192947f, 0.167303f, -0.336887f, -0.081505f, -0.080331f, 0.193489f, 0.598216f, -0.038377f, 0.170683f, -0.188260f, 0.160712f, -0.044907f, -0.081738f, 0.110524f, 0.068902f, 0.002763f, 0.060401f, 0.151940f, 0.029833f, -0.016493f, 0.175118f, 0.035335f, 0.249203f, 0.062068f, -0.215765f, 0.093092f, 0.138723f, 0.151096f, -0.103877f, -0.222258f, -0.011676f, 0.107548f, -0.332635f, -0.206528f, 0.429789f, -0.078653f, 0.178321f, -0.186337f, -0.129083f, 0.226014f, 0.117815f, -0.129536f, 0.221285f, -0.069216f, 0.229390f, 0.198518f, 0.135451f, -0.033512f, 0.032062f, -0.024360f, -0.200724f, -0.012098f, -0.037325f, 0.056281f, 0.188647f, 0.181359f, -0.008689f, -0.065724f, -0.117886f, -0.203578f, -0.181470f, 0.021903f, -0.077078f, 0.191288f, -0.086246f, 0.129919f, -0.147859f, 0.059485f, -0.067151f, -0.195530f, -0.208714f, 0.240259f, -0.158538f, 0.107497f, 0.101323f, -0.132036f, -0.038541f, -0.164746f, 0.050297f, -0.152441f, -0.181240f, 0.181817f, -0.064911f, -0.003040f, -0.077809f, 0.072234f, 0.076630f, -0.027476f, -0.171881f, -0.143633f, 0.221472f, 0.192616f, -0.102658f, -0.223115f, 0.132992f, 0.193601f, -0.162997f, 0.184325f, -0.128558f, -0.183507f, -0.151513f, -0.218797f, -0.003748f, 0.051311f, 0.075519f, 0.240097f, 0.098547f, 0.126910f, -0.172669f, -0.203955f, -0.025472f, -0.106988f, 0.201228f, 0.075921f, 0.027938f, -0.206378f, -0.039816f, -0.140966f, -0.120440f, 0.034655f, 0.163043f, -0.047110f, -0.235813f, 0.181070f, 0.044656f, 0.179537f, 0.000668f, 0.081555f, 0.202304f, -0.228936f, -0.034243f, 0.165159f, 0.109267f, -0.199112f, -0.015551f, -0.171775f, 0.132763f, -0.054169f, -0.069270f, -0.137663f, 0.146494f, 0.102693f, -0.079608f, -0.143181f, 0.094613f, 0.216766f, 0.092898f, 0.102726f, -0.105336f, 0.032870f, -0.086894f, -0.078703f, -0.312447f, -0.253204f, 0.070043f, 0.115389f, 0.154223f, -0.433032f, 0.403789f, -0.141366f, 0.102477f, -0.045116f, 0.011822f, 0.170497f, -0.246173f, 0.210038f, 0.290103f, -0.245926f, 0.093274f, 0.014379f, 0.206471f, 0.206350f, 0.151286f, -0.196686f, 0.111057f, -0.279979f, 0.019743f, -0.088632f, -0.177125f, -0.221434f, 0.007351f, 0.032556f, 0.023579f, 0.109487f, -0.299773f, -0.234240f, 0.010164f, -0.033691f, 0.022864f, 0.043544f, 0.529745f, -0.136130f, 0.065677f, -0.320530f, 0.328521f, -0.314505f, -0.344202f, -0.056752f, -0.074050f, -0.041913f, 0.017856f, 0.001445f, 0.143304f, -0.218834f, -0.000922f, 0.010761f, -0.055797f, -0.041469f, 0.010643f, -0.044156f, 0.436806f, -0.233416f, -0.255403f, 0.335705f, 0.117530f, -0.383414f, -0.008290f, -0.342431f, 0.139196f, 0.152739f, -0.382282f, -0.196117f, -0.206170f, -0.011329f, -0.076781f, 0.139563f, -0.087580f, -0.086386f, -0.125123f, 0.210562f, 0.042658f, -0.053195f, -0.160813f, -0.014786f, 0.104855f, 0.198599f, -0.056763f, 0.146745f, 0.109639f, -0.026283f, -0.061988f, -0.123076f, -0.181701f, 0.175974f, -0.182706f, 0.032838f, 0.039569f, -0.085681f, -0.031125f, 0.053196f, -0.038244f, 0.040032f, 0.046416f, 0.064058f, -0.103056f, -0.105562f, -0.092537f, -0.233993f, 0.132439f, -0.047046f, -0.211147f, -0.098395f, 0.050612f, -0.067602f, -0.008027f, -0.106725f, -0.229091f, -0.159345f, 0.034707f, 0.171630f, -0.131137f, -0.220120f, -0.243890f, 0.060731f, -0.121696f, -0.126126f, 0.016747f, -0.039840f, 0.176783f, -0.198767f, -0.150598f, -0.176935f, 0.180799f, -0.169003f, 0.085924f, -0.194274f, -0.062151f, -0.178651f, 0.078592f, 0.078337f, -0.084043f, 0.072124f, 0.156428f, 0.001794f, 0.183196f, -0.043223f, -0.257084f, -0.133071f, 0.038838f, -0.226686f, 0.106743f, 0.171921f, -0.032974f, 0.047594f, 0.262672f, 0.183694f, 0.117164f, 0.176936f, 0.144270f, -0.442131f, -0.112506f, -0.043693f, 0.127559f, 0.136028f, 0.229795f, -0.076936f, -0.189269f, 0.226789f, -0.181229f, 0.264322f, -0.002739f, -0.015406f, -0.163627f, 0.127337f, -0.007526f, -0.404833f, 0.276982f, 0.092924f, 0.031125f, 0.001208f, -0.060869f, -0.021359f, -0.105967f, 0.063900f, -0.062762f, -0.007159f, 0.227071f, 0.182853f, -0.019699f, -0.049607f, 0.177150f, 0.082126f, 0.179054f, 0.067573f, -0.157666f, 0.076948f, -0.129341f, -0.079913f, -0.116550f, 0.130838f, -0.322531f, 0.164598f, -0.324492f, 0.073843f, 0.372664f, 0.057679f, 0.032941f, 0.186525f, 0.039662f, 0.221144f, -0.117685f, -0.026853f, 0.156660f, 0.214106f, 0.144703f, -0.120615f, 0.195212f, 0.035101f, 0.199767f, 0.199704f, -0.164315f, -0.096973f, 0.222514f, 0.213024f, 0.295587f, 0.026298f, 0.171294f, 0.100179f, -0.195179f, -0.251433f, 0.277775f, 0.101176f, -0.078946f, 0.227867f, -0.177222f, -0.171660f, 0.200957f, 0.010020f, -0.002279f, -0.687196f, 0.015413f, 0.070631f, 0.131252f, 0.041224f, 0.084233f, -0.157547f, 0.138141f, 0.073512f, -0.259393f, 0.065889f, -0.195706f, -0.051664f, -0.086895f, 0.120089f, 0.116394f, -0.041050f, 0.103302f, 0.017224f, 0.136716f, -0.224324f, -0.164329f, 0.085709f, -0.164753f, -0.106981f, 0.036510f, 0.168286f, 0.220230f, -0.229349f, 0.193489f, -0.122467f, 0.040386f, 0.198967f, -0.199445f, -0.248175f, -0.259908f, 0.024419f, 0.183217f, 0.141489f, 0.013844f, 0.021676f, -0.516076f, -0.018935f, -0.345326f, -0.058847f, 0.411300f, -0.025239f, 0.147104f, 0.057965f, 0.186480f, -0.067882f, 0.056237f, 0.021998f, 0.114568f, 0.170782f, 0.221028f, -0.014810f, 0.181636f, 0.180167f, -0.232661f, -0.074504f, -0.371687f, 0.128198f, -0.041454f, -0.032945f, -0.128149f, -0.112051f, -0.031187f, 0.152971f, -0.105981f, -0.284741f, 0.207205f, 0.017396f, -0.120038f, 0.179852f, -0.094912f, 0.089229f, 0.077552f, 0.097948f, 0.199353f, -0.349585f, 0.030039f, 0.023906f, -0.025977f, -0.107808f, -0.098147f, -0.109214f, -0.089250f, -0.020318f, -0.018514f, 0.092634f, -0.149673f, -0.090754f, -0.049816f, -0.228962f, 0.002318f, -0.117039f, -0.214761f, 0.216253f, -0.190154f, 0.162753f, -0.162670f, -0.057034f, -0.206449f, 0.083921f, -0.158284f, 0.216368f, -0.082755f, -0.182826f, 0.082611f, -0.145040f, -0.015770f, -0.073869f, -0.060446f, -0.218877f, 0.190718f, 0.072226f, 0.199006f, 0.127051f, -0.176197f, -0.092119f, 0.037375f, -0.118600f, -0.187763f, 0.021779f, -0.001250f, -0.072890f, 0.246955f, 0.157508f, -0.170644f, -0.147493f, -0.004058f, 0.053435f, 0.080365f, -0.207893f, -0.225806f, 0.068420f, -0.070221f, 0.079496f, -0.061607f, -0.173930f, -0.235338f, 0.154812f, -0.094098f, 0.150031f, -0.221677f, -0.187731f, -0.205350f, 0.125565f, 0.194968f, 0.174469f, 0.030083f, -0.184449f, 0.081186f, 0.021417f, 0.245095f, 0.114846f, 0.131962f, -0.078259f, 0.092266f, -0.571631f, 0.070601f, -0.139397f, -0.044912f, 0.138944f, 0.034241f, -0.096178f, -0.241638f, 0.121503f, -0.457145f, -0.053251f, -0.212499f, -0.098973f, -0.236940f, 0.174636f, -0.032736f, -0.315701f, 0.156484f, 0.064673f, 0.030480f, 0.229854f, -0.113334f, 0.268920f, 0.216699f, -0.024400f, -0.173521f, 0.074853f, -0.104785f, -0.103824f, 0.197712f, 0.126187f, -0.120391f, 0.044435f, 0.062183f, -0.263233f, -0.236328f, 0.184397f, 0.247140f, -0.040794f, -0.125053f, 0.031483f, -0.161918f, 0.123994f, -0.172713f, 0.203162f, 0.520687f, 0.172486f, -0.122659f, -0.141276f, -0.095267f, 0.004413f, 0.122390f, 0.053955f, 0.136408f, 0.017015f, -0.004362f, 0.044299f, 0.136430f, 0.149123f, -0.015436f, 0.145539f, -0.294232f, -0.061446f, 0.256095f, 0.130838f, 0.093088f, 0.233927f, 0.131190f, 0.081351f, -0.177739f, -0.177800f, -0.006883f, -0.161941f, 0.215057f, -0.012006f, 0.087311f, -0.206022f, 0.044933f, 0.114913f, 0.090570f, -0.561523f, 0.163492f, 0.117139f, -0.018658f, 0.050886f, 0.185328f, -0.055019f, -0.115736f, -0.039325f, -0.268273f, 0.242719f, 0.178993f, 0.202533f, -0.047544f, -0.019027f, 0.085903f, -0.148183f, 0.391574f, 0.061330f, 0.144645f, 0.187370f, -0.151520f, 0.107554f, -0.091170f, 0.091723f, 0.034707f, 0.253905f, -0.100421f, 0.191883f, -0.178058f, 0.089610f, 0.206809f, 0.018820f, 0.100190f, -0.038655f, -0.130731f, 0.015610f, 0.017979f, -0.182646f, 0.188278f, -0.205390f, -0.298796f, 0.109498f, -0.314551f, 0.098802f, 0.218001f, -0.008907f, -0.006764f, 0.204218f, 0.215868f, -0.136633f, -0.063113f, -0.132076f, -0.019918f, 0.005557f, 0.258269f, -0.114950f, -0.026355f, 0.049153f, 0.241006f, -0.033027f, -0.094417f, -0.055996f, -0.040812f, 0.072029f, -0.006826f, 0.088282f, 0.129381f, 0.149672f, -0.190778f, 0.181924f, -0.052237f, -0.059909f, 0.060992f, -0.051488f, 0.284227f, -0.130243f, 0.010878f, -0.014025f, 0.103346f, -0.578101f, 0.128719f, -0.088191f, 0.139971f, 0.172680f, 0.031826f, -0.185721f, -0.147920f, 0.184926f, -0.466700f, -0.100157f, 0.084318f, -0.062823f, -0.309121f, -0.024788f, -0.063491f, -0.380121f, 0.428000f, 0.155618f, -0.119832f, 0.165666f, -0.180463f, 0.059247f, -0.077146f, 0.264539f, -0.078688f, 0.101760f, -0.094187f, 0.112994f, -0.028776f, -0.078977f, -0.151226f, 0.206523f, 0.201454f, -0.212943f, 0.181754f, 0.223129f, 0.123845f, -0.106748f, -0.038778f, -0.136914f, -0.486137f, 0.283223f, -0.157644f, 0.221366f, 0.451713f, 0.138475f, -0.029236f, 0.150303f, 0.095137f, -0.067622f, 0.088118f, 0.263798f, 0.093169f, -0.150760f, 0.245936f, 0.120069f, 0.208233f, -0.164181f, -0.005432f, 0.099477f, -0.022714f, 0.193925f, 0.229818f, -0.129907f, 0.050449f, 0.222098f, -0.029878f, 0.166912f, -0.187919f, -0.212319f, 0.031661f, -0.170398f, -0.029992f, -0.083389f, 0.119951f, 0.069056f, 0.176924f, 0.037310f, -0.043957f, -0.131406f, -0.130046f, -0.126094f, 0.142493f, 0.179348f, 0.185676f, 0.293273f, -0.103894f, 0.003731f, -0.011602f, -0.257456f, 0.068483f, -0.190385f, -0.111561f, 0.202589f, -0.242828f, 0.142516f, -0.042510f, -0.257361f, -0.210785f, -0.222986f, -0.009325f, -0.184407f, 0.015316f, 0.164208f, -0.109813f, 0.167741f, 0.162015f, -0.230845f, 0.051733f, 0.112266f, -0.246432f, -0.267342f, -0.030316f, 0.169316f, 0.055890f, 0.201389f, 0.026585f, 0.149961f, 0.004399f, -0.164145f, -0.217092f, -0.253308f, -0.137454f, 0.174881f, 0.193276f, -0.214537f, 0.148151f, -0.183188f, 0.067923f, 0.026068f, -0.102285f, -0.121215f, 0.083807f, -0.156551f, -0.155994f, 0.026354f, -0.094167f, -0.203925f, -0.036399f, -0.149440f, 0.142464f, -0.013673f, 0.183133f, 0.046725f, 0.202619f, 0.103187f, -0.247259f, -0.085979f, 0.092804f, -0.110893f, 0.161989f, 0.009320f, -0.124010f, 0.262856f, 0.166730f, 0.126488f, -0.025130f, 0.269320f, -0.087031f, -0.281123f, 0.002750f, 0.267285f, 0.006343f, -0.078546f, -0.097786f, -0.198726f, -0.159211f, 0.269128f, -0.248949f, -0.085829f, -0.100960f, -0.103671f, -0.317621f, -0.194355f, 0.009024f, 0.031099f, 0.444467f, 0.156335f, -0.018619f, 0.161092f, 0.044869f, 0.186758f, -0.144400f, -0.065049f, 0.303342f, 0.210880f, 0.224422f, 0.227181f, 0.210591f, -0.157499f, 0.238523f, 0.198810f, -0.133577f, -0.096332f, -0.075942f, -0.021078f, 0.078320f, 0.155600f, 0.004903f, -0.212852f, -0.456381f, 0.235800f, -0.213807f, 0.277187f, 0.463418f, 0.097408f, -0.142522f, 0.000742f, 0.259707f, 0.287664f, 0.044713f, 0.001774f, 0.259584f, -0.157460f, -0.171093f, 0.085963f, 0.237857f, -0.188021f, 0.015515f, 0.116181f, -0.236699f, 0.031194f, 0.070684f, 0.214316f, 0.161774f, -0.103837f, -0.130633f, 0.043956f, -0.189888f, -0.027712f, 0.266865f, -0.148768f, 0.257446f, -0.110705f, 0.208165f, 0.155757f, -0.101405f, 0.044333f, 0.262493f, -0.281384f, -0.017271f, 0.277639f, 0.025701f, 0.169227f, 0.132182f, 0.210314f, -0.130522f, 0.275480f, -0.191125f, 0.015355f, 0.174566f, 0.189657f, -0.044651f, -0.140390f, 0.021274f, -0.260393f, 0.565618f, -0.019448f, -0.064513f, -0.019255f, -0.012116f, 0.155874f, -0.117525f, -0.129553f, 0.297079f, 0.295354f, -0.020363f, -0.235062f, 0.253674f, 0.238439f, 0.093003f, 0.174635f, 0.215210f, -0.057310f, -0.227351f, 0.047558f, 0.154678f, 0.244366f, -0.013015f, 0.030886f, -0.241931f, 0.281813f, -0.365789f, -0.012911f, 0.609880f, 0.215197f, 0.248298f, 0.046824f, 0.206400f, 0.092371f, 0.043537f, 0.088490f, 0.021845f, -0.109308f, 0.186107f, -0.015624f, -0.062026f, -0.100115f, -0.027952f, -0.151598f, -0.335771f, -0.046873f, 0.277191f, 0.069516f, 0.229839f, 0.112200f, -0.167493f, 0.297927f, 0.090320f, 0.134207f, -0.144506f, -0.146919f, -0.041290f, -0.108389f, 0.046906f, 0.129378f, 0.177166f, -0.141935f, 0.227337f, 0.048794f, 0.244663f, 0.112845f, 0.028668f, -0.093025f, -0.132273f, -0.166061f, 0.069897f, -0.159832f, 0.609881f, 0.067656f, 0.133538f, -0.193166f, 0.153262f, 0.071598f, -0.067212f, 0.590489f, -0.009439f, 0.069226f, -0.002092f, -0.022215f, 0.082833f, 0.244652f, 0.104144f, 0.110326f, -0.090152f, 0.059382f, 0.116617f, -0.150797f, -0.066723f, 0.103647f, -0.118517f, -0.085117f, 0.033152f, -0.129476f, -0.261861f, 0.019591f, -0.091318f, -0.194341f, 0.184546f, 0.045508f, 0.544727f, 0.077481f, 0.389284f, -0.182655f, 0.096591f, -0.034416f, -0.014901f, -0.005295f, 0.034711f, -0.038356f, 0.136347f, -0.079623f, -0.053755f, 0.184179f, -0.203216f, 0.038309f, -0.182794f, 0.083196f, -0.004739f, -0.007207f, 0.404846f, 0.141505f, -0.130582f, 0.092330f, -0.049151f, -0.173425f, -0.178839f, -0.145977f, -0.220182f, 0.050470f, -0.073769f, -0.004650f, 0.098118f, 0.194915f, 0.074966f, -0.080689f, 0.219305f, 0.237889f, -0.073751f, -0.375933f, 0.128384f, -0.147489f, 0.147018f, 0.231760f, -0.177997f, 0.015692f, 0.109354f, 0.027372f, 0.023816f, -0.015379f, -0.088328f, -0.018868f, 0.095948f, 0.179630f, -0.148782f, 0.147778f, 0.180084f, -0.053601f, -0.022499f, -0.039499f, 0.216675f, 0.129296f, 0.102264f, -0.025524f, -0.038391f, -0.179454f, 0.008012f, -0.027506f, 0.117679f, 0.166099f, 0.261197f, 0.168480f, 0.216534f, 0.124038f, 0.142768f, 0.104360f, 0.168996f, 0.073995f, 0.123134f, -0.160384f, -0.482030f, 0.174755f, -0.275711f, -0.148547f, 0.216712f, 0.150307f, -0.027043f, 0.048269f, 0.113521f, 0.091900f, 0.057240f, 0.095351f, 0.000462f, -0.024215f, -0.093915f, 0.056956f, -0.063181f, 0.131556f, -0.038287f, -0.015415f, -0.071586f, 0.239167f, -0.120463f, -0.184545f, 0.142236f, 0.089158f, 0.214698f, 0.096230f, -0.182840f, -0.287865f, 0.021509f, 0.111966f, 0.016648f, -0.162609f, -0.014961f, -0.070190f, -0.111733f, 0.109529f, 0.115968f, -0.376192f, -0.211661f, 0.059503f, 0.275067f, 0.054668f, 0.066873f, 0.085955f, -0.244427f, 0.260602f, -0.077597f, 0.012586f, -0.115792f, 0.218524f, -0.340324f, 0.133383f, 0.203631f, -0.109963f, 0.127067f, 0.257644f, 0.057519f, 0.133289f, 0.186716f, 0.243770f, 0.110865f, -0.076053f, 0.015410f, 0.008661f, 0.245882f, -0.242489f, 0.094962f, 0.085865f, 0.204843f, 0.097853f, 0.171604f, -0.056162f, -0.015130f, -0.000383f, 0.078636f, 0.057472f, 0.204319f, -0.089436f, -0.553799f, -0.126282f, -0.258265f, 0.125707f, 0.431010f, 0.208790f, 0.283348f, 0.089716f, 0.212601f, 0.098926f, 0.236829f, 0.016561f, 0.117609f, -0.094159f, 0.245357f, -0.120992f, 0.241478f, 0.167136f, 0.130593f, 0.184490f, -0.177515f, 0.282697f, 0.265716f, -0.143274f, -0.081464f, -0.084548f, 0.284445f, 0.047952f, 0.053422f, 0.118881f, 0.219830f, -0.147514f, -0.025098f, 0.309818f, -0.158830f, -0.041753f, -0.065272f, 0.192791f, -0.195727f, 0.212040f, 0.188681f, 0.079044f, 0.188090f, -0.198395f, 0.179571f, -0.030551f, 0.079293f, 0.191228f, 0.290123f, 0.082623f, -0.216268f, 0.103529f, -0.040165f, -0.223093f, 0.077933f, -0.037350f, 0.264536f, 0.022193f, 0.032061f, -0.055184f, -0.220475f, -0.029472f, -0.006279f, -0.165923f, -0.000121f, 0.145494f, 0.119556f, -0.207897f, -0.205171f, -0.162180f, 0.076197f, -0.176809f, -0.100385f, 0.220716f, -0.033524f, 0.001103f, -0.088879f, -0.213029f, 0.065640f, 0.187609f, 0.279785f, 0.047955f, 0.163243f, -0.017984f, 0.200742f, 0.134599f, -0.077788f, 0.123204f, -0.252377f, -0.007802f, 0.179878f, -0.140344f, -0.247750f, -0.033136f, -0.101255f, 0.123960f, -0.216879f, -0.141686f, -0.115755f, -0.023308f, 0.075762f, -0.215881f, 0.092172f, -0.132799f, -0.047673f, -0.224927f, -0.008076f, -0.184130f, 0.029850f, -0.136576f, 0.225475f, 0.135956f, 0.091432f, -0.091279f, 0.185477f, -0.277763f, -0.101996f, 0.008419f, -0.173876f, -0.060317f, 0.216611f, -0.012677f, -0.143216f, 0.121186f, 0.156229f, -0.120211f, -0.106703f, 0.125255f, -0.047865f, -0.194421f, 0.208662f, 0.092339f, 0.045588f, -0.068808f, -0.177616f, 0.186858f, 0.142570f, 0.099563f, -0.231521f, 0.096056f, 0.103937f, -0.137018f, 0.087030f, 0.160038f, -0.222776f, -0.036294f, -0.031517f, -0.097974f, -0.209773f, 0.025664f, -0.086344f, -0.138614f, -0.156432f, 0.129082f, -0.038653f, -0.062891f, -0.133314f, 0.066063f, 0.197753f, -0.165169f, 0.464343f, -0.050259f, 0.221465f, 0.125453f, -0.015608f, -0.182357f, -0.173249f, -0.061460f, 0.150517f, 0.105316f, 0.114620f, 0.118646f, -0.134275f, -0.150839f, 0.164932f, 0.131729f, -0.013931f, -0.090103f, 0.229587f, -0.020238f, 0.244115f, 0.048090f, -0.148002f, -0.151851f, 0.013070f, 0.021501f, -0.212017f, 0.080102f, -0.072572f, 0.201606f, 0.196550f, 0.073315f, 0.210718f, -0.084282f, -0.212955f, 0.047396f, -0.196867f, -0.161604f, -0.226541f, -0.230019f, -0.018272f, -0.233154f, -0.159468f, -0.070038f, 0.195247f, -0.216762f, 0.182461f, -0.142099f, -0.120006f, 0.130847f, -0.122039f, -0.027231f, -0.235319f, 0.104048f, 0.171667f, -0.059600f, 0.394624f, 0.087960f, -0.079757f, 0.143320f, -0.202864f, 0.101389f, 0.196666f, 0.166279f, 0.034024f, -0.131915f, 0.221633f, -0.112203f, 0.074918f, -0.115553f, 0.031073f, -0.173701f, 0.179440f, -0.277398f, -0.030478f, 0.082810f, -0.154027f, -0.120780f, 0.075706f, -0.140949f, -0.328238f, 0.165100f, 0.117422f, -0.114250f, 0.449878f, -0.128866f, 0.179413f, 0.013290f, -0.206331f, -0.128931f, 0.087670f, 0.247163f, 0.215316f, 0.080024f, -0.156668f, 0.162844f, -0.160216f, -0.022265f, 0.121536f, 0.187668f, -0.107313f, 0.149440f, -0.047885f, 0.045733f, 0.221099f, 0.056014f, 0.114272f, 0.125157f, -0.097086f, -0.183292f, -0.032604f, 0.103938f, 0.012196f, -0.049712f, -0.298345f, -0.048706f, -0.115046f, 0.100314f, 0.204008f, 0.121952f, 0.261270f, -0.079652f, -0.082399f, -0.165145f, -0.170254f, 0.130750f, 0.107942f, 0.142645f, -0.187391f, -0.190001f, -0.125962f, -0.211715f, 0.182763f, -0.082058f, -0.207812f, 0.139700f, -0.314704f, -0.252684f, -0.208568f, 0.126451f, 0.017446f, 0.148510f, -0.210303f, -0.149396f, -0.167581f, 0.067413f, -0.229653f, -0.103725f, -0.130655f, -0.234258f, 0.041081f, 0.057728f, -0.072446f, 0.307313f, -0.007146f, 0.046688f, 0.059865f, -0.000484f, -0.147059f, 0.109387f, -0.225560f, 0.064925f, 0.004008f, -0.240003f, -0.424452f, 0.031178f, 0.003291f, -0.171129f, 0.077185f, 0.055780f, 0.183340f, -0.015303f, 0.210465f, -0.156083f, -0.161644f, 0.101132f, -0.190298f, -0.160692f, 0.071766f, 0.076217f, -0.108939f, 0.041410f, -0.001291f, -0.061567f, 0.063455f, -0.221866f, -0.068233f, 0.066482f, -0.194246f, 0.251668f, 0.029291f, -0.175122f, 0.201346f, 0.082101f, 0.135302f, -0.171996f, 0.043049f, 0.107612f, -0.170034f, -0.161391f, 0.033229f, 0.084375f, 0.160289f, -0.079199f, 0.060225f, -0.001416f, -0.096535f, 0.184697f, -0.364399f, 0.190000f, -0.107015f, -0.006194f, -0.285834f, -0.009346f, 0.036056f, -0.234824f, 0.557452f, -0.167451f, 0.162147f, -0.182885f, -0.077909f, 0.233341f, -0.165140f, 0.202786f, 0.193271f, -0.157860f, 0.049136f, -0.192069f, 0.137085f, 0.074603f, 0.248751f, 0.264123f, 0.250953f, -0.227187f, -0.020761f, 0.236191f, -0.171237f, 0.057145f, 0.252506f, 0.092850f, -0.527553f, 0.165178f, -0.307509f, -0.180699f, 0.351159f, 0.162060f, -0.034333f, 0.266300f, 0.152967f, 0.121816f, 0.022698f, -0.066429f, 0.164748f, -0.155782f, 0.151746f, 0.266266f, 0.043120f, -0.119842f, 0.204272f, -0.100445f, -0.048381f, 0.285801f, -0.020992f, 0.031450f, -0.094928f, 0.095078f, -0.162481f, 0.251669f, -0.032552f, -0.020378f, -0.033059f, -0.169789f, -0.159856f, 0.008134f, 0.069262f, -0.182653f, -0.137920f, -0.003740f, -0.160083f, 0.026205f, -0.254482f, 0.205259f, -0.042076f, 0.070594f, 0.064785f, 0.143862f, 0.059444f, -0.123560f, -0.080559f, 0.094814f, -0.026275f, -0.070163f, -0.300146f, 0.203626f, -0.137323f, 0.008410f, -0.033372f, -0.100938f, -0.150386f, 0.047004f, -0.075981f, 0.083911f, 0.187617f, -0.232664f, 0.184321f, 0.037803f, 0.151443f, -0.111130f, -0.023178f, 0.140276f, -0.086306f, 0.159341f, -0.115517f, -0.138106f, 0.167872f, 0.005696f, -0.149612f, 0.122918f, -0.031028f, 0.035723f, -0.288754f, 0.150717f, -0.269552f, -0.160301f, 0.148512f, -0.153814f, 0.010917f, -0.168409f, -0.211763f, -0.184108f, -0.160768f, 0.084552f, -0.257241f, -0.200421f, 0.200923f, 0.159910f, 0.102929f, 0.214246f, 0.133658f, 0.024496f, 0.048991f, -0.014535f, 0.007522f, -0.269827f, 0.202021f, -0.188354f, 0.137024f, 0.091617f, 0.202520f, -0.279048f, -0.192337f, 0.157190f, -0.048930f, -0.130302f, 0.103349f, -0.093393f, 0.126368f, -0.169116f, 0.020974f, -0.088561f, 0.070727f, -0.033203f, -0.105778f, 0.280672f, -0.204412f, -0.125707f, -0.145756f, -0.050980f, -0.219609f, 0.127544f, 0.156141f, 0.010069f, 0.049070f, 0.142827f, 0.242301f, 0.081570f, 0.228201f, 0.024201f, 0.261245f, 0.175208f, -0.150911f, 0.125746f, -0.109494f, -0.095982f, -0.188894f, 0.046613f, 0.068609f, -0.220563f, 0.046380f, 0.247468f, 0.228986f, -0.169674f, 0.094504f, -0.007220f, 0.056492f, 0.213734f, 0.217962f, -0.001335f, -0.066769f, 0.002247f, -0.171680f, 0.222340f, -0.317227f, -0.013895f, 0.458433f, -0.199522f, 0.000141f, -0.205862f, 0.036242f, 0.218541f, 0.210564f, -0.052080f, 0.086142f, 0.232020f, 0.179834f, 0.122529f, 0.056747f, -0.000763f, -0.057918f, -0.170950f, -0.170030f, -0.158673f, -0.159005f, 0.017388f, -0.034048f, -0.131328f, 0.239824f, -0.012844f, -0.181582f, -0.148517f, 0.141834f, -0.132535f };
+static const float prediction_next_power_gen_layer_4_biases[80] = { -0.021600f, 0.247674f, 0.017485f, 0.194143f, 0.198612f, 0.247382f, -0.089134f, 0.234998f, -0.038623f, 0.202678f, 0.232916f, 0.237441f, 0.221252f, -0.033757f, 0.122938f, -0.072734f, 0.207362f, 0.228337f, 0.003543f, 0.240097f, 0.244331f, -0.005031f, 0.005559f, 0.231704f, 0.123975f, 0.194782f, -0.083205f, 0.226034f, 0.187034f, 0.239039f, -0.025377f, 0.017445f, -0.000425f, -0.005559f, 0.215821f, 0.173422f, -0.018774f, -0.025363f, 0.036727f, 0.182280f, -0.008712f, 0.218325f, -0.035811f, 0.245066f, -0.028336f, 0.214301f, -0.025368f, 0.132803f, 0.194119f, -0.053427f, 0.223483f, 0.173631f, -0.039231f, 0.231643f, -0.016439f, -0.057617f, 0.202092f, 0.220955f, 0.171652f, -0.045924f, -0.034652f, 0.180408f, -0.014066f, 0.224533f, -0.013879f, 0.237703f, -0.011621f, 0.182905f, -0.004810f, 0.130836f, 0.251373f, -0.005265f, -0.013845f, 0.212506f, 0.200500f, -0.036299f, 0.219599f, 0.063734f, 0.218560f, 0.213247f };
+static const float prediction_next_power_gen_layer_4_weights[2560] = { 0.092487f, -0.097320f, 0.277394f, -0.203564f, 0.075110f, -0.233807f, -0.035579f, 0.049008f, 0.258267f, -0.038927f, 0.133128f, 0.197667f, 0.071820f, -0.129222f, -0.026511f, -0.008184f, 0.066189f, 0.040071f, 0.027263f, 0.214999f, -0.232411f, 0.056078f, 0.109264f, 0.126881f, 0.121407f, 0.092785f, 0.158027f, 0.058239f, 0.100146f, 0.065816f, -0.110682f, -0.179576f, -0.178668f, 0.098185f, 0.211040f, 0.199287f, 0.020187f, 0.208188f, 0.011879f, 0.192107f, 0.023299f, 0.007123f, 0.034926f, -0.273143f, 0.071119f, -0.162184f, 0.148335f, -0.110712f, 0.164281f, -0.054155f, 0.117944f, 0.022550f, 0.020384f, 0.148331f, 0.125328f, 0.251064f, -0.053509f, -0.040192f, -0.100315f, -0.136654f, -0.007627f, 0.079048f, -0.182309f, -0.044942f, -0.155231f, 0.151210f, 0.165677f, -0.167464f, 0.054098f, -0.047837f, -0.151191f, 0.192836f, 0.210128f, -0.098723f, 0.215829f, -0.056527f, -0.113606f, 0.142742f, 0.067828f, 0.007645f, 0.000890f, 0.111232f, -0.113613f, 0.229680f, -0.194984f, -0.015459f, -0.180382f, 0.222587f, 0.097425f, 0.226791f, -0.098083f, -0.157364f, -0.063257f, -0.067644f, 0.041795f, 0.119357f, -0.201217f, 0.068639f, 0.151765f, 0.170400f, 0.219895f, -0.033926f, 0.216658f, -0.004170f, 0.150526f, -0.192636f, 0.223808f, 0.023794f, -0.072458f, 0.111989f, 0.160429f, -0.205578f, -0.194137f, 0.124916f, -0.180034f, 0.169458f, -0.000212f, -0.100113f, -0.175038f, 0.115413f, 0.211421f, 0.083111f, -0.171596f, -0.187029f, -0.013158f, 0.108078f, -0.065358f, -0.187399f, -0.023531f, -0.114700f, 0.254883f, 0.113889f, -0.070797f, -0.002182f, 0.207154f, -0.090658f, -0.001763f, -0.056056f, 0.067661f, -0.053643f, -0.119312f, -0.134146f, 0.156702f, -0.192382f, -0.030966f, 0.187986f, 0.110287f, 0.086606f, -0.017912f, 0.053678f, 0.018321f, -0.199396f, 0.119183f, 0.081475f, 0.051127f, -0.011882f, 0.252680f, 0.164262f, -0.114310f, -0.114944f, 0.022752f, -0.170913f, -0.036320f, -0.125900f, -0.023234f, 0.093427f, 0.038327f, -0.233449f, -0.319823f, -0.071420f, 0.162602f, -0.424976f, -0.201311f, 0.096280f, -0.188456f, 0.139273f, 0.178804f, 0.044718f, 0.094479f, 0.020710f, 0.223361f, -0.112025f, -0.032337f, 0.225665f, 0.095535f, 0.082343f, 0.300959f, -0.073932f, -0.080136f, 0.006224f, 0.084018f, -0.081605f, 0.141031f, -0.078808f, -0.113276f, -0.003320f, -0.024796f, 0.117409f, 0.044925f, 0.137832f, 0.116355f, -0.097245f, -0.175049f, 0.064483f, 0.088421f, -0.131449f, -0.214057f, -0.246977f, 0.100101f, 0.120418f, 0.084298f, -0.070627f, 0.185873f, -0.227689f, -0.131432f, -0.026794f, 0.093821f, -0.130041f, -0.422579f, 0.085759f, 0.104510f, -0.085419f, -0.214742f, -0.187232f, -0.060209f, -0.011226f, -0.137447f, 0.249326f, 0.207404f, 0.037164f, 0.062646f, -0.222172f, -0.064717f, -0.082262f, 0.072401f, 0.108154f, 0.058657f, 0.154668f, -0.159997f, 0.251345f, -0.054527f, 0.222136f, 0.250757f, 0.084718f, 0.295406f, 0.175049f, -0.195585f, 0.048149f, 0.123798f, -0.193502f, -0.107568f, -0.123472f, -0.099816f, 0.256620f, 0.151290f, 0.059807f, -0.072730f, 0.190380f, 0.145354f, -0.226040f, -0.051334f, 0.014774f, 0.191290f, -0.085107f, 0.145294f, 0.109609f, 0.027461f, 0.017486f, 0.158984f, 0.007506f, -0.220088f, -0.234497f, 0.058041f, -0.223061f, -0.166317f, -0.189734f, -0.256029f, -0.144741f, -0.079702f, -0.056039f, -0.140763f, 0.099209f, -0.065205f, -0.119674f, -0.192168f, 0.077181f, -0.119388f, 0.128075f, -0.167864f, -0.241660f, 0.258862f, 0.053509f, -0.056780f, 0.205631f, 0.039976f, -0.102191f, 0.094637f, 0.216718f, -0.149812f, -0.023859f, -0.161089f, -0.208374f, 0.113122f, -0.254228f, 0.164814f, 0.209735f, 0.226868f, 0.052182f, 0.171852f, 0.008971f, 0.085078f, 0.181945f, 0.007080f, -0.136458f, 0.022516f, -0.259148f, -0.181398f, -0.083346f, 0.020567f, 0.014531f, 0.151848f, -0.046628f, 0.175814f, 0.066165f, 0.019527f, 0.052148f, 0.036456f, -0.099049f, -0.006918f, 0.250031f, 0.162144f, -0.045436f, 0.192597f, -0.022193f, 0.144181f, 0.204775f, 0.045183f, -0.180388f, 0.018486f, -0.134450f, 0.069054f, 0.212874f, -0.116252f, 0.019453f, 0.177725f, 0.219780f, 0.119663f, 0.189839f, 0.206937f, 0.020021f, -0.014239f, 0.041301f, 0.217059f, -0.160256f, -0.121735f, 0.217499f, -0.131318f, 0.048017f, -0.116620f, 0.082466f, 0.216333f, 0.024736f, -0.153511f, -0.042995f, -0.095480f, 0.039770f, 0.153054f, 0.050105f, 0.258719f, -0.154612f, 0.136888f, -0.118213f, 0.077859f, -0.033812f, -0.211518f, 0.101488f, -0.053888f, -0.062701f, 0.131168f, -0.049858f, -0.137016f, 0.265286f, -0.103753f, 0.006544f, -0.030865f, 0.167803f, -0.044148f, 0.103581f, -0.128595f, -0.089617f, 0.158168f, -0.196040f, 0.177480f, 0.124241f, 0.224323f, 0.075455f, -0.201966f, -0.052180f, 0.111410f, 0.131279f, 0.250081f, 0.073425f, -0.058646f, -0.123485f, 0.223567f, 0.107233f, -0.202606f, 0.052792f, 0.242820f, 0.163227f, -0.135853f, -0.157893f, 0.050015f, 0.160141f, -0.062160f, 0.233755f, 0.134159f, -0.114807f, -0.019803f, -0.153994f, 0.071432f, 0.093277f, -0.085394f, -0.049606f, 0.100543f, -0.173544f, 0.099301f, -0.125845f, 0.187945f, 0.113314f, 0.014523f, -0.128260f, -0.138116f, 0.218077f, -0.106313f, 0.174600f, -0.172043f, -0.132861f, 0.162375f, -0.040903f, 0.050002f, -0.004185f, -0.120532f, 0.194261f, 0.077265f, -0.058316f, 0.067297f, 0.119713f, 0.198625f, 0.142251f, -0.017496f, 0.095359f, -0.209000f, 0.163004f, 0.072409f, -0.031956f, -0.199492f, 0.112260f, 0.003872f, -0.000349f, -0.119857f, 0.200245f, 0.184489f, 0.006060f, -0.127750f, -0.103146f, 0.071243f, -0.024841f, -0.141317f, 0.149552f, -0.182530f, -0.148862f, -0.141217f, -0.128021f, 0.141785f, 0.140648f, -0.159154f, -0.083701f, 0.035227f, 0.161053f, 0.059031f, -0.156147f, -0.001240f, -0.016856f, -0.104586f, -0.058607f, 0.040765f, 0.180870f, 0.306330f, -0.009439f, 0.176443f, 0.082420f, -0.230933f, -0.059814f, -0.107509f, 0.141251f, 0.221955f, 0.078393f, -0.050547f, -0.014314f, 0.160614f, 0.158987f, -0.096800f, -0.073028f, -0.225621f, -0.223808f, 0.231979f, -0.000250f, -0.097726f, -0.050721f, -0.223978f, -0.126541f, -0.058579f, 0.174413f, -0.069123f, 0.138458f, -0.216428f, 0.211605f, 0.046891f, -0.321767f, -0.009753f, -0.013100f, 0.052137f, -0.233379f, -0.127023f, 0.010478f, 0.141227f, 0.187383f, 0.077838f, -0.085595f, -0.202627f, 0.227451f, -0.032736f, 0.128695f, 0.075843f, -0.191099f, 0.235964f, -0.136676f, -0.162251f, -0.140385f, 0.053476f, 0.208688f, 0.089006f, 0.229232f, 0.080368f, 0.091006f, 0.083079f, -0.140478f, 0.108020f, 0.024519f, 0.258519f, -0.279756f, 0.057131f, -0.147354f, 0.042625f, -0.191616f, -0.086244f, 0.046812f, 0.080284f, 0.147917f, 0.119526f, -0.108112f, 0.142220f, -0.011318f, 0.252978f, -0.111316f, -0.246937f, 0.052881f, 0.045409f, -0.072940f, -0.227001f, -0.019057f, 0.109074f, -0.038281f, 0.135219f, 0.091105f, -0.063866f, 0.185910f, 0.063644f, -0.225621f, 0.060114f, 0.060257f, 0.196527f, 0.156786f, 0.014905f, 0.035047f, 0.017117f, -0.046418f, -0.192165f, -0.163341f, 0.154076f, -0.032197f, -0.198653f, 0.201920f, -0.036651f, 0.205378f, -0.033113f, -0.180948f, -0.104472f, 0.057170f, 0.159591f, 0.201636f, -0.150878f, 0.083864f, 0.011388f, -0.063199f, 0.037525f, -0.019522f, 0.247430f, -0.149041f, 0.153813f, 0.289992f, 0.252404f, 0.231344f, 0.138354f, -0.154674f, -0.143643f, 0.008963f, -0.143784f, -0.180747f, 0.084657f, 0.139942f, -0.005348f, -0.060797f, 0.212886f, 0.241044f, 0.091940f, -0.117825f, 0.206200f, 0.086023f, 0.067230f, 0.144503f, -0.163886f, -0.104408f, -0.168400f, 0.013184f, -0.015226f, 0.146859f, 0.052728f, 0.019684f, -0.116917f, 0.049783f, 0.211814f, 0.172840f, 0.010825f, 0.169442f, 0.007773f, 0.046964f, -0.183701f, 0.005192f, 0.206383f, -0.083943f, -0.141696f, 0.049302f, 0.279370f, 0.002980f, 0.135309f, 0.046284f, 0.178516f, -0.051604f, 0.176776f, 0.156977f, -0.009558f, 0.218630f, 0.276212f, -0.136424f, 0.158087f, 0.036628f, 0.259795f, 0.111890f, 0.021890f, -0.007070f, 0.029785f, -0.049597f, -0.184888f, 0.047251f, -0.180039f, -0.068947f, -0.108046f, -0.174559f, -0.108477f, 0.095537f, -0.102211f, 0.067178f, 0.158462f, -0.132568f, 0.185361f, 0.144302f, 0.180969f, -0.063836f, 0.046127f, 0.192049f, 0.050012f, 0.095678f, -0.178361f, -0.115973f, -0.108962f, -0.213142f, 0.145897f, 0.097217f, 0.046884f, -0.101676f, 0.041691f, -0.142117f, -0.176328f, 0.129545f, 0.136725f, -0.185104f, -0.211608f, 0.170185f, -0.200427f, 0.045427f, 0.148808f, -0.133694f, 0.101171f, -0.092400f, -0.213952f, -0.076129f, 0.159910f, 0.163767f, 0.069225f, -0.222668f, 0.224091f, -0.118964f, -0.087762f, -0.028341f, -0.150780f, -0.079953f, 0.073245f, 0.110532f, -0.021882f, -0.211251f, -0.196075f, 0.118210f, -0.136473f, -0.023394f, 0.080526f, 0.013585f, 0.076897f, -0.135909f, 0.124720f, 0.159055f, 0.141985f, -0.324069f, -0.101195f, 0.071849f, 0.003459f, -0.172609f, 0.092466f, 0.238469f, 0.070007f, -0.145890f, 0.052663f, 0.150162f, 0.241120f, 0.196241f, -0.037447f, -0.128125f, -0.095536f, -0.067273f, 0.115974f, 0.065379f, 0.226864f, 0.244141f, 0.067431f, 0.277104f, -0.042636f, -0.152224f, 0.150300f, 0.055434f, 0.104470f, -0.209578f, -0.018637f, 0.063922f, 0.084102f, -0.130662f, 0.017632f, -0.099617f, -0.137394f, -0.074544f, -0.229681f, 0.128171f, 0.097551f, -0.241290f, -0.023982f, 0.114955f, 0.114104f, 0.036502f, -0.200073f, -0.044353f, 0.054108f, 0.039424f, 0.104539f, -0.205635f, -0.156274f, -0.040255f, -0.105728f, -0.124280f, 0.151637f, 0.052391f, 0.065669f, -0.098662f, -0.013634f, -0.054651f, 0.059278f, 0.128156f, 0.102819f, 0.053468f, -0.183287f, 0.163644f, -0.124017f, -0.304544f, 0.080354f, 0.118770f, -0.180588f, -0.141754f, -0.026966f, 0.183352f, 0.237823f, 0.135587f, 0.204494f, -0.150455f, -0.136437f, 0.047965f, 0.048682f, 0.198624f, -0.064173f, 0.065507f, -0.064155f, 0.066043f, 0.117367f, 0.035013f, 0.193506f, -0.265287f, -0.084584f, 0.045136f, -0.031206f, -0.028366f, -0.018830f, 0.031997f, -0.093400f, -0.140443f, 0.034444f, 0.211648f, -0.006952f, 0.146810f, 0.055531f, 0.205833f, -0.170864f, -0.167233f, -0.091441f, 0.189262f, 0.005277f, 0.052361f, -0.230417f, -0.016104f, -0.231950f, 0.153798f, 0.199235f, -0.004447f, 0.167283f, 0.208493f, 0.140588f, 0.064950f, 0.001973f, 0.019203f, 0.302631f, 0.178415f, 0.174829f, -0.044937f, 0.046647f, -0.207255f, 0.057504f, -0.101896f, 0.179389f, -0.197709f, 0.010410f, 0.258776f, 0.222658f, 0.002933f, -0.156894f, 0.033912f, -0.092526f, -0.195622f, -0.064021f, -0.046632f, 0.042618f, 0.140880f, 0.253686f, 0.131552f, -0.145821f, 0.077157f, 0.263081f, 0.183232f, -0.152554f, 0.276592f, 0.061670f, -0.171550f, -0.032611f, 0.065248f, -0.118697f, 0.197507f, 0.036503f, 0.167450f, 0.070493f, 0.098825f, 0.086564f, -0.228945f, -0.119448f, 0.103839f, 0.104583f, 0.239826f, 0.108914f, -0.127392f, -0.140770f, 0.054861f, -0.176149f, 0.256318f, 0.087959f, -0.039021f, 0.241974f, -0.183737f, -0.101679f, 0.000066f, 0.179127f, 0.197313f, 0.056817f, 0.073257f, -0.007309f, 0.135432f, 0.024628f, -0.027177f, -0.150400f, 0.047780f, 0.161612f, -0.099796f, -0.145787f, 0.073510f, -0.191574f, -0.273447f, 0.118900f, 0.263181f, -0.133119f, 0.190522f, -0.176838f, 0.008710f, -0.133158f, -0.087293f, 0.127965f, 0.259640f, -0.142296f, -0.036896f, 0.107504f, 0.185525f, -0.055008f, 0.079840f, -0.098505f, 0.209514f, -0.131533f, -0.012718f, 0.151690f, 0.006883f, -0.105243f, -0.006643f, -0.048281f, -0.042955f, -0.002798f, -0.129189f, -0.030407f, -0.122630f, 0.006959f, -0.011434f, -0.221635f, -0.095585f, 0.132141f, -0.182875f, 0.097600f, -0.180295f, -0.010837f, -0.233568f, -0.199637f, -0.061824f, 0.083437f, 0.034047f, 0.026609f, -0.179778f, -0.112887f, -0.095882f, 0.033877f, 0.132641f, 0.195923f, -0.200796f, -0.009220f, -0.021036f, -0.224505f, -0.093617f, -0.059777f, -0.134038f, -0.100905f, -0.074960f, 0.069884f, -0.193369f, 0.118523f, -0.247651f, 0.119377f, -0.026706f, 0.060050f, -0.136773f, -0.176122f, 0.185927f, 0.028208f, -0.145104f, 0.025776f, 0.145273f, 0.190683f, -0.235416f, -0.214294f, -0.149314f, 0.142981f, -0.175319f, 0.040614f, 0.144773f, -0.106672f, 0.153163f, 0.178949f, -0.073949f, 0.018379f, -0.210525f, 0.103906f, 0.145711f, -0.040611f, 0.114041f, 0.097521f, -0.200857f, -0.053177f, -0.145820f, 0.228022f, 0.015586f, -0.139050f, -0.035525f, -0.062589f, 0.139088f, -0.090400f, -0.119681f, -0.163393f, -0.061446f, -0.115801f, -0.188854f, -0.226767f, 0.087395f, -0.133151f, 0.028010f, 0.211327f, 0.179430f, 0.152081f, 0.233145f, -0.029888f, -0.146774f, -0.059401f, -0.221157f, -0.212962f, -0.109878f, -0.044260f, -0.151419f, -0.113938f, -0.085901f, -0.153040f, -0.165006f, 0.062892f, -0.222360f, 0.001108f, -0.145465f, 0.219325f, 0.001287f, 0.040356f, -0.083579f, -0.056478f, 0.137985f, -0.112617f, 0.199594f, -0.022991f, 0.162192f, 0.163187f, -0.138807f, 0.070064f, 0.139340f, 0.075234f, 0.024891f, -0.152219f, 0.086340f, 0.040380f, 0.165508f, 0.116172f, 0.135779f, 0.210370f, 0.127254f, -0.123100f, 0.002296f, 0.099375f, -0.163709f, -0.061759f, -0.145855f, -0.195319f, 0.218302f, 0.095308f, 0.249311f, -0.126333f, 0.175366f, 0.269396f, 0.238631f, -0.022666f, 0.217112f, 0.114278f, -0.105298f, -0.069713f, 0.064117f, 0.185973f, 0.125014f, 0.163497f, 0.227414f, -0.148133f, -0.069038f, -0.057339f, 0.193543f, 0.054646f, 0.025135f, 0.089771f, -0.053544f, -0.088416f, 0.227739f, 0.209918f, 0.043411f, 0.095127f, 0.221553f, 0.064849f, 0.178329f, 0.127322f, -0.218967f, 0.033296f, -0.140404f, -0.175966f, -0.063313f, 0.061268f, -0.206595f, 0.192902f, 0.060536f, 0.125877f, -0.060739f, -0.016810f, -0.111352f, -0.147682f, -0.040505f, -0.206764f, -0.127311f, -0.123648f, 0.134984f, -0.206392f, 0.014173f, 0.033918f, 0.107338f, -0.235315f, -0.144720f, -0.009383f, 0.289759f, -0.086974f, -0.240706f, -0.130380f, 0.145436f, 0.113058f, -0.295908f, -0.223952f, 0.178419f, 0.146486f, -0.272960f, -0.152831f, -0.125519f, 0.009584f, -0.252631f, 0.045501f, -0.032203f, 0.010112f, 0.081297f, 0.076346f, 0.017347f, -0.124204f, -0.058543f, -0.007613f, -0.086646f, -0.108338f, 0.168697f, -0.218089f, 0.188303f, -0.078998f, -0.090994f, 0.116639f, 0.076525f, 0.023405f, -0.093840f, 0.145164f, -0.176074f, -0.155542f, -0.044480f, 0.017724f, -0.118746f, -0.146254f, 0.084296f, -0.228603f, -0.132038f, 0.145282f, 0.036075f, -0.116165f, 0.152614f, 0.174200f, -0.209887f, 0.004768f, 0.115475f, 0.176252f, -0.166179f, -0.298749f, -0.121362f, 0.203599f, 0.012840f, 0.198949f, -0.014530f, -0.064140f, 0.226097f, 0.224674f, 0.047615f, 0.230104f, -0.231582f, -0.146480f, 0.155038f, 0.116571f, 0.161845f, -0.183601f, 0.097579f, -0.198721f, 0.068337f, 0.045208f, 0.075029f, -0.124043f, 0.152621f, 0.180528f, -0.216057f, 0.277230f, -0.031349f, -0.061459f, -0.068875f, -0.030574f, 0.239165f, 0.284443f, 0.207862f, -0.112375f, -0.172145f, -0.002840f, 0.172503f, 0.163339f, -0.166106f, -0.159703f, 0.134853f, 0.081902f, -0.183153f, 0.173059f, -0.135286f, -0.098147f, -0.094783f, 0.146032f, -0.011479f, -0.025948f, -0.104877f, 0.215465f, 0.120976f, -0.129764f, 0.117816f, 0.106052f, -0.106883f, -0.093438f, -0.083956f, -0.183537f, 0.145675f, -0.181122f, 0.181905f, -0.076627f, -0.024550f, 0.078484f, -0.134083f, 0.107203f, 0.216071f, -0.225438f, -0.025413f, -0.216743f, -0.028954f, -0.150126f, -0.049010f, -0.133871f, -0.098119f, 0.144933f, -0.223343f, 0.171449f, -0.006319f, -0.183218f, -0.102631f, -0.231478f, 0.001710f, 0.050247f, 0.049695f, -0.169355f, 0.127709f, 0.177422f, -0.234643f, 0.202700f, 0.079200f, 0.144092f, -0.161756f, 0.153721f, -0.073798f, 0.232493f, 0.044108f, -0.118091f, -0.044245f, -0.004335f, -0.082339f, 0.073114f, -0.249448f, 0.019869f, 0.177426f, 0.024302f, -0.189238f, 0.080949f, 0.258904f, 0.238755f, -0.041016f, 0.074858f, 0.037691f, -0.153581f, -0.150639f, 0.235514f, -0.017148f, 0.145134f, 0.137173f, 0.246077f, 0.199557f, 0.023913f, -0.180525f, 0.040980f, 0.030318f, -0.007840f, -0.142163f, 0.137660f, 0.045683f, -0.211308f, -0.091485f, -0.216913f, 0.105369f, 0.111307f, -0.024800f, 0.020170f, -0.166953f, 0.157999f, -0.046105f, -0.119821f, 0.084647f, 0.129412f, 0.118663f, -0.120519f, 0.099526f, 0.106626f, 0.095782f, 0.163748f, -0.151231f, 0.210994f, -0.159741f, -0.208961f, -0.034738f, -0.050292f, -0.032511f, 0.127039f, -0.063449f, 0.059958f, 0.029621f, -0.170772f, -0.115522f, -0.136194f, 0.157643f, -0.195523f, 0.168632f, -0.193455f, 0.033454f, 0.163036f, 0.112763f, 0.262792f, -0.151179f, 0.212389f, -0.053275f, 0.209227f, 0.039501f, 0.122917f, 0.162156f, -0.108620f, 0.239597f, 0.152255f, -0.076480f, -0.204173f, 0.255440f, 0.132949f, -0.136250f, -0.168988f, 0.193393f, -0.240566f, 0.112824f, 0.090208f, 0.082467f, 0.174923f, -0.006955f, 0.058158f, 0.221067f, -0.159400f, -0.042583f, 0.112626f, 0.190957f, 0.227986f, -0.150199f, 0.169570f, -0.105194f, 0.128878f, -0.013201f, 0.076774f, -0.082326f, 0.098574f, -0.108237f, 0.043482f, 0.128599f, -0.022506f, -0.058386f, -0.222952f, -0.213117f, 0.119883f, -0.230380f, 0.176977f, -0.233144f, 0.042260f, 0.108341f, -0.033878f, 0.131215f, 0.062794f, 0.170516f, 0.261038f, -0.004620f, 0.125595f, 0.086053f, 0.168621f, 0.076297f, -0.001220f, -0.111998f, 0.054975f, -0.058077f, 0.008124f, -0.008056f, 0.122959f, 0.030056f, -0.026656f, 0.100155f, 0.216168f, -0.133691f, 0.045532f, -0.021971f, 0.012404f, -0.006298f, -0.156237f, 0.149339f, 0.213493f, -0.058759f, 0.093158f, -0.107012f, 0.090779f, 0.031029f, -0.167383f, -0.080905f, -0.163061f, 0.040996f, -0.215861f, -0.111526f, -0.098913f, -0.125079f, -0.030702f, -0.053386f, -0.210772f, 0.189132f, -0.024064f, 0.077225f, 0.210962f, 0.102300f, 0.046006f, -0.137482f, 0.129890f, 0.101864f, -0.146352f, 0.155416f, -0.213016f, -0.002593f, -0.080358f, -0.039542f, 0.171094f, 0.054095f, -0.096093f, -0.058537f, 0.152399f, 0.211061f, 0.209966f, -0.099090f, 0.033622f, 0.036942f, -0.061131f, 0.040175f, -0.048585f, -0.292508f, -0.070993f, 0.039816f, -0.149990f, -0.068840f, 0.196906f, -0.044884f, -0.027812f, 0.055391f, 0.059596f, -0.092868f, -0.216398f, 0.154423f, -0.137819f, -0.030314f, 0.049165f, 0.108053f, 0.131042f, 0.210656f, 0.220041f, 0.037911f, -0.065605f, 0.054588f, 0.256057f, 0.032842f, -0.211603f, -0.034345f, -0.024776f, 0.175551f, 0.068990f, 0.140374f, -0.098168f, -0.276573f, 0.175420f, -0.099601f, 0.123672f, 0.168519f, -0.201112f, 0.032263f, -0.015422f, 0.176382f, 0.094468f, 0.020031f, 0.111353f, -0.151282f, 0.219337f, 0.165682f, -0.085680f, 0.102274f, 0.272357f, -0.070650f, -0.089835f, 0.190076f, 0.033295f, 0.019209f, 0.100936f, -0.131609f, -0.138551f, -0.241140f, -0.160670f, 0.088112f, 0.024176f, -0.169040f, -0.085508f, 0.067371f, 0.064185f, 0.159082f, -0.117100f, -0.239181f, 0.032249f, 0.042802f, -0.063176f, 0.170853f, 0.023238f, 0.109687f, -0.022560f, 0.145413f, 0.086086f, -0.040302f, 0.137124f, 0.104571f, -0.027027f, 0.057140f, -0.117446f, 0.082286f, 0.073526f, 0.206474f, -0.073863f, 0.276193f, -0.183896f, -0.052730f, 0.069375f, 0.147625f, -0.071517f, -0.172070f, -0.129116f, -0.317027f, 0.039527f, -0.152123f, -0.087874f, -0.137847f, -0.051392f, -0.158434f, 0.267890f, 0.160322f, 0.116346f, 0.028758f, 0.140733f, 0.202360f, -0.011148f, -0.145817f, 0.250695f, -0.033483f, 0.033274f, -0.026130f, -0.200423f, 0.136908f, -0.087931f, -0.008629f, 0.195991f, -0.080572f, -0.158199f, 0.218964f, 0.201643f, -0.106772f, 0.124499f, -0.165792f, 0.002634f, -0.010469f, -0.008824f, 0.174523f, -0.101813f, 0.141039f, 0.014615f, 0.134037f, -0.203859f, 0.132161f, 0.037958f, 0.112871f, 0.117210f, 0.156118f, 0.232958f, 0.023849f, -0.048456f, 0.215810f, 0.246296f, 0.072210f, -0.027736f, -0.042669f, -0.031809f, 0.099811f, -0.187594f, 0.148174f, 0.167605f, 0.104498f, -0.006427f, -0.243621f, -0.209500f, 0.140334f, 0.083298f, -0.036543f, 0.210447f, 0.047607f, -0.066545f, 0.204068f, 0.077262f, 0.093079f, -0.201926f, -0.210056f, -0.247335f, -0.138745f, -0.227621f, 0.001084f, -0.025202f, -0.214402f, -0.201313f, -0.228577f, 0.058122f, 0.145370f, 0.103396f, -0.159922f, 0.261099f, 0.089586f, -0.121354f, 0.302019f, 0.205777f, 0.204914f, 0.275173f, -0.192778f, -0.040009f, 0.170512f, -0.050130f, -0.127381f, -0.201527f, 0.121747f, -0.149439f, -0.200791f, 0.219282f, 0.200034f, 0.278825f, -0.182793f, 0.195941f, 0.241567f, 0.164639f, -0.117038f, 0.286482f, -0.049059f, -0.127931f, -0.101248f, -0.007743f, -0.124182f, -0.074424f, 0.096604f, 0.182136f, 0.191368f, -0.011410f, 0.115324f, -0.179065f, -0.242460f, -0.204694f, -0.216463f, -0.161684f, 0.011412f, -0.206941f, -0.140896f, 0.154505f, -0.118001f, -0.046282f, 0.052905f, -0.027659f, 0.175728f, -0.237883f, -0.103889f, 0.086558f, -0.150632f, 0.035814f, 0.080057f, -0.039595f, 0.201581f, -0.024581f, -0.005798f, -0.047047f, -0.017524f, -0.161048f, 0.148820f, -0.323861f, -0.208746f, 0.158281f, 0.041012f, 0.137310f, -0.071076f, -0.103937f, 0.168187f, -0.160388f, -0.028069f, 0.215164f, 0.107496f, 0.197132f, 0.043167f, 0.127823f, 0.016891f, -0.032825f, -0.096538f, 0.029245f, 0.051257f, -0.342235f, -0.071538f, 0.283266f, -0.079024f, -0.150759f, -0.284320f, 0.262337f, 0.128035f, -0.338922f, -0.005980f, -0.139449f, -0.057710f, 0.162431f, -0.097371f, 0.213614f, 0.152543f, -0.160171f, 0.106933f, 0.240404f, -0.308761f, 0.041972f, -0.048266f, 0.003811f, -0.299474f, -0.255318f, 0.195546f, 0.190857f, 0.146609f, -0.011834f, -0.138154f, -0.186576f, 0.077115f, -0.134872f, 0.251574f, -0.094096f, -0.011826f, 0.108125f, 0.006800f, 0.137041f, 0.066342f, 0.072349f, 0.061911f, 0.080313f, 0.040533f, 0.228622f, -0.096963f, 0.138993f, 0.086674f, 0.119951f, 0.102725f, 0.253058f, -0.156155f, -0.100851f, 0.021700f, 0.172082f, 0.091676f, -0.155710f, -0.184411f, 0.107651f, 0.177731f, 0.117552f, 0.127293f, -0.059752f, -0.145802f, -0.094928f, 0.167453f, -0.200568f, -0.045563f, 0.266349f, -0.145031f, 0.035564f, -0.061109f, -0.123455f, -0.117833f, 0.049642f, 0.007587f, 0.153044f, 0.132838f, -0.008571f, 0.094527f, -0.049051f, -0.095412f, 0.092187f, 0.254351f, 0.169144f, -0.003497f, 0.058751f, -0.168815f, -0.065471f, 0.071760f, -0.189885f, 0.115672f, 0.090945f, -0.004730f, 0.236649f, 0.087302f, -0.201010f, 0.227498f, -0.076657f, -0.045262f, 0.107320f, -0.037352f, -0.156727f, 0.163287f, -0.011151f, 0.011682f, 0.208517f, 0.058667f, -0.161627f, -0.006856f, 0.109325f, 0.067501f, -0.007520f, -0.039963f, -0.094893f, -0.014834f, -0.053958f, -0.031533f, -0.144896f, 0.101258f, 0.023860f, -0.079909f, 0.085019f, 0.063306f, -0.024814f, -0.093310f, 0.118187f, -0.206045f, -0.004072f, -0.005587f, -0.183275f, 0.159798f, -0.089884f, -0.173805f, -0.121208f, -0.031674f, 0.008469f, 0.032559f, -0.224715f, 0.045604f, -0.299992f, 0.047635f, 0.014302f, -0.148724f, 0.163186f, 0.111753f, -0.109557f, 0.138712f, 0.062627f, -0.065513f, -0.140585f, 0.271446f, 0.216548f, 0.137556f, 0.001197f, 0.089098f, -0.080933f, -0.197795f, -0.098843f, -0.248925f, -0.104719f, -0.175645f, 0.116276f, -0.248043f, 0.137910f, 0.098152f, 0.057609f, 0.084073f, 0.120789f, -0.226974f, -0.196201f, 0.091876f, 0.089240f, 0.046745f, 0.271441f, -0.008985f, -0.205288f, -0.131056f, -0.142537f, 0.176454f, -0.100775f, 0.193358f, -0.072054f, -0.148361f, 0.174673f, -0.169223f, 0.236008f, 0.020051f, 0.004818f, 0.038433f, 0.155754f, 0.151826f, 0.240103f, 0.051288f, -0.063504f, 0.205531f, -0.104365f, -0.113927f, -0.018233f, 0.073322f, 0.045660f, 0.083099f, 0.075339f, 0.269042f, -0.085175f, 0.071903f, 0.210558f, -0.142727f, 0.102631f, -0.157670f, 0.158858f, 0.220387f, -0.167856f, -0.156059f, 0.211397f, 0.236167f, 0.073751f, -0.123626f, -0.137594f, -0.128754f, -0.000992f, 0.139284f, -0.190576f, 0.011629f, 0.012742f, -0.107308f, 0.150380f, -0.226995f, -0.040132f, -0.229902f, -0.040641f, -0.145511f, 0.237812f, 0.099345f, -0.089850f, -0.317860f, -0.067826f, 0.081947f, 0.149929f, 0.257551f, -0.215031f, -0.102377f, -0.026790f, -0.237270f, -0.051813f, 0.125307f, -0.011301f, -0.386838f, 0.028355f, 0.124306f, 0.083819f, 0.108770f, -0.138852f, 0.138188f, 0.019158f, -0.028558f, -0.019747f, 0.272293f, -0.209971f, 0.038450f, -0.069859f, -0.169757f, 0.217219f, 0.050490f, 0.209657f, 0.274489f, 0.016835f, -0.041670f, 0.005160f, -0.038612f, -0.034051f, -0.119001f, -0.110201f, -0.176472f, 0.150018f, 0.067141f, -0.022018f, 0.074565f, -0.221979f, -0.167868f, 0.036752f, -0.180146f, -0.111136f, -0.187755f, 0.052015f, -0.204857f, 0.084123f, 0.162550f, -0.167885f, -0.018078f, -0.137264f, 0.051182f, 0.061373f, 0.126151f, -0.312954f, -0.033896f, 0.209584f, -0.224668f, -0.217759f, 0.171408f, 0.242074f, 0.191041f, -0.052912f, 0.188437f, -0.037152f, 0.008023f, 0.019191f, 0.095736f, -0.043362f, 0.114756f, -0.166459f, -0.399980f, -0.093166f, 0.263621f, -0.181096f, 0.079509f, 0.181557f, -0.125308f, 0.201520f, 0.192108f, 0.110942f, 0.061087f, -0.199514f, 0.094200f, 0.267007f, 0.229234f, -0.097731f, -0.086348f, -0.182039f, 0.234202f, 0.038101f, -0.008546f, -0.057834f, -0.240664f, 0.080559f, -0.047734f, -0.145239f, 0.215793f, -0.162405f, -0.143594f, 0.023455f, -0.035285f, -0.023002f, 0.004646f, 0.162712f, 0.205521f, 0.100756f, 0.123833f, -0.226471f, 0.052483f, -0.059726f, 0.024189f, -0.054915f, 0.021830f, 0.016483f, 0.079326f, 0.082687f, -0.078295f, 0.159686f, 0.015934f, 0.004931f, -0.102880f, -0.154684f, -0.124808f, 0.114652f, -0.165750f, 0.281819f, 0.168380f, -0.187210f, -0.006014f, 0.097796f, 0.060890f, -0.191883f, 0.116629f, -0.195017f, -0.067259f, 0.142035f, 0.035477f, 0.049854f, 0.246641f, -0.070988f, 0.177379f, -0.073850f, -0.114614f, -0.120775f, 0.278118f, -0.012428f, 0.036226f, 0.062528f, 0.173537f, -0.186056f, 0.158890f, 0.234844f, -0.043362f, 0.245571f, -0.014137f, -0.151081f, 0.092594f, -0.194564f, 0.019457f, -0.137487f, 0.040789f, -0.199842f, 0.187249f, -0.067807f, 0.175919f, 0.135433f, -0.244077f, -0.037015f, -0.052992f, 0.055036f, 0.189062f, 0.170224f, -0.063598f, -0.167302f, 0.161359f, 0.174465f, -0.109578f, -0.234247f, -0.035973f, -0.095202f, 0.061443f, -0.155996f, -0.151038f, -0.150026f, 0.039369f, 0.185539f, 0.190467f, -0.025229f, -0.347894f, -0.131642f, 0.102344f, -0.218837f, -0.072575f, -0.074173f, 0.144072f, 0.292648f, 0.250327f, 0.019456f, 0.420947f, -0.070705f, -0.077816f, -0.004904f, -0.142423f, -0.028501f, -0.253744f, -0.232452f, -0.223592f, 0.082263f, 0.110471f, 0.144229f, 0.070715f, -0.248161f, -0.054687f, 0.120784f, -0.291249f, -0.126674f, 0.046307f, -0.062270f, -0.061720f, -0.082373f, 0.126018f, -0.040099f, -0.025527f, 0.116310f, 0.233018f, 0.152685f, -0.342214f, -0.208856f, -0.037177f, -0.120308f, -0.277206f, -0.229254f, 0.279422f, -0.104524f, 0.045198f, 0.129738f, 0.179545f, 0.261517f, -0.138523f, 0.221148f, 0.065025f, -0.256715f, 0.203134f, 0.187898f, -0.037743f, -0.140908f, 0.097703f, 0.189726f, 0.252072f, 0.067026f, -0.127530f, -0.124882f, -0.166038f, -0.219259f, -0.059446f, -0.208752f, -0.042667f, -0.023735f, -0.067799f, 0.182835f, 0.068440f, 0.168326f, 0.067469f, -0.165677f, -0.127563f, -0.323060f, 0.002674f, -0.253499f, -0.083696f, -0.229222f, 0.112081f, -0.317654f, -0.250937f, 0.335518f, 0.040481f, -0.348125f, -0.304800f, 0.329969f, -0.077247f, -0.159799f, -0.328502f, 0.149442f, -0.180352f, 0.184534f, 0.183201f, 0.242880f, -0.065410f, 0.198805f, 0.023051f, -0.074730f, -0.008153f, -0.207229f, -0.230239f, -0.090449f, -0.174290f, -0.219790f, -0.086472f, -0.154944f, -0.053218f, -0.132371f, -0.034015f, 0.167462f, -0.128546f, 0.097187f, -0.056151f, -0.055814f, 0.036887f, -0.133974f, -0.012846f, 0.131396f, -0.026466f, 0.186054f, -0.197056f, 0.012741f, 0.135430f, 0.184039f, 0.021364f, -0.125799f, -0.008227f, 0.119517f, -0.127296f, 0.219279f, -0.123677f, 0.219475f, 0.210029f, -0.099296f, 0.026488f, -0.194526f, 0.144490f, -0.133533f, 0.068527f, 0.059431f, 0.174585f, 0.231924f, -0.136085f, 0.248226f, -0.102226f, -0.084688f, 0.087062f, 0.008073f, -0.154467f, -0.156307f, -0.001467f, 0.005395f, 0.216820f, 0.225006f, -0.135454f, 0.047422f, 0.245280f, 0.064863f, 0.232006f, 0.076282f, -0.163614f, 0.122032f, -0.237757f, -0.180937f, 0.059336f, -0.094446f, -0.355782f, -0.164573f, 0.118239f, 0.202045f, -0.174829f, 0.086605f, -0.074447f, -0.102756f, 0.045510f, -0.141835f, 0.192260f, -0.082765f, 0.147516f, 0.154675f, 0.173051f, 0.109843f, -0.212890f, 0.140454f, -0.070795f, -0.153062f, 0.083325f, -0.141169f, 0.188630f, 0.074356f, -0.180548f, 0.127788f, -0.134627f, -0.090727f, 0.041469f, -0.152259f, 0.073839f, 0.215319f, -0.033930f, -0.124124f, 0.071521f, -0.218388f, 0.088727f, -0.190977f, 0.185921f, -0.003106f, 0.072237f, -0.099758f, -0.133358f, 0.056165f, 0.046599f, 0.025761f, 0.177674f, -0.034208f, 0.197359f, 0.062382f, -0.197666f, -0.218326f, -0.101027f, -0.025624f, -0.148964f, 0.250763f, 0.162699f, 0.187096f, -0.122489f, -0.072049f, -0.148856f, 0.227015f, 0.110138f, 0.212470f, -0.287094f, 0.178605f, 0.018619f, 0.255350f, -0.125930f, -0.064133f, 0.216425f, 0.185759f, -0.094856f, 0.048186f, 0.061357f, 0.000346f, 0.240866f, 0.056861f, 0.230131f, -0.165761f, 0.079693f, -0.126282f, -0.026602f, -0.007490f, 0.057354f, 0.171110f, -0.163149f, 0.073513f, 0.058052f, 0.032294f, 0.014425f, -0.060529f, -0.023427f, 0.299534f, 0.143142f, 0.138405f, 0.324913f, 0.044366f, -0.126335f, -0.229823f, -0.068784f, -0.026783f, -0.168232f, -0.062137f, 0.057497f, 0.082207f, -0.033198f, 0.397012f, 0.198425f, 0.112811f, -0.028109f, 0.121515f, -0.217114f, 0.111579f, -0.119845f, 0.008337f, -0.161271f, 0.005384f, -0.054465f, -0.110510f, -0.145256f, -0.207295f, 0.201962f, 0.252337f, -0.000187f, 0.253074f, 0.129749f, 0.044279f, -0.109240f, 0.144828f, 0.184730f, 0.124966f, 0.060681f, -0.059092f, 0.015260f, 0.089967f, 0.107976f, 0.159062f, 0.096435f, 0.125979f, 0.079638f, -0.141039f, -0.121107f, -0.009732f, -0.038491f, 0.233720f, 0.199366f, -0.066540f, 0.106872f, -0.124064f, 0.200476f, 0.274076f, 0.197729f, -0.018308f, 0.047140f, -0.039190f, -0.014270f, 0.175300f, 0.219830f, 0.173767f, 0.037504f, 0.139692f, -0.049016f, 0.166052f, -0.102796f, -0.162763f, -0.043469f, -0.183113f, 0.223475f, 0.248529f, -0.117351f, -0.195839f, 0.152218f, 0.195107f, -0.180060f, 0.053163f, -0.103971f, 0.022891f, 0.095114f, -0.192110f, 0.121750f };
+static const float prediction_next_power_gen_layer_5_biases[48] = { 0.197264f, 0.209058f, 0.177196f, -0.015117f, -0.013483f, 0.282062f, 0.257720f, -0.048415f, 0.319505f, 0.297237f, -0.025991f, 0.293271f, -0.011391f, -0.020802f, 0.403556f, -0.019356f, -0.022001f, -0.014891f, 0.299755f, -0.008702f, -0.007618f, -0.029617f, -0.006672f, 0.270267f, -0.022197f, -0.052068f, -0.011501f, 0.257595f, -0.019499f, -0.019715f, 0.214228f, -0.010885f, 0.167051f, -0.045285f, 0.248827f, 0.209476f, -0.018278f, 0.171971f, 0.262780f, 0.400136f, -0.038142f, 0.226181f, 0.276814f, 0.192218f, -0.009289f, 0.346045f, -0.011473f, 0.275328f };
+static const float prediction_next_power_gen_layer_5_weights[3840] = { 0.113376f, 0.154436f, 0.104488f, -0.013098f, 0.092100f, 0.089588f, -0.003489f, 0.251238f, -0.180335f, -0.114546f, 0.047866f, 0.042397f, 0.131455f, -0.116637f, 0.118744f, -0.196429f, -0.127731f, 0.208201f, 0.176711f, 0.096922f, -0.166758f, 0.096017f, 0.177331f, 0.077099f, 0.214682f, 0.027498f, -0.116462f, -0.105199f, -0.013037f, -0.025808f, -0.157788f, -0.089179f, -0.195004f, 0.113693f, -0.023064f, -0.002673f, 0.257436f, -0.140125f, -0.035677f, 0.161159f, 0.102784f, 0.009384f, -0.171858f, 0.138003f, 0.150386f, 0.010668f, 0.134437f, 0.087969f, -0.052900f, -0.160426f, 0.067259f, 0.159468f, -0.158291f, 0.165768f, -0.094834f, 0.032831f, 0.234778f, -0.010734f, 0.116549f, 0.227039f, 0.181037f, 0.131444f, 0.181628f, -0.055126f, 0.230310f, 0.007990f, -0.017130f, 0.226067f, -0.088785f, -0.031514f, 0.142058f, 0.003030f, -0.118115f, -0.139255f, 0.059667f, -0.037162f, 0.233736f, 0.029180f, -0.030155f, -0.034444f, -0.342387f, -0.131256f, -0.075712f, -0.079921f, -0.115960f, 0.064855f, 0.001569f, 0.192430f, 0.175600f, 0.084121f, -0.159717f, -0.040153f, 0.281807f, 0.098554f, 0.227664f, 0.024795f, 0.066096f, 0.003066f, -0.079469f, 0.084403f, 0.188830f, -0.125812f, -0.138365f, 0.117507f, -0.145965f, 0.033326f, -0.144728f, 0.208724f, -0.072719f, -0.058493f, 0.104659f, -0.095849f, -0.016025f, 0.099320f, -0.073017f, 0.008977f, -0.002057f, 0.003680f, -0.142326f, -0.112220f, -0.019277f, 0.157126f, 0.203459f, 0.013306f, -0.087628f, 0.023926f, 0.086342f, 0.223588f, -0.072914f, 0.079014f, 0.121762f, -0.045668f, -0.164393f, 0.127218f, 0.096897f, -0.129001f, 0.219936f, 0.009313f, 0.081575f, 0.102177f, -0.080784f, 0.050830f, -0.061861f, 0.277367f, 0.035919f, 0.153658f, 0.094149f, 0.229717f, 0.180142f, -0.268199f, 0.084669f, -0.336483f, -0.007026f, -0.043601f, 0.163131f, -0.156047f, -0.002391f, -0.190025f, 0.115870f, -0.053028f, -0.146559f, 0.188527f, 0.122895f, -0.164586f, 0.047710f, -0.071667f, -0.114880f, 0.027196f, -0.114375f, 0.046730f, 0.180671f, 0.214336f, 0.194642f, 0.259021f, -0.187557f, -0.208884f, -0.146962f, -0.206757f, 0.113034f, 0.140606f, -0.017304f, -0.068633f, -0.019767f, -0.015300f, -0.000367f, 0.211160f, -0.119460f, 0.122231f, 0.111707f, -0.028187f, -0.052118f, 0.129751f, 0.085680f, 0.210789f, 0.048718f, 0.002890f, 0.003254f, -0.132645f, 0.050227f, 0.153446f, -0.068777f, 0.191203f, 0.093014f, 0.028006f, -0.000711f, 0.128246f, -0.104375f, 0.134276f, 0.083531f, -0.045218f, 0.010504f, -0.188214f, 0.093443f, 0.125905f, -0.038741f, 0.109642f, -0.200145f, -0.182413f, -0.049420f, -0.146664f, 0.046080f, -0.166352f, 0.065355f, 0.081836f, 0.083510f, -0.093101f, -0.102238f, -0.156079f, -0.083569f, -0.454153f, -0.136098f, 0.281556f, 0.262264f, 0.130605f, -0.108934f, 0.199783f, 0.061936f, 0.093347f, 0.166605f, 0.121196f, 0.044768f, -0.122552f, 0.035452f, -0.031519f, 0.185115f, 0.203384f, 0.170639f, 0.003317f, -0.141191f, 0.088193f, -0.072587f, 0.145234f, -0.106935f, -0.052682f, 0.145469f, 0.081113f, -0.112247f, -0.127416f, 0.090342f, 0.028903f, -0.146038f, 0.128904f, -0.118479f, 0.013993f, -0.129304f, -0.013523f, -0.031945f, 0.161404f, -0.089187f, 0.172449f, 0.036111f, 0.200745f, 0.001511f, -0.114519f, 0.139635f, 0.015675f, 0.188940f, 0.192757f, -0.001663f, 0.098970f, -0.041692f, 0.063024f, -0.176890f, -0.153271f, 0.171169f, -0.053694f, -0.062600f, 0.020191f, 0.194866f, -0.159593f, -0.130141f, -0.056990f, -0.041636f, -0.083548f, -0.045043f, 0.092830f, -0.052136f, 0.136799f, -0.226407f, -0.017168f, -0.148028f, -0.199855f, -0.178652f, -0.166078f, 0.060176f, -0.196721f, -0.060790f, -0.093845f, -0.076920f, -0.045951f, 0.123753f, -0.009009f, -0.144960f, -0.050881f, -0.065782f, -0.146408f, 0.078483f, -0.004970f, -0.014100f, 0.074401f, -0.105972f, -0.209222f, 0.057043f, -0.160136f, 0.109808f, 0.023114f, 0.108848f, 0.007726f, 0.203105f, -0.049144f, 0.080947f, -0.108687f, 0.076519f, 0.139987f, -0.131617f, 0.215704f, 0.175266f, -0.113011f, -0.077928f, -0.210409f, 0.010595f, 0.081611f, 0.142557f, 0.139066f, 0.025823f, -0.074153f, 0.122116f, 0.114287f, 0.194351f, -0.160954f, 0.051382f, -0.081840f, -0.054554f, -0.150058f, 0.081169f, -0.012057f, -0.065036f, 0.045124f, -0.183094f, 0.090128f, -0.179728f, -0.182937f, 0.008787f, 0.087107f, 0.029835f, 0.196994f, 0.016475f, -0.213103f, -0.070917f, -0.183919f, -0.204278f, -0.162027f, 0.118330f, -0.159380f, -0.211453f, 0.015785f, -0.193807f, -0.199765f, 0.129195f, -0.212904f, -0.080260f, 0.086703f, -0.040443f, -0.225334f, -0.122589f, -0.112950f, -0.175443f, 0.010532f, 0.059258f, -0.031445f, 0.129592f, -0.180508f, -0.014628f, -0.064795f, -0.119216f, -0.102441f, 0.157143f, -0.010244f, -0.146692f, 0.137212f, 0.197856f, 0.230238f, 0.159925f, -0.001589f, 0.228974f, 0.178691f, 0.128461f, -0.032662f, -0.172743f, -0.084996f, 0.150172f, 0.280192f, 0.179632f, -0.163591f, 0.057522f, -0.176204f, 0.061274f, 0.060048f, 0.046837f, 0.242949f, 0.251949f, 0.130431f, -0.178710f, 0.207046f, -0.080898f, 0.182445f, 0.218219f, -0.100855f, -0.097877f, 0.058106f, -0.184246f, 0.204308f, 0.172120f, 0.111366f, 0.022752f, 0.065644f, 0.237184f, -0.157817f, -0.111128f, 0.190717f, 0.092142f, 0.133734f, -0.137737f, 0.213633f, 0.078144f, 0.131726f, -0.017577f, 0.118663f, -0.001084f, 0.098142f, -0.003546f, -0.051808f, 0.025507f, 0.110042f, -0.037973f, 0.303196f, -0.003300f, 0.206925f, 0.238845f, -0.029247f, -0.075940f, 0.085608f, -0.008387f, 0.210851f, 0.131949f, 0.212103f, -0.025800f, 0.191373f, -0.071964f, -0.405668f, 0.251303f, 0.031972f, 0.142811f, -0.009714f, 0.288810f, 0.019846f, 0.204052f, 0.072030f, 0.033480f, 0.265776f, 0.169942f, 0.215830f, 0.122335f, 0.111992f, -0.038564f, 0.175997f, -0.047296f, 0.023241f, 0.068912f, 0.193088f, 0.106237f, 0.024615f, 0.014319f, -0.121180f, -0.034032f, 0.159379f, 0.163126f, -0.015241f, 0.176857f, 0.153942f, 0.217900f, -0.165243f, 0.060415f, 0.179969f, 0.042034f, -0.106905f, 0.185117f, 0.127606f, 0.071887f, 0.186632f, 0.190201f, -0.057520f, 0.164868f, -0.062938f, 0.215534f, 0.014266f, -0.043571f, 0.184452f, 0.135739f, 0.102562f, -0.048661f, 0.093551f, -0.110050f, 0.109843f, -0.100862f, 0.198144f, -0.128302f, 0.166876f, 0.023802f, 0.054104f, 0.058008f, 0.093407f, 0.025694f, 0.164536f, -0.067376f, -0.036094f, -0.007928f, -0.114135f, 0.027303f, -0.120560f, 0.287318f, -0.148180f, 0.045435f, -0.047689f, -0.124365f, 0.102869f, 0.008615f, 0.238653f, 0.112878f, -0.342602f, 0.130081f, 0.075515f, -0.172391f, -0.139632f, 0.175271f, -0.106379f, 0.155898f, 0.161981f, -0.078069f, -0.042161f, 0.117524f, -0.081401f, -0.050880f, -0.190296f, -0.067607f, -0.109683f, -0.164983f, -0.091825f, 0.017412f, 0.083381f, 0.131205f, -0.045379f, 0.168297f, -0.178322f, -0.151379f, -0.132169f, -0.242371f, 0.036922f, -0.013944f, 0.069954f, -0.210963f, 0.212509f, -0.143462f, 0.078230f, 0.134941f, -0.065104f, -0.099515f, 0.091071f, -0.168145f, -0.180586f, -0.075663f, 0.128123f, -0.142690f, -0.183098f, -0.258875f, -0.248721f, 0.094679f, 0.165370f, 0.004022f, -0.184839f, 0.121036f, -0.170053f, -0.051115f, 0.019751f, 0.118276f, 0.164011f, 0.076396f, -0.231691f, 0.156856f, -0.076955f, 0.088384f, -0.138879f, -0.209303f, -0.190312f, 0.160091f, -0.154790f, -0.176479f, -0.173398f, -0.096679f, -0.017249f, -0.226131f, 0.165282f, 0.097632f, -0.074732f, 0.013977f, 0.128095f, -0.100720f, -0.022302f, -0.174736f, 0.155367f, 0.013392f, -0.045122f, -0.194154f, 0.134479f, -0.117046f, -0.023747f, 0.113686f, 0.046709f, -0.255825f, -0.154867f, 0.260677f, -0.103941f, 0.106719f, -0.077432f, 0.297935f, 0.166408f, -0.064199f, 0.114680f, 0.035262f, -0.097754f, 0.183978f, 0.312285f, 0.125461f, 0.146318f, 0.056156f, 0.073978f, 0.134526f, 0.011170f, -0.148811f, 0.059130f, 0.108882f, 0.030010f, -0.167110f, -0.044214f, -0.036181f, 0.084935f, 0.183260f, 0.013015f, 0.039055f, 0.191631f, 0.121247f, 0.218483f, -0.082504f, 0.187940f, 0.313352f, -0.061145f, 0.128611f, -0.166494f, -0.082961f, 0.221357f, 0.214295f, 0.012593f, 0.005977f, 0.132289f, -0.133484f, 0.130756f, 0.105887f, 0.126658f, 0.143901f, 0.047625f, 0.102238f, 0.025618f, -0.139268f, 0.257500f, -0.031526f, 0.178073f, 0.174040f, 0.292954f, 0.008010f, 0.151949f, -0.030525f, -0.083391f, 0.221124f, 0.330760f, -0.060664f, 0.193828f, -0.062417f, 0.289921f, -0.138210f, -0.387939f, -0.084054f, 0.386438f, 0.117871f, 0.293012f, 0.083086f, 0.018758f, 0.040786f, -0.059616f, 0.083195f, 0.137131f, 0.125005f, 0.037805f, -0.070207f, 0.078713f, 0.286269f, 0.180067f, -0.047759f, 0.160692f, 0.143875f, 0.149332f, 0.292474f, 0.265758f, 0.142355f, 0.115169f, -0.121240f, 0.130021f, 0.034519f, 0.032207f, 0.129325f, -0.069631f, -0.009744f, 0.181635f, -0.032470f, -0.115889f, 0.131666f, -0.011468f, -0.102480f, -0.017024f, 0.043397f, 0.085398f, -0.081105f, 0.113552f, 0.000035f, 0.212145f, 0.298663f, 0.217607f, 0.123381f, -0.096516f, -0.052815f, 0.010765f, -0.151846f, -0.008534f, -0.094933f, 0.134745f, 0.052612f, -0.103297f, -0.059031f, 0.224947f, -0.029368f, 0.268088f, 0.040585f, 0.060411f, -0.086707f, 0.180798f, 0.076483f, 0.004062f, -0.095688f, 0.151412f, 0.159531f, 0.149695f, 0.174201f, 0.153573f, 0.105735f, 0.276263f, 0.159747f, 0.280620f, -0.177519f, -0.080424f, -0.158255f, -0.125246f, 0.172547f, 0.203095f, 0.207340f, 0.060416f, 0.009239f, -0.064648f, 0.152449f, -0.087837f, 0.173668f, 0.009342f, 0.150129f, -0.074819f, 0.005706f, -0.076065f, 0.129950f, -0.009110f, 0.179639f, 0.072818f, -0.191830f, -0.061264f, 0.167119f, -0.226251f, 0.159658f, -0.113789f, 0.027075f, 0.105023f, -0.023161f, -0.212827f, -0.030620f, 0.004478f, -0.060857f, 0.175499f, 0.185774f, -0.047311f, 0.053269f, -0.178613f, -0.006046f, 0.072713f, -0.186452f, 0.043830f, 0.108116f, 0.016817f, -0.063036f, 0.173595f, -0.194845f, -0.096650f, 0.086043f, 0.069007f, 0.135305f, 0.043195f, 0.040366f, 0.190449f, 0.029470f, -0.000116f, 0.128099f, 0.160826f, -0.088404f, -0.041652f, -0.200871f, 0.009214f, -0.028747f, 0.107141f, 0.075842f, -0.168002f, 0.044809f, 0.107085f, 0.140584f, -0.119550f, 0.112589f, 0.193781f, 0.054356f, -0.220626f, -0.005390f, -0.087699f, 0.015183f, -0.088505f, 0.185630f, 0.041428f, 0.147080f, -0.203955f, 0.157494f, -0.038629f, -0.066425f, -0.035174f, -0.089338f, -0.214953f, 0.016750f, -0.045197f, 0.019535f, 0.101873f, 0.239734f, -0.040685f, 0.214131f, 0.246927f, -0.120328f, 0.227363f, 0.037185f, 0.217949f, 0.068866f, -0.084362f, 0.153220f, 0.094642f, -0.003874f, -0.035704f, -0.025606f, -0.080041f, -0.088691f, 0.235866f, 0.080664f, 0.159577f, 0.124292f, 0.196797f, 0.202123f, 0.075102f, -0.126758f, 0.067404f, -0.090442f, 0.301435f, 0.076349f, 0.032956f, -0.119242f, -0.263948f, 0.041747f, 0.084894f, 0.099951f, 0.038518f, 0.123548f, -0.041196f, 0.012807f, -0.055189f, -0.179000f, 0.137062f, -0.063071f, 0.180178f, -0.188435f, 0.123362f, -0.068086f, -0.061627f, -0.114190f, 0.238765f, 0.119980f, 0.107042f, -0.153387f, 0.080463f, 0.229155f, 0.343581f, 0.053542f, 0.209241f, 0.099242f, 0.153281f, 0.030512f, 0.083347f, 0.133747f, 0.067871f, -0.138448f, 0.189688f, -0.031347f, 0.044188f, -0.055943f, -0.045045f, 0.125166f, 0.262595f, 0.092467f, 0.082442f, -0.033306f, -0.103723f, 0.109536f, -0.092756f, 0.182115f, 0.246161f, -0.032933f, -0.222497f, -0.220870f, -0.080425f, -0.007120f, -0.188025f, 0.090693f, -0.162024f, 0.145786f, -0.054622f, -0.129972f, 0.037727f, -0.189789f, 0.007695f, -0.197157f, 0.017391f, -0.152409f, 0.079768f, -0.061209f, 0.012653f, 0.183372f, -0.163699f, 0.209525f, 0.185689f, -0.200819f, 0.142867f, -0.015385f, 0.082632f, -0.026047f, 0.030423f, 0.049908f, 0.179008f, 0.024154f, -0.118997f, -0.178699f, 0.042163f, -0.073227f, -0.131371f, -0.134286f, -0.081850f, -0.136397f, 0.097959f, -0.159605f, 0.103767f, 0.130027f, -0.151698f, -0.042157f, 0.108052f, 0.078679f, 0.124889f, 0.185634f, 0.065502f, -0.188510f, -0.064845f, 0.143883f, -0.086836f, -0.148401f, -0.150278f, 0.129075f, -0.215726f, 0.019078f, -0.192166f, 0.070826f, 0.152202f, 0.013160f, -0.009181f, 0.109356f, 0.046299f, -0.180552f, 0.140725f, -0.085491f, 0.118013f, 0.174044f, 0.123291f, -0.116029f, -0.018752f, 0.087988f, -0.208974f, -0.076907f, 0.130844f, 0.042910f, -0.221818f, -0.066318f, -0.227619f, -0.044266f, -0.211954f, 0.057701f, -0.043425f, -0.151338f, 0.126189f, 0.017982f, -0.080419f, 0.131314f, -0.057764f, 0.050273f, 0.198336f, 0.169615f, -0.105915f, 0.161865f, -0.216059f, 0.098920f, 0.038238f, 0.038418f, -0.052494f, 0.010421f, 0.167487f, 0.182286f, 0.069075f, -0.004355f, -0.023692f, -0.136898f, 0.088049f, 0.156577f, 0.067414f, 0.191589f, -0.066272f, -0.207677f, -0.177882f, 0.092794f, 0.006622f, -0.104594f, -0.211346f, -0.071028f, -0.013131f, -0.096782f, -0.085282f, 0.157638f, -0.092198f, -0.211265f, 0.044477f, -0.138161f, 0.081781f, -0.198221f, -0.127636f, 0.164451f, -0.022412f, 0.009008f, -0.213820f, -0.111324f, 0.123996f, 0.063017f, 0.200098f, 0.132854f, -0.177816f, 0.199517f, 0.119747f, -0.077961f, -0.161430f, 0.146218f, 0.088673f, 0.140268f, -0.013288f, 0.115441f, -0.125577f, 0.002322f, -0.209604f, -0.043161f, -0.218974f, -0.182934f, -0.186054f, 0.213005f, 0.141979f, 0.063854f, -0.047283f, 0.285692f, -0.109842f, 0.101058f, 0.247817f, 0.137586f, 0.047195f, -0.111469f, 0.106463f, 0.152930f, -0.108556f, 0.163306f, 0.142228f, 0.248456f, 0.220532f, 0.031430f, 0.234409f, -0.074834f, -0.052076f, -0.150036f, 0.236200f, 0.167698f, 0.265234f, -0.079832f, -0.054695f, 0.092993f, 0.103562f, 0.026319f, 0.179148f, -0.150263f, 0.081757f, -0.032963f, -0.032260f, 0.067599f, 0.043712f, 0.234926f, -0.074280f, -0.144573f, 0.235661f, 0.211066f, 0.264664f, -0.077855f, 0.233602f, 0.138896f, -0.066812f, 0.007827f, 0.040879f, 0.299176f, 0.107547f, -0.089455f, 0.030871f, 0.244938f, 0.040736f, 0.136107f, 0.153990f, -0.038780f, -0.122509f, 0.292878f, 0.011811f, -0.030510f, 0.262124f, -0.135029f, 0.013697f, 0.056747f, 0.112089f, -0.072394f, -0.440274f, 0.251937f, 0.133614f, 0.032447f, 0.240227f, -0.060872f, -0.023092f, -0.107575f, -0.216907f, 0.071455f, 0.273789f, 0.143920f, -0.002719f, -0.177023f, -0.142311f, 0.143642f, -0.024195f, 0.020096f, -0.007633f, 0.167465f, 0.002216f, 0.084327f, 0.050414f, -0.102987f, 0.144641f, 0.168965f, -0.251385f, 0.015036f, 0.018836f, 0.004789f, 0.039101f, -0.108805f, -0.169239f, -0.187456f, -0.134742f, 0.055971f, 0.168852f, -0.116687f, -0.228139f, -0.035765f, -0.057364f, 0.100110f, -0.187563f, 0.042123f, 0.141608f, -0.193896f, 0.075675f, 0.098905f, -0.026952f, -0.188936f, -0.224179f, 0.185128f, -0.129161f, -0.197214f, -0.084250f, -0.061833f, -0.034152f, 0.190973f, -0.157330f, 0.002694f, 0.124448f, 0.107710f, 0.196123f, -0.109524f, -0.112312f, -0.172514f, 0.121567f, 0.129073f, -0.240021f, 0.108456f, -0.174816f, -0.045261f, 0.151623f, -0.011461f, -0.009712f, 0.188095f, -0.108696f, 0.160370f, 0.009661f, 0.156999f, -0.008178f, 0.162009f, -0.249712f, 0.140575f, 0.105532f, 0.150678f, -0.157807f, 0.171842f, 0.098469f, -0.020593f, -0.123157f, 0.036645f, -0.081685f, -0.118009f, -0.087293f, -0.171246f, -0.107678f, -0.124141f, -0.215415f, -0.004500f, 0.010145f, -0.227354f, 0.138210f, 0.115558f, 0.122848f, -0.120689f, 0.147314f, 0.067219f, 0.102918f, 0.171833f, 0.044700f, 0.164693f, -0.073546f, 0.011750f, -0.205881f, 0.124066f, 0.015880f, 0.057222f, -0.109122f, 0.174704f, -0.164035f, -0.159451f, 0.034298f, -0.030872f, -0.183723f, 0.005355f, 0.009639f, 0.030342f, -0.115960f, -0.068804f, -0.013467f, 0.030648f, -0.099544f, -0.142038f, 0.051585f, 0.030478f, 0.124746f, 0.171636f, 0.043487f, -0.152027f, -0.093235f, 0.083397f, -0.120590f, 0.049184f, -0.153695f, -0.044806f, -0.332796f, 0.040903f, 0.181610f, -0.182033f, -0.014716f, 0.132230f, -0.044590f, 0.100423f, 0.196946f, -0.216263f, -0.183553f, 0.028797f, -0.008327f, 0.072671f, 0.038327f, 0.114240f, 0.094450f, 0.204094f, -0.184172f, 0.070892f, -0.178780f, -0.150518f, -0.222250f, -0.003189f, 0.154396f, 0.200734f, -0.105330f, 0.119229f, 0.033977f, -0.210467f, -0.054726f, 0.145021f, -0.217863f, -0.039414f, 0.155119f, -0.030602f, -0.015940f, 0.142897f, -0.123762f, -0.107539f, -0.022696f, 0.166670f, 0.132992f, -0.011264f, 0.056808f, 0.102858f, -0.079317f, -0.213454f, 0.014007f, -0.204641f, 0.100854f, -0.187367f, 0.139203f, 0.194641f, 0.145896f, -0.106829f, -0.038317f, 0.097256f, -0.051004f, -0.127902f, -0.212785f, 0.046641f, 0.011485f, -0.169893f, -0.108257f, 0.004137f, -0.122156f, 0.069272f, 0.183936f, 0.047429f, -0.159486f, -0.154647f, 0.198039f, -0.162604f, 0.055102f, -0.036156f, 0.173449f, 0.187969f, -0.143924f, 0.170688f, -0.126445f, -0.222372f, -0.008091f, 0.129527f, -0.015734f, -0.151290f, -0.194355f, -0.038321f, 0.143537f, 0.021274f, -0.131091f, -0.049171f, -0.076296f, -0.090907f, -0.040887f, -0.230147f, -0.069594f, 0.091944f, -0.089731f, 0.040042f, -0.030118f, 0.181735f, -0.035216f, -0.142104f, -0.035539f, 0.057705f, 0.064654f, -0.011598f, 0.092361f, -0.095970f, 0.185684f, 0.075961f, 0.092157f, 0.132868f, 0.256729f, 0.092846f, -0.025325f, -0.034825f, 0.063511f, -0.057708f, 0.043801f, 0.239760f, 0.142249f, 0.030436f, 0.144353f, -0.118217f, -0.211739f, -0.133973f, 0.100080f, 0.003092f, -0.161323f, -0.025377f, 0.112654f, -0.049112f, 0.235718f, -0.146185f, -0.151093f, -0.088581f, -0.198636f, -0.033935f, 0.112777f, -0.088670f, -0.131139f, -0.032278f, -0.040212f, -0.122040f, 0.124801f, 0.048431f, -0.173995f, -0.012723f, -0.132004f, -0.109541f, -0.077901f, 0.156008f, -0.031085f, 0.071160f, -0.071154f, 0.143772f, 0.040159f, 0.191697f, 0.169451f, -0.131209f, 0.118570f, 0.096367f, -0.187695f, 0.209357f, -0.003805f, 0.164184f, 0.073618f, 0.008796f, -0.017286f, 0.211563f, -0.059444f, 0.180341f, -0.231314f, 0.262091f, 0.204440f, -0.153441f, 0.090146f, -0.037369f, -0.010046f, -0.070506f, -0.020124f, 0.123350f, 0.079803f, 0.116284f, -0.029226f, -0.039966f, 0.054832f, -0.062631f, 0.215992f, -0.108079f, 0.029041f, -0.200740f, -0.196423f, -0.063038f, -0.086088f, 0.174250f, -0.119557f, 0.156254f, 0.060749f, -0.083851f, -0.082273f, 0.096199f, 0.008351f, -0.100733f, 0.071244f, -0.152056f, 0.040945f, -0.100408f, -0.123954f, -0.109093f, 0.124391f, 0.046801f, -0.177246f, -0.002606f, 0.194199f, 0.102065f, 0.200189f, -0.060291f, 0.192711f, 0.091937f, -0.019282f, -0.028140f, -0.124289f, -0.095417f, 0.019479f, -0.222075f, 0.031375f, -0.161918f, -0.223594f, -0.114238f, 0.003453f, 0.178390f, -0.160540f, 0.098393f, 0.204943f, -0.104341f, -0.087911f, -0.092691f, 0.179819f, 0.018867f, 0.157385f, 0.189797f, -0.045601f, 0.090438f, -0.031148f, -0.125943f, -0.015662f, -0.034464f, -0.045131f, -0.065080f, -0.189692f, -0.088065f, -0.024258f, 0.085396f, 0.202669f, 0.020773f, -0.204400f, 0.126307f, -0.113179f, -0.020845f, -0.048626f, -0.042817f, -0.219226f, -0.022196f, -0.019657f, 0.067599f, 0.165511f, -0.072639f, -0.055422f, -0.147845f, -0.213322f, 0.073867f, 0.119602f, 0.079122f, -0.218075f, -0.111732f, -0.161188f, 0.168106f, 0.160275f, -0.014133f, -0.091911f, 0.150590f, 0.159221f, -0.096454f, 0.039882f, 0.178770f, -0.001828f, -0.081195f, -0.155663f, 0.005192f, -0.170459f, 0.066271f, 0.160120f, -0.207068f, 0.105101f, 0.180508f, 0.169223f, -0.044640f, 0.120111f, 0.064153f, -0.181683f, -0.194026f, 0.154917f, -0.022790f, -0.092101f, -0.086611f, 0.012286f, -0.173510f, 0.033678f, 0.196029f, -0.108986f, -0.200196f, -0.220171f, -0.124390f, -0.024526f, 0.073002f, 0.008480f, -0.045693f, -0.197461f, 0.002638f, 0.025805f, -0.066705f, 0.171674f, -0.144760f, -0.087251f, 0.036660f, -0.033634f, -0.148698f, 0.174549f, 0.203454f, 0.041357f, 0.210737f, -0.032554f, -0.184072f, 0.009325f, -0.174096f, -0.004271f, -0.185457f, 0.148701f, 0.023990f, -0.090143f, -0.157871f, 0.143456f, 0.096962f, 0.035410f, -0.073808f, -0.006694f, -0.072961f, 0.039974f, 0.002480f, 0.090637f, -0.044213f, -0.158154f, -0.176593f, -0.202955f, -0.237446f, 0.052960f, 0.154795f, 0.000071f, -0.066110f, 0.065823f, -0.156324f, -0.206800f, 0.173172f, 0.157047f, -0.214484f, -0.090635f, -0.174924f, -0.199138f, -0.066728f, 0.074991f, -0.036854f, 0.055976f, -0.005192f, 0.044282f, -0.030920f, -0.213346f, -0.119936f, 0.135450f, 0.180215f, 0.118511f, -0.184634f, 0.019755f, -0.029798f, 0.037553f, -0.017808f, 0.150340f, -0.196945f, -0.056391f, -0.113342f, 0.104717f, -0.041850f, -0.186517f, -0.194861f, 0.001743f, 0.052566f, -0.202943f, -0.067320f, 0.044585f, 0.005739f, 0.109967f, -0.170221f, 0.098930f, 0.103643f, -0.054268f, -0.185202f, 0.121683f, -0.107898f, -0.142517f, -0.002271f, 0.037306f, -0.050635f, 0.031229f, 0.162426f, 0.124694f, 0.011227f, -0.206045f, -0.165277f, 0.214889f, 0.093022f, 0.109712f, -0.008296f, -0.032501f, 0.173651f, -0.077312f, 0.056600f, -0.171909f, -0.194672f, -0.018603f, 0.049314f, 0.136218f, -0.018184f, -0.153227f, 0.109714f, -0.031931f, -0.147666f, 0.188523f, 0.145050f, -0.069529f, -0.216448f, 0.059855f, -0.031369f, -0.018772f, 0.206001f, -0.189886f, 0.195451f, 0.137249f, -0.036461f, -0.048181f, -0.053211f, -0.018529f, 0.031126f, -0.138556f, 0.017136f, -0.044944f, -0.098113f, -0.152901f, 0.160488f, -0.053626f, 0.036044f, -0.019580f, 0.182327f, -0.109376f, 0.136954f, -0.066910f, -0.110177f, 0.062521f, -0.024663f, -0.202149f, -0.054992f, -0.084286f, -0.146458f, 0.106773f, -0.141588f, -0.017811f, 0.141925f, 0.118940f, 0.059515f, 0.015512f, -0.169191f, 0.082932f, -0.013008f, -0.214998f, 0.098549f, -0.082201f, 0.059338f, 0.179561f, -0.064480f, -0.132295f, 0.170892f, -0.056115f, 0.052390f, 0.124911f, -0.118167f, 0.195223f, -0.020974f, -0.186625f, -0.027031f, -0.075209f, -0.003077f, -0.144920f, -0.172977f, -0.074202f, 0.085206f, 0.231431f, 0.028570f, 0.256987f, -0.027557f, 0.006323f, -0.094587f, 0.038249f, -0.125716f, -0.084918f, 0.077359f, 0.083627f, 0.024155f, -0.126958f, -0.108078f, 0.036369f, 0.124452f, 0.006764f, -0.045345f, -0.096540f, 0.311527f, 0.010154f, 0.111616f, 0.010947f, 0.195645f, 0.013022f, 0.151367f, 0.147474f, 0.180370f, 0.168512f, 0.029618f, 0.089068f, 0.136276f, -0.191209f, 0.007799f, 0.054687f, 0.134797f, 0.072973f, -0.147939f, -0.009941f, 0.101954f, -0.014765f, 0.000958f, 0.237566f, 0.076541f, 0.013112f, 0.183634f, 0.099040f, 0.238129f, 0.035246f, 0.000630f, 0.255563f, 0.055007f, 0.308426f, 0.143324f, 0.296224f, 0.298226f, 0.083629f, 0.139590f, -0.087519f, -0.096832f, 0.238303f, 0.301808f, -0.094433f, 0.048969f, 0.193470f, 0.000880f, 0.233936f, 0.049633f, -0.252237f, -0.031076f, -0.012068f, -0.182412f, 0.191831f, 0.088113f, -0.079332f, 0.235486f, 0.021811f, 0.277591f, 0.151992f, -0.211259f, -0.013397f, 0.028036f, -0.077765f, -0.105433f, 0.055814f, -0.086916f, -0.229608f, 0.089584f, 0.090353f, -0.035068f, 0.048947f, 0.097745f, 0.146404f, 0.078533f, -0.047509f, -0.161501f, 0.176057f, -0.035808f, 0.160189f, -0.144520f, 0.016632f, 0.069773f, -0.202162f, -0.244818f, -0.229020f, -0.025725f, 0.053580f, -0.124027f, -0.192876f, -0.137922f, -0.027466f, 0.148822f, -0.027629f, 0.149554f, -0.195531f, 0.079212f, -0.087538f, 0.067572f, -0.007649f, 0.202500f, 0.108628f, 0.098684f, 0.120982f, 0.102246f, 0.093479f, 0.148779f, 0.126618f, -0.195663f, -0.197020f, 0.052472f, 0.134624f, 0.183139f, -0.029223f, -0.186890f, 0.157444f, 0.156155f, -0.077290f, -0.134451f, 0.123095f, 0.127734f, -0.238771f, 0.082947f, 0.120328f, 0.040386f, 0.009899f, 0.077947f, -0.185385f, -0.196026f, -0.149147f, -0.003472f, -0.146922f, 0.175118f, 0.032990f, -0.020208f, -0.147455f, 0.068439f, -0.089222f, 0.153057f, 0.073881f, 0.070161f, -0.048339f, -0.086092f, 0.015191f, 0.093097f, 0.017359f, -0.142660f, -0.213171f, 0.120111f, 0.132197f, -0.090280f, -0.240384f, -0.193376f, -0.232229f, -0.146888f, 0.006303f, -0.047454f, -0.117069f, -0.174130f, 0.187541f, 0.126790f, -0.102056f, 0.157342f, 0.100450f, 0.172997f, 0.173561f, -0.210663f, -0.237786f, -0.196106f, -0.037747f, -0.153879f, -0.208537f, 0.210644f, -0.115157f, 0.039202f, 0.165944f, -0.198747f, 0.180546f, 0.002205f, -0.056126f, 0.093898f, -0.144460f, -0.138339f, -0.070427f, -0.113238f, -0.086907f, -0.160692f, -0.038551f, -0.140095f, 0.090382f, -0.016594f, -0.217328f, -0.144534f, -0.202327f, 0.177612f, -0.109067f, 0.150171f, 0.136224f, 0.103900f, -0.076052f, -0.003315f, 0.039558f, 0.148166f, -0.177436f, 0.089469f, -0.117524f, 0.131299f, -0.066425f, 0.012777f, 0.083074f, -0.103983f, -0.161136f, -0.040889f, -0.165746f, 0.019203f, 0.003290f, 0.084213f, 0.021037f, -0.192217f, 0.155618f, 0.150460f, 0.065425f, 0.023131f, -0.054670f, -0.222059f, -0.210254f, -0.012936f, 0.049126f, 0.171304f, -0.027798f, 0.188235f, 0.070565f, -0.199328f, -0.038711f, 0.007682f, 0.116474f, 0.103738f, 0.177816f, -0.058051f, -0.126824f, -0.138552f, 0.207926f, -0.209402f, -0.085489f, 0.060271f, -0.105606f, -0.051138f, 0.191905f, 0.161884f, -0.129098f, -0.041390f, -0.211085f, -0.190354f, -0.013179f, -0.040577f, -0.241650f, -0.020618f, 0.056664f, -0.033226f, 0.036661f, -0.162471f, 0.013473f, -0.215367f, -0.222807f, -0.140551f, -0.101533f, -0.016323f, -0.015137f, 0.028137f, -0.072371f, -0.050759f, 0.042596f, -0.069173f, -0.149263f, -0.135692f, -0.109401f, 0.036792f, 0.199202f, -0.001889f, -0.155957f, 0.045207f, 0.087353f, -0.123827f, -0.080822f, -0.093648f, -0.093250f, 0.140825f, -0.031659f, -0.062448f, -0.087425f, -0.097252f, -0.111517f, 0.075134f, 0.170806f, -0.179653f, 0.167969f, -0.088552f, 0.063810f, 0.077495f, 0.126380f, 0.189270f, 0.211585f, 0.158153f, 0.126745f, -0.094502f, 0.029754f, -0.120508f, 0.013664f, 0.103966f, 0.146845f, -0.071460f, -0.001043f, -0.116461f, -0.027737f, 0.139777f, -0.136125f, -0.005369f, 0.112659f, -0.055106f, 0.154619f, 0.241804f, 0.052018f, 0.140252f, -0.075529f, -0.007855f, 0.163302f, -0.032918f, 0.084223f, 0.013982f, 0.231293f, -0.116989f, 0.229821f, -0.011466f, -0.013500f, 0.099079f, 0.097439f, -0.110428f, -0.152381f, 0.064537f, 0.071643f, 0.050856f, -0.018459f, -0.040753f, 0.113815f, 0.205555f, 0.121782f, 0.093933f, 0.053017f, 0.126298f, -0.097686f, 0.011993f, -0.006602f, 0.220694f, 0.161275f, 0.032044f, 0.154662f, -0.113896f, 0.112581f, 0.222516f, 0.218034f, -0.006505f, 0.083710f, 0.294921f, -0.059726f, 0.080475f, 0.036868f, -0.068621f, -0.087533f, 0.211907f, -0.117125f, 0.161392f, 0.209238f, -0.122635f, 0.173818f, 0.189100f, 0.020817f, 0.249768f, -0.072028f, -0.143283f, 0.153637f, 0.175548f, 0.068688f, -0.182535f, -0.079788f, -0.191763f, 0.001733f, 0.125947f, 0.106439f, 0.075517f, -0.179407f, -0.082234f, 0.062780f, -0.029862f, 0.175712f, 0.160217f, -0.113769f, 0.065213f, 0.073534f, -0.033237f, -0.093122f, -0.225355f, 0.071890f, 0.052592f, -0.217459f, -0.014633f, 0.100478f, -0.126692f, -0.183615f, -0.149036f, 0.024590f, 0.149659f, 0.017023f, 0.022682f, -0.214855f, 0.091128f, -0.081958f, -0.185372f, -0.221381f, 0.205587f, -0.136529f, 0.157876f, 0.046696f, -0.035876f, 0.045349f, -0.023938f, -0.097741f, 0.139689f, -0.026857f, 0.077916f, 0.101773f, -0.043750f, 0.058582f, 0.118025f, 0.008543f, -0.213633f, -0.073130f, 0.092302f, -0.065490f, -0.139199f, 0.080336f, 0.175638f, -0.217793f, -0.020255f, 0.135924f, 0.148631f, 0.077850f, 0.128118f, 0.149729f, 0.197721f, 0.137468f, -0.053544f, 0.114250f, 0.181414f, -0.104202f, 0.051464f, 0.013531f, 0.105858f, -0.167814f, 0.021344f, -0.121562f, 0.095105f, -0.110474f, 0.175027f, 0.082254f, -0.038508f, -0.121765f, -0.224762f, -0.089465f, 0.172179f, -0.195381f, -0.071287f, -0.276158f, 0.166902f, -0.060197f, 0.118408f, 0.032174f, 0.147877f, 0.051647f, -0.131780f, 0.170411f, -0.159102f, -0.175862f, -0.097764f, 0.179136f, 0.035529f, 0.178685f, 0.038535f, -0.040747f, -0.190184f, 0.049385f, 0.117870f, 0.054244f, 0.052145f, 0.066879f, -0.073079f, -0.204010f, -0.157269f, 0.175300f, -0.066261f, 0.116370f, -0.063380f, 0.024376f, 0.198386f, 0.106282f, -0.240973f, -0.105687f, -0.050750f, -0.066509f, -0.060511f, -0.121024f, -0.065583f, 0.101486f, -0.025163f, 0.087685f, 0.094101f, -0.252650f, 0.070962f, 0.113799f, 0.061321f, -0.190448f, 0.149281f, 0.018539f, 0.117396f, -0.197905f, 0.145183f, -0.136179f, -0.219142f, -0.153295f, -0.221947f, 0.138589f, 0.038342f, -0.024612f, 0.028893f, -0.201700f, 0.066417f, -0.113311f, -0.155040f, -0.031005f, -0.083868f, 0.010020f, 0.178911f, -0.055578f, -0.074196f, -0.158653f, 0.191385f, -0.052705f, 0.125149f, -0.046025f, -0.072040f, 0.139053f, 0.194228f, -0.107581f, 0.179439f, 0.109336f, 0.055548f, -0.081325f, 0.241338f, 0.053231f, 0.043886f, 0.197645f, 0.195195f, 0.009493f, -0.077257f, 0.056546f, 0.214387f, 0.166907f, -0.135202f, 0.079096f, 0.110953f, 0.207281f, 0.135507f, 0.120543f, -0.165138f, 0.085432f, 0.055811f, 0.158562f, 0.240393f, -0.057072f, 0.112961f, 0.030041f, 0.034829f, -0.162368f, -0.080091f, 0.016205f, -0.139642f, 0.187879f, 0.194456f, -0.133810f, 0.077764f, 0.053802f, 0.208280f, 0.022846f, -0.155183f, 0.074518f, 0.063163f, 0.352704f, -0.101722f, 0.234289f, -0.157066f, 0.071292f, 0.177121f, -0.136383f, 0.085232f, 0.018385f, 0.169812f, 0.026397f, 0.147577f, 0.027185f, -0.152995f, -0.149471f, 0.245849f, 0.227459f, -0.079757f, 0.204981f, 0.037277f, -0.112862f, 0.082396f, -0.155874f, 0.199878f, -0.035974f, 0.154642f, -0.181890f, -0.176809f, -0.008099f, 0.196987f, -0.036310f, -0.065225f, -0.079214f, 0.205919f, -0.183839f, -0.132453f, 0.007608f, -0.042780f, 0.122937f, 0.083938f, -0.199684f, 0.163587f, 0.051038f, -0.101270f, -0.028214f, 0.109134f, 0.137814f, 0.178750f, -0.097230f, -0.119072f, -0.060176f, -0.024438f, -0.047450f, 0.087800f, -0.208158f, -0.114628f, -0.009357f, -0.155014f, 0.066827f, 0.074057f, 0.041021f, 0.174534f, -0.005723f, -0.043442f, -0.100632f, 0.139931f, -0.071009f, 0.140479f, -0.033085f, 0.126722f, -0.157207f, -0.014500f, 0.057366f, 0.154921f, -0.200155f, -0.218315f, 0.106803f, -0.101945f, -0.201962f, 0.184324f, 0.060623f, -0.071683f, -0.026472f, -0.042935f, 0.133557f, -0.000427f, -0.005663f, 0.011574f, 0.137687f, 0.102585f, 0.009884f, -0.069801f, 0.085626f, -0.029471f, 0.052093f, 0.104579f, 0.083249f, 0.082633f, 0.166133f, 0.047666f, -0.032704f, -0.069835f, -0.189184f, -0.195713f, -0.009343f, 0.148064f, -0.029540f, 0.098464f, 0.050311f, 0.163976f, 0.027632f, -0.093631f, 0.084921f, -0.174457f, -0.216139f, 0.003594f, 0.145567f, 0.003873f, 0.227252f, -0.148786f, -0.164498f, 0.038721f, -0.210955f, -0.091670f, -0.017579f, -0.156555f, -0.030632f, -0.104687f, 0.056468f, -0.065638f, 0.176457f, 0.150296f, 0.050563f, 0.070761f, 0.198487f, -0.005177f, 0.000121f, 0.087019f, 0.185645f, 0.015122f, 0.033286f, 0.001034f, -0.114961f, 0.212499f, -0.205886f, -0.171842f, -0.047440f, -0.124407f, -0.074761f, -0.017487f, 0.171610f, -0.006170f, -0.156258f, 0.078498f, -0.042921f, 0.123962f, 0.127753f, -0.065932f, 0.009944f, -0.074882f, -0.031688f, 0.167126f, -0.015975f, -0.126429f, -0.028980f, -0.082012f, 0.043581f, -0.028137f, 0.174210f, 0.016475f, 0.109619f, 0.028223f, -0.127032f, 0.138574f, -0.495107f, -0.037365f, 0.022108f, 0.091818f, 0.165518f, -0.055956f, -0.017333f, 0.029539f, -0.179576f, -0.079350f, -0.029614f, 0.148892f, 0.113906f, 0.070311f, 0.092262f, 0.090640f, -0.213470f, -0.157157f, -0.201977f, -0.128936f, -0.009717f, -0.060657f, -0.169926f, -0.103101f, 0.165922f, 0.058399f, -0.140531f, -0.058648f, 0.096258f, 0.130327f, 0.147755f, -0.262521f, -0.153442f, 0.040213f, -0.045365f, -0.194283f, -0.121340f, -0.162160f, -0.187003f, 0.146710f, 0.004338f, 0.153346f, 0.072620f, -0.150106f, 0.197364f, 0.019426f, 0.114962f, -0.092673f, 0.125128f, -0.185065f, 0.107617f, -0.154692f, 0.045006f, 0.087273f, -0.039108f, -0.124551f, 0.002489f, -0.001365f, -0.018282f, 0.031225f, 0.119080f, 0.126323f, 0.126199f, 0.148331f, -0.235478f, 0.115619f, -0.230558f, 0.142768f, 0.132772f, -0.134296f, -0.104300f, 0.029478f, 0.005107f, -0.102979f, -0.060304f, -0.095936f, -0.163747f, -0.153025f, 0.146939f, 0.181895f, -0.153803f, 0.097067f, 0.126801f, -0.130096f, -0.210191f, -0.037024f, -0.142292f, 0.136609f, -0.045933f, -0.179421f, 0.132200f, -0.140135f, 0.169194f, -0.113363f, 0.163484f, 0.138376f, 0.073383f, 0.081311f, -0.079448f, 0.117384f, 0.026331f, 0.243519f, 0.122688f, 0.101074f, 0.079761f, 0.015245f, 0.076785f, -0.005787f, 0.105993f, -0.164353f, 0.042611f, 0.227781f, -0.150005f, 0.014335f, 0.102852f, -0.048351f, 0.157989f, 0.195238f, 0.040015f, -0.061964f, 0.183867f, -0.019886f, -0.134727f, -0.020042f, 0.146146f, -0.111998f, -0.101053f, 0.092126f, 0.162100f, -0.131736f, -0.093093f, -0.071230f, 0.264022f, 0.158944f, 0.271692f, 0.091040f, 0.275742f, 0.184418f, 0.056512f, -0.036240f, -0.120173f, 0.031263f, 0.024754f, 0.237626f, 0.316747f, -0.083530f, 0.001989f, 0.134521f, -0.102678f, -0.025012f, -0.146276f, -0.040696f, 0.187074f, -0.107192f, 0.227962f, -0.046018f, -0.071644f, 0.181193f, -0.151112f, -0.149571f, -0.206997f, 0.280871f, 0.121441f, 0.117461f, 0.227363f, -0.069316f, 0.138291f, -0.018123f, 0.059491f, 0.217665f, 0.069621f, 0.056591f, 0.064957f, 0.064933f, 0.203368f, -0.123579f, 0.091285f, 0.263019f, 0.202882f, 0.140937f, 0.148814f, 0.183260f, -0.011867f, 0.240470f, -0.144033f, 0.155329f, 0.169083f, 0.089641f, 0.217302f, 0.162048f, 0.102041f, 0.137283f, -0.126532f, 0.103598f, -0.131934f, -0.157192f, -0.118816f, -0.020378f, 0.240422f, -0.054855f, 0.202971f, 0.188751f, -0.051459f, -0.106894f, 0.117520f, 0.180614f, -0.004474f, -0.153164f, -0.007969f, 0.137691f, 0.144201f, -0.056319f, 0.245715f, -0.093639f, 0.007649f, 0.213849f, 0.267245f, 0.236370f, -0.117787f, 0.234949f, -0.002231f, 0.088013f, 0.001158f, -0.094418f, 0.203138f, 0.175432f, 0.109265f, -0.148538f, 0.262253f, 0.043121f, 0.175304f, -0.018134f, -0.014840f, 0.006935f, 0.050827f, -0.054229f, 0.273526f, 0.120670f, -0.069124f, -0.098738f, -0.119679f, 0.205256f, 0.287894f, -0.107585f, 0.139319f, 0.182260f, 0.028841f, 0.123261f, 0.207845f, 0.024009f, 0.015916f, 0.102980f, 0.098361f, 0.187442f, -0.041316f, 0.091521f, -0.192278f, -0.018503f, -0.129330f, -0.000518f, -0.228827f, 0.047925f, -0.090625f, -0.223873f, 0.191361f, -0.100170f, -0.261710f, -0.092578f, -0.017187f, -0.076583f, -0.102859f, -0.027626f, -0.107654f, 0.128238f, -0.024958f, -0.134813f, -0.172910f, -0.109451f, -0.033001f, -0.130724f, 0.067325f, -0.105823f, 0.213029f, 0.182735f, 0.148094f, 0.039897f, -0.004524f, 0.157988f, -0.216315f, -0.054339f, -0.010986f, -0.166868f, 0.150699f, 0.038600f, -0.278194f, -0.127125f, -0.215690f, 0.174591f, -0.250512f, -0.195964f, -0.085671f, -0.269135f, 0.152267f, 0.175930f, 0.078142f, -0.012227f, 0.018082f, -0.178073f, -0.016926f, -0.204460f, -0.139867f, -0.029396f, 0.120308f, 0.144683f, 0.189872f, -0.212006f, -0.023032f, -0.076874f, -0.180380f, 0.082248f, -0.029732f, 0.143213f, 0.043736f, 0.055434f, 0.127437f, 0.089869f, 0.124763f, 0.072981f, 0.112866f, -0.148409f, 0.096470f, 0.140262f, -0.024510f, -0.068288f, 0.155399f, 0.158416f, 0.037881f, -0.181449f, 0.215859f, 0.094223f, -0.140294f, -0.076818f, -0.172473f, 0.270438f, 0.036408f, 0.153190f, 0.203983f, 0.051451f, -0.141232f, -0.082298f, 0.080634f, 0.064614f, 0.086157f, 0.006402f, 0.061063f, 0.033954f, -0.024282f, 0.134619f, 0.124055f, 0.133611f, -0.005000f, -0.130378f, -0.157867f, -0.090742f, -0.095171f, 0.248317f, 0.204938f, 0.021446f, -0.166229f, -0.029132f, -0.013175f, 0.021704f, 0.216416f, -0.024123f, 0.240227f, 0.045579f, 0.231859f, -0.120343f, 0.115669f, -0.044700f, -0.092594f, -0.022346f, 0.172752f, 0.044295f, 0.085799f, 0.169304f, -0.016621f, -0.111127f, 0.183545f, 0.077426f, -0.196219f, -0.082276f, 0.155727f, 0.010095f, -0.021729f, 0.027502f, -0.157487f, -0.146680f, 0.044162f, 0.079971f, -0.309436f, 0.040140f, 0.313295f, -0.163218f, 0.106073f, 0.253594f, -0.045378f, -0.120712f, 0.142310f, 0.072395f, -0.054898f, -0.100410f, -0.124096f, -0.178719f, 0.023006f, 0.116518f, 0.202578f, -0.111220f, 0.260996f, 0.100776f, 0.254193f, 0.144417f, -0.036604f, 0.094878f, 0.020528f, -0.024310f, -0.186888f, 0.121186f, -0.069701f, -0.192310f, 0.031579f, 0.216013f, -0.097005f, 0.205566f, -0.003157f, -0.044093f, 0.107326f, -0.047605f, 0.171495f, 0.228519f, 0.004605f, -0.004968f, 0.224688f, 0.154592f, 0.047013f, 0.213688f, 0.111426f, -0.091618f, 0.073831f, -0.044360f, 0.064226f, 0.157502f, 0.273383f, 0.145091f, 0.042064f, 0.226072f, 0.057251f, 0.028076f, -0.131445f, -0.060106f, -0.115647f, 0.095961f, -0.003362f, 0.028761f, 0.147415f, -0.143449f, 0.307799f, 0.271396f, -0.099541f, -0.108534f, -0.144195f, 0.070192f, -0.163797f, -0.037853f, -0.062759f, -0.043495f, 0.069048f, 0.031565f, -0.066026f, -0.124654f, -0.099098f, 0.138857f, 0.372752f, 0.265997f, -0.019030f, -0.089096f, 0.073698f, 0.081666f, -0.064008f, 0.013198f, -0.038652f, 0.192130f, 0.283940f, 0.163864f, 0.167051f, 0.321275f, -0.108503f, 0.149510f, 0.215097f, 0.006436f, 0.231919f, 0.268849f, 0.140812f, 0.234735f, 0.115454f, -0.077937f, 0.165832f, 0.120315f, 0.102733f, -0.049091f, -0.066771f, 0.038611f, 0.111700f, 0.111111f, 0.124863f, -0.063094f, 0.202758f, 0.069737f, -0.025539f, 0.075761f, 0.228764f, 0.213973f, -0.033140f, 0.013871f, -0.139522f, 0.215260f, -0.109958f, 0.134897f, 0.006798f, -0.017923f, -0.058870f, -0.166525f, 0.224844f, -0.117204f, 0.163866f, 0.201177f, 0.036108f, -0.137663f, 0.141123f, 0.114544f, 0.087903f, 0.122114f, 0.293400f, -0.130419f, -0.073107f, 0.247225f, 0.252261f, 0.322312f, 0.083815f, 0.067349f, 0.128679f, -0.001005f, -0.051041f, -0.058341f, -0.031447f, -0.175954f, 0.131192f, 0.203489f, -0.029140f, 0.024407f, -0.291578f, 0.191765f, -0.018838f, 0.090361f, 0.156652f, 0.203925f, -0.109970f, 0.041683f, 0.046954f, 0.009298f, 0.066456f, 0.151634f, 0.181252f, -0.210217f, 0.009876f, -0.161368f, 0.005728f, -0.128353f, 0.044327f, -0.180669f, -0.107693f, -0.199392f, -0.032649f, -0.091781f, -0.051779f, 0.140230f, 0.147727f, -0.179536f, -0.134218f, -0.116428f, -0.066785f, 0.005632f, 0.015782f, -0.168960f, 0.014081f, 0.067859f, 0.053988f, -0.090168f, -0.013955f, -0.240796f, -0.152198f, 0.120695f, -0.136040f, 0.027498f, -0.157311f, 0.164067f, 0.156497f, 0.106730f, 0.100614f, 0.074132f, -0.100129f, -0.101547f, -0.142055f, -0.171166f, 0.103922f, 0.018579f, -0.161300f, -0.087962f, 0.195506f, 0.046464f, -0.265218f, 0.095166f, -0.190302f, 0.100350f, -0.079442f, -0.054237f, -0.215291f, -0.228040f, -0.160666f, -0.074938f, 0.093990f, -0.064723f, -0.248426f, -0.122074f, -0.005454f, -0.045036f, -0.216127f, -0.051240f, 0.014871f, 0.145228f, 0.151125f, 0.193124f, -0.126577f, -0.028412f, 0.028828f, -0.149038f, -0.187355f, -0.066628f, 0.130520f, -0.145123f, 0.023325f, -0.078961f, 0.043732f, -0.158180f, -0.090019f, -0.169529f, 0.090041f, 0.055759f, 0.204697f, -0.011973f, 0.079022f, 0.159696f, -0.123266f, -0.009764f, 0.059484f, -0.095112f, -0.092335f, -0.012343f, -0.148060f, -0.064053f, 0.240794f, -0.031990f, -0.000135f, -0.085924f, -0.032134f, -0.007507f, -0.159903f, 0.208563f, 0.019017f, -0.133652f, 0.045393f, -0.142842f, 0.031241f, -0.107764f, -0.083587f, -0.026560f, 0.090463f, -0.155885f, 0.114126f, 0.066017f, -0.032398f, -0.007483f, -0.036205f, -0.068181f, 0.120042f, -0.089696f, -0.068585f, -0.047262f, 0.099280f, 0.065601f, 0.203646f, 0.148039f, 0.115879f, -0.085303f, 0.240052f, 0.150503f, 0.195609f, 0.191459f, -0.060378f, -0.045672f, 0.143338f, 0.197303f, 0.182621f, -0.058129f, 0.222877f, 0.090479f, 0.019464f, 0.190736f, -0.104123f, 0.102962f, -0.490874f, 0.088952f, 0.279089f, -0.003674f, 0.172756f, 0.203610f, -0.085893f, 0.172835f, -0.126978f, 0.241570f, 0.120306f, -0.005339f, 0.274594f, -0.005655f, 0.260098f, 0.197391f, -0.017131f, 0.116127f, 0.243365f, 0.149468f, 0.121871f, 0.013980f, 0.174398f, 0.060097f, 0.004001f, 0.014131f, 0.081297f, 0.165022f, 0.122091f, 0.155477f, 0.254630f, -0.012211f, -0.094774f, -0.103609f, 0.154399f, -0.085478f, 0.078628f, -0.103318f, 0.191603f, 0.149805f, 0.083988f, 0.217893f, 0.125971f, 0.105269f, 0.159648f, -0.110134f, -0.050723f, -0.172900f, 0.105716f, -0.141307f, 0.041179f, -0.084532f, -0.046149f, 0.089699f, 0.177617f, -0.186955f, 0.117598f, -0.151041f, -0.134169f, 0.117061f, 0.073335f, -0.081942f, 0.139967f, -0.018541f, 0.068675f, -0.073117f, 0.051698f, 0.250683f, -0.108293f, -0.149914f, -0.096259f, 0.209324f, 0.219394f, -0.198737f, 0.188306f, -0.062331f, 0.029043f, -0.069177f, 0.066450f, 0.195328f, -0.475306f, -0.074130f, 0.168810f, -0.023854f, -0.079813f, -0.077031f, -0.198249f, 0.022537f, -0.187085f, 0.125679f, -0.057381f, 0.040622f, 0.201597f, 0.155717f, -0.062708f, 0.125923f, -0.154313f, 0.107910f, 0.238138f, -0.012512f, 0.133762f, 0.099188f, 0.096807f, 0.190000f, 0.200106f, 0.188891f, 0.004268f, 0.157264f, 0.189453f, 0.011452f, 0.242052f, -0.082062f, 0.156577f, -0.048794f, 0.200603f, 0.023214f, 0.171691f, 0.015199f, 0.124896f, 0.105664f, 0.135043f, 0.020889f, 0.110388f, 0.105357f, -0.038977f, 0.041245f, -0.190474f, 0.300327f, 0.023858f, 0.161226f, 0.113813f, 0.218941f, 0.142704f, -0.067626f, -0.086378f, -0.059229f, 0.027231f, 0.051810f, 0.009304f, 0.106172f, -0.073665f, -0.014932f, 0.133681f, 0.232529f, 0.154842f, 0.049298f, 0.096575f, 0.095525f, -0.162886f, -0.011651f, 0.226762f, 0.257037f, 0.000870f, 0.059435f, 0.074249f, 0.064271f, -0.092409f, -0.114346f, 0.189380f, 0.126309f, -0.111745f, 0.053147f, -0.062011f, 0.125667f, 0.180261f, 0.010396f, 0.006252f, -0.055646f, 0.195429f, 0.052609f, -0.087850f, 0.079967f, 0.111264f, 0.082171f, -0.223272f, -0.219019f, -0.026810f, -0.214989f, 0.058106f, -0.089767f, 0.067356f, 0.088204f, 0.148075f, 0.043559f, 0.164546f, -0.130785f, 0.136597f, 0.183142f, 0.196959f, 0.151520f, -0.037807f, -0.171365f, -0.075240f, 0.066124f, -0.140798f, 0.102514f, -0.182010f, -0.126925f, -0.195848f, 0.155548f, 0.198716f, -0.125464f, 0.018786f, 0.141098f, 0.174856f, -0.154263f, 0.138554f, 0.182585f, 0.140340f, -0.169230f, -0.076605f, -0.108116f, 0.108990f, -0.150637f, 0.185766f, 0.034343f, 0.080548f, 0.124019f, -0.099370f, 0.091809f, 0.200119f, 0.010492f, -0.184742f, -0.125065f, -0.129248f, -0.162575f, -0.159684f, -0.189724f, 0.123686f, 0.196456f, -0.067008f, -0.128601f, -0.084278f, -0.075488f, -0.112602f, -0.078569f, -0.088476f, -0.004032f, -0.116320f, -0.099301f, -0.164303f, 0.117739f, -0.143697f, -0.065161f, -0.097257f, 0.155616f, 0.125165f, -0.048982f, -0.065377f, 0.125476f, -0.047327f, 0.240997f, 0.284392f, 0.186214f, 0.208348f, 0.280944f, -0.056030f, 0.129884f, 0.058969f, 0.210580f, 0.066656f, 0.221220f, 0.101151f, 0.288160f, 0.145994f, -0.126283f, -0.146328f, 0.200393f, 0.079920f, -0.083533f, 0.302179f, 0.180738f, -0.079529f, 0.008349f, 0.253810f, 0.119884f, -0.036087f, -0.014712f, 0.090883f, 0.052237f, -0.019164f, -0.136287f, 0.200468f, 0.179807f, 0.061972f, 0.182947f, 0.188041f, 0.164317f, 0.154521f, -0.099073f, -0.177071f, -0.014864f, 0.235433f, -0.023235f, 0.291269f, -0.117744f, 0.243777f, -0.089509f, 0.112964f, 0.036581f, 0.124822f, 0.268253f, 0.167424f, -0.091638f, 0.087890f, -0.091282f, 0.067425f, -0.104603f, 0.247870f, 0.117853f, 0.019842f, 0.290323f, -0.127097f, 0.213271f, 0.087967f, -0.125210f, -0.085313f, 0.065271f, 0.189722f, 0.212136f, -0.267608f, 0.123333f, -0.039573f, 0.037897f, -0.084964f, 0.240746f, -0.067975f, 0.168984f, -0.124574f, -0.109496f, 0.294338f, -0.125242f, -0.066851f, 0.190508f, -0.025460f, 0.028050f, -0.172160f, 0.158280f, -0.124804f, -0.080269f, -0.212799f, 0.063177f, -0.105630f, -0.002021f, -0.084811f, -0.004516f, 0.043159f, -0.224888f, -0.178248f, -0.102101f, -0.173853f, -0.198277f, 0.171849f, -0.132007f, 0.051297f, -0.021695f, -0.114306f, -0.012071f, 0.200451f, 0.050222f, -0.113276f, 0.043456f, 0.199875f, -0.195492f, -0.168057f, 0.041238f, -0.141372f, 0.191398f, -0.051938f, 0.148383f, 0.005732f, 0.177643f, 0.073855f, 0.027986f, 0.115380f, 0.121828f, -0.039609f, -0.213944f, -0.083576f, -0.201690f, 0.049854f, -0.052225f, 0.099872f, -0.157464f, -0.067286f, 0.125032f, 0.008859f, 0.132948f, -0.213033f, 0.189452f, -0.165422f, 0.074756f, -0.195434f, 0.107008f, -0.074310f, -0.017672f, -0.212606f, -0.066604f, -0.070087f, -0.185705f, 0.165996f, 0.041838f, -0.229588f, 0.204593f, -0.023847f, 0.004854f, -0.053449f, 0.032694f, 0.021440f, -0.152065f, 0.088900f, 0.048670f, 0.243872f, 0.133077f, -0.147693f, -0.147135f, -0.003743f, -0.199068f, 0.019004f, 0.082975f, -0.021362f, -0.062104f, 0.236269f, 0.278855f, -0.128630f, 0.155527f, 0.082159f, -0.092259f, 0.029299f, 0.086960f, 0.140239f, 0.190085f, 0.209157f, -0.051371f, 0.237989f, 0.074412f, 0.242340f, 0.186276f, 0.147278f, 0.111022f, -0.097879f, 0.013848f, -0.055067f, -0.045203f, 0.001505f, 0.136421f, -0.062488f, 0.066849f, -0.022210f, 0.125229f, -0.093095f, 0.146319f, 0.142653f, 0.196431f, 0.066870f, 0.194365f, 0.121640f, -0.017470f, -0.093680f, -0.071666f, -0.131727f, -0.026490f, -0.096951f, 0.194458f, 0.131834f, -0.161809f, 0.184603f, 0.137152f, 0.056192f, 0.149993f, -0.129036f, 0.051030f, 0.065204f, -0.073585f, -0.015125f, -0.162567f, 0.100512f, -0.015961f, -0.069968f, 0.216952f, -0.308439f, 0.244971f, 0.271773f, 0.075902f, 0.108354f, 0.191084f, -0.064638f, 0.026858f, 0.037874f, -0.003091f, 0.041064f };
+static const float prediction_next_power_gen_layer_6_biases[1] = { 0.558927f };
+static const float prediction_next_power_gen_layer_6_weights[48] = { 0.328718f, 0.358232f, 0.323057f, -0.266855f, -0.051430f, 0.169581f, 0.182884f, -0.110854f, 0.183953f, 0.159593f, -0.281252f, 0.192676f, -0.138494f, -0.133048f, 0.125162f, -0.066471f, -0.134311f, -0.005265f, 0.298521f, -0.121588f, -0.169907f, 0.309495f, -0.301920f, 0.196283f, -0.135982f, -0.043573f, -0.269926f, 0.204078f, -0.185081f, -0.119821f, 0.199298f, 0.005367f, 0.299653f, 0.010820f, 0.184812f, 0.148011f, -0.303001f, 0.300981f, 0.302335f, 0.115528f, -0.276861f, 0.213904f, 0.315794f, 0.190732f, -0.211664f, 0.122684f, -0.094062f, 0.211596f };
+static float prediction_next_power_gen_buf1[80];
+static float prediction_next_power_gen_buf2[80];
+
+static void
+prediction_next_power_gen_layer_0(const float *in, float *out)
+{
+  const float *w = prediction_next_power_gen_layer_0_weights;
+  int o;
+
+  for(o = 0; o < 48; o++, w += 5) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4];
+    sum = sum + prediction_next_power_gen_layer_0_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_power_gen_layer_1(const float *in, float *out)
+{
+  const float *w = prediction_next_power_gen_layer_1_weights;
+  int o;
+
+  for(o = 0; o < 80; o++, w += 48) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum = sum + prediction_next_power_gen_layer_1_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_power_gen_layer_2(const float *in, float *out)
+{
+  const float *w = prediction_next_power_gen_layer_2_weights;
+  int o;
+
+  for(o = 0; o < 80; o++, w += 80) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum += w[48] * in[48]; sum += w[49] * in[49]; sum += w[50] * in[50]; sum += w[51] * in[51];
+    sum += w[52] * in[52]; sum += w[53] * in[53]; sum += w[54] * in[54]; sum += w[55] * in[55];
+    sum += w[56] * in[56]; sum += w[57] * in[57]; sum += w[58] * in[58]; sum += w[59] * in[59];
+    sum += w[60] * in[60]; sum += w[61] * in[61]; sum += w[62] * in[62]; sum += w[63] * in[63];
+    sum += w[64] * in[64]; sum += w[65] * in[65]; sum += w[66] * in[66]; sum += w[67] * in[67];
+    sum += w[68] * in[68]; sum += w[69] * in[69]; sum += w[70] * in[70]; sum += w[71] * in[71];
+    sum += w[72] * in[72]; sum += w[73] * in[73]; sum += w[74] * in[74]; sum += w[75] * in[75];
+    sum += w[76] * in[76]; sum += w[77] * in[77]; sum += w[78] * in[78]; sum += w[79] * in[79];
+    sum = sum + prediction_next_power_gen_layer_2_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_power_gen_layer_3(const float *in, float *out)
+{
+  const float *w = prediction_next_power_gen_layer_3_weights;
+  int o;
+
+  for(o = 0; o < 32; o++, w += 80) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum += w[48] * in[48]; sum += w[49] * in[49]; sum += w[50] * in[50]; sum += w[51] * in[51];
+    sum += w[52] * in[52]; sum += w[53] * in[53]; sum += w[54] * in[54]; sum += w[55] * in[55];
+    sum += w[56] * in[56]; sum += w[57] * in[57]; sum += w[58] * in[58]; sum += w[59] * in[59];
+    sum += w[60] * in[60]; sum += w[61] * in[61]; sum += w[62] * in[62]; sum += w[63] * in[63];
+    sum += w[64] * in[64]; sum += w[65] * in[65]; sum += w[66] * in[66]; sum += w[67] * in[67];
+    sum += w[68] * in[68]; sum += w[69] * in[69]; sum += w[70] * in[70]; sum += w[71] * in[71];
+    sum += w[72] * in[72]; sum += w[73] * in[73]; sum += w[74] * in[74]; sum += w[75] * in[75];
+    sum += w[76] * in[76]; sum += w[77] * in[77]; sum += w[78] * in[78]; sum += w[79] * in[79];
+    sum = sum + prediction_next_power_gen_layer_3_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_power_gen_layer_4(const float *in, float *out)
+{
+  const float *w = prediction_next_power_gen_layer_4_weights;
+  int o;
+
+  for(o = 0; o < 80; o++, w += 32) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum = sum + prediction_next_power_gen_layer_4_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_power_gen_layer_5(const float *in, float *out)
+{
+  const float *w = prediction_next_power_gen_layer_5_weights;
+  int o;
+
+  for(o = 0; o < 48; o++, w += 80) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum += w[48] * in[48]; sum += w[49] * in[49]; sum += w[50] * in[50]; sum += w[51] * in[51];
+    sum += w[52] * in[52]; sum += w[53] * in[53]; sum += w[54] * in[54]; sum += w[55] * in[55];
+    sum += w[56] * in[56]; sum += w[57] * in[57]; sum += w[58] * in[58]; sum += w[59] * in[59];
+    sum += w[60] * in[60]; sum += w[61] * in[61]; sum += w[62] * in[62]; sum += w[63] * in[63];
+    sum += w[64] * in[64]; sum += w[65] * in[65]; sum += w[66] * in[66]; sum += w[67] * in[67];
+    sum += w[68] * in[68]; sum += w[69] * in[69]; sum += w[70] * in[70]; sum += w[71] * in[71];
+    sum += w[72] * in[72]; sum += w[73] * in[73]; sum += w[74] * in[74]; sum += w[75] * in[75];
+    sum += w[76] * in[76]; sum += w[77] * in[77]; sum += w[78] * in[78]; sum += w[79] * in[79];
+    sum = sum + prediction_next_power_gen_layer_5_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_power_gen_layer_6(const float *in, float *out)
+{
+  const float *w = prediction_next_power_gen_layer_6_weights;
+  int o;
+
+  for(o = 0; o < 1; o++, w += 48) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum = sum + prediction_next_power_gen_layer_6_biases[o];
+    out[o] = sum;
+  }
+}
+
+int32_t
+prediction_next_power_gen_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+{
+  int32_t i;
+
+  if(n_features != 5 || out_length < 1) {
+    return -1;
+  }
+  prediction_next_power_gen_layer_0(features, prediction_next_power_gen_buf1);
+  prediction_next_power_gen_layer_1(prediction_next_power_gen_buf1, prediction_next_power_gen_buf2);
+  prediction_next_power_gen_layer_2(prediction_next_power_gen_buf2, prediction_next_power_gen_buf1);
+  prediction_next_power_gen_layer_3(prediction_next_power_gen_buf1, prediction_next_power_gen_buf2);
+  prediction_next_power_gen_layer_4(prediction_next_power_gen_buf2, prediction_next_power_gen_buf1);
+  prediction_next_power_gen_layer_5(prediction_next_power_gen_buf1, prediction_next_power_gen_buf2);
+  prediction_next_power_gen_layer_6(prediction_next_power_gen_buf2, prediction_next_power_gen_buf1);
+  for(i = 0; i < 1; i++) {
+    out[i] = prediction_next_power_gen_buf1[i];
+  }
+  return 0;
+}
+
+int32_t
+prediction_next_power_gen_step(uint8_t layer, const float *features, int32_t n_features, float *out, int32_t out_length)
+{
+  int32_t i;
+
+  switch(layer) {
+  case 0:
+    if(n_features != 5 || out_length < 1) {
+      return -1;
+    }
+    prediction_next_power_gen_layer_0(features, prediction_next_power_gen_buf1);
+    return 1;
+  case 1:
+    prediction_next_power_gen_layer_1(prediction_next_power_gen_buf1, prediction_next_power_gen_buf2);
+    return 1;
+  case 2:
+    prediction_next_power_gen_layer_2(prediction_next_power_gen_buf2, prediction_next_power_gen_buf1);
+    return 1;
+  case 3:
+    prediction_next_power_gen_layer_3(prediction_next_power_gen_buf1, prediction_next_power_gen_buf2);
+    return 1;
+  case 4:
+    prediction_next_power_gen_layer_4(prediction_next_power_gen_buf2, prediction_next_power_gen_buf1);
+    return 1;
+  case 5:
+    prediction_next_power_gen_layer_5(prediction_next_power_gen_buf1, prediction_next_power_gen_buf2);
+    return 1;
+  case 6:
+    prediction_next_power_gen_layer_6(prediction_next_power_gen_buf2, prediction_next_power_gen_buf1);
+    break;
+  default:
+    return -1;
+  }
+  for(i = 0; i < 1; i++) {
+    out[i] = prediction_next_power_gen_buf1[i];
+  }
+  return 0;
+}
+
+float
+prediction_next_power_gen_regress1(const float *features, int32_t n_features)
+{
+  if(n_features != 5) {
+    return NAN;
+  }
+  prediction_next_power_gen_layer_0(features, prediction_next_power_gen_buf1);
+  prediction_next_power_gen_layer_1(prediction_next_power_gen_buf1, prediction_next_power_gen_buf2);
+  prediction_next_power_gen_layer_2(prediction_next_power_gen_buf2, prediction_next_power_gen_buf1);
+  prediction_next_power_gen_layer_3(prediction_next_power_gen_buf1, prediction_next_power_gen_buf2);
+  prediction_next_power_gen_layer_4(prediction_next_power_gen_buf2, prediction_next_power_gen_buf1);
+  prediction_next_power_gen_layer_5(prediction_next_power_gen_buf1, prediction_next_power_gen_buf2);
+  prediction_next_power_gen_layer_6(prediction_next_power_gen_buf2, prediction_next_power_gen_buf1);
+  return prediction_next_power_gen_buf1[0];
+}
@@ -0,0 +1,39 @@
+#include "mlp_q8.h"
+static const int32_t prediction_next_power_q8_layer_0_biases[48] = { -30, 17, 25, 45, -56, 27, -6, 42, -27, 15, -34, -13, 17, 17, 29, -4, -28, 14, -1, -76, 48, -8, 0, 29, -27, -3, 12, 6, 13, -14, -29, 16, 13, 32, 46, -27, 9, -22, 4, 30, 50, 58, -13, -12, 43, 8, -23, 14 };
+static const int8_t prediction_next_power_q8_layer_0_weights[240] = { 16, -4, 28, -21, -21, 45, 3, 7, 1, 42, -11, 6, -41, 26, 13, -115, -3, -6, -5, 70, 27, -6, 18, 9, -85, 59, -7, 25, -8, 3, -89, -2, -9, 4, -28, -61, 4, -13, 4, 52, 6, 6, 7, 16, -66, 72, -7, -9, 3, 71, -55, 7, -6, 22, -50, 48, 7, -4, -11, 22, -63, 9, -16, -18, -31, -106, -7, 16, -10, 9, 29, 11, -14, 13, 14, -3, -4, -6, -34, 9, 6, 13, 23, -12, -61, 4, 0, -10, 10, 10, 38, 3, 0, -16, -49, 13, 0, -10, 16, -22, 56, 1, 15, 13, -22, 51, 3, 0, 15, -44, 29, 0, -10, 24, 9, 70, 5, 14, 9, 21, 28, -15, -10, -4, -7, -65, 11, 7, 10, -54, 26, -2, 21, 20, -38, 49, 8, -11, 20, -86, -127, 5, -1, 19, -10, 2, 6, 1, 14, 5, -92, -2, 13, 5, 75, 0, -7, -37, 22, 25, 56, -8, -21, 23, 46, 42, -3, 11, -10, -36, -62, -12, -5, 15, 0, -9, 7, -17, -12, -27, 10, -1, 15, 9, 42, -91, 2, -16, -15, -54, 57, 5, -23, 1, 32, 36, 3, 21, -10, 57, 58, -1, 2, -12, 10, -24, 12, -11, -16, 29, 19, -5, -19, 5, 41, 17, 5, 4, -6, 50, 15, -13, 15, 26, 29, 36, -9, -15, 8, -10, -117, 7, 16, -19, 0, 44, -10, -7, 4, -42 };
+static const int32_t prediction_next_power_q8_layer_1_biases[80] = { -6, -42, 28, 20, -13, 12, 24, 27, -13, 27, 22, -16, 13, 39, 16, -8, -1, 15, 21, 25, 8, 21, 13, -24, 9, -23, 7, 28, 3, 16, 11, 7, -31, 4, 19, 41, 39, 23, -28, 36, -15, 20, 13, -37, 40, 11, 17, 13, 20, -30, 36, 5, 33, 7, -12, 7, 5, 6, 7, 3, 21, 16, -26, 44, -11, 21, 11, 13, 17, -29, 33, 11, -27, -8, -31, -1, -72, 19, -9, 22 };
+static const int8_t prediction_next_power_q8_layer_1_weights[3840] = { 16, -4, 12, 8, -21, 16, 1, -24, 10, -18, -9, 13, -34, 7, -3, 20, -30, -23, 15, 18, -16, 1, -13, 5, 0, -26, -3, 11, -7, -4, 24, 13, -14, -10, -30, 5, 2, -32, 4, 29, -11, 15, -13, -13, -6, 3, 14, 7, 12, 4, 24, 2, -34, -6, -6, 4, -20, 2, 13, 8, -59, -9, 0, 0, -39, 5, -18, 23, -28, 11, -9, -11, 7, -74, -35, 21, -31, 15, -8, 14, -8, -1, -36, 21, -41, 3, -7, -64, -27, -21, 21, -1, -66, 20, -1, 23, -12, 1, 8, 8, 0, 1, 4, -26, -12, 16, -11, -8, -28, 2, 19, 7, -16, 1, -4, -16, -7, -4, -17, 5, 3, -14, 6, 18, 8, 16, -20, -31, 15, 25, -30, -19, -9, -31, 12, 26, 24, 2, 13, -23, 5, 16, 21, 1, 16, 22, -5, -29, 4, -6, 6, 13, 11, 0, 28, 10, -30, -18, -1, 23, 14, 17, -15, 26, 5, 0, -9, -2, -25, 3, -20, 18, -5, -2, 5, -19, -12, -14, -23, -2, -17, -12, 3, 6, 17, -23, 20, 13, 24, 20, -11, -6, 6, 26, -5, -40, 22, 20, -3, -17, 24, -16, -15, -21, 5, 11, -14, 4, -23, 22, 21, 23, -9, 19, 12, -3, -13, 6, -14, -12, -19, -14, 13, 12, 18, -25, -19, -9, -15, -1, -20, -23, -16, -2, -1, -15, -20, 8, -6, 20, -31, 8, 9, -3, 13, -12, -31, 19, 9, -10, -19, 14, -47, 1, -11, 1, -34, 17, 8, 22, 16, -9, -6, 7, -7, -17, -7, 21, -4, 13, 10, -4, 5, 13, -13, 5, 3, -11, -23, -10, -24, -19, -13, -15, 15, -15, 11, 2, -3, -22, -34, -20, -19, 21, -8, 17, 21, 17, -3, 18, 0, 23, 0, 12, -28, 12, 4, 29, 25, 11, -2, -3, -8, 10, -22, 20, -23, 19, -25, -10, 24, -10, -4, 10, -17, -27, 13, 19, 11, -19, 0, -13, 0, 2, -5, 17, 2, -6, 5, 0, 22, 14, -29, -3, 30, 22, -4, -10, -11, -15, 2, 17, 18, -11, 14, -8, 4, -4, 2, 21, 7, -20, 19, 19, -11, 13, -10, -3, 24, 26, -21, 1, 15, -38, 4, -19, -5, 0, -19, 18, -5, 19, 16, 8, -2, -17, -8, -3, -26, 3, -5, -18, -16, 1, 20, -10, -15, -13, 17, -19, 0, -22, -25, -19, -4, 1, -25, 16, -5, -14, 2, -12, -11, 0, -5, -17, 8, 17, -9, 18, 16, -10, 12, -14, 17, -5, 3, -18, -23, -26, -20, 12, -31, 0, -9, -1, -20, 11, 27, 13, 10, 19, 18, -5, 1, 10, -17, 30, -32, 23, 22, 19, -2, 24, 21, 15, -8, -9, 13, -21, 2, -18, -4, -19, -13, -16, -30, -30, -13, -24, 23, -22, 8, 7, -13, -9, -16, 12, -29, 11, -4, 10, 12, -8, -10, 14, -40, -20, -5, 10, 14, -13, -33, 6, 25, 26, -29, 16, 16, 3, 23, -3, 23, -13, 10, -48, -2, -4, -26, -15, 6, -24, 14, -16, -35, -3, -9, -36, 20, 15, 1, 6, -4, 18, 5, -3, -14, -9, -26, 6, 11, 22, -1, -6, 36, 13, 18, 11, -13, -22, 18, -31, -12, 2, -30, 23, 17, -20, 6, 5, -20, -7, 30, 7, -21, -5, -33, 8, -24, 33, -13, 7, -14, -2, -31, 23, -1, -38, 4, 14, 29, 10, -7, 2, -16, -6, 7, -24, -38, -40, -4, -18, -27, 11, -19, 1, 4, -3, 5, -2, -1, 13, -23, -8, -23, 3, 20, 4, 8, -4, -6, -32, 17, 9, -13, -8, -18, -42, 14, -5, -30, -4, 10, -19, 2, 19, 2, -7, 23, -26, 17, -5, -15, 10, -10, -10, -52, -41, 23, 17, -6, -13, -10, -7, -14, -16, -14, -13, -18, 33, -13, 26, -4, 4, -14, -1, 12, 24, 18, 2, 24, 2, -55, -4, -14, -31, -1, 6, 3, 22, -10, 12, 19, 9, 19, -13, -15, 17, 23, 15, -17, 16, 10, 11, 2, 1, 6, -8, -23, 19, -7, 4, 12, -20, -3, 3, -16, -24, -3, 23, -14, 4, -15, 15, 18, 16, 9, -31, 7, -15, 2, 13, -9, -25, -8, 0, 5, -26, -7, -6, 7, -23, -13, 8, -24, -12, 6, 16, -42, 23, -3, 4, 10, 11, -14, -21, 2, -19, -23, -5, -4, -3, -19, -18, -24, -1, 12, -2, -10, -3, -1, -23, 24, 4, -10, -9, 17, -23, -9, -22, -9, -16, -20, 0, -1, 4, 8, -16, -5, -25, 12, -1, -1, 7, -23, 18, -12, -4, 2, -2, 6, -5, -21, -2, 3, -11, -17, -17, 5, 2, -4, 0, -7, -13, 10, 20, -22, -18, -15, 0, -1, 19, -26, -10, 15, -1, -36, 18, 7, -6, 23, 3, -24, 13, -9, -29, 12, -22, 8, -23, 9, 6, 4, -18, 9, -19, 4, 2, -12, -29, 6, -20, 9, 12, 21, -3, -16, -4, -35, -12, 24, -30, 4, 13, -23, 3, 28, 12, 5, -11, -48, 19, -14, 25, -4, 10, 11, -7, -1, 3, -4, -11, 17, 8, -3, 1, -6, -19, 16, -18, -1, 21, -4, -19, -7, 1, -9, -27, -26, -5, -30, 0, -7, -17, 14, -6, 2, -10, 10, 38, -6, -3, 19, 13, 10, -5, 3, 13, -13, -15, 16, 24, -39, -17, -5, -32, 9, 12, -39, 21, -3, -3, 13, -3, 13, -7, -9, -24, 12, -20, 20, 14, -22, -4, -26, 1, 2, 2, -6, 5, -13, 13, 3, 8, 3, -18, 8, 11, 6, 18, 24, -5, 23, 12, 23, 22, -23, -16, 21, 29, -15, 25, 1, -21, 15, 17, -6, -28, 16, -13, 18, -20, 6, 7, -22, -24, 27, -19, -1, 9, -2, -5, -26, -42, -14, 22, 5, -32, 10, -7, 2, 4, -9, 8, -8, 21, -27, 1, -1, -14, 26, 23, 21, 24, -27, -15, 15, 24, -46, -8, -7, -27, 22, -4, -12, 24, -23, -14, -9, 14, -10, -9, 16, 15, 0, -9, 5, 22, 9, 3, -29, -50, -18, 24, -8, -7, 6, 6, 2, -2, 7, -13, -8, 29, -16, -2, -22, 20, 12, 13, 22, -1, -28, -1, 25, -20, -28, -2, 18, -64, 7, 21, -49, -11, 16, -30, -22, 25, 18, 23, -19, -2, 20, -2, -6, 8, -8, -10, -21, -1, 7, 0, -4, 3, 9, 20, 19, -14, -1, -5, 2, 10, -5, 13, 5, -16, 10, 5, -18, 21, -10, -11, -8, 18, -27, 22, 11, 4, 17, -3, -43, -9, 7, -32, -14, -7, -1, -3, -17, 18, 11, -5, -2, -5, 14, -10, -19, 41, 11, 20, 19, 8, -20, 0, -28, 8, -7, 25, -14, 30, 5, 5, -1, -18, -13, 22, 25, -27, -2, 11, -22, 24, 5, -2, -3, -14, 5, -15, -24, 14, -33, 28, -2, -25, 4, -21, -6, -5, -15, -19, 27, 1, -17, 8, -5, -49, -5, 8, -40, 7, 5, 20, 17, 17, 13, 2, 29, -13, 10, 12, -11, -1, 14, 6, 6, 24, -2, -27, 20, 7, -21, 15, -7, -17, -18, 17, -56, 14, 0, -27, -1, 23, 21, 10, 13, -11, 17, 6, -25, -11, -9, 2, -15, 1, 31, -24, -25, -5, -12, -41, 1, 0, 26, 33, -23, 48, -6, -2, 14, -39, 4, 17, 10, 8, -17, 9, 21, -14, 32, 33, 9, 12, -1, -9, -6, 12, 20, 20, -20, -28, -8, -22, 9, -19, 17, -37, 13, 3, -20, -18, -2, -15, 22, 5, -2, 14, -2, -20, 0, -3, -16, 1, 16, 18, 7, -11, -17, -15, 19, -6, 1, -14, -27, -20, 23, 21, -19, -2, -30, 2, 0, 20, -3, -30, -20, -26, -20, -4, -25, -26, 11, 2, -3, -2, -3, 6, -56, -8, -65, -34, -9, -2, 1, -7, -11, -14, -52, -20, 8, -33, 14, -23, -32, -2, -10, -19, 17, -9, 24, 13, -8, 19, 10, 25, -26, 7, -11, -47, 10, 0, -37, -30, -12, -31, 14, 10, 1, -58, 28, 2, 11, 6, -9, -5, -38, -25, -11, -40, 2, 18, -52, -42, -12, -14, -12, 9, -10, 5, 4, 2, -14, 16, 7, 11, -5, -8, 11, 25, -2, -5, -10, 11, -16, 19, 11, 3, 29, -21, -20, 5, 18, -13, 20, -19, -10, -56, -15, 14, 4, 9, 9, -7, -17, 20, -13, -34, -8, 1, -13, -33, -9, 10, 20, 4, -9, 12, -7, 16, -35, 15, 17, 9, 0, 16, 19, -2, -16, -25, -7, -9, -5, 7, 20, 2, 8, 8, -7, -10, 11, 6, 10, 22, 17, 6, 9, -3, -10, 15, 4, 6, -1, -12, 0, 3, 14, -23, 18, 2, -8, 23, -15, -29, 0, -26, -24, -10, -29, 18, -2, -7, -3, 10, -1, 24, 11, -16, -22, -15, -14, -6, -6, 23, -8, 21, -15, -11, -2, 22, 13, 7, -25, -9, -22, -19, 1, 28, -18, -10, 5, 2, 3, -45, -4, 10, 9, -2, 0, -3, 24, 9, -10, 3, -15, 7, 2, -21, -7, -15, 1, 23, 25, 20, -30, 0, -16, 15, -29, -8, -26, 0, 22, 23, -4, 14, -11, -27, -18, -16, -20, 12, -12, 11, 24, 17, -18, 0, -3, 8, 2, 40, 29, 0, -18, -8, 7, -43, 17, -7, 23, 27, -37, -27, -12, -21, 0, 33, -29, -51, -5, -21, -7, 7, -5, -15, 50, 22, 26, -50, 14, 10, 32, -5, 11, -8, -71, 6, -1, -13, -91, 2, 29, -21, 38, -18, 4, -4, -9, -7, 5, 16, -42, -10, 13, -4, 2, -13, -27, 10, -9, 12, -45, -2, -2, -8, 0, 8, -7, -15, -30, -39, -5, 13, -11, 10, -18, -39, 14, -2, -21, 16, -2, -24, 16, 8, 2, -4, 15, -3, 17, -12, 6, 14, -35, 30, -68, -51, -76, -10, 20, -45, -17, 9, -36, -9, 14, -6, 17, 0, -88, 4, -17, -15, -11, -6, 5, 15, -7, -10, -2, -18, 18, 5, 2, -66, 28, -14, -76, 2, 3, -7, 29, 4, 21, -40, 0, -2, 3, 6, -38, -10, -13, 11, -1, -14, -7, 13, -18, -4, 15, -13, 11, 21, -4, 3, -6, 17, 10, 11, 12, -13, 15, 20, -9, -1, -20, -11, -11, -5, -12, 10, -15, -12, 27, 16, 11, 0, -8, -23, 0, 15, -10, 4, -20, 2, 14, -16, -10, 6, -14, -32, 10, 20, -14, -19, -3, 2, 24, -14, -3, -7, -21, -27, 28, 20, -12, 2, 28, 19, -2, 2, -5, -34, 2, -9, -19, 3, 10, -8, 23, 13, 3, -3, 33, 18, -3, 2, 9, -19, -8, 17, -4, -11, -41, -5, -18, 25, 14, 7, -15, -19, -14, 1, -37, -3, -7, -13, 12, 15, -5, 13, 12, 34, -6, -3, 23, -3, 9, -4, -11, 8, -25, -28, 11, 3, -13, 8, -12, 2, 22, 2, -28, 8, 14, -25, 27, 23, 24, -1, -8, 14, 30, 17, -22, 15, 8, -19, -16, -16, 15, 22, 7, -9, 17, 3, 21, 11, -33, -13, 11, 9, 1, -22, 5, -7, -13, 10, -5, 3, -10, 1, -13, -12, -19, -1, 11, 4, -14, 20, -15, -21, 6, -12, -17, 10, -23, 13, -25, 15, 9, -9, 0, -14, -18, 24, -64, -12, 14, 9, -28, -8, 12, -14, -35, -3, -1, 23, 6, 5, -21, 23, -11, 23, 20, -18, 6, 19, -26, -5, 6, -6, -2, 18, -8, -44, -3, 3, -18, 3, -9, -93, -8, 17, 12, 13, -3, -2, -9, 11, -5, 3, 11, -10, 6, 6, 16, 31, -12, 13, -13, -26, 7, -14, -53, -5, -9, -23, -8, -20, 15, 17, 17, -5, -3, 14, 5, 13, -17, 10, -10, 4, -28, 12, -28, -12, -22, -2, 30, -9, -10, -1, 22, 10, 4, -12, 12, -15, 0, 7, -13, -4, -12, -33, -24, 7, -16, -39, 28, 11, 0, -14, -10, -10, -2, 26, 17, -9, 28, -16, -5, 7, 12, 11, -27, -4, 25, 8, -52, -6, -22, -34, 6, 3, -36, 10, 5, 3, 18, 9, 12, -23, 0, 19, 3, 25, 7, 22, -37, -6, -24, -40, -26, -11, -2, -43, 12, 20, 15, 5, -4, -49, 20, 35, 8, -17, -5, 7, 26, -8, -10, 22, -5, 23, -19, 9, -30, 2, 9, 7, -4, -16, -50, 36, 18, -12, -1, -4, 19, -11, -13, -16, 0, 8, 17, 6, 12, -22, 20, -23, -36, -44, -44, -7, -10, 8, 5, 4, -9, -72, -5, 40, -11, -3, 10, 2, -31, 7, -8, -12, 0, -62, -30, 23, -37, 5, -57, 35, 7, -20, -41, 37, -68, 8, 21, -58, -32, 1, 32, -40, -127, 6, -41, 9, -19, 6, -94, -15, 4, 13, -66, -23, 14, -1, -42, -10, -32, 10, -6, 6, 11, 8, -12, 27, 26, 22, 20, 9, -33, 15, 17, -17, -17, 7, 6, -81, -9, 12, -15, -39, -10, -22, 28, -13, 10, -8, 10, 6, 26, -11, 28, -14, 20, -6, -6, 1, -17, -7, -22, -19, 16, 9, 4, 13, 10, 4, -4, -3, -20, 21, 24, 16, 23, 10, 25, -15, 12, -24, 14, 2, -10, 13, -7, 12, 8, -16, -9, 16, -15, -9, -2, 22, 18, -9, 1, 18, -18, 16, -17, 4, -26, 22, 1, -21, -4, 12, -20, -1, -14, -3, 27, -8, 2, 23, 17, 17, 9, 7, 21, 6, -18, -14, -1, 25, 0, -8, -11, 29, -19, 27, 18, -19, 23, -9, -29, 16, -9, -13, -5, -12, 18, -12, -18, 11, 19, 10, -16, 9, 22, -20, -6, -18, -9, 15, -15, -14, -13, -8, 13, 21, -3, 4, 12, 0, 14, 20, 17, 6, 7, -4, 16, 16, -15, 18, -13, 6, -36, -13, -25, 11, 9, -12, -5, -21, 18, -18, -13, 5, -15, -18, -10, -17, 20, -14, 19, -5, -18, 15, -26, -34, -19, -2, -16, 6, 8, -6, 5, 16, 3, 12, -5, 17, 1, 1, 11, -14, -8, 13, 13, 20, 11, 7, 6, 29, -26, -9, -29, 5, 29, 23, -22, 2, 8, -38, 15, 21, 3, -4, -1, -15, -6, 19, 5, 23, -5, -26, -1, 16, -63, -41, -34, -3, -9, -2, 5, 20, -59, -31, 13, -17, -29, 6, -12, 30, -26, 10, 14, -14, -61, -66, -1, 22, -2, 4, -35, -1, 7, -36, -39, 1, -76, -37, 7, -70, -9, -9, 10, 2, -72, 21, -22, 4, -16, -3, -73, -21, -23, -3, -44, -17, -14, 20, 14, -10, 0, -4, 19, 22, 21, 19, -16, -14, -6, 17, -7, 22, -31, 7, -19, -19, -38, -9, -10, -51, 5, -4, -25, -4, 14, -23, 6, 16, 22, -15, 15, -18, -3, -11, 24, -26, -5, 9, -13, -29, -36, 11, -42, -17, -25, -6, 17, 24, 8, 6, 1, 9, -40, 20, -17, -21, -23, 0, 14, 9, -22, -8, -29, -7, -6, 5, -24, -1, 15, -20, -23, 1, 3, 6, 26, 11, -1, -22, 24, 15, -16, 20, -16, 3, 1, 27, -73, 0, 28, 32, -11, -10, 0, -8, -42, -15, 8, -13, 31, -8, -21, 31, -16, 4, 16, -6, 26, 0, -31, 11, 2, -14, -22, 31, 1, -89, -10, 30, -37, 5, -9, -76, 16, 6, -11, -3, 6, -11, 18, -4, 8, 1, 14, 6, -10, -13, -7, -12, -17, 14, -11, 8, 3, -11, -34, -15, -19, 16, -2, -12, 19, 4, 25, -15, 24, -16, 11, -9, -13, 2, -30, -3, -13, -25, 18, 13, -14, -5, 2, -3, 15, -18, 0, 2, 10, 1, 25, 21, -29, 9, -6, -8, 1, -49, -60, -16, -36, -38, -18, 29, 34, 30, -38, -45, -3, 29, -49, 20, 19, -19, -20, -13, 22, 10, -6, -23, -16, -2, -40, -13, 1, -4, -12, -9, -16, 17, 7, 4, 17, 34, 30, 1, -9, -3, -17, -9, 22, -8, -35, 10, -30, -9, -5, 18, -10, -5, -2, 7, 11, 13, -21, 9, -1, 16, -1, 18, 17, -9, -19, -7, 5, -20, -16, -21, 15, 13, 2, 5, -20, 7, -17, 2, -40, 6, -13, -32, 19, -5, -9, -21, 16, 6, 6, 0, 9, -3, -27, 1, 24, -19, -73, -13, -29, -22, -21, 24, 25, -6, -53, -17, 33, -78, -91, 23, -6, 27, 17, -8, 8, 8, -18, -19, -7, -16, 11, -4, -7, -10, -16, 13, -37, -6, 22, -25, 3, 20, -21, -45, 19, 17, -18, -5, -34, -16, 13, 13, -2, -26, 5, 15, -26, -38, 21, 0, -37, -11, 4, 10, -1, 30, -10, -16, 3, -14, 24, -18, 3, 13, -15, 0, -18, 24, -38, -10, -26, -21, -4, -8, -33, -9, 17, -2, 18, 7, -18, -18, 3, -13, 16, -14, 2, 11, 10, 13, -11, -40, -13, 27, 4, -23, -25, -14, 38, 28, -16, -4, -8, 22, -10, 5, 8, 12, -20, 20, -20, -23, -13, -1, -21, -8, -35, -21, -18, 21, 6, 1, -33, 21, -4, -9, 24, 19, 12, 8, 5, 21, 4, -16, -8, -11, -12, -27, -21, -16, 3, -24, 5, 9, -10, -6, -17, -19, -9, -22, -13, -5, -1, -14, 18, -8, 1, 9, 18, -7, -15, -8, 10, 12, -15, 5, -9, 8, -22, -5, -11, -17, 14, 1, -18, 1, 7, -33, 9, 8, 3, -10, 12, -2, -3, 19, -36, -7, 15, -11, 8, 3, -10, 16, -18, 13, 12, 10, 15, -11, 21, 0, -16, 10, -7, -10, 10, 8, 8, 18, 14, -9, -7, -12, -25, -9, 23, -3, -29, -14, 16, 4, -24, -12, 1, 22, -16, -16, -13, -9, -7, -7, 1, 19, -21, -15, 6, 24, -2, -11, 24, 23, -4, -11, -14, -19, -13, 21, -29, 18, 24, -14, -4, -13, 28, -6, 5, -28, 10, -8, -28, -3, 13, 9, 20, 10, -39, 18, 1, -21, 5, 0, -4, 21, 27, 0, 14, 1, -5, -5, 18, -17, -29, 11, -4, -7, 31, -9, -20, -14, -5, 20, -23, 16, -25, -12, -13, -22, 7, -23, -9, -6, 8, 5, -11, 9, 28, 23, 0, -11, -4, -28, 7, 11, 6, -26, -40, -9, 22, -15, -23, 10, 8, -15, 20, -30, 6, 3, -27, 3, -60, -15, 0, -4, -12, -4, -9, 9, -35, -23, -1, -2, -9, -2, -26, 23, -15, -21, 1, 17, -18, 24, -38, -24, -1, -12, -56, -13, 6, -21, -4, 12, 3, -11, 21, 8, 1, 19, 15, -19, 0, -15, -14, 21, -31, 15, 17, 22, 18, -44, -27, -18, -8, 13, 18, 27, -13, -5, 2, 10, -2, 20, -7, -18, -21, -2, 2, -18, -11, 7, -32, 3, 6, 5, -21, -5, -12, -5, -22, 0, -30, 31, 29, 14, -14, -11, 15, -2, -6, -6, -1, -11, -22, 21, -1, -21, 2, -29, 19, 14, -15, -7, 25, 15, -7, 2, -20, 2, 23, 25, 0, 16, 18, 17, 28, -3, 5, -1, -33, 15, -2, -8, -13, 30, 13, 12, 0, 3, -28, -14, -20, -33, 0, 13, -16, 21, 8, -16, -18, 27, -13, -1, -15, 1, -12, -39, -3, -17, -17, 13, 15, -17, 12, 14, -34, -1, -3, -52, -23, 7, -17, 35, -12, 14, 19, 20, -45, -4, -18, -4, -43, -10, 2, 6, 26, 6, -48, -17, 21, -33, 9, -11, -7, -49, 12, 13, 25, 3, -31, -5, -39, -3, -28, -27, -20, 6, -12, -31, 21, -20, 29, 15, -32, -2, 15, -9, 4, -2, 0, -11, -11, 12, 4, -16, -35, 2, -18, 29, -7, 16, -22, 4, 10, -8, -10, 16, 13, 16, 16, 17, 6, -37, -5, -18, -15, 27, -2, 28, 1, 21, -24, -37, -23, -19, -31, 7, 23, -18, -16, -1, 3, -35, 5, 23, 14, -1, 5, 18, 20, -18, -7, 3, -17, -36, 23, 23, -25, -10, 10, -3, 17, -10, -54, 3, -6, -33, -10, 17, 7, -10, -3, 8, -14, 30, 10, -1, -23, 6, 9, 14, -5, -5, -2, -6, -25, -3, 20, 14, 15, -8, -17, 28, -23, 2, -1, 14, 9, 17, 1, -24, -35, 12, 10, -6, -1, -24, 9, -16, -3, -4, -18, 27, -25, 6, 24, -10, -30, 18, -14, -12, 7, -3, -34, -2, -18, -16, -18, 12, -4, 8, 3, 5, 13, -19, -70, 10, -22, 23, 18, 25, -43, -12, 3, 3, -6, 1, 9, 7, -23, -16, -5, -2, -36, -16, 2, -48, 2, 5, 4, -10, -4, -33, 24, -1, -1, 20, -11, 16, 32, -11, -26, 8, -16, 4, -2, -42, -5, 13, -24, -23, -9, 4, -5, 6, 8, -26, -18, 7, 1, 3, -12, -6, 3, 22, -18, -21, -29, 19, -15, 23, -30, 20, -21, -25, 10, -4, -33, 1, 11, 4, 24, -17, -7, 6, -13, -11, 10, 3, 15, 11, -23, -15, 19, 22, 6, 21, 10, -4, -14, -23, 24, -27, -21, -9, -13, -22, -14, -5, 12, 12, -2, -9, 15, -15, 14, 8, 1, 0, 19, -4, 9, -11, -14, -27, 1, 6, 0, -26, -8, 12, 0, -5, -24, 3, 15, 7, 5, -16, 4, 7, -22, -26, 16, -18, -36, -27, -14, -2, -21, -27, -23, 21, -11, -1, -31, 13, 11, -25, -16, -12, 15, 14, -15, -28, 15, 20, -30, -3, -2, -20, 1, -29, -2, -16, 4, -39, -23, -9, 11, -20, 20, -5, 13, -29, 6, 8, -37, 20, 20, 3, 0, 6, -28, -14, 26, -29, 39, -10, -17, 6, -10, 20, 2, 18, -34, 3, 23, 25, 2, -12, -51, 12, 23, -11, 34, 11, 13, 13, -10, -14, 4, 9, -18, 22, -23, -25, -13, -25, 7, 15, 22, -29, -7, -22, 23, -20, -10, 6, 7, -17, -22, 13, -9, 3, 11, 20, 18, -19, -18, -2, -18, -1, 5, 7, -12, 16, 6, 18, -22, 10, -9, -16, -20, -15, 1, -3, 5, 21, 2, -9, -25, 4, -5, -9, 19, -6, -15, -14, -19, -5, -14, 27, 4, 26, -21, -54, 26, 11, 3, -40, 3, -9, -5, 16, -10, -76, -25, -30, 5, -9, 6, -25, 2, 14, -27, 28, -15, -27, 4, -20, 18, 25, -28, -19, -33, 3, -19, -65, 9, -35, 0, 8, 1, -41, -42, 11, -7, -19, 2, 15, 2, 3, -47, -45, -14, -5, 20, -21, -11, -18, -47, -20, -10, 30, 22, -5, -46, -1, -1, 3, 21, 17, 12, 17, -8, -16, -9, 3, -34, -23, -11, -18, -7, 0, -17, 5, -2, 12, 0, 12, -23, -10, -9, -2, 29, -9, -31, 28, -20, -14, 0, -1, 9, 5, 18, 0, -22, 6, 27, -7, 14, 3, 3, -9, 18, 8, -6, -4, 13, -1, -6, 11, 0, 27, 8, -20, -8, 7, -12, -28, 4, -3, -33, 6, -10, 6, 15, 6, -18, -28, 7, -13, -27, -9, -12, -35, -6, -19, -33, -8, -3, 24, -29, -9, 16, -3, -3, 7, -12, 30, -18, -16, -14, 19, -2, 22, -16, 19, 7, -10, -23, -31, -11, 6, -30, -6, -18, 7, 27, -7, 3, 28, 28, -28, 0, -14, -3, -34, 1, 19, 14, 7, -15, 13 };
+static const int32_t prediction_next_power_q8_layer_2_biases[80] = { 12, -79, 62, -40, -16, 54, 22, 9, 39, 57, -41, 5, 36, -7, 30, 71, -4, 35, -7, 40, 4, -13, 54, -16, 76, 51, 61, 31, -15, 64, -3, 48, 57, 47, 46, -23, -9, 54, 64, 62, 48, -29, -73, 62, 48, 51, 45, -23, 16, 63, -2, 54, 92, 51, 47, 22, 61, 59, 20, 47, 61, -22, 55, 37, 57, -23, 32, 3, -22, -5, 61, 19, 22, 51, 40, 54, -14, -40, 2, -18 };
+static const int8_t prediction_next_power_q8_layer_2_weights[6400] = { -23, 42, 25, -15, -32, -13, 4, -24, -28, 16, -24, -24, -29, -27, -26, 18, 8, 6, 10, 13, -15, -28, -31, 12, -1, -17, -2, 45, 1, 14, 28, -18, -32, -24, 22, -16, 0, 6, -16, -8, -18, 4, 2, 93, 32, -3, 10, -10, 18, 31, 13, 2, 4, 17, -20, 19, 28, 24, -49, -21, -25, -17, 19, 14, 0, -32, 41, -3, -12, -1, 32, -7, -59, 2, -27, -35, -45, 9, -21, -20, 24, 14, -24, 7, -3, -13, -20, -2, -7, 4, 20, -17, 22, 12, 6, 29, -14, -1, 27, 11, -3, 32, -10, 41, 3, 22, 15, -2, -16, -15, -6, -23, -18, -29, 1, 5, -9, -16, 22, 29, -3, 0, 3, 3, -16, 13, 18, -9, -29, -46, 3, -16, 0, 22, -11, 1, -3, -4, -13, -14, 19, 9, 30, 4, -3, -1, 20, -40, -24, -23, 11, 4, 22, -29, 16, -26, 17, 2, -15, 22, 40, 15, 11, -24, 19, 18, 12, -7, -25, -20, -10, 30, 29, 29, -29, 26, -2, 28, 22, -7, 33, 25, -13, 12, -12, -8, 28, 9, 10, -21, -1, 15, -52, -2, 73, 17, 22, -23, 11, -4, 28, 5, -1, 97, 7, 27, 34, 0, -13, 53, 7, 39, 34, -18, 52, -13, 19, 2, -15, -3, 29, 38, 17, -16, 26, 35, 25, -8, 24, -6, 35, 30, 22, 27, -36, -18, -69, 35, 19, 2, -31, 4, -7, 23, -10, 19, 5, -35, -9, 9, 26, -19, -21, -13, -23, 2, -19, 15, 23, -28, 4, -6, 12, 16, 18, -61, 1, 9, 7, 22, -28, -32, -19, -23, 44, 12, 0, -29, 13, -11, -30, -6, -12, 18, -33, -7, 14, 1, 2, 36, 3, -11, 8, -29, 3, 22, -5, 5, -15, 20, -28, 22, 17, -25, -11, -8, 21, -19, -26, -13, -27, -26, -30, 14, -25, -9, -4, 0, 10, 17, 10, -18, -1, -14, 3, 3, -3, -29, 24, -33, -27, 9, -22, -28, 18, -8, 26, -25, 0, -14, 8, -2, 2, -16, -18, -14, -11, 3, 9, -1, 2, -10, 4, -1, 18, -18, -17, 24, 17, -36, 24, 3, 1, -30, 0, -10, 9, 21, -11, 23, -24, -33, -32, 21, -4, 0, 17, -1, -30, -14, 16, -12, 16, -30, -10, -31, -1, 20, 19, 10, -23, -7, 17, 18, 15, 18, -30, -28, 10, -20, 17, 20, 15, 20, -36, 8, -1, 21, -7, 19, 27, 24, -1, -6, 9, 27, -11, 23, -7, 34, 30, 4, -15, -32, 26, -20, -25, 33, 6, 7, 6, -13, -21, 34, 30, 2, -15, 17, -18, 24, 20, 31, 34, 41, 13, 22, 9, 24, 20, 54, 28, -9, 21, 18, 17, -30, 53, -25, 28, -5, 4, -1, -28, -23, 5, 31, 40, -21, 13, 17, 18, 17, 8, 1, -22, 2, -34, 1, -15, 3, -11, 8, -11, -23, 13, -5, 17, -27, 32, -3, -18, 0, 9, 23, 24, 19, -1, -18, 36, -20, -5, 31, 0, -11, 0, -42, 22, 37, -23, 2, 10, 16, -23, -20, 43, -13, -26, -16, -27, 13, 12, 24, 18, 52, -16, 6, -9, -25, -25, -28, -24, 11, 3, -9, 1, -11, 55, -4, 40, 31, -15, 31, -17, 32, 19, 30, 1, -17, 10, -11, 1, -17, -4, 6, -60, -22, -45, 33, -9, -28, 2, 16, 44, -51, 31, -20, -27, 20, -22, -34, -28, -66, -3, 34, 62, 27, -1, -8, -62, -31, 6, -70, -15, 14, 2, -42, 26, -26, 6, -3, -57, 24, 46, -53, -4, 3, -39, -52, -18, -9, -13, -42, -8, -10, -52, -11, -27, -20, 2, 17, 24, 14, -7, -19, -29, 9, 7, 2, 20, -45, 63, -46, 37, 6, 20, 6, 4, -13, 29, -36, -17, 0, -44, -23, -43, -39, -27, 22, 16, -22, -3, -36, 27, 26, 28, -17, 13, -27, 5, -4, -26, -7, 19, 4, 17, 9, 9, -24, 5, -18, 2, 32, 19, 11, 8, 21, 25, 42, 18, 0, -17, -25, -3, -3, 57, -24, -33, 30, -32, 24, -26, 24, 4, 29, -20, -33, -24, -19, 20, -18, 22, -20, 10, 0, 10, -23, 13, -22, 9, 8, -11, -20, -44, -21, 1, 21, -20, -21, -3, -32, 4, 6, 11, 9, -7, -32, -70, 18, 11, -17, 28, 19, -22, 17, -6, -29, 30, 1, 6, 11, 22, 19, 39, -20, -26, 31, -9, -8, 0, 11, 36, 37, 12, -16, 35, 3, -20, 14, -17, 21, -23, -19, -8, -1, 47, 23, 27, -4, -11, 17, 7, 18, 36, 41, -5, 1, 11, -18, -21, 50, -13, -3, 45, -2, -1, 9, 5, 29, -4, -14, 4, 26, -5, -22, -5, 0, 42, 5, 8, 13, -8, -1, 17, 34, -46, 3, -66, 28, 13, -23, -34, 2, 18, -15, -42, -25, -1, -40, 1, 27, 34, -29, -39, 7, -16, 28, 26, -26, -17, -20, 16, -11, 25, -26, -26, -14, 5, 17, 16, 22, 7, -35, -6, -3, 58, 28, -54, 29, 17, 24, -45, -4, 19, -38, 1, -30, 1, 10, -6, -44, 36, 47, 9, -22, 41, 5, 15, -2, -24, -32, 2, -25, -14, 14, 0, -28, -22, 23, -13, 1, 29, 26, 16, -54, -12, -14, -74, 15, 9, 7, 4, 56, -18, -9, 9, -6, 26, -21, -25, -4, 6, 23, -11, 11, -33, -22, 3, 0, -23, 6, 32, 2, -22, -43, 15, 6, 17, 13, 12, 17, -9, -31, -44, -11, 56, -8, -19, -15, 1, 1, 10, -10, 33, 45, -23, -17, -31, -29, -14, 74, -8, -5, 40, 5, 14, 27, 58, -9, 25, -13, -8, 26, -36, 5, 27, -12, 28, -25, -32, 28, 7, 9, 2, -3, -12, -4, -78, 16, -13, -23, -29, 2, 2, -20, 24, -23, -35, 3, -11, -29, -11, 28, 15, -5, -29, -14, -2, 26, -31, 12, -17, -27, -17, -6, 19, -14, -18, -3, 24, -4, -1, -22, -57, 16, 35, -8, -8, -30, -8, 10, 32, -10, 22, 86, 23, -5, -30, -9, -25, 52, -35, -28, -14, 8, -21, -9, -5, -17, -22, 25, 16, 13, -6, 30, 17, 26, 42, 8, -12, 34, -19, -24, 27, 11, 10, 31, -15, 13, 1, -27, -36, -38, 10, 4, -34, 31, -24, -20, 1, -6, -18, 1, 2, -27, -2, -15, 0, 29, 29, 1, -27, -36, 29, -23, 26, 13, -24, 18, -9, -17, 24, -16, -1, -3, -6, 29, -59, 22, -27, -24, 11, 10, 22, -30, -40, 27, -12, 9, -28, -8, 7, 8, -7, 1, 12, -23, 34, 11, -28, 29, -7, 7, 4, 13, -19, 10, -2, 15, -26, -11, -29, -23, -18, -4, 15, -23, 10, 13, -9, -4, 29, -8, 25, 36, 29, 35, 30, -21, 3, -48, -8, -108, 11, 9, 41, 26, 5, 11, -14, -17, 31, -6, -1, 24, 2, 6, 28, -23, -21, 40, -46, -18, -6, 14, -19, 4, -70, 13, -20, 17, -17, -22, 8, 6, -52, -16, -16, -12, 32, 7, 50, -24, -30, -7, -13, -11, -25, -9, 27, 16, -17, 18, 38, 9, 10, 22, -9, -24, 14, -38, 9, -5, 9, 12, -7, -24, 18, 32, 20, 6, 32, 66, -13, -2, -8, 2, -3, 32, -16, -17, -6, -3, 29, 43, -9, 0, -25, 2, 7, 37, -6, 3, 11, -26, 17, -44, -18, 45, 9, 25, -23, 30, -44, 40, 68, -15, 32, 24, -23, 27, 0, 7, 14, 70, 46, -4, 19, 15, 23, 25, 43, -4, 22, 27, 35, -19, 26, 3, 5, 15, 29, 37, -23, -5, 26, -3, 31, 13, 0, 23, 9, 26, -20, -6, -41, 17, -62, 23, -13, 21, 30, 17, -13, 30, -16, 6, -12, -33, -31, -69, -34, -44, 16, 32, 61, 10, -26, 11, -69, 17, -21, -58, 4, 37, -46, 1, 6, -32, 7, -66, -81, -26, 46, -81, 20, -22, -22, -70, -27, -19, 12, -42, 16, -46, -93, -46, -27, -35, -30, -9, -81, -19, -28, 4, 20, 6, 2, -45, -19, 24, 43, -23, 48, 22, 42, 20, 5, 3, 40, 7, 20, 3, 1, 8, 13, 2, 9, 29, 49, 19, 7, 25, -27, 9, -12, -5, 22, 15, -22, 18, -29, -4, 1, 20, 2, 10, 7, 22, 32, -9, -14, 27, -14, -52, 11, -59, -13, 44, 5, -13, -13, 22, -81, -14, 76, 14, -24, -16, 15, 2, 12, -18, 31, 55, -19, -7, -16, -26, 11, 39, 3, 29, 31, -17, 21, 4, 42, 26, 9, -5, -21, -33, -38, 25, -6, 15, -20, -8, 17, 5, 28, -24, 3, -16, -25, 20, -72, -13, 5, 8, -5, -5, -7, 21, -31, -10, 4, -32, -13, 21, -21, -34, -22, 5, -2, 6, -31, 23, 22, 12, 12, -1, -26, -37, 24, -23, -20, 23, 25, -34, -29, -24, -34, 16, 12, -13, -22, 11, -31, -6, 1, 0, 9, 2, -4, -36, 2, -8, 25, 6, 27, 9, -8, -30, -21, -12, 14, -9, 21, -7, 24, -11, -37, -30, 6, -12, 12, -22, 10, 2, -10, -1, 0, -20, -16, -31, -13, -24, 23, -13, -28, 9, -19, -18, 26, -7, -23, -22, -22, -10, -19, -27, 34, 4, -29, -18, -27, -14, -10, 1, 15, 29, 16, -2, 18, -5, 3, 7, 36, -26, 4, -27, -73, -13, 56, 25, 33, 32, 19, -3, -8, 34, -19, 57, 10, 25, -19, -25, 24, 41, -15, 33, 20, -16, 57, -19, 26, 29, -13, -20, -18, -18, 10, 30, 9, 26, 24, -22, -24, 2, 34, 4, -63, -19, -39, 26, -41, 5, 10, 27, 27, -9, 38, -17, 26, 9, 11, 15, -6, -6, -14, -18, 19, -40, 26, -30, 18, 19, -27, -10, -22, -31, 16, 30, -5, 5, 20, -2, 49, 12, 42, 10, 7, -2, -25, 8, -72, 27, -40, -22, -46, 22, 4, -36, -53, 6, -3, -34, 2, -50, -30, 20, -27, -3, 14, 34, 9, 16, -23, -13, -18, -6, -7, -50, -4, 32, 38, -8, -3, -12, 10, -9, -20, 17, 34, 3, -44, -24, 36, 38, -17, -24, -27, -23, -20, -31, -35, -24, -27, 26, -7, 12, 12, 18, 10, 11, -23, 11, -29, -5, -22, 17, -32, -20, -6, 4, -33, -17, -17, -14, -9, 12, -32, 22, 8, -27, -19, -24, 29, -28, -6, -21, -26, -8, 16, -19, 10, 5, 5, 0, 20, -24, -6, -25, 24, -23, -13, -22, -23, -31, 26, 22, -30, 9, 12, -15, -8, 23, 2, -9, -7, 7, 3, 5, -30, 8, -9, 2, 16, -5, 29, 61, 25, -11, -20, 31, 30, -15, -18, 28, 21, 1, 10, -9, 14, -12, 10, 2, 30, 14, -14, -2, -15, -37, 34, -40, 24, 19, -2, -5, 5, -3, -1, -14, 71, 28, 27, 17, 32, 39, -7, 13, 37, 41, 17, 18, 8, 19, 20, 56, -1, 22, 26, 8, 2, -16, 54, 12, 14, -11, 10, -21, 25, 25, -1, 6, 25, 16, -22, -6, 4, -4, 0, 26, 11, -5, -37, -4, -28, 21, 4, 20, -4, 11, 12, 19, 16, -32, 2, -68, -14, -60, 2, -30, 38, 11, -30, -5, -41, -23, -37, -33, -8, 40, -12, 34, -9, 15, -33, 2, -59, -70, 36, -75, -15, 0, -3, -39, -41, -54, 5, -61, 8, -4, -38, -48, -70, 11, 0, -29, -58, -29, -78, 8, -10, -21, 19, -43, -8, 1, 15, 12, -23, -13, -10, -18, -19, 22, 17, -57, -3, -32, -36, -31, 13, -26, -8, 12, 40, -10, -30, -58, 18, -4, -21, 13, 31, -10, -5, 1, 11, -60, 46, 25, 49, -21, 1, 2, -7, 24, -83, 8, -34, 15, -17, -32, -32, -12, -25, -41, -33, -6, -85, -39, 21, 15, 8, -36, -19, -11, -21, 14, 6, -52, -53, -67, -5, 16, -37, 3, -3, -26, -20, -17, 18, -1, -12, -46, 5, -32, 37, -43, -103, 38, -86, -14, 50, -40, -9, -45, 32, 9, 50, -21, 42, 38, 15, -5, -13, 30, 34, 3, 9, 21, 10, 22, -22, 17, -1, -27, 37, -2, 37, 39, 21, -5, 19, 32, 39, 9, 7, -4, -17, -23, 15, -4, 11, 6, 20, 11, 3, 13, -14, 12, 64, 10, -22, 19, 3, -10, 32, 35, -6, 53, 10, -6, -16, -7, 22, 54, 42, -6, 19, 0, 13, -5, 21, 23, 1, 7, 4, 13, 2, 5, 17, 10, 14, 27, -2, -14, 40, -15, -24, -15, -18, -8, -69, 32, -11, -11, -10, 10, 31, -13, 6, 14, 27, -5, 33, -5, -8, -5, 20, 31, -18, -24, 29, -24, 2, 8, 0, 5, 3, 10, 14, -17, 23, 4, 16, 6, -24, -15, -29, 11, 67, -8, 35, -10, 13, 31, -22, 35, 26, 64, 35, 8, 6, 0, 16, 43, 19, -8, 44, -15, 38, -16, 38, 19, 37, 28, 27, -20, -33, 7, -28, 6, 6, -5, 20, 18, 40, -18, 11, 27, -12, 4, -33, 33, -23, 16, 19, 51, 19, -9, 9, -11, -12, -24, -12, 13, 14, 21, -22, -10, 15, 4, -25, 15, -19, -11, -11, 14, 26, -52, 18, -71, 15, 12, -16, -30, 20, 14, -76, -20, 25, 1, -24, 15, -13, -25, -29, 7, 10, 48, 10, 26, 19, 6, 14, 42, 3, -10, 24, 24, -8, 24, 27, 16, 20, -31, -31, 26, -5, 33, -10, 19, 12, -4, 4, 30, 30, 22, 16, 13, -21, -2, -43, -12, 19, 23, 24, 11, -21, -32, -19, -2, 20, -39, -27, -40, -19, 19, 13, -17, -2, -21, -13, 5, 12, -24, 13, -21, 3, -20, 13, -15, -31, 26, -35, 9, 6, -9, -26, 13, -3, 24, -34, 14, -20, 17, 22, 14, -33, -25, 8, -14, 2, -9, 21, -21, 4, -19, -18, -23, -27, -23, 31, -33, -43, -22, 1, 18, -25, 24, 34, -27, 25, 20, -19, -17, -14, -16, -29, -8, -28, -11, 4, -26, -13, -27, 11, 14, 25, 8, 7, 19, -18, 21, 27, 36, -2, -29, 26, -1, 7, 24, -17, 21, 17, 31, 33, -18, -18, -15, 5, -20, -9, 42, 12, -23, -9, -17, -2, -5, 30, 35, 40, 14, 29, 19, 26, 29, 43, 80, 3, -5, -15, -18, 33, 35, 22, 17, 33, -7, 11, -26, 10, -12, 30, -20, -7, 16, -8, -9, 27, 7, -13, 19, 0, -25, 16, -4, -3, 37, -29, -20, -11, 16, -6, -17, -11, -21, 9, -2, -23, -24, -26, -25, 12, -15, 24, -26, -5, 30, -7, 3, 24, -22, -1, 18, -6, 30, 20, -11, -21, -30, 8, 11, -2, -5, 19, -7, -25, 6, -10, -12, -28, -29, 2, -24, -32, -21, 18, -4, 9, -7, 20, -20, 12, -13, -30, -6, -25, -19, 23, 32, -24, -11, -2, 6, -8, 26, 11, -10, 21, 24, -22, -7, -10, -17, -30, -3, 23, 25, 12, -27, -20, -24, -28, -8, 17, 8, -20, 20, 13, 5, -3, 34, 26, -17, 36, -4, -19, -6, -6, -5, -5, 11, -24, -7, 19, 26, 0, 2, 3, -27, 28, 17, -7, -4, 21, -14, -4, 18, 53, 24, -18, 6, 6, 3, 16, -8, 25, 76, 14, 7, 14, 19, -20, 79, -2, 16, 3, 24, 35, -13, 20, 23, 29, 3, -17, 1, -15, 34, 33, 21, -17, 31, -4, -10, -19, 14, 23, 29, -1, 21, -34, -1, 7, 4, 30, 38, -18, -7, -27, 33, 1, 33, 15, 16, -20, -28, -10, 24, 7, 36, 22, 13, -12, -10, 37, 7, -10, -13, 27, -31, 38, 34, 35, 7, -3, 3, -26, -8, 80, -7, 7, 29, -24, 9, 1, 27, 34, 89, 46, -9, 34, -21, 2, 74, -11, 16, 4, -21, 52, 8, 60, -23, 11, 4, 12, 14, 28, 6, 8, -11, -4, 34, -5, 1, 8, -17, 1, 12, -21, 15, -19, -16, 19, -3, 15, 24, 6, -7, -22, -20, -16, 10, -20, 14, -18, -24, -2, -23, 5, 27, 11, 28, 24, 37, -17, 26, -1, -15, 10, -50, 33, 41, 4, 6, -32, 18, -47, 8, 74, 2, 12, -12, 18, 42, -1, -4, 9, 84, 22, -28, 0, -23, 14, 38, -15, -17, 27, 1, 43, -4, 30, -18, 35, -13, -3, -23, -39, 12, -18, 27, 40, 20, 16, 26, -22, -16, -1, -20, -21, -32, -38, 1, -15, 32, 20, 43, -16, -9, 25, 10, -14, 2, 31, 28, -21, -30, 0, 6, -4, -6, -8, -15, 26, 27, 9, 9, 1, 8, 0, -44, -12, 43, 15, 5, 9, -6, -92, 2, 65, 7, 35, 8, -22, -16, -2, 27, 25, 61, -15, 23, 6, 28, 17, 68, -20, -1, 15, 23, 23, -7, 58, 2, -12, 21, 22, -27, -1, 22, -19, 14, 5, -23, -11, 24, -22, -27, -19, -21, -16, 11, -49, 26, 19, 14, 12, -15, -3, 6, 7, -26, 21, 9, 1, 2, -31, 13, 14, -5, -27, -24, 25, 27, 34, -4, 20, -20, -25, 30, -10, -52, -37, 27, 12, -28, 29, 25, -73, -24, 7, 27, 36, -22, -6, 6, -13, -1, 38, -53, -2, 15, -20, 3, -25, 9, -15, -5, -31, -7, -13, -26, -4, -25, 8, -40, -18, -36, -51, -9, -19, 3, -15, 13, -16, 20, -18, 42, -24, -16, -40, 14, -26, -11, 5, -4, 21, 8, -11, -23, 12, 6, 0, -24, 5, 15, -27, 31, 1, 6, -27, -4, -17, -8, 1, -19, -13, -6, 18, 15, 6, 30, -14, 27, -36, -14, 3, 16, -54, -19, 58, -18, -19, -3, -36, 21, -27, -26, -28, 23, 6, -7, 24, 10, 10, 10, 9, 7, -14, 23, 24, -11, 30, -27, 16, 9, -37, 10, -14, -12, -32, -20, 19, 10, -6, 41, 29, 14, -4, 13, -11, -5, -46, -8, -27, 15, -18, 35, -16, 28, 4, 10, -18, 22, -6, 0, -3, 8, -10, -1, -25, -10, -16, -1, 5, 27, 5, 17, 32, -10, 31, -30, -18, 48, 5, 25, -6, 9, -23, 11, 71, -18, 30, 22, 9, -2, -1, -1, 36, 41, 32, -22, 24, -3, -5, 28, -19, 17, -6, 4, 36, -18, 5, -16, -18, 29, 0, 21, 6, 4, -20, -12, 24, 20, 16, 12, 16, 18, -9, -19, -45, -12, -30, 42, -7, 5, 6, 51, 31, 31, -1, 24, 35, 33, 0, 26, -6, 0, 7, 11, 32, 18, 33, 30, 35, 29, -3, 30, 18, -26, 35, 2, 32, 46, -2, 5, -13, -5, -31, 25, 48, -26, 18, 14, -25, -13, -10, 17, -1, 51, 15, 5, 2, 20, -4, 24, 1, 22, 13, 26, 55, 8, 42, 17, 6, 20, 28, -25, -34, 9, 5, 18, -4, -1, 30, -18, -7, 22, -22, 8, -42, -16, -14, 6, 31, 1, 31, 9, 5, 23, 6, -5, -8, 22, 18, -17, 23, -19, 18, 17, 17, -18, 10, -5, 26, 16, 14, 10, 22, -3, -10, 0, -9, 46, 26, 28, 11, 2, 5, -2, 49, 20, 8, -12, 17, 34, 38, -17, 24, 55, -12, 1, 15, -6, -11, 34, 40, 1, 22, -7, 39, 5, 21, 16, 29, 14, -12, 33, -15, 16, -9, 13, 20, 20, 9, 12, -5, -2, -22, 15, -19, -18, -31, -14, -22, 4, -19, 4, -30, 6, 18, -32, -9, 7, 13, 15, 13, -1, 11, 24, 28, -16, -10, 13, -22, -26, -12, -1, 25, -16, -1, -44, 19, 45, -2, 7, 27, 21, -90, 18, 77, -17, 26, -6, -16, 37, -4, 0, 0, 56, 9, -5, 28, -8, 3, 34, 8, -10, 33, 0, 51, -10, 54, 14, 17, 13, 19, -9, -20, 9, 10, -5, 26, 10, 10, 18, -16, -18, -31, 6, 8, -2, -63, 20, 21, -7, 25, 19, -14, 26, 44, 34, 11, 32, -27, 0, 11, -6, -10, 19, 4, -24, 22, 14, -16, -19, -17, -10, 26, 28, -34, 20, 30, -30, -24, 16, 26, -8, 31, -25, -37, 30, -25, 1, -1, -2, -28, 5, -42, -22, -9, -17, 28, 9, -11, -17, 21, -16, -10, -12, -12, -7, -22, 25, -25, 1, -17, 24, 12, 5, -32, -23, -25, 12, -11, 1, -5, -31, 15, -19, -8, 7, -7, 12, 38, 26, 22, -13, 26, 35, -38, 1, -30, -8, -14, 3, -12, -16, 24, 17, -16, -10, 12, -22, 30, -22, 16, -15, 24, 32, 27, 32, 2, -6, 15, -26, 10, 24, 8, -18, -29, 1, -14, 6, -23, -10, 9, 22, 22, -40, -28, 11, -2, -1, -8, 13, 33, -2, -15, -29, -50, 16, -16, 23, -8, 16, -3, 13, 21, -20, 33, 17, 21, 13, 14, 32, -10, 36, 7, -9, 24, 3, 52, 35, 32, -31, -22, 29, 10, 8, 17, 18, 34, -20, 11, 14, 17, -23, 4, 27, -6, -7, -28, -19, -15, -10, 29, 15, 5, -20, 19, -10, -22, 50, 37, -10, -20, -14, -38, 6, 50, 34, -11, 29, 7, 21, -16, 33, 29, 75, 9, 2, -6, 12, 13, 82, 10, 11, 42, -6, 12, 0, 4, 11, -1, -12, 9, 2, -20, -15, 4, -4, -4, -6, -7, -14, 31, 10, 10, -19, -4, 27, -53, 7, -27, 6, 28, 37, 7, 11, 1, 3, 14, 19, -6, -28, 19, -9, -5, 41, 23, 31, 30, -10, 3, 26, 6, -4, 5, 19, 25, -17, 36, 3, 10, 10, 23, 12, -64, -21, 61, 23, 22, -11, 16, 38, 31, -13, -17, 64, -10, -20, -11, 16, 27, 49, -20, 3, 2, 9, 47, 25, 50, 26, -19, 24, -32, 6, -19, 26, 11, 15, 10, -20, 1, -8, -20, 12, -39, 29, -52, -30, -74, 39, 17, 22, 35, 62, 26, -16, 17, 20, -15, 16, -1, 31, 24, -27, -16, 29, 21, -11, -14, 0, -7, 3, -8, -16, 23, -19, 25, 2, -21, -2, 31, 16, 9, 15, -21, 5, 36, -2, 14, -4, -24, 20, -9, 13, 33, 85, 39, 24, 17, 8, -6, 41, 8, -22, 24, 11, 28, -23, 30, 20, -12, 8, 10, -25, 23, -17, -20, 8, 8, -22, -14, 17, 2, 9, 22, -17, -2, 2, -59, 17, 4, -15, -16, 40, -10, -12, -7, 16, 15, 4, 24, -9, -16, -23, 28, -7, 20, -8, 23, 29, -14, -13, 5, 35, -2, 6, 1, 9, -6, 22, -4, -3, -16, -12, -9, 24, 37, -17, 15, 27, -21, 14, 25, 8, 30, 43, 13, 10, -13, 18, 33, 77, 26, -2, 31, 8, 16, 25, 45, 25, 13, -26, 22, 7, -23, 29, -7, 31, 40, -19, 3, -28, -17, 19, 21, 15, -19, -15, -14, 22, 11, 5, -17, -19, -7, -3, -24, -19, -19, 25, 27, 47, 17, -29, -7, -38, 7, 14, -19, -14, -26, -7, 0, -25, 14, 1, 22, -3, 26, 8, -18, -22, -4, -19, -28, -13, -21, -9, -4, -9, -28, 15, -37, -20, 14, 34, 10, 10, -20, -2, 17, 7, -35, 17, 29, 4, 32, 8, -4, -7, 33, -28, -4, -11, 8, -19, -32, 2, -10, -12, -16, 6, 1, -17, -3, -3, -27, 17, -11, 1, -29, 29, 18, -25, -2, -15, 31, -1, -21, -5, 6, -91, -10, -34, -32, -11, 28, 28, 23, -26, -78, -36, -8, -68, -5, 26, -19, 28, 26, 10, -19, -39, -34, 32, 18, -44, 19, -53, -36, -80, -3, -39, -53, -50, 2, 10, -79, -48, -35, -39, -41, -31, -65, 14, -3, 12, 12, 9, 2, 8, -49, -17, 30, -14, 35, -45, 24, -5, -13, -12, 17, -64, 34, 9, 21, 8, -39, -55, -13, 38, 28, 13, 12, 10, 35, 36, -26, 7, 13, 13, -26, -10, 24, 26, 37, -15, 19, -26, 7, -4, -5, 9, 30, 26, 30, -10, -16, -26, 30, 8, -1, 0, -17, 13, 14, 0, 62, 18, -20, 23, -13, 8, -22, 22, 4, 84, 6, 27, 35, 35, 12, 75, 6, 26, 46, 33, 22, -3, 66, -2, 18, 27, 4, 6, -32, 37, -4, 9, 40, -10, -23, 4, 30, 28, 18, -12, -32, -7, -32, 7, 34, 0, 29, -15, 3, -54, 19, 0, -45, -32, -13, 6, -45, -18, 0, 32, -2, -28, -25, -24, -52, -38, 7, -38, 0, -47, 26, -36, 22, 1, 26, 7, -17, -10, 20, 2, -17, -61, 17, -22, -20, 40, -39, -5, -41, 24, -29, -18, -16, 5, -35, -1, -33, -23, 21, -41, -15, 11, 0, 3, 25, 8, 14, -13, 21, -35, -60, -1, -1, -2, 10, 28, -30, -39, -18, 11, -41, -12, 26, -34, -13, -7, 12, 2, 18, 32, -9, -25, -3, -3, 4, -6, 34, 28, -22, -14, -12, 18, -10, 20, -1, -26, 18, -20, -23, -16, 27, -13, 37, 37, 13, 27, -20, 31, -57, -6, 45, 12, -4, 9, 16, -6, 20, 30, 16, 60, 16, 3, -9, 14, 16, 32, -12, -8, 2, -20, 1, 21, 26, -18, 24, 5, -5, 29, 25, 34, -18, 28, 36, 11, 20, -27, 11, -21, -8, -8, -46, -32, -16, 16, -10, 24, -35, 18, -27, 3, -9, 16, -3, 9, 16, 17, -15, -83, -8, 32, 18, 1, -1, -3, 4, 4, -30, -47, -32, 63, -19, -45, -4, 27, 23, -26, -60, -13, -127, -19, 28, 13, 9, -54, -14, -37, -8, -21, -12, 21, -5, -40, -33, 20, -14, -2, -6, -55, -23, -25, -6, -26, 17, 7, -32, 28, 31, -38, -89, 66, -12, -1, -6, -19, -19, -59, 53, 33, 49, 24, 20, 21, -21, -28, -35, 8, -8, 63, -17, 22, -17, 25, -21, 0, 22, 0, 18, -7, -18, 9, -12, 18, -9, -7, -19, -1, -20, -9, 5, 16, 39, -40, 12, 60, -7, -20, 22, 17, -91, 38, 56, 18, 4, -3, 27, 37, -27, 29, -20, 42, -11, 21, -17, -7, -7, 51, 15, 24, -8, 31, -3, -28, 50, 5, 10, 10, -17, 3, -55, 4, -10, -12, -16, -3, 21, 7, -12, 20, -4, -22, -8, 7, -66, 6, 20, 19, 16, 23, -10, -5, 11, 9, 32, 24, 21, 24, -6, 17, 34, -4, 25, -13, -13, 25, 34, 29, 15, -10, 14, -33, 7, -22, 33, 38, -11, -28, 3, -6, -5, 21, 27, 20, -18, 26, -7, 11, 21, -9, -3, 67, 39, -17, 24, 25, -12, 69, 37, 7, 45, 0, 37, 29, 30, 12, 29, 21, -15, 23, 20, -14, 28, -9, 27, -18, 37, -15, -12, -20, -21, 9, -23, 2, -22, 0, -31, -26, -26, 24, -16, -20, 22, -6, 3, 25, 16, -33, -29, 16, 7, -13, 12, -21, -27, -5, 0, -4, 9, 9, -18, 19, 0, -21, 13, 26, 7, 24, -5, 13, -73, -10, 55, 0, 5, 6, -31, 20, -36, 28, -22, 88, 6, 5, -15, -24, -9, 24, 28, -22, 38, -27, 19, 2, 32, -25, -4, 3, -34, -1, -38, -8, -23, 9, 29, -27, 11, 18, 1, 7, -49, -14, -42, 19, -72, 9, 4, 10, 18, 62, -1, -22, -6, 22, 18, -7, 20, 11, -9, 20, -9, 12, -7, -16, -1, 6, -21, 10, -17, 42, -10, -18, -13, -15, 37, 10, -8, 5, 28, -9, -39, -6, 38, 9, 38, 39, 17, 7, -4, 25, -19, 58, 5, 23, 7, 34, 11, 25, 25, 37, -2, 3, 48, 14, 49, 17, 38, 4, 17, -12, 0, -9, 22, 21, -3, 13, 39, -23, -6, -1, 15, -19, -31, 4, -13, 38, 7, 27, -15, 27, -10, 31, 22, 26, 18, 20, 34, 5, 32, -31, 32, -7, 3, -19, 14, 7, 4, 11, 6, 22, 6, 7, 28, 6, -3, 48, -1, 5, -18, 24, -21, -10, 50, -8, -11, -10, 29, -9, 17, 18, 8, 76, 0, -23, -1, 9, 24, 73, -14, -16, 29, 7, 13, -3, 43, 34, -20, -17, -24, 14, 11, -16, -7, 26, 19, 21, 9, 5, -15, 18, -11, -6, -38, -14, -43, 16, -11, -13, -14, 9, 2, 4, -13, 10, 2, 1, 4, -23, -6, -14, 0, 26, 9, 23, -21, -15, -1, 3, 10, 37, -11, -9, -1, -30, -6, 20, -23, 20, 23, -1, -69, -6, 65, 10, -22, -18, -18, 8, -26, 9, -25, 87, -22, 18, -12, -30, -20, 22, 6, -5, 24, -10, 1, 15, 55, -17, 2, -17, -27, 27, -12, 32, -9, 9, -13, 1, 30, 37, -14, 11, -58, -6, -67, 8, -47, 5, -21, -15, 13, 1, 4, 10, 13, -6, -9, 23, -24, 26, 17, -31, -15, 32, -32, -6, -20, -12, -24, 21, -1, -19, 28, -43, -11, -20, -7, 23, -19, 12, 29, -24, -6, 26, 56, -16, 6, 27, -23, 3, 17, -8, 27, 35, 39, 21, 6, 21, -8, 25, 32, -8, 10, -3, 49, 19, 65, -4, 27, -20, -17, -13, -4, 24, 18, 32, 4, 29, 17, -12, 34, -15, 20, 25, -43, -11, -27, 40, 16, 13, -11, 25, 21, 30, 6, 31, -8, 33, -24, -26, 20, 16, 11, 37, -25, -19, 30, 22, -4, -6, 1, 30, 25, -7, 26, 15, 33, 33, 38, 29, 30, -7, -9, -1, 34, 33, -15, -18, -19, -16, -10, -10, 3, 82, 35, -18, -6, -18, 11, 20, -2, -1, 51, 33, 40, 27, 49, 20, 26, 33, -16, -13, -15, -21, -28, -13, 37, 30, 19, -23, 41, 5, 27, 3, -30, -11, -54, 36, 1, 5, -13, 13, 22, -10, -25, -28, -8, -30, 30, -41, -17, -11, -11, -23, -1, 9, 26, -24, 19, -19, 17, -25, -28, -22, -24, -18, 8, -2, -18, 7, 17, -35, -29, -11, -12, -31, -9, -20, 26, -1, 6, -29, 1, 19, -9, -18, -3, -20, -2, 13, 18, 0, -1, -36, 19, -22, 25, -3, -18, 27, 13, 6, -25, -2, 3, -4, -11, -34, 14, 36, -26, -31, 25, -14, 36, -4, -26, 8, 9, -32, -10, 8, 20, -24, 18, -14, 38, 4, 5, 11, 36, 12, 3, 17, 30, -6, -18, 2, 1, 35, 25, -15, -3, -11, -7, -59, -8, 2, 27, 10, -17, 2, -60, -3, 28, 14, 18, 25, 11, 1, -15, 3, 9, 57, -3, -2, -10, 17, 23, 52, 28, -1, 16, -23, 36, 13, 14, 36, -14, -16, 5, 31, -8, -2, 30, -24, 40, 35, 23, 17, 2, -2, -6, -25, -24, 27, -68, 16, -9, 23, 2, 29, -8, 22, 16, 29, 6, 7, 26, -21, 32, -16, 31, 31, 18, 3, -11, 21, 15, 29, 16, 5, 24, -4, -15, -17, 32, -2, 12, -21, 20, 25, 4, 10, 54, 0, 2, -26, 10, -7, -21, 14, -16, 33, 38, -28, 29, 2, 28, 26, 25, -9, -11, 16, 42, 2, 10, 9, 24, 16, -30, -11, -16, 33, -19, 2, -20, -7, 18, -12, 17, 16, 5, -13, -13, -8, -46, -3, 0, 22, -21, 47, 35, -13, -5, 22, -1, 24, -9, 21, 33, 24, -15, 0, 12, 24, 27, 29, -13, 13, 38, 37, -5, 4, -11, 0, -15, 7, -16, 17, 22, -16, -32, -3, 82, 23, 19, 35, 34, 13, 32, -22, 16, 73, 24, -20, 3, -10, 26, 59, 34, 39, 4, 23, 10, -16, 14, -21, 32, 19, 27, 17, -15, -11, -18, 14, 11, 26, 3, 29, 32, 17, -5, -9, -43, -32, -45, 37, 25, 29, 22, -18, -14, -28, -8, -28, 17, -30, 4, 12, 17, 14, -28, -4, -6, 10, 4, -19, 3, 24, 15, 23, -18, 17, -10, -12, 0, 16, -13, -33, -54, 9, -14, 23, -31, 25, -16, -14, -16, -4, 0, 8, 3, -28, 10, -14, -37, -22, 4, 8, 6, -11, -22, -23, -27, -21, -9, -6, -36, -23, -35, -2, 13, -2, 25, 16, 25, 9, -25, -24, 12, -31, 25, -13, -17, 0, -31, 13, -1, -22, -12, 24, 20, 0, -14, 16, -1, 27, 5, -1, -22, 19, -6, 11, 18, -12, 18, 14, 1, 28, 9, -16, -28, -33, -3, -18, 2, 34, 23, -27, -15, 25, -71, 2, 72, 7, 16, -28, 2, 28, 23, 0, 37, 38, 39, 20, 29, 15, -22, 38, 14, -19, -9, -2, 37, 12, 41, -30, 29, 17, -33, 2, -37, 29, -27, -22, -3, 31, -2, 27, 8, -2, -22, 10, -2, 18, -27, -14, 27, 25, -33, -36, -1, -27, -20, 20, -13, -14, -24, -33, 22, -36, -27, 2, -9, 27, 16, 17, -27, -18, -20, 5, 0, -36, 8, -37, 8, -30, -24, -10, -36, -22, 11, -3, 16, -14, -11, -28, -1, -27, -4, 11, -6, 15, 7, 9, 29, -31, -2, -13, 9, -23, -14, -32, -1, -29, 21, 19, 17, 5, -16, 24, -36, 3, 8, -35, -23, -30, 12, 1, 13, 15, 25, 25, -7, -25, -24, -12, -20, -8, 17, -28, -41, 16, 40, 24, -33, -25, -15, -68, 7, -25, 19, 3, 21, -29, -28, -11, -7, -10, -13, -22, -13, 27, -35, 24, -6, 30, -13, -64, -73, 31, 27, -37, -8, 5, 34, -18, -32, -41, 9, -22, 10, 19, -86, -28, -48, -66, -11, 16, -22, 12, -45, -7, -24, -43, 1, -38, -9, 0, 40, -34, 16, -10, -45, -50, -16, 13, -18, 54, 44, -16, 24, -20, 22, 8, 30, 43, 73, -11, -23, 54, -31, -12, 19, -22, -18, 9, 25, 27, 2, 9, -4, -24, -13, -15, -20, -4, 14, 5, 11, 24, 14, 17, -21, 23, -4, 56, -11, 5, 25, 17, -36, 28, 39, -24, 10, -35, -43, 18, -38, 28, 19, 92, 13, -5, 26, -4, -14, 73, -1, 7, 27, -29, 22, 5, 30, 17, -40, -25, 11, -6, 17, -26, -19, 0, -10, 23, 7, 8, -17, 23, -68, 22, -82, -30, -56, -10, 8, 21, -21, 52, 4, 7, -22, -24, -5, 30, -11, 29, 20, -5, -13, 14, 26, -2, 15, 1, 33, -10, 10, 8, -7, 7, 21, -40, -5, 14, 29, 17, 2, 36, -66, 13, 66, 10, -13, -13, 24, -12, 16, 22, -11, 58, -6, 11, 29, -16, 27, 51, 10, 6, 18, -1, 22, 1, 56, -14, 2, -2, 28, 25, -30, 32, 17, 11, 35, 32, -8, 17, 6, -20, 18, -7, -39, 27, -41, 31, -6, 35, -39, 18, 9, -23, 7, 19, -3, -10, 10, -19, -24, -5, -11, 18, 21, 29, 27, 1, 18, -26, 3, 11, 4, -1, -19, 3, -1, 45, -17, -11, -13, 9, -41, 30, 81, -5, -15, -21, -34, 36, 14, -1, 16, 68, -2, -11, -29, -30, 28, 27, -27, 25, -3, -22, 7, -6, 40, 12, -12, 15, 5, 17, 8, -24, -14, 1, -5, 20, 8, -35, -12, 17, 8, 16, -14, -10, -42, 38, 19, 18, 14, 56, -2, -22, 30, -14, 28, -34, 20, -5, -1, -23, 13, -22, -11, -10, -31, -7, 1, 17, 11, 16, 22, -40, 28, -4, -27, 16, -18, 15, -1, 12, -2, 6, 70, -21, 15, -11, -12, -1, -27, 10, -24, 22, 8, -23, -1, -5, -28, 64, -14, 2, -6, -30, 45, 16, 33, 14, 32, -31, 8, -2, 4, -8, 10, -17, -9, -5, -13, -15, 4, 7, 8, 5, -27, -25, -76, -13, -5, -9, 13, 45, 3, 29, -27, -17, 5, -10, 1, 30, -18, 1, -20, 19, 6, 14, -16, -19, 24, 6, 29, 24, -31, -11, 25, -45, 31, 27, -15, -2, -19, 32, -82, -14, 64, 22, 39, 18, 0, -3, -4, -20, 0, 61, 12, 6, -27, -8, -5, 43, -21, 3, 19, -24, 4, 11, 9, -6, -18, 10, -26, 3, -20, 36, -22, 22, -4, 31, 32, -5, 16, 24, 13, -25, -54, 4, -73, -12, -2, -8, 5, 38, 1, 28, -3, -28, 16, 19, 24, -4, -24, -9, 35, -22, -8, -5, -22, -14, 27, -4, 17, 25, 6, -7, -8, -38, 1, 44, 14, 17, -15, -23, -56, 13, 54, -30, -9, 0, 9, -14, -9, 8, 4, 66, -3, 19, 2, -23, 14, 67, 37, -4, 4, -27, 6, 16, 10, -20, 36, -11, -25, 22, -30, -25, 7, -2, 20, 26, 8, -1, -11, 25, -14, 23, -55, 17, -71, -7, 18, -25, -21, 63, 30, -8, 13, 21, 31, 11, -4, 10, 11, -12, -1, -20, -16, 4, 22, 31, 0, -25, -9, 25, 33, -17, -2, -20, -19, 34, 8, 17, -14, 29, -18, 1, 71, 8, 9, 33, -28, 12, -17, 7, 3, 91, 41, 2, 10, 12, 3, 53, 37, 31, 19, 15, 38, 17, 26, -13, -11, 7, 3, 24, 3, 14, 9, -26, 12, -13, 35, -25, 23, 10, -8, -11, 7, 20, -70, 25, 14, -25, -5, 16, 8, 10, -20, -9, -18, -30, -8, -24, 12, 8, -21, -23, 30, -27, 25, 16, -24, 12, 18, -18, 1, 7, -20, -19, 27, 7, -2, -16, 25, -24, -23, 10, 7, -11, -24, 0, -23, 7, -27, 21, 7, -27, -26, -21, -19, -28, -6, 4, 14, 16, 1, 14, -11, -33, -25, 0, 15, 3, 9, -16, -19, 1, -3, -15, -12, -15, 12, -28, -4, -22, 2, -8, -26, 16, -22, 5, 13, -7, -13, -32, -8, 48, 6, 13, -13, -5, 24, 3, -15, -5, -24, -26, 26, 12, 3, 13, 10, 3, 8, 2, 2, 31, -1, 36, -30, -27, 13, 9, 37, 18, 32, -5, -51, 2, 4, 35, 17, -7, 33, -13, -18, -61, 16, -10, 39, 46, 18, 6, 21, 5, -14, 40, -48, -24, -29, -3, -41, -14, -10, 18, 11, 11, 32, -11, -4, 33, -7, -13, 18, -11, 30, 17, 31, 27, 30, -24, 6, 4, 5, 59, -29, 16, -9, 23, 4, -19, 18, -20, 27, -23, 23, 14, -18, 36, -11, -18, -9, 14, -9, 12, 1, 15, -7, 41, 32, 5, 14, -12, -40, -6, 17, 25, 62, -23, -9, 19, -11, 24, -8, 16, -18, 46, 15, 9, 20, 23, -17, 55, 8, -3, 27, -28, 45, -6, 44, 27, 13, 20, -31, -12, 37, 10, 1, -19, 16, -10, 26, 35, -20, -29, -47, 3, -32, -5, -66, -4, -7, -1, -21, 2, -9, 15, 13, -19, -29, 14, -28, -14, -23, -10, -14, -31, 22, 7, -8, 3, 4, -25, 5, 27, 17, -2, 14, 3, 14, 28, 4, -21, 15, -8, -20, -16, 8, -29, -11, -16, 5, -24, -8, -31, 12, 24, 10, -20, 0, 6, -29, 9, -26, -4, -6, -17, 26, -11, -15, -2, 18, -28, 0, 15, -32, -7, -1, -13, 9, -14, -13, -23, -29, 22, 7, -21, 0, 9, 6, 26, -6, 18 };
+static const int32_t prediction_next_power_q8_layer_3_biases[32] = { 27, 19, 2, 38, 20, 31, 36, 2, -9, 29, 0, 9, -7, 35, 24, -11, 31, 33, 36, -7, 40, 37, -5, 33, 39, 2, -25, -7, 3, 38, 2, 28 };
+static const int8_t prediction_next_power_q8_layer_3_weights[2560] = { 3, -21, 9, 24, 44, 17, -16, -104, -36, -21, -22, 19, 10, 21, 13, 25, -22, -16, 13, 19, 0, -21, -20, -33, 102, 24, -28, 36, 6, 45, -10, 34, 25, -16, 20, -33, -22, -24, -27, 33, -8, 14, -15, -2, 32, 13, -7, 37, -62, -31, -2, -14, 62, -21, -14, 32, -2, 23, 2, 20, 6, 21, 47, -1, 24, 21, 0, -23, -32, 50, -28, -3, -24, 28, 49, -6, -1, -33, 20, 42, -23, -14, -43, 24, -16, -3, -27, -95, -4, -17, -19, 10, 3, 3, 0, -16, -17, 31, 36, -20, -29, -34, 30, -46, 66, 18, 22, 12, 27, 29, -13, 0, 9, 10, -34, 10, 22, -44, 30, -39, 19, 36, 22, 4, 33, -2, 16, -20, -79, -39, -64, -20, 87, 11, 23, 38, 21, -24, -23, 19, -1, 26, -33, 11, -5, 31, -33, -28, -7, 29, 34, -9, 34, 12, 0, 34, -15, -11, 18, 33, -27, 7, -40, 1, -4, -27, -3, -11, 24, -5, 42, 34, 19, -14, 34, -20, -41, 5, -6, 33, -53, -3, -13, -21, -56, 32, -43, -18, -8, 0, 38, 7, 14, -30, 9, -44, -12, 7, -17, 38, -14, 26, -41, 48, 21, 36, 21, -8, -61, -28, -49, -19, -25, 10, 21, 34, 18, -7, 28, 32, 40, -26, -27, -18, 4, -4, 27, 16, -21, -37, 40, 21, 37, -1, -21, 28, -31, 23, 36, -17, 30, -13, 55, 22, 10, -31, 25, -44, 19, 22, -8, 8, 51, 5, 32, 50, -30, 4, 15, 46, 5, 9, 52, -46, 76, 35, 55, 11, -11, 44, -5, 42, 25, 39, 12, -3, -23, 41, 40, -14, -26, -14, -31, 47, 47, 46, 11, 25, -28, 47, -75, 7, 38, 5, 28, -10, 38, 21, -17, 51, 36, 21, 8, 51, -22, -17, 35, -6, 10, -10, 43, 14, 49, 28, 8, -25, -21, -44, 7, 40, 16, -9, 29, 10, 2, 32, 37, -68, -42, 42, 33, 36, 20, -19, 43, -27, -69, 33, 1, -12, -24, -35, 24, -51, 18, 4, 2, -4, 39, -22, -14, 42, 26, 44, -11, 39, -25, -26, -2, 16, 26, -52, 16, -6, -39, -34, -7, -8, -21, 22, -14, 15, 81, -20, -34, -6, 33, -12, -5, 42, -23, -2, -25, 11, -15, -8, 12, 11, -36, 8, -39, -9, 45, 0, 28, 19, 10, 0, -39, -39, -2, 13, -22, 6, -35, -7, -25, -123, 20, 27, 3, 35, -12, -14, -11, 39, -48, 2, 26, 35, -23, 2, 20, -75, 38, -9, 25, 28, -34, 13, 29, 23, -8, 31, -4, 6, -7, 32, 29, 39, 30, 6, -16, 24, -21, 4, -23, 29, -45, -38, -26, 44, 33, -3, -39, 44, 27, -25, 9, 17, 43, -19, -26, -37, 26, 31, -35, 36, -32, 1, -6, 24, -7, 46, 43, 35, -33, -47, 18, 6, -19, -19, 26, -20, -35, 46, -4, -85, 12, -6, 38, -13, 10, 1, -36, -4, 9, 3, -31, 37, -40, 10, 23, 12, 77, 34, 44, -7, 22, 28, -8, 43, 39, 47, 34, -32, -13, 10, 2, 3, -27, 16, 11, 51, 10, 22, 34, 23, -21, 9, -77, 8, 81, 18, 52, -3, 40, 21, 31, 50, 27, -29, 25, 2, 43, -7, 34, -1, -57, 10, 42, 18, 2, 6, 14, 35, -34, 20, -2, -15, -26, -52, -13, -20, 6, -14, 45, 31, 33, 13, -25, -16, 27, -26, 10, -19, 82, -41, 18, -38, -46, -42, -32, 67, 10, 29, -9, 6, -30, -8, -29, -12, -7, 35, -27, -20, -54, -21, 30, -34, 32, -34, 30, -27, 22, -2, -33, -4, 55, 20, 44, 9, 32, -49, -32, -11, -19, 15, -11, -37, 34, -40, -37, -24, 12, -33, -24, 25, 25, -49, 3, -25, -17, -19, 3, -7, -14, -12, -38, -12, 16, -22, -27, -27, 6, -9, -26, 52, 2, -42, 31, 22, -24, -12, 59, 23, 55, -16, 24, -10, -34, -29, 14, 83, 15, -51, 25, -21, -10, 27, -17, 14, 30, 12, -26, -55, 23, 11, 18, -11, 1, 19, 3, 29, 24, 16, -41, -2, 82, 1, 68, 1, -7, 24, -20, 34, -3, 15, -1, -38, -41, -17, 3, -6, 17, 31, 10, -2, 16, -25, -13, 38, -13, -38, -35, -45, 29, -49, -42, -15, 32, -17, -10, -5, -38, -1, -13, -25, 37, 7, 19, 34, 51, -32, 19, -12, -15, 42, 36, 31, -62, -15, -15, 36, 111, -7, 32, -35, 30, -8, -15, 20, 13, 1, 11, 28, 6, -3, 32, 7, 46, 11, -40, 17, 26, 28, -19, -41, -2, 20, -61, -38, 79, -15, 33, -34, -24, 42, 22, -24, 41, -13, 42, 37, 25, -6, 6, -5, -37, -2, -7, 10, 35, 34, -2, -12, -22, -38, -34, 4, -14, 35, -16, 24, -27, 11, -12, -36, -39, 44, -29, 20, 19, -24, -7, -30, 9, -28, -33, 34, -12, -1, -14, 13, 14, -5, -32, -27, 41, 36, -19, -41, 25, 36, -30, 34, -24, -34, -28, -40, -1, 9, 14, 44, 18, 23, -32, -38, -5, -20, 37, 14, 5, -38, -7, -26, -22, 6, 30, -9, -44, 33, 8, 33, 0, 15, 37, -42, -6, 31, 20, -37, -3, -32, 25, -10, -13, -25, 27, 19, -15, -26, 17, 40, 17, 19, -19, 6, -16, -15, -58, -47, 13, 21, 29, -80, 75, -26, 19, -8, 2, 32, -45, 39, 54, -45, 17, 3, 38, 38, 28, -36, 21, -52, 4, -16, -33, -41, 1, 6, 4, 20, -55, -43, 2, -6, 4, 8, 98, -25, 12, -59, 61, -58, -64, -10, -14, -8, 3, 0, 26, -40, 0, 2, -10, -8, 2, -8, 81, -43, -47, 62, 22, -71, -2, -63, 26, 28, -71, -36, -38, -2, -14, 26, -16, -16, -23, 39, 8, -10, -30, -3, 19, 37, -10, 27, 20, -5, -11, -23, -34, 33, -34, 6, 7, -16, -6, 10, -7, 7, 9, 12, -19, -20, -17, -43, 24, -9, -39, -18, 9, -12, -1, -20, -42, -29, 6, 32, -24, -41, -45, 11, -22, -23, 3, -7, 33, -37, -28, -33, 33, -31, 16, -36, -11, -33, 15, 14, -16, 13, 29, 0, 34, -8, -48, -25, 7, -42, 20, 32, -6, 9, 49, 34, 22, 33, 27, -82, -21, -8, 24, 25, 42, -14, -35, 42, -33, 49, -1, -3, -30, 24, -1, -75, 51, 17, 6, 0, -11, -4, -20, 12, -12, -1, 42, 34, -4, -9, 33, 15, 33, 12, -29, 14, -24, -15, -22, 24, -60, 30, -60, 14, 69, 11, 6, 34, 7, 41, -22, -5, 29, 40, 27, -22, 36, 6, 37, 37, -30, -18, 41, 39, 55, 5, 32, 19, -36, -46, 51, 19, -15, 42, -33, -32, 37, 2, 0, -127, 3, 13, 24, 8, 16, -29, 26, 14, -48, 12, -36, -10, -16, 22, 22, -8, 19, 3, 25, -41, -30, 16, -30, -20, 7, 31, 41, -42, 36, -23, 7, 37, -37, -46, -48, 5, 34, 26, 3, 4, -95, -3, -64, -11, 76, -5, 27, 11, 34, -13, 10, 4, 21, 32, 41, -3, 34, 33, -43, -14, -69, 24, -8, -6, -24, -21, -6, 28, -20, -53, 38, 3, -22, 33, -18, 16, 14, 18, 37, -65, 6, 4, -5, -20, -18, -20, -16, -4, -3, 17, -28, -17, -9, -42, 0, -22, -40, 40, -35, 30, -30, -11, -38, 16, -29, 40, -15, -34, 15, -27, -3, -14, -11, -40, 35, 13, 37, 23, -33, -17, 7, -22, -35, 4, 0, -13, 46, 29, -32, -27, -1, 10, 15, -38, -42, 13, -13, 15, -11, -32, -43, 29, -17, 28, -41, -35, -38, 23, 36, 32, 6, -34, 15, 4, 45, 21, 24, -14, 17, -106, 13, -26, -8, 26, 6, -18, -45, 22, -84, -10, -39, -18, -44, 32, -6, -58, 29, 12, 6, 42, -21, 50, 40, -5, -32, 14, -19, -19, 37, 23, -22, 8, 11, -49, -44, 34, 46, -8, -23, 6, -30, 23, -32, 38, 96, 32, -23, -26, -18, 1, 23, 10, 25, 3, -1, 8, 25, 28, -3, 27, -54, -11, 47, 24, 17, 43, 24, 15, -33, -33, -1, -30, 40, -2, 16, -38, 8, 21, 17, -104, 30, 22, -3, 9, 34, -10, -21, -7, -50, 45, 33, 37, -9, -4, 16, -27, 72, 11, 27, 35, -28, 20, -17, 17, 6, 47, -19, 35, -33, 17, 38, 3, 19, -7, -24, 3, 3, -34, 35, -38, -55, 20, -58, 18, 40, -2, -1, 38, 40, -25, -12, -24, -4, 1, 48, -21, -5, 9, 45, -6, -17, -10, -8, 13, -1, 16, 24, 28, -35, 34, -10, -11, 11, -10, 53, -24, 2, -3, 19, -107, 24, -16, 26, 32, 6, -34, -27, 34, -86, -19, 16, -12, -57, -5, -12, -70, 79, 29, -22, 31, -33, 11, -14, 49, -15, 19, -17, 21, -5, -15, -28, 38, 37, -39, 34, 41, 23, -20, -7, -25, -90, 52, -29, 41, 83, 26, -5, 28, 18, -12, 16, 49, 17, -28, 45, 22, 38, -30, -1, 18, -4, 36, 42, -24, 9, 41, -6, 31, -35, -39, 6, -31, -6, -15, 22, 13, 33, 7, -8, -24, -24, -23, 26, 33, 34, 54, -19, 1, -2, -48, 13, -35, -21, 37, -45, 26, -8, -48, -39, -41, -2, -34, 3, 30, -20, 31, 30, -43, 10, 21, -46, -49, -6, 31, 10, 37, 5, 28, 1, -30, -40, -47, -25, 32, 36, -40, 27, -34, 13, 5, -19, -22, 15, -29, -29, 5, -17, -38, -7, -28, 26, -3, 34, 9, 37, 19, -46, -16, 17, -20, 30, 2, -23, 49, 31, 23, -5, 50, -16, -52, 1, 49, 1, -15, -18, -37, -29, 50, -46, -16, -19, -19, -59, -36, 2, 6, 82, 29, -3, 30, 8, 35, -27, -12, 56, 39, 41, 42, 39, -29, 44, 37, -25, -18, -14, -4, 14, 29, 1, -39, -84, 44, -40, 51, 86, 18, -26, 0, 48, 53, 8, 0, 48, -29, -32, 16, 44, -35, 3, 21, -44, 6, 13, 40, 30, -19, -24, 8, -35, -5, 49, -27, 48, -20, 38, 29, -19, 8, 49, -52, -3, 51, 5, 31, 24, 39, -24, 51, -35, 3, 32, 35, -8, -26, 4, -48, 105, -4, -12, -4, -2, 29, -22, -24, 55, 55, -4, -43, 47, 44, 17, 32, 40, -11, -42, 9, 29, 45, -2, 6, -45, 52, -68, -2, 113, 40, 46, 9, 38, 17, 8, 16, 4, -20, 34, -3, -11, -19, -5, -28, -62, -9, 51, 13, 42, 21, -31, 55, 17, 25, -27, -27, -8, -20, 9, 24, 33, -26, 42, 9, 45, 21, 5, -17, -24, -31, 13, -30, 113, 13, 25, -36, 28, 13, -12, 109, -2, 13, 0, -4, 15, 45, 19, 20, -17, 11, 22, -28, -12, 19, -22, -16, 6, -24, -48, 4, -17, -36, 34, 8, 101, 14, 72, -34, 18, -6, -3, -1, 6, -7, 25, -15, -10, 34, -38, 7, -34, 15, -1, -1, 75, 26, -24, 17, -9, -32, -33, -27, -41, 9, -14, -1, 18, 36, 14, -15, 41, 44, -14, -69, 24, -27, 27, 43, -33, 3, 20, 5, 4, -3, -16, -3, 18, 33, -27, 27, 33, -10, -4, -7, 40, 24, 19, -5, -7, -33, 1, -5, 22, 31, 48, 31, 40, 23, 26, 19, 31, 14, 23, -30, -89, 32, -51, -27, 40, 28, -5, 9, 21, 17, 11, 18, 0, -4, -17, 11, -12, 24, -7, -3, -13, 44, -22, -34, 26, 16, 40, 18, -34, -53, 4, 21, 3, -30, -3, -13, -21, 20, 21, -70, -39, 11, 51, 10, 12, 16, -45, 48, -14, 2, -21, 40, -63, 25, 38, -20, 23, 48, 11, 25, 35, 45, 20, -14, 3, 2, 45, -45, 18, 16, 38, 18, 32, -10, -3, 0, 15, 11, 38, -17, -102, -23, -48, 23, 80, 39, 52, 17, 39, 18, 44, 3, 22, -17, 45, -22, 45, 31, 24, 34, -33, 52, 49, -26, -15, -16, 53, 9, 10, 22, 41, -27, -5, 57, -29, -8, -12, 36, -36, 39, 35, 15, 35, -37, 33, -6, 15, 35, 54, 15, -40, 19, -7, -41, 14, -7, 49, 4, 6, -10, -41, -5, -1, -31, 0, 27, 22, -38, -38, -30, 14, -33, -19, 41, -6, 0, -16, -39, 12, 35, 52, 9, 30, -3, 37, 25, -14, 23, -47, -1, 33, -26, -46, -6, -19, 23, -40, -26, -21, -4, 14, -40, 17, -25, -9, -42, -1, -34, 6, -25, 42, 25, 17, -17, 34, -51, -19, 2, -32, -11, 40, -2, -26, 22, 29, -22, -20, 23, -9, -36, 39, 17, 8, -13, -33, 35, 26, 18, -43, 18, 19, -25, 16, 30, -41, -7, -6, -18, -39, 5, -16, -26, -29, 24, -7, -12, -25, 12, 37, -31, 86, -9, 41, 23, -3, -34, -32, -11, 28, 19, 21, 22, -25, -28, 30, 24, -3, -17, 42, -4, 45, 9, -27, -28, 2, 4, -39, 15, -13, 37, 36, 14, 39, -16, -39, 9, -36, -30, -42, -43, -3, -43, -29, -13, 36, -40, 34, -26, -22, 24, -23, -5, -43, 19, 32, -11, 73, 16, -15, 26, -37, 19, 36, 31, 6, -24, 41, -21, 14, -21, 6, -32, 33, -51, -6, 15, -28, -22, 14, -26, -61, 31, 22, -21, 83, -24, 33, 2, -38, -24, 16, 46, 40, 15, -29, 30, -30, -4, 22, 35, -20, 28, -9, 8, 41, 10, 21, 23, -18, -34, -6, 19, 2, -9, -55, -9, -21, 19, 38, 23, 48, -15, -15, -31, -31, 24, 20, 26, -35, -35, -23, -39, 34, -15, -38, 26, -58, -47, -39, 23, 3, 27, -39, -28, -31, 12, -42, -19, -24, -43, 8, 11, -13, 57, -1, 9, 11, 0, -27, 20, -42, 12, 1, -44, -78, 6, 1, -32, 14, 10, 34, -3, 39, -29, -30, 19, -35, -30, 13, 14, -20, 8, 0, -11, 12, -41, -13, 12, -36, 47, 5, -32, 37, 15, 25, -32, 8, 20, -31, -30, 6, 16, 30, -15, 11, 0, -18, 34, -67, 35, -20, -1, -53, -2, 7, -43, 103, -31, 30, -34, -14, 43, -31, 37, 36, -29, 9, -35, 25, 14, 46, 49, 46, -42, -4, 44, -32, 11, 47, 17, -97, 31, -57, -33, 65, 30, -6, 49, 28, 23, 4, -12, 30, -29, 28, 49, 8, -22, 38, -19, -9, 53, -4, 6, -18, 18, -30, 47, -6, -4, -6, -31, -30, 2, 13, -34, -25, -1, -30, 5, -47, 38, -8, 13, 12, 27, 11, -23, -15, 18, -5, -13, -55, 38, -25, 2, -6, -19, -28, 9, -14, 16, 35, -43, 34, 7, 28, -21, -4, 26, -16, 29, -21, -26, 31, 1, -28, 23, -6, 7, -53, 28, -50, -30, 27, -28, 2, -31, -39, -34, -30, 16, -48, -37, 37, 30, 19, 40, 25, 5, 9, -3, 1, -50, 37, -35, 25, 17, 37, -52, -36, 29, -9, -24, 19, -17, 23, -31, 4, -16, 13, -6, -20, 52, -38, -23, -27, -9, -41, 24, 29, 2, 9, 26, 45, 15, 42, 4, 48, 32, -28, 23, -20, -18, -35, 9, 13, -41, 9, 46, 42, -31, 17, -1, 10, 39, 40, 0, -12, 0, -32, 41, -59, -3, 85, -37, 0, -38, 7, 40, 39, -10, 16, 43, 33, 23, 10, 0, -11, -32, -31, -29, -29, 3, -6, -24, 44, -2, -34, -27, 26, -24 };
+static const int32_t prediction_next_power_q8_layer_4_biases[80] = { -2, 22, 2, 17, 18, 22, -8, 21, -3, 18, 21, 21, 20, -3, 11, -6, 18, 20, 0, 21, 22, 0, 0, 21, 11, 17, -7, 20, 17, 21, -2, 2, 0, 0, 19, 15, -2, -2, 3, 16, -1, 19, -3, 22, -3, 19, -2, 12, 17, -5, 20, 15, -3, 21, -1, -5, 18, 20, 15, -4, -3, 16, -1, 20, -1, 21, -1, 16, 0, 12, 22, 0, -1, 19, 18, -3, 19, 6, 19, 19 };
+static const int8_t prediction_next_power_q8_layer_4_weights[2560] = { 28, -29, 83, -61, 22, -70, -11, 15, 77, -12, 40, 59, 21, -39, -8, -2, 20, 12, 8, 64, -69, 17, 33, 38, 36, 28, 47, 17, 30, 20, -33, -54, -53, 29, 63, 60, 6, 62, 4, 57, 7, 2, 10, -82, 21, -48, 44, -33, 49, -16, 35, 7, 6, 44, 37, 75, -16, -12, -30, -41, -2, 24, -54, -13, -46, 45, 50, -50, 16, -14, -45, 58, 63, -30, 64, -17, -34, 43, 20, 2, 0, 33, -34, 69, -58, -5, -54, 67, 29, 68, -29, -47, -19, -20, 12, 36, -60, 21, 45, 51, 66, -10, 65, -1, 45, -58, 67, 7, -22, 33, 48, -61, -58, 37, -54, 51, 0, -30, -52, 34, 63, 25, -51, -56, -4, 32, -20, -56, -7, -34, 76, 34, -21, -1, 62, -27, -1, -17, 20, -16, -36, -40, 47, -57, -9, 56, 33, 26, -5, 16, 5, -60, 36, 24, 15, -4, 76, 49, -34, -34, 7, -51, -11, -38, -7, 28, 11, -70, -96, -21, 49, -127, -60, 29, -56, 42, 53, 13, 28, 6, 67, -33, -10, 67, 29, 25, 90, -22, -24, 2, 25, -24, 42, -24, -34, -1, -7, 35, 13, 41, 35, -29, -52, 19, 26, -39, -64, -74, 30, 36, 25, -21, 56, -68, -39, -8, 28, -39, -126, 26, 31, -26, -64, -56, -18, -3, -41, 75, 62, 11, 19, -66, -19, -25, 22, 32, 18, 46, -48, 75, -16, 66, 75, 25, 88, 52, -58, 14, 37, -58, -32, -37, -30, 77, 45, 18, -22, 57, 43, -68, -15, 4, 57, -25, 43, 33, 8, 5, 48, 2, -66, -70, 17, -67, -50, -57, -77, -43, -24, -17, -42, 30, -19, -36, -57, 23, -36, 38, -50, -72, 77, 16, -17, 61, 12, -31, 28, 65, -45, -7, -48, -62, 34, -76, 49, 63, 68, 16, 51, 3, 25, 54, 2, -41, 7, -77, -54, -25, 6, 4, 45, -14, 53, 20, 6, 16, 11, -30, -2, 75, 48, -14, 58, -7, 43, 61, 14, -54, 6, -40, 21, 64, -35, 6, 53, 66, 36, 57, 62, 6, -4, 12, 65, -48, -36, 65, -39, 14, -35, 25, 65, 7, -46, -13, -29, 12, 46, 15, 77, -46, 41, -35, 23, -10, -63, 30, -16, -19, 39, -15, -41, 79, -31, 2, -9, 50, -13, 31, -38, -27, 47, -59, 53, 37, 67, 23, -60, -16, 33, 39, 75, 22, -18, -37, 67, 32, -61, 16, 73, 49, -41, -47, 15, 48, -19, 70, 40, -34, -6, -46, 21, 28, -26, -15, 30, -52, 30, -38, 56, 34, 4, -38, -41, 65, -32, 52, -51, -40, 49, -12, 15, -1, -36, 58, 23, -17, 20, 36, 59, 43, -5, 28, -62, 49, 22, -10, -60, 34, 1, 0, -36, 60, 55, 2, -38, -31, 21, -7, -42, 45, -55, -44, -42, -38, 42, 42, -48, -25, 11, 48, 18, -47, 0, -5, -31, -18, 12, 54, 92, -3, 53, 25, -69, -18, -32, 42, 66, 23, -15, -4, 48, 48, -29, -22, -67, -67, 69, 0, -29, -15, -67, -38, -18, 52, -21, 41, -65, 63, 14, -96, -3, -4, 16, -70, -38, 3, 42, 56, 23, -26, -61, 68, -10, 38, 23, -57, 71, -41, -48, -42, 16, 62, 27, 69, 24, 27, 25, -42, 32, 7, 77, -84, 17, -44, 13, -57, -26, 14, 24, 44, 36, -32, 43, -3, 76, -33, -74, 16, 14, -22, -68, -6, 33, -11, 40, 27, -19, 56, 19, -67, 18, 18, 59, 47, 4, 10, 5, -14, -57, -49, 46, -10, -59, 60, -11, 61, -10, -54, -31, 17, 48, 60, -45, 25, 3, -19, 11, -6, 74, -45, 46, 87, 75, 69, 41, -46, -43, 3, -43, -54, 25, 42, -2, -18, 64, 72, 27, -35, 62, 26, 20, 43, -49, -31, -50, 4, -5, 44, 16, 6, -35, 15, 63, 52, 3, 51, 2, 14, -55, 2, 62, -25, -42, 15, 83, 1, 40, 14, 53, -15, 53, 47, -3, 65, 83, -41, 47, 11, 78, 33, 7, -2, 9, -15, -55, 14, -54, -21, -32, -52, -32, 29, -31, 20, 47, -40, 55, 43, 54, -19, 14, 57, 15, 29, -53, -35, -33, -64, 44, 29, 14, -30, 12, -42, -53, 39, 41, -55, -63, 51, -60, 14, 44, -40, 30, -28, -64, -23, 48, 49, 21, -67, 67, -36, -26, -8, -45, -24, 22, 33, -7, -63, -59, 35, -41, -7, 24, 4, 23, -41, 37, 48, 42, -97, -30, 21, 1, -52, 28, 71, 21, -44, 16, 45, 72, 59, -11, -38, -29, -20, 35, 20, 68, 73, 20, 83, -13, -45, 45, 17, 31, -63, -6, 19, 25, -39, 5, -30, -41, -22, -69, 38, 29, -72, -7, 34, 34, 11, -60, -13, 16, 12, 31, -61, -47, -12, -32, -37, 45, 16, 20, -29, -4, -16, 18, 38, 31, 16, -55, 49, -37, -91, 24, 35, -54, -42, -8, 55, 71, 41, 61, -45, -41, 14, 15, 59, -19, 20, -19, 20, 35, 10, 58, -79, -25, 13, -9, -8, -6, 10, -28, -42, 10, 63, -2, 44, 17, 62, -51, -50, -27, 57, 2, 16, -69, -5, -69, 46, 60, -1, 50, 62, 42, 19, 1, 6, 90, 53, 52, -13, 14, -62, 17, -30, 54, -59, 3, 77, 67, 1, -47, 10, -28, -58, -19, -14, 13, 42, 76, 39, -44, 23, 79, 55, -46, 83, 18, -51, -10, 19, -35, 59, 11, 50, 21, 30, 26, -68, -36, 31, 31, 72, 33, -38, -42, 16, -53, 77, 26, -12, 72, -55, -30, 0, 54, 59, 17, 22, -2, 40, 7, -8, -45, 14, 48, -30, -44, 22, -57, -82, 36, 79, -40, 57, -53, 3, -40, -26, 38, 78, -43, -11, 32, 55, -16, 24, -29, 63, -39, -4, 45, 2, -31, -2, -14, -13, -1, -39, -9, -37, 2, -3, -66, -29, 39, -55, 29, -54, -3, -70, -60, -18, 25, 10, 8, -54, -34, -29, 10, 40, 59, -60, -3, -6, -67, -28, -18, -40, -30, -22, 21, -58, 35, -74, 36, -8, 18, -41, -53, 56, 8, -43, 8, 43, 57, -70, -64, -45, 43, -52, 12, 43, -32, 46, 53, -22, 5, -63, 31, 44, -12, 34, 29, -60, -16, -44, 68, 5, -42, -11, -19, 42, -27, -36, -49, -18, -35, -56, -68, 26, -40, 8, 63, 54, 45, 70, -9, -44, -18, -66, -64, -33, -13, -45, -34, -26, -46, -49, 19, -66, 0, -43, 66, 0, 12, -25, -17, 41, -34, 60, -7, 48, 49, -41, 21, 42, 22, 7, -45, 26, 12, 49, 35, 41, 63, 38, -37, 1, 30, -49, -18, -44, -58, 65, 28, 75, -38, 52, 81, 71, -7, 65, 34, -31, -21, 19, 56, 37, 49, 68, -44, -21, -17, 58, 16, 8, 27, -16, -26, 68, 63, 13, 28, 66, 19, 53, 38, -65, 10, -42, -53, -19, 18, -62, 58, 18, 38, -18, -5, -33, -44, -12, -62, -38, -37, 40, -62, 4, 10, 32, -70, -43, -3, 87, -26, -72, -39, 43, 34, -88, -67, 53, 44, -82, -46, -38, 3, -75, 14, -10, 3, 24, 23, 5, -37, -17, -2, -26, -32, 50, -65, 56, -24, -27, 35, 23, 7, -28, 43, -53, -46, -13, 5, -35, -44, 25, -68, -39, 43, 11, -35, 46, 52, -63, 1, 35, 53, -50, -89, -36, 61, 4, 59, -4, -19, 68, 67, 14, 69, -69, -44, 46, 35, 48, -55, 29, -59, 20, 14, 22, -37, 46, 54, -65, 83, -9, -18, -21, -9, 71, 85, 62, -34, -51, -1, 52, 49, -50, -48, 40, 24, -55, 52, -40, -29, -28, 44, -3, -8, -31, 64, 36, -39, 35, 32, -32, -28, -25, -55, 44, -54, 54, -23, -7, 23, -40, 32, 65, -67, -8, -65, -9, -45, -15, -40, -29, 43, -67, 51, -2, -55, -31, -69, 1, 15, 15, -51, 38, 53, -70, 61, 24, 43, -48, 46, -22, 69, 13, -35, -13, -1, -25, 22, -75, 6, 53, 7, -57, 24, 77, 71, -12, 22, 11, -46, -45, 70, -5, 43, 41, 74, 60, 7, -54, 12, 9, -2, -42, 41, 14, -63, -27, -65, 31, 33, -7, 6, -50, 47, -14, -36, 25, 39, 35, -36, 30, 32, 29, 49, -45, 63, -48, -62, -10, -15, -10, 38, -19, 18, 9, -51, -35, -41, 47, -58, 50, -58, 10, 49, 34, 79, -45, 63, -16, 63, 12, 37, 48, -32, 72, 45, -23, -61, 76, 40, -41, -51, 58, -72, 34, 27, 25, 52, -2, 17, 66, -48, -13, 34, 57, 68, -45, 51, -31, 39, -4, 23, -25, 29, -32, 13, 38, -7, -17, -67, -64, 36, -69, 53, -70, 13, 32, -10, 39, 19, 51, 78, -1, 38, 26, 50, 23, 0, -33, 16, -17, 2, -2, 37, 9, -8, 30, 65, -40, 14, -7, 4, -2, -47, 45, 64, -18, 28, -32, 27, 9, -50, -24, -49, 12, -65, -33, -30, -37, -9, -16, -63, 57, -7, 23, 63, 31, 14, -41, 39, 30, -44, 46, -64, -1, -24, -12, 51, 16, -29, -17, 46, 63, 63, -30, 10, 11, -18, 12, -15, -87, -21, 12, -45, -21, 59, -13, -8, 17, 18, -28, -65, 46, -41, -9, 15, 32, 39, 63, 66, 11, -20, 16, 77, 10, -63, -10, -7, 52, 21, 42, -29, -83, 52, -30, 37, 50, -60, 10, -5, 53, 28, 6, 33, -45, 66, 50, -26, 31, 81, -21, -27, 57, 10, 6, 30, -39, -41, -72, -48, 26, 7, -51, -26, 20, 19, 48, -35, -71, 10, 13, -19, 51, 7, 33, -7, 43, 26, -12, 41, 31, -8, 17, -35, 25, 22, 62, -22, 83, -55, -16, 21, 44, -21, -51, -39, -95, 12, -45, -26, -41, -15, -47, 80, 48, 35, 9, 42, 60, -3, -44, 75, -10, 10, -8, -60, 41, -26, -3, 59, -24, -47, 65, 60, -32, 37, -50, 1, -3, -3, 52, -30, 42, 4, 40, -61, 39, 11, 34, 35, 47, 70, 7, -14, 64, 74, 22, -8, -13, -10, 30, -56, 44, 50, 31, -2, -73, -63, 42, 25, -11, 63, 14, -20, 61, 23, 28, -60, -63, -74, -41, -68, 0, -8, -64, -60, -68, 17, 43, 31, -48, 78, 27, -36, 90, 61, 61, 82, -58, -12, 51, -15, -38, -60, 36, -45, -60, 66, 60, 83, -55, 59, 72, 49, -35, 86, -15, -38, -30, -2, -37, -22, 29, 54, 57, -3, 34, -54, -72, -61, -65, -48, 3, -62, -42, 46, -35, -14, 16, -8, 53, -71, -31, 26, -45, 11, 24, -12, 60, -7, -2, -14, -5, -48, 44, -97, -62, 47, 12, 41, -21, -31, 50, -48, -8, 64, 32, 59, 13, 38, 5, -10, -29, 9, 15, -102, -21, 85, -24, -45, -85, 78, 38, -101, -2, -42, -17, 49, -29, 64, 46, -48, 32, 72, -92, 13, -14, 1, -89, -76, 58, 57, 44, -4, -41, -56, 23, -40, 75, -28, -4, 32, 2, 41, 20, 22, 19, 24, 12, 68, -29, 42, 26, 36, 31, 76, -47, -30, 6, 51, 27, -47, -55, 32, 53, 35, 38, -18, -44, -28, 50, -60, -14, 80, -43, 11, -18, -37, -35, 15, 2, 46, 40, -3, 28, -15, -29, 28, 76, 51, -1, 18, -50, -20, 21, -57, 35, 27, -1, 71, 26, -60, 68, -23, -14, 32, -11, -47, 49, -3, 3, 62, 18, -48, -2, 33, 20, -2, -12, -28, -4, -16, -9, -43, 30, 7, -24, 25, 19, -7, -28, 35, -62, -1, -2, -55, 48, -27, -52, -36, -9, 3, 10, -67, 14, -90, 14, 4, -44, 49, 33, -33, 41, 19, -20, -42, 81, 65, 41, 0, 27, -24, -59, -30, -74, -31, -52, 35, -74, 41, 29, 17, 25, 36, -68, -59, 27, 27, 14, 81, -3, -61, -39, -43, 53, -30, 58, -22, -44, 52, -51, 71, 6, 1, 11, 47, 45, 72, 15, -19, 61, -31, -34, -5, 22, 14, 25, 23, 80, -25, 21, 63, -43, 31, -47, 47, 66, -50, -47, 63, 71, 22, -37, -41, -38, 0, 42, -57, 3, 4, -32, 45, -68, -12, -69, -12, -43, 71, 30, -27, -95, -20, 24, 45, 77, -64, -31, -8, -71, -15, 37, -3, -116, 8, 37, 25, 33, -41, 41, 6, -9, -6, 81, -63, 11, -21, -51, 65, 15, 63, 82, 5, -12, 2, -12, -10, -36, -33, -53, 45, 20, -7, 22, -66, -50, 11, -54, -33, -56, 16, -61, 25, 49, -50, -5, -41, 15, 18, 38, -94, -10, 63, -67, -65, 51, 72, 57, -16, 56, -11, 2, 6, 29, -13, 34, -50, -120, -28, 79, -54, 24, 54, -37, 60, 57, 33, 18, -60, 28, 80, 69, -29, -26, -54, 70, 11, -3, -17, -72, 24, -14, -43, 64, -49, -43, 7, -11, -7, 1, 49, 61, 30, 37, -68, 16, -18, 7, -16, 7, 5, 24, 25, -23, 48, 5, 1, -31, -46, -37, 34, -50, 84, 50, -56, -2, 29, 18, -57, 35, -58, -20, 42, 11, 15, 74, -21, 53, -22, -34, -36, 83, -4, 11, 19, 52, -56, 47, 70, -13, 73, -4, -45, 28, -58, 6, -41, 12, -60, 56, -20, 53, 40, -73, -11, -16, 16, 56, 51, -19, -50, 48, 52, -33, -70, -11, -28, 18, -47, -45, -45, 12, 55, 57, -8, -104, -39, 31, -65, -22, -22, 43, 87, 75, 6, 126, -21, -23, -1, -43, -9, -76, -69, -67, 25, 33, 43, 21, -74, -16, 36, -87, -38, 14, -19, -18, -25, 38, -12, -8, 35, 70, 46, -102, -62, -11, -36, -83, -69, 84, -31, 14, 39, 54, 78, -41, 66, 19, -77, 61, 56, -11, -42, 29, 57, 75, 20, -38, -37, -50, -66, -18, -62, -13, -7, -20, 55, 20, 50, 20, -50, -38, -97, 1, -76, -25, -69, 33, -95, -75, 100, 12, -104, -91, 99, -23, -48, -98, 45, -54, 55, 55, 73, -20, 59, 7, -22, -2, -62, -69, -27, -52, -66, -26, -46, -16, -40, -10, 50, -38, 29, -17, -17, 11, -40, -4, 39, -8, 56, -59, 4, 40, 55, 6, -38, -2, 36, -38, 66, -37, 66, 63, -30, 8, -58, 43, -40, 20, 18, 52, 69, -41, 74, -31, -25, 26, 2, -46, -47, 0, 2, 65, 67, -40, 14, 73, 19, 69, 23, -49, 36, -71, -54, 18, -28, -106, -49, 35, 60, -52, 26, -22, -31, 14, -42, 57, -25, 44, 46, 52, 33, -64, 42, -21, -46, 25, -42, 56, 22, -54, 38, -40, -27, 12, -46, 22, 64, -10, -37, 21, -65, 27, -57, 56, -1, 22, -30, -40, 17, 14, 8, 53, -10, 59, 19, -59, -65, -30, -8, -45, 75, 49, 56, -37, -22, -44, 68, 33, 63, -86, 53, 6, 76, -38, -19, 65, 56, -28, 14, 18, 0, 72, 17, 69, -50, 24, -38, -8, -2, 17, 51, -49, 22, 17, 10, 4, -18, -7, 90, 43, 41, 97, 13, -38, -69, -21, -8, -50, -19, 17, 25, -10, 119, 59, 34, -8, 36, -65, 33, -36, 2, -48, 2, -16, -33, -43, -62, 60, 75, 0, 76, 39, 13, -33, 43, 55, 37, 18, -18, 5, 27, 32, 48, 29, 38, 24, -42, -36, -3, -12, 70, 60, -20, 32, -37, 60, 82, 59, -5, 14, -12, -4, 52, 66, 52, 11, 42, -15, 50, -31, -49, -13, -55, 67, 74, -35, -59, 45, 58, -54, 16, -31, 7, 28, -57, 36 };
+static const int32_t prediction_next_power_q8_layer_5_biases[48] = { 9, 10, 8, -1, -1, 13, 12, -2, 15, 14, -1, 13, -1, -1, 18, -1, -1, -1, 14, 0, 0, -1, 0, 12, -1, -2, -1, 12, -1, -1, 10, 0, 8, -2, 11, 10, -1, 8, 12, 18, -2, 10, 13, 9, 0, 16, -1, 13 };
+static const int8_t prediction_next_power_q8_layer_5_weights[3840] = { 29, 40, 27, -3, 24, 23, -1, 64, -46, -29, 12, 11, 34, -30, 30, -50, -33, 53, 45, 25, -43, 25, 45, 20, 55, 7, -30, -27, -3, -7, -40, -23, -50, 29, -6, -1, 66, -36, -9, 41, 26, 2, -44, 35, 39, 3, 34, 23, -14, -41, 17, 41, -41, 43, -24, 8, 60, -3, 30, 58, 46, 34, 47, -14, 59, 2, -4, 58, -23, -8, 36, 1, -30, -36, 15, -10, 60, 7, -8, -9, -88, -34, -19, -21, -30, 17, 0, 49, 45, 22, -41, -10, 72, 25, 58, 6, 17, 1, -20, 22, 48, -32, -35, 30, -37, 9, -37, 54, -19, -15, 27, -25, -4, 25, -19, 2, -1, 1, -37, -29, -5, 40, 52, 3, -22, 6, 22, 57, -19, 20, 31, -12, -42, 33, 25, -33, 56, 2, 21, 26, -21, 13, -16, 71, 9, 39, 24, 59, 46, -69, 22, -86, -2, -11, 42, -40, -1, -49, 30, -14, -38, 48, 32, -42, 12, -18, -29, 7, -29, 12, 46, 55, 50, 66, -48, -54, -38, -53, 29, 36, -4, -18, -5, -4, 0, 54, -31, 31, 29, -7, -13, 33, 22, 54, 12, 1, 1, -34, 13, 39, -18, 49, 24, 7, 0, 33, -27, 34, 21, -12, 3, -48, 24, 32, -10, 28, -51, -47, -13, -38, 12, -43, 17, 21, 21, -24, -26, -40, -21, -116, -35, 72, 67, 34, -28, 51, 16, 24, 43, 31, 11, -31, 9, -8, 47, 52, 44, 1, -36, 23, -19, 37, -27, -14, 37, 21, -29, -33, 23, 7, -37, 33, -30, 4, -33, -3, -8, 41, -23, 44, 9, 51, 0, -29, 36, 4, 48, 49, 0, 25, -11, 16, -45, -39, 44, -14, -16, 5, 50, -41, -33, -15, -11, -21, -12, 24, -13, 35, -58, -4, -38, -51, -46, -43, 15, -50, -16, -24, -20, -12, 32, -2, -37, -13, -17, -38, 20, -1, -4, 19, -27, -54, 15, -41, 28, 6, 28, 2, 52, -13, 21, -28, 20, 36, -34, 55, 45, -29, -20, -54, 3, 21, 37, 36, 7, -19, 31, 29, 50, -41, 13, -21, -14, -38, 21, -3, -17, 12, -47, 23, -46, -47, 2, 22, 8, 51, 4, -55, -18, -47, -52, -42, 30, -41, -54, 4, -50, -51, 33, -55, -21, 22, -10, -58, -31, -29, -45, 3, 15, -8, 33, -46, -4, -17, -31, -26, 40, -3, -38, 35, 51, 59, 41, 0, 59, 46, 33, -8, -44, -22, 39, 72, 46, -42, 15, -45, 16, 15, 12, 62, 65, 33, -46, 53, -21, 47, 56, -26, -25, 15, -47, 52, 44, 29, 6, 17, 61, -40, -29, 49, 24, 34, -35, 55, 20, 34, -5, 30, 0, 25, -1, -13, 7, 28, -10, 78, -1, 53, 61, -8, -19, 22, -2, 54, 34, 54, -7, 49, -18, -104, 64, 8, 37, -2, 74, 5, 52, 18, 9, 68, 44, 55, 31, 29, -10, 45, -12, 6, 18, 50, 27, 6, 4, -31, -9, 41, 42, -4, 45, 39, 56, -42, 15, 46, 11, -27, 47, 33, 18, 48, 49, -15, 42, -16, 55, 4, -11, 47, 35, 26, -12, 24, -28, 28, -26, 51, -33, 43, 6, 14, 15, 24, 7, 42, -17, -9, -2, -29, 7, -31, 74, -38, 12, -12, -32, 26, 2, 61, 29, -88, 33, 19, -44, -36, 45, -27, 40, 42, -20, -11, 30, -21, -13, -49, -17, -28, -42, -24, 4, 21, 34, -12, 43, -46, -39, -34, -62, 9, -4, 18, -54, 55, -37, 20, 35, -17, -26, 23, -43, -46, -19, 33, -37, -47, -66, -64, 24, 42, 1, -47, 31, -44, -13, 5, 30, 42, 20, -59, 40, -20, 23, -36, -54, -49, 41, -40, -45, -44, -25, -4, -58, 42, 25, -19, 4, 33, -26, -6, -45, 40, 3, -12, -50, 34, -30, -6, 29, 12, -66, -40, 67, -27, 27, -20, 76, 43, -16, 29, 9, -25, 47, 80, 32, 38, 14, 19, 35, 3, -38, 15, 28, 8, -43, -11, -9, 22, 47, 3, 10, 49, 31, 56, -21, 48, 80, -16, 33, -43, -21, 57, 55, 3, 2, 34, -34, 34, 27, 32, 37, 12, 26, 7, -36, 66, -8, 46, 45, 75, 2, 39, -8, -21, 57, 85, -16, 50, -16, 74, -35, -100, -22, 99, 30, 75, 21, 5, 10, -15, 21, 35, 32, 10, -18, 20, 73, 46, -12, 41, 37, 38, 75, 68, 37, 30, -31, 33, 9, 8, 33, -18, -2, 47, -8, -30, 34, -3, -26, -4, 11, 22, -21, 29, 0, 54, 77, 56, 32, -25, -14, 3, -39, -2, -24, 35, 13, -26, -15, 58, -8, 69, 10, 15, -22, 46, 20, 1, -25, 39, 41, 38, 45, 39, 27, 71, 41, 72, -46, -21, -41, -32, 44, 52, 53, 15, 2, -17, 39, -23, 45, 2, 39, -19, 1, -20, 33, -2, 46, 19, -49, -16, 43, -58, 41, -29, 7, 27, -6, -55, -8, 1, -16, 45, 48, -12, 14, -46, -2, 19, -48, 11, 28, 4, -16, 45, -50, -25, 22, 18, 35, 11, 10, 49, 8, 0, 33, 41, -23, -11, -52, 2, -7, 27, 19, -43, 11, 27, 36, -31, 29, 50, 14, -57, -1, -22, 4, -23, 48, 11, 38, -52, 40, -10, -17, -9, -23, -55, 4, -12, 5, 26, 61, -10, 55, 63, -31, 58, 10, 56, 18, -22, 39, 24, -1, -9, -7, -21, -23, 61, 21, 41, 32, 50, 52, 19, -33, 17, -23, 77, 20, 8, -31, -68, 11, 22, 26, 10, 32, -11, 3, -14, -46, 35, -16, 46, -48, 32, -17, -16, -29, 61, 31, 27, -39, 21, 59, 88, 14, 54, 25, 39, 8, 21, 34, 17, -36, 49, -8, 11, -14, -12, 32, 67, 24, 21, -9, -27, 28, -24, 47, 63, -8, -57, -57, -21, -2, -48, 23, -42, 37, -14, -33, 10, -49, 2, -51, 4, -39, 20, -16, 3, 47, -42, 54, 48, -52, 37, -4, 21, -7, 8, 13, 46, 6, -31, -46, 11, -19, -34, -34, -21, -35, 25, -41, 27, 33, -39, -11, 28, 20, 32, 48, 17, -48, -17, 37, -22, -38, -39, 33, -55, 5, -49, 18, 39, 3, -2, 28, 12, -46, 36, -22, 30, 45, 32, -30, -5, 23, -54, -20, 34, 11, -57, -17, -58, -11, -54, 15, -11, -39, 32, 5, -21, 34, -15, 13, 51, 44, -27, 42, -55, 25, 10, 10, -13, 3, 43, 47, 18, -1, -6, -35, 23, 40, 17, 49, -17, -53, -46, 24, 2, -27, -54, -18, -3, -25, -22, 40, -24, -54, 11, -35, 21, -51, -33, 42, -6, 2, -55, -29, 32, 16, 51, 34, -46, 51, 31, -20, -41, 38, 23, 36, -3, 30, -32, 1, -54, -11, -56, -47, -48, 55, 36, 16, -12, 73, -28, 26, 64, 35, 12, -29, 27, 39, -28, 42, 36, 64, 57, 8, 60, -19, -13, -38, 61, 43, 68, -20, -14, 24, 27, 7, 46, -39, 21, -8, -8, 17, 11, 60, -19, -37, 60, 54, 68, -20, 60, 36, -17, 2, 10, 77, 28, -23, 8, 63, 10, 35, 40, -10, -31, 75, 3, -8, 67, -35, 4, 15, 29, -19, -113, 65, 34, 8, 62, -16, -6, -28, -56, 18, 70, 37, -1, -45, -37, 37, -6, 5, -2, 43, 1, 22, 13, -26, 37, 43, -64, 4, 5, 1, 10, -28, -43, -48, -35, 14, 43, -30, -59, -9, -15, 26, -48, 11, 36, -50, 19, 25, -7, -48, -58, 47, -33, -51, -22, -16, -9, 49, -40, 1, 32, 28, 50, -28, -29, -44, 31, 33, -62, 28, -45, -12, 39, -3, -2, 48, -28, 41, 2, 40, -2, 42, -64, 36, 27, 39, -40, 44, 25, -5, -32, 9, -21, -30, -22, -44, -28, -32, -55, -1, 3, -58, 35, 30, 32, -31, 38, 17, 26, 44, 11, 42, -19, 3, -53, 32, 4, 15, -28, 45, -42, -41, 9, -8, -47, 1, 2, 8, -30, -18, -3, 8, -26, -36, 13, 8, 32, 44, 11, -39, -24, 21, -31, 13, -39, -11, -85, 10, 47, -47, -4, 34, -11, 26, 51, -55, -47, 7, -2, 19, 10, 29, 24, 52, -47, 18, -46, -39, -57, -1, 40, 51, -27, 31, 9, -54, -14, 37, -56, -10, 40, -8, -4, 37, -32, -28, -6, 43, 34, -3, 15, 26, -20, -55, 4, -52, 26, -48, 36, 50, 37, -27, -10, 25, -13, -33, -55, 12, 3, -44, -28, 1, -31, 18, 47, 12, -41, -40, 51, -42, 14, -9, 44, 48, -37, 44, -32, -57, -2, 33, -4, -39, -50, -10, 37, 5, -34, -13, -20, -23, -10, -59, -18, 24, -23, 10, -8, 47, -9, -36, -9, 15, 17, -3, 24, -25, 48, 19, 24, 34, 66, 24, -6, -9, 16, -15, 11, 62, 36, 8, 37, -30, -54, -34, 26, 1, -41, -7, 29, -13, 60, -37, -39, -23, -51, -9, 29, -23, -34, -8, -10, -31, 32, 12, -45, -3, -34, -28, -20, 40, -8, 18, -18, 37, 10, 49, 43, -34, 30, 25, -48, 54, -1, 42, 19, 2, -4, 54, -15, 46, -59, 67, 52, -39, 23, -10, -3, -18, -5, 32, 20, 30, -7, -10, 14, -16, 55, -28, 7, -51, -50, -16, -22, 45, -31, 40, 16, -22, -21, 25, 2, -26, 18, -39, 11, -26, -32, -28, 32, 12, -45, -1, 50, 26, 51, -15, 49, 24, -5, -7, -32, -24, 5, -57, 8, -42, -57, -29, 1, 46, -41, 25, 53, -27, -23, -24, 46, 5, 40, 49, -12, 23, -8, -32, -4, -9, -12, -17, -49, -23, -6, 22, 52, 5, -52, 32, -29, -5, -12, -11, -56, -6, -5, 17, 42, -19, -14, -38, -55, 19, 31, 20, -56, -29, -41, 43, 41, -4, -24, 39, 41, -25, 10, 46, 0, -21, -40, 1, -44, 17, 41, -53, 27, 46, 43, -11, 31, 16, -47, -50, 40, -6, -24, -22, 3, -45, 9, 50, -28, -51, -56, -32, -6, 19, 2, -12, -51, 1, 7, -17, 44, -37, -22, 9, -9, -38, 45, 52, 11, 54, -8, -47, 2, -45, -1, -48, 38, 6, -23, -40, 37, 25, 9, -19, -2, -19, 10, 1, 23, -11, -41, -45, -52, -61, 14, 40, 0, -17, 17, -40, -53, 44, 40, -55, -23, -45, -51, -17, 19, -9, 14, -1, 11, -8, -55, -31, 35, 46, 30, -47, 5, -8, 10, -5, 39, -51, -14, -29, 27, -11, -48, -50, 0, 13, -52, -17, 11, 1, 28, -44, 25, 27, -14, -48, 31, -28, -37, -1, 10, -13, 8, 42, 32, 3, -53, -42, 55, 24, 28, -2, -8, 45, -20, 15, -44, -50, -5, 13, 35, -5, -39, 28, -8, -38, 48, 37, -18, -56, 15, -8, -5, 53, -49, 50, 35, -9, -12, -14, -5, 8, -36, 4, -12, -25, -39, 41, -14, 9, -5, 47, -28, 35, -17, -28, 16, -6, -52, -14, -22, -38, 27, -36, -5, 36, 31, 15, 4, -43, 21, -3, -55, 25, -21, 15, 46, -17, -34, 44, -14, 13, 32, -30, 50, -5, -48, -7, -19, -1, -37, -44, -19, 22, 59, 7, 66, -7, 2, -24, 10, -32, -22, 20, 21, 6, -33, -28, 9, 32, 2, -12, -25, 80, 3, 29, 3, 50, 3, 39, 38, 46, 43, 8, 23, 35, -49, 2, 14, 35, 19, -38, -3, 26, -4, 0, 61, 20, 3, 47, 25, 61, 9, 0, 66, 14, 79, 37, 76, 76, 21, 36, -22, -25, 61, 77, -24, 13, 50, 0, 60, 13, -65, -8, -3, -47, 49, 23, -20, 60, 6, 71, 39, -54, -3, 7, -20, -27, 14, -22, -59, 23, 23, -9, 13, 25, 38, 20, -12, -41, 45, -9, 41, -37, 4, 18, -52, -63, -59, -7, 14, -32, -49, -35, -7, 38, -7, 38, -50, 20, -22, 17, -2, 52, 28, 25, 31, 26, 24, 38, 32, -50, -51, 13, 35, 47, -7, -48, 40, 40, -20, -34, 32, 33, -61, 21, 31, 10, 3, 20, -48, -50, -38, -1, -38, 45, 8, -5, -38, 18, -23, 39, 19, 18, -12, -22, 4, 24, 4, -37, -55, 31, 34, -23, -62, -50, -60, -38, 2, -12, -30, -45, 48, 33, -26, 40, 26, 44, 45, -54, -61, -50, -10, -39, -53, 54, -30, 10, 43, -51, 46, 1, -14, 24, -37, -35, -18, -29, -22, -41, -10, -36, 23, -4, -56, -37, -52, 46, -28, 39, 35, 27, -20, -1, 10, 38, -46, 23, -30, 34, -17, 3, 21, -27, -41, -10, -43, 5, 1, 22, 5, -49, 40, 39, 17, 6, -14, -57, -54, -3, 13, 44, -7, 48, 18, -51, -10, 2, 30, 27, 46, -15, -33, -36, 53, -54, -22, 15, -27, -13, 49, 42, -33, -11, -54, -49, -3, -10, -62, -5, 15, -9, 9, -42, 3, -55, -57, -36, -26, -4, -4, 7, -19, -13, 11, -18, -38, -35, -28, 9, 51, 0, -40, 12, 22, -32, -21, -24, -24, 36, -8, -16, -22, -25, -29, 19, 44, -46, 43, -23, 16, 20, 32, 49, 54, 41, 33, -24, 8, -31, 4, 27, 38, -18, 0, -30, -7, 36, -35, -1, 29, -14, 40, 62, 13, 36, -19, -2, 42, -8, 22, 4, 59, -30, 59, -3, -3, 25, 25, -28, -39, 17, 18, 13, -5, -10, 29, 53, 31, 24, 14, 32, -25, 3, -2, 57, 41, 8, 40, -29, 29, 57, 56, -2, 21, 76, -15, 21, 9, -18, -22, 54, -30, 41, 54, -31, 45, 49, 5, 64, -18, -37, 39, 45, 18, -47, -20, -49, 0, 32, 27, 19, -46, -21, 16, -8, 45, 41, -29, 17, 19, -9, -24, -58, 18, 13, -56, -4, 26, -32, -47, -38, 6, 38, 4, 6, -55, 23, -21, -48, -57, 53, -35, 40, 12, -9, 12, -6, -25, 36, -7, 20, 26, -11, 15, 30, 2, -55, -19, 24, -17, -36, 21, 45, -56, -5, 35, 38, 20, 33, 38, 51, 35, -14, 29, 47, -27, 13, 3, 27, -43, 5, -31, 24, -28, 45, 21, -10, -31, -58, -23, 44, -50, -18, -71, 43, -15, 30, 8, 38, 13, -34, 44, -41, -45, -25, 46, 9, 46, 10, -10, -49, 13, 30, 14, 13, 17, -19, -52, -40, 45, -17, 30, -16, 6, 51, 27, -62, -27, -13, -17, -16, -31, -17, 26, -6, 22, 24, -65, 18, 29, 16, -49, 38, 5, 30, -51, 37, -35, -56, -39, -57, 36, 10, -6, 7, -52, 17, -29, -40, -8, -22, 3, 46, -14, -19, -41, 49, -14, 32, -12, -18, 36, 50, -28, 46, 28, 14, -21, 62, 14, 11, 51, 50, 2, -20, 15, 55, 43, -35, 20, 28, 53, 35, 31, -42, 22, 14, 41, 62, -15, 29, 8, 9, -42, -21, 4, -36, 48, 50, -34, 20, 14, 53, 6, -40, 19, 16, 90, -26, 60, -40, 18, 45, -35, 22, 5, 44, 7, 38, 7, -39, -38, 63, 58, -20, 53, 10, -29, 21, -40, 51, -9, 40, -47, -45, -2, 51, -9, -17, -20, 53, -47, -34, 2, -11, 32, 22, -51, 42, 13, -26, -7, 28, 35, 46, -25, -31, -15, -6, -12, 23, -53, -29, -2, -40, 17, 19, 11, 45, -1, -11, -26, 36, -18, 36, -8, 33, -40, -4, 15, 40, -51, -56, 27, -26, -52, 47, 16, -18, -7, -11, 34, 0, -1, 3, 35, 26, 3, -18, 22, -8, 13, 27, 21, 21, 43, 12, -8, -18, -49, -50, -2, 38, -8, 25, 13, 42, 7, -24, 22, -45, -55, 1, 37, 1, 58, -38, -42, 10, -54, -24, -5, -40, -8, -27, 14, -17, 45, 39, 13, 18, 51, -1, 0, 22, 48, 4, 9, 0, -29, 55, -53, -44, -12, -32, -19, -4, 44, -2, -40, 20, -11, 32, 33, -17, 3, -19, -8, 43, -4, -32, -7, -21, 11, -7, 45, 4, 28, 7, -33, 36, -127, -10, 6, 24, 42, -14, -4, 8, -46, -20, -8, 38, 29, 18, 24, 23, -55, -40, -52, -33, -2, -16, -44, -26, 43, 15, -36, -15, 25, 33, 38, -67, -39, 10, -12, -50, -31, -42, -48, 38, 1, 39, 19, -39, 51, 5, 29, -24, 32, -47, 28, -40, 12, 22, -10, -32, 1, 0, -5, 8, 31, 32, 32, 38, -60, 30, -59, 37, 34, -34, -27, 8, 1, -26, -15, -25, -42, -39, 38, 47, -39, 25, 33, -33, -54, -9, -36, 35, -12, -46, 34, -36, 43, -29, 42, 35, 19, 21, -20, 30, 7, 62, 31, 26, 20, 4, 20, -1, 27, -42, 11, 58, -38, 4, 26, -12, 41, 50, 10, -16, 47, -5, -35, -5, 37, -29, -26, 24, 42, -34, -24, -18, 68, 41, 70, 23, 71, 47, 14, -9, -31, 8, 6, 61, 81, -21, 1, 35, -26, -6, -38, -10, 48, -27, 58, -12, -18, 46, -39, -38, -53, 72, 31, 30, 58, -18, 35, -5, 15, 56, 18, 15, 17, 17, 52, -32, 23, 67, 52, 36, 38, 47, -3, 62, -37, 40, 43, 23, 56, 42, 26, 35, -32, 27, -34, -40, -30, -5, 62, -14, 52, 48, -13, -27, 30, 46, -1, -39, -2, 35, 37, -14, 63, -24, 2, 55, 69, 61, -30, 60, -1, 23, 0, -24, 52, 45, 28, -38, 67, 11, 45, -5, -4, 2, 13, -14, 70, 31, -18, -25, -31, 53, 74, -28, 36, 47, 7, 32, 53, 6, 4, 26, 25, 48, -11, 23, -49, -5, -33, 0, -59, 12, -23, -57, 49, -26, -67, -24, -4, -20, -26, -7, -28, 33, -6, -35, -44, -28, -8, -34, 17, -27, 55, 47, 38, 10, -1, 41, -55, -14, -3, -43, 39, 10, -71, -33, -55, 45, -64, -50, -22, -69, 39, 45, 20, -3, 5, -46, -4, -52, -36, -8, 31, 37, 49, -54, -6, -20, -46, 21, -8, 37, 11, 14, 33, 23, 32, 19, 29, -38, 25, 36, -6, -18, 40, 41, 10, -47, 55, 24, -36, -20, -44, 69, 9, 39, 52, 13, -36, -21, 21, 17, 22, 2, 16, 9, -6, 35, 32, 34, -1, -33, -40, -23, -24, 64, 53, 6, -43, -7, -3, 6, 56, -6, 62, 12, 59, -31, 30, -11, -24, -6, 44, 11, 22, 43, -4, -29, 47, 20, -50, -21, 40, 3, -6, 7, -40, -38, 11, 21, -79, 10, 80, -42, 27, 65, -12, -31, 37, 19, -14, -26, -32, -46, 6, 30, 52, -29, 67, 26, 65, 37, -9, 24, 5, -6, -48, 31, -18, -49, 8, 55, -25, 53, -1, -11, 28, -12, 44, 59, 1, -1, 58, 40, 12, 55, 29, -24, 19, -11, 16, 40, 70, 37, 11, 58, 15, 7, -34, -15, -30, 25, -1, 7, 38, -37, 79, 70, -26, -28, -37, 18, -42, -10, -16, -11, 18, 8, -17, -32, -25, 36, 96, 68, -5, -23, 19, 21, -16, 3, -10, 49, 73, 42, 43, 82, -28, 38, 55, 2, 59, 69, 36, 60, 30, -20, 43, 31, 26, -13, -17, 10, 29, 29, 32, -16, 52, 18, -7, 19, 59, 55, -9, 4, -36, 55, -28, 35, 2, -5, -15, -43, 58, -30, 42, 52, 9, -35, 36, 29, 23, 31, 75, -33, -19, 63, 65, 83, 21, 17, 33, 0, -13, -15, -8, -45, 34, 52, -7, 6, -75, 49, -5, 23, 40, 52, -28, 11, 12, 2, 17, 39, 46, -54, 3, -41, 1, -33, 11, -46, -28, -51, -8, -24, -13, 36, 38, -46, -34, -30, -17, 1, 4, -43, 4, 17, 14, -23, -4, -62, -39, 31, -35, 7, -40, 42, 40, 27, 26, 19, -26, -26, -36, -44, 27, 5, -41, -23, 50, 12, -68, 24, -49, 26, -20, -14, -55, -58, -41, -19, 24, -17, -64, -31, -1, -12, -55, -13, 4, 37, 39, 50, -32, -7, 7, -38, -48, -17, 33, -37, 6, -20, 11, -41, -23, -43, 23, 14, 53, -3, 20, 41, -32, -3, 15, -24, -24, -3, -38, -16, 62, -8, 0, -22, -8, -2, -41, 53, 5, -34, 12, -37, 8, -28, -21, -7, 23, -40, 29, 17, -8, -2, -9, -17, 31, -23, -18, -12, 25, 17, 52, 38, 30, -22, 62, 39, 50, 49, -15, -12, 37, 51, 47, -15, 57, 23, 5, 49, -27, 26, -126, 23, 72, -1, 44, 52, -22, 44, -33, 62, 31, -1, 70, -1, 67, 51, -4, 30, 62, 38, 31, 4, 45, 15, 1, 4, 21, 42, 31, 40, 65, -3, -24, -27, 40, -22, 20, -27, 49, 38, 22, 56, 32, 27, 41, -28, -13, -44, 27, -36, 11, -22, -12, 23, 46, -48, 30, -39, -34, 30, 19, -21, 36, -5, 18, -19, 13, 64, -28, -38, -25, 54, 56, -51, 48, -16, 7, -18, 17, 50, -122, -19, 43, -6, -20, -20, -51, 6, -48, 32, -15, 10, 52, 40, -16, 32, -40, 28, 61, -3, 34, 25, 25, 49, 51, 48, 1, 40, 49, 3, 62, -21, 40, -13, 51, 6, 44, 4, 32, 27, 35, 5, 28, 27, -10, 11, -49, 77, 6, 41, 29, 56, 37, -17, -22, -15, 7, 13, 2, 27, -19, -4, 34, 60, 40, 13, 25, 25, -42, -3, 58, 66, 0, 15, 19, 16, -24, -29, 49, 32, -29, 14, -16, 32, 46, 3, 2, -14, 50, 13, -23, 21, 29, 21, -57, -56, -7, -55, 15, -23, 17, 23, 38, 11, 42, -34, 35, 47, 51, 39, -10, -44, -19, 17, -36, 26, -47, -33, -50, 40, 51, -32, 5, 36, 45, -40, 36, 47, 36, -43, -20, -28, 28, -39, 48, 9, 21, 32, -25, 24, 51, 3, -47, -32, -33, -42, -41, -49, 32, 50, -17, -33, -22, -19, -29, -20, -23, -1, -30, -25, -42, 30, -37, -17, -25, 40, 32, -13, -17, 32, -12, 62, 73, 48, 53, 72, -14, 33, 15, 54, 17, 57, 26, 74, 37, -32, -38, 51, 21, -21, 78, 46, -20, 2, 65, 31, -9, -4, 23, 13, -5, -35, 51, 46, 16, 47, 48, 42, 40, -25, -45, -4, 60, -6, 75, -30, 63, -23, 29, 9, 32, 69, 43, -24, 23, -23, 17, -27, 64, 30, 5, 74, -33, 55, 23, -32, -22, 17, 49, 54, -69, 32, -10, 10, -22, 62, -17, 43, -32, -28, 76, -32, -17, 49, -7, 7, -44, 41, -32, -21, -55, 16, -27, -1, -22, -1, 11, -58, -46, -26, -45, -51, 44, -34, 13, -6, -29, -3, 51, 13, -29, 11, 51, -50, -43, 11, -36, 49, -13, 38, 1, 46, 19, 7, 30, 31, -10, -55, -21, -52, 13, -13, 26, -40, -17, 32, 2, 34, -55, 49, -42, 19, -50, 27, -19, -5, -55, -17, -18, -48, 43, 11, -59, 52, -6, 1, -14, 8, 5, -39, 23, 12, 63, 34, -38, -38, -1, -51, 5, 21, -5, -16, 61, 72, -33, 40, 21, -24, 8, 22, 36, 49, 54, -13, 61, 19, 62, 48, 38, 28, -25, 4, -14, -12, 0, 35, -16, 17, -6, 32, -24, 38, 37, 50, 17, 50, 31, -4, -24, -18, -34, -7, -25, 50, 34, -42, 47, 35, 14, 38, -33, 13, 17, -19, -4, -42, 26, -4, -18, 56, -79, 63, 70, 19, 28, 49, -17, 7, 10, -1, 11 };
+static const int32_t prediction_next_power_q8_layer_6_biases[1] = { 15 };
+static const int8_t prediction_next_power_q8_layer_6_weights[48] = { 117, 127, 115, -95, -18, 60, 65, -39, 65, 57, -100, 68, -49, -47, 44, -24, -48, -2, 106, -43, -60, 110, -107, 70, -48, -15, -96, 72, -66, -42, 71, 2, 106, 4, 66, 52, -107, 107, 107, 41, -98, 76, 112, 68, -75, 43, -33, 75 };
+static int8_t prediction_next_power_q8_buf1[80];
+static int8_t prediction_next_power_q8_buf2[80];
+static const float prediction_next_power_q8_input_inv_scale[5] = { 1.27012706f, 10.583333f, 5.52173901f, 4.53571415f, 1.41111112f };
+static const mlp_q8_layer_t prediction_next_power_q8_layers[7] = { 
+{ 48, 5, prediction_next_power_q8_layer_0_weights, prediction_next_power_q8_layer_0_biases, 1949781682, 7, MLP_Q8_ACT_RELU }, 
+{ 80, 48, prediction_next_power_q8_layer_1_weights, prediction_next_power_q8_layer_1_biases, 1318329424, 6, MLP_Q8_ACT_RELU }, 
+{ 80, 80, prediction_next_power_q8_layer_2_weights, prediction_next_power_q8_layer_2_biases, 1459315018, 8, MLP_Q8_ACT_RELU }, 
+{ 32, 80, prediction_next_power_q8_layer_3_weights, prediction_next_power_q8_layer_3_biases, 1731439754, 9, MLP_Q8_ACT_RELU }, 
+{ 80, 32, prediction_next_power_q8_layer_4_weights, prediction_next_power_q8_layer_4_biases, 1098421648, 8, MLP_Q8_ACT_RELU }, 
+{ 48, 80, prediction_next_power_q8_layer_5_weights, prediction_next_power_q8_layer_5_biases, 1882524243, 9, MLP_Q8_ACT_RELU }, 
+{ 1, 48, prediction_next_power_q8_layer_6_weights, prediction_next_power_q8_layer_6_biases, 0, 0, MLP_Q8_ACT_IDENTITY } };
+static const mlp_q8_net_t prediction_next_power_q8 = { 7, prediction_next_power_q8_layers, 5, prediction_next_power_q8_input_inv_scale, 0.0362045579f, prediction_next_power_q8_buf1, prediction_next_power_q8_buf2, 80 };
+
+static inline int32_t
+prediction_next_power_q8_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+{
+  return mlp_q8_regress(&prediction_next_power_q8, features, n_features, out, out_length);
+}
+
+static inline float
+prediction_next_power_q8_regress1(const float *features, int32_t n_features)
+{
+  return mlp_q8_regress1(&prediction_next_power_q8, features, n_features);
+}
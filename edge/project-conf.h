@@ -49,6 +49,39 @@
 #undef COAP_MAX_OPEN_TRANSACTIONS
 #define COAP_MAX_OPEN_TRANSACTIONS 4
 
+/* Coda delle richieste in uscita (node/coap_queue.h): richieste accodate e in volo.
+ * Di default una transazione resta libera per le notifiche di /res_threshold */
+#define COAP_QUEUE_CONF_SIZE 6
+/* #define COAP_QUEUE_CONF_MAX_INFLIGHT 3 */
+
+/* Telemetria a batch su /res_bulk (resources/res_batch.h): capienza del ring e
+ * valori iniziali di size e delay, modificabili a runtime con un PUT su /res_batch */
+#define BATCH_CONF_MAX 8
+#define BATCH_CONF_SIZE 4
+#define BATCH_CONF_DELAY 60
+
+/* Allineamento di roof e power per istante di misura (node/sample_join.h): distanza
+ * massima tra le letture di uno slot e attesa della lettura mancante, in secondi */
+#define SAMPLE_JOIN_CONF_TOLERANCE 7
+#define SAMPLE_JOIN_CONF_GRACE 5
+
+/* Roof e power inviano a deadband (node/report.h), con gli stessi valori qui:
+ * entro REPORT_CONF_MAX_SILENCE secondi dall'ultima lettura una sorgente in
+ * silenzio vale come invariata. ROOF_CONF_HOUR_SECONDS e' la durata dell'ora
+ * simulata del roof, con cui l'edge fa avanzare ora e mese */
+#define REPORT_CONF_ENABLED 1
+#define REPORT_CONF_MAX_SILENCE 120
+#define ROOF_CONF_HOUR_SECONDS 15
+
+/* Journal su flash dei record non consegnati (node/journal.h), con make JOURNAL=1:
+ * JOURNAL_CONF_SEGMENTS file da JOURNAL_CONF_SEG_RECORDS record (36 byte l'uno),
+ * da 192 a 256 record = circa un'ora di cicli. Il recupero invia al piu'
+ * JOURNAL_CONF_REPLAY_BATCH record ogni JOURNAL_CONF_REPLAY_INTERVAL secondi */
+#define JOURNAL_CONF_SEGMENTS 4
+#define JOURNAL_CONF_SEG_RECORDS 64
+#define JOURNAL_CONF_REPLAY_BATCH 8
+#define JOURNAL_CONF_REPLAY_INTERVAL 2
+
 #undef NBR_TABLE_CONF_MAX_NEIGHBORS
 #define NBR_TABLE_CONF_MAX_NEIGHBORS     10
 #undef UIP_CONF_MAX_ROUTES
@@ -56,10 +89,73 @@
 #undef UIP_CONF_BUFFER_SIZE
 #define UIP_CONF_BUFFER_SIZE    240
 
+/* Motore di inferenza per la previsione (ml/prediction_engine.h):
+ * 0 = emlearn float32, 1 = int8 (ml/mlp_q8.c), 2 = kernel specializzato (*_gen.h),
+ * 3 = pesi potati CSR (ml/mlp_csr.c) */
+#define PREDICTION_CONF_ENGINE 0
+
+/* Previsione delle prossime 24 ore in una sola inferenza, esposta su /res_forecast.
+ * Richiede prediction_forecast_power.h (Colab_IOT.py) e, per i motori 1-3, l'header
+ * derivato corrispondente */
+#define PREDICTION_CONF_FORECAST 0
+
+/* Modello fuso nextSolar + nextPower eseguito dall'edge (prediction_fused.h da
+ * Colab_IOT.py): va impostato uguale su edge e roof, il roof non esegue inferenza */
+#define PREDICTION_CONF_FUSED 0
+
+/* Backend dei layer int8 e float (ml/mlp_backend.h): 0 = C portabile, 1 = Cortex-M DSP,
+ * 2 = x86 SSE4.1/AVX2. Se non definito viene scelto in base al target */
+/* #define MLP_CONF_BACKEND 0 */
+/* Verifica del backend all'avvio con i vettori di test condivisi */
+#define MLP_CONF_SELFTEST 0
+/* Riuso del risultato e del layer 0 tra previsioni successive con il motore int8
+ * (ml/mlp_q8_memo.h): solo le feature cambiate vengono ricalcolate */
+#define MLP_Q8_CONF_MEMO 1
+/* Latenza per stadio della pipeline (node/pipe_stats.h): istogrammi a bucket
+ * fissi e tempi Energest su /res_stats, notificati al server ogni
+ * PIPE_STATS_CONF_PERIOD secondi */
+#define PIPE_STATS_CONF_ENABLED 1
+#define PIPE_STATS_CONF_PERIOD 60
+/* Profilazione per layer dell'inferenza (ml/mlp_prof.h): tick rtimer e CPU di
+ * Energest con min/media/max/p99, serviti in sola lettura su /res_prof */
+#define MLP_PROF_CONF_ENABLED 0
+#if MLP_PROF_CONF_ENABLED || PIPE_STATS_CONF_ENABLED
+#define ENERGEST_CONF_ON 1
+#endif
+
+/* Costo del parsing dei payload all'avvio (msg/msg_bench.c): sscanf con copia
+ * del payload contro i codec generati da msg/messages.json, in ns per messaggio */
+#define MSG_CONF_BENCH 0
+/* Invio in SenML-CBOR (msg/msg_cbor.h) alle risorse che lo annunciano nella
+ * lookup, con ritorno al JSON se il destinatario lo rifiuta */
+#define MSG_CONF_SENML 1
+
 /* Abilita block-wise transfer
 #define COAP_OBSERVE_CLIENT 1
 #define COAP_BLOCK_WISE 1
 #define COAP_MAX_CHUNK_SIZE REST_MAX_CHUNK_SIZE
 */
 
+/* Attuazione di gruppo (node/coap_group.h), con make GROUP=1: un PUT multicast
+ * al gruppo ff05::1:COAP_GROUP_CONF_ID al posto dei PUT a furnace e alarm, e
+ * ritorno all'unicast per chi non notifica entro COAP_GROUP_CONF_ACK_TIMEOUT
+ * secondi. I pacchetti del gruppo li inoltra il motore multicast MPL */
+#if COAP_GROUP_CONF_ENABLED
+#define UIP_MCAST6_CONF_ENGINE UIP_MCAST6_ENGINE_MPL
+#define COAP_GROUP_CONF_ID 1
+#define COAP_GROUP_CONF_ACK_TIMEOUT 3
+#endif
+
+/* Avvio comune dei nodi (node/node_runtime.h): register e lookup falliti si
+ * ritentano dopo NODE_RUNTIME_CONF_BACKOFF_MIN secondi, raddoppiando fino a
+ * NODE_RUNTIME_CONF_BACKOFF_MAX. Le destinazioni trovate e le soglie sono
+ * salvate su CFS (make NODE_STORE=0 per non salvarle). La registrazione si
+ * rinnova ogni NODE_RUNTIME_CONF_REFRESH secondi, sotto il lifetime del server */
+#define NODE_RUNTIME_CONF_BACKOFF_MIN 1
+#define NODE_RUNTIME_CONF_BACKOFF_MAX 64
+#define NODE_RUNTIME_CONF_REFRESH 300
+
+/* Profilo TSCH, con make TSCH=1 (node/tsch_app.h) */
+#include "../node/tsch_app_conf.h"
+
 #endif /* PROJECT_CONF_H_ */
@@ -0,0 +1,156 @@
+#include "contiki.h"
+#include "coap-engine.h"
+#include <stdio.h>
+#include <string.h>
+#include "sys/log.h"
+#include "msg_codec.h"
+#include "res_batch.h"
+#include "journal.h"
+
+#define LOG_MODULE "RES_BATCH"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+int batch_size = BATCH_SIZE;   // record per invio, 1 = un POST per ciclo
+int batch_delay = BATCH_DELAY; // attesa massima del record piu' vecchio (s)
+
+static batch_record_t ring[BATCH_MAX];
+static uint8_t head = 0, count = 0;
+static uint8_t sending = 0;    // record in testa al ring inclusi nell'invio in corso
+static uint16_t sent = 0, lost = 0;
+
+uint8_t batch_add(const batch_record_t *r) {
+  if(count == BATCH_MAX) {
+    // Ring pieno: il record piu' vecchio va nel journal, anche se e' in invio (se il batch arriva,
+    // il doppione recuperato dal journal il server lo ignora). Senza journal un record in invio non
+    // si toglie, perche' a invio fallito andrebbe perso: si scarta il nuovo
+    if(!JOURNAL || journal_append(&ring[head]) != JOURNAL_OK) {
+      lost++;
+      if(sending > 0) {
+        return count;
+      }
+    }
+    if(sending > 0) {
+      sending--;
+    }
+    head = (head + 1) % BATCH_MAX;
+    count--;
+  }
+  ring[(head + count) % BATCH_MAX] = *r;
+  count++;
+  return count;
+}
+
+uint8_t batch_pending(void) {
+  return count - sending;
+}
+
+static void put_row(msg_writer_t *w, const batch_record_t *r, uint32_t bt, uint8_t first) {
+  msg_put_raw(w, first ? "[" : ",[", first ? 1 : 2);
+  msg_put_int(w, (int32_t)(r->ts - bt));
+  msg_put_raw(w, ",", 1); msg_put_int(w, r->sol);
+  msg_put_raw(w, ",", 1); msg_put_int(w, r->mese);
+  msg_put_raw(w, ",", 1); msg_put_int(w, r->ora);
+  msg_put_raw(w, ",", 1); msg_put_int(w, r->temp);
+  msg_put_raw(w, ",", 1); msg_put_int(w, r->hum);
+  msg_put_raw(w, ",", 1); msg_put_int(w, r->pow);
+  msg_put_raw(w, ",", 1); msg_put_int(w, r->npow);
+  msg_put_raw(w, ",", 1); msg_put_int(w, r->nsol);
+  msg_put_raw(w, ",", 1); msg_put_int(w, r->miss);
+  msg_put_raw(w, "]", 1);
+}
+
+static void put_start(msg_writer_t *w, uint32_t bt, uint8_t replay) {
+  msg_put_raw(w, "{\"bt\":", 6);
+  msg_put_int(w, (int32_t)bt);
+  if(replay) {
+    msg_put_raw(w, ",\"replay\":1", 11);
+  }
+  msg_put_raw(w, ",\"rows\":[", 9);
+}
+
+int batch_encode(char *buf, uint16_t size) {
+  msg_writer_t w = { buf, size, 0, 0 };
+  uint32_t bt = ring[head].ts;
+  uint8_t i;
+
+  put_start(&w, bt, 0);
+  for(i = 0; i < count; i++) {
+    put_row(&w, &ring[(head + i) % BATCH_MAX], bt, i == 0);
+  }
+  msg_put_raw(&w, "]}", 2);
+  sending = count;
+  return msg_writer_end(&w);
+}
+
+int batch_encode_records(const batch_record_t *r, uint8_t n, char *buf, uint16_t size) {
+  msg_writer_t w = { buf, size, 0, 0 };
+  uint8_t i;
+
+  put_start(&w, r[0].ts, 1);
+  for(i = 0; i < n; i++) {
+    put_row(&w, &r[i], r[0].ts, i == 0);
+  }
+  msg_put_raw(&w, "]}", 2);
+  return msg_writer_end(&w);
+}
+
+void batch_sent(uint8_t delivered) {
+  if(delivered) {
+    head = (head + sending) % BATCH_MAX;
+    count -= sending;
+    sent++;
+  } else if(JOURNAL) {
+    // Server non raggiungibile: i record in invio passano al journal e il ring si libera
+    while(sending > 0 && journal_append(&ring[head]) == JOURNAL_OK) {
+      head = (head + 1) % BATCH_MAX;
+      count--;
+      sending--;
+    }
+  }
+  sending = 0;
+}
+
+// GET
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset) {
+  const journal_stats_t *js = journal_stats();
+  msg_batch_t m = { batch_size, batch_delay, count, sent, lost,
+                    journal_depth(), js->appended, js->replayed, js->evicted, js->rate, MSG_BATCH_REQUIRED };
+  int len = msg_batch_encode(&m, (char *)buffer, preferred_size);
+  if(len < 0) {
+    len = 0;
+  }
+  coap_set_header_content_format(response, APPLICATION_JSON);
+  coap_set_payload(response, buffer, len);
+}
+
+// PUT: size e/o delay, gli altri restano invariati
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+                            uint16_t preferred_size, int32_t *offset) {
+  const uint8_t *payload = NULL;
+  int len = coap_get_payload(request, &payload);
+  msg_batch_set_t m;
+
+  if(len > 0 && msg_batch_set_decode(payload, len, &m) == MSG_OK && m.present &&
+     (!(m.present & MSG_BATCH_SET_SIZE) || m.size <= BATCH_MAX)) {
+    if(m.present & MSG_BATCH_SET_SIZE) {
+      batch_size = m.size;
+      LOG_INFO("Updated batch size to %d\n", batch_size);
+    }
+    if(m.present & MSG_BATCH_SET_DELAY) {
+      batch_delay = m.delay;
+      LOG_INFO("Updated batch delay to %d s\n", batch_delay);
+    }
+    coap_set_status_code(response, CHANGED_2_04);
+    return;
+  }
+  LOG_WARN("Payload non valido (size 1..%d, delay 1..3600): %.*s\n", BATCH_MAX, len, payload ? (const char *)payload : "");
+  coap_set_status_code(response, BAD_REQUEST_4_00);
+}
+
+RESOURCE(res_batch,
+     "title=\"Telemetry batching\";rt=\"Control\"",
+     res_get_handler,
+     NULL,
+     res_put_handler,
+     NULL);
@@ -0,0 +1,94 @@
+/*
+ * Telemetria a batch dall'edge al server: i record dati + previsione di
+ * ogni ciclo si accumulano in un ring in RAM e partono insieme in un solo
+ * POST su /res_bulk (block-wise se non sta in un messaggio) quando il ring
+ * raggiunge batch_size record o il record piu' vecchio ha batch_delay
+ * secondi. Con batch_size 1 l'edge invia un POST su /res_data e uno su
+ * /res_prediction per ciclo, come senza batch.
+ *
+ * Con make JOURNAL=1 i record non consegnati (invio fallito o ring pieno)
+ * passano al journal su flash (node/journal.h) e l'edge li recupera su
+ * /res_bulk a ritmo limitato quando il server torna a rispondere.
+ *
+ * batch_size e batch_delay si cambiano a runtime con un PUT su /res_batch.
+ * Il payload e' JSON con il base time e una riga per record, tempi relativi:
+ *   {"bt":1759823360,"rows":[[0,sol,mese,ora,temp,hum,pow,nPow,nSol,miss],...]}
+ * I batch di recupero dal journal hanno anche "replay":1: il server li
+ * salva senza la logica di controllo, che riguarda solo i dati attuali.
+ */
+#ifndef RES_BATCH_H_
+#define RES_BATCH_H_
+
+#include <stdint.h>
+
+/* Capienza del ring (record) */
+#ifdef BATCH_CONF_MAX
+#define BATCH_MAX BATCH_CONF_MAX
+#else
+#define BATCH_MAX 8
+#endif
+
+/* Valori iniziali di batch_size e batch_delay (s) */
+#ifdef BATCH_CONF_SIZE
+#define BATCH_SIZE BATCH_CONF_SIZE
+#else
+#define BATCH_SIZE 4
+#endif
+#ifdef BATCH_CONF_DELAY
+#define BATCH_DELAY BATCH_CONF_DELAY
+#else
+#define BATCH_DELAY 60
+#endif
+
+/* Blocchi Block1 dell'upload (<= REST_MAX_CHUNK_SIZE del server e COAP_QUEUE_PAYLOAD) */
+#ifdef BATCH_CONF_BLOCK
+#define BATCH_BLOCK BATCH_CONF_BLOCK
+#else
+#define BATCH_BLOCK 64
+#endif
+
+/* Recupero del journal (make JOURNAL=1): record per POST e pausa tra i POST (s) */
+#ifdef JOURNAL_CONF_REPLAY_BATCH
+#define JOURNAL_REPLAY_BATCH JOURNAL_CONF_REPLAY_BATCH
+#else
+#define JOURNAL_REPLAY_BATCH BATCH_MAX
+#endif
+#ifdef JOURNAL_CONF_REPLAY_INTERVAL
+#define JOURNAL_REPLAY_INTERVAL JOURNAL_CONF_REPLAY_INTERVAL
+#else
+#define JOURNAL_REPLAY_INTERVAL 2
+#endif
+
+/* Payload massimo: intestazione (con "replay":1) e una riga da al piu' 10 interi per record */
+#define BATCH_BUF_SIZE(n) (35 + (n) * 72)
+
+typedef struct batch_record {
+  uint32_t ts;           /* UNIX epoch */
+  int32_t sol, pow, npow, nsol;
+  int16_t temp, hum;
+  uint8_t mese, ora, miss;
+} batch_record_t;
+
+extern int batch_size;
+extern int batch_delay;
+
+/* Accoda un record; a ring pieno sovrascrive il piu' vecchio dopo averlo
+ * spostato nel journal (JOURNAL). Senza journal lo scarta se non e' in
+ * invio, altrimenti scarta r. Ritorna i record nel ring */
+uint8_t batch_add(const batch_record_t *r);
+
+uint8_t batch_pending(void);
+
+/* Scrive il batch con tutti i record in attesa e li segna in invio.
+ * Ritorna la lunghezza o MSG_ERR_SPACE */
+int batch_encode(char *buf, uint16_t size);
+
+/* Scrive un batch di recupero con gli n record di r riletti dal journal,
+ * segnato con "replay":1. Ritorna la lunghezza o MSG_ERR_SPACE */
+int batch_encode_records(const batch_record_t *r, uint8_t n, char *buf, uint16_t size);
+
+/* Esito dell'invio: consegnato toglie dal ring i record inviati, altrimenti
+ * restano per il prossimo tentativo (con JOURNAL passano al journal su flash) */
+void batch_sent(uint8_t delivered);
+
+#endif /* RES_BATCH_H_ */
@@ -0,0 +1,70 @@
+// === /res_forecast ===
+#include "contiki.h"
+#include "coap-engine.h"
+#include <stdio.h>
+#include <string.h>
+#include "sys/log.h"
+#include "prediction_engine.h"
+
+#if PREDICTION_FORECAST
+
+#define LOG_MODULE "RES_FORECAST"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+extern int forecast_power[PREDICTION_FORECAST_HORIZON];
+extern int forecast_hour;
+
+static char forecast_json[24 + PREDICTION_FORECAST_HORIZON * 7];
+
+// JSON completo: {"ora":h,"fc":[+1h,...,+24h]}
+static int forecast_to_json(void) {
+  int len = snprintf(forecast_json, sizeof(forecast_json), "{\"ora\":%d,\"fc\":[", forecast_hour);
+  int h;
+
+  for(h = 0; h < PREDICTION_FORECAST_HORIZON && len < (int)sizeof(forecast_json); h++) {
+    len += snprintf(forecast_json + len, sizeof(forecast_json) - len, h ? ",%d" : "%d", forecast_power[h]);
+  }
+  if(len < (int)sizeof(forecast_json)) {
+    len += snprintf(forecast_json + len, sizeof(forecast_json) - len, "]}");
+  }
+  return len < (int)sizeof(forecast_json) ? len : (int)sizeof(forecast_json) - 1;
+}
+
+// GET (anche per le notifiche): block-wise se il vettore supera preferred_size
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset) {
+  int32_t start = offset ? *offset : 0;
+  int32_t len, chunk;
+
+  if(forecast_hour < 0) {
+    coap_set_status_code(response, SERVICE_UNAVAILABLE_5_03);
+    return;
+  }
+
+  len = forecast_to_json();
+  if(start >= len) {
+    coap_set_status_code(response, BAD_OPTION_4_02);
+    return;
+  }
+
+  chunk = len - start;
+  if(chunk > preferred_size) {
+    chunk = preferred_size;
+  }
+  memcpy(buffer, forecast_json + start, chunk);
+  coap_set_header_content_format(response, APPLICATION_JSON);
+  coap_set_payload(response, buffer, chunk);
+
+  if(offset) {
+    *offset = start + chunk < len ? start + chunk : -1;
+  }
+}
+
+RESOURCE(res_forecast,
+     "title=\"Forecast 24h\";obs;rt=\"Forecast\"",
+     res_get_handler,
+     NULL,
+     NULL,
+     NULL);
+
+#endif /* PREDICTION_FORECAST */
@@ -4,24 +4,36 @@
 #include <stdio.h>
 #include <string.h>
 #include "sys/log.h"
+#include "sys/rtimer.h"
+#include "msg_codec.h"
 
 #define LOG_MODULE "RES_ROOF"
 #define LOG_LEVEL LOG_LEVEL_INFO
 
-#define MAX_DATA_SIZE 128
-
-static char roof_data[MAX_DATA_SIZE]; // Buffer dati per la risorsa roof
-extern int roof_updated; // Flag per indicare se la risorsa è stata aggiornata
+extern msg_roof_t roof_msg; // Ultimo campione valido, servito dal GET
 static int parse = 0;
 
 extern void try_regression(); // Funzione per avviare la regressione e inviare i dati al server
-extern int parse_roof(const char *json_str);
+extern int parse_roof(const uint8_t *payload, uint16_t len, unsigned int format);
+extern void put_handler_latency(rtimer_clock_t start); // latenza dell'handler, separata da quella dell'inferenza
 
 // GET
 void res_roof_get_handler(coap_message_t *request, coap_message_t *response,
                           uint8_t *buffer, uint16_t buffer_size, int32_t *offset) {
-  int len = snprintf((char *)buffer, buffer_size, "%s", roof_data);
-  coap_set_header_content_format(response, APPLICATION_JSON);
+  unsigned int accept = APPLICATION_JSON;
+  int len = 0;
+
+  coap_get_header_accept(request, &accept);
+  if(accept == MSG_CT_SENML_CBOR) {
+    len = roof_msg.present ? msg_roof_encode_senml(&roof_msg, (char *)buffer, buffer_size) : 0;
+  } else {
+    accept = APPLICATION_JSON;
+    len = roof_msg.present ? msg_roof_encode(&roof_msg, (char *)buffer, buffer_size) : 0;
+  }
+  if(len < 0) {
+    len = 0;
+  }
+  coap_set_header_content_format(response, accept);
   coap_set_payload(response, buffer, len);
 }
 
@@ -29,29 +41,36 @@ void res_roof_get_handler(coap_message_t *request, coap_message_t *response,
 // PUT
 void res_roof_put_handler(coap_message_t *request, coap_message_t *response,
                            uint8_t *buffer, uint16_t buffer_size, int32_t *offset) {
+  rtimer_clock_t start = RTIMER_NOW();
   const uint8_t *payload = NULL;
   size_t len = coap_get_payload(request, &payload);
-  if (len > 0 && len < sizeof(roof_data)) {
-    memcpy(roof_data, payload, len);
-    roof_data[len] = '\0';
-    LOG_INFO("Ricevuto PUT su /res_roof: %s\n", roof_data);
+  unsigned int format = APPLICATION_JSON; // senza Content-Format: JSON
+  coap_get_header_content_format(request, &format);
+  if (format != APPLICATION_JSON && format != MSG_CT_SENML_CBOR) {
+    coap_set_status_code(response, UNSUPPORTED_MEDIA_TYPE_4_15);
+  } else if (len > 0) {
+    if (format == APPLICATION_JSON) {
+      LOG_INFO("Ricevuto PUT su /res_roof: %.*s\n", (int)len, (const char *)payload);
+    } else {
+      LOG_INFO("Ricevuto PUT su /res_roof: SenML-CBOR, %u byte\n", (unsigned)len);
+    }
 
-    parse = parse_roof(roof_data);
+    parse = parse_roof(payload, len, format); // direttamente sul payload, senza copie
 
     if(parse==1){
     coap_set_status_code(response, CHANGED_2_04);
-    roof_updated = 1; // Ho ricevuto dati validi, aggiorno flag
-    try_regression();
+    try_regression(); // allinea il campione con l'altro sensore e accoda soltanto l'inferenza
     }else{
       coap_set_status_code(response, BAD_REQUEST_4_00);
     }
   } else {
     coap_set_status_code(response, BAD_REQUEST_4_00);
   }
+  put_handler_latency(start);
 }
 
 RESOURCE(res_roof,
-         "title=\"Roof Sensor\";rt=\"application/json\"",
+         "title=\"Roof Sensor\";rt=\"application/json\";ct=\"50 112\"",
          res_roof_get_handler,
          NULL,
          res_roof_put_handler,
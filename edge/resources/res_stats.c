@@ -0,0 +1,70 @@
+// === /res_stats: latenza per stadio della pipeline ed Energest (node/pipe_stats.h), osservabile ===
+#include "contiki.h"
+#include "coap-engine.h"
+#include <string.h>
+#include "pipe_stats.h"
+
+#if PIPE_STATS
+
+#ifdef PIPE_STATS_CONF_JSON_SIZE
+#define STATS_JSON_SIZE PIPE_STATS_CONF_JSON_SIZE
+#else
+#define STATS_JSON_SIZE 900
+#endif
+
+// Notifica agli osservatori (il server, che salva su MySQL) ogni PIPE_STATS_PERIOD secondi
+#ifdef PIPE_STATS_CONF_PERIOD
+#define PIPE_STATS_PERIOD PIPE_STATS_CONF_PERIOD
+#else
+#define PIPE_STATS_PERIOD 60
+#endif
+
+static char stats_json[STATS_JSON_SIZE];
+static int stats_len;
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset);
+static void res_periodic_handler(void);
+
+PERIODIC_RESOURCE(res_stats,
+     "title=\"Pipeline stats\";obs;rt=\"application/json\"",
+     res_get_handler,
+     NULL,
+     NULL,
+     NULL,
+     PIPE_STATS_PERIOD * CLOCK_SECOND,
+     res_periodic_handler);
+
+// GET (anche per le notifiche), block-wise come /res_prof: il JSON viene ricostruito
+// solo al blocco 0, cosi' i blocchi successivi restano coerenti
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset) {
+  int32_t start = offset ? *offset : 0;
+  int32_t chunk;
+
+  if(start == 0) {
+    stats_len = pipe_stats_json(stats_json, sizeof(stats_json));
+  }
+  if(start >= stats_len) {
+    coap_set_status_code(response, BAD_OPTION_4_02);
+    return;
+  }
+
+  chunk = stats_len - start;
+  if(chunk > preferred_size) {
+    chunk = preferred_size;
+  }
+  memcpy(buffer, stats_json + start, chunk);
+  coap_set_header_content_format(response, APPLICATION_JSON);
+  coap_set_payload(response, buffer, chunk);
+
+  if(offset) {
+    *offset = start + chunk < stats_len ? start + chunk : -1;
+  }
+}
+
+static void res_periodic_handler(void) {
+  coap_notify_observers(&res_stats);
+}
+
+#endif /* PIPE_STATS */
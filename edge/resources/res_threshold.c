@@ -4,6 +4,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include "sys/log.h"
+#include "msg_codec.h"
+#include "node_runtime.h"
 
 #define LOG_MODULE "RES_THRESHOLD"
 #define LOG_LEVEL LOG_LEVEL_INFO
@@ -14,13 +16,39 @@ int auto_furnace_ctrl = 1; // Controllo automatico della furnace abilitato di de
 
 extern void set_auto_ctrl(); // Funzione che cambia stato di Edge e il led associato
 
+// Configurazione salvata su flash (node/node_runtime.h): l'edge riavviato riparte dalle ultime soglie
+#define THRESHOLD_FILE "edgecfg"
+typedef struct threshold_cfg {
+  int threshold_on;
+  int threshold_off;
+  int auto_furnace_ctrl;
+} threshold_cfg_t;
+
+void threshold_restore(void) {
+  threshold_cfg_t cfg;
+
+  if (node_runtime_load(THRESHOLD_FILE, &cfg, sizeof(cfg))) {
+    threshold_on = cfg.threshold_on;
+    threshold_off = cfg.threshold_off;
+    auto_furnace_ctrl = cfg.auto_furnace_ctrl;
+    LOG_INFO("Configurazione dalla flash: on %d, off %d, auto %d\n", threshold_on, threshold_off, auto_furnace_ctrl);
+  }
+}
+
+void threshold_store(void) {
+  threshold_cfg_t cfg = { threshold_on, threshold_off, auto_furnace_ctrl };
+
+  node_runtime_save(THRESHOLD_FILE, &cfg, sizeof(cfg));
+}
+
 // GET
 static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
               uint16_t preferred_size, int32_t *offset) {
-  int len = snprintf((char *)buffer, preferred_size, "{\"auto_furnace_ctrl\":%d,"
-                                                      "\"on_threshold\":%d,"
-                                                      "\"off_threshold\":%d}",
-                                                      auto_furnace_ctrl, threshold_on, threshold_off);
+  msg_threshold_t m = { auto_furnace_ctrl, threshold_on, threshold_off, MSG_THRESHOLD_REQUIRED };
+  int len = msg_threshold_encode(&m, (char *)buffer, preferred_size);
+  if(len < 0) {
+    len = 0;
+  }
   coap_set_header_content_format(response, APPLICATION_JSON);
   coap_set_payload(response, buffer, len);
 }
@@ -32,42 +60,28 @@ static void res_put_handler(coap_message_t *request, coap_message_t *response, u
   int len = coap_get_payload(request, &payload);
 
   if (len > 0 && payload) {
-    char json[128];
-    memset(json, 0, sizeof(json));
-    strncpy(json, (const char *)payload, sizeof(json) - 1);
+    msg_threshold_set_t m;
 
-    // Parsing del JSON cercando  threshold_on, threshold_off e auto_furnace_ctrl se presenti
-    if (strstr(json, "threshold_on") != NULL) {
-      int new_val;
-      if (sscanf(json, "{\"threshold_on\":%d}", &new_val) == 1) {
-        threshold_on = new_val;
+    // Parsing in una passata: threshold_on, threshold_off e auto_furnace_ctrl se presenti, in qualsiasi ordine
+    if (msg_threshold_set_decode(payload, len, &m) == MSG_OK && m.present) {
+      if (m.present & MSG_THRESHOLD_SET_THRESHOLD_ON) {
+        threshold_on = m.threshold_on;
         LOG_INFO("Updated threshold_on to %d\n", threshold_on);
-        coap_set_status_code(response, CHANGED_2_04);
-        return;
       }
-    }
-
-    if (strstr(json, "threshold_off") != NULL) {
-      int new_val;
-      if (sscanf(json, "{\"threshold_off\":%d}", &new_val) == 1) {
-        threshold_off = new_val;
+      if (m.present & MSG_THRESHOLD_SET_THRESHOLD_OFF) {
+        threshold_off = m.threshold_off;
         LOG_INFO("Updated threshold_off to %d\n", threshold_off);
-        coap_set_status_code(response, CHANGED_2_04);
-        return;
       }
-    }
-
-    if(strstr(json, "auto_furnace_ctrl") != NULL) {
-      int new_val;
-      if (sscanf(json, "{\"auto_furnace_ctrl\":%d}", &new_val) == 1 && (new_val == 0 || new_val == 1)) {
-        auto_furnace_ctrl = new_val;
+      if (m.present & MSG_THRESHOLD_SET_AUTO_FURNACE_CTRL) {
+        auto_furnace_ctrl = m.auto_furnace_ctrl;
         set_auto_ctrl(); // Cambia stato della edge e led
         LOG_INFO("Updated auto_furnace_ctrl to %d\n", auto_furnace_ctrl);
-        coap_set_status_code(response, CHANGED_2_04);
-        return;
       }
+      threshold_store();
+      coap_set_status_code(response, CHANGED_2_04);
+      return;
     }
-    LOG_WARN("[RES_THRESHOLD] Payload non valido: %s\n", json);
+    LOG_WARN("[RES_THRESHOLD] Payload non valido: %.*s\n", len, (const char *)payload);
     coap_set_status_code(response, BAD_REQUEST_4_00);
   } else {
     LOG_WARN("[RES_THRESHOLD] Payload mancante\n");
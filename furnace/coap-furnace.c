@@ -8,25 +8,14 @@
 #include <stdlib.h>
 #include "os/dev/leds.h"
 #include "os/dev/button-hal.h"
-#include "net/netstack.h"
-#include "net/routing/routing.h"
-#include "net/ipv6/uiplib.h"
+#include "coap_group.h"
+#include "node_runtime.h"
 
 #define LOG_MODULE "NodeFurnace"
 #define LOG_LEVEL LOG_LEVEL_INFO
 
-#define SERVER_EP "coap://[fd00::1]:5683"
-
-static coap_endpoint_t server_ep;
-static coap_message_t request[1];
-static struct etimer wait_timer; // Timer per ricerca root iniziale
 extern int furnace_state; // Valore della risorsa res_furnace
 
-static char json_buf[64];
-
-// Iteratori
-int attempts = 0;
-
 PROCESS(node_furnace_process, "Furnace Actuator Node");
 AUTOSTART_PROCESSES(&node_furnace_process);
 
@@ -47,25 +36,23 @@ void set_furnace(int new_state) {
     }
 }
 
-// Funzione di callback per gestire la risposta dal server
-void response_handler(coap_message_t *response){
-
-   if (response == NULL) {
-    LOG_INFO("Timeout dal server\n");
-    return;
+#if COAP_GROUP
+// Comando di gruppo dell'edge (node/coap_group.h): qui conta solo furnace_state.
+// La notifica observe fa da conferma, anche a stato invariato se l'edge la chiede
+static void group_command(const msg_group_t *m) {
+  if(m->furnace_state != furnace_state) {
+    LOG_INFO("Comando di gruppo, cambio stato: %d -> %d\n", furnace_state, (int)m->furnace_state);
+    furnace_state = m->furnace_state;
+    set_furnace(furnace_state);
+    coap_notify_observers(&res_furnace);
+  } else if(m->ack & COAP_GROUP_FURNACE) {
+    coap_notify_observers(&res_furnace);
   }
-
-  // Stampa e controlla codice CoAP (es. 2.05, 4.04, ecc.)
-  uint8_t class = response->code >> 5;
-  uint8_t detail = response->code & 0x1F;
-  LOG_INFO("Codice risposta: %u.%02u\n", class, detail);
 }
+#endif
 
 PROCESS_THREAD(node_furnace_process, ev, data)
 {
-  static uip_ipaddr_t dest_ipaddr;
-  char ipstr[64]; // temp ip root e server
-  char endpoint[128]; // indirizzo server root
   button_hal_button_t *btn;
 
   PROCESS_BEGIN();
@@ -77,47 +64,23 @@ PROCESS_THREAD(node_furnace_process, ev, data)
   // Inizializzo risorse del nodo
   res_furnace.flags |= IS_OBSERVABLE;
   coap_activate_resource(&res_furnace, "res_furnace");
+#if COAP_GROUP
+  coap_group_join(group_command);
+#endif
 
-  // Ricerca nodo ROOT
-  etimer_set(&wait_timer, CLOCK_SECOND);
-  while(!NETSTACK_ROUTING.node_is_reachable() ||
-      !NETSTACK_ROUTING.get_root_ipaddr(&dest_ipaddr)) {
-  LOG_INFO("In attesa del root...\n");
-  leds_toggle(LEDS_RED);
-  PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&wait_timer));
-  etimer_reset(&wait_timer);
-  }
-  
-  leds_on(LEDS_RED);
-
-  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &dest_ipaddr);
-  snprintf(endpoint, sizeof(endpoint), "coap://[%s]:5683", ipstr);
-  LOG_INFO("Root trovato: %s\n", endpoint);
-
-  coap_endpoint_parse(SERVER_EP, strlen(SERVER_EP), &server_ep);
+  // Root e registrazione in node_runtime_process (node/node_runtime.h), con backoff
+  // sui fallimenti: intanto i comandi e il bottone sono gia' serviti
+  node_runtime_start("{\"id\":\"nodeFurnace\", \"resources\":[\"/res_furnace\"]}", NULL, 0);
 
-
-   // === 1. REGISTRAZIONE + REGISTRAZIONE RISORSE ===
-  snprintf(json_buf, sizeof(json_buf),
-           "{\"id\":\"nodeFurnace\", \"resources\":[\"/res_furnace\"]}");
-  
-  coap_init_message(request, COAP_TYPE_CON, COAP_POST, coap_get_mid());
-  coap_set_header_uri_path(request, "register");
-  coap_set_payload(request, (uint8_t *)json_buf, strlen(json_buf));
-
-  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &server_ep.ipaddr);
-  LOG_INFO("-> Invio a CoaP server IP: [%s], porta: %u\n", ipstr, uip_ntohs(server_ep.port));
-
-  COAP_BLOCKING_REQUEST(&server_ep, request, response_handler);
-  LOG_INFO("Registrazione completata\n");
-
-  leds_on(LEDS_BLUE);
-
-  // === 2. CICLO INFINITO ===
+  // === CICLO INFINITO ===
   while(1) {
     PROCESS_WAIT_EVENT();
     //LOG_INFO("Evento ricevuto: %u\n", ev);
 
+    if(ev == ev_runtime_registered) {
+      leds_on(LEDS_BLUE);
+    }
+
     // Gestione evento pressione del bottone
     if(ev == button_hal_release_event) {
       btn = (button_hal_button_t *)data;
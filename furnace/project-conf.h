@@ -60,4 +60,15 @@
 #define COAP_MAX_CHUNK_SIZE REST_MAX_CHUNK_SIZE
 */
 
+/* Attuazione di gruppo (node/coap_group.h), con make GROUP=1: il nodo si iscrive
+ * al gruppo ff05::1:COAP_GROUP_CONF_ID dell'edge e serve /res_group. I
+ * pacchetti del gruppo li inoltra il motore multicast MPL */
+#if COAP_GROUP_CONF_ENABLED
+#define UIP_MCAST6_CONF_ENGINE UIP_MCAST6_ENGINE_MPL
+#define COAP_GROUP_CONF_ID 1
+#endif
+
+/* Profilo TSCH, con make TSCH=1 (node/tsch_app.h) */
+#include "../node/tsch_app_conf.h"
+
 #endif /* PROJECT_CONF_H_ */
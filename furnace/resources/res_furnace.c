@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "sys/log.h"
+#include "msg_codec.h"
 
 
 #define LOG_MODULE "RES_FURNACE"
@@ -14,11 +15,16 @@ extern void set_furnace(int new_state);
 static int parse = 0;
 coap_resource_t res_furnace;
 
-// Funzione per fare il parsing del JSON ricevuto cercando il campo "furnace_state"
-static int parse_furnace(const char *json_str, int *new_state){
-  int matched = sscanf(json_str, "{\"furnace_state\": %d}", new_state);
-  LOG_INFO("Ho fatto parsing, matched = %d\n", matched);
-  return (matched == 1);  // ritorna 1 se è andato bene
+// Funzione per fare il parsing del JSON ricevuto cercando il campo "furnace_state" (0 o 1, verificato dallo schema)
+static int parse_furnace(const uint8_t *payload, uint16_t len, int *new_state){
+  msg_furnace_t m;
+  int r = msg_furnace_decode(payload, len, &m);
+  LOG_INFO("Ho fatto parsing, esito = %d\n", r);
+  if(r != MSG_OK) {
+    return 0;
+  }
+  *new_state = m.furnace_state;
+  return 1;  // ritorna 1 se è andato bene
 }
 
 // GET
@@ -26,7 +32,11 @@ static void res_furnace_get_handler(coap_message_t *request, coap_message_t *res
                       uint8_t *buffer, uint16_t preferred_size, int32_t *offset) {
 
   LOG_INFO("[RES_FURNACE] Ricevuto GET su /res_furnace: %d\n", furnace_state);                      
-  int len = snprintf((char *)buffer, preferred_size, "{\"furnace_state\":%d}", furnace_state);
+  msg_furnace_t m = { furnace_state, 0 };
+  int len = msg_furnace_encode(&m, (char *)buffer, preferred_size);
+  if(len < 0) {
+    len = 0;
+  }
   coap_set_header_content_format(response, APPLICATION_JSON);
   coap_set_payload(response, buffer, len);
 }
@@ -34,12 +44,13 @@ static void res_furnace_get_handler(coap_message_t *request, coap_message_t *res
 // PUT
 static void res_furnace_put_handler(coap_message_t *request, coap_message_t *response,
                       uint8_t *buffer, uint16_t preferred_size, int32_t *offset) {
-  size_t len = coap_get_payload(request, (const uint8_t **)&buffer);
+  const uint8_t *payload = NULL;
+  size_t len = coap_get_payload(request, &payload);
 
     if(len > 0) {
         int new_state;
-        parse = parse_furnace((const char *)buffer, &new_state);
-        if(parse && (new_state == 0 || new_state == 1)){
+        parse = parse_furnace(payload, len, &new_state);
+        if(parse){
           LOG_INFO("[RES_FURNACE] Ricevuto PUT su /res_furnace: %d\n", new_state);
 
           // Solo se lo stato è cambiato cambia led e notifica observers
@@ -53,7 +64,7 @@ static void res_furnace_put_handler(coap_message_t *request, coap_message_t *res
         
         coap_set_status_code(response, CHANGED_2_04);
         } else {
-        LOG_WARN("[RES_FURNACE] Payload non valido: %s\n", buffer);
+        LOG_WARN("[RES_FURNACE] Payload non valido: %.*s\n", (int)len, (const char *)payload);
         coap_set_status_code(response, BAD_REQUEST_4_00);
         }
     } else {
@@ -0,0 +1,51 @@
+/*
+ * Inferenza a passi per le reti emlearn float (EmlNet), un layer per chiamata
+ * come mlp_q8_step(): permette di cedere la CPU tra un layer e l'altro.
+ * Va incluso dopo l'header del modello (eml_net.h e' solo header).
+ *
+ * Ogni layer passa dal backend di ml/mlp_backend.h (mlp_backend_dense_f32),
+ * che somma nell'ordine di eml_net_forward(): il risultato coincide con
+ * eml_net_regress(). Sono supportate le attivazioni usate dai modelli del
+ * progetto (ReLU e identita').
+ */
+#ifndef EML_NET_STEP_H_
+#define EML_NET_STEP_H_
+
+#include <eml_net.h>
+#include "mlp_backend.h"
+
+/* Ritorna 1 se restano layer, 0 quando out contiene il risultato, -1 su errore */
+static int32_t
+eml_net_step(EmlNet *net, uint8_t layer, const float *features, int32_t n_features,
+             float *out, int32_t out_length)
+{
+  const EmlNetLayer *l = &net->layers[layer];
+  const EmlNetLayer *last = &net->layers[net->n_layers - 1];
+  // Stessa alternanza di eml_net_infer(): il layer l scrive in activations1 se l e' pari
+  const float *in = layer == 0 ? features : (layer % 2 ? net->activations1 : net->activations2);
+  float *next = layer % 2 ? net->activations2 : net->activations1;
+  int32_t i;
+
+  if(layer >= net->n_layers ||
+     (layer == 0 && (n_features != l->n_inputs || out_length < last->n_outputs))) {
+    return -1;
+  }
+  mlp_backend_dense_f32(l->weights, l->biases, in, l->n_inputs, l->n_outputs, next);
+  if(l->activation == EmlNetActivationRelu) {
+    for(i = 0; i < l->n_outputs; i++) {
+      next[i] = next[i] > 0.0f ? next[i] : 0.0f;
+    }
+  } else if(l->activation != EmlNetActivationIdentity) {
+    return -1;
+  }
+
+  if(layer < net->n_layers - 1) {
+    return 1;
+  }
+  for(i = 0; i < last->n_outputs; i++) {
+    out[i] = next[i];
+  }
+  return 0;
+}
+
+#endif /* EML_NET_STEP_H_ */
@@ -0,0 +1,71 @@
+/*
+ * Backend di calcolo per i layer densi int8 di ml/mlp_q8.c e per quelli
+ * float delle reti emlearn (ml/eml_net_step.h)
+ *
+ * Ogni backend implementa lo stesso prodotto scalare int8 x int8 -> int32
+ * e il layer denso con riquantizzazione e attivazione. Il risultato e'
+ * intero, quindi tutti i backend devono dare esattamente gli stessi valori:
+ * lo verifica mlp_backend_selftest() con i vettori di ml/mlp_backend_vectors.h.
+ *
+ * Il layer float somma gli ingressi di ogni uscita nell'ordine di
+ * eml_net_forward(). Il backend SIMD calcola piu' uscite per istruzione
+ * senza cambiare quell'ordine; il DSP usa il codice portabile (SMLAD e'
+ * solo intero, la FPU dei Cortex-M4F/M33 e' scalare).
+ *
+ * Selezione con MLP_CONF_BACKEND nel project-conf.h, altrimenti automatica
+ * in base alle estensioni disponibili sul target.
+ */
+#ifndef MLP_BACKEND_H_
+#define MLP_BACKEND_H_
+
+#ifdef CONTIKI
+#include "contiki.h"
+#endif
+#include "mlp_q8.h"
+
+#define MLP_BACKEND_SCALAR 0 /* C portabile */
+#define MLP_BACKEND_DSP    1 /* Cortex-M4/M7/M33: SMLAD, due MAC 16 bit per istruzione */
+#define MLP_BACKEND_SIMD   2 /* host x86 SSE4.1/AVX2, build native (make MLP_SIMD=avx2) */
+
+#ifdef MLP_CONF_BACKEND
+#define MLP_BACKEND MLP_CONF_BACKEND
+#elif defined(__ARM_FEATURE_SIMD32)
+#define MLP_BACKEND MLP_BACKEND_DSP
+#elif defined(__AVX2__) || defined(__SSE4_1__)
+#define MLP_BACKEND MLP_BACKEND_SIMD
+#else
+#define MLP_BACKEND MLP_BACKEND_SCALAR
+#endif
+
+/* Ingressi massimi di un layer (buffer di espansione a 16 bit del backend DSP) */
+#ifdef MLP_CONF_MAX_INPUTS
+#define MLP_MAX_INPUTS MLP_CONF_MAX_INPUTS
+#else
+#define MLP_MAX_INPUTS 128
+#endif
+
+/* Verifica del backend all'avvio dei nodi con mlp_backend_selftest() */
+#ifdef MLP_CONF_SELFTEST
+#define MLP_SELFTEST MLP_CONF_SELFTEST
+#else
+#define MLP_SELFTEST 0
+#endif
+
+/* acc + w[0..n) . in[0..n) */
+int32_t mlp_backend_dot_q8(const int8_t *w, const int8_t *in, uint16_t n, int32_t acc);
+
+/* Layer nascosto completo: prodotti scalari, riquantizzazione e attivazione */
+void mlp_backend_dense_q8(const mlp_q8_layer_t *layer, const int8_t *in, int8_t *out);
+
+/* Layer float in formato emlearn, pesi w[i * n_outputs + o]: out = b + w . in,
+ * senza attivazione */
+void mlp_backend_dense_f32(const float *w, const float *b, const float *in,
+                           uint16_t n_inputs, uint16_t n_outputs, float *out);
+
+/* Nome del backend compilato, per i log */
+const char *mlp_backend_name(void);
+
+/* Esegue i vettori di test condivisi, ritorna il numero di risultati errati */
+int mlp_backend_selftest(void);
+
+#endif /* MLP_BACKEND_H_ */
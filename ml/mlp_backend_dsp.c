@@ -0,0 +1,86 @@
+// === Backend Cortex-M con estensioni DSP (stile CMSIS-NN arm_fully_connected_q7) ===
+// L'ingresso del layer viene espanso una sola volta a 16 bit nell'ordine
+// x0,x2,x1,x3: cosi' 4 pesi letti come una parola a 32 bit si separano con
+// due SXTB16 in (w0,w2) e (w1,w3) e ogni SMLAD esegue due MAC.
+#include "mlp_backend.h"
+
+#if MLP_BACKEND == MLP_BACKEND_DSP
+
+#include <arm_acle.h>
+#include <string.h>
+
+static int16_t in16[MLP_MAX_INPUTS];
+
+static void
+expand_input(const int8_t *in, uint16_t n)
+{
+  uint16_t i;
+  for(i = 0; i + 4 <= n; i += 4) {
+    in16[i] = in[i];
+    in16[i + 1] = in[i + 2];
+    in16[i + 2] = in[i + 1];
+    in16[i + 3] = in[i + 3];
+  }
+  for(; i < n; i++) {
+    in16[i] = in[i];
+  }
+}
+
+static int32_t
+dot_expanded(const int8_t *w, const int8_t *in, uint16_t n, int32_t acc)
+{
+  uint16_t i;
+  for(i = 0; i + 4 <= n; i += 4) {
+    uint32_t w32, x02, x13;
+    memcpy(&w32, &w[i], 4);      // le righe non sono allineate a 4 byte
+    memcpy(&x02, &in16[i], 4);
+    memcpy(&x13, &in16[i + 2], 4);
+    acc = __smlad(__sxtb16(w32), x02, acc);
+    acc = __smlad(__sxtb16(__ror(w32, 8)), x13, acc);
+  }
+  for(; i < n; i++) {
+    acc += (int32_t)w[i] * in[i];
+  }
+  return acc;
+}
+
+int32_t
+mlp_backend_dot_q8(const int8_t *w, const int8_t *in, uint16_t n, int32_t acc)
+{
+  if(n > MLP_MAX_INPUTS) {
+    uint16_t i;
+    for(i = 0; i < n; i++) {
+      acc += (int32_t)w[i] * in[i];
+    }
+    return acc;
+  }
+  expand_input(in, n);
+  return dot_expanded(w, in, n, acc);
+}
+
+void
+mlp_backend_dense_q8(const mlp_q8_layer_t *layer, const int8_t *in, int8_t *out)
+{
+  const int8_t *w = layer->weights;
+  uint16_t o;
+
+  if(layer->n_inputs > MLP_MAX_INPUTS) {
+    for(o = 0; o < layer->n_outputs; o++, w += layer->n_inputs) {
+      out[o] = mlp_q8_output(layer, mlp_backend_dot_q8(w, in, layer->n_inputs, layer->biases[o]));
+    }
+    return;
+  }
+
+  expand_input(in, layer->n_inputs);
+  for(o = 0; o < layer->n_outputs; o++, w += layer->n_inputs) {
+    out[o] = mlp_q8_output(layer, dot_expanded(w, in, layer->n_inputs, layer->biases[o]));
+  }
+}
+
+const char *
+mlp_backend_name(void)
+{
+  return "dsp";
+}
+
+#endif /* MLP_BACKEND == MLP_BACKEND_DSP */
@@ -0,0 +1,53 @@
+// === Backend portabile in C ===
+#include "mlp_backend.h"
+
+#if MLP_BACKEND == MLP_BACKEND_SCALAR
+
+int32_t
+mlp_backend_dot_q8(const int8_t *w, const int8_t *in, uint16_t n, int32_t acc)
+{
+  uint16_t i;
+  for(i = 0; i < n; i++) {
+    acc += (int32_t)w[i] * in[i];
+  }
+  return acc;
+}
+
+void
+mlp_backend_dense_q8(const mlp_q8_layer_t *layer, const int8_t *in, int8_t *out)
+{
+  const int8_t *w = layer->weights;
+  uint16_t o;
+
+  for(o = 0; o < layer->n_outputs; o++, w += layer->n_inputs) {
+    out[o] = mlp_q8_output(layer, mlp_backend_dot_q8(w, in, layer->n_inputs, layer->biases[o]));
+  }
+}
+
+const char *
+mlp_backend_name(void)
+{
+  return "scalar";
+}
+
+#endif /* MLP_BACKEND == MLP_BACKEND_SCALAR */
+
+// Layer float anche per il backend DSP
+#if MLP_BACKEND != MLP_BACKEND_SIMD
+
+void
+mlp_backend_dense_f32(const float *w, const float *b, const float *in,
+                      uint16_t n_inputs, uint16_t n_outputs, float *out)
+{
+  uint16_t i, o;
+
+  for(o = 0; o < n_outputs; o++) {
+    float sum = 0.0f;
+    for(i = 0; i < n_inputs; i++) {
+      sum += w[(uint32_t)i * n_outputs + o] * in[i];
+    }
+    out[o] = sum + b[o];
+  }
+}
+
+#endif /* MLP_BACKEND != MLP_BACKEND_SIMD */
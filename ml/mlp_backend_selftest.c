@@ -0,0 +1,49 @@
+// === Verifica del backend compilato con i vettori di test condivisi ===
+#include "mlp_backend.h"
+
+#if MLP_SELFTEST
+
+#include "mlp_backend_vectors.h"
+
+int
+mlp_backend_selftest(void)
+{
+  int8_t out[80];
+  float out_f32[48];
+  int errors = 0;
+  uint16_t c, o, offset = 0;
+
+  for(c = 0; c < MLP_VEC_DOT_CASES; c++) {
+    int32_t r = mlp_backend_dot_q8(&mlp_vec_dot_w[offset], &mlp_vec_dot_x[offset],
+                                   mlp_vec_dot_n[c], mlp_vec_dot_bias[c]);
+    if(r != mlp_vec_dot_expected[c]) {
+      errors++;
+    }
+    offset += mlp_vec_dot_n[c];
+  }
+
+  for(c = 0; c < MLP_VEC_DENSE_CASES; c++) {
+    mlp_backend_dense_q8(&mlp_vec_dense_layers[c], mlp_vec_dense_x[c], out);
+    for(o = 0; o < mlp_vec_dense_layers[c].n_outputs; o++) {
+      if(out[o] != mlp_vec_dense_expected[c][o]) {
+        errors++;
+      }
+    }
+  }
+
+  // Layer float: stessa somma dei vettori, a meno dell'arrotondamento di un'eventuale FMA
+  for(c = 0; c < MLP_VEC_F32_CASES; c++) {
+    mlp_backend_dense_f32(mlp_vec_f32_w[c], mlp_vec_f32_b[c], mlp_vec_f32_x[c],
+                          mlp_vec_f32_shape[c][0], mlp_vec_f32_shape[c][1], out_f32);
+    for(o = 0; o < mlp_vec_f32_shape[c][1]; o++) {
+      float d = out_f32[o] - mlp_vec_f32_expected[c][o];
+      float e = mlp_vec_f32_expected[c][o];
+      if((d < 0 ? -d : d) > 1e-5f * (1.0f + (e < 0 ? -e : e))) {
+        errors++;
+      }
+    }
+  }
+  return errors;
+}
+
+#endif /* MLP_SELFTEST */
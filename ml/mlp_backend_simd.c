@@ -0,0 +1,99 @@
+// === Backend SIMD x86 per i build native (simulazione e replay offline) ===
+// I pesi e gli ingressi int8 vengono estesi a 16 bit e moltiplicati a
+// coppie con PMADDWD: 8 MAC per istruzione con SSE4.1, 16 con AVX2.
+// Nei layer float i pesi di un ingresso sono contigui per uscita: ogni
+// istruzione aggiorna 4 (SSE) o 8 (AVX) uscite, con moltiplicazione e somma
+// separate come nel codice scalare.
+#include "mlp_backend.h"
+
+#if MLP_BACKEND == MLP_BACKEND_SIMD
+
+#include <immintrin.h>
+
+int32_t
+mlp_backend_dot_q8(const int8_t *w, const int8_t *in, uint16_t n, int32_t acc)
+{
+  uint16_t i = 0;
+  __m128i sum4;
+
+#ifdef __AVX2__
+  __m256i sum8 = _mm256_setzero_si256();
+  for(; i + 16 <= n; i += 16) {
+    __m256i w16 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)&w[i]));
+    __m256i x16 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)&in[i]));
+    sum8 = _mm256_add_epi32(sum8, _mm256_madd_epi16(w16, x16));
+  }
+  sum4 = _mm_add_epi32(_mm256_castsi256_si128(sum8), _mm256_extracti128_si256(sum8, 1));
+#else
+  sum4 = _mm_setzero_si128();
+#endif
+  for(; i + 8 <= n; i += 8) {
+    __m128i w16 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)&w[i]));
+    __m128i x16 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)&in[i]));
+    sum4 = _mm_add_epi32(sum4, _mm_madd_epi16(w16, x16));
+  }
+  sum4 = _mm_add_epi32(sum4, _mm_shuffle_epi32(sum4, _MM_SHUFFLE(1, 0, 3, 2)));
+  sum4 = _mm_add_epi32(sum4, _mm_shuffle_epi32(sum4, _MM_SHUFFLE(2, 3, 0, 1)));
+  acc += _mm_cvtsi128_si32(sum4);
+
+  for(; i < n; i++) {
+    acc += (int32_t)w[i] * in[i];
+  }
+  return acc;
+}
+
+void
+mlp_backend_dense_q8(const mlp_q8_layer_t *layer, const int8_t *in, int8_t *out)
+{
+  const int8_t *w = layer->weights;
+  uint16_t o;
+
+  for(o = 0; o < layer->n_outputs; o++, w += layer->n_inputs) {
+    out[o] = mlp_q8_output(layer, mlp_backend_dot_q8(w, in, layer->n_inputs, layer->biases[o]));
+  }
+}
+
+void
+mlp_backend_dense_f32(const float *w, const float *b, const float *in,
+                      uint16_t n_inputs, uint16_t n_outputs, float *out)
+{
+  uint16_t i, o = 0;
+
+#ifdef __AVX2__
+  for(; o + 8 <= n_outputs; o += 8) {
+    __m256 sum = _mm256_setzero_ps();
+    for(i = 0; i < n_inputs; i++) {
+      __m256 wv = _mm256_loadu_ps(&w[(uint32_t)i * n_outputs + o]);
+      sum = _mm256_add_ps(sum, _mm256_mul_ps(wv, _mm256_set1_ps(in[i])));
+    }
+    _mm256_storeu_ps(&out[o], _mm256_add_ps(sum, _mm256_loadu_ps(&b[o])));
+  }
+#endif
+  for(; o + 4 <= n_outputs; o += 4) {
+    __m128 sum = _mm_setzero_ps();
+    for(i = 0; i < n_inputs; i++) {
+      __m128 wv = _mm_loadu_ps(&w[(uint32_t)i * n_outputs + o]);
+      sum = _mm_add_ps(sum, _mm_mul_ps(wv, _mm_set1_ps(in[i])));
+    }
+    _mm_storeu_ps(&out[o], _mm_add_ps(sum, _mm_loadu_ps(&b[o])));
+  }
+  for(; o < n_outputs; o++) {
+    float sum = 0.0f;
+    for(i = 0; i < n_inputs; i++) {
+      sum += w[(uint32_t)i * n_outputs + o] * in[i];
+    }
+    out[o] = sum + b[o];
+  }
+}
+
+const char *
+mlp_backend_name(void)
+{
+#ifdef __AVX2__
+  return "avx2";
+#else
+  return "sse4.1";
+#endif
+}
+
+#endif /* MLP_BACKEND == MLP_BACKEND_SIMD */
@@ -0,0 +1,41 @@
+/* Generato da tools/mlp_vectors.py: vettori di test per ml/mlp_backend_selftest.c */
+#define MLP_VEC_DOT_CASES 16
+static const uint16_t mlp_vec_dot_n[16] = { 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 48, 80, 127 };
+static const int8_t mlp_vec_dot_w[436] = { 127, 69, -102, 119, -35, 58, 15, -104, 9, 40, 103, -59, 49, -127, -127, -127, -127, -127, -127, -127, -108, 61, -83, 64, -58, -71, 25, 56, -89, -123, 111, 10, -40, 100, 68, -55, -44, -56, -104, -117, 106, -92, 65, -66, 8, 24, -35, 120, 97, 22, -27, 36, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 0, 32, 3, -44, 51, 19, -106, -8, -60, 76, 59, -80, -111, -115, -34, -20, 106, -73, -84, 112, 88, 78, 51, -88, 4, 30, 13, 77, -48, -98, 9, -73, 39, -10, 71, 22, -83, 92, 8, 82, 107, 112, 70, -27, 53, 106, 42, -98, 22, -123, 92, -51, 106, -52, -121, -7, 98, 86, -42, 31, -20, 93, -71, -76, 120, 56, -6, 13, -51, -18, 37, 72, -42, 59, -86, 103, 16, -84, -68, -45, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, 81, -79, 26, 114, 111, 34, 86, 84, -45, -63, 78, -69, -117, 127, 53, 123, -100, 29, -119, 120, 98, -27, 90, 45, 127, 52, -73, -85, -35, -120, 114, 16, 1, 83, 104, 109, 49, 65, -83, -118, -81, 57, 99, 49, 0, 44, -122, 22, -49, -19, 44, -51, 17, -14, -5, 27, 97, -3, 108, -30, -119, 53, -33, -30, 80, 23, 57, 54, -93, -115, -123, -83, -72, -107, -84, 50, -109, 57, 22, 51, -6, 23, -109, 70, -24, 120, -122, 6, -57, 96, 30, 17, 43, 119, 47, -59, 111, -25, 78, 67, 13, -73, -39, 126, -36, 124, 56, -111, 111, -3, 6, -23, -34, -54, 45, 56, -88, 79, 71, 63, 3, -90, -41, 114, -81, -118, 36, -112, 23, -3, 68, 42, -99, 54, -48, 117, 46, -25, -54, -22, -86, -91, 41, -115, -29, 37, -41, 70, -68, -48, 4, 38, -13, -41, 47, -113, 101, 20, 51, -19, -90, -70, 111, -40, -58, 89, -116, -101, 118, -93, -47, -86, -44, -93, 64, 115, -53, -59, 68, -123, -23, 8, 107, -69, -15, -125, -88, 57, -53, -55, -34, -123, -127, 53, -14, 88, -107, -3, 94, -6, -96, -15, -78, -15, 107, 23, 31, -13, -63, 35, -43, -48, 21, 18, 11, -127, 1, 99, 36, -8, -9, 29, 42, -92, -42, 103, 46, -39, 61, 87, -40, 93, 116, 12, -7, -116, -10, 23, 29, 37, -61, -34, -24, -22, -73, 43, 123, 9, 39, -37, 18, 17, -56, -9, -71 };
+static const int8_t mlp_vec_dot_x[436] = { 127, -60, 84, 24, -55, -38, -17, -85, 0, 8, 45, -127, -52, 127, 127, 127, 127, 127, 127, 127, 54, -15, 124, 62, 65, -93, -71, 74, 49, -126, 65, 17, -9, 32, -34, 45, -35, 98, -60, -4, 92, 98, -108, 28, -123, -108, -94, -4, -97, 58, 102, -54, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 10, -51, -60, -17, 15, -3, -107, -74, 125, 16, -68, -92, -79, -123, -84, 73, 91, -101, -63, 125, 63, 87, 99, -115, 7, 105, 35, 60, -21, -17, -11, 114, -34, 103, 107, -110, -122, -48, -78, 55, -51, -22, 105, 93, 55, 48, 38, 74, -64, 29, 17, 6, -92, -50, -95, -10, 88, 96, 34, -82, 41, -11, 92, 15, -82, -22, -85, -31, -93, -32, -15, 56, 103, 19, -118, 74, -114, -42, 44, -126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 17, 106, -116, -21, 33, -87, -91, -58, 29, -20, -34, -78, -66, -17, 107, 53, 113, 96, 8, -35, 112, -69, 51, 49, -49, -80, -1, 63, 78, 84, -22, -50, -103, -60, 8, -78, 107, 33, -94, -52, -36, -59, 103, -32, -2, 124, 114, -66, 21, 33, -28, 22, 71, 85, 1, 85, -94, -106, -61, -116, -80, 12, -91, 73, 110, 44, 126, 72, -74, -120, 22, -1, -108, 104, -41, -82, 51, 100, -1, -46, -94, -119, -11, 80, 75, -109, 92, 60, -46, 91, -24, 1, -55, 14, 25, -115, 50, 99, 68, -3, -31, 91, -46, 76, 2, -90, -90, 55, 113, 74, -36, 84, -84, 51, -43, 67, -16, 9, 123, -65, -43, -70, 0, 49, 75, 33, 127, -5, 118, -123, 127, 47, -60, 113, 88, 47, -99, 45, -91, -96, -79, -87, -5, 22, 60, -63, -99, -120, -84, -37, 6, -51, -62, 86, -38, 53, 114, -38, 119, -5, -106, -25, -20, -7, 38, -102, -1, -59, 30, 23, -95, -64, 87, 99, -117, -50, 36, 34, -89, -24, -15, 81, 69, 24, -127, -45, 74, -121, 18, -125, -113, 47, -61, -96, 9, -50, 93, 42, 27, -24, -109, -43, -104, 56, 29, -35, -4, 122, 80, -82, -30, 65, -126, -103, -24, -69, -91, -85, -80, -41, 44, 2, -43, 73, -40, 47, -76, -2, -100, -92, 79, 23, -11, -38, -10, 62, 56, -102, 111, -97, -21, -51, 58, 47, 110, -40, -25, 122, 121, 60, -39, -41, 28, 3, -77 };
+static const int32_t mlp_vec_dot_bias[16] = { -38385, -20537, -72646, -39785, -35482, 20270, -33700, 36157, 86321, -77734, -31817, 44671, -86802, -79682, 44194, 76530 };
+static const int32_t mlp_vec_dot_expected[16] = { -22256, -30389, -64340, -29885, -148385, 12401, -14865, 15648, 344385, -35136, 36535, 65540, -619059, -102610, 86950, 61227 };
+#define MLP_VEC_DENSE_CASES 3
+static const int8_t mlp_vec_dense_0_w[240] = { -20, 102, -110, -75, 82, -123, -38, 94, -52, -26, 127, 96, -69, -124, 31, 78, 70, 121, 104, -65, -127, 107, -19, -7, -48, 61, 118, -27, -83, 14, -31, -11, -72, 123, 97, 55, -52, 108, 66, -31, 104, 7, -79, 4, 39, -72, 95, 5, 92, -23, -97, -101, -81, -72, -86, -73, 116, -101, -36, 90, 64, 67, 22, 109, 85, 75, 114, -30, -90, -83, 50, 83, -82, -46, -72, 111, -110, 99, 73, -9, -50, -65, -80, -58, 23, -87, -76, 83, -62, 46, 54, -95, 53, -12, 72, 5, -98, -51, -27, -127, 102, -125, -80, -42, -105, -54, 95, -41, -8, 54, -40, 44, -75, -117, 9, -52, -8, -88, -71, -60, 112, -12, -56, -15, -111, -57, -120, -50, -111, 125, -125, -24, 5, 67, -98, 102, -50, 64, -103, 65, 86, -28, -20, 112, 91, 94, 80, 5, 22, 111, 28, 45, -7, 75, 28, 65, -42, -102, -18, 68, -122, 1, 46, -110, -53, -88, 24, 104, 67, 84, 87, -51, -75, -103, -125, 72, 93, -26, -56, 124, 51, 61, 106, -92, -31, -13, -102, 42, 85, 59, -76, -122, 55, -3, 36, -48, -87, -123, 28, -119, -62, -107, -125, 47, 108, -50, -119, 22, 12, -63, -117, -22, -7, -14, 34, -100, -96, 12, -96, 101, -94, -118, 94, -49, -61, -54, 76, 119, 122, -6, -62, 99, 64, -46, 6, -16, 60, 39, -32, -77 };
+static const int32_t mlp_vec_dense_0_b[48] = { -15024, -8987, 11601, 16263, 10844, -7838, 6646, -3228, 3777, -5817, 15379, 8000, 4024, -18287, 11760, 17344, -6313, 11347, -10342, 19571, 7410, 1420, -18931, 13045, 12942, -6213, -19534, -10513, -14518, -8486, -13892, 6540, -53, -15303, 14624, -9160, 4096, -7161, -6000, -123, 3591, -1682, 14331, 17299, -19247, 15586, 19414, 6833 };
+static const int8_t mlp_vec_dense_0_x[5] = { 14, 118, 120, 81, 86 };
+static const int8_t mlp_vec_dense_0_expected[48] = { 0, 0, 118, 127, 127, 0, 127, 92, 3, 127, 0, 127, 127, 0, 32, 127, 0, 127, 0, 0, 0, 127, 0, 0, 0, 0, 0, 0, 0, 127, 0, 0, 0, 127, 0, 76, 127, 0, 0, 0, 0, 0, 127, 90, 0, 127, 127, 119 };
+static const int8_t mlp_vec_dense_1_w[6400] = { 57, 2, 111, -61, 115, 112, -97, -54, 88, 113, -59, -82, -83, -27, 31, -47, -58, 53, 40, 110, 66, 91, -31, -80, 123, 0, -50, 76, -88, 12, -30, -90, -73, -39, 27, 85, 33, 39, -6, -76, 93, -45, -15, 2, 45, -53, 75, -79, -23, -125, -96, 104, 32, 50, -112, 46, 122, 7, 122, -43, 23, 9, 18, -96, 72, -85, -54, -36, -26, 126, 32, -69, -55, 39, 50, 111, 1, -96, -104, -31, -120, -127, -68, 31, 92, 100, 123, 49, 21, 65, -68, 105, 119, -125, 71, 35, -15, 50, -50, -18, 119, -99, 5, 122, 63, -80, 21, 18, -88, 87, -45, 96, -40, -113, -111, 18, 8, -66, -56, 115, -92, -15, 65, 22, -34, 31, -54, 58, -82, 57, -15, 10, 2, 21, -111, 16, 111, -21, 91, -6, -92, 67, -108, -58, -50, -61, 97, 105, -89, -96, -116, 87, -64, 65, -106, -84, -126, 15, -45, 56, 36, 11, 99, -5, 50, -121, -117, 47, -70, 27, -10, -17, 15, -120, -64, 94, 31, -21, 46, -39, -83, 73, 57, -7, 90, -96, -86, -21, -39, -49, -70, 100, -48, -117, 34, -53, 0, 107, -79, 92, -83, -78, -98, -96, -119, 127, 108, -15, 122, 73, -40, -91, 53, -65, 17, 6, 96, -85, 77, 109, -44, 68, -51, 103, -78, -66, 114, 77, 54, 35, -15, 70, -47, 36, -59, -101, 46, -110, -76, 41, -42, 69, 83, 98, -124, 64, -49, -124, -78, 7, -41, 94, 56, 119, 72, -62, -50, 54, -44, -25, 69, -70, 81, -91, -52, 84, 73, -64, -29, 125, -48, 61, -23, 27, 4, 126, 26, 93, 3, 34, -22, -20, 95, -64, -41, -102, 117, -86, -41, 108, 8, -103, 96, -66, -53, 80, -69, 112, -96, -1, 26, -41, -91, -41, -32, -33, 69, 70, 56, 29, -91, -112, 81, 46, -106, -125, 22, -98, -123, -17, 22, -67, -82, -78, -56, 21, -107, 85, 111, -49, -61, -80, -119, -56, -105, 39, -114, -114, 25, -113, -47, -121, 29, -77, -89, -65, -7, 5, -80, 111, -24, -71, -85, 68, 84, -52, -33, 37, 64, -111, -2, -61, -53, -119, 110, 41, 3, 44, -96, -58, -57, -55, 97, 40, -1, 20, 104, 25, 44, 102, 61, -42, 49, -9, -75, -4, 34, 94, 11, 63, 59, 121, 20, -38, 22, -36, 85, 111, -104, -124, -101, -22, -105, -25, -34, -101, 95, -42, 74, -36, -61, -24, -40, -65, -9, 76, -28, 111, -109, -96, 97, -48, 125, -19, -21, 37, -97, 16, -112, 12, 74, -92, 17, -78, 33, 13, 79, -116, 64, 30, 36, 83, -111, 46, 22, 121, -12, -38, 35, -75, 75, -36, -6, 54, -110, 72, -105, 103, -80, 125, -36, -124, 78, -54, 90, -113, -50, -86, 73, -23, 103, 85, 31, -24, -107, 105, -47, 97, -38, 68, 86, 6, 56, 98, 9, 94, -114, 112, 121, 111, -79, -88, 108, -79, -25, -98, 98, -115, -70, 41, -7, 12, -62, -42, 92, -86, 93, -30, 2, -115, 90, 7, 48, -28, -4, 11, -73, 110, 26, -2, 84, 87, 82, -79, 39, 55, 94, -4, -31, 125, -57, -6, -3, 81, 57, -50, -113, -126, -97, 82, 99, -30, -68, -12, 65, -44, -21, 29, -122, 21, -44, -87, 66, -69, -82, -48, -112, -74, -46, -118, -102, -94, 3, -6, -89, -127, 93, -63, 9, -2, 7, 93, -15, -35, 97, 82, 86, 98, 8, 5, -58, -67, -80, 102, -65, -97, -78, 94, -11, -30, -1, 6, 89, -66, -127, -88, 17, -47, -71, -51, 87, -60, -43, 5, -121, 38, 79, 117, 7, 8, -121, -80, -26, -75, 34, 47, -52, -103, 127, -79, 59, -5, 126, 16, -18, 108, 80, -48, 118, -62, 8, 98, 122, 30, 27, -100, 48, -81, 53, 79, 4, 28, 17, 119, 60, -23, 77, -47, 54, 72, 113, 102, -56, 113, 113, -50, -52, 123, -109, -118, -83, -1, -118, 3, -30, -59, -125, 95, 89, 70, -61, -78, 73, 67, 25, 126, 127, 89, -78, 47, 39, 53, -5, 75, 90, 72, 24, -108, -1, 3, 74, -90, -84, 86, 54, 48, 9, 32, -2, -100, -61, -42, 89, -60, -73, -105, 30, -86, 36, 26, 31, -119, -105, 120, -57, -58, 62, -40, -95, 44, 46, 96, -67, 43, -123, 123, -47, 3, -58, 48, -72, 23, -34, 0, 25, 85, 85, -79, -45, -62, -49, 123, -66, -4, -39, -58, -22, -95, -59, 21, 64, 32, 49, -19, 111, -95, -34, 75, 124, 50, 115, 53, -8, -100, 24, 11, -7, -8, -46, -23, -42, 39, -119, -117, 4, -70, -97, -72, -61, 119, 1, -78, 38, -25, -27, 86, 34, -40, -122, -108, -23, -125, -101, 126, -122, 55, 12, -66, -80, -89, -30, 47, -107, 4, 57, -59, -66, -121, 24, 80, 49, -34, 37, 8, -80, 103, -18, 108, 7, 125, 12, -1, -58, -15, 89, 30, -53, -66, -98, -76, 115, 43, 101, -14, 127, 53, 55, -38, -7, 75, -105, -111, 81, 99, 81, -51, 68, -77, -101, 93, 62, 117, 38, 90, 100, 87, 9, 66, 32, -86, -81, 31, 93, 125, -123, -28, 57, 49, -36, -27, 58, 50, 104, 91, 10, -101, -98, 115, -21, 53, 20, -59, 102, -35, 42, 80, -35, -112, -17, -103, -98, 122, -126, 59, -108, -22, -81, -31, 114, -45, 68, 33, -39, 118, 100, 114, -127, 122, 57, 80, -103, -29, -1, 75, 88, -93, -107, -72, -75, -60, -19, -114, -37, -95, -112, 108, 66, 33, 2, 87, -66, 2, 86, 106, 101, 15, -119, -35, -108, 4, -54, -37, 120, 24, 44, -62, -80, -104, 56, 92, 111, -18, -7, -21, -68, 83, 28, 11, 32, 57, -43, -124, 53, -23, -88, -37, -73, -31, 54, 104, -9, 78, 8, -101, -68, -81, 62, 89, 92, -79, -110, 30, 30, 22, -52, 99, -72, -80, 71, -58, -54, -7, -117, -50, -73, 127, -62, 36, 6, 5, 12, -65, -77, -79, -109, 10, 5, -100, 62, 49, 26, 3, -24, -86, -111, -68, -62, -83, -29, -10, -97, 70, -81, -89, 91, -52, 123, -60, 59, 34, 59, -64, -5, 89, 53, -14, 115, 15, 53, 50, 119, 82, -95, 116, 66, 37, -64, 49, 25, 26, -107, 117, -106, 86, -10, 122, -9, -113, -101, 78, -10, -35, -74, 1, -116, 50, -62, -26, 9, 42, -13, -28, -38, -53, -39, -31, 70, 75, -123, 65, 83, -13, -103, 122, -12, 122, -25, 1, -63, -66, -102, -54, -15, -90, -101, 45, -64, 119, -76, -64, 118, 126, 99, -118, 20, 117, -90, -111, 60, -106, -33, 108, -72, -58, 28, 103, 56, 6, -114, 4, 20, 109, -118, 11, -84, 103, 26, 101, 72, 61, 109, -125, -35, 40, 121, 60, -115, 17, -97, -37, 51, 9, -109, -29, 81, 88, 24, -124, 48, 86, 59, 50, -35, -13, 18, 50, -107, -2, 122, -86, -82, 6, -76, 20, 97, -93, -80, 123, -24, -77, 110, -28, -99, -49, -117, -59, 72, -86, -71, -2, 1, 26, -61, 82, 93, -35, -46, 27, -102, 27, 83, -24, 67, -20, 1, -73, -21, -77, -67, -111, 108, -2, -73, 1, -39, -45, 17, -19, 1, -65, 7, 122, -79, 63, -97, -108, -26, -120, -73, -85, 125, 93, -68, 92, -48, -52, -32, -89, -102, 36, -105, -110, 4, -102, -57, 7, -57, 55, -51, 61, -79, -34, 119, 127, -15, 87, -42, 55, 62, 75, 75, -60, -46, 101, 86, -96, -70, -66, 53, -13, 105, 59, -102, 14, -118, -111, -16, 74, 84, -50, -94, 95, 18, -117, -106, 114, 1, 9, -92, -94, 55, -37, 99, -22, 123, -23, -26, 83, 19, -108, -84, 37, -39, -32, -72, -63, -26, -112, 103, -29, 6, 41, -87, -18, -98, 11, -34, 37, -33, -18, 31, -53, -124, 46, 52, -82, 27, 70, -14, -46, 108, -65, 29, 69, -98, -127, 87, 111, 122, 39, -46, 67, 66, 41, -126, 116, -26, 125, 5, 100, 100, -107, 96, -39, -62, 108, -77, 108, 72, 90, 7, -81, -22, -13, -123, -63, -97, -13, -109, 1, 76, -11, -43, 40, -36, -80, 98, 3, -97, -65, -92, -32, -59, 73, -108, 2, -12, 95, -59, -121, 95, -56, 108, 28, 91, -54, -14, -35, -87, -85, 39, 9, 101, -53, -33, 52, -106, 96, 26, -58, 95, 46, 108, 32, -73, 93, -44, 57, 35, 123, -98, -67, -104, -40, -104, 42, -61, -45, 14, 7, 9, -47, 71, -4, -101, -66, -39, 38, -51, -16, -62, -119, 9, 39, -86, 70, -82, 97, 25, -106, 11, -31, -18, 19, -25, 26, 75, 126, -44, 24, -57, 17, -8, -119, 78, -75, 8, 115, -23, -46, -61, -63, -122, 122, -54, -91, -76, 16, 34, 110, 53, 47, -79, -76, 122, -71, -83, 109, 16, -14, 19, -63, -74, 72, -74, 80, 59, -61, 42, -126, -72, -73, 21, -49, 103, -50, 32, 94, -37, 44, -18, -60, 72, -114, -3, -45, -41, 99, -25, 70, -13, -107, 40, 68, -50, 15, 20, 104, 44, 110, -89, 94, -5, 17, -15, -120, -80, -29, -4, 119, 80, 33, 113, 112, -22, -43, 76, 58, 104, -71, 97, 35, -46, 69, 118, 10, 47, -22, -14, 15, -51, 1, 118, -69, 33, -25, -117, 39, 63, 38, 92, -9, -117, -30, -36, 78, -87, 10, 102, -102, -97, 56, -67, -12, 22, -33, -101, 62, -103, 44, 24, 81, -122, 47, 16, -31, -51, 106, -54, -107, -25, -80, 57, -126, 61, -84, 11, -50, 57, 118, -71, -62, -115, -117, -117, 51, 50, 116, 75, 124, -19, 104, 42, -22, -60, -20, -54, -75, 121, -103, -90, 79, -93, 116, -96, 75, -29, 111, -47, 72, -28, -43, 100, -2, -41, -72, -63, 49, 87, -6, -16, 83, -77, -99, -110, 0, 16, -32, -92, -12, 114, -36, 18, 60, -118, 3, -118, 67, 114, -99, -57, 51, 54, 41, -93, 64, 66, 113, -35, -19, -39, -94, -20, -2, 87, 48, 2, 30, -85, -15, -10, 58, 71, 99, 35, -89, -97, 56, 48, -82, 26, -104, 102, 104, -70, -93, -119, 62, 9, -13, -28, 76, 53, -70, 122, -84, -14, -3, -72, 11, 53, -106, 26, 105, 56, -71, 126, 46, 10, -31, -52, -69, 43, 39, 97, 41, -53, -32, 10, 75, 5, -105, 85, 106, -46, -39, 84, -98, -78, 105, -86, 125, -51, -40, -83, 35, 126, -87, 41, 23, 7, 29, 22, -6, 3, 83, 64, 5, -104, -119, 125, 78, -98, 27, -49, -83, -90, -25, 28, 83, 116, 73, -82, 13, -45, 46, -124, 84, -48, 55, 53, -110, -4, -63, -16, -32, -56, -40, 47, 91, 106, -34, 108, -25, 55, -28, 9, -53, 20, 3, -65, -13, -8, -82, -109, -41, -75, 45, 58, 114, -31, 52, 96, 101, -104, -107, -102, 4, 77, 68, -56, -84, 92, -65, -47, 76, -96, -111, -89, 5, -124, 91, 124, -49, -75, 121, -4, 20, -103, -124, -51, 51, 18, -57, -118, -18, -100, -114, -8, 39, 80, -48, 99, 14, -59, -84, -19, 31, 82, 6, 121, 13, 41, 86, 41, 0, -54, 31, -69, -13, 4, -68, -91, 120, 21, -25, 38, -96, -33, 13, 5, -36, -123, 60, -107, 122, 45, -123, 52, 118, -25, -9, -116, -84, -119, -5, -124, -97, -89, 72, 94, 56, 82, -91, 107, -45, -118, 83, 1, -96, 64, -30, -86, -113, -75, 122, -22, 70, 13, 64, -53, -99, 127, 33, 70, -2, 37, -19, -35, -30, -32, -14, -109, 4, 118, 81, -16, -106, 42, -35, 90, -60, -23, 86, 7, -66, -44, -70, 3, 1, -47, -36, -111, -27, 82, 84, -121, -14, -119, -96, -62, -52, -108, -94, 21, 88, 100, 80, -98, 59, -60, -81, 46, 49, 30, 47, -71, -1, 25, 74, 42, 57, -42, -68, 103, -117, -73, 112, -52, 50, -117, -14, 123, 32, 3, -123, -50, 118, 47, 53, 110, -39, -102, -68, 7, -68, 34, -2, -108, -98, -46, -87, -20, 2, -25, -115, -109, -111, -66, -67, 11, 117, -62, -3, -99, -109, 49, -60, 100, 24, -86, -83, -79, -102, -26, 25, 49, -16, -59, -62, 8, -108, 28, 55, 58, -118, 28, 84, 9, -114, -65, 81, -75, 54, 15, -75, 10, 15, 56, 92, 28, -109, 62, -15, 50, 38, 88, 87, -95, 99, 97, -120, -84, -98, 0, -80, -53, 115, 116, -103, 123, 57, -28, -88, 127, 41, -108, 12, -13, -63, 102, -33, 95, 76, 95, 90, -95, -44, -30, -75, -66, 63, -121, -1, 84, 50, 27, -97, -127, -48, -117, -106, -59, 2, 109, -81, 107, 11, 83, -76, 59, -33, 41, -88, -10, 88, 122, 110, -107, -95, 47, -30, 93, 100, -71, 7, -63, 115, -117, -10, 5, -115, -27, 104, 5, -30, -68, -45, 8, -115, 9, 112, 13, -19, -105, 0, -106, -18, 44, -60, 103, 32, -63, -50, -41, 94, -63, 42, -9, 11, 54, -32, 26, -22, 11, 82, 77, 14, 46, 78, -110, -123, -118, -65, 102, 38, -114, -95, 25, -42, 46, 105, 127, 4, -46, -34, -117, 74, -96, -25, -81, -70, 120, -38, -24, -120, 121, -7, 75, 18, 82, -111, -51, 98, -114, 23, -24, 65, 87, -18, -62, 45, 2, 113, -37, 124, -4, 42, 32, 109, 113, -124, 53, 13, 72, -113, 48, 96, 123, -88, -56, 66, 90, -114, 1, -35, 116, 70, -24, 89, 73, -41, 113, -20, 105, -42, -117, -17, -100, 77, 20, -62, -14, -72, 5, 37, -96, -102, 73, 4, 12, -13, -63, -86, 1, -42, -95, 75, 48, 79, -35, 51, -83, -19, 8, 106, 95, 30, -49, -75, -4, 22, -120, -23, -50, -124, 61, -93, 43, -9, -13, -95, 45, -46, 26, -125, -76, -21, 52, -111, -104, -86, -66, -15, -89, 28, 88, -61, 22, -66, 24, 117, 69, -14, 118, -35, 57, -91, 51, -121, -43, -118, 121, -69, 6, -91, 17, 64, 122, -80, -104, -33, 12, -122, -20, -102, -54, 4, 111, -5, 72, -85, 15, -66, -120, -122, -90, -127, 121, 33, -5, -117, -114, -20, -12, -85, -16, -35, -79, -11, 43, -125, -31, -115, -121, 54, -94, -57, 127, 112, -80, 117, -24, -12, 15, 80, -91, -73, 25, -50, 71, -87, -110, 46, -108, -38, 56, 123, 99, 75, 94, 31, -55, -41, 83, 26, 50, 112, 84, -79, 118, 65, -91, 47, 107, -32, -3, -122, -80, 1, 88, -70, 58, 60, -87, 10, -124, -69, -16, -89, 101, -120, 123, 5, -74, 126, 42, -60, 111, -77, 23, -9, -2, -93, -121, 2, 79, 68, -11, 23, -52, 25, 22, 94, -13, -104, 74, 111, -6, 66, 8, -95, 52, 40, 3, -113, -21, 118, 9, -71, 10, 84, 65, -44, 19, 16, -53, 11, 69, 90, -25, 71, -119, -120, 15, 90, -31, -91, -123, -51, -66, 20, -42, -83, 113, 125, -28, 86, -76, 21, 106, 70, 110, 98, -83, -66, 6, 6, 48, -33, 1, 11, 87, 5, -97, 119, 98, -81, -69, 8, 90, -78, 125, -95, -42, -8, -110, -95, -1, -61, -73, -116, 56, -29, 80, -78, 119, -32, 86, -110, -8, 126, -111, -16, -90, -107, 64, -53, -79, 75, 71, -126, 111, -78, 84, 89, -41, 88, 110, -75, -122, -89, 16, -4, 96, -44, -124, 13, -16, 77, 5, -20, 49, -84, 85, -110, -5, -56, 90, -46, -84, 113, 18, 83, 106, -85, 27, -85, 23, -115, -76, -59, 82, 50, -126, -64, 8, -74, -66, 27, 35, -63, -76, -85, 83, -78, -37, 91, 105, 63, -10, 65, -72, 65, 87, 26, 51, -116, 52, 122, -63, -21, 61, -48, 33, -25, -106, 86, 27, -9, 121, 87, -111, 24, -11, 32, 11, 120, -59, -49, -28, -45, -74, 6, -23, -67, -92, -56, -95, 62, -9, 58, 55, -48, 80, 64, 62, -85, -74, -38, -121, -17, 44, -104, 108, -106, 105, -92, -25, 74, -18, -82, 87, -113, -55, -24, -111, -67, 64, -9, -55, 93, -74, -81, -88, 77, -111, 126, 46, -118, 11, 126, -48, -5, -102, 38, -29, -114, 6, -84, -81, 123, -98, -116, 124, -108, 89, 51, 108, 39, 21, 35, -34, 92, -78, -36, -64, -104, 82, -39, 122, 43, -113, -55, 105, -89, -114, 67, 8, 83, -12, 4, 45, -62, -75, 114, 40, 120, 39, 121, -55, -122, 116, -60, 50, 111, -77, -19, 116, 40, -59, -123, -12, -67, 24, -8, 51, -111, -127, -63, 22, 126, -103, -13, 92, 21, -101, -45, 71, -92, 120, -60, -120, 86, 9, -106, -109, 70, 46, -44, 118, -39, 114, -87, 77, 17, 80, -51, 125, 99, 8, -11, 74, -97, -113, -84, -122, 7, 92, 126, 114, 23, -118, -50, 48, 41, 80, 90, 6, 37, -9, -72, -102, -104, -49, -2, 70, 11, -50, -40, 98, 108, -30, -71, 72, 58, -41, -123, 69, 85, 114, -30, 39, 51, -4, -63, -16, 86, 89, 30, -126, 99, 123, -16, 102, -56, 91, 82, -31, 27, -90, 88, 11, 58, -15, 64, 36, -90, 116, -40, -99, 1, -61, -42, -32, 18, -27, -68, -39, -62, -117, 50, -117, -40, -56, -115, 52, 75, -91, -14, -92, -81, -119, 38, -45, -56, 17, 42, -84, 34, -92, -88, -90, 99, 83, 77, -29, -105, 73, 126, -62, 95, 111, -33, -58, 94, 110, 48, 6, 30, 14, -12, 92, -91, 68, -28, 21, -117, 67, 89, 15, -51, -21, 58, -123, 74, 90, 63, 3, 53, 34, 42, 78, 39, 110, 14, -113, -102, -91, -54, 42, 10, 74, -58, -5, 122, 24, -67, -105, -61, 84, 70, 40, 74, 72, 103, 40, -19, -74, 22, -28, -66, -37, -50, 68, 74, 68, 43, -91, 46, 36, 101, 123, -98, 87, -115, -85, -94, 16, 23, -104, 53, 62, -33, -2, -67, -106, -71, -41, 85, -27, 100, -85, -84, 34, -45, -20, -27, -1, 124, 22, 14, -113, 44, -20, -28, -125, 1, 112, -117, 114, 109, -1, -41, 97, 48, -60, -47, 95, 63, -34, -66, 64, 16, 25, -70, -105, -103, 43, 68, -83, 73, 45, -82, -113, 49, 110, -10, 33, -19, 107, 45, 78, -111, -68, -110, 80, -8, 8, 60, 85, -27, -24, -73, 59, -90, 91, -44, 52, 76, -34, 105, -108, 91, -42, -81, 110, -103, -96, 11, 86, 85, 102, -48, -45, 82, 80, -34, 120, -119, -39, -36, 56, 3, -71, 70, -119, 57, -112, -114, 103, 23, 40, -67, -9, 111, -79, 6, -56, -97, 56, -103, -109, 77, 104, 15, -13, -108, 2, -120, -93, 72, 19, -62, 35, 39, 107, 49, -47, -44, -57, -17, 22, -100, -13, 45, 41, -52, -120, 120, -97, -121, 2, 97, 83, -78, 25, -84, -117, 61, -22, 63, 100, -56, 75, 84, -112, 80, 74, 37, -14, 58, -69, 121, -56, 98, 105, -10, 27, 112, -75, -11, -21, 20, -27, 125, -68, 112, 102, 109, 22, -61, 91, -81, -57, -89, -26, 76, 97, -116, -101, -91, -104, 12, 47, -24, -110, 81, -79, -75, -41, 93, -96, -57, -106, 4, -11, 3, -8, -59, 89, -42, 48, 21, 77, 20, 121, 62, -92, -53, -64, 17, 106, -69, -125, 68, -80, -127, -68, -86, -64, 83, -25, -23, 83, -124, -94, -67, -9, -36, 8, -38, -84, -83, 120, -64, -42, -123, -51, 99, -102, -20, 106, -28, -117, -39, 118, 64, 14, 77, 70, 94, 89, -46, 60, -20, 82, 31, -41, 103, -66, 27, -115, 0, -62, -56, -26, -104, -24, 94, -5, -34, -56, 72, -110, -27, 120, 116, -116, 127, -120, 102, -115, -36, 43, -21, -18, -111, -16, 14, 6, -8, -8, 27, 120, 21, -31, -74, 100, -71, 103, -94, -46, 110, -20, 51, 102, -25, -23, 108, 15, -27, 1, 108, 122, -96, -86, -42, 41, 75, 62, 88, 46, -79, 90, -103, 115, 25, 23, 22, -68, 14, 6, 85, -13, 108, 10, -44, -53, 78, -60, -53, 72, -95, 74, -75, 113, -124, 76, -13, -114, -95, 112, 12, 99, -17, -46, 30, -75, -100, -52, -28, -21, -39, -69, -78, -29, -108, 91, 59, -90, -49, 108, 58, 88, -89, -26, 20, -2, -83, -120, -120, -74, 71, -80, 113, 107, -36, 26, 3, -96, 105, 84, -97, 18, -115, -116, 101, -71, 13, -45, -76, -35, -113, -62, 47, -20, 81, 119, -37, -112, 107, -103, -84, -79, 113, -109, -74, 82, -124, -95, 67, 54, 99, 115, 46, 7, 47, 52, 32, 65, 17, 118, 49, -70, 121, -114, -28, 103, 30, -106, 21, 56, -103, -100, 73, -108, -57, -48, 43, -101, 42, 80, 110, 34, -105, 106, 51, -43, 53, 0, 68, 22, 107, 114, 113, 57, 12, 6, -53, 1, 30, -16, 84, 1, 40, -53, 59, -106, 58, 74, -61, -58, -79, 76, -111, -113, -48, -53, -21, -72, 44, -18, -98, -48, -10, -107, -104, 53, -90, -78, 7, -7, 114, -51, -111, -90, 40, 115, 104, -126, -43, -15, 80, 51, -103, 95, -127, 20, 106, -31, 14, 97, 4, 125, 100, -3, -117, 59, 0, -66, -110, 87, -36, -115, 41, 66, -16, 60, -83, -39, -122, -92, 46, -72, 46, 10, -22, -124, -94, -28, 76, -104, 126, 107, -59, 115, -72, -84, 115, -1, 0, 68, 113, 19, -7, -69, 68, -107, -22, -104, -26, 127, 82, 8, 111, 126, -111, -5, -71, -99, -33, -120, -21, 104, 18, 77, 124, 80, -59, -85, -26, 112, -65, -117, 66, -87, 61, -60, 77, 87, 80, -78, 105, -7, -107, -49, -107, -66, -87, -78, 118, -27, 7, 82, -37, 63, 11, 68, -66, -2, -9, -68, 12, -47, 84, -82, 120, 97, -92, -1, -46, -58, 44, 39, -66, 68, -100, 79, -71, 5, -76, -1, -93, -84, 75, 85, -114, 51, 12, -11, 86, 2, 78, -68, -44, -85, -113, 97, -70, 110, 58, 27, -102, -105, -6, -118, 33, 56, 13, 97, -53, 64, -60, -98, 14, -86, -38, 58, 88, -92, -73, 40, -23, -11, -61, -36, 116, -33, 53, 28, 81, 101, 32, -90, 51, -90, 40, -18, 53, -83, 116, -50, 108, 12, 8, 17, 117, -57, 124, -98, 13, 9, -6, 7, 51, 8, -91, 78, 6, 95, 60, -126, -11, -61, 95, -95, -64, 120, -89, -1, 70, -66, -2, 87, -42, -113, -34, 75, -100, -104, 115, 113, -11, 118, 5, 63, -70, 64, -81, 49, -125, -93, 9, 31, 62, 106, 125, -9, -17, -39, 17, -109, -66, 40, 111, -16, 3, -13, 76, 4, -119, -81, -101, 52, -63, -12, -9, -8, 24, 42, 77, 57, -117, -25, -30, 104, 75, -2, 16, -37, -62, 80, 81, 62, -33, -67, -11, -4, -16, 14, -19, -70, -9, -69, 118, -11, -29, -29, -30, -24, 107, 95, 115, -100, 35, 73, -14, -58, -10, 17, 126, 3, -53, -27, 116, -111, -31, 19, 2, 36, 80, -45, 78, -47, -7, 96, -101, -87, 105, -74, -77, 16, 75, -81, -118, -34, 42, 82, 75, 89, 110, 1, -100, 53, -25, 74, -17, 83, -92, -19, 49, -81, 122, 51, 57, -60, 25, 123, -44, -123, 71, 73, 36, -110, 54, 89, -91, -36, 14, -42, 40, 85, -28, 106, 125, 126, -85, 67, -10, 53, 8, 94, 90, -85, -101, 126, 33, -66, -7, 0, 56, 110, -68, 52, -24, 45, -50, -36, 87, 45, -111, 4, 32, -91, -93, 97, 32, 61, 111, 99, -57, 34, -2, 58, -123, -110, 63, 38, -3, -81, 120, 86, 110, 82, 15, 111, 4, -115, 106, -1, -12, 63, -31, 7, 4, 28, -113, -6, 96, -122, 34, -112, -20, 49, -102, -109, 4, -54, 83, -8, -40, -24, -63, -32, 10, -67, -120, 5, 78, 124, 93, -69, -34, -87, -25, 103, 77, 73, -8, -105, -57, 92, 13, 60, 4, -105, 81, 15, 127, -73, -34, -110, -95, -97, -127, -64, 127, 115, -20, -68, -104, -47, 51, -28, 59, 0, -58, -56, -102, -66, -34, -116, -25, 21, 15, -21, 48, -100, 81, 47, 89, 24, -3, -53, -104, -125, 118, 25, -43, 10, 99, 74, -13, 105, 77, -103, 65, 106, 3, 75, -12, -58, -46, -113, 3, -34, -80, 69, 110, 25, -48, -112, -69, -73, -84, 32, -123, -68, -77, -93, 25, 48, 88, -26, -22, 65, 78, -92, 31, 36, 72, -90, 7, 54, 113, 35, -52, 31, 99, 101, -116, -8, -35, 102, -85, -54, -81, 46, -120, -2, -4, -60, -75, -33, 29, 65, -33, -79, -101, 110, -28, -29, 89, 109, -38, 83, 100, 96, -24, 122, -69, 55, 75, 22, -75, 5, -32, -108, 43, 70, -26, -92, -75, 31, -43, 45, -92, -112, -95, 71, -30, -70, 79, -34, -15, -94, 59, 68, 107, 90, 45, -30, 75, 5, -1, -28, 75, 102, -16, -120, 43, 20, -126, 112, 47, -60, 114, 69, -31, 54, 57, -106, -6, -4, -40, 7, -63, -43, -66, -28, -37, 82, -123, 121, -34, -89, -21, -75, -60, 0, -3, -121, 67, -28, 8, 124, -114, 57, -88, 104, 28, 22, 99, -93, -13, -68, -104, -102, -61, -114, -115, 6, -61, -100, -36, -44, -76, -115, -69, 90, 96, -63, 64, 41, 127, 105, -107, -43, 54, 28, -46, -94, 111, 59, 9, -34, 47, -47, 80, 53, -18, -34, -18, 19, 9, -85, 3, 50, -63, 89, 69, 26, 73, -38, -113, 90, 44, 39, -35, -21, -99, -45, -5, 47, 113, -94, 50, -54, 9, 73, 31, 87, -72, -36, 77, -59, 123, 118, -6, -32, 31, -1, -30, -61, -26, 67, 29, -89, -33, 32, -85, 39, -5, 79, 88, 107, -50, 79, 75, -70, 9, 61, -60, 43, -55, -9, -83, 46, 61, -97, 26, -75, -13, -80, -42, -52, 91, -117, -25, -109, -75, -125, -76, -46, -60, 106, -10, 0, 4, -76, -98, 96, 69, -59, -54, 0, 23, -46, 108, 106, 51, -49, -112, -88, -101, 13, 13, 98, 5, 64, 126, -113, -113, 50, 60, -119, -49, -41, -84, -119, 97, -18, 61, -53, 50, 29, -84, -80, 30, -40, -113, 43, -113, -29, -97, -126, -104, 115, 123, 112, -82, -79, 78, 81, -48, 13, 13, -124, -69, -17, -115, -84, -45, -65, 89, 7, 9, -60, -119, -127, -23, -28, 86, -111, -94, 30, -27, -119, 55, 30, 26, -12, 110, -64, -65, 45, -30, -11, 84, 70, -82, -113, -127, 1, -51, 126, -2, -92, -97, -69, -7, 126, -80, -100, -4, -2, -37, 0, -22, 102, -35, -66, 114, -127, 124, -52, -122, -12, 37, 97, 40, 104, 116, -18, -43, -30, -17, 7, -107, -127, 124, -63, 26, 122, 25, 3, 97, 29, -61, -48, -58, -77, -72, 56, 61, -93, 100, -75, 66, 49, -124, -30, -93, 100, -28, -51, -41, -106, 26, -70, -64, -20, 7, -96, -118, 2, 96, -116, -60, -124, -75, -59, -120, 88, 78, 98, -27, -81, 69, 124, 30, -61, -75, 63, -99, 123, 108, 127, 84, 92, 41, 23, 17, -115, -107, -49, 46, 19, -86, -113, -77, 46, 34, -50, 52, -51, -91, 76, 42, -112, 126, -69, 37, 115, -72, -60, -90, 113, -94, -26, 30, -60, -101, -43, 86, -53, -28, 71, -80, -105, -55, 64, -47, 54, 53, -25, 104, -41, 93, 68, 30, -43, 89, 96, 36, -107, -104, -26, 90, 56, 38, 62, -39, -102, -21, -37, 76, 79, -127, -40, -26, 88, 7, 116, -123, 7, 41, 102, -10, -112, 38, -74, -59, 99, -110, -68, -82, -111, 6, 87, 96, -92, 113, -103, 54, 93, 40, 90, 92, -102, -116, 65, 14, -66, 64, 98, 9, -4, 65, 31, -63, -108, -68, -81, -2, -104, 98, 113, -75, 40, 110, -107, 15, -37, -125, 88, 113, -101, 122, 17, 56, 89, -97, -104, -80, -40, 121, 78, -46, -112, 32, 55, 52, 79, 95, 120, -77, -67, -90, -50, 64, 73, -9, 90, 94, -54, 3, 9, 8, 40, -20, 11, 85, -11, 63, -69, 89, 53, -44, -75, 116, 52, -4, -104, -88, -46, 18, 31, -47, -101, 60, 110, -18, 33, 45, 103, -112, 1, 105, 74, 19, 111, 31, 56, -9, 78, -33, 72, 18, -124, 58, -62, 99, 79, 3, -122, -89, 60, 2, -92, -99, -126, -112, -84, -111, -77, 63, -6, 19, 22, -40, -5, 74, -29, -53, -91, 71, -118, 36, -115, 99, -121, 38, 9, -53, 95, 34, -61, 86, 114, -103, -11, -126, 93, -29, -85, 93, -14, 120, 117, -43, -51, -31, 85, -44, -42, 60, 122, 37, 46, -108, -114, -1, -17, -43, 120, -72, -45, 119, 71, -109, -121, 114, 74, -109, -126, -83, 38, 44, -11, 22, -119, -112, 19, -104, -75, -89, -58, -40, 78, 43, -53, 111, -73, -103, -112, -25, -105, -56, -76, 18, 59, 95, 35, -76, -66, 106, 56, -105, 4, 23, -85, 77, 62, -69, 48, 81, -32, 13, 23, 111, 101, 29, 68, 127, 91, -77, -79, 103, 72, -114, -64, -10, -107, -91, -25, 57, -44, -57, 101, 63, 83, -99, 69, 32, -48, -127, -51, -107, 105, -4, 23, 85, 88, -26, 95, 115, 105, 115, -121, 13, -1, -7, 65, 21, -114, 122, -97, 85, -65, -57, -119, -4, -22, -115, 47, 4, -91, 42, -102, -37, -75, 117, -38, -99, 100, 22, -70, -97, 62, -40, 43, 70, 21, 75, -123, -90, 68, -59, -41, 37, 30, -30, 122, -110, 71, -22, 81, 22, 113, -44, 88, -118, 78, -43, 12, -118, -31, 64, -31, 63, 36, 91, -48, -110, 111, -84, 27, -119, 33, -99, 114, -34, -51, 11, -53, 46, -51, -50, -22, -95, -3, 60, -46, 107, -103, 23, -123, -67, -61, -47, -51, 72, 61, -67, -5, -57, 49, -8, -93, 9, 98, 23, 121, -119, -66, 99, -39, -119, 4, -114, -40, -67, -1, -90, 108, -21, -61, 105, 112, 31, 11, 20, 62, 115, -21, -9, -63, 57, -49, 110, -29, 49, 25, -83, 56, -6, -71, 2, -106, -7, 46, -98, 69, -124, -48, 105, 47, 2, -90, 8, -56, 65, -110, -90, -52, 103, -84, -105, -47, 14, -66, 102, 31, 69, 37, -60, -70, -125, -15, 77, -63, 41, -6, -28, 122, -29, -23, 119, -55, 49, 117, -115, 69, -4, -51, 56, -118, -26, -56, -48, 41, 87, -105, 42, 116, -83, -12, -31, -85, 14, -89, 21, 35, -63, -76, -106, 126, 112, -32, 100, -14, 74, 106, -48, 32, -95, 116, 72, -32, 107, 69, -41, -40, 73, -113, -18, 96, -124, 64, 86, -26, -34, -127, -111, 111, 18, -52, -11, -49, -37, 20, 92, -104, 104, -110, -43, 108, -40, -10, 87, 75, -79, 5, 29, -97, -120, -126, -106, -20, -94, -12, -11, 45, -59, -111, -40, -27, -118, 82, -90, 127, 30, 109, -110, 55, -64, 98, -4, 29, 77, -83, -79, 36, -51, 49, -39, -27, 10, 124, 75, 73, -77, -127, -41, 127, 104, 89, -30, 16, 112, -82, 31, 102, 12, -57, 40, -106, 41, 82, 16, 45, 1, 8, -51, 98, 46, 113, -19, 113, -79, -16, 28, -5, -97, 52, 77, 78, -66, -33, -46, -7, -14, -55, 63, 14, -106, -90, -99, -23, 5, -59, 115, 30, 65, 97, 95, -11, 117, 3, -93, 78, 86, 56, 124, -16, -121, -31, -57, -68, -117, 23, 112, -15, -27, -37, 40, 48, 1, -52, 95, -47, 120, 103, -4, -93, 99, 120, -75, 59, 46, -91, -27, 73, 120, 56, -5, 95, -72, -105, 105, 24, -100, -50, 48, 120, -30, 51, -65, -33, -73, -122, -83, 23, 22, 65, -91, 100, 39, 54, 27, 48, -93, -77, 104, -105, -6, 13, 108, -98, -83, 124, 115, -67, 51, -76, -36, -12, 51, -123, 85, 21, 11, 6, -84, 35, -120, 115, -79, 81, 90, 15, 56, -126, -24, -127, -21, -81, -76, 32, 106, -100, 95, 29, -25, 5, -81, 83, 81, -34, -22, -109, -122, 36, -103, -10, 22, -90, -121, 113, 93, 13, 84, -111, -68, -53, 80, 94, -83, -32, -60, -94, 92, -62, -116, -122, -14, -121, 126, -60, -8, -8, 9, 113, 1, 6, 22, -42, -55, -59, -35, 110, -38, -94, 126, -57, -1, 16, -120, -98, 33, 35, 119, -42, -50, -31, -13, -104, 62, 103, -6, 52, -57, -87, -18, 30, -84, -82, -27, -22, -22, 38, 105, 10, -70, -8, -123, -1, -95, 95, -117, 46, 42, -100, -36, 125, -119, 74, 10, 97, -117, -105, 82, 45, -118, -8, 43, -18, -6, 71, 8, 29, 102, 10, -82, 69, 42, 106, -45, -34, -22, -53, -108, 99, 45, 39, 76, -51, -12, -68, 111, 61, -84, -84, 30, 127, 43, -38, -67, -101, -89, -9, 51, -6, 14, 8, 6, -64, -45, 16, -74, 71, -80, 42, 54, -116, 104, 31, -71, 62, -32, -101, -49, -24, -83, 49, 28, 118, -26, -42, -93, -11, -61, 12, 4, 105, -103, -44, -16, 32, -54, 39, -89, -89, -79, -91, -77, -47, -7, -10, 59, -2, 45, -113, 118, 61, 46, -82, -3, 52, 99, 43, -11, -33, 38, -79, 48, 124, -110, 103, -46, -120, -83, -58, -55, 110, -119, -40, 36, 120, 119, -116, -12, 5, 50, -77, -43, 24, 38, 121, 117, -10, -34, 26, 36, 49, -100, 91, 20, -42, 116, -30, -52, 14, -85, -94, 30, -29, 97, 79, -117, -81, -66, 95, -7, -40, 93, -70, -72, 48, 5, 119, -80, 32, 13, 59, 105, 102, 103, 100, -99, -102, -103, 53, -20, 111, 39, 82, 42, 124, 79, -120, -55, -123, 44, -22, 86, -17, 51, -20, 92, -120, -103, -96, -24, -21, -105, 64, 12, -64, -12, -91, -83, -86, -69, -56, 9, -121, -69, -56, -123, 103, 108, -45, -102, -127, -74, -52, 109, -45, -71, 59, -118, -96, 78, -98, -43, -109, 22, -94, 1, -59, -23, 0, -105, -112, 102, 111, 96, 102, -46, -122, -51, 127, -21, -43, 33, -26, -87, -94, 40, 75, -10, 15, -63, 38, -3, 48, 71, -16, 125, 38, 109, 124, -69, 34, -57, 122, -80, -67, 58, -98, 56, 45, -10, -10, -12, 45, -77, 32, 71, -79, -85, 68, -117, 35, -56, -96, 64, 96, -67, -59, -68, 38, -39, 119, -105, -102, 55, 23, 123, 22, -31, 52, -72, -57, -13, -78, -112, -1, 94, 73, 64, -36, -108, 60, -70, 33, 113, -53, -85, -9, -113, -113, -95, 12, -124, -114, 110, 6, -61, -99, -91, 106, 66, 1, 72, 7, 81, -112, -32, -45, -91, -14, 33, 64, -18, 25, -61, -84, -27, -28, 57, -23, 92, -87, 66, 55, 83, 75, -16, 3, -55, -79, -86, -125, 39, 117, -76, 4, 123, 72, -60, 59, -9, -96, 35, -122, 101, 123, 108, -72, -92, 44, 127, -87, 93, -73, -13, 112, 78, 31, -112, 77, -30, 93, 19, -32, -98, 121, -78, -122, -13, -111, 46, 77, 47, -11, 55, 40, 51, -122, -28, -93, 64, -1, -7, 39, -79, -58, 84, -53, 31, 75, 61, -1, 43, -32, -117, -15, 36, 25, 116, -102, -45, -74, -14, -55, 54, -70, -111, -97, -105, -105, 28, 19, -105, 66, 7, 81, -78, -18, 44, -101, -126, -86, -29, 80, 97, -10, -40, -60, -6, -87, -116, 82, 65, -100, -8, 29, -121, 36, -3, 103, 96, -17, -77, -110, -28, -61, 75, 100, -115, 125, -60, -4, 29, 11, -97, 13, 8, 53, -67, 110, -18, -48, -41, -48, -47, 5, -39, -82, -111, -85, 124, 92, -72, -97, 41, -115, 72, -112, 13, -17, 113, -46, -97, -3, -37, -93, -113, 89, 4, -46, -111, -103, -114, 95, -125, -63, 121, 3, 107, 1, 44, 11, 47, -75, 21, -82, 66, -85, -34, 48, 48, 87, 85, -70, 77, 52, -125, 60, -75, -55, -91, -66, -25, 27, 97, -127, 0, 5, 93, -75, -81, -120, -68, 28, -110, -116, 43, 94, -98, -46, -96, 122, 54, -115, 75, 56, 66, -5, -66, 104, 3, 16, 55, 111, -11, 116, -25, -100, 70, 77, 113, 54, 35, -97, 52, -11, -99, -44, 2, 122, -17, 25, 31, -39, -14, -101, -17, 108, -74, 113, -46, 83, 127, -63, 7, -123, 114, 89, -72, 68, -66, -72, -67, -96, 54, 119, 106, 16, 71, -69, 71, -123, 71, 54, -79, 6, -97, -99, 119, 111, 20, -24, -123, 84, 69, -78, -42, -34, 126, 6, 30, -30, -89, 67, 27, -67, 54, 116, -3, -59, 100, 39, -113, -59, -118, -96, 107, -51, 123, -9, -106, 82, -93, -71, -110, -95, 21, 115, 100, -44, 51, 92, -40, -42, -84, -47, 112, 81, 44, -95, -52, -88, 86, -42, -111, -68, 37, 103, 80, 101, 15, -87, 113, 86, 123, -16, -75, -83, 29, 80, 65, 46, 111, 35, 104, -54, 124, 100, -60, -71, 76, 51, -68, -1, -123, -93, -12, -31, -124, -77, 100, 97, 58, 83, -93, 64, 40, 1, -121, -24, 49, -4, 115, -95, -45, -116, 78, 70, 78, 95, -13, -31, 78, -47, -46, 89, -106, 0, -124, 65, -93, 58, -86, -8, -11, 125, -92, -121, -96, -125, -39, -110, -37, 63, -122, 71, 66, -34, -54, 110, -80, 45, -34, 20, -27, 84, 111, 113, -112, 114, 109, -3, -92, -72, 102, -56, -111, 118, -106, -65, 93, 98, 27, -88, -50, -24, -56, 95, 103, -16, -112, 34, 100, -90, -34, 1, -61, 57, -77, 4, 105, -7, 40, -7, -103, 96, -12, -22, 18, 86, 43, -44, -75, 7, 30, 121, -113, -114, -65, -8, 11, -70, -36, 16, -99, 110, 93, -19, -16, -36, 15, -125, -85, -104, 91, -8, 98, -19, -47, 37, -3, 1, -69, 62, -127, -35, 107, -84, 22, 78, 3, -40, -62, -76, 110, 122, -77, -14, 87, 96, 38, 111, 30, -94, -13, 47, -1, 23, 82, -34, -123, 47, -14, -52, 8, 56, -126, 2, 100, -22, 32, -81, 93, 76, -81, 57, -22, -74, -84, 1, 61, -84, 36, 99, 99, 50, -81, -42, 101, 116, -83, -22, -56, -20, 54, -27, 107, -108, -41, 66, 13, -107, -37, -88, -68, -120, 85, 52, -37, 28, -79, 25, 33, -77, 127, 105, -72, -44, 116, -52, -23, -83, 12, 105, 84, 15, 31, -89, 82, -81, -82, -75, 87, 4, -77, 45, 35, -61, 62, -101, 46, 2, 52, 26, -109 };
+static const int32_t mlp_vec_dense_1_b[80] = { -9750, -11500, -14882, 17451, 2798, -18271, -9626, 3800, -12782, -9608, -19959, 19413, -16816, -16410, 12226, 497, 2226, -9710, -18634, 19002, 12219, -10015, 824, 13001, 8688, -7512, -1246, 16884, 12391, 18266, -10870, 1014, 8019, -17937, -3637, 13871, 4866, -19466, -12048, 18374, -13325, -10432, 15714, -7195, 15564, -9622, -7440, -16635, -3977, 9556, 19100, -17204, -2018, -15437, 7677, 14442, -13178, -12800, -7219, 4479, 18268, 8802, -6582, 11092, 2379, -4915, -1144, -16510, -12330, -15318, 4804, 10648, 2956, 10820, 19376, 8824, 15794, -5833, -13093, -1129 };
+static const int8_t mlp_vec_dense_1_x[80] = { 44, 14, 15, 72, 16, 31, 76, 101, 32, 76, 35, 39, 27, 127, 22, 25, 19, 63, 79, 60, 53, 65, 113, 127, 0, 29, 37, 13, 9, 81, 90, 121, 67, 33, 63, 103, 62, 126, 75, 85, 110, 110, 4, 83, 82, 109, 32, 37, 85, 79, 78, 110, 108, 8, 94, 22, 93, 40, 39, 66, 47, 96, 81, 67, 81, 59, 73, 100, 15, 61, 31, 124, 13, 118, 79, 47, 29, 26, 16, 46 };
+static const int8_t mlp_vec_dense_1_expected[80] = { 0, 0, 0, 12, 0, 0, 0, 0, 35, 0, 111, 0, 0, 0, 0, 0, 0, 0, 0, 83, 28, 27, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 20, 127, 0, 0, 60, 0, 0, 0, 0, 0, 0, 109, 0, 97, 2, 103, 0, 0, 0, 0, 0, 0, 0, 127, 0, 127, 0, 0, 63, 0, 55, 0, 0, 0, 0, 0, 0, 118, 0, 0, 46, 68, 0, 0, 0 };
+static const int8_t mlp_vec_dense_2_w[231] = { 96, -44, 54, -109, 60, -96, -72, -85, 122, -69, 42, 10, -20, -77, 94, -53, -22, 102, 40, -79, 87, -15, -74, 85, -82, -36, -69, 86, 50, 83, 26, -31, 92, -85, 12, 30, 39, -60, -16, 42, -116, 82, 74, 34, 38, -30, -89, -2, 43, -58, -97, -85, 77, -25, -9, 122, -23, 46, 60, -87, -43, -19, 72, 26, -3, -20, 19, 80, -89, 39, -123, -6, -9, 92, 31, 113, -13, 45, 22, 125, -47, 55, -67, -17, -118, 65, -98, -77, 18, 75, 18, -101, -119, 5, -60, -104, -102, -116, -22, 75, 7, 1, -20, -106, 56, -9, 41, 15, 40, -45, -63, -54, 65, -21, 61, 105, -8, -83, 93, 59, 116, -52, -26, 7, -35, -83, -115, 101, 61, -86, 78, 106, -56, 115, 71, 4, -102, 27, -2, 19, -35, -89, -66, 51, 11, -58, -30, -60, -28, -14, 37, -81, -67, -31, -68, -115, 90, 39, 125, -3, -80, -121, 78, 98, 85, 87, -9, -124, -60, 57, 17, 115, -35, 23, -127, 72, 13, 10, -38, 26, 55, -77, 37, 59, 79, 112, 101, -53, -16, 63, 56, 14, 15, -3, -19, 25, -34, 0, -11, 46, -78, -64, -119, 104, 98, -92, 9, -63, 1, 49, -29, -106, -47, 68, 82, -30, 98, -84, 8, 72, 122, -102, 74, 10, 18, 17, 106, -51, -103, 59, -65 };
+static const int32_t mlp_vec_dense_2_b[7] = { -14951, 17525, 19206, -4480, -11035, 8335, -15956 };
+static const int8_t mlp_vec_dense_2_x[33] = { 35, -45, 16, -42, 13, 89, 107, -124, 36, -56, 115, -48, -65, -89, -21, -11, -95, 77, -7, 103, -118, 7, -113, -7, 42, 103, -105, 123, 116, 30, 107, -122, -102 };
+static const int8_t mlp_vec_dense_2_expected[7] = { 18, 37, -2, -25, -29, 52, -3 };
+static const mlp_q8_layer_t mlp_vec_dense_layers[3] = { { 48, 5, mlp_vec_dense_0_w, mlp_vec_dense_0_b, 1786706395, 6, MLP_Q8_ACT_RELU }, { 80, 80, mlp_vec_dense_1_w, mlp_vec_dense_1_b, 1154487209, 8, MLP_Q8_ACT_RELU }, { 7, 33, mlp_vec_dense_2_w, mlp_vec_dense_2_b, 1539316279, 10, MLP_Q8_ACT_IDENTITY } };
+static const int8_t *const mlp_vec_dense_x[3] = { mlp_vec_dense_0_x, mlp_vec_dense_1_x, mlp_vec_dense_2_x };
+static const int8_t *const mlp_vec_dense_expected[3] = { mlp_vec_dense_0_expected, mlp_vec_dense_1_expected, mlp_vec_dense_2_expected };
+#define MLP_VEC_F32_CASES 3
+static const float mlp_vec_f32_0_w[240] = { 3.311552107e-01f, 6.413640380e-01f, 9.110220671e-01f, -5.966125131e-01f, 4.565529525e-01f, -1.733036637e-01f, 6.545528173e-01f, 8.249080777e-01f, 8.827412724e-01f, 5.135468245e-01f, 8.390957117e-01f, -7.639219761e-01f, -8.121886849e-01f, -1.663094014e-01f, 4.403918386e-01f, 6.139216423e-01f, 6.740311384e-01f, -7.368806601e-01f, 3.680613041e-01f, 1.082638577e-01f, -6.657465100e-01f, -5.113945529e-02f, 5.502683520e-01f, -6.695969105e-01f, 7.899828553e-01f, -6.714385152e-01f, -8.365198374e-01f, -2.733724713e-01f, 5.566297770e-01f, 5.502243042e-01f, 7.299025059e-01f, -6.408121586e-01f, -5.640687346e-01f, -5.881864429e-01f, -5.854983330e-01f, -1.548696160e-01f, 9.900411367e-01f, 3.546915948e-01f, -3.199563920e-01f, 9.200065136e-01f, 1.246707290e-01f, -9.224407077e-01f, -8.531779051e-01f, 1.080396846e-01f, -6.115416884e-01f, -4.617527127e-01f, -2.546158135e-01f, 1.930336356e-01f, 8.623623848e-01f, -8.236685395e-01f, 8.460832834e-01f, -1.395687610e-01f, -3.783205152e-01f, -4.227327108e-01f, -2.865419090e-01f, -1.594078541e-01f, -2.073343694e-01f, 6.932627559e-01f, -3.219418824e-01f, -5.205801725e-01f, 8.636159301e-01f, 5.571852922e-01f, -9.434334636e-01f, 1.111116931e-01f, 2.533579171e-01f, -7.037773728e-01f, -3.343657553e-01f, -6.382967830e-01f, -8.293824196e-01f, 2.464329265e-02f, -8.529877663e-01f, -7.805868238e-02f, -4.358403012e-02f, 1.936532259e-01f, 7.092779279e-01f, -9.467721581e-01f, -6.435226798e-01f, 3.355205357e-01f, -1.442904919e-01f, -6.405246258e-01f, -6.205374599e-01f, -6.251477599e-01f, 8.415106535e-01f, -2.382994741e-01f, 1.514900029e-01f, 1.429897994e-01f, 5.102344751e-01f, -3.609684110e-02f, -2.279598117e-01f, 4.271328747e-01f, -3.499277234e-01f, -8.036500812e-01f, 9.950198531e-01f, 8.658908606e-01f, -8.640629798e-02f, 4.455257654e-01f, 6.342313290e-01f, -2.383387238e-01f, -6.377481818e-01f, -6.810690761e-01f, 7.552489042e-01f, 9.801064134e-01f, -1.023916155e-01f, 9.585629702e-01f, -5.271846801e-02f, -9.455944598e-02f, -4.629023373e-01f, 1.349328160e-01f, -2.188642770e-01f, 7.342057824e-01f, 9.034177661e-01f, 4.268168211e-01f, -1.246571839e-01f, -2.679736316e-01f, 9.428745508e-01f, 3.597387969e-01f, 2.535019815e-01f, -9.988447428e-01f, 9.711537957e-01f, -3.242770135e-01f, 4.886172712e-03f, -6.693789959e-01f, 9.304159880e-01f, 7.650845051e-01f, -2.082976103e-01f, 5.945692062e-01f, 9.941781163e-01f, 7.422003150e-01f, -7.945016026e-01f, -8.408845067e-01f, -3.094897270e-01f, -2.236319147e-02f, -5.334898233e-01f, -6.833108068e-01f, -5.365311503e-01f, 9.155237079e-01f, 6.193535924e-01f, -6.895154119e-01f, -1.408546269e-01f, 6.882160902e-01f, -4.536327422e-01f, 4.286943004e-02f, -4.228775203e-01f, 8.577144146e-01f, 2.249977365e-02f, -3.842104077e-01f, 4.745990634e-01f, -5.281931162e-01f, -4.879124761e-01f, 8.517302871e-01f, 7.824070454e-01f, -6.493670344e-01f, -8.006769419e-01f, 7.595609426e-01f, -1.364066452e-01f, 5.405758023e-01f, -3.020831347e-01f, -8.763151765e-01f, -7.531495094e-01f, -6.831680238e-02f, 4.885642529e-01f, 8.237580061e-01f, -3.787452281e-01f, -1.571284682e-01f, 4.257498980e-01f, 3.819334805e-01f, 5.624796748e-01f, 4.966124594e-01f, 5.616960302e-02f, 5.136237741e-01f, -1.058009863e-01f, 5.601458549e-01f, -7.962337136e-02f, -7.783386707e-01f, 6.191939116e-01f, -6.837006807e-01f, 8.770716190e-02f, 4.663197994e-01f, 2.603976130e-01f, 1.216950640e-01f, 9.535723925e-01f, -4.723490775e-01f, 2.320475644e-03f, 4.862714112e-01f, 9.612870812e-01f, -5.268534422e-01f, -9.320018888e-01f, 6.155250669e-01f, 2.903748453e-01f, -1.066368371e-01f, 8.262677193e-01f, 9.559896588e-01f, -2.539740205e-01f, -1.541252732e-01f, 1.208696961e-01f, -2.277114242e-01f, -1.115975380e-01f, -5.288905501e-01f, 6.701492667e-01f, -1.090485156e-01f, 8.097266555e-01f, 6.427656412e-01f, -6.945251022e-03f, -5.979378819e-01f, -9.709538221e-01f, -4.407788813e-01f, 6.221786737e-01f, 1.082543507e-01f, 5.402716994e-01f, -8.017174602e-01f, 5.082709789e-01f, 9.728377461e-01f, -9.476298094e-01f, -7.330399156e-01f, 7.085754275e-01f, -2.369842231e-01f, -3.568656743e-01f, 6.991956234e-01f, 7.612616420e-01f, 9.852805734e-01f, -4.988423586e-01f, 1.578830332e-01f, -8.021751642e-01f, 8.424134925e-03f, 6.765742898e-01f, -3.343583643e-01f, 2.482746542e-02f, 3.324747384e-01f, -8.570443392e-01f, -4.235435128e-01f, -2.655049562e-01f, 8.318619728e-01f, 3.913185596e-01f, 2.450651079e-01f, -5.195148587e-01f, 7.075548172e-01f, -5.479205847e-01f, 5.399075747e-01f, -4.539902210e-01f, 8.953725100e-01f };
+static const float mlp_vec_f32_0_b[48] = { -8.928516507e-01f, -7.759684920e-01f, 7.862287760e-01f, -6.692123413e-01f, 1.726733148e-01f, -2.818397880e-01f, 1.554624289e-01f, 2.273464799e-01f, -5.166663975e-02f, -6.014641840e-03f, 4.748148620e-01f, -6.345539093e-01f, 4.009021819e-01f, -9.374940395e-01f, 5.770397186e-01f, -1.881538332e-01f, 3.655828536e-01f, -7.019448876e-01f, 9.242067337e-01f, 8.445096016e-01f, 7.512843013e-01f, 6.318494081e-01f, 5.012142658e-01f, -9.589514136e-01f, -6.194347888e-02f, -5.823224783e-01f, -8.526552916e-01f, 3.940116465e-01f, 9.853374958e-01f, 9.450556636e-01f, -2.158692777e-01f, -5.415132642e-01f, 2.063070536e-01f, -7.286392450e-01f, 6.358184814e-01f, 7.912811637e-01f, 2.249571979e-01f, 7.669849396e-01f, -5.956539512e-01f, 7.558699846e-01f, -3.602364361e-01f, 2.309256978e-02f, 8.442548513e-01f, 9.037852287e-03f, 6.018721461e-01f, -5.711013079e-01f, -9.046713114e-01f, 8.870877624e-01f };
+static const float mlp_vec_f32_0_x[5] = { 3.353119612e+00f, 2.275244713e+00f, -3.063555062e-02f, -2.150477648e+00f, -3.674353838e+00f };
+static const float mlp_vec_f32_0_expected[48] = { 3.045012236e+00f, 9.004027247e-01f, 4.320846558e+00f, -9.938536882e-01f, 2.278934479e+00f, -1.743089914e+00f, -2.443474054e+00f, 4.398436069e+00f, 1.184764743e+00f, -6.989586949e-01f, 2.888947010e+00f, -3.350117683e+00f, 3.866430044e+00f, 3.254164457e+00f, -7.869660854e-01f, 1.859278083e+00f, 1.701642573e-01f, -3.591529846e+00f, 3.156267405e-01f, -3.492419720e+00f, -8.094959855e-01f, 2.419150829e+00f, -3.437334776e+00f, -3.569048405e+00f, 3.678108692e+00f, -6.046249390e+00f, -4.641951561e+00f, -7.525066376e+00f, 3.398144960e+00f, 4.628881454e+00f, 3.488740683e+00f, -2.730991125e+00f, -5.747203350e+00f, -3.871761322e+00f, -5.450761318e-02f, -1.752851963e+00f, 5.004151821e+00f, 4.874603748e+00f, 4.794083238e-01f, -3.716861010e-01f, -3.984908342e+00f, -1.844475389e+00f, 1.104721904e+00f, -5.401756287e+00f, 2.217920303e+00f, -1.905104399e+00f, -2.050818443e+00f, -2.823993444e+00f };
+static const float mlp_vec_f32_1_w[624] = { 7.149651647e-01f, 7.923024893e-01f, -5.163174272e-01f, 3.117254078e-01f, 1.081932150e-02f, -1.661295258e-02f, -3.548881412e-02f, 2.510461770e-02f, -8.685851097e-01f, -5.496693850e-01f, -5.278366804e-01f, -1.972118169e-01f, -2.269291729e-01f, 9.622723460e-01f, 8.510485888e-01f, 3.953276575e-01f, -2.595337033e-01f, 1.273094267e-01f, -4.214663059e-02f, -2.608928084e-01f, 7.093325257e-01f, 5.469346046e-01f, 4.278413653e-01f, -2.570240498e-01f, -1.928536594e-01f, -2.788942754e-01f, 3.761893511e-01f, 4.725886583e-01f, 6.171946526e-01f, 1.336397082e-01f, -4.056677818e-01f, 6.022109389e-01f, 2.444063425e-01f, 9.264864922e-01f, -2.541033626e-01f, -6.729848981e-01f, 6.756465435e-01f, -9.964242578e-01f, -6.805259585e-01f, 2.180256248e-01f, 3.811214268e-01f, -4.946736693e-01f, -9.337425828e-01f, 1.085101441e-01f, 5.586136580e-01f, 9.828192592e-01f, -3.791649342e-01f, -3.874973953e-01f, 4.140875340e-01f, 5.710948706e-01f, -4.252703786e-01f, -7.793247104e-01f, -4.985014498e-01f, -4.997641742e-01f, 2.625730820e-02f, -6.132853627e-01f, -8.511421680e-01f, 9.307286143e-01f, 2.128085047e-01f, -9.654948711e-01f, 4.300200641e-01f, -6.369847655e-01f, -2.093494684e-01f, 9.783481061e-02f, 4.652212262e-01f, 9.262884855e-01f, -4.976479113e-01f, -9.202600718e-01f, -5.997558236e-01f, -3.410367370e-01f, -5.656755567e-01f, -1.550813168e-01f, -1.444687247e-01f, 8.965678811e-01f, 8.999028206e-01f, -1.249000207e-01f, -2.731299996e-01f, 7.682878971e-01f, 4.019679427e-01f, 7.748019695e-01f, -1.536410004e-01f, -9.564636946e-01f, -4.027269483e-01f, -5.976293087e-01f, 2.420282215e-01f, 1.805175990e-01f, -7.793798447e-01f, 6.027029157e-01f, 3.621599674e-01f, -1.718402654e-01f, -1.233507618e-01f, -6.539713591e-02f, 3.665195704e-01f, -2.613436058e-02f, 8.026983738e-01f, 2.549579740e-01f, -2.755259573e-01f, 5.542508960e-01f, 1.594211310e-01f, -6.229589581e-01f, 3.278230131e-01f, 7.926428318e-01f, -7.730840892e-02f, 1.581433266e-01f, -8.514631391e-01f, -8.878114820e-01f, -4.877708256e-01f, 9.008015394e-01f, -7.893619537e-01f, -3.643265963e-01f, 3.159895241e-01f, 7.858141065e-01f, 9.178950787e-01f, 2.814717889e-01f, -9.100853205e-01f, -1.207157299e-01f, 7.970826030e-01f, -3.861922324e-01f, -9.885904193e-01f, 8.475953937e-01f, 7.811794877e-01f, 4.565040171e-01f, -6.665978432e-01f, 4.358033538e-01f, -7.491517067e-01f, -5.023346543e-01f, -9.518020749e-01f, -5.696101189e-01f, 7.742988467e-01f, 4.934513867e-01f, 3.539360166e-01f, 2.035328448e-01f, -5.630456209e-01f, -8.265757561e-01f, -4.931968153e-01f, 7.174088359e-01f, 3.294964880e-02f, -8.593289852e-01f, -4.320714772e-01f, -9.766728431e-02f, -6.479156613e-01f, -7.858527303e-01f, -2.084002271e-02f, 7.514640689e-01f, -5.371394753e-01f, -1.308329403e-01f, 5.958189964e-01f, 1.304768324e-01f, 2.620548904e-01f, 4.298518896e-01f, 6.286813021e-01f, -8.931490183e-01f, 1.417147368e-01f, -8.262537718e-01f, -6.802350879e-01f, -8.970233202e-01f, -6.498728395e-01f, 7.471039891e-01f, -6.615073681e-01f, -9.568600059e-01f, -4.916959703e-01f, 5.385937095e-01f, 5.970301852e-02f, 8.884550631e-02f, 3.209579289e-01f, -3.735401332e-01f, 5.789294839e-01f, -1.362201199e-02f, -3.829356432e-01f, -4.756909609e-01f, 9.656425118e-01f, 5.739082098e-01f, 1.119314730e-01f, 2.659190446e-02f, 2.144109458e-01f, -9.515048862e-01f, -8.331952095e-01f, 2.965471745e-01f, 3.456658423e-01f, 7.786254287e-01f, 2.317175716e-01f, 4.851232767e-01f, 1.307114363e-01f, -1.965625882e-01f, -8.720360696e-02f, 9.075032473e-01f, 8.651059866e-01f, 7.661894560e-01f, 1.459153742e-01f, -5.720176101e-01f, -8.430338502e-01f, 8.197845221e-01f, -7.941511273e-01f, -2.886669934e-01f, 6.262333989e-01f, -5.873276591e-01f, 5.946947336e-01f, -5.256339908e-01f, 5.692407489e-01f, 4.231015444e-01f, -4.276751876e-01f, -3.254293501e-01f, -2.747639120e-01f, 1.552178711e-01f, 8.131951094e-01f, 9.241758287e-02f, -1.672103703e-01f, -2.179178894e-01f, -6.492432356e-01f, 3.398573399e-01f, -8.240547031e-03f, 7.902679443e-01f, 3.203114867e-02f, 9.114922881e-01f, -1.195576712e-01f, 3.116161749e-02f, -6.352061629e-01f, 5.784289837e-01f, -9.427377582e-01f, -6.417366266e-01f, -3.696581125e-01f, 6.783965826e-01f, 2.222713977e-01f, -3.855794072e-01f, 8.299112916e-01f, 6.630447507e-01f, -9.381665587e-01f, -5.157101154e-01f, 3.944553435e-01f, 7.407352924e-01f, 4.843314290e-01f, 7.676562071e-01f, -7.484457493e-01f, -9.840099216e-01f, -1.176448092e-01f, -8.728007078e-01f, 3.242241740e-01f, 8.314812779e-01f, -1.621329933e-01f, 1.586672068e-01f, -2.246102244e-01f, -6.714600921e-01f, -7.644836307e-01f, 4.317817688e-01f, 8.086253405e-01f, -2.698296010e-01f, -7.284742594e-01f, 6.587162614e-01f, -4.755300283e-01f, 5.347699523e-01f, 3.046312034e-01f, -3.798002899e-01f, 2.267739549e-02f, -2.605999112e-01f, -7.492743134e-01f, -5.516849756e-01f, 1.437897831e-01f, 5.602149963e-01f, -8.175833225e-01f, -6.024805903e-01f, -9.770489931e-01f, 9.679971933e-01f, -7.869643569e-01f, -2.401119620e-01f, -8.890776038e-01f, 1.915733912e-03f, 2.647075057e-01f, 4.833621904e-02f, 3.558608890e-01f, -5.690068603e-01f, 8.288913965e-01f, 5.361827612e-01f, -6.207416654e-01f, -9.414422512e-02f, -9.599912167e-01f, 6.581228971e-01f, 7.924559712e-01f, 4.752857238e-02f, -2.819084227e-01f, 5.988095403e-01f, -2.911303639e-01f, -9.063923955e-01f, 3.289054930e-01f, -1.870986521e-01f, 9.940824509e-01f, 2.754177712e-02f, -7.679078579e-01f, 5.677195787e-01f, 9.199221134e-01f, -7.580938935e-01f, -3.582704961e-01f, -2.950515784e-02f, 4.141527712e-01f, 4.064678252e-01f, 2.484930009e-01f, 7.276225686e-01f, 4.728777111e-01f, -9.536769390e-01f, 9.392212033e-01f, 6.572108865e-01f, 3.491845429e-01f, 5.675746799e-01f, 6.509534717e-01f, -9.006147385e-01f, 2.705392540e-01f, -7.173607945e-01f, -4.849672318e-01f, 6.407315731e-01f, 9.618995339e-02f, -3.984995484e-01f, -6.174064875e-01f, -4.345822707e-02f, -7.879054546e-01f, -2.321303636e-01f, 7.150440812e-01f, -2.582932711e-01f, 3.397688270e-02f, 8.978161216e-01f, -2.746833563e-01f, -4.436879456e-01f, -1.673720479e-01f, -2.225575447e-01f, 9.204027057e-01f, -9.725434184e-01f, -6.983855963e-01f, 5.670139194e-01f, -9.946052432e-01f, -1.259833574e-01f, 3.929238021e-01f, -8.867856860e-01f, -3.648855686e-01f, -4.420773983e-01f, 2.421170659e-02f, 2.450358421e-01f, 5.230226517e-01f, -8.065044284e-01f, -5.134611726e-01f, 5.172924995e-01f, 7.457045317e-01f, -3.527210653e-01f, -8.833496571e-01f, -7.239789367e-01f, 5.829573870e-01f, -7.363545299e-01f, -5.705646873e-01f, -6.185951233e-01f, -1.719660014e-01f, 2.834717631e-01f, -7.250980139e-01f, -5.620218813e-02f, 8.568915129e-01f, -9.861765429e-03f, -2.383003198e-02f, 4.659675062e-01f, 1.132428125e-01f, -1.159041077e-01f, 6.833362579e-01f, -7.180408239e-01f, -5.879953504e-01f, 9.762121439e-01f, -4.720825255e-01f, -8.444059491e-01f, -6.715368629e-01f, 8.889141679e-01f, -6.314367056e-01f, 6.375401467e-02f, 4.677112103e-01f, -9.486194253e-01f, -4.353252351e-01f, 4.707283676e-01f, -4.520336390e-01f, -2.904118896e-01f, 1.204187572e-01f, 6.026481390e-01f, -3.716486394e-01f, -6.742196083e-01f, -9.460781813e-01f, -4.515507817e-01f, 3.349556923e-01f, 8.259872198e-01f, 6.064898334e-03f, -7.060126662e-01f, 2.396296561e-01f, -8.069359064e-01f, -7.403542995e-01f, -7.220802307e-01f, 8.526813984e-01f, 2.397111505e-01f, -9.835921526e-01f, 8.605853915e-01f, -2.210057527e-01f, -6.670869589e-01f, 3.540422022e-01f, 2.559330128e-02f, 2.540827394e-01f, -1.176277101e-01f, -5.591147542e-01f, -9.892700315e-01f, 3.209599555e-01f, -3.529883176e-02f, -1.440213323e-01f, 2.386279404e-01f, -2.175654983e-03f, 8.334351778e-01f, 4.612033963e-01f, 8.563015461e-01f, -5.337667465e-01f, 2.448616177e-01f, 8.137881160e-01f, 5.365881920e-01f, -2.214637846e-01f, 4.821158350e-01f, 1.678279489e-01f, -4.060014784e-01f, 4.749741852e-01f, -8.019597530e-01f, -8.041460514e-01f, -6.083704233e-01f, -6.979346275e-01f, 7.414687276e-01f, -5.398250222e-01f, 9.442380667e-01f, -9.104903936e-01f, -8.520284295e-01f, -1.588395536e-01f, 2.455552667e-01f, 2.639675438e-01f, -7.755904198e-01f, 5.892689899e-02f, -6.337226033e-01f, -5.147116780e-01f, -5.037239194e-01f, -4.602628946e-01f, 7.355859876e-01f, 6.073951721e-01f, -6.912510395e-01f, 3.694845140e-01f, -5.394470692e-01f, -9.671546817e-01f, -8.686315417e-01f, 5.034962893e-01f, 3.544485867e-01f, 5.961827189e-02f, -7.401350141e-01f, 6.011028290e-01f, 1.959256828e-02f, 1.511163265e-01f, 6.367577910e-01f, -3.959670365e-01f, -3.754777908e-01f, -7.944471240e-01f, -3.321684599e-01f, 6.273128986e-01f, 2.484068871e-01f, -4.710970223e-01f, -4.512291551e-01f, 3.014490604e-01f, 6.939945817e-01f, -1.816705167e-01f, -9.981972575e-01f, 8.940328956e-01f, 7.659053206e-01f, 2.614978552e-01f, -9.173186421e-01f, -1.011970192e-01f, -4.126704633e-01f, -8.308197856e-01f, -1.866419464e-01f, 1.694212295e-02f, 1.709083468e-02f, -4.389927685e-01f, -5.062161088e-01f, 6.289765239e-01f, -7.810215950e-01f, 5.857213214e-02f, 1.128680855e-01f, -6.450180411e-01f, -9.550361633e-01f, 5.502904300e-03f, 7.940034568e-02f, -6.881939173e-01f, -9.909826517e-01f, 4.172549769e-02f, -9.639115334e-01f, -1.662395447e-01f, 5.399000049e-01f, 6.889968514e-01f, 1.658210307e-01f, 2.084702551e-01f, -7.216317058e-01f, 8.612536825e-03f, -5.202835798e-01f, 6.501501799e-01f, -2.297498584e-01f, 2.515802085e-01f, 5.179007649e-01f, -1.248673871e-01f, 8.666126728e-01f, 5.675119534e-02f, -4.540684521e-01f, 7.167724967e-01f, 3.379919827e-01f, -9.741867185e-01f, -4.839383662e-01f, 5.154448152e-01f, 3.228380382e-01f, -4.249232262e-02f, 9.018641710e-01f, -3.195590377e-01f, 3.967794776e-01f, -2.979095578e-01f, -4.618846774e-01f, -5.770462751e-01f, -8.205416799e-01f, -7.477200031e-01f, -6.461130977e-01f, -4.024261832e-01f, 9.152581096e-01f, -6.864946485e-01f, -1.155660599e-01f, -6.125704646e-01f, -1.517157406e-01f, -9.385632873e-01f, -4.536730647e-01f, -4.946973920e-01f, 6.558685005e-02f, -9.771416187e-01f, -1.533722971e-02f, -8.233222961e-01f, 7.391847968e-01f, -1.490262449e-01f, 5.286561847e-01f, 6.649546623e-01f, -3.685924113e-01f, 6.112069488e-01f, 9.189864993e-02f, 6.303465366e-01f, 6.000498533e-01f, -6.835826039e-01f, 3.111045957e-01f, -1.836902946e-01f, -9.430052638e-01f, -5.324412584e-01f, -5.779401064e-01f, 1.051714346e-01f, -2.868342102e-01f, -6.453872919e-01f, 5.760405064e-01f, -6.736333370e-01f, 4.866986275e-01f, 4.221997261e-01f, -6.522096992e-01f, 3.936212659e-01f, 3.805757165e-01f, 3.472449183e-01f, 9.229936004e-01f, 8.612934947e-01f, -1.077405587e-01f, -3.729290664e-01f, -7.732028365e-01f, -3.454419672e-01f, 2.990470529e-01f, 6.692559719e-01f, -7.061636448e-01f, 4.017038271e-02f, -6.866669655e-01f, 7.487112284e-01f, 8.253829479e-01f, -8.305321336e-01f, -8.392862678e-01f, 6.707465649e-01f, -1.256062388e-01f, -2.777206004e-01f, 9.668169022e-01f, 8.130134940e-01f, -5.187580585e-01f, -4.770399630e-01f, 8.487694860e-01f, 8.616725802e-01f, -1.176492423e-01f, -1.625960916e-01f, 5.668057203e-01f, -7.405340075e-01f, -3.777866960e-01f, -8.412734866e-01f, -6.856327057e-01f, -7.238470316e-01f, -3.445287943e-01f, 5.076957345e-01f, 8.598653674e-01f, -6.098465919e-01f, -6.454141736e-01f, 9.397612512e-02f, 3.368745148e-01f, 5.461984277e-01f, 8.202244341e-02f, 7.907874584e-01f, -6.694510579e-01f, -6.840723008e-02f, -7.329335213e-01f, 9.624560475e-01f, 9.737501144e-01f, 2.510329485e-01f, 6.195511818e-01f, 1.395954788e-01f, 9.148392677e-01f, 5.441740751e-01f, 4.194894433e-02f, -6.677956879e-02f, 3.998230398e-01f, -7.010577321e-01f, -1.611026675e-01f, -8.317823410e-01f, -1.927455515e-01f, 8.261904120e-01f, 9.104739875e-03f, 4.631446600e-01f, -8.208540678e-01f, -9.097331762e-01f, -5.729718804e-01f, 5.966848135e-01f, -5.635452867e-01f, -7.094120383e-01f, 4.687638283e-01f };
+static const float mlp_vec_f32_1_b[13] = { 1.409059763e-01f, -6.744983792e-01f, 1.645190269e-02f, -5.336115956e-01f, -2.388657182e-01f, 4.979801178e-02f, 9.445310235e-01f, -2.345869541e-01f, -6.987112164e-01f, 3.394090533e-01f, 6.935523748e-01f, 6.439747810e-01f, -4.894978702e-01f };
+static const float mlp_vec_f32_1_x[48] = { 3.198900223e+00f, -2.926597357e+00f, -2.922585726e+00f, 2.084831476e+00f, 1.715709805e+00f, 1.689472646e-01f, 1.590862513e+00f, -1.718927741e+00f, 3.534851313e+00f, -7.824788094e-01f, 2.173507452e+00f, 3.091769218e+00f, 8.076137304e-02f, -3.976435900e+00f, 2.174262285e+00f, 3.616559744e+00f, -2.203542233e+00f, 3.874696970e+00f, -3.559482574e+00f, 1.834269762e+00f, 3.318499088e+00f, 3.653133392e+00f, -3.713386774e+00f, 3.418874025e+00f, 1.915064692e+00f, 2.824206114e+00f, 6.840752363e-01f, -2.189262629e+00f, 1.240325212e+00f, 1.814074159e+00f, -1.782396674e+00f, 2.062489241e-01f, 2.471942902e+00f, 2.208207846e+00f, -1.056866765e+00f, 1.621117473e+00f, 3.049242735e+00f, 2.843023539e+00f, -3.378551483e+00f, -1.490975380e+00f, -1.911759496e+00f, -2.990120351e-01f, -2.452573776e+00f, -2.671970606e+00f, 2.060878992e+00f, -4.929544330e-01f, -2.008400679e+00f, -2.818268776e+00f };
+static const float mlp_vec_f32_1_expected[13] = { 2.335452080e+00f, -4.218450069e+00f, -2.021875954e+01f, -6.183522701e+00f, -6.326042175e+00f, 2.886553049e+00f, 8.064037323e+00f, -6.343123436e+00f, -8.485950470e+00f, 1.677341461e+00f, -1.665756989e+01f, -7.360562801e+00f, -1.202917099e+01f };
+static const float mlp_vec_f32_2_w[13] = { -3.144895434e-01f, 6.126667857e-01f, 2.357521057e-01f, 6.386502981e-01f, 5.908990502e-01f, 9.830937982e-01f, -9.286746383e-01f, 4.118582308e-01f, -5.996925831e-01f, -5.331234932e-01f, -8.421084285e-01f, 5.127247572e-01f, -9.099161625e-01f };
+static const float mlp_vec_f32_2_b[1] = { 1.296660304e-01f };
+static const float mlp_vec_f32_2_x[13] = { -2.528570890e+00f, 2.125793934e+00f, -1.409053087e+00f, -3.473083735e+00f, 3.481404305e+00f, -2.121126652e+00f, -6.703006029e-01f, -2.559893608e+00f, -2.345861673e+00f, -3.575173616e-01f, -3.628053665e+00f, -3.926777840e+00f, 7.182998657e-01f };
+static const float mlp_vec_f32_2_expected[1] = { 1.202738047e+00f };
+static const uint16_t mlp_vec_f32_shape[3][2] = { { 5, 48 }, { 48, 13 }, { 13, 1 } };
+static const float *const mlp_vec_f32_w[3] = { mlp_vec_f32_0_w, mlp_vec_f32_1_w, mlp_vec_f32_2_w };
+static const float *const mlp_vec_f32_b[3] = { mlp_vec_f32_0_b, mlp_vec_f32_1_b, mlp_vec_f32_2_b };
+static const float *const mlp_vec_f32_x[3] = { mlp_vec_f32_0_x, mlp_vec_f32_1_x, mlp_vec_f32_2_x };
+static const float *const mlp_vec_f32_expected[3] = { mlp_vec_f32_0_expected, mlp_vec_f32_1_expected, mlp_vec_f32_2_expected };
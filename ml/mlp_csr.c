@@ -0,0 +1,89 @@
+#include "mlp_csr.h"
+#include <math.h>
+
+void
+mlp_csr_layer_forward(const mlp_csr_layer_t *layer, const float *in, float *out)
+{
+  uint16_t o, k;
+
+  for(o = 0; o < layer->n_outputs; o++) {
+    float sum = 0.0f;
+    for(k = layer->row_ptr[o]; k < layer->row_ptr[o + 1]; k++) {
+      sum += layer->values[k] * in[layer->col_idx[k]];
+    }
+    sum = sum + layer->biases[o];
+    if(layer->activation == MLP_CSR_ACT_RELU && sum < 0.0f) {
+      sum = 0.0f;
+    }
+    out[o] = sum;
+  }
+}
+
+// Tutti i layer, ritorna il buffer con le uscite dell'ultimo
+static const float *
+forward(const mlp_csr_net_t *net, const float *features)
+{
+  const float *in = features;
+  float *out = net->buf1;
+  uint8_t l;
+
+  for(l = 0; l < net->n_layers; l++) {
+    mlp_csr_layer_forward(&net->layers[l], in, out);
+    in = out;
+    out = (out == net->buf1) ? net->buf2 : net->buf1;
+  }
+  return in;
+}
+
+int32_t
+mlp_csr_step(const mlp_csr_net_t *net, uint8_t layer, const float *features, int32_t n_features,
+             float *out, int32_t out_length)
+{
+  const mlp_csr_layer_t *last = &net->layers[net->n_layers - 1];
+  // Stessa alternanza di forward(): il layer l scrive in buf1 se l e' pari
+  const float *in = layer == 0 ? features : (layer % 2 ? net->buf1 : net->buf2);
+  float *next = layer % 2 ? net->buf2 : net->buf1;
+  uint16_t o;
+
+  if(layer >= net->n_layers ||
+     (layer == 0 && (n_features != net->layers[0].n_inputs || out_length < last->n_outputs))) {
+    return -1;
+  }
+
+  mlp_csr_layer_forward(&net->layers[layer], in, next);
+  if(layer < net->n_layers - 1) {
+    return 1;
+  }
+  for(o = 0; o < last->n_outputs; o++) {
+    out[o] = next[o];
+  }
+  return 0;
+}
+
+float
+mlp_csr_regress1(const mlp_csr_net_t *net, const float *features, int32_t n_features)
+{
+  if(n_features != net->layers[0].n_inputs ||
+     net->layers[net->n_layers - 1].n_outputs != 1) {
+    return NAN;
+  }
+  return forward(net, features)[0];
+}
+
+int32_t
+mlp_csr_regress(const mlp_csr_net_t *net, const float *features, int32_t n_features,
+                float *out, int32_t out_length)
+{
+  const mlp_csr_layer_t *last = &net->layers[net->n_layers - 1];
+  const float *result;
+  uint16_t o;
+
+  if(n_features != net->layers[0].n_inputs || out_length < last->n_outputs) {
+    return -1;
+  }
+  result = forward(net, features);
+  for(o = 0; o < last->n_outputs; o++) {
+    out[o] = result[o];
+  }
+  return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Motore di inferenza per MLP con pesi sparsi (pruning per magnitudine).
+ *
+ * Ogni layer e' memorizzato in formato CSR: per ogni neurone di uscita solo
+ * i pesi non nulli, con indice di colonna uint8 e row_ptr uint16.
+ * Saltare un peso nullo equivale a sommare 0, quindi il risultato coincide
+ * con quello di eml_net_regress1 sullo stesso modello potato.
+ * I modelli vengono generati con tools/eml_sparse.py.
+ */
+#ifndef MLP_CSR_H_
+#define MLP_CSR_H_
+
+#include <stdint.h>
+
+#define MLP_CSR_ACT_IDENTITY 0
+#define MLP_CSR_ACT_RELU     1
+
+typedef struct mlp_csr_layer {
+  uint16_t n_outputs;
+  uint16_t n_inputs;         /* al massimo 256, indici di colonna uint8 */
+  const uint16_t *row_ptr;   /* n_outputs + 1 elementi */
+  const uint8_t *col_idx;
+  const float *values;
+  const float *biases;
+  uint8_t activation;
+} mlp_csr_layer_t;
+
+typedef struct mlp_csr_net {
+  uint8_t n_layers;
+  const mlp_csr_layer_t *layers;
+  float *buf1;
+  float *buf2;
+  int32_t buf_length;
+} mlp_csr_net_t;
+
+/* Esegue un layer: in -> out (attivazione inclusa) */
+void mlp_csr_layer_forward(const mlp_csr_layer_t *layer, const float *in, float *out);
+
+/* Inferenza completa, ritorna NAN se la rete non e' compatibile con l'ingresso */
+float mlp_csr_regress1(const mlp_csr_net_t *net, const float *features, int32_t n_features);
+
+/* Inferenza con piu' uscite, ritorna 0 oppure -1 */
+int32_t mlp_csr_regress(const mlp_csr_net_t *net, const float *features, int32_t n_features,
+                        float *out, int32_t out_length);
+
+/* Inferenza a passi, un layer per chiamata (come mlp_q8_step()) */
+int32_t mlp_csr_step(const mlp_csr_net_t *net, uint8_t layer, const float *features, int32_t n_features,
+                     float *out, int32_t out_length);
+
+#endif /* MLP_CSR_H_ */
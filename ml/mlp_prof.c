@@ -0,0 +1,188 @@
+#include "mlp_prof.h"
+
+#if MLP_PROF
+#include "sys/rtimer.h"
+#include "sys/energest.h"
+#include <stdio.h>
+#include <string.h>
+
+static mlp_prof_t *profiles[MLP_PROF_MAX_PROFILES];
+static uint8_t n_profiles;
+
+static uint32_t
+cpu_now(void)
+{
+#if ENERGEST_CONF_ON
+  energest_flush();
+  return (uint32_t)energest_type_time(ENERGEST_TYPE_CPU);
+#else
+  return 0;
+#endif
+}
+
+#define SUB (1 << MLP_PROF_SUB_BITS)
+
+// Bucket logaritmici: valori sotto SUB esatti, poi SUB bucket per ogni potenza di 2
+static uint8_t
+bucket(uint32_t t)
+{
+  uint8_t msb = 0;
+  uint32_t b;
+
+  if(t < SUB) {
+    return (uint8_t)t;
+  }
+  while(t >> (msb + 1)) {
+    msb++;
+  }
+  b = ((uint32_t)(msb - MLP_PROF_SUB_BITS + 1) << MLP_PROF_SUB_BITS) | ((t >> (msb - MLP_PROF_SUB_BITS)) & (SUB - 1));
+  return b < MLP_PROF_BUCKETS ? (uint8_t)b : MLP_PROF_BUCKETS - 1;
+}
+
+// Valore massimo che cade nel bucket b
+static uint32_t
+bucket_top(uint8_t b)
+{
+  uint8_t msb = (b >> MLP_PROF_SUB_BITS) + MLP_PROF_SUB_BITS - 1;
+
+  if(b < SUB) {
+    return b;
+  }
+  return (((uint32_t)(SUB | (b & (SUB - 1))) + 1) << (msb - MLP_PROF_SUB_BITS)) - 1;
+}
+
+static void
+record(mlp_prof_stat_t *s, uint32_t t, uint32_t cpu)
+{
+  uint8_t b = bucket(t);
+
+  if(s->count == 0 || t < s->min) {
+    s->min = t;
+  }
+  if(t > s->max) {
+    s->max = t;
+  }
+  s->count++;
+  s->sum += t;
+  s->cpu_sum += cpu;
+  if(s->hist[b] < UINT16_MAX) {
+    s->hist[b]++;
+  }
+}
+
+void
+mlp_prof_register(mlp_prof_t *p, const char *name)
+{
+  memset(p, 0, sizeof(*p));
+  p->name = name;
+  if(n_profiles < MLP_PROF_MAX_PROFILES) {
+    profiles[n_profiles++] = p;
+  }
+}
+
+void
+mlp_prof_step_start(mlp_prof_t *p)
+{
+  p->cpu0 = cpu_now();
+  p->t0 = (uint32_t)RTIMER_NOW();
+}
+
+void
+mlp_prof_step_end(mlp_prof_t *p, uint8_t layer, int32_t more)
+{
+  uint32_t t = (uint32_t)(rtimer_clock_t)(RTIMER_NOW() - p->t0);
+  uint32_t cpu = cpu_now() - p->cpu0;
+
+  if(more < 0) {
+    p->run = p->run_cpu = 0; // rete non compatibile, niente da registrare
+    return;
+  }
+  if(layer < MLP_PROF_MAX_LAYERS) {
+    record(&p->layer[layer], t, cpu);
+    if(layer >= p->n_layers) {
+      p->n_layers = layer + 1;
+    }
+  }
+  p->run += t;
+  p->run_cpu += cpu;
+  if(more == 0) {
+    record(&p->total, p->run, p->run_cpu);
+    p->run = p->run_cpu = 0;
+  }
+}
+
+uint32_t
+mlp_prof_percentile(const mlp_prof_stat_t *s, uint8_t pct)
+{
+  uint32_t need = (s->count * pct + 99) / 100, seen = 0;
+  uint8_t b;
+
+  for(b = 0; b < MLP_PROF_BUCKETS; b++) {
+    seen += s->hist[b];
+    if(seen >= need && seen > 0) {
+      return bucket_top(b) < s->max ? bucket_top(b) : s->max;
+    }
+  }
+  return s->max;
+}
+
+uint8_t
+mlp_prof_count(void)
+{
+  return n_profiles;
+}
+
+const mlp_prof_t *
+mlp_prof_get(uint8_t i)
+{
+  return i < n_profiles ? profiles[i] : NULL;
+}
+
+// [min,media,max,p99,cpu media] in tick
+static int
+stat_json(const mlp_prof_stat_t *s, char *buf, int size)
+{
+  uint32_t n = s->count ? s->count : 1;
+  return snprintf(buf, size, "[%lu,%lu,%lu,%lu,%lu]",
+                  (unsigned long)s->min, (unsigned long)(s->sum / n), (unsigned long)s->max,
+                  (unsigned long)mlp_prof_percentile(s, 99), (unsigned long)(s->cpu_sum / n));
+}
+
+int
+mlp_prof_json(char *buf, int size)
+{
+  int len, i;
+  uint8_t l;
+
+#if ENERGEST_CONF_ON
+  len = snprintf(buf, size, "{\"hz\":%lu,\"ehz\":%lu", (unsigned long)RTIMER_SECOND, (unsigned long)ENERGEST_SECOND);
+#else
+  len = snprintf(buf, size, "{\"hz\":%lu,\"ehz\":0", (unsigned long)RTIMER_SECOND);
+#endif
+  for(i = 0; i < n_profiles && len < size; i++) {
+    const mlp_prof_t *p = profiles[i];
+    len += snprintf(buf + len, size - len, ",\"%s\":{\"n\":%lu,\"tot\":", p->name, (unsigned long)p->total.count);
+    if(len < size) {
+      len += stat_json(&p->total, buf + len, size - len);
+    }
+    if(len < size) {
+      len += snprintf(buf + len, size - len, ",\"l\":[");
+    }
+    for(l = 0; l < p->n_layers && len < size; l++) {
+      if(l > 0) {
+        len += snprintf(buf + len, size - len, ",");
+      }
+      if(len < size) {
+        len += stat_json(&p->layer[l], buf + len, size - len);
+      }
+    }
+    if(len < size) {
+      len += snprintf(buf + len, size - len, "]}");
+    }
+  }
+  if(len < size) {
+    len += snprintf(buf + len, size - len, "}");
+  }
+  return len < size ? len : size - 1;
+}
+#endif /* MLP_PROF */
@@ -0,0 +1,80 @@
+/*
+ * Profilazione dell'inferenza sul nodo: tick rtimer e tempo CPU di Energest
+ * per ogni layer e per l'inferenza completa.
+ *
+ * Si abilita a tempo di compilazione con MLP_PROF_CONF_ENABLED: senza, le
+ * macro MLP_PROF_START/MLP_PROF_END non generano codice. Ogni statistica
+ * conserva min, max, somma e un istogramma logaritmico (4 bucket per
+ * ottava) da cui si ricava il p99 come estremo superiore del bucket,
+ * con un errore massimo del 25%.
+ * I profili registrati con mlp_prof_register() sono serviti da /res_prof
+ * (ml/res_prof.c).
+ */
+#ifndef MLP_PROF_H_
+#define MLP_PROF_H_
+
+#ifdef CONTIKI
+#include "contiki.h"
+#endif
+#include <stdint.h>
+
+#ifdef MLP_PROF_CONF_ENABLED
+#define MLP_PROF MLP_PROF_CONF_ENABLED
+#else
+#define MLP_PROF 0
+#endif
+
+#ifdef MLP_PROF_CONF_MAX_LAYERS
+#define MLP_PROF_MAX_LAYERS MLP_PROF_CONF_MAX_LAYERS
+#else
+#define MLP_PROF_MAX_LAYERS 8
+#endif
+
+#define MLP_PROF_SUB_BITS 2  /* 4 bucket per ottava */
+#define MLP_PROF_BUCKETS 60  /* fino a 2^16 tick */
+#define MLP_PROF_MAX_PROFILES 2
+
+typedef struct mlp_prof_stat {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint32_t sum;          /* tick rtimer */
+  uint32_t cpu_sum;      /* tick Energest in ENERGEST_TYPE_CPU */
+  uint16_t hist[MLP_PROF_BUCKETS];
+} mlp_prof_stat_t;
+
+typedef struct mlp_prof {
+  const char *name;
+  uint8_t n_layers;      /* layer piu' profondo visto */
+  mlp_prof_stat_t layer[MLP_PROF_MAX_LAYERS];
+  mlp_prof_stat_t total; /* somma dei layer di un'inferenza (senza le attese tra le slice) */
+  /* Inferenza in corso */
+  uint32_t t0, cpu0;
+  uint32_t run, run_cpu;
+} mlp_prof_t;
+
+void mlp_prof_register(mlp_prof_t *p, const char *name);
+
+/* Prima e dopo ogni layer eseguito; con more <= 0 l'inferenza e' conclusa */
+void mlp_prof_step_start(mlp_prof_t *p);
+void mlp_prof_step_end(mlp_prof_t *p, uint8_t layer, int32_t more);
+
+/* Valore sotto cui cade la percentuale pct dei campioni */
+uint32_t mlp_prof_percentile(const mlp_prof_stat_t *s, uint8_t pct);
+
+/* Profili registrati, per /res_prof */
+uint8_t mlp_prof_count(void);
+const mlp_prof_t *mlp_prof_get(uint8_t i);
+
+/* JSON di tutti i profili registrati, ritorna la lunghezza scritta */
+int mlp_prof_json(char *buf, int size);
+
+#if MLP_PROF
+#define MLP_PROF_START(p) mlp_prof_step_start(p)
+#define MLP_PROF_END(p, layer, more) mlp_prof_step_end((p), (layer), (more))
+#else
+#define MLP_PROF_START(p)
+#define MLP_PROF_END(p, layer, more)
+#endif
+
+#endif /* MLP_PROF_H_ */
@@ -0,0 +1,110 @@
+#include "mlp_q8.h"
+#include "mlp_backend.h"
+#include <math.h>
+
+void
+mlp_q8_quantize_input(const mlp_q8_net_t *net, const float *features, int8_t *buf)
+{
+  uint8_t j;
+  for(j = 0; j < net->n_inputs; j++) {
+    float v = features[j] * net->input_inv_scale[j];
+    int32_t q = (int32_t)(v >= 0 ? v + 0.5f : v - 0.5f);
+    if(q > MLP_Q8_MAX) q = MLP_Q8_MAX;
+    if(q < -MLP_Q8_MAX) q = -MLP_Q8_MAX;
+    buf[j] = (int8_t)q;
+  }
+}
+
+void
+mlp_q8_layer_forward(const mlp_q8_layer_t *layer, const int8_t *in, int8_t *out)
+{
+  mlp_backend_dense_q8(layer, in, out);
+}
+
+// Quantizza l'ingresso ed esegue i layer nascosti, ritorna le attivazioni dell'ultimo
+static const int8_t *
+forward_hidden(const mlp_q8_net_t *net, const float *features)
+{
+  int8_t *in = net->buf1, *out = net->buf2, *tmp;
+  uint8_t l;
+
+  mlp_q8_quantize_input(net, features, in);
+
+  for(l = 0; l < net->n_layers - 1; l++) {
+    mlp_q8_layer_forward(&net->layers[l], in, out);
+    tmp = in; in = out; out = tmp;
+  }
+  return in;
+}
+
+// Layer lineare di uscita: tutte le uscite condividono la scala dell'accumulatore
+static void
+output_layer(const mlp_q8_net_t *net, const int8_t *in, float *out)
+{
+  const mlp_q8_layer_t *last = &net->layers[net->n_layers - 1];
+  const int8_t *w = last->weights;
+  uint16_t o;
+
+  for(o = 0; o < last->n_outputs; o++, w += last->n_inputs) {
+    out[o] = (float)mlp_backend_dot_q8(w, in, last->n_inputs, last->biases[o]) * net->output_scale;
+  }
+}
+
+float
+mlp_q8_regress1(const mlp_q8_net_t *net, const float *features, int32_t n_features)
+{
+  const mlp_q8_layer_t *last = &net->layers[net->n_layers - 1];
+  const int8_t *in;
+
+  if(n_features != net->n_inputs || net->n_inputs > net->buf_length ||
+     last->n_outputs != 1 || last->multiplier != 0) {
+    return NAN;
+  }
+
+  in = forward_hidden(net, features);
+
+  // Layer di uscita lineare: unica moltiplicazione float dell'inferenza
+  return (float)mlp_backend_dot_q8(last->weights, in, last->n_inputs, last->biases[0]) * net->output_scale;
+}
+
+int32_t
+mlp_q8_regress(const mlp_q8_net_t *net, const float *features, int32_t n_features,
+               float *out, int32_t out_length)
+{
+  const mlp_q8_layer_t *last = &net->layers[net->n_layers - 1];
+
+  if(n_features != net->n_inputs || net->n_inputs > net->buf_length ||
+     out_length < last->n_outputs || last->multiplier != 0) {
+    return -1;
+  }
+
+  output_layer(net, forward_hidden(net, features), out);
+  return 0;
+}
+
+int32_t
+mlp_q8_step(const mlp_q8_net_t *net, uint8_t layer, const float *features, int32_t n_features,
+            float *out, int32_t out_length)
+{
+  const mlp_q8_layer_t *last = &net->layers[net->n_layers - 1];
+  // Stessa alternanza dei buffer di forward_hidden(): il layer l legge buf1 se l e' pari
+  int8_t *in = layer % 2 ? net->buf2 : net->buf1;
+  int8_t *next = layer % 2 ? net->buf1 : net->buf2;
+
+  if(layer == 0) {
+    if(n_features != net->n_inputs || net->n_inputs > net->buf_length ||
+       out_length < last->n_outputs || last->multiplier != 0) {
+      return -1;
+    }
+    mlp_q8_quantize_input(net, features, in);
+  } else if(layer >= net->n_layers) {
+    return -1;
+  }
+
+  if(layer < net->n_layers - 1) {
+    mlp_q8_layer_forward(&net->layers[layer], in, next);
+    return 1;
+  }
+  output_layer(net, in, out);
+  return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * Motore di inferenza int8 per le MLP di previsione (next_power, next_solar).
+ *
+ * Alternativa a eml_net_regress1(): pesi int8 con scala per layer,
+ * accumulatori int32 e riquantizzazione in virgola fissa tra i layer.
+ * I modelli vengono generati dagli header emlearn con tools/eml_quantize.py.
+ */
+#ifndef MLP_Q8_H_
+#define MLP_Q8_H_
+
+#include <stdint.h>
+
+#define MLP_Q8_ACT_IDENTITY 0
+#define MLP_Q8_ACT_RELU     1
+
+typedef struct mlp_q8_layer {
+  uint16_t n_outputs;
+  uint16_t n_inputs;
+  const int8_t *weights;   /* [n_outputs][n_inputs], righe contigue */
+  const int32_t *biases;   /* in scala peso * ingresso */
+  int32_t multiplier;      /* riquantizzazione Q31, 0 per il layer di uscita */
+  int8_t shift;            /* shift a destra aggiuntivo dopo il Q31 */
+  uint8_t activation;
+} mlp_q8_layer_t;
+
+typedef struct mlp_q8_net {
+  uint8_t n_layers;
+  const mlp_q8_layer_t *layers;
+  uint8_t n_inputs;
+  const float *input_inv_scale;  /* 1/scala di ogni feature di ingresso */
+  float output_scale;            /* da accumulatore di uscita a valore reale */
+  int8_t *buf1;
+  int8_t *buf2;
+  int32_t buf_length;
+} mlp_q8_net_t;
+
+#define MLP_Q8_MAX 127
+
+/* Riquantizza l'accumulatore di un'uscita e applica l'attivazione */
+static inline int8_t
+mlp_q8_output(const mlp_q8_layer_t *layer, int32_t acc)
+{
+  int rs = 31 + layer->shift;
+  int64_t prod = (int64_t)acc * layer->multiplier;
+  int32_t q = (int32_t)((prod + ((int64_t)1 << (rs - 1))) >> rs);
+  int32_t lo = layer->activation == MLP_Q8_ACT_RELU ? 0 : -MLP_Q8_MAX;
+
+  if(q > MLP_Q8_MAX) q = MLP_Q8_MAX;
+  if(q < lo) q = lo;
+  return (int8_t)q;
+}
+
+/* Quantizza le feature float di ingresso in buf (n_inputs valori int8) */
+void mlp_q8_quantize_input(const mlp_q8_net_t *net, const float *features, int8_t *buf);
+
+/* Esegue un layer nascosto con il backend compilato (ml/mlp_backend.h) */
+void mlp_q8_layer_forward(const mlp_q8_layer_t *layer, const int8_t *in, int8_t *out);
+
+/* Inferenza completa, ritorna NAN se la rete non e' compatibile con l'ingresso */
+float mlp_q8_regress1(const mlp_q8_net_t *net, const float *features, int32_t n_features);
+
+/* Inferenza con piu' uscite (es. previsione a 24 ore), ritorna 0 oppure -1 */
+int32_t mlp_q8_regress(const mlp_q8_net_t *net, const float *features, int32_t n_features,
+                       float *out, int32_t out_length);
+
+/* Inferenza a passi, un layer per chiamata con layer = 0, 1, ... n_layers - 1:
+ * permette di cedere la CPU tra un layer e l'altro. Ritorna 1 se restano layer,
+ * 0 quando out contiene il risultato, -1 se la rete non e' compatibile.
+ * Lo stato intermedio resta in buf1/buf2 della rete: un'inferenza alla volta. */
+int32_t mlp_q8_step(const mlp_q8_net_t *net, uint8_t layer, const float *features, int32_t n_features,
+                    float *out, int32_t out_length);
+
+#endif /* MLP_Q8_H_ */
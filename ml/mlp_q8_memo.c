@@ -0,0 +1,185 @@
+#include "mlp_q8_memo.h"
+#include "mlp_backend.h"
+#include <string.h>
+#include <math.h>
+
+#ifdef CONTIKI
+#include "sys/rtimer.h"
+#define MLP_Q8_MEMO_NOW() ((uint32_t)RTIMER_NOW())
+#else
+// Build su host: microsecondi da clock monotono
+static uint32_t
+host_now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+#define MLP_Q8_MEMO_NOW() host_now()
+#endif
+
+static uint32_t
+net_macs(const mlp_q8_net_t *net)
+{
+  uint32_t macs = 0;
+  uint8_t l;
+  for(l = 0; l < net->n_layers; l++) {
+    macs += (uint32_t)net->layers[l].n_inputs * net->layers[l].n_outputs;
+  }
+  return macs;
+}
+
+static void
+account_saved(mlp_q8_memo_t *memo, uint32_t elapsed)
+{
+  if(memo->stats.run_ticks > elapsed) {
+    memo->stats.ticks_saved += memo->stats.run_ticks - elapsed;
+  }
+}
+
+void
+mlp_q8_memo_invalidate(mlp_q8_memo_t *memo)
+{
+  memo->valid = 0;
+  memo->pending = 0;
+}
+
+static uint8_t
+fits(const mlp_q8_net_t *net)
+{
+  return net->n_inputs <= MLP_Q8_MEMO_MAX_INPUTS && net->n_layers >= 2 &&
+         net->layers[0].n_outputs <= MLP_Q8_MEMO_MAX_WIDTH;
+}
+
+// Layer 0 con memoizzazione, ritorna 0 se il risultato precedente resta valido
+static int32_t
+first_layer(const mlp_q8_net_t *net, mlp_q8_memo_t *memo, const float *features)
+{
+  const mlp_q8_layer_t *first = &net->layers[0];
+  int8_t q[MLP_Q8_MEMO_MAX_INPUTS];
+  uint8_t j, changed = 0, same_l0;
+  uint16_t o;
+
+  memo->stats.calls++;
+  mlp_q8_quantize_input(net, features, q);
+
+  if(memo->valid) {
+    for(j = 0; j < net->n_inputs; j++) {
+      changed += q[j] != memo->input[j];
+    }
+    // Con un'inferenza precedente interrotta il risultato memorizzato non e' valido
+    if(changed == 0 && !memo->pending) {
+      memo->stats.hits++;
+      memo->stats.macs_saved += net_macs(net);
+      return 0;
+    }
+  }
+
+  memo->incremental = memo->valid && changed < net->n_inputs;
+  if(memo->incremental) {
+    // Solo le feature cambiate: acc0[o] += w[o][j] * delta_j
+    for(j = 0; j < net->n_inputs; j++) {
+      int32_t delta = (int32_t)q[j] - memo->input[j];
+      const int8_t *w = first->weights + j;
+      if(delta == 0) {
+        continue;
+      }
+      for(o = 0; o < first->n_outputs; o++, w += first->n_inputs) {
+        memo->acc0[o] += (int32_t)*w * delta;
+      }
+    }
+    memo->stats.incremental++;
+    memo->stats.macs_saved += (uint32_t)(net->n_inputs - changed) * first->n_outputs;
+  } else {
+    for(o = 0; o < first->n_outputs; o++) {
+      memo->acc0[o] = mlp_backend_dot_q8(first->weights + o * first->n_inputs, q,
+                                         first->n_inputs, first->biases[o]);
+    }
+  }
+  memcpy(memo->input, q, net->n_inputs);
+
+  same_l0 = memo->valid && !memo->pending;
+  for(o = 0; o < first->n_outputs; o++) {
+    int8_t a = mlp_q8_output(first, memo->acc0[o]);
+    if(a != memo->out0[o]) {
+      same_l0 = 0;
+      memo->out0[o] = a;
+    }
+  }
+
+  // Da qui acc0 e out0 corrispondono a input, il risultato arriva con l'ultimo layer
+  memo->valid = 1;
+  if(same_l0) {
+    // Il resto della rete vede gli stessi ingressi
+    memo->stats.l0_hits++;
+    memo->stats.macs_saved += net_macs(net) - (uint32_t)first->n_inputs * first->n_outputs;
+    return 0;
+  }
+  memo->pending = 1;
+  return 1;
+}
+
+int32_t
+mlp_q8_memo_step(const mlp_q8_net_t *net, mlp_q8_memo_t *memo, uint8_t layer,
+                 const float *features, int32_t n_features, float *out, int32_t out_length)
+{
+  const mlp_q8_layer_t *last = &net->layers[net->n_layers - 1];
+  uint32_t start = MLP_Q8_MEMO_NOW();
+  // Il layer 1 legge out0 dal contesto, poi buf1/buf2 si alternano
+  int8_t *in = layer == 1 ? memo->out0 : (layer % 2 ? net->buf2 : net->buf1);
+  int8_t *next = layer % 2 ? net->buf1 : net->buf2;
+  int32_t more = 1;
+
+  // Rete oltre le dimensioni del contesto (es. blob caricato a caldo): passi senza memo
+  if(!fits(net)) {
+    return mlp_q8_step(net, layer, features, n_features, out, out_length);
+  }
+  if(layer == 0) {
+    if(n_features != net->n_inputs || out_length < 1 || last->n_outputs != 1 ||
+       last->multiplier != 0 || net->layers[0].n_outputs > net->buf_length) {
+      return -1;
+    }
+    memo->busy = 0;
+    more = first_layer(net, memo, features);
+    if(!more) {
+      account_saved(memo, MLP_Q8_MEMO_NOW() - start);
+      out[0] = memo->result;
+    }
+  } else if(layer < net->n_layers - 1) {
+    mlp_q8_layer_forward(&net->layers[layer], in, next);
+  } else if(layer == net->n_layers - 1 && memo->pending) {
+    memo->result = (float)mlp_backend_dot_q8(last->weights, in, last->n_inputs, last->biases[0]) * net->output_scale;
+    memo->pending = 0;
+    out[0] = memo->result;
+    more = 0;
+  } else {
+    return -1;
+  }
+
+  memo->busy += MLP_Q8_MEMO_NOW() - start;
+  if(layer > 0 && !more) {
+    if(!memo->incremental) {
+      memo->stats.full++;
+    }
+    // Media mobile (1/4) del tempo di calcolo di un'inferenza, riferimento per i risparmi
+    memo->stats.run_ticks = memo->stats.run_ticks ? (3 * memo->stats.run_ticks + memo->busy) / 4 : memo->busy;
+  }
+  return more;
+}
+
+float
+mlp_q8_memo_regress1(const mlp_q8_net_t *net, mlp_q8_memo_t *memo,
+                     const float *features, int32_t n_features)
+{
+  uint8_t layer = 0;
+  int32_t more;
+  float result;
+
+  if(!fits(net)) {
+    return mlp_q8_regress1(net, features, n_features);
+  }
+  do {
+    more = mlp_q8_memo_step(net, memo, layer++, features, n_features, &result, 1);
+  } while(more > 0);
+  return more == 0 ? result : NAN;
+}
@@ -0,0 +1,101 @@
+/*
+ * Inferenza int8 con memoizzazione per ingressi che cambiano lentamente.
+ *
+ * mese e ora cambiano al massimo una volta all'ora, temperatura e umidita'
+ * di pochi gradi tra un campione e l'altro. Il contesto conserva l'ultimo
+ * ingresso quantizzato, gli accumulatori del layer 0 e la sua uscita:
+ *  - ingresso quantizzato identico: ritorna il risultato precedente;
+ *  - solo alcune feature cambiate: il layer 0 somma soltanto il delta
+ *    w[o][j] * (x_nuovo[j] - x_vecchio[j]) delle feature cambiate;
+ *  - uscita del layer 0 identica dopo la riquantizzazione: il resto della
+ *    rete non cambia e ritorna il risultato precedente.
+ * Gli accumulatori sono interi, quindi il risultato coincide sempre con
+ * quello di mlp_q8_regress1().
+ */
+#ifndef MLP_Q8_MEMO_H_
+#define MLP_Q8_MEMO_H_
+
+#ifdef CONTIKI
+#include "contiki.h"
+#endif
+#include "mlp_q8.h"
+
+#ifdef MLP_Q8_CONF_MEMO
+#define MLP_Q8_MEMO MLP_Q8_CONF_MEMO
+#else
+#define MLP_Q8_MEMO 1
+#endif
+
+/* Dimensioni massime del contesto: feature di ingresso e uscite del layer 0 */
+#ifdef MLP_Q8_MEMO_CONF_MAX_INPUTS
+#define MLP_Q8_MEMO_MAX_INPUTS MLP_Q8_MEMO_CONF_MAX_INPUTS
+#else
+#define MLP_Q8_MEMO_MAX_INPUTS 8
+#endif
+#ifdef MLP_Q8_MEMO_CONF_MAX_WIDTH
+#define MLP_Q8_MEMO_MAX_WIDTH MLP_Q8_MEMO_CONF_MAX_WIDTH
+#else
+#define MLP_Q8_MEMO_MAX_WIDTH 64
+#endif
+
+typedef struct mlp_q8_memo_stats {
+  uint32_t calls;
+  uint32_t hits;         /* ingresso quantizzato identico */
+  uint32_t l0_hits;      /* uscita del layer 0 identica */
+  uint32_t incremental;  /* layer 0 aggiornato col delta delle feature cambiate */
+  uint32_t full;         /* ricalcolo completo */
+  uint64_t macs_saved;   /* a 64 bit come ticks_saved: cumulativi per la vita del nodo */
+  uint32_t run_ticks;    /* tempo di calcolo medio delle inferenze calcolate */
+  uint64_t ticks_saved;  /* somma di (run_ticks - durata) sulle chiamate evitate */
+} mlp_q8_memo_stats_t;
+
+typedef struct mlp_q8_memo {
+  uint8_t valid;         /* input, acc0 e out0 coerenti tra loro */
+  uint8_t pending;       /* inferenza a passi in corso, result non aggiornato */
+  uint8_t incremental;
+  uint32_t busy;         /* tempo di calcolo dell'inferenza in corso */
+  int8_t input[MLP_Q8_MEMO_MAX_INPUTS];
+  int32_t acc0[MLP_Q8_MEMO_MAX_WIDTH];
+  int8_t out0[MLP_Q8_MEMO_MAX_WIDTH];
+  float result;
+  mlp_q8_memo_stats_t stats;
+} mlp_q8_memo_t;
+
+/* Tick per secondo dei contatori di tempo (rtimer sui nodi) */
+#ifdef CONTIKI
+#define MLP_Q8_MEMO_TICKS_PER_SECOND RTIMER_SECOND
+#else
+#include <time.h>
+#define MLP_Q8_MEMO_TICKS_PER_SECOND 1000000
+#endif
+
+/* Percentuale di chiamate servite dal risultato memorizzato */
+static inline uint32_t
+mlp_q8_memo_hit_rate(const mlp_q8_memo_stats_t *s)
+{
+  return s->calls ? (uint32_t)(((uint64_t)s->hits + s->l0_hits) * 100 / s->calls) : 0;
+}
+
+/* Tempo risparmiato in millisecondi */
+static inline uint64_t
+mlp_q8_memo_ms_saved(const mlp_q8_memo_stats_t *s)
+{
+  return s->ticks_saved / MLP_Q8_MEMO_TICKS_PER_SECOND * 1000 +
+         s->ticks_saved % MLP_Q8_MEMO_TICKS_PER_SECOND * 1000 / MLP_Q8_MEMO_TICKS_PER_SECOND;
+}
+
+/* Come mlp_q8_regress1(), riusando il contesto della chiamata precedente.
+ * Un contesto a zero (variabile statica) e' valido e parte da un ricalcolo
+ * completo. Reti piu' grandi del contesto vengono calcolate per intero. */
+float mlp_q8_memo_regress1(const mlp_q8_net_t *net, mlp_q8_memo_t *memo,
+                           const float *features, int32_t n_features);
+
+/* Come mlp_q8_step(), con il contesto: il layer 0 puo' gia' concludere
+ * l'inferenza (ritorna 0) se il risultato memorizzato resta valido */
+int32_t mlp_q8_memo_step(const mlp_q8_net_t *net, mlp_q8_memo_t *memo, uint8_t layer,
+                         const float *features, int32_t n_features, float *out, int32_t out_length);
+
+/* Invalida il contesto (es. dopo il cambio del modello), mantiene i contatori */
+void mlp_q8_memo_invalidate(mlp_q8_memo_t *memo);
+
+#endif /* MLP_Q8_MEMO_H_ */
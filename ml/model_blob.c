@@ -0,0 +1,109 @@
+#include "model_blob.h"
+#include <string.h>
+
+#ifdef CONTIKI
+#include "contiki.h"
+#include "lib/crc16.h"
+#endif
+
+#define ALIGN4(n) (((n) + 3) & ~(uint32_t)3)
+
+uint16_t
+model_blob_crc(uint16_t acc, const uint8_t *data, uint32_t len)
+{
+#ifdef CONTIKI
+  return crc16_data(data, (int)len, acc);
+#else
+  // Build su host: stesso algoritmo di crc16_add() di Contiki
+  while(len--) {
+    acc ^= *data++;
+    acc = (uint16_t)((acc >> 8) | (acc << 8));
+    acc ^= (uint16_t)((acc & 0xff00) << 4);
+    acc ^= (uint16_t)((acc >> 8) >> 4);
+    acc ^= (uint16_t)((acc & 0xff00) >> 5);
+  }
+  return acc;
+#endif
+}
+
+int
+model_blob_check_header(const model_blob_header_t *h, uint8_t n_inputs, uint8_t n_outputs,
+                        uint32_t max_size, uint16_t max_width)
+{
+  if(h->magic != MODEL_BLOB_MAGIC || h->format != MODEL_BLOB_FORMAT ||
+     h->dtype != MODEL_BLOB_DTYPE_Q8 || h->n_layers == 0) {
+    return MODEL_BLOB_ERR_HEADER;
+  }
+  if(h->n_inputs != n_inputs || h->n_outputs != n_outputs) {
+    return MODEL_BLOB_ERR_SHAPE;
+  }
+  if(h->length > max_size - sizeof(*h) || h->buf_length > max_width) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  return MODEL_BLOB_OK;
+}
+
+int
+model_blob_bind_q8(const uint8_t *blob, uint32_t size, mlp_q8_net_t *net,
+                   mlp_q8_layer_t *layers, uint8_t max_layers)
+{
+  const model_blob_header_t *h = (const model_blob_header_t *)blob;
+  const model_blob_layer_t *desc;
+  uint32_t pos;
+  uint16_t prev;
+  uint8_t l;
+
+  if(size < sizeof(*h) || h->length != size - sizeof(*h)) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  if(h->magic != MODEL_BLOB_MAGIC || h->format != MODEL_BLOB_FORMAT ||
+     h->dtype != MODEL_BLOB_DTYPE_Q8 || h->n_layers == 0) {
+    return MODEL_BLOB_ERR_HEADER;
+  }
+  if(h->n_layers > max_layers) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  if(model_blob_crc(0, blob + MODEL_BLOB_CRC_OFFSET, size - MODEL_BLOB_CRC_OFFSET) != h->crc) {
+    return MODEL_BLOB_ERR_CRC;
+  }
+
+  // Descrittori dei layer e scale di ingresso
+  desc = (const model_blob_layer_t *)(blob + sizeof(*h));
+  pos = sizeof(*h) + (uint32_t)h->n_layers * sizeof(*desc);
+  net->input_inv_scale = (const float *)(blob + pos);
+  pos += (uint32_t)h->n_inputs * sizeof(float);
+  if(pos > size) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+
+  // Bias e pesi di ogni layer, con controllo della catena di dimensioni
+  prev = h->n_inputs;
+  for(l = 0; l < h->n_layers; l++) {
+    if(desc[l].n_inputs != prev || desc[l].n_outputs > h->buf_length || desc[l].n_inputs > h->buf_length) {
+      return MODEL_BLOB_ERR_SHAPE;
+    }
+    layers[l].n_outputs = desc[l].n_outputs;
+    layers[l].n_inputs = desc[l].n_inputs;
+    layers[l].multiplier = desc[l].multiplier;
+    layers[l].shift = desc[l].shift;
+    layers[l].activation = desc[l].activation;
+    layers[l].biases = (const int32_t *)(blob + pos);
+    pos += (uint32_t)desc[l].n_outputs * sizeof(int32_t);
+    layers[l].weights = (const int8_t *)(blob + pos);
+    pos += ALIGN4((uint32_t)desc[l].n_outputs * desc[l].n_inputs);
+    if(pos > size) {
+      return MODEL_BLOB_ERR_SIZE;
+    }
+    prev = desc[l].n_outputs;
+  }
+  if(pos != size || prev != h->n_outputs || desc[h->n_layers - 1].multiplier != 0) {
+    return MODEL_BLOB_ERR_SHAPE;
+  }
+
+  net->n_layers = h->n_layers;
+  net->layers = layers;
+  net->n_inputs = h->n_inputs;
+  net->output_scale = h->output_scale;
+  net->buf_length = h->buf_length;
+  return MODEL_BLOB_OK;
+}
@@ -0,0 +1,71 @@
+/*
+ * Formato binario dei modelli int8 aggiornabili senza riflashare il nodo.
+ *
+ * Il blob e' generato da tools/model_blob.py e contiene, little-endian e
+ * allineati a 4 byte:
+ *   model_blob_header_t
+ *   model_blob_layer_t            x n_layers
+ *   float input_inv_scale         x n_inputs
+ *   per ogni layer: int32 biases  x n_outputs
+ *                   int8 weights  x n_outputs * n_inputs (padding a 4 byte)
+ *
+ * model_blob_bind_q8() costruisce un mlp_q8_net_t che punta direttamente ai
+ * pesi e ai bias del blob: nessuna copia ne' conversione.
+ */
+#ifndef MODEL_BLOB_H_
+#define MODEL_BLOB_H_
+
+#include <stdint.h>
+#include "mlp_q8.h"
+
+#define MODEL_BLOB_MAGIC    0x314c444dUL /* "MDL1" */
+#define MODEL_BLOB_FORMAT   1
+#define MODEL_BLOB_DTYPE_Q8 1            /* pesi int8, accumulatori int32 (ml/mlp_q8.c) */
+
+typedef struct model_blob_header {
+  uint32_t magic;
+  uint16_t format;
+  uint16_t crc;           /* crc16 dei byte da version alla fine del blob */
+  uint32_t version;       /* versione del modello, cresce a ogni rilascio */
+  uint32_t length;        /* byte che seguono l'header */
+  uint8_t dtype;
+  uint8_t n_layers;
+  uint8_t n_inputs;
+  uint8_t n_outputs;
+  uint16_t buf_length;    /* larghezza massima dei layer */
+  uint16_t reserved;
+  float output_scale;     /* da accumulatore di uscita a valore reale */
+} model_blob_header_t;
+
+typedef struct model_blob_layer {
+  uint16_t n_outputs;
+  uint16_t n_inputs;
+  int32_t multiplier;     /* riquantizzazione Q31, 0 per il layer di uscita */
+  int8_t shift;
+  uint8_t activation;
+  uint16_t reserved;
+} model_blob_layer_t;
+
+#define MODEL_BLOB_CRC_OFFSET 8 /* il crc copre il blob a partire da version */
+
+#define MODEL_BLOB_OK          0
+#define MODEL_BLOB_ERR_HEADER -1 /* magic, formato o dtype non riconosciuti */
+#define MODEL_BLOB_ERR_SHAPE  -2 /* ingressi/uscite diversi da quelli attesi dal nodo */
+#define MODEL_BLOB_ERR_SIZE   -3 /* lunghezza incoerente o oltre lo spazio disponibile */
+#define MODEL_BLOB_ERR_CRC    -4
+
+/* Aggiorna il crc16 (lo stesso di os/lib/crc16.c) con len byte */
+uint16_t model_blob_crc(uint16_t acc, const uint8_t *data, uint32_t len);
+
+/* Controlla l'header: modello atteso con n_inputs ingressi e n_outputs uscite,
+ * lunghezza totale entro max_size byte e larghezza entro max_width */
+int model_blob_check_header(const model_blob_header_t *h, uint8_t n_inputs, uint8_t n_outputs,
+                            uint32_t max_size, uint16_t max_width);
+
+/* Verifica il blob completo (header, sezioni e crc) e collega net ai suoi
+ * pesi. layers deve avere spazio per max_layers descrittori; buf1/buf2 di
+ * net restano a carico del chiamante */
+int model_blob_bind_q8(const uint8_t *blob, uint32_t size, mlp_q8_net_t *net,
+                       mlp_q8_layer_t *layers, uint8_t max_layers);
+
+#endif /* MODEL_BLOB_H_ */
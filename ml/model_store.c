@@ -0,0 +1,270 @@
+#include "model_store.h"
+
+#if MODEL_STORE
+#include "contiki.h"
+#include "model_blob.h"
+#include "cfs/cfs.h"
+#include "cfs/cfs-coffee.h"
+#include "sys/log.h"
+#include <string.h>
+
+#define LOG_MODULE "ModelStore"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+#define VERIFY_CHUNK 32
+
+static const char *slot_name[] = {"", "mdl_a", "mdl_b"};
+
+static uint32_t arena[MODEL_STORE_SIZE / sizeof(uint32_t)]; // blob attivo, allineato a 4 byte
+static mlp_q8_layer_t blob_layers[MODEL_STORE_MAX_LAYERS];
+static int8_t blob_buf1[MODEL_STORE_MAX_WIDTH];
+static int8_t blob_buf2[MODEL_STORE_MAX_WIDTH];
+static mlp_q8_net_t blob_net = { 0, blob_layers, 0, NULL, 0.0f, blob_buf1, blob_buf2, 0 };
+
+static model_store_info_t info;
+static uint8_t expected_inputs, expected_outputs;
+static uint8_t upload_slot;
+static int upload_fd = -1;
+static uint32_t done_offset, done_size; // ultimo blocco dell'upload completato
+
+// Controlla header, lunghezza e crc di uno slot leggendolo a blocchi
+static int
+verify_slot(uint8_t slot, model_blob_header_t *h)
+{
+  uint8_t chunk[VERIFY_CHUNK];
+  uint32_t left;
+  uint16_t crc;
+  int fd, n, r;
+
+  fd = cfs_open(slot_name[slot], CFS_READ);
+  if(fd < 0) {
+    return MODEL_STORE_ERR_IO;
+  }
+  if(cfs_read(fd, h, sizeof(*h)) != sizeof(*h)) {
+    cfs_close(fd);
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  r = model_blob_check_header(h, expected_inputs, expected_outputs, MODEL_STORE_SIZE, MODEL_STORE_MAX_WIDTH);
+  if(r != MODEL_BLOB_OK) {
+    cfs_close(fd);
+    return r;
+  }
+
+  crc = model_blob_crc(0, (const uint8_t *)h + MODEL_BLOB_CRC_OFFSET, sizeof(*h) - MODEL_BLOB_CRC_OFFSET);
+  for(left = h->length; left > 0; left -= n) {
+    n = cfs_read(fd, chunk, left < VERIFY_CHUNK ? left : VERIFY_CHUNK);
+    if(n <= 0) {
+      cfs_close(fd);
+      return MODEL_BLOB_ERR_SIZE;
+    }
+    crc = model_blob_crc(crc, chunk, n);
+  }
+  // Byte in piu' oltre la lunghezza dichiarata: blob non valido
+  n = cfs_read(fd, chunk, 1);
+  cfs_close(fd);
+  if(n > 0) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  return crc == h->crc ? MODEL_BLOB_OK : MODEL_BLOB_ERR_CRC;
+}
+
+// Legge lo slot nell'area statica e collega blob_net ai suoi pesi
+static int
+load_slot(uint8_t slot)
+{
+  const model_blob_header_t *h = (const model_blob_header_t *)arena;
+  int fd, n, r;
+
+  fd = cfs_open(slot_name[slot], CFS_READ);
+  if(fd < 0) {
+    return MODEL_STORE_ERR_IO;
+  }
+  n = cfs_read(fd, arena, sizeof(arena));
+  cfs_close(fd);
+  if(n <= 0) {
+    return MODEL_STORE_ERR_IO;
+  }
+
+  r = model_blob_bind_q8((const uint8_t *)arena, (uint32_t)n, &blob_net, blob_layers, MODEL_STORE_MAX_LAYERS);
+  if(r != MODEL_BLOB_OK || h->n_inputs != expected_inputs || h->n_outputs != expected_outputs) {
+    return r != MODEL_BLOB_OK ? r : MODEL_BLOB_ERR_SHAPE;
+  }
+  info.slot = slot;
+  info.version = h->version;
+  info.crc = h->crc;
+  return MODEL_STORE_OK;
+}
+
+static void
+fail(int r)
+{
+  info.errors++;
+  info.last_error = r;
+}
+
+void
+model_store_init(uint8_t n_inputs, uint8_t n_outputs)
+{
+  model_blob_header_t h;
+  uint32_t best_version = 0;
+  uint8_t slot, best = 0;
+
+  expected_inputs = n_inputs;
+  expected_outputs = n_outputs;
+  memset(&info, 0, sizeof(info));
+
+  for(slot = 1; slot <= 2; slot++) {
+    if(verify_slot(slot, &h) == MODEL_BLOB_OK && h.version > best_version) {
+      best = slot;
+      best_version = h.version;
+    }
+  }
+  if(best != 0 && load_slot(best) == MODEL_STORE_OK) {
+    LOG_INFO("Modello v%lu caricato dallo slot %c\n", (unsigned long)info.version, 'A' + best - 1);
+  } else {
+    info.slot = 0;
+    LOG_INFO("Nessun modello valido in CFS, uso quello del firmware\n");
+  }
+}
+
+const mlp_q8_net_t *
+model_store_q8(const mlp_q8_net_t *builtin)
+{
+  return info.slot != 0 ? &blob_net : builtin;
+}
+
+static void
+abort_upload(int r)
+{
+  if(upload_fd >= 0) {
+    cfs_close(upload_fd);
+    upload_fd = -1;
+  }
+  cfs_remove(slot_name[upload_slot]);
+  done_size = 0;
+  fail(r);
+}
+
+int
+model_store_write(uint32_t offset, const uint8_t *data, uint16_t len, uint8_t more)
+{
+  model_blob_header_t h;
+  int r;
+
+  if(offset == 0) {
+    if(upload_fd >= 0) {
+      cfs_close(upload_fd);
+    }
+    // Sempre nello slot non attivo: il modello in uso resta intatto fino all'attivazione
+    upload_slot = info.slot == 1 ? 2 : 1;
+    if(info.pending == upload_slot) {
+      info.pending = 0;
+    }
+    info.received = 0;
+    done_size = 0;
+
+    // Header nel primo blocco: rifiuta subito un blob non compatibile
+    if(len >= sizeof(h)) {
+      memcpy(&h, data, sizeof(h));
+      r = model_blob_check_header(&h, expected_inputs, expected_outputs, MODEL_STORE_SIZE, MODEL_STORE_MAX_WIDTH);
+      if(r == MODEL_BLOB_OK && h.version <= info.version) {
+        r = MODEL_STORE_ERR_VERSION;
+      }
+      if(r != MODEL_BLOB_OK) {
+        fail(r);
+        return r;
+      }
+    }
+
+    cfs_remove(slot_name[upload_slot]);
+    cfs_coffee_reserve(slot_name[upload_slot], MODEL_STORE_SIZE);
+    upload_fd = cfs_open(slot_name[upload_slot], CFS_WRITE);
+    if(upload_fd < 0) {
+      fail(MODEL_STORE_ERR_IO);
+      return MODEL_STORE_ERR_IO;
+    }
+  } else if(upload_fd < 0) {
+    // Ultimo blocco ritrasmesso dopo la verifica (ACK perso): gia' accettato
+    if(!more && done_size != 0 && offset == done_offset && offset + len == done_size) {
+      return MODEL_STORE_OK;
+    }
+    return MODEL_STORE_ERR_SEQ;
+  } else if(offset + len == info.received) {
+    return MODEL_STORE_OK; // blocco ritrasmesso (ACK perso), gia' scritto
+  } else if(offset != info.received) {
+    return MODEL_STORE_ERR_SEQ;
+  }
+
+  if(info.received + len > MODEL_STORE_SIZE) {
+    abort_upload(MODEL_BLOB_ERR_SIZE);
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  if(cfs_write(upload_fd, data, len) != len) {
+    abort_upload(MODEL_STORE_ERR_IO);
+    return MODEL_STORE_ERR_IO;
+  }
+  info.received += len;
+  if(more) {
+    return MODEL_STORE_OK;
+  }
+
+  cfs_close(upload_fd);
+  upload_fd = -1;
+  r = verify_slot(upload_slot, &h);
+  if(r == MODEL_BLOB_OK && h.version <= info.version) {
+    r = MODEL_STORE_ERR_VERSION;
+  }
+  if(r != MODEL_BLOB_OK) {
+    abort_upload(r);
+    LOG_WARN("Upload modello scartato: errore %d\n", r);
+    return r;
+  }
+  info.pending = upload_slot;
+  info.pending_version = h.version;
+  done_offset = offset;
+  done_size = info.received;
+  LOG_INFO("Modello v%lu verificato nello slot %c, %lu byte\n",
+           (unsigned long)h.version, 'A' + upload_slot - 1, (unsigned long)info.received);
+  return MODEL_STORE_OK;
+}
+
+uint8_t
+model_store_swap_pending(void)
+{
+  return info.pending != 0;
+}
+
+int
+model_store_activate(void)
+{
+  uint8_t previous = info.slot;
+  uint8_t slot = info.pending;
+  int r;
+
+  if(slot == 0) {
+    return MODEL_STORE_OK;
+  }
+  info.pending = 0;
+  r = load_slot(slot);
+  if(r == MODEL_STORE_OK) {
+    info.swaps++;
+    LOG_INFO("Modello v%lu attivo dallo slot %c\n", (unsigned long)info.version, 'A' + slot - 1);
+    return r;
+  }
+
+  // L'area statica e' stata sovrascritta: ricarica il modello precedente
+  fail(r);
+  if(previous == 0 || load_slot(previous) != MODEL_STORE_OK) {
+    info.slot = 0;
+    info.version = 0;
+  }
+  LOG_WARN("Attivazione fallita (errore %d), resta la versione %lu\n", r, (unsigned long)info.version);
+  return r;
+}
+
+const model_store_info_t *
+model_store_info(void)
+{
+  return &info;
+}
+#endif /* MODEL_STORE */
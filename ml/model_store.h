@@ -0,0 +1,94 @@
+/*
+ * Modelli int8 aggiornabili a caldo: due slot A/B su CFS (Coffee) con i blob
+ * di ml/model_blob.h, ricevuti via CoAP block-wise da ml/res_model.c.
+ *
+ * Il blob arriva sempre nello slot non attivo e diventa candidato solo
+ * quando header, dimensioni e crc sono verificati: un trasferimento
+ * interrotto non tocca il modello in uso. Il nodo attiva il nuovo modello
+ * con model_store_activate() fuori da un'inferenza in corso; al riavvio
+ * viene caricato lo slot valido con la versione piu' alta e, senza slot
+ * validi, resta il modello compilato nel firmware.
+ *
+ * Coffee non e' mappato in memoria su tutte le piattaforme: all'attivazione
+ * lo slot viene letto una volta in un'area statica e i kernel int8 leggono
+ * pesi e bias direttamente dal blob, senza conversioni.
+ */
+#ifndef MODEL_STORE_H_
+#define MODEL_STORE_H_
+
+#include "prediction_engine.h"
+#include "mlp_q8.h"
+
+/* Si abilita con make MODEL_STORE=1 (aggiunge il modulo os/storage/cfs) */
+#ifdef MODEL_STORE_CONF_ENABLED
+#define MODEL_STORE MODEL_STORE_CONF_ENABLED
+#else
+#define MODEL_STORE 0
+#endif
+
+#if MODEL_STORE && PREDICTION_ENGINE != PREDICTION_ENGINE_Q8
+#error "MODEL_STORE richiede il motore int8 (PREDICTION_CONF_ENGINE 1)"
+#endif
+
+/* Dimensione massima di un blob (area statica e spazio riservato per slot) */
+#ifdef MODEL_STORE_CONF_SIZE
+#define MODEL_STORE_SIZE MODEL_STORE_CONF_SIZE
+#else
+#define MODEL_STORE_SIZE 24576
+#endif
+#ifdef MODEL_STORE_CONF_MAX_LAYERS
+#define MODEL_STORE_MAX_LAYERS MODEL_STORE_CONF_MAX_LAYERS
+#else
+#define MODEL_STORE_MAX_LAYERS 8
+#endif
+#ifdef MODEL_STORE_CONF_MAX_WIDTH
+#define MODEL_STORE_MAX_WIDTH MODEL_STORE_CONF_MAX_WIDTH
+#else
+#define MODEL_STORE_MAX_WIDTH 96
+#endif
+
+#define MODEL_STORE_OK           0
+#define MODEL_STORE_ERR_SEQ    -10 /* blocco fuori sequenza o senza blocco 0 */
+#define MODEL_STORE_ERR_IO     -11 /* errore di scrittura/lettura CFS */
+#define MODEL_STORE_ERR_VERSION -12 /* versione non successiva a quella attiva */
+
+typedef struct model_store_info {
+  uint32_t version;      /* versione attiva, 0 = modello compilato */
+  uint16_t crc;
+  uint8_t slot;          /* 0 = nessuno, 1 = A, 2 = B */
+  uint8_t pending;       /* slot verificato in attesa di attivazione */
+  uint32_t pending_version;
+  uint32_t received;     /* byte ricevuti dell'upload in corso */
+  uint16_t swaps;
+  uint16_t errors;
+  int16_t last_error;
+} model_store_info_t;
+
+/* Verifica gli slot e carica quello valido con la versione piu' alta.
+ * n_inputs/n_outputs sono quelli del modello usato dal nodo */
+void model_store_init(uint8_t n_inputs, uint8_t n_outputs);
+
+/* Rete da usare per l'inferenza: quella del blob attivo, altrimenti builtin */
+const mlp_q8_net_t *model_store_q8(const mlp_q8_net_t *builtin);
+
+/* Scrive un blocco dell'upload nello slot non attivo (offset crescenti dal
+ * blocco 0). Con more = 0 chiude e verifica lo slot: se valido diventa
+ * in attesa di attivazione */
+int model_store_write(uint32_t offset, const uint8_t *data, uint16_t len, uint8_t more);
+
+/* 1 se uno slot verificato aspetta model_store_activate() */
+uint8_t model_store_swap_pending(void);
+
+/* Carica lo slot in attesa; va chiamata quando nessuna inferenza e' in corso.
+ * Se il caricamento fallisce torna al modello attivo prima dello scambio */
+int model_store_activate(void);
+
+const model_store_info_t *model_store_info(void);
+
+#if MODEL_STORE
+#define model_store_net(builtin) model_store_q8(builtin)
+#else
+#define model_store_net(builtin) (builtin)
+#endif
+
+#endif /* MODEL_STORE_H_ */
@@ -0,0 +1,39 @@
+/*
+ * Selezione a tempo di compilazione del motore di inferenza usato da
+ * predict_next_power() (edge) e predict_next_solar() (roof).
+ * Si imposta con PREDICTION_CONF_ENGINE nel project-conf.h del nodo.
+ */
+#ifndef PREDICTION_ENGINE_H_
+#define PREDICTION_ENGINE_H_
+
+#define PREDICTION_ENGINE_FLOAT 0 /* emlearn eml_net_regress1, pesi float32 */
+#define PREDICTION_ENGINE_Q8    1 /* ml/mlp_q8.c, pesi int8 e accumulatori int32 */
+#define PREDICTION_ENGINE_GEN   2 /* kernel float specializzato da tools/eml_codegen.py */
+#define PREDICTION_ENGINE_CSR   3 /* pesi potati in formato CSR (ml/mlp_csr.c) */
+
+#ifdef PREDICTION_CONF_ENGINE
+#define PREDICTION_ENGINE PREDICTION_CONF_ENGINE
+#else
+#define PREDICTION_ENGINE PREDICTION_ENGINE_FLOAT
+#endif
+
+/* Previsione multi-orizzonte sull'edge (prediction_forecast_power*.h, una
+ * uscita per ciascuna delle prossime ore), esposta su /res_forecast */
+#ifdef PREDICTION_CONF_FORECAST
+#define PREDICTION_FORECAST PREDICTION_CONF_FORECAST
+#else
+#define PREDICTION_FORECAST 0
+#endif
+
+#define PREDICTION_FORECAST_HORIZON 24
+
+/* Modello fuso sull'edge (prediction_fused*.h): ingressi solare e consumo,
+ * uscite nextSolar e nextPower con un solo tronco. Il roof non esegue
+ * inferenza e invia nextSolar = 0 */
+#ifdef PREDICTION_CONF_FUSED
+#define PREDICTION_FUSED PREDICTION_CONF_FUSED
+#else
+#define PREDICTION_FUSED 0
+#endif
+
+#endif /* PREDICTION_ENGINE_H_ */
@@ -0,0 +1,94 @@
+// === /model/<nome>: upload block-wise dei modelli int8 (ml/model_store.h) ===
+#include "contiki.h"
+#include "coap-engine.h"
+#include <stdio.h>
+#include "sys/log.h"
+#include "model_store.h"
+
+#if MODEL_STORE
+#include "model_blob.h"
+
+#define LOG_MODULE "RES_MODEL"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+// GET: modello attivo, eventuale slot in attesa di attivazione e stato dell'upload
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset) {
+  const model_store_info_t *info = model_store_info();
+  int len = snprintf((char *)buffer, preferred_size,
+                     "{\"ver\":%lu,\"slot\":\"%c\",\"crc\":%u,\"pending\":%lu,\"rx\":%lu,\"swaps\":%u,\"err\":%u,\"last\":%d}",
+                     (unsigned long)info->version, info->slot ? 'A' + info->slot - 1 : '-', info->crc,
+                     (unsigned long)(info->pending ? info->pending_version : 0), (unsigned long)info->received,
+                     info->swaps, info->errors, info->last_error);
+  coap_set_header_content_format(response, APPLICATION_JSON);
+  coap_set_payload(response, buffer, len);
+}
+
+// PUT block-wise (Block1): ogni blocco viene scritto nello slot non attivo,
+// l'ultimo chiude e verifica il blob
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset) {
+  const uint8_t *payload = NULL;
+  int len = coap_get_payload(request, &payload);
+  uint32_t num = 0, block_offset = 0;
+  uint8_t more = 0;
+  uint16_t size = 0;
+  int r;
+
+  // Senza opzione Block1 il blob deve stare in un solo messaggio
+  if(!coap_get_header_block1(request, &num, &more, &size, &block_offset)) {
+    num = 0;
+    more = 0;
+    block_offset = 0;
+    size = len;
+  } else if(size > COAP_MAX_CHUNK_SIZE) {
+    coap_set_status_code(response, REQUEST_ENTITY_TOO_LARGE_4_13);
+    coap_set_header_block1(response, 0, 0, COAP_MAX_CHUNK_SIZE);
+    return;
+  }
+  if(len <= 0 || payload == NULL) {
+    coap_set_status_code(response, BAD_REQUEST_4_00);
+    return;
+  }
+
+  r = model_store_write(block_offset, payload, len, more);
+  switch(r) {
+  case MODEL_STORE_OK:
+    if(more) {
+      coap_set_status_code(response, CONTINUE_2_31);
+      coap_set_header_block1(response, num, 1, size);
+    } else {
+      coap_set_status_code(response, CHANGED_2_04);
+      if(size != len || num > 0) {
+        coap_set_header_block1(response, num, 0, size);
+      }
+    }
+    break;
+  case MODEL_STORE_ERR_SEQ:
+    coap_set_status_code(response, REQUEST_ENTITY_INCOMPLETE_4_08);
+    break;
+  case MODEL_STORE_ERR_VERSION:
+    coap_set_status_code(response, PRECONDITION_FAILED_4_12);
+    break;
+  case MODEL_BLOB_ERR_SIZE:
+    coap_set_status_code(response, REQUEST_ENTITY_TOO_LARGE_4_13);
+    break;
+  case MODEL_STORE_ERR_IO:
+    coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+    break;
+  default:
+    coap_set_status_code(response, BAD_REQUEST_4_00); // header, forma o crc non validi
+    break;
+  }
+  if(r != MODEL_STORE_OK) {
+    LOG_WARN("Blocco %lu del modello rifiutato: errore %d\n", (unsigned long)num, r);
+  }
+}
+
+RESOURCE(res_model,
+         "title=\"Model update\";rt=\"application/octet-stream\"",
+         res_get_handler,
+         NULL,
+         res_put_handler,
+         NULL);
+#endif /* MODEL_STORE */
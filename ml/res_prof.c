@@ -0,0 +1,54 @@
+// === /res_prof: profilazione dell'inferenza per layer (ml/mlp_prof.h), sola lettura ===
+#include "contiki.h"
+#include "coap-engine.h"
+#include <string.h>
+#include "mlp_prof.h"
+
+#if MLP_PROF
+
+#ifdef MLP_PROF_CONF_JSON_SIZE
+#define PROF_JSON_SIZE MLP_PROF_CONF_JSON_SIZE
+#else
+#define PROF_JSON_SIZE 640
+#endif
+
+static char prof_json[PROF_JSON_SIZE];
+static int prof_len;
+
+// {"hz":..,"ehz":..,"<profilo>":{"n":..,"tot":[min,avg,max,p99,cpu],"l":[[...],...]}}
+// Block-wise: il JSON viene ricostruito solo al blocco 0, cosi' i blocchi
+// successivi restano coerenti anche se nel frattempo gira un'inferenza
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer,
+              uint16_t preferred_size, int32_t *offset) {
+  int32_t start = offset ? *offset : 0;
+  int32_t chunk;
+
+  if(start == 0) {
+    prof_len = mlp_prof_json(prof_json, sizeof(prof_json));
+  }
+  if(start >= prof_len) {
+    coap_set_status_code(response, BAD_OPTION_4_02);
+    return;
+  }
+
+  chunk = prof_len - start;
+  if(chunk > preferred_size) {
+    chunk = preferred_size;
+  }
+  memcpy(buffer, prof_json + start, chunk);
+  coap_set_header_content_format(response, APPLICATION_JSON);
+  coap_set_payload(response, buffer, chunk);
+
+  if(offset) {
+    *offset = start + chunk < prof_len ? start + chunk : -1;
+  }
+}
+
+RESOURCE(res_prof,
+     "title=\"Inference profile\";rt=\"application/json\"",
+     res_get_handler,
+     NULL,
+     NULL,
+     NULL);
+
+#endif /* MLP_PROF */
@@ -0,0 +1,34 @@
+/*
+ * Modello in C degli intrinseci ACLE usati da ml/mlp_backend_dsp.c, per
+ * eseguire il backend DSP sull'host (make -C ml/test). Stessa semantica
+ * delle istruzioni Cortex-M: ROR, SXTB16 e SMLAD.
+ */
+#ifndef ARM_ACLE_H_
+#define ARM_ACLE_H_
+
+#include <stdint.h>
+
+static inline uint32_t
+__ror(uint32_t x, uint32_t y)
+{
+  return (x >> y) | (x << (32 - y));
+}
+
+/* Estende con segno i byte 0 e 2 nelle due meta' a 16 bit */
+static inline uint32_t
+__sxtb16(uint32_t x)
+{
+  int16_t lo = (int8_t)(x & 0xff);
+  int16_t hi = (int8_t)((x >> 16) & 0xff);
+  return (uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+}
+
+/* acc + a.lo * b.lo + a.hi * b.hi, meta' a 16 bit con segno */
+static inline int32_t
+__smlad(uint32_t a, uint32_t b, int32_t acc)
+{
+  return acc + (int16_t)(a & 0xffff) * (int16_t)(b & 0xffff) +
+         (int16_t)(a >> 16) * (int16_t)(b >> 16);
+}
+
+#endif /* ARM_ACLE_H_ */
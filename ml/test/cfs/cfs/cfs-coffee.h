@@ -0,0 +1,9 @@
+/* cfs_coffee_reserve() di Coffee: sull'host non riserva nulla */
+#ifndef CFS_COFFEE_H_
+#define CFS_COFFEE_H_
+
+#include "cfs/cfs.h"
+
+int cfs_coffee_reserve(const char *name, unsigned long size);
+
+#endif /* CFS_COFFEE_H_ */
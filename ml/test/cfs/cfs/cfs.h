@@ -0,0 +1,14 @@
+/* Interfaccia CFS di Contiki (os/storage/cfs/cfs.h) usata da ml/model_store.c */
+#ifndef CFS_H_
+#define CFS_H_
+
+#define CFS_READ  1
+#define CFS_WRITE 2
+
+int cfs_open(const char *name, int flags);
+void cfs_close(int fd);
+int cfs_read(int fd, void *buf, unsigned int len);
+int cfs_write(int fd, const void *buf, unsigned int len);
+int cfs_remove(const char *name);
+
+#endif /* CFS_H_ */
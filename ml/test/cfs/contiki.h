@@ -0,0 +1,11 @@
+/*
+ * Header di Contiki ridotti a quanto usa ml/model_store.c, per eseguirlo
+ * sull'host (make -C ml/test store). Il file system e' in RAM, in
+ * ml/test/test_store.c.
+ */
+#ifndef CONTIKI_H_
+#define CONTIKI_H_
+
+#include <stdint.h>
+
+#endif /* CONTIKI_H_ */
@@ -0,0 +1,10 @@
+/* Log di Contiki disattivati: i test stampano solo i propri esiti */
+#ifndef LOG_H_
+#define LOG_H_
+
+#define LOG_LEVEL_INFO 3
+
+#define LOG_INFO(...)
+#define LOG_WARN(...)
+
+#endif /* LOG_H_ */
@@ -0,0 +1,51 @@
+# -*- coding: utf-8 -*-
+'''
+Confronta le uscite di test_q8 (motore int8 in C) con la simulazione intera
+di tools/eml_quantize.py sugli stessi ingressi: devono essere identiche.
+I modelli si riquantizzano con i range del README e il seed di default,
+gli stessi usati per generare gli header *_q8.h.
+
+Uso (dal Makefile): ./test_q8 > out_q8.txt && python3 check_q8.py out_q8.txt
+'''
+
+import os
+import sys
+
+import numpy as np
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..')
+sys.path.insert(0, os.path.join(ROOT, 'tools'))
+
+import emlearn_header as eh  # noqa: E402
+import eml_quantize as eq  # noqa: E402
+
+MODELS = {
+    'next_power': ('edge/prediction_next_power.h', '0:100:0.01,1:12:1,0:23:1,10:28:1,30:90:1'),
+    'next_solar': ('roof/prediction_next_solar.h', '0:10:0.001,1:12:1,0:23:1,10:28:1,30:90:1'),
+}
+
+
+def main():
+    rows = {}
+    with open(sys.argv[1]) as f:
+        for line in f:
+            name, *values = line.split()
+            rows.setdefault(name, []).append([float(v) for v in values])
+
+    failed = 0
+    for name, (header, ranges) in sorted(MODELS.items()):
+        model = eh.load(os.path.join(ROOT, header))
+        calib = eh.sample_inputs(eh.parse_ranges(ranges), 20000, 42)
+        qmodel = eq.quantize(model, calib)
+        data = np.array(rows[name], dtype=np.float32)
+        sim = eq.simulate(qmodel, data[:, :5])
+        bad = int(np.count_nonzero(sim != data[:, 5]))
+        err = np.abs(data[:, 5].astype(np.float64) - model.forward(data[:, :5]).astype(np.float64))
+        print('%s: %d ingressi, %d diversi dalla simulazione, MAE rispetto al float %.4f'
+              % (name, len(data), bad, err.mean()))
+        failed += bad
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,93 @@
+// === Confronto tra i backend di ml/mlp_backend.h sull'host ===
+// Compilato una volta per backend (Makefile): esegue il selftest con i
+// vettori condivisi, poi layer int8 e float pseudo-casuali di molte forme
+// (tutte le code dei blocchi da 4, 8 e 16). Su stdout scrive un riepilogo per
+// forma che il Makefile confronta tra i backend: deve essere identico byte
+// per byte, anche per i float (compilati senza FMA).
+#include <stdio.h>
+#include <string.h>
+#include "mlp_backend.h"
+
+#define MAX_IN 130
+#define MAX_OUT 40
+
+static uint32_t seed = 12345;
+
+static uint32_t
+next_rand(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+static int8_t
+rand_q8(void)
+{
+  return (int8_t)(next_rand() % 255) - 127;
+}
+
+static float
+rand_f32(void)
+{
+  return ((float)(next_rand() % 20001) - 10000.0f) / 5000.0f;
+}
+
+// FNV-1a dei byte del risultato
+static uint32_t
+fnv(uint32_t h, const void *data, size_t len)
+{
+  const uint8_t *p = (const uint8_t *)data;
+  while(len--) {
+    h = (h ^ *p++) * 16777619u;
+  }
+  return h;
+}
+
+int
+main(void)
+{
+  static int8_t w8[MAX_OUT * MAX_IN], x8[MAX_IN], out8[MAX_OUT];
+  static int32_t b32[MAX_OUT];
+  static float wf[MAX_OUT * MAX_IN], bf[MAX_OUT], xf[MAX_IN], outf[MAX_OUT];
+  mlp_q8_layer_t layer;
+  uint16_t n_in, n_out, i;
+  int errors = mlp_backend_selftest();
+
+  fprintf(stderr, "%-8s selftest: %d errori\n", mlp_backend_name(), errors);
+
+  for(n_in = 1; n_in <= MAX_IN; n_in += n_in < 40 ? 1 : 13) {
+    for(n_out = 1; n_out <= MAX_OUT; n_out += n_out < 17 ? 1 : 7) {
+      uint32_t h8 = 2166136261u, hf = 2166136261u;
+      int32_t dot;
+
+      for(i = 0; i < n_in * n_out; i++) {
+        w8[i] = rand_q8();
+        wf[i] = rand_f32();
+      }
+      for(i = 0; i < n_in; i++) {
+        x8[i] = rand_q8();
+        xf[i] = rand_f32();
+      }
+      for(i = 0; i < n_out; i++) {
+        b32[i] = (int32_t)(next_rand() % 200001) - 100000;
+        bf[i] = rand_f32();
+      }
+      layer.n_outputs = n_out;
+      layer.n_inputs = n_in;
+      layer.weights = w8;
+      layer.biases = b32;
+      layer.multiplier = 1073741824 + (int32_t)(next_rand() % 1000000);
+      layer.shift = n_in / 16;
+      layer.activation = n_out % 2 ? MLP_Q8_ACT_RELU : MLP_Q8_ACT_IDENTITY;
+
+      dot = mlp_backend_dot_q8(w8, x8, n_in, b32[0]);
+      mlp_backend_dense_q8(&layer, x8, out8);
+      mlp_backend_dense_f32(wf, bf, xf, n_in, n_out, outf);
+      h8 = fnv(fnv(h8, &dot, sizeof(dot)), out8, n_out);
+      hf = fnv(hf, outf, n_out * sizeof(float));
+      printf("%3u x %2u  dot %11ld  q8 %08lx  f32 %08lx\n", n_in, n_out, (long)dot,
+             (unsigned long)h8, (unsigned long)hf);
+    }
+  }
+  return errors != 0;
+}
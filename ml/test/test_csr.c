@@ -0,0 +1,82 @@
+// === Motore sparso (ml/mlp_csr.c) sui modelli potati dell'edge e del roof ===
+// Gli header CSR li genera il Makefile con tools/eml_sparse.py (sparsita' 0.5
+// sui layer nascosti). Il riferimento e' lo stesso modello potato in forma
+// densa: i pesi CSR vengono riespansi nel formato emlearn ed eseguiti con
+// mlp_backend_dense_f32(), che somma nell'ordine di eml_net_forward().
+// Saltare i pesi nulli non deve cambiare il risultato, bit a bit.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mlp_backend.h"
+#include "csr_next_power.h"
+#include "csr_next_solar.h"
+
+#define SAMPLES 50000
+#define MAX_WIDTH 80
+
+static float dense_w[MAX_WIDTH * MAX_WIDTH];
+
+static float
+dense_regress1(const mlp_csr_net_t *net, const float *features)
+{
+  static float buf1[MAX_WIDTH], buf2[MAX_WIDTH];
+  const float *in = features;
+  float *out = buf1;
+  uint16_t o, k;
+  uint8_t l;
+
+  for(l = 0; l < net->n_layers; l++) {
+    const mlp_csr_layer_t *layer = &net->layers[l];
+    memset(dense_w, 0, sizeof(float) * layer->n_inputs * layer->n_outputs);
+    for(o = 0; o < layer->n_outputs; o++) {
+      for(k = layer->row_ptr[o]; k < layer->row_ptr[o + 1]; k++) {
+        dense_w[layer->col_idx[k] * layer->n_outputs + o] = layer->values[k];
+      }
+    }
+    mlp_backend_dense_f32(dense_w, layer->biases, in, layer->n_inputs, layer->n_outputs, out);
+    if(layer->activation == MLP_CSR_ACT_RELU) {
+      for(o = 0; o < layer->n_outputs; o++) {
+        out[o] = out[o] > 0.0f ? out[o] : 0.0f;
+      }
+    }
+    in = out;
+    out = out == buf1 ? buf2 : buf1;
+  }
+  return in[0];
+}
+
+static int
+run(const char *name, const mlp_csr_net_t *net, float solar_div)
+{
+  int bad = 0, step_bad = 0, k;
+  uint32_t nnz = 0, macs = 0;
+  uint8_t l;
+
+  for(l = 0; l < net->n_layers; l++) {
+    nnz += net->layers[l].row_ptr[net->layers[l].n_outputs];
+    macs += (uint32_t)net->layers[l].n_inputs * net->layers[l].n_outputs;
+  }
+  srand(5);
+  for(k = 0; k < SAMPLES; k++) {
+    float in[5] = { (rand() % 10000) / solar_div, 1 + rand() % 12, rand() % 24, 10 + rand() % 19,
+                    30 + rand() % 61 };
+    float ref = dense_regress1(net, in);
+    float a = mlp_csr_regress1(net, in, 5), b = 0.0f;
+    uint8_t layer = 0;
+
+    while(mlp_csr_step(net, layer++, in, 5, &b, 1) > 0);
+    bad += memcmp(&ref, &a, sizeof(ref)) != 0;
+    step_bad += memcmp(&ref, &b, sizeof(ref)) != 0;
+  }
+  printf("%s: %lu pesi su %lu, %d ingressi, diversi dal denso potato: regress1 %d, step %d\n",
+         name, (unsigned long)nnz, (unsigned long)macs, SAMPLES, bad, step_bad);
+  return bad + step_bad + (nnz >= macs);
+}
+
+int
+main(void)
+{
+  int errors = run("next_power", &prediction_next_power_csr, 100.0f);
+  errors += run("next_solar", &prediction_next_solar_csr, 1000.0f);
+  return errors != 0;
+}
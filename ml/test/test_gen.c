@@ -0,0 +1,54 @@
+// === Motori float sui modelli dell'edge e del roof ===
+// Il kernel specializzato (tools/eml_codegen.py) e l'inferenza a passi
+// (ml/eml_net_step.h, sul backend di ml/mlp_backend.h) devono dare lo stesso
+// float di eml_net_regress1() di emlearn, bit a bit, su 100000 ingressi
+// casuali nel dominio del firmware. Anche *_gen_step() deve coincidere.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../edge/prediction_next_power.h"
+#include "../../edge/prediction_next_power_gen.h"
+#include "../../roof/prediction_next_solar.h"
+#include "../../roof/prediction_next_solar_gen.h"
+#include "eml_net_step.h"
+
+#define SAMPLES 100000
+
+typedef float (*regress1_t)(const float *features, int32_t n_features);
+typedef int32_t (*gen_step_t)(uint8_t layer, const float *features, int32_t n_features,
+                              float *out, int32_t out_length);
+
+static int
+run(const char *name, EmlNet *net, regress1_t gen, gen_step_t gen_step, float solar_div)
+{
+  int gen_bad = 0, step_bad = 0, net_bad = 0, k;
+
+  srand(3);
+  for(k = 0; k < SAMPLES; k++) {
+    float in[5] = { (rand() % 10000) / solar_div, 1 + rand() % 12, rand() % 24, 10 + rand() % 19,
+                    30 + rand() % 61 };
+    float ref = eml_net_regress1(net, in, 5);
+    float a = gen(in, 5), b = 0.0f, c = 0.0f;
+    uint8_t layer = 0;
+
+    while(gen_step(layer++, in, 5, &b, 1) > 0);
+    layer = 0;
+    while(eml_net_step(net, layer++, in, 5, &c, 1) > 0);
+    gen_bad += memcmp(&ref, &a, sizeof(ref)) != 0;
+    step_bad += memcmp(&ref, &b, sizeof(ref)) != 0;
+    net_bad += memcmp(&ref, &c, sizeof(ref)) != 0;
+  }
+  printf("%s: %d ingressi, diversi da eml_net_regress1: gen %d, gen_step %d, eml_net_step %d\n",
+         name, SAMPLES, gen_bad, step_bad, net_bad);
+  return gen_bad + step_bad + net_bad;
+}
+
+int
+main(void)
+{
+  int errors = run("next_power", &prediction_next_power, prediction_next_power_gen_regress1,
+                   prediction_next_power_gen_step, 100.0f);
+  errors += run("next_solar", &prediction_next_solar, prediction_next_solar_gen_regress1,
+                prediction_next_solar_gen_step, 1000.0f);
+  return errors != 0;
+}
@@ -0,0 +1,71 @@
+// === Memo del layer 0 (ml/mlp_q8_memo.c) su una passeggiata casuale ===
+// 200000 previsioni con ingressi che cambiano poco per volta, come sui nodi:
+// potenza/produzione a piccoli passi, ora e mese ogni tanto, temperatura e
+// umidita' di rado. mlp_q8_memo_regress1() e mlp_q8_memo_step() (contesti
+// separati, invalidati ogni 50000 passi come dopo un cambio di modello)
+// devono dare esattamente il valore di mlp_q8_regress1().
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mlp_q8_memo.h"
+#include "../../edge/prediction_next_power_q8.h"
+#include "../../roof/prediction_next_solar_q8.h"
+
+#define STEPS 200000
+#define INVALIDATE_EVERY 50000
+
+static int
+run(const char *name, const mlp_q8_net_t *net, int max_value, float value_div)
+{
+  static mlp_q8_memo_t memo, memo_step;
+  int value = max_value / 3, mese = 5, ora = 10, t = 20, h = 60;
+  int bad = 0, step_bad = 0, i;
+  mlp_q8_memo_stats_t *s = &memo.stats;
+
+  memset(&memo, 0, sizeof(memo));
+  memset(&memo_step, 0, sizeof(memo_step));
+  srand(1);
+  for(i = 0; i < STEPS; i++) {
+    if(i % 240 == 0) {
+      ora = (ora + 1) % 24;
+    }
+    if(i % 5760 == 0) {
+      mese = mese % 12 + 1;
+    }
+    if(i > 0 && i % INVALIDATE_EVERY == 0) {
+      mlp_q8_memo_invalidate(&memo);
+      mlp_q8_memo_invalidate(&memo_step);
+    }
+    value += rand() % 201 - 100;
+    value = value < 0 ? 0 : (value > max_value ? max_value : value);
+    if(rand() % 4 == 0) {
+      t += rand() % 3 - 1;
+    }
+    if(rand() % 4 == 0) {
+      h += rand() % 3 - 1;
+    }
+
+    float f[5] = { value / value_div, mese, ora, t, h };
+    float ref = mlp_q8_regress1(net, f, 5);
+    float a = mlp_q8_memo_regress1(net, &memo, f, 5), b = 0.0f;
+    uint8_t layer = 0;
+
+    while(mlp_q8_memo_step(net, &memo_step, layer++, f, 5, &b, 1) > 0);
+    bad += memcmp(&ref, &a, sizeof(ref)) != 0;
+    step_bad += memcmp(&ref, &b, sizeof(ref)) != 0;
+  }
+  printf("%s: %d passi, diversi da mlp_q8_regress1: memo %d, memo_step %d; hit %lu, layer 0 %lu, "
+         "incrementali %lu, completi %lu, MAC risparmiati %llu\n", name, STEPS, bad, step_bad,
+         (unsigned long)s->hits, (unsigned long)s->l0_hits, (unsigned long)s->incremental,
+         (unsigned long)s->full, (unsigned long long)s->macs_saved);
+  // Il memo deve anche servire: senza hit o aggiornamenti incrementali il test non prova nulla
+  return bad + step_bad + (s->hits == 0 || s->incremental == 0);
+}
+
+int
+main(void)
+{
+  int errors = run("next_power", &prediction_next_power_q8, 10000, 100.0f);
+  errors += run("next_solar", &prediction_next_solar_q8, 10000, 1000.0f);
+  return errors != 0;
+}
@@ -0,0 +1,42 @@
+// === Motore int8 (ml/mlp_q8.c) sui modelli dell'edge e del roof ===
+// 2000 ingressi casuali nel dominio del firmware per ogni modello: stampa
+// ingressi e uscita di mlp_q8_regress1(), che check_q8.py confronta con la
+// simulazione intera di tools/eml_quantize.py (devono coincidere bit a bit).
+// Verifica anche che mlp_q8_step(), un layer per chiamata, dia lo stesso valore.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../edge/prediction_next_power_q8.h"
+#include "../../roof/prediction_next_solar_q8.h"
+
+#define SAMPLES 2000
+
+static int
+run(const char *name, const mlp_q8_net_t *net, float solar_div)
+{
+  int errors = 0, k;
+
+  srand(1);
+  for(k = 0; k < SAMPLES; k++) {
+    float in[5] = { (rand() % 10000) / solar_div, 1 + rand() % 12, rand() % 24, 10 + rand() % 19,
+                    30 + rand() % 61 };
+    float a = mlp_q8_regress1(net, in, 5), b = 0.0f;
+    uint8_t layer = 0;
+
+    while(mlp_q8_step(net, layer++, in, 5, &b, 1) > 0);
+    if(memcmp(&a, &b, sizeof(a)) != 0) {
+      errors++;
+    }
+    printf("%s %.9g %.9g %.9g %.9g %.9g %.9g\n", name, in[0], in[1], in[2], in[3], in[4], a);
+  }
+  fprintf(stderr, "%s: %d uscite di mlp_q8_step diverse da mlp_q8_regress1\n", name, errors);
+  return errors;
+}
+
+int
+main(void)
+{
+  int errors = run("next_power", &prediction_next_power_q8, 100.0f);
+  errors += run("next_solar", &prediction_next_solar_q8, 1000.0f);
+  return errors != 0;
+}
@@ -0,0 +1,222 @@
+// === Upload dei modelli (ml/model_store.c) su un CFS in RAM ===
+// Blob di un layer 5 -> 1 inviato a blocchi come da ml/res_model.c: upload
+// completo, blocchi ritrasmessi dopo un ACK perso (anche l'ultimo, dopo la
+// verifica), blocchi fuori sequenza, crc errato e versione non successiva.
+#include <stdio.h>
+#include <string.h>
+#include "model_store.h"
+#include "model_blob.h"
+#include "cfs/cfs-coffee.h"
+
+#define BLOCK 32
+#define N_INPUTS 5
+
+// --- CFS in RAM: due file, uno per slot, un descrittore aperto alla volta ---
+static struct {
+  char name[8];
+  uint8_t data[256];
+  unsigned int size;
+} files[2];
+static int open_file = -1;
+static unsigned int pos;
+
+static int
+find(const char *name)
+{
+  int i;
+
+  for(i = 0; i < 2; i++) {
+    if(strcmp(files[i].name, name) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int
+cfs_open(const char *name, int flags)
+{
+  int i = find(name);
+
+  if(i < 0 && flags == CFS_WRITE && (i = find("")) >= 0) {
+    strcpy(files[i].name, name);
+    files[i].size = 0;
+  }
+  if(i >= 0) {
+    open_file = i;
+    pos = 0;
+  }
+  return i;
+}
+
+void
+cfs_close(int fd)
+{
+  (void)fd;
+  open_file = -1;
+}
+
+int
+cfs_read(int fd, void *buf, unsigned int len)
+{
+  if(fd != open_file) {
+    return -1;
+  }
+  len = len < files[fd].size - pos ? len : files[fd].size - pos;
+  memcpy(buf, files[fd].data + pos, len);
+  pos += len;
+  return len;
+}
+
+int
+cfs_write(int fd, const void *buf, unsigned int len)
+{
+  if(fd != open_file || pos + len > sizeof(files[fd].data)) {
+    return -1;
+  }
+  memcpy(files[fd].data + pos, buf, len);
+  pos += len;
+  files[fd].size = pos;
+  return len;
+}
+
+int
+cfs_remove(const char *name)
+{
+  int i = find(name);
+
+  if(i >= 0) {
+    files[i].name[0] = '\0';
+  }
+  return i >= 0 ? 0 : -1;
+}
+
+int
+cfs_coffee_reserve(const char *name, unsigned long size)
+{
+  (void)name;
+  (void)size;
+  return 0;
+}
+
+// --- Blob e upload ---
+static int errors;
+
+static void
+check(int cond, const char *what)
+{
+  if(!cond) {
+    printf("ERRORE: %s\n", what);
+    errors++;
+  }
+}
+
+// Layer di uscita 5 -> 1: header, descrittore, scale, bias e pesi (padding a 8)
+static uint32_t
+make_blob(uint8_t *blob, uint32_t version)
+{
+  model_blob_header_t h;
+  model_blob_layer_t l;
+  float scale[N_INPUTS] = { 100.0f, 10.0f, 5.0f, 4.0f, 2.0f };
+  int32_t bias = 7;
+  int8_t weights[8] = { 1, -2, 3, -4, 5, 0, 0, 0 };
+  uint32_t n = sizeof(h);
+
+  memset(&h, 0, sizeof(h));
+  memset(&l, 0, sizeof(l));
+  l.n_outputs = 1;
+  l.n_inputs = N_INPUTS;
+  memcpy(blob + n, &l, sizeof(l));
+  n += sizeof(l);
+  memcpy(blob + n, scale, sizeof(scale));
+  n += sizeof(scale);
+  memcpy(blob + n, &bias, sizeof(bias));
+  n += sizeof(bias);
+  memcpy(blob + n, weights, sizeof(weights));
+  n += sizeof(weights);
+
+  h.magic = MODEL_BLOB_MAGIC;
+  h.format = MODEL_BLOB_FORMAT;
+  h.version = version;
+  h.length = n - sizeof(h);
+  h.dtype = MODEL_BLOB_DTYPE_Q8;
+  h.n_layers = 1;
+  h.n_inputs = N_INPUTS;
+  h.n_outputs = 1;
+  h.buf_length = N_INPUTS;
+  h.output_scale = 0.5f;
+  memcpy(blob, &h, sizeof(h));
+  h.crc = model_blob_crc(0, blob + MODEL_BLOB_CRC_OFFSET, n - MODEL_BLOB_CRC_OFFSET);
+  memcpy(blob, &h, sizeof(h));
+  return n;
+}
+
+// Invia il blob a blocchi e ritorna l'esito dell'ultimo
+static int
+upload(const uint8_t *blob, uint32_t size)
+{
+  uint32_t offset;
+  int r = MODEL_STORE_OK;
+
+  for(offset = 0; offset < size && r == MODEL_STORE_OK; offset += BLOCK) {
+    uint16_t len = size - offset < BLOCK ? size - offset : BLOCK;
+    r = model_store_write(offset, blob + offset, len, offset + len < size);
+  }
+  return r;
+}
+
+int
+main(void)
+{
+  uint8_t blob[128];
+  uint32_t size, last;
+  const model_store_info_t *info = model_store_info();
+
+  model_store_init(N_INPUTS, 1);
+  check(info->slot == 0 && info->version == 0, "slot attivo senza modelli in CFS");
+  check(model_store_write(BLOCK, blob, BLOCK, 1) == MODEL_STORE_ERR_SEQ, "blocco accettato senza il blocco 0");
+
+  // Upload completo, con un blocco intermedio ritrasmesso
+  size = make_blob(blob, 2);
+  last = (size - 1) / BLOCK * BLOCK;
+  check(model_store_write(0, blob, BLOCK, 1) == MODEL_STORE_OK, "blocco 0");
+  check(model_store_write(BLOCK, blob + BLOCK, BLOCK, 1) == MODEL_STORE_OK, "blocco 1");
+  check(model_store_write(BLOCK, blob + BLOCK, BLOCK, 1) == MODEL_STORE_OK, "blocco 1 ritrasmesso");
+  check(model_store_write(last, blob + last, size - last, 0) == MODEL_STORE_OK, "ultimo blocco");
+  check(info->pending != 0 && info->pending_version == 2, "modello verificato non in attesa");
+
+  // Ultimo blocco ritrasmesso dopo la verifica: stesso esito, nessun errore
+  check(model_store_write(last, blob + last, size - last, 0) == MODEL_STORE_OK,
+        "ultimo blocco ritrasmesso dopo la verifica");
+  check(info->pending != 0 && info->errors == 0, "ritrasmissione dell'ultimo blocco contata come errore");
+  check(model_store_write(last - BLOCK, blob + last - BLOCK, BLOCK, 1) == MODEL_STORE_ERR_SEQ,
+        "blocco intermedio accettato dopo la verifica");
+  check(model_store_write(last, blob + last, size - last - 1, 0) == MODEL_STORE_ERR_SEQ,
+        "ultimo blocco di lunghezza diversa accettato dopo la verifica");
+
+  check(model_store_activate() == MODEL_STORE_OK && info->version == 2 && info->pending == 0,
+        "attivazione della versione 2");
+  check(model_store_write(last, blob + last, size - last, 0) == MODEL_STORE_OK,
+        "ultimo blocco ritrasmesso dopo l'attivazione");
+  check(info->pending == 0, "ritrasmissione dopo l'attivazione rimessa in attesa");
+
+  // Versione non successiva: rifiutata al blocco 0
+  check(model_store_write(0, blob, BLOCK, 1) == MODEL_STORE_ERR_VERSION, "versione non successiva accettata");
+
+  // Crc errato: rifiutato a fine upload, e la ritrasmissione non lo rende valido
+  size = make_blob(blob, 3);
+  blob[size - 1] ^= 1;
+  check(upload(blob, size) == MODEL_BLOB_ERR_CRC, "blob con crc errato accettato");
+  check(model_store_write(last, blob + last, size - last, 0) == MODEL_STORE_ERR_SEQ,
+        "ultimo blocco di un upload scartato accettato");
+  check(info->pending == 0 && info->version == 2, "upload scartato ha cambiato il modello");
+
+  // Il riavvio carica lo slot valido con la versione piu' alta
+  blob[size - 1] ^= 1;
+  check(upload(blob, size) == MODEL_STORE_OK, "upload della versione 3");
+  model_store_init(N_INPUTS, 1);
+  check(info->version == 3 && info->slot != 0, "versione 3 non caricata al riavvio");
+
+  printf("Upload modelli: %s\n", errors ? "ERRORI" : "ok");
+  return errors != 0;
+}
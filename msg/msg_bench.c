@@ -0,0 +1,132 @@
+#include "msg_json.h"
+
+#if MSG_BENCH
+#include "contiki.h"
+#include "sys/rtimer.h"
+#include "sys/log.h"
+#include "msg_codec.h"
+#include <stdio.h>
+#include <string.h>
+
+#define LOG_MODULE "MsgBench"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+#ifdef MSG_CONF_BENCH_RUNS
+#define BENCH_RUNS MSG_CONF_BENCH_RUNS
+#else
+#define BENCH_RUNS 200
+#endif
+
+// Payload come arrivano dai nodi e dal server
+static const char roof_json[] = "{\"solar\": 812, \"mese\": 5, \"ora\": 16, \"temp\": 21, \"humid\": 54, \"nextSolar\": 790}";
+static const char power_json[] = "{\"power\": 3120}";
+static const char threshold_json[] = "{\"threshold_off\": 3000}";
+static const char furnace_json[] = "{\"furnace_state\":1}";
+
+static char copy[128];
+static volatile int sink;
+
+// Percorso precedente: copia nel buffer della risorsa e sscanf con formato fisso
+static int
+old_roof(void)
+{
+  int v[6];
+  memcpy(copy, roof_json, sizeof(roof_json));
+  return sscanf(copy, "{\"solar\": %d, \"mese\": %d, \"ora\": %d, \"temp\": %d, \"humid\": %d, \"nextSolar\": %d}",
+                &v[0], &v[1], &v[2], &v[3], &v[4], &v[5]) == 6;
+}
+
+static int
+old_power(void)
+{
+  int v;
+  memcpy(copy, power_json, sizeof(power_json));
+  return sscanf(copy, "{\"power\": %d}", &v) == 1;
+}
+
+static int
+old_threshold(void)
+{
+  int v;
+  memset(copy, 0, sizeof(copy));
+  strncpy(copy, threshold_json, sizeof(copy) - 1);
+  if(strstr(copy, "threshold_on") != NULL && sscanf(copy, "{\"threshold_on\":%d}", &v) == 1) {
+    return 1;
+  }
+  return strstr(copy, "threshold_off") != NULL && sscanf(copy, "{\"threshold_off\":%d}", &v) == 1;
+}
+
+static int
+old_furnace(void)
+{
+  int v;
+  return sscanf(furnace_json, "{\"furnace_state\":%d}", &v) == 1;
+}
+
+static int
+new_roof(void)
+{
+  msg_roof_t m;
+  return msg_roof_decode((const uint8_t *)roof_json, sizeof(roof_json) - 1, &m) == MSG_OK;
+}
+
+static int
+new_power(void)
+{
+  msg_power_t m;
+  return msg_power_decode((const uint8_t *)power_json, sizeof(power_json) - 1, &m) == MSG_OK;
+}
+
+static int
+new_threshold(void)
+{
+  msg_threshold_set_t m;
+  return msg_threshold_set_decode((const uint8_t *)threshold_json, sizeof(threshold_json) - 1, &m) == MSG_OK;
+}
+
+static int
+new_furnace(void)
+{
+  msg_furnace_t m;
+  return msg_furnace_decode((const uint8_t *)furnace_json, sizeof(furnace_json) - 1, &m) == MSG_OK;
+}
+
+// Nanosecondi per messaggio
+static unsigned long
+run(int (*parse)(void))
+{
+  rtimer_clock_t start;
+  uint32_t ticks;
+  int i, ok = 0;
+
+  start = RTIMER_NOW();
+  for(i = 0; i < BENCH_RUNS; i++) {
+    ok += parse();
+  }
+  ticks = (uint32_t)(RTIMER_NOW() - start);
+  sink = ok;
+  return ok == BENCH_RUNS ? (unsigned long)((uint64_t)ticks * 1000000000 / RTIMER_SECOND / BENCH_RUNS) : 0;
+}
+
+void
+msg_bench_run(void)
+{
+  static const struct {
+    const char *name;
+    int (*old)(void);
+    int (*codec)(void);
+  } cases[] = {
+    { "roof", old_roof, new_roof },
+    { "power", old_power, new_power },
+    { "threshold", old_threshold, new_threshold },
+    { "furnace", old_furnace, new_furnace },
+  };
+  uint8_t i;
+
+  // 0 ns indica un parsing fallito
+  for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    LOG_INFO("Parsing %s: sscanf %lu ns, codec %lu ns (%d messaggi)\n", cases[i].name,
+             run(cases[i].old), run(cases[i].codec), BENCH_RUNS);
+  }
+}
+#endif /* MSG_BENCH */
@@ -0,0 +1,269 @@
+#include "msg_cbor.h"
+
+#include <string.h>
+
+#define CBOR_UINT   0
+#define CBOR_NINT   1
+#define CBOR_BYTES  2
+#define CBOR_TEXT   3
+#define CBOR_ARRAY  4
+#define CBOR_MAP    5
+#define CBOR_TAG    6
+#define CBOR_SIMPLE 7
+
+/* Etichette SenML-CBOR (RFC 8428, tabella 4) */
+#define SENML_BN -2
+#define SENML_BT -3
+#define SENML_BV -5
+#define SENML_N   0
+#define SENML_V   2
+
+#define SKIP_DEPTH 4
+
+// Testa di un elemento: tipo maggiore e argomento (niente lunghezze indefinite)
+static int
+read_head(msg_cbor_t *s, uint8_t *major, uint32_t *val)
+{
+  uint8_t info, n, i;
+
+  if(s->p == s->end) {
+    return MSG_ERR_SYNTAX;
+  }
+  *major = *s->p >> 5;
+  info = *s->p++ & 0x1f;
+  if(info < 24) {
+    *val = info;
+    return MSG_OK;
+  }
+  if(info > 27 || (info == 27 && *major != CBOR_SIMPLE)) {
+    return MSG_ERR_SYNTAX; // indefiniti e interi a 64 bit non usati dai messaggi
+  }
+  n = (uint8_t)(1 << (info - 24));
+  if(s->end - s->p < n) {
+    return MSG_ERR_SYNTAX;
+  }
+  *val = 0;
+  for(i = 0; i < n; i++) {
+    *val = (*val << 8) | *s->p++; // per i double a 8 byte conta solo il salto
+  }
+  return MSG_OK;
+}
+
+static int
+skip_item(msg_cbor_t *s, uint8_t depth)
+{
+  uint8_t major;
+  uint32_t val, i;
+
+  if(depth > SKIP_DEPTH || read_head(s, &major, &val) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  switch(major) {
+  case CBOR_BYTES:
+  case CBOR_TEXT:
+    if((uint32_t)(s->end - s->p) < val) {
+      return MSG_ERR_SYNTAX;
+    }
+    s->p += val;
+    break;
+  case CBOR_MAP:
+    val *= 2;
+    /* fall through */
+  case CBOR_ARRAY:
+    for(i = 0; i < val; i++) {
+      if(skip_item(s, depth + 1) < 0) {
+        return MSG_ERR_SYNTAX;
+      }
+    }
+    break;
+  case CBOR_TAG:
+    return skip_item(s, depth + 1);
+  default:
+    break; // interi e semplici: gia' consumati da read_head
+  }
+  return MSG_OK;
+}
+
+static int
+read_int(msg_cbor_t *s, int32_t *v)
+{
+  uint8_t major;
+  uint32_t val;
+
+  if(read_head(s, &major, &val) < 0 || val > INT32_MAX) {
+    return MSG_ERR_SYNTAX;
+  }
+  if(major == CBOR_UINT) {
+    *v = (int32_t)val;
+  } else if(major == CBOR_NINT) {
+    *v = -1 - (int32_t)val;
+  } else {
+    return MSG_ERR_SYNTAX;
+  }
+  return MSG_OK;
+}
+
+int
+msg_senml_begin(msg_cbor_t *s, const uint8_t *buf, uint16_t len)
+{
+  uint8_t major;
+  uint32_t val;
+
+  s->p = buf;
+  s->end = buf + len;
+  s->bv = 0;
+  s->bt = 0;
+  if(buf == NULL || read_head(s, &major, &val) < 0 || major != CBOR_ARRAY) {
+    return MSG_ERR_SYNTAX;
+  }
+  s->records = (uint16_t)val;
+  return MSG_OK;
+}
+
+int
+msg_senml_next(msg_cbor_t *s, const char **name, uint8_t *name_len, int32_t *v)
+{
+  uint8_t major, has_v;
+  uint32_t pairs, len;
+  int32_t label, value;
+
+  while(s->records > 0) {
+    s->records--;
+    if(read_head(s, &major, &pairs) < 0 || major != CBOR_MAP) {
+      return MSG_ERR_SYNTAX;
+    }
+    *name = NULL;
+    *name_len = 0;
+    has_v = 0;
+    for(; pairs > 0; pairs--) {
+      if(read_int(s, &label) < 0) {
+        return MSG_ERR_SYNTAX;
+      }
+      switch(label) {
+      case SENML_N:
+        if(read_head(s, &major, &len) < 0 || major != CBOR_TEXT || len > 0xff ||
+           (uint32_t)(s->end - s->p) < len) {
+          return MSG_ERR_SYNTAX;
+        }
+        *name = (const char *)s->p;
+        *name_len = (uint8_t)len;
+        s->p += len;
+        break;
+      case SENML_V:
+      case SENML_BV:
+      case SENML_BT:
+        // Solo valori interi: i messaggi dello schema non usano decimali
+        if(read_int(s, &value) < 0) {
+          return MSG_ERR_SYNTAX;
+        }
+        if(label == SENML_V) {
+          *v = value;
+          has_v = 1;
+        } else if(label == SENML_BV) {
+          s->bv = value;
+        } else {
+          s->bt = (uint32_t)value;
+        }
+        break;
+      default:
+        if(skip_item(s, 0) < 0) { // bn, unita', valori non numerici...
+          return MSG_ERR_SYNTAX;
+        }
+      }
+    }
+    if(has_v && *name != NULL) {
+      *v += s->bv;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void
+put_head(msg_writer_t *w, uint8_t major, uint32_t val)
+{
+  uint8_t head[5];
+  uint8_t n;
+
+  if(val < 24) {
+    head[0] = (uint8_t)((major << 5) | val);
+    n = 1;
+  } else if(val <= 0xff) {
+    head[0] = (uint8_t)((major << 5) | 24);
+    head[1] = (uint8_t)val;
+    n = 2;
+  } else if(val <= 0xffff) {
+    head[0] = (uint8_t)((major << 5) | 25);
+    head[1] = (uint8_t)(val >> 8);
+    head[2] = (uint8_t)val;
+    n = 3;
+  } else {
+    head[0] = (uint8_t)((major << 5) | 26);
+    head[1] = (uint8_t)(val >> 24);
+    head[2] = (uint8_t)(val >> 16);
+    head[3] = (uint8_t)(val >> 8);
+    head[4] = (uint8_t)val;
+    n = 5;
+  }
+  msg_put_raw(w, (const char *)head, n);
+}
+
+static void
+put_int(msg_writer_t *w, int32_t v)
+{
+  if(v < 0) {
+    put_head(w, CBOR_NINT, (uint32_t)(-1 - v));
+  } else {
+    put_head(w, CBOR_UINT, (uint32_t)v);
+  }
+}
+
+// Chiave n e valore v di un record
+static void
+put_record(msg_writer_t *w, const char *name, uint8_t name_len, int32_t v)
+{
+  put_int(w, SENML_N);
+  put_head(w, CBOR_TEXT, name_len);
+  msg_put_raw(w, name, name_len);
+  put_int(w, SENML_V);
+  put_int(w, v);
+}
+
+void
+msg_senml_open(msg_writer_t *w, uint8_t n_records)
+{
+  put_head(w, CBOR_ARRAY, n_records);
+}
+
+void
+msg_senml_int(msg_writer_t *w, const char *name, uint8_t name_len, int32_t v)
+{
+  put_head(w, CBOR_MAP, 2);
+  put_record(w, name, name_len, v);
+}
+
+void
+msg_senml_int_bt(msg_writer_t *w, const char *name, uint8_t name_len, int32_t v,
+                 const msg_str_t *bt)
+{
+  uint32_t t = 0;
+  uint16_t i;
+
+  for(i = 0; i < bt->len && bt->s[i] >= '0' && bt->s[i] <= '9'; i++) {
+    t = t * 10 + (uint32_t)(bt->s[i] - '0');
+  }
+  if(i == 0 || i < bt->len) {
+    msg_senml_int(w, name, name_len, v); // epoch non valido: record senza base time
+    return;
+  }
+  put_head(w, CBOR_MAP, 3);
+  put_int(w, SENML_BT);
+  put_head(w, CBOR_UINT, t);
+  put_record(w, name, name_len, v);
+}
+
+int
+msg_senml_end(msg_writer_t *w)
+{
+  return w->full ? MSG_ERR_SPACE : w->len;
+}
@@ -0,0 +1,50 @@
+/*
+ * SenML-CBOR (RFC 8428, Content-Format 112) per i messaggi dello schema con
+ * "senml": ogni campo intero diventa un record {n: chiave, v: valore} e il
+ * campo con "senml": "bt" (epoch in stringa) il base time del primo record.
+ *
+ * E' l'alternativa binaria al JSON di msg/msg_json.h sugli stessi
+ * msg_<nome>_t: il formato viene scelto per destinazione in base al "ct"
+ * restituito dalla lookup, con ritorno al JSON se il destinatario rifiuta
+ * il payload (4.00/4.15).
+ */
+#ifndef MSG_CBOR_H_
+#define MSG_CBOR_H_
+
+#include "msg_json.h"
+
+#define MSG_CT_JSON        50  /* application/json */
+#define MSG_CT_SENML_CBOR 112  /* application/senml+cbor */
+
+/* Invio in SenML-CBOR verso le destinazioni che lo accettano */
+#ifdef MSG_CONF_SENML
+#define MSG_SENML MSG_CONF_SENML
+#else
+#define MSG_SENML 0
+#endif
+
+typedef struct msg_cbor {
+  const uint8_t *p;
+  const uint8_t *end;
+  uint16_t records;      /* record ancora da leggere */
+  int32_t bv;            /* base value, sommato ai valori dei record */
+  uint32_t bt;           /* base time, 0 se assente */
+} msg_cbor_t;
+
+/* Apre l'array di record SenML */
+int msg_senml_begin(msg_cbor_t *s, const uint8_t *buf, uint16_t len);
+
+/* Record successivo con valore numerico intero: 1 con nome (senza base name)
+ * e valore, 0 a fine array, <0 errore. I record senza "v" sono saltati */
+int msg_senml_next(msg_cbor_t *s, const char **name, uint8_t *name_len, int32_t *v);
+
+void msg_senml_open(msg_writer_t *w, uint8_t n_records);
+void msg_senml_int(msg_writer_t *w, const char *name, uint8_t name_len, int32_t v);
+/* Primo record con base time preso dalla stringa epoch bt */
+void msg_senml_int_bt(msg_writer_t *w, const char *name, uint8_t name_len, int32_t v,
+                      const msg_str_t *bt);
+
+/* Ritorna la lunghezza scritta o MSG_ERR_SPACE (binario, senza terminatore) */
+int msg_senml_end(msg_writer_t *w);
+
+#endif /* MSG_CBOR_H_ */
@@ -0,0 +1,836 @@
+/* Generato da tools/msg_codegen.py a partire da msg/messages.json: non modificare */
+#include "msg_codec.h"
+
+#include <string.h>
+
+int
+msg_roof_decode(const uint8_t *buf, uint16_t len, msg_roof_t *m)
+{
+  msg_scan_t s;
+  const char *key;
+  uint8_t key_len;
+  int r;
+
+  m->present = 0;
+  if(msg_scan_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {
+    switch(key_len) {
+    case 1:
+      if(memcmp(key, "t", 1) == 0) {
+        r = msg_scan_int(&s, &m->t);
+        m->present |= MSG_ROOF_T;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 3:
+      if(memcmp(key, "ora", 3) == 0) {
+        r = msg_scan_int(&s, &m->ora);
+        m->present |= MSG_ROOF_ORA;
+      } else if(memcmp(key, "seq", 3) == 0) {
+        r = msg_scan_int(&s, &m->seq);
+        m->present |= MSG_ROOF_SEQ;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 4:
+      if(memcmp(key, "mese", 4) == 0) {
+        r = msg_scan_int(&s, &m->mese);
+        m->present |= MSG_ROOF_MESE;
+      } else if(memcmp(key, "temp", 4) == 0) {
+        r = msg_scan_int(&s, &m->temp);
+        m->present |= MSG_ROOF_TEMP;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 5:
+      if(memcmp(key, "solar", 5) == 0) {
+        r = msg_scan_int(&s, &m->solar);
+        m->present |= MSG_ROOF_SOLAR;
+      } else if(memcmp(key, "humid", 5) == 0) {
+        r = msg_scan_int(&s, &m->humid);
+        m->present |= MSG_ROOF_HUMID;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 9:
+      if(memcmp(key, "nextSolar", 9) == 0) {
+        r = msg_scan_int(&s, &m->next_solar);
+        m->present |= MSG_ROOF_NEXT_SOLAR;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    default:
+      r = msg_scan_skip(&s);
+    }
+    if(r < 0) {
+      return MSG_ERR_SYNTAX;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_ROOF_REQUIRED) != MSG_ROOF_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  if((m->present & MSG_ROOF_MESE) && (m->mese < 1 || m->mese > 12)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_ROOF_ORA) && (m->ora < 0 || m->ora > 23)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_ROOF_SEQ) && (m->seq < 0 || m->seq > 65535)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_ROOF_T) && (m->t < 0)) {
+    return MSG_ERR_RANGE;
+  }
+  return MSG_OK;
+}
+
+int
+msg_roof_encode(const msg_roof_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_put_raw(&w, "{\"solar\":", 9);
+  msg_put_int(&w, m->solar);
+  msg_put_raw(&w, ",\"mese\":", 8);
+  msg_put_int(&w, m->mese);
+  msg_put_raw(&w, ",\"ora\":", 7);
+  msg_put_int(&w, m->ora);
+  msg_put_raw(&w, ",\"temp\":", 8);
+  msg_put_int(&w, m->temp);
+  msg_put_raw(&w, ",\"humid\":", 9);
+  msg_put_int(&w, m->humid);
+  msg_put_raw(&w, ",\"nextSolar\":", 13);
+  msg_put_int(&w, m->next_solar);
+  msg_put_raw(&w, ",\"seq\":", 7);
+  msg_put_int(&w, m->seq);
+  msg_put_raw(&w, ",\"t\":", 5);
+  msg_put_int(&w, m->t);
+  msg_put_raw(&w, "}", 1);
+  return msg_writer_end(&w);
+}
+
+int
+msg_roof_decode_senml(const uint8_t *buf, uint16_t len, msg_roof_t *m)
+{
+  msg_cbor_t s;
+  const char *rec;
+  uint8_t rec_len;
+  int32_t v;
+  int r;
+
+  m->present = 0;
+  if(msg_senml_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_senml_next(&s, &rec, &rec_len, &v)) > 0) {
+    switch(rec_len) {
+    case 1:
+      if(memcmp(rec, "t", 1) == 0) {
+        m->t = v;
+        m->present |= MSG_ROOF_T;
+      }
+      break;
+    case 3:
+      if(memcmp(rec, "sol", 3) == 0) {
+        m->solar = v;
+        m->present |= MSG_ROOF_SOLAR;
+      } else if(memcmp(rec, "ora", 3) == 0) {
+        m->ora = v;
+        m->present |= MSG_ROOF_ORA;
+      } else if(memcmp(rec, "hum", 3) == 0) {
+        m->humid = v;
+        m->present |= MSG_ROOF_HUMID;
+      } else if(memcmp(rec, "seq", 3) == 0) {
+        m->seq = v;
+        m->present |= MSG_ROOF_SEQ;
+      }
+      break;
+    case 4:
+      if(memcmp(rec, "mese", 4) == 0) {
+        m->mese = v;
+        m->present |= MSG_ROOF_MESE;
+      } else if(memcmp(rec, "temp", 4) == 0) {
+        m->temp = v;
+        m->present |= MSG_ROOF_TEMP;
+      } else if(memcmp(rec, "nSol", 4) == 0) {
+        m->next_solar = v;
+        m->present |= MSG_ROOF_NEXT_SOLAR;
+      }
+      break;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_ROOF_REQUIRED) != MSG_ROOF_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  if((m->present & MSG_ROOF_MESE) && (m->mese < 1 || m->mese > 12)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_ROOF_ORA) && (m->ora < 0 || m->ora > 23)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_ROOF_SEQ) && (m->seq < 0 || m->seq > 65535)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_ROOF_T) && (m->t < 0)) {
+    return MSG_ERR_RANGE;
+  }
+  return MSG_OK;
+}
+
+int
+msg_roof_encode_senml(const msg_roof_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_senml_open(&w, 8);
+  msg_senml_int(&w, "sol", 3, m->solar);
+  msg_senml_int(&w, "mese", 4, m->mese);
+  msg_senml_int(&w, "ora", 3, m->ora);
+  msg_senml_int(&w, "temp", 4, m->temp);
+  msg_senml_int(&w, "hum", 3, m->humid);
+  msg_senml_int(&w, "nSol", 4, m->next_solar);
+  msg_senml_int(&w, "seq", 3, m->seq);
+  msg_senml_int(&w, "t", 1, m->t);
+  return msg_senml_end(&w);
+}
+
+int
+msg_power_decode(const uint8_t *buf, uint16_t len, msg_power_t *m)
+{
+  msg_scan_t s;
+  const char *key;
+  uint8_t key_len;
+  int r;
+
+  m->present = 0;
+  if(msg_scan_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {
+    switch(key_len) {
+    case 1:
+      if(memcmp(key, "t", 1) == 0) {
+        r = msg_scan_int(&s, &m->t);
+        m->present |= MSG_POWER_T;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 3:
+      if(memcmp(key, "seq", 3) == 0) {
+        r = msg_scan_int(&s, &m->seq);
+        m->present |= MSG_POWER_SEQ;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 5:
+      if(memcmp(key, "power", 5) == 0) {
+        r = msg_scan_int(&s, &m->power);
+        m->present |= MSG_POWER_POWER;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    default:
+      r = msg_scan_skip(&s);
+    }
+    if(r < 0) {
+      return MSG_ERR_SYNTAX;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_POWER_REQUIRED) != MSG_POWER_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  if((m->present & MSG_POWER_SEQ) && (m->seq < 0 || m->seq > 65535)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_POWER_T) && (m->t < 0)) {
+    return MSG_ERR_RANGE;
+  }
+  return MSG_OK;
+}
+
+int
+msg_power_encode(const msg_power_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_put_raw(&w, "{\"power\":", 9);
+  msg_put_int(&w, m->power);
+  msg_put_raw(&w, ",\"seq\":", 7);
+  msg_put_int(&w, m->seq);
+  msg_put_raw(&w, ",\"t\":", 5);
+  msg_put_int(&w, m->t);
+  msg_put_raw(&w, "}", 1);
+  return msg_writer_end(&w);
+}
+
+int
+msg_power_decode_senml(const uint8_t *buf, uint16_t len, msg_power_t *m)
+{
+  msg_cbor_t s;
+  const char *rec;
+  uint8_t rec_len;
+  int32_t v;
+  int r;
+
+  m->present = 0;
+  if(msg_senml_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_senml_next(&s, &rec, &rec_len, &v)) > 0) {
+    switch(rec_len) {
+    case 1:
+      if(memcmp(rec, "t", 1) == 0) {
+        m->t = v;
+        m->present |= MSG_POWER_T;
+      }
+      break;
+    case 3:
+      if(memcmp(rec, "pow", 3) == 0) {
+        m->power = v;
+        m->present |= MSG_POWER_POWER;
+      } else if(memcmp(rec, "seq", 3) == 0) {
+        m->seq = v;
+        m->present |= MSG_POWER_SEQ;
+      }
+      break;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_POWER_REQUIRED) != MSG_POWER_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  if((m->present & MSG_POWER_SEQ) && (m->seq < 0 || m->seq > 65535)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_POWER_T) && (m->t < 0)) {
+    return MSG_ERR_RANGE;
+  }
+  return MSG_OK;
+}
+
+int
+msg_power_encode_senml(const msg_power_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_senml_open(&w, 3);
+  msg_senml_int(&w, "pow", 3, m->power);
+  msg_senml_int(&w, "seq", 3, m->seq);
+  msg_senml_int(&w, "t", 1, m->t);
+  return msg_senml_end(&w);
+}
+
+int
+msg_threshold_set_decode(const uint8_t *buf, uint16_t len, msg_threshold_set_t *m)
+{
+  msg_scan_t s;
+  const char *key;
+  uint8_t key_len;
+  int r;
+
+  m->present = 0;
+  if(msg_scan_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {
+    switch(key_len) {
+    case 12:
+      if(memcmp(key, "threshold_on", 12) == 0) {
+        r = msg_scan_int(&s, &m->threshold_on);
+        m->present |= MSG_THRESHOLD_SET_THRESHOLD_ON;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 13:
+      if(memcmp(key, "threshold_off", 13) == 0) {
+        r = msg_scan_int(&s, &m->threshold_off);
+        m->present |= MSG_THRESHOLD_SET_THRESHOLD_OFF;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 17:
+      if(memcmp(key, "auto_furnace_ctrl", 17) == 0) {
+        r = msg_scan_int(&s, &m->auto_furnace_ctrl);
+        m->present |= MSG_THRESHOLD_SET_AUTO_FURNACE_CTRL;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    default:
+      r = msg_scan_skip(&s);
+    }
+    if(r < 0) {
+      return MSG_ERR_SYNTAX;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_THRESHOLD_SET_REQUIRED) != MSG_THRESHOLD_SET_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  if((m->present & MSG_THRESHOLD_SET_AUTO_FURNACE_CTRL) && (m->auto_furnace_ctrl < 0 || m->auto_furnace_ctrl > 1)) {
+    return MSG_ERR_RANGE;
+  }
+  return MSG_OK;
+}
+
+int
+msg_threshold_encode(const msg_threshold_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_put_raw(&w, "{\"auto_furnace_ctrl\":", 21);
+  msg_put_int(&w, m->auto_furnace_ctrl);
+  msg_put_raw(&w, ",\"on_threshold\":", 16);
+  msg_put_int(&w, m->on_threshold);
+  msg_put_raw(&w, ",\"off_threshold\":", 17);
+  msg_put_int(&w, m->off_threshold);
+  msg_put_raw(&w, "}", 1);
+  return msg_writer_end(&w);
+}
+
+int
+msg_furnace_decode(const uint8_t *buf, uint16_t len, msg_furnace_t *m)
+{
+  msg_scan_t s;
+  const char *key;
+  uint8_t key_len;
+  int r;
+
+  m->present = 0;
+  if(msg_scan_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {
+    switch(key_len) {
+    case 13:
+      if(memcmp(key, "furnace_state", 13) == 0) {
+        r = msg_scan_int(&s, &m->furnace_state);
+        m->present |= MSG_FURNACE_FURNACE_STATE;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    default:
+      r = msg_scan_skip(&s);
+    }
+    if(r < 0) {
+      return MSG_ERR_SYNTAX;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_FURNACE_REQUIRED) != MSG_FURNACE_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  if((m->present & MSG_FURNACE_FURNACE_STATE) && (m->furnace_state < 0 || m->furnace_state > 1)) {
+    return MSG_ERR_RANGE;
+  }
+  return MSG_OK;
+}
+
+int
+msg_furnace_encode(const msg_furnace_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_put_raw(&w, "{\"furnace_state\":", 17);
+  msg_put_int(&w, m->furnace_state);
+  msg_put_raw(&w, "}", 1);
+  return msg_writer_end(&w);
+}
+
+int
+msg_alarm_decode(const uint8_t *buf, uint16_t len, msg_alarm_t *m)
+{
+  msg_scan_t s;
+  const char *key;
+  uint8_t key_len;
+  int r;
+
+  m->present = 0;
+  if(msg_scan_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {
+    switch(key_len) {
+    case 11:
+      if(memcmp(key, "alarm_state", 11) == 0) {
+        r = msg_scan_int(&s, &m->alarm_state);
+        m->present |= MSG_ALARM_ALARM_STATE;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    default:
+      r = msg_scan_skip(&s);
+    }
+    if(r < 0) {
+      return MSG_ERR_SYNTAX;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_ALARM_REQUIRED) != MSG_ALARM_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  if((m->present & MSG_ALARM_ALARM_STATE) && (m->alarm_state < 0 || m->alarm_state > 3)) {
+    return MSG_ERR_RANGE;
+  }
+  return MSG_OK;
+}
+
+int
+msg_alarm_encode(const msg_alarm_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_put_raw(&w, "{\"alarm_state\":", 15);
+  msg_put_int(&w, m->alarm_state);
+  msg_put_raw(&w, "}", 1);
+  return msg_writer_end(&w);
+}
+
+int
+msg_group_decode(const uint8_t *buf, uint16_t len, msg_group_t *m)
+{
+  msg_scan_t s;
+  const char *key;
+  uint8_t key_len;
+  int r;
+
+  m->present = 0;
+  if(msg_scan_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {
+    switch(key_len) {
+    case 3:
+      if(memcmp(key, "ack", 3) == 0) {
+        r = msg_scan_int(&s, &m->ack);
+        m->present |= MSG_GROUP_ACK;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 4:
+      if(memcmp(key, "gseq", 4) == 0) {
+        r = msg_scan_int(&s, &m->gseq);
+        m->present |= MSG_GROUP_GSEQ;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 11:
+      if(memcmp(key, "alarm_state", 11) == 0) {
+        r = msg_scan_int(&s, &m->alarm_state);
+        m->present |= MSG_GROUP_ALARM_STATE;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 13:
+      if(memcmp(key, "furnace_state", 13) == 0) {
+        r = msg_scan_int(&s, &m->furnace_state);
+        m->present |= MSG_GROUP_FURNACE_STATE;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    default:
+      r = msg_scan_skip(&s);
+    }
+    if(r < 0) {
+      return MSG_ERR_SYNTAX;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_GROUP_REQUIRED) != MSG_GROUP_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  if((m->present & MSG_GROUP_FURNACE_STATE) && (m->furnace_state < 0 || m->furnace_state > 1)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_GROUP_ALARM_STATE) && (m->alarm_state < 0 || m->alarm_state > 3)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_GROUP_GSEQ) && (m->gseq < 0 || m->gseq > 65535)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_GROUP_ACK) && (m->ack < 0 || m->ack > 3)) {
+    return MSG_ERR_RANGE;
+  }
+  return MSG_OK;
+}
+
+int
+msg_group_encode(const msg_group_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_put_raw(&w, "{\"furnace_state\":", 17);
+  msg_put_int(&w, m->furnace_state);
+  msg_put_raw(&w, ",\"alarm_state\":", 15);
+  msg_put_int(&w, m->alarm_state);
+  msg_put_raw(&w, ",\"gseq\":", 8);
+  msg_put_int(&w, m->gseq);
+  msg_put_raw(&w, ",\"ack\":", 7);
+  msg_put_int(&w, m->ack);
+  msg_put_raw(&w, "}", 1);
+  return msg_writer_end(&w);
+}
+
+int
+msg_data_encode(const msg_data_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_put_raw(&w, "{\"ts\":", 6);
+  msg_put_str(&w, m->ts.s, m->ts.len);
+  msg_put_raw(&w, ",\"sol\":", 7);
+  msg_put_int(&w, m->sol);
+  msg_put_raw(&w, ",\"mese\":", 8);
+  msg_put_int(&w, m->mese);
+  msg_put_raw(&w, ",\"ora\":", 7);
+  msg_put_int(&w, m->ora);
+  msg_put_raw(&w, ",\"temp\":", 8);
+  msg_put_int(&w, m->temp);
+  msg_put_raw(&w, ",\"hum\":", 7);
+  msg_put_int(&w, m->hum);
+  msg_put_raw(&w, ",\"pow\":", 7);
+  msg_put_int(&w, m->pow);
+  msg_put_raw(&w, "}", 1);
+  return msg_writer_end(&w);
+}
+
+int
+msg_data_encode_senml(const msg_data_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_senml_open(&w, 6);
+  msg_senml_int_bt(&w, "sol", 3, m->sol, &m->ts);
+  msg_senml_int(&w, "mese", 4, m->mese);
+  msg_senml_int(&w, "ora", 3, m->ora);
+  msg_senml_int(&w, "temp", 4, m->temp);
+  msg_senml_int(&w, "hum", 3, m->hum);
+  msg_senml_int(&w, "pow", 3, m->pow);
+  return msg_senml_end(&w);
+}
+
+int
+msg_prediction_encode(const msg_prediction_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_put_raw(&w, "{\"ts\":", 6);
+  msg_put_str(&w, m->ts.s, m->ts.len);
+  msg_put_raw(&w, ",\"nPow\":", 8);
+  msg_put_int(&w, m->next_power);
+  msg_put_raw(&w, ",\"nSol\":", 8);
+  msg_put_int(&w, m->next_solar);
+  msg_put_raw(&w, ",\"miss\":", 8);
+  msg_put_int(&w, m->miss);
+  msg_put_raw(&w, "}", 1);
+  return msg_writer_end(&w);
+}
+
+int
+msg_prediction_encode_senml(const msg_prediction_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_senml_open(&w, 3);
+  msg_senml_int_bt(&w, "nPow", 4, m->next_power, &m->ts);
+  msg_senml_int(&w, "nSol", 4, m->next_solar);
+  msg_senml_int(&w, "miss", 4, m->miss);
+  return msg_senml_end(&w);
+}
+
+int
+msg_batch_set_decode(const uint8_t *buf, uint16_t len, msg_batch_set_t *m)
+{
+  msg_scan_t s;
+  const char *key;
+  uint8_t key_len;
+  int r;
+
+  m->present = 0;
+  if(msg_scan_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {
+    switch(key_len) {
+    case 4:
+      if(memcmp(key, "size", 4) == 0) {
+        r = msg_scan_int(&s, &m->size);
+        m->present |= MSG_BATCH_SET_SIZE;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    case 5:
+      if(memcmp(key, "delay", 5) == 0) {
+        r = msg_scan_int(&s, &m->delay);
+        m->present |= MSG_BATCH_SET_DELAY;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    default:
+      r = msg_scan_skip(&s);
+    }
+    if(r < 0) {
+      return MSG_ERR_SYNTAX;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_BATCH_SET_REQUIRED) != MSG_BATCH_SET_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  if((m->present & MSG_BATCH_SET_SIZE) && (m->size < 1 || m->size > 16)) {
+    return MSG_ERR_RANGE;
+  }
+  if((m->present & MSG_BATCH_SET_DELAY) && (m->delay < 1 || m->delay > 3600)) {
+    return MSG_ERR_RANGE;
+  }
+  return MSG_OK;
+}
+
+int
+msg_batch_encode(const msg_batch_t *m, char *buf, uint16_t size)
+{
+  msg_writer_t w = { buf, size, 0, 0 };
+
+  msg_put_raw(&w, "{\"size\":", 8);
+  msg_put_int(&w, m->size);
+  msg_put_raw(&w, ",\"delay\":", 9);
+  msg_put_int(&w, m->delay);
+  msg_put_raw(&w, ",\"pending\":", 11);
+  msg_put_int(&w, m->pending);
+  msg_put_raw(&w, ",\"sent\":", 8);
+  msg_put_int(&w, m->sent);
+  msg_put_raw(&w, ",\"lost\":", 8);
+  msg_put_int(&w, m->lost);
+  msg_put_raw(&w, ",\"jdepth\":", 10);
+  msg_put_int(&w, m->jdepth);
+  msg_put_raw(&w, ",\"jin\":", 7);
+  msg_put_int(&w, m->jin);
+  msg_put_raw(&w, ",\"jout\":", 8);
+  msg_put_int(&w, m->jout);
+  msg_put_raw(&w, ",\"jlost\":", 9);
+  msg_put_int(&w, m->jlost);
+  msg_put_raw(&w, ",\"jrate\":", 9);
+  msg_put_int(&w, m->jrate);
+  msg_put_raw(&w, "}", 1);
+  return msg_writer_end(&w);
+}
+
+int
+msg_lookup_decode(const uint8_t *buf, uint16_t len, msg_lookup_t *m)
+{
+  msg_scan_t s;
+  const char *key;
+  uint8_t key_len;
+  int r;
+
+  m->present = 0;
+  if(msg_scan_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {
+    switch(key_len) {
+    case 2:
+      if(memcmp(key, "ip", 2) == 0) {
+        r = msg_scan_str(&s, &m->ip);
+        m->present |= MSG_LOOKUP_IP;
+      } else if(memcmp(key, "ct", 2) == 0) {
+        r = msg_scan_int(&s, &m->ct);
+        m->present |= MSG_LOOKUP_CT;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    default:
+      r = msg_scan_skip(&s);
+    }
+    if(r < 0) {
+      return MSG_ERR_SYNTAX;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_LOOKUP_REQUIRED) != MSG_LOOKUP_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  return MSG_OK;
+}
+
+int
+msg_timestamp_decode(const uint8_t *buf, uint16_t len, msg_timestamp_t *m)
+{
+  msg_scan_t s;
+  const char *key;
+  uint8_t key_len;
+  int r;
+
+  m->present = 0;
+  if(msg_scan_begin(&s, buf, len) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {
+    switch(key_len) {
+    case 9:
+      if(memcmp(key, "timestamp", 9) == 0) {
+        r = msg_scan_str(&s, &m->timestamp);
+        m->present |= MSG_TIMESTAMP_TIMESTAMP;
+      } else {
+        r = msg_scan_skip(&s);
+      }
+      break;
+    default:
+      r = msg_scan_skip(&s);
+    }
+    if(r < 0) {
+      return MSG_ERR_SYNTAX;
+    }
+  }
+  if(r < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  if((m->present & MSG_TIMESTAMP_REQUIRED) != MSG_TIMESTAMP_REQUIRED) {
+    return MSG_ERR_MISSING;
+  }
+  return MSG_OK;
+}
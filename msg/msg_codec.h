@@ -0,0 +1,208 @@
+/* Generato da tools/msg_codegen.py a partire da msg/messages.json: non modificare */
+#ifndef MSG_CODEC_H_
+#define MSG_CODEC_H_
+
+#include "msg_json.h"
+#include "msg_cbor.h"
+
+/* PUT /res_roof, dal nodo roof all'edge: seq e t (epoch della misura, 0 se non sincronizzato) allineano il campione a quello di power */
+typedef struct msg_roof {
+  int32_t solar;
+  int32_t mese;
+  int32_t ora;
+  int32_t temp;
+  int32_t humid;
+  int32_t next_solar;
+  int32_t seq;
+  int32_t t;
+  uint16_t present;
+} msg_roof_t;
+#define MSG_ROOF_SOLAR 0x0001
+#define MSG_ROOF_MESE 0x0002
+#define MSG_ROOF_ORA 0x0004
+#define MSG_ROOF_TEMP 0x0008
+#define MSG_ROOF_HUMID 0x0010
+#define MSG_ROOF_NEXT_SOLAR 0x0020
+#define MSG_ROOF_SEQ 0x0040
+#define MSG_ROOF_T 0x0080
+#define MSG_ROOF_REQUIRED 0x003f
+int msg_roof_decode(const uint8_t *buf, uint16_t len, msg_roof_t *m);
+int msg_roof_encode(const msg_roof_t *m, char *buf, uint16_t size);
+int msg_roof_decode_senml(const uint8_t *buf, uint16_t len, msg_roof_t *m);
+int msg_roof_encode_senml(const msg_roof_t *m, char *buf, uint16_t size);
+
+/* PUT /res_power, dal nodo power all'edge: seq e t come in roof */
+typedef struct msg_power {
+  int32_t power;
+  int32_t seq;
+  int32_t t;
+  uint16_t present;
+} msg_power_t;
+#define MSG_POWER_POWER 0x0001
+#define MSG_POWER_SEQ 0x0002
+#define MSG_POWER_T 0x0004
+#define MSG_POWER_REQUIRED 0x0001
+int msg_power_decode(const uint8_t *buf, uint16_t len, msg_power_t *m);
+int msg_power_encode(const msg_power_t *m, char *buf, uint16_t size);
+int msg_power_decode_senml(const uint8_t *buf, uint16_t len, msg_power_t *m);
+int msg_power_encode_senml(const msg_power_t *m, char *buf, uint16_t size);
+
+/* PUT /res_threshold: uno o piu' campi, quelli assenti restano invariati */
+typedef struct msg_threshold_set {
+  int32_t threshold_on;
+  int32_t threshold_off;
+  int32_t auto_furnace_ctrl;
+  uint16_t present;
+} msg_threshold_set_t;
+#define MSG_THRESHOLD_SET_THRESHOLD_ON 0x0001
+#define MSG_THRESHOLD_SET_THRESHOLD_OFF 0x0002
+#define MSG_THRESHOLD_SET_AUTO_FURNACE_CTRL 0x0004
+#define MSG_THRESHOLD_SET_REQUIRED 0x0000
+int msg_threshold_set_decode(const uint8_t *buf, uint16_t len, msg_threshold_set_t *m);
+
+/* GET e notifiche di /res_threshold */
+typedef struct msg_threshold {
+  int32_t auto_furnace_ctrl;
+  int32_t on_threshold;
+  int32_t off_threshold;
+  uint16_t present;
+} msg_threshold_t;
+#define MSG_THRESHOLD_AUTO_FURNACE_CTRL 0x0001
+#define MSG_THRESHOLD_ON_THRESHOLD 0x0002
+#define MSG_THRESHOLD_OFF_THRESHOLD 0x0004
+#define MSG_THRESHOLD_REQUIRED 0x0007
+int msg_threshold_encode(const msg_threshold_t *m, char *buf, uint16_t size);
+
+/* PUT, GET e notifiche di /res_furnace */
+typedef struct msg_furnace {
+  int32_t furnace_state;
+  uint16_t present;
+} msg_furnace_t;
+#define MSG_FURNACE_FURNACE_STATE 0x0001
+#define MSG_FURNACE_REQUIRED 0x0001
+int msg_furnace_decode(const uint8_t *buf, uint16_t len, msg_furnace_t *m);
+int msg_furnace_encode(const msg_furnace_t *m, char *buf, uint16_t size);
+
+/* PUT di /res_alarm (GET e notifiche sono text/plain) */
+typedef struct msg_alarm {
+  int32_t alarm_state;
+  uint16_t present;
+} msg_alarm_t;
+#define MSG_ALARM_ALARM_STATE 0x0001
+#define MSG_ALARM_REQUIRED 0x0001
+int msg_alarm_decode(const uint8_t *buf, uint16_t len, msg_alarm_t *m);
+int msg_alarm_encode(const msg_alarm_t *m, char *buf, uint16_t size);
+
+/* PUT multicast di /res_group, dall'edge a tutti gli attuatori: ack chiede la notifica anche a stato invariato (bit 0 furnace, bit 1 alarm) */
+typedef struct msg_group {
+  int32_t furnace_state;
+  int32_t alarm_state;
+  int32_t gseq;
+  int32_t ack;
+  uint16_t present;
+} msg_group_t;
+#define MSG_GROUP_FURNACE_STATE 0x0001
+#define MSG_GROUP_ALARM_STATE 0x0002
+#define MSG_GROUP_GSEQ 0x0004
+#define MSG_GROUP_ACK 0x0008
+#define MSG_GROUP_REQUIRED 0x000f
+int msg_group_decode(const uint8_t *buf, uint16_t len, msg_group_t *m);
+int msg_group_encode(const msg_group_t *m, char *buf, uint16_t size);
+
+/* POST /res_data, dall'edge al server */
+typedef struct msg_data {
+  msg_str_t ts;
+  int32_t sol;
+  int32_t mese;
+  int32_t ora;
+  int32_t temp;
+  int32_t hum;
+  int32_t pow;
+  uint16_t present;
+} msg_data_t;
+#define MSG_DATA_TS 0x0001
+#define MSG_DATA_SOL 0x0002
+#define MSG_DATA_MESE 0x0004
+#define MSG_DATA_ORA 0x0008
+#define MSG_DATA_TEMP 0x0010
+#define MSG_DATA_HUM 0x0020
+#define MSG_DATA_POW 0x0040
+#define MSG_DATA_REQUIRED 0x007f
+int msg_data_encode(const msg_data_t *m, char *buf, uint16_t size);
+int msg_data_encode_senml(const msg_data_t *m, char *buf, uint16_t size);
+
+/* POST /res_prediction, dall'edge al server */
+typedef struct msg_prediction {
+  msg_str_t ts;
+  int32_t next_power;
+  int32_t next_solar;
+  int32_t miss;
+  uint16_t present;
+} msg_prediction_t;
+#define MSG_PREDICTION_TS 0x0001
+#define MSG_PREDICTION_NEXT_POWER 0x0002
+#define MSG_PREDICTION_NEXT_SOLAR 0x0004
+#define MSG_PREDICTION_MISS 0x0008
+#define MSG_PREDICTION_REQUIRED 0x000f
+int msg_prediction_encode(const msg_prediction_t *m, char *buf, uint16_t size);
+int msg_prediction_encode_senml(const msg_prediction_t *m, char *buf, uint16_t size);
+
+/* PUT /res_batch: record per invio (1 = un POST per ciclo) e attesa massima in secondi */
+typedef struct msg_batch_set {
+  int32_t size;
+  int32_t delay;
+  uint16_t present;
+} msg_batch_set_t;
+#define MSG_BATCH_SET_SIZE 0x0001
+#define MSG_BATCH_SET_DELAY 0x0002
+#define MSG_BATCH_SET_REQUIRED 0x0000
+int msg_batch_set_decode(const uint8_t *buf, uint16_t len, msg_batch_set_t *m);
+
+/* GET di /res_batch: configurazione, record in attesa, batch consegnati, record persi e journal su flash (record da recuperare, scritti, recuperati, scartati, record/min del recupero) */
+typedef struct msg_batch {
+  int32_t size;
+  int32_t delay;
+  int32_t pending;
+  int32_t sent;
+  int32_t lost;
+  int32_t jdepth;
+  int32_t jin;
+  int32_t jout;
+  int32_t jlost;
+  int32_t jrate;
+  uint16_t present;
+} msg_batch_t;
+#define MSG_BATCH_SIZE 0x0001
+#define MSG_BATCH_DELAY 0x0002
+#define MSG_BATCH_PENDING 0x0004
+#define MSG_BATCH_SENT 0x0008
+#define MSG_BATCH_LOST 0x0010
+#define MSG_BATCH_JDEPTH 0x0020
+#define MSG_BATCH_JIN 0x0040
+#define MSG_BATCH_JOUT 0x0080
+#define MSG_BATCH_JLOST 0x0100
+#define MSG_BATCH_JRATE 0x0200
+#define MSG_BATCH_REQUIRED 0x03ff
+int msg_batch_encode(const msg_batch_t *m, char *buf, uint16_t size);
+
+/* Risposta del server a GET /lookup?res=...: ct e' il Content-Format binario accettato dalla risorsa */
+typedef struct msg_lookup {
+  msg_str_t ip;
+  int32_t ct;
+  uint16_t present;
+} msg_lookup_t;
+#define MSG_LOOKUP_IP 0x0001
+#define MSG_LOOKUP_CT 0x0002
+#define MSG_LOOKUP_REQUIRED 0x0001
+int msg_lookup_decode(const uint8_t *buf, uint16_t len, msg_lookup_t *m);
+
+/* Risposta del server a GET /register (UNIX epoch come stringa) */
+typedef struct msg_timestamp {
+  msg_str_t timestamp;
+  uint16_t present;
+} msg_timestamp_t;
+#define MSG_TIMESTAMP_TIMESTAMP 0x0001
+#define MSG_TIMESTAMP_REQUIRED 0x0001
+int msg_timestamp_decode(const uint8_t *buf, uint16_t len, msg_timestamp_t *m);
+
+#endif /* MSG_CODEC_H_ */
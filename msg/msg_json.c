@@ -0,0 +1,242 @@
+#include "msg_json.h"
+
+#include <string.h>
+
+#define IS_SPACE(c) ((c) == ' ' || (c) == '\t' || (c) == '\r' || (c) == '\n')
+
+static void
+skip_space(msg_scan_t *s)
+{
+  while(s->p < s->end && IS_SPACE(*s->p)) {
+    s->p++;
+  }
+}
+
+int
+msg_scan_begin(msg_scan_t *s, const uint8_t *buf, uint16_t len)
+{
+  s->p = (const char *)buf;
+  s->end = s->p + len;
+  s->first = 1;
+  if(buf == NULL) {
+    return MSG_ERR_SYNTAX;
+  }
+  skip_space(s);
+  if(s->p == s->end || *s->p != '{') {
+    return MSG_ERR_SYNTAX;
+  }
+  s->p++;
+  return MSG_OK;
+}
+
+// Stringa tra virgolette: lascia s->p dopo la virgoletta di chiusura
+static int
+scan_quoted(msg_scan_t *s, const char **start, uint16_t *len)
+{
+  const char *q;
+
+  if(s->p == s->end || *s->p != '"') {
+    return MSG_ERR_SYNTAX;
+  }
+  q = ++s->p;
+  while(q < s->end && *q != '"') {
+    if(*q == '\\') {
+      if(++q == s->end) {
+        return MSG_ERR_SYNTAX;
+      }
+    }
+    q++;
+  }
+  if(q == s->end) {
+    return MSG_ERR_SYNTAX;
+  }
+  *start = s->p;
+  *len = (uint16_t)(q - s->p);
+  s->p = q + 1;
+  return MSG_OK;
+}
+
+int
+msg_scan_key(msg_scan_t *s, const char **key, uint8_t *key_len)
+{
+  uint16_t len;
+
+  skip_space(s);
+  if(s->p == s->end) {
+    return MSG_ERR_SYNTAX;
+  }
+  if(*s->p == '}') {
+    s->p++;
+    return 0;
+  }
+  if(!s->first) {
+    if(*s->p != ',') {
+      return MSG_ERR_SYNTAX;
+    }
+    s->p++;
+    skip_space(s);
+  }
+  s->first = 0;
+
+  if(scan_quoted(s, key, &len) < 0 || len > 0xff) {
+    return MSG_ERR_SYNTAX;
+  }
+  *key_len = (uint8_t)len;
+  skip_space(s);
+  if(s->p == s->end || *s->p != ':') {
+    return MSG_ERR_SYNTAX;
+  }
+  s->p++;
+  skip_space(s);
+  return 1;
+}
+
+int
+msg_scan_int(msg_scan_t *s, int32_t *v)
+{
+  uint32_t acc = 0;
+  uint32_t limit = INT32_MAX;
+  uint8_t neg = 0;
+  const char *start;
+
+  if(s->p < s->end && *s->p == '-') {
+    neg = 1;
+    limit = (uint32_t)INT32_MAX + 1;
+    s->p++;
+  }
+  start = s->p;
+  while(s->p < s->end && *s->p >= '0' && *s->p <= '9') {
+    uint8_t d = (uint8_t)(*s->p - '0');
+    if(acc > (limit - d) / 10) {
+      return MSG_ERR_SYNTAX;
+    }
+    acc = acc * 10 + d;
+    s->p++;
+  }
+  // Niente cifre, oppure decimali/esponente: non e' un intero
+  if(s->p == start || (s->p < s->end && (*s->p == '.' || *s->p == 'e' || *s->p == 'E'))) {
+    return MSG_ERR_SYNTAX;
+  }
+  *v = neg ? (int32_t)(0 - acc) : (int32_t)acc;
+  return MSG_OK;
+}
+
+int
+msg_scan_str(msg_scan_t *s, msg_str_t *v)
+{
+  return scan_quoted(s, &v->s, &v->len);
+}
+
+int
+msg_scan_skip(msg_scan_t *s)
+{
+  uint8_t depth = 0;
+  const char *str;
+  uint16_t len;
+
+  while(s->p < s->end) {
+    char c = *s->p;
+    if(c == '"') {
+      if(scan_quoted(s, &str, &len) < 0) {
+        return MSG_ERR_SYNTAX;
+      }
+      if(depth == 0) {
+        return MSG_OK;
+      }
+      continue;
+    }
+    if(c == '{' || c == '[') {
+      depth++;
+    } else if(c == '}' || c == ']') {
+      if(depth == 0) {
+        return MSG_OK; // fine dell'oggetto che contiene il valore
+      }
+      if(--depth == 0) {
+        s->p++;
+        return MSG_OK;
+      }
+    } else if(depth == 0 && (c == ',' || IS_SPACE(c))) {
+      return MSG_OK;
+    }
+    s->p++;
+  }
+  return depth == 0 ? MSG_OK : MSG_ERR_SYNTAX;
+}
+
+int
+msg_decode_int(const uint8_t *buf, uint16_t len, int32_t *v)
+{
+  msg_scan_t s;
+
+  if(buf == NULL) {
+    return MSG_ERR_SYNTAX;
+  }
+  s.p = (const char *)buf;
+  s.end = s.p + len;
+  skip_space(&s);
+  if(msg_scan_int(&s, v) < 0) {
+    return MSG_ERR_SYNTAX;
+  }
+  skip_space(&s);
+  return s.p == s.end ? MSG_OK : MSG_ERR_SYNTAX;
+}
+
+int
+msg_str_copy(const msg_str_t *v, char *dst, uint16_t size)
+{
+  if(v->len >= size) {
+    return 0;
+  }
+  memcpy(dst, v->s, v->len);
+  dst[v->len] = '\0';
+  return 1;
+}
+
+void
+msg_put_raw(msg_writer_t *w, const char *s, uint16_t n)
+{
+  if(w->full || w->len + n >= w->size) {
+    w->full = 1;
+    return;
+  }
+  memcpy(w->buf + w->len, s, n);
+  w->len += n;
+}
+
+void
+msg_put_int(msg_writer_t *w, int32_t v)
+{
+  char digits[11];
+  uint8_t n = 0;
+  uint32_t u = v < 0 ? 0 - (uint32_t)v : (uint32_t)v;
+
+  do {
+    digits[sizeof(digits) - 1 - n++] = (char)('0' + u % 10);
+    u /= 10;
+  } while(u > 0);
+  if(v < 0) {
+    digits[sizeof(digits) - 1 - n++] = '-';
+  }
+  msg_put_raw(w, digits + sizeof(digits) - n, n);
+}
+
+void
+msg_put_str(msg_writer_t *w, const char *s, uint16_t n)
+{
+  msg_put_raw(w, "\"", 1);
+  msg_put_raw(w, s, n);
+  msg_put_raw(w, "\"", 1);
+}
+
+int
+msg_writer_end(msg_writer_t *w)
+{
+  if(w->full || w->len >= w->size) {
+    if(w->size > 0) {
+      w->buf[0] = '\0';
+    }
+    return MSG_ERR_SPACE;
+  }
+  w->buf[w->len] = '\0';
+  return w->len;
+}
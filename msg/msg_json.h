@@ -0,0 +1,76 @@
+/*
+ * Scansione e scrittura JSON per i codec generati da tools/msg_codegen.py
+ * a partire da msg/messages.json (msg/msg_codec.h).
+ *
+ * Lo scanner lavora direttamente sul payload CoAP, puntatore e lunghezza
+ * senza terminatore: una sola passata, chiavi in qualsiasi ordine, spazi
+ * ammessi ovunque e valori di chiavi sconosciute saltati. Le stringhe
+ * sono restituite come puntatore e lunghezza dentro il payload, senza
+ * copie ne' sequenze di escape risolte.
+ */
+#ifndef MSG_JSON_H_
+#define MSG_JSON_H_
+
+#include <stdint.h>
+
+#define MSG_OK           0
+#define MSG_ERR_SYNTAX  -1 /* JSON non valido o valore del tipo sbagliato */
+#define MSG_ERR_MISSING -2 /* manca un campo obbligatorio dello schema */
+#define MSG_ERR_RANGE   -3 /* valore fuori dal dominio dello schema */
+#define MSG_ERR_SPACE   -4 /* buffer di uscita troppo piccolo */
+
+/* Confronto dei parser con sscanf all'avvio dell'edge (msg/msg_bench.c) */
+#ifdef MSG_CONF_BENCH
+#define MSG_BENCH MSG_CONF_BENCH
+#else
+#define MSG_BENCH 0
+#endif
+
+typedef struct msg_scan {
+  const char *p;
+  const char *end;
+  uint8_t first;         /* nessuna chiave letta: niente virgola prima */
+} msg_scan_t;
+
+typedef struct msg_str {
+  const char *s;         /* dentro il payload, non terminata */
+  uint16_t len;
+} msg_str_t;
+
+typedef struct msg_writer {
+  char *buf;
+  uint16_t size;
+  uint16_t len;
+  uint8_t full;
+} msg_writer_t;
+
+/* Apre l'oggetto JSON di primo livello */
+int msg_scan_begin(msg_scan_t *s, const uint8_t *buf, uint16_t len);
+
+/* Chiave successiva: 1 con lo scanner sul valore, 0 a fine oggetto, <0 errore */
+int msg_scan_key(msg_scan_t *s, const char **key, uint8_t *key_len);
+
+int msg_scan_int(msg_scan_t *s, int32_t *v);
+int msg_scan_str(msg_scan_t *s, msg_str_t *v);
+
+/* Salta il valore corrente (anche oggetti e array annidati) */
+int msg_scan_skip(msg_scan_t *s);
+
+/* Payload text/plain con un solo intero (es. GET di /res_alarm) */
+int msg_decode_int(const uint8_t *buf, uint16_t len, int32_t *v);
+
+/* Copia una stringa dello schema in un buffer terminato, 0 se non ci sta */
+int msg_str_copy(const msg_str_t *v, char *dst, uint16_t size);
+
+void msg_put_raw(msg_writer_t *w, const char *s, uint16_t n);
+void msg_put_int(msg_writer_t *w, int32_t v);
+void msg_put_str(msg_writer_t *w, const char *s, uint16_t n);
+
+/* Termina il buffer, ritorna la lunghezza scritta o MSG_ERR_SPACE */
+int msg_writer_end(msg_writer_t *w);
+
+#if MSG_BENCH
+void msg_bench_run(void);
+#endif
+
+#endif /* MSG_JSON_H_ */
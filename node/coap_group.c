@@ -0,0 +1,141 @@
+#include "coap_group.h"
+#include "net/ipv6/uip.h"
+#include "net/ipv6/uip-ds6.h"
+#include "sys/ctimer.h"
+#include "sys/log.h"
+#include <string.h>
+
+#define LOG_MODULE "CoapGroup"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+static coap_group_stats_t stats;
+static coap_group_handler_t handler;
+static coap_group_timeout_t timeout_cb;
+static uint8_t pending;
+static struct ctimer ack_timer;
+
+static void res_group_put_handler(coap_message_t *request, coap_message_t *response,
+                                  uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+RESOURCE(res_group,
+         "title=\"Group command\";rt=\"group\"",
+         NULL,
+         NULL,
+         res_group_put_handler,
+         NULL);
+
+void
+coap_group_addr(uip_ipaddr_t *addr)
+{
+  uip_ip6addr(addr, 0xff05, 0, 0, 0, 0, 0, 1, COAP_GROUP_ID);
+}
+
+int
+coap_group_join(coap_group_handler_t h)
+{
+  uip_ipaddr_t addr;
+
+  handler = h;
+  coap_activate_resource(&res_group, "res_group");
+  coap_group_addr(&addr);
+  if(uip_ds6_maddr_add(&addr) == NULL) {
+    LOG_WARN("Iscrizione al gruppo fallita\n");
+    return 0;
+  }
+  LOG_INFO("Iscritto al gruppo ff05::1:%x\n", COAP_GROUP_ID);
+  return 1;
+}
+
+int
+coap_group_send(const char *path, const uint8_t *payload, uint16_t len)
+{
+  static uint8_t buf[COAP_MAX_PACKET_SIZE];
+  static coap_message_t message[1];
+  coap_endpoint_t ep;
+  size_t n;
+
+  memset(&ep, 0, sizeof(ep));
+  coap_group_addr(&ep.ipaddr);
+  ep.port = UIP_HTONS(COAP_DEFAULT_PORT);
+
+  coap_init_message(message, COAP_TYPE_NON, COAP_PUT, coap_get_mid());
+  coap_set_header_uri_path(message, path);
+  coap_set_header_content_format(message, APPLICATION_JSON);
+  coap_set_payload(message, payload, len);
+  n = coap_serialize_message(message, buf);
+  if(n == 0 || coap_sendto(&ep, buf, n) <= 0) {
+    return 0;
+  }
+  stats.sent++;
+  return 1;
+}
+
+static void
+ack_timeout(void *ptr)
+{
+  uint8_t p = pending;
+
+  pending = 0;
+  if(p && timeout_cb != NULL) {
+    LOG_WARN("Nessuna conferma dal gruppo (membri 0x%02x), invio in unicast\n", p);
+    stats.fallback += (p & COAP_GROUP_FURNACE ? 1 : 0) + (p & COAP_GROUP_ALARM ? 1 : 0);
+    timeout_cb(p);
+  }
+}
+
+void
+coap_group_expect(uint8_t members, coap_group_timeout_t timeout)
+{
+  pending = members;
+  timeout_cb = timeout;
+  if(members) {
+    ctimer_set(&ack_timer, COAP_GROUP_ACK_TIMEOUT * CLOCK_SECOND, ack_timeout, NULL);
+  } else {
+    ctimer_stop(&ack_timer);
+  }
+}
+
+void
+coap_group_ack(uint8_t member)
+{
+  if(pending & member) {
+    pending &= ~member;
+    stats.acked++;
+    if(!pending) {
+      ctimer_stop(&ack_timer);
+    }
+  }
+}
+
+const coap_group_stats_t *
+coap_group_stats(void)
+{
+  return &stats;
+}
+
+static void
+res_group_put_handler(coap_message_t *request, coap_message_t *response,
+                      uint8_t *buffer, uint16_t preferred_size, int32_t *offset)
+{
+  const uint8_t *payload = NULL;
+  size_t len = coap_get_payload(request, &payload);
+  msg_group_t m;
+
+  if(len == 0 || msg_group_decode(payload, len, &m) != MSG_OK) {
+    LOG_WARN("Comando di gruppo non valido\n");
+    coap_set_status_code(response, BAD_REQUEST_4_00);
+  } else {
+    stats.received++;
+    LOG_INFO("Comando di gruppo %ld: furnace %ld, alarm %ld, ack 0x%02lx\n",
+             (long)m.gseq, (long)m.furnace_state, (long)m.alarm_state, (unsigned long)m.ack);
+    if(handler != NULL) {
+      handler(&m);
+    }
+    coap_set_status_code(response, CHANGED_2_04);
+  }
+  // Nessuna risposta a un multicast (RFC 7390): le conferme sono le notifiche
+  // observe. Come coap_separate_accept(), il motore scarta la risposta
+  if(uip_is_addr_mcast(&UIP_IP_BUF->destipaddr)) {
+    coap_status_code = MANUAL_RESPONSE;
+  }
+}
@@ -0,0 +1,80 @@
+/*
+ * Attuazione di gruppo con CoAP su multicast IPv6 (RFC 7390).
+ *
+ * Gli attuatori si iscrivono al gruppo site-local ff05::1:COAP_GROUP_ID
+ * con coap_group_join() e servono /res_group: un solo PUT NON dell'edge
+ * porta lo stato di tutti gli attuatori (messaggio group di
+ * msg/messages.json) e ognuno applica il proprio. Alle richieste multicast
+ * non si risponde: la conferma di ogni attuatore e' la notifica observe
+ * della sua risorsa, inviata quando lo stato cambia o quando il bit del
+ * membro e' in ack.
+ *
+ * L'edge invia con coap_group_send() e attende le conferme con
+ * coap_group_expect(): i membri senza notifica entro COAP_GROUP_ACK_TIMEOUT
+ * secondi vengono passati alla callback, che li aggiorna in unicast.
+ *
+ * Si abilita con make GROUP=1 su tutti i nodi: il motore multicast MPL di
+ * Contiki-NG inoltra i pacchetti del gruppo anche attraverso roof e power.
+ */
+#ifndef COAP_GROUP_H_
+#define COAP_GROUP_H_
+
+#include "contiki.h"
+#include "coap-engine.h"
+#include "msg_codec.h"
+#include <stdint.h>
+
+#ifdef COAP_GROUP_CONF_ENABLED
+#define COAP_GROUP COAP_GROUP_CONF_ENABLED
+#else
+#define COAP_GROUP 0
+#endif
+
+/* Gruppo ff05::1:COAP_GROUP_ID, uno per essiccatoio */
+#ifdef COAP_GROUP_CONF_ID
+#define COAP_GROUP_ID COAP_GROUP_CONF_ID
+#else
+#define COAP_GROUP_ID 1
+#endif
+
+/* Attesa delle notifiche dei membri prima del ritorno all'unicast, in secondi */
+#ifdef COAP_GROUP_CONF_ACK_TIMEOUT
+#define COAP_GROUP_ACK_TIMEOUT COAP_GROUP_CONF_ACK_TIMEOUT
+#else
+#define COAP_GROUP_ACK_TIMEOUT 3
+#endif
+
+/* Membri del gruppo, bit di ack */
+#define COAP_GROUP_FURNACE 0x01
+#define COAP_GROUP_ALARM   0x02
+
+/* Comando ricevuto su /res_group (decodificato e valido) */
+typedef void (*coap_group_handler_t)(const msg_group_t *m);
+
+/* Membri senza conferma allo scadere dell'attesa */
+typedef void (*coap_group_timeout_t)(uint8_t pending);
+
+typedef struct coap_group_stats {
+  uint16_t sent;         /* PUT multicast */
+  uint16_t acked;        /* conferme dei membri */
+  uint16_t fallback;     /* membri aggiornati in unicast */
+  uint16_t received;     /* comandi ricevuti (attuatori) */
+} coap_group_stats_t;
+
+void coap_group_addr(uip_ipaddr_t *addr);
+
+/* Iscrive il nodo al gruppo e attiva /res_group. Ritorna 1 se iscritto */
+int coap_group_join(coap_group_handler_t handler);
+
+/* PUT NON di payload su path al gruppo. Ritorna 1 se inviato */
+int coap_group_send(const char *path, const uint8_t *payload, uint16_t len);
+
+/* Attende la conferma dei membri in members (sostituisce l'attesa precedente) */
+void coap_group_expect(uint8_t members, coap_group_timeout_t timeout);
+
+/* Conferma del membro, dalla sua notifica */
+void coap_group_ack(uint8_t member);
+
+const coap_group_stats_t *coap_group_stats(void);
+
+#endif /* COAP_GROUP_H_ */
@@ -0,0 +1,296 @@
+#include "coap_queue.h"
+#include "sys/ctimer.h"
+#include "sys/log.h"
+#include <string.h>
+
+#define LOG_MODULE "CoapQueue"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+#define RETRY_INTERVAL (CLOCK_SECOND / 4)
+
+enum { ITEM_FREE, ITEM_WAITING, ITEM_INFLIGHT, ITEM_DONE }; // DONE: risposta arrivata, transazione in chiusura
+
+static coap_queue_item_t items[COAP_QUEUE_SIZE];
+static coap_queue_stats_t stats;
+static uint16_t next_seq;
+static struct ctimer retry_timer;
+
+static void dispatch(void);
+
+// a arriva prima di b: priorita' piu' alta, poi ordine di accodamento
+static int
+before(const coap_queue_item_t *a, const coap_queue_item_t *b)
+{
+  if(a->prio != b->prio) {
+    return a->prio < b->prio;
+  }
+  return (int16_t)(a->seq - b->seq) < 0;
+}
+
+static coap_queue_item_t *
+next_waiting(void)
+{
+  coap_queue_item_t *best = NULL;
+  int i;
+
+  for(i = 0; i < COAP_QUEUE_SIZE; i++) {
+    if(items[i].status == ITEM_WAITING && (best == NULL || before(&items[i], best))) {
+      best = &items[i];
+    }
+  }
+  return best;
+}
+
+// Richiesta in attesa da sacrificare per una nuova con priorita' prio:
+// la piu' vecchia tra quelle con la priorita' piu' bassa, mai piu' importante della nuova
+static coap_queue_item_t *
+victim(uint8_t prio)
+{
+  coap_queue_item_t *v = NULL;
+  int i;
+
+  for(i = 0; i < COAP_QUEUE_SIZE; i++) {
+    coap_queue_item_t *q = &items[i];
+    if(q->status != ITEM_WAITING || q->prio < prio) {
+      continue;
+    }
+    if(v == NULL || q->prio > v->prio || (q->prio == v->prio && (int16_t)(q->seq - v->seq) < 0)) {
+      v = q;
+    }
+  }
+  return v;
+}
+
+static coap_queue_item_t *
+find_waiting(const coap_endpoint_t *ep, uint8_t method, const char *path)
+{
+  int i;
+
+  for(i = 0; i < COAP_QUEUE_SIZE; i++) {
+    if(items[i].status == ITEM_WAITING && items[i].ep == ep &&
+       items[i].method == method && strcmp(items[i].path, path) == 0) {
+      return &items[i];
+    }
+  }
+  return NULL;
+}
+
+// Prima di done(): la richiesta non conta piu' tra quelle in volo
+static void
+complete(coap_queue_item_t *q)
+{
+  if(q->status == ITEM_INFLIGHT) {
+    stats.inflight--;
+    q->status = ITEM_DONE;
+  }
+}
+
+static void
+record_latency(coap_queue_item_t *q)
+{
+  coap_queue_lat_t *l = &stats.lat[q->prio];
+
+  l->last = (uint32_t)(RTIMER_NOW() - q->origin);
+  l->sum += l->last;
+  if(l->last > l->max) {
+    l->max = l->last;
+  }
+  l->count++;
+}
+
+// Callback dell'API coap-callback-api: RESPONSE porta la risposta, FINISHED chiude la
+// transazione; timeout ed errori di blocco la chiudono senza risposta
+static void
+request_callback(coap_callback_request_state_t *state)
+{
+  coap_queue_item_t *q = (coap_queue_item_t *)state;
+  coap_message_t *response = state->state.response;
+
+  switch(state->state.status) {
+  case COAP_REQUEST_STATUS_MORE:
+    return;
+  case COAP_REQUEST_STATUS_RESPONSE:
+    complete(q);
+    record_latency(q);
+    if((response->code >> 5) == 2) {
+      stats.ok++;
+    } else {
+      stats.failed++;
+    }
+    if(q->done != NULL) {
+      q->done(q, response);
+    }
+    return;
+  case COAP_REQUEST_STATUS_FINISHED:
+    break;
+  default:
+    LOG_WARN("Nessuna risposta da /%s\n", q->path);
+    complete(q);
+    stats.timeouts++;
+    if(q->done != NULL) {
+      q->done(q, NULL);
+    }
+    break;
+  }
+  q->status = ITEM_FREE;
+  dispatch();
+}
+
+static void
+retry(void *ptr)
+{
+  dispatch();
+}
+
+// Invia in ordine di priorita' finche' ci sono transazioni libere
+static void
+dispatch(void)
+{
+  coap_queue_item_t *q;
+  uint32_t wait;
+
+  while(stats.inflight < COAP_QUEUE_MAX_INFLIGHT && (q = next_waiting()) != NULL) {
+    coap_init_message(q->request, COAP_TYPE_CON, q->method, coap_get_mid());
+    coap_set_header_uri_path(q->request, q->path);
+    coap_set_header_content_format(q->request, q->format);
+    coap_set_payload(q->request, q->payload, q->len);
+    if(q->flags & COAP_QUEUE_BLOCK1) {
+      coap_set_header_block1(q->request, q->block_num, q->block_more, q->block_size);
+    }
+    if(!coap_send_request(&q->state, q->ep, q->request, request_callback)) {
+      // Transazioni del motore CoAP esaurite (es. notifiche in corso): si riprova dopo
+      ctimer_set(&retry_timer, RETRY_INTERVAL, retry, NULL);
+      return;
+    }
+    q->status = ITEM_INFLIGHT;
+    stats.sent++;
+    if(++stats.inflight > stats.inflight_max) {
+      stats.inflight_max = stats.inflight;
+    }
+    wait = (uint32_t)(RTIMER_NOW() - q->queued);
+    if(wait > stats.lat[q->prio].wait_max) {
+      stats.lat[q->prio].wait_max = wait;
+    }
+  }
+}
+
+// Prende un elemento libero (o da sostituire o da scartare) e lo riempie, senza inviarlo
+static coap_queue_item_t *
+enqueue(coap_endpoint_t *ep, uint8_t method, const char *path,
+        unsigned int format, const uint8_t *payload, uint16_t len,
+        uint8_t prio, uint8_t flags, rtimer_clock_t origin,
+        coap_queue_done_t done, void *ctx)
+{
+  coap_queue_item_t *q = NULL;
+  int replace = 0;
+  int i;
+
+  if(len > COAP_QUEUE_PAYLOAD || prio >= COAP_QUEUE_PRIOS) {
+    LOG_WARN("Richiesta per /%s non valida (%u byte, priorita' %u)\n", path, len, prio);
+    return NULL;
+  }
+
+  if(flags & COAP_QUEUE_REPLACE) {
+    q = find_waiting(ep, method, path);
+    if(q != NULL) {
+      stats.replaced++; // mantiene il posto in coda, cambia solo il contenuto
+      replace = 1;
+    }
+  }
+  for(i = 0; q == NULL && i < COAP_QUEUE_SIZE; i++) {
+    if(items[i].status == ITEM_FREE) {
+      q = &items[i];
+    }
+  }
+  if(q == NULL) {
+    q = victim(prio);
+    stats.dropped++;
+    if(q == NULL) {
+      LOG_WARN("Coda piena, scarto /%s\n", path);
+      return NULL;
+    }
+    LOG_WARN("Coda piena, scarto /%s in attesa per /%s\n", q->path, path);
+    // Il proprietario della richiesta scartata la vede finire senza risposta
+    q->status = ITEM_DONE;
+    if(q->done != NULL) {
+      q->done(q, NULL);
+    }
+  }
+
+  if(!replace) {
+    q->seq = next_seq++;
+    q->queued = RTIMER_NOW();
+  }
+  q->ep = ep;
+  q->method = method;
+  q->path = path;
+  q->format = format;
+  q->prio = prio;
+  q->flags = flags;
+  q->origin = origin;
+  q->done = done;
+  q->ctx = ctx;
+  memcpy(q->payload, payload, len);
+  q->len = len;
+  q->status = ITEM_WAITING;
+  return q;
+}
+
+int
+coap_queue_send(coap_endpoint_t *ep, uint8_t method, const char *path,
+                unsigned int format, const uint8_t *payload, uint16_t len,
+                uint8_t prio, uint8_t flags, rtimer_clock_t origin,
+                coap_queue_done_t done, void *ctx)
+{
+  if(enqueue(ep, method, path, format, payload, len, prio, flags & ~COAP_QUEUE_BLOCK1,
+             origin, done, ctx) == NULL) {
+    return 0;
+  }
+  dispatch();
+  return 1;
+}
+
+int
+coap_queue_send_block(coap_endpoint_t *ep, uint8_t method, const char *path,
+                      unsigned int format, const uint8_t *data, uint32_t total,
+                      uint32_t num, uint16_t block_size, uint8_t prio,
+                      rtimer_clock_t origin, coap_queue_done_t done, void *ctx)
+{
+  uint32_t offset = num * block_size;
+  coap_queue_item_t *q;
+  uint16_t len;
+
+  if(block_size > COAP_QUEUE_PAYLOAD || offset >= total) {
+    return 0;
+  }
+  len = total - offset < block_size ? (uint16_t)(total - offset) : block_size;
+  q = enqueue(ep, method, path, format, data + offset, len, prio, COAP_QUEUE_BLOCK1,
+              origin, done, ctx);
+  if(q == NULL) {
+    return 0;
+  }
+  q->block_num = num;
+  q->block_size = block_size;
+  q->block_more = offset + len < total;
+  dispatch();
+  return 1;
+}
+
+int
+coap_queue_idle(void)
+{
+  int i;
+
+  for(i = 0; i < COAP_QUEUE_SIZE; i++) {
+    if(items[i].status == ITEM_WAITING || items[i].status == ITEM_INFLIGHT) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+const coap_queue_stats_t *
+coap_queue_stats(void)
+{
+  return &stats;
+}
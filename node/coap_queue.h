@@ -0,0 +1,127 @@
+/*
+ * Coda delle richieste CoAP in uscita, non bloccante e con priorita'.
+ *
+ * Al posto di una sequenza di COAP_BLOCKING_REQUEST il nodo accoda le
+ * richieste e torna subito al suo ciclo: la coda ne tiene in volo fino a
+ * COAP_QUEUE_MAX_INFLIGHT (sull'API a callback di Contiki-NG) e, quando una
+ * transazione si chiude, invia la successiva in ordine di priorita' e, a pari
+ * priorita', di arrivo. I comandi agli attuatori (COAP_QUEUE_PRIO_ACTUATOR)
+ * partono quindi sempre prima della telemetria gia' in attesa.
+ *
+ * Con COAP_QUEUE_REPLACE una richiesta non ancora inviata verso la stessa
+ * risorsa viene sostituita: per un attuatore conta solo l'ultimo stato.
+ * A coda piena si scarta la richiesta in attesa piu' vecchia con priorita'
+ * non superiore a quella nuova.
+ *
+ * Payload piu' grandi di un messaggio si inviano con coap_queue_send_block(),
+ * un blocco Block1 (RFC 7959) alla volta: il chiamante accoda il blocco
+ * successivo quando done riceve 2.31 Continue.
+ *
+ * Per ogni priorita' la coda misura l'attesa prima dell'invio e la latenza
+ * dall'istante di origine passato a coap_queue_send() (es. l'arrivo del
+ * campione) alla risposta.
+ */
+#ifndef COAP_QUEUE_H_
+#define COAP_QUEUE_H_
+
+#include "contiki.h"
+#include "coap-engine.h"
+#include "coap-callback-api.h"
+#include "sys/rtimer.h"
+#include <stdint.h>
+
+/* Richieste accodate o in volo */
+#ifdef COAP_QUEUE_CONF_SIZE
+#define COAP_QUEUE_SIZE COAP_QUEUE_CONF_SIZE
+#else
+#define COAP_QUEUE_SIZE 6
+#endif
+
+/* Transazioni in volo: una resta libera per le notifiche e le observe del nodo */
+#ifdef COAP_QUEUE_CONF_MAX_INFLIGHT
+#define COAP_QUEUE_MAX_INFLIGHT COAP_QUEUE_CONF_MAX_INFLIGHT
+#else
+#define COAP_QUEUE_MAX_INFLIGHT (COAP_MAX_OPEN_TRANSACTIONS - 1)
+#endif
+
+/* Payload copiato nella coda (il buffer del chiamante torna subito libero) */
+#ifdef COAP_QUEUE_CONF_PAYLOAD
+#define COAP_QUEUE_PAYLOAD COAP_QUEUE_CONF_PAYLOAD
+#else
+#define COAP_QUEUE_PAYLOAD 96
+#endif
+
+#define COAP_QUEUE_PRIO_ACTUATOR  0 /* PUT agli attuatori */
+#define COAP_QUEUE_PRIO_TELEMETRY 1 /* dati e previsioni verso il server */
+#define COAP_QUEUE_PRIOS          2
+
+#define COAP_QUEUE_REPLACE 0x01 /* sostituisce la richiesta in attesa verso la stessa risorsa */
+#define COAP_QUEUE_BLOCK1  0x02 /* impostato da coap_queue_send_block() */
+
+typedef struct coap_queue_item coap_queue_item_t;
+
+/* Fine di una richiesta: response NULL per timeout, errore di trasferimento o
+ * richiesta scartata a coda piena */
+typedef void (*coap_queue_done_t)(coap_queue_item_t *item, coap_message_t *response);
+
+struct coap_queue_item {
+  coap_callback_request_state_t state; /* primo membro: la callback risale all'elemento */
+  coap_message_t request[1];
+  coap_endpoint_t *ep;
+  const char *path;
+  uint8_t method;
+  uint8_t prio;
+  uint8_t flags;
+  uint8_t status;
+  unsigned int format;   /* Content-Format del payload */
+  uint16_t seq;          /* ordine di arrivo a pari priorita' */
+  uint16_t len;
+  uint32_t block_num;    /* con COAP_QUEUE_BLOCK1 */
+  uint16_t block_size;
+  uint8_t block_more;
+  uint8_t payload[COAP_QUEUE_PAYLOAD];
+  rtimer_clock_t origin; /* istante dell'evento che ha generato la richiesta */
+  rtimer_clock_t queued;
+  coap_queue_done_t done;
+  void *ctx;             /* dato del chiamante, per done */
+};
+
+typedef struct coap_queue_lat {
+  uint32_t count;
+  uint32_t last, max;      /* tick rtimer da origin alla risposta */
+  uint64_t sum;            /* a 64 bit: non si azzera per la vita del nodo */
+  uint32_t wait_max;       /* tick rtimer in coda prima dell'invio */
+} coap_queue_lat_t;
+
+typedef struct coap_queue_stats {
+  uint16_t sent;
+  uint16_t ok;           /* risposte 2.xx */
+  uint16_t failed;       /* risposte 4.xx/5.xx */
+  uint16_t timeouts;
+  uint16_t dropped;      /* scartate a coda piena */
+  uint16_t replaced;     /* sostituite da una richiesta piu' recente */
+  uint8_t inflight;
+  uint8_t inflight_max;
+  coap_queue_lat_t lat[COAP_QUEUE_PRIOS];
+} coap_queue_stats_t;
+
+/* Accoda una richiesta CON con il payload copiato. Ritorna 1 se accodata,
+ * 0 se la coda e' piena di richieste con priorita' piu' alta */
+int coap_queue_send(coap_endpoint_t *ep, uint8_t method, const char *path,
+                    unsigned int format, const uint8_t *payload, uint16_t len,
+                    uint8_t prio, uint8_t flags, rtimer_clock_t origin,
+                    coap_queue_done_t done, void *ctx);
+
+/* Accoda il blocco num (da block_size byte, potenza di 2 fino a COAP_QUEUE_PAYLOAD)
+ * dei total byte di data. Ritorna 1 se accodato, 0 come coap_queue_send() */
+int coap_queue_send_block(coap_endpoint_t *ep, uint8_t method, const char *path,
+                          unsigned int format, const uint8_t *data, uint32_t total,
+                          uint32_t num, uint16_t block_size, uint8_t prio,
+                          rtimer_clock_t origin, coap_queue_done_t done, void *ctx);
+
+/* 1 se non ci sono richieste in attesa ne' in volo (vale anche dentro done) */
+int coap_queue_idle(void);
+
+const coap_queue_stats_t *coap_queue_stats(void);
+
+#endif /* COAP_QUEUE_H_ */
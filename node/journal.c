@@ -0,0 +1,293 @@
+#include "journal.h"
+
+#if JOURNAL
+#include "cfs/cfs.h"
+#include "cfs/cfs-coffee.h"
+#include "lib/crc16.h"
+#include "sys/log.h"
+#include <string.h>
+
+#define LOG_MODULE "Journal"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+#define META_FILE "jmeta"
+
+typedef struct entry_header {
+  uint32_t seq;
+  uint16_t crc;          /* crc16 di seq e del record */
+  uint16_t reserved;
+} entry_header_t;
+
+static uint8_t record_size;
+static uint16_t entry_size;
+static uint32_t head_seq;  /* primo record non confermato */
+static uint32_t tail_seq;  /* prossimo record da scrivere */
+static journal_stats_t stats;
+static clock_time_t catchup_start; /* primo ack del recupero in corso, 0 = nessuno */
+static uint32_t catchup_acked;
+
+static void
+segment_name(char *name, uint32_t seq)
+{
+  name[0] = 'j';
+  name[1] = 'r';
+  name[2] = '0' + (seq / JOURNAL_SEG_RECORDS) % JOURNAL_SEGMENTS;
+  name[3] = '\0';
+}
+
+static uint16_t
+entry_crc(const entry_header_t *h, const void *record)
+{
+  uint16_t crc = crc16_data((const unsigned char *)&h->seq, sizeof(h->seq), 0);
+  return crc16_data((const unsigned char *)record, record_size, crc);
+}
+
+static void
+save_head(void)
+{
+  int fd = cfs_open(META_FILE, CFS_WRITE);
+
+  if(fd < 0 || cfs_write(fd, &head_seq, sizeof(head_seq)) != sizeof(head_seq)) {
+    stats.errors++;
+  }
+  if(fd >= 0) {
+    cfs_close(fd);
+  }
+}
+
+// Primo seq e numero di record di un segmento, 0 se vuoto o illeggibile.
+// Fa fede l'ultimo record: il segmento puo' iniziare dopo la sua testa se e' stato
+// ricreato a journal vuoto, e i record mancanti sono gia' confermati in META_FILE
+static uint32_t
+scan_segment(uint8_t segment, uint32_t *first)
+{
+  uint8_t record[JOURNAL_RECORD_MAX];
+  entry_header_t h;
+  cfs_offset_t end;
+  char name[4];
+  int fd;
+
+  segment_name(name, (uint32_t)segment * JOURNAL_SEG_RECORDS);
+  fd = cfs_open(name, CFS_READ);
+  if(fd < 0) {
+    return 0;
+  }
+  end = cfs_seek(fd, 0, CFS_SEEK_END) / entry_size * entry_size;
+  if(end < entry_size ||
+     cfs_seek(fd, end - entry_size, CFS_SEEK_SET) < 0 ||
+     cfs_read(fd, &h, sizeof(h)) != sizeof(h) ||
+     cfs_read(fd, record, record_size) != record_size ||
+     h.crc != entry_crc(&h, record) ||
+     (h.seq / JOURNAL_SEG_RECORDS) % JOURNAL_SEGMENTS != segment ||
+     h.seq % JOURNAL_SEG_RECORDS != (uint32_t)end / entry_size - 1) {
+    cfs_close(fd);
+    return 0;
+  }
+  cfs_close(fd);
+  *first = h.seq - h.seq % JOURNAL_SEG_RECORDS;
+  return (uint32_t)end / entry_size;
+}
+
+void
+journal_init(uint8_t size)
+{
+  uint32_t first, count, saved = 0;
+  uint8_t s;
+  int found = 0;
+  int fd;
+
+  record_size = size;
+  entry_size = sizeof(entry_header_t) + size;
+
+  fd = cfs_open(META_FILE, CFS_READ);
+  if(fd >= 0) {
+    if(cfs_read(fd, &saved, sizeof(saved)) != sizeof(saved)) {
+      saved = 0;
+    }
+    cfs_close(fd);
+  } else {
+    cfs_coffee_reserve(META_FILE, sizeof(head_seq));
+  }
+
+  head_seq = tail_seq = saved;
+  for(s = 0; s < JOURNAL_SEGMENTS; s++) {
+    count = scan_segment(s, &first);
+    if(count == 0) {
+      continue;
+    }
+    if(!found || first < head_seq) {
+      head_seq = first;
+    }
+    if(!found || first + count > tail_seq) {
+      tail_seq = first + count;
+    }
+    found = 1;
+  }
+  // Record gia' confermati prima del riavvio
+  if(found && saved > head_seq && saved <= tail_seq) {
+    head_seq = saved;
+  }
+  LOG_INFO("Journal: %lu record da consegnare (seq %lu-%lu)\n",
+           (unsigned long)(tail_seq - head_seq), (unsigned long)head_seq, (unsigned long)tail_seq);
+}
+
+int
+journal_append(const void *record)
+{
+  entry_header_t h;
+  uint32_t reused_end;
+  char name[4];
+  int fd, ok;
+
+  if(record_size == 0 || record_size > JOURNAL_RECORD_MAX) {
+    return JOURNAL_ERR_SIZE;
+  }
+  segment_name(name, tail_seq);
+
+  if(tail_seq % JOURNAL_SEG_RECORDS == 0) {
+    // Segmento riusato: i record non confermati che contiene sono i piu' vecchi
+    reused_end = tail_seq - (uint32_t)(JOURNAL_SEGMENTS - 1) * JOURNAL_SEG_RECORDS;
+    if(tail_seq >= (uint32_t)(JOURNAL_SEGMENTS - 1) * JOURNAL_SEG_RECORDS && head_seq < reused_end) {
+      LOG_WARN("Journal pieno: scartati %lu record\n", (unsigned long)(reused_end - head_seq));
+      stats.evicted += reused_end - head_seq;
+      head_seq = reused_end;
+      save_head();
+    }
+    cfs_remove(name);
+    cfs_coffee_reserve(name, (cfs_offset_t)JOURNAL_SEG_RECORDS * entry_size);
+  } else if((fd = cfs_open(name, CFS_READ)) < 0) {
+    // Segmento cancellato a journal vuoto: si riprende a meta'
+    cfs_coffee_reserve(name, (cfs_offset_t)JOURNAL_SEG_RECORDS * entry_size);
+  } else {
+    cfs_close(fd);
+  }
+
+  h.seq = tail_seq;
+  h.reserved = 0;
+  h.crc = entry_crc(&h, record);
+  fd = cfs_open(name, CFS_WRITE | CFS_APPEND);
+  ok = fd >= 0 &&
+       cfs_seek(fd, (cfs_offset_t)(tail_seq % JOURNAL_SEG_RECORDS) * entry_size, CFS_SEEK_SET) >= 0 &&
+       cfs_write(fd, &h, sizeof(h)) == sizeof(h) &&
+       cfs_write(fd, record, record_size) == record_size;
+  if(fd >= 0) {
+    cfs_close(fd);
+  }
+  if(!ok) {
+    stats.errors++;
+    return JOURNAL_ERR_IO;
+  }
+  tail_seq++;
+  stats.appended++;
+  return JOURNAL_OK;
+}
+
+uint32_t
+journal_depth(void)
+{
+  return tail_seq - head_seq;
+}
+
+uint8_t
+journal_peek(void *records, uint8_t max)
+{
+  uint8_t *out = (uint8_t *)records;
+  entry_header_t h;
+  uint32_t seq = head_seq;
+  uint8_t n = 0;
+  uint8_t skipped = 0;
+  char name[4];
+  int fd = -1;
+
+  while(n < max && seq < tail_seq) {
+    if(fd < 0 || seq % JOURNAL_SEG_RECORDS == 0) {
+      if(fd >= 0) {
+        cfs_close(fd);
+      }
+      segment_name(name, seq);
+      fd = cfs_open(name, CFS_READ);
+      if(fd < 0 || cfs_seek(fd, (cfs_offset_t)(seq % JOURNAL_SEG_RECORDS) * entry_size, CFS_SEEK_SET) < 0) {
+        break;
+      }
+    }
+    if(cfs_read(fd, &h, sizeof(h)) != sizeof(h) ||
+       cfs_read(fd, out, record_size) != record_size ||
+       h.seq != seq || h.crc != entry_crc(&h, out)) {
+      // Record corrotto (es. scrittura interrotta): se e' il primo si salta
+      stats.errors++;
+      if(n == 0) {
+        head_seq = ++seq;
+        skipped = 1;
+        continue;
+      }
+      break;
+    }
+    out += record_size;
+    seq++;
+    n++;
+  }
+  if(fd >= 0) {
+    cfs_close(fd);
+  }
+  // Record saltati: la testa si salva subito, o dopo un riavvio si rileggerebbero
+  if(skipped) {
+    save_head();
+  }
+  return n;
+}
+
+void
+journal_ack(uint8_t n)
+{
+  uint32_t old = head_seq;
+  clock_time_t now = clock_time();
+  char name[4];
+
+  if(n > tail_seq - head_seq) {
+    n = tail_seq - head_seq;
+  }
+  head_seq += n;
+  stats.replayed += n;
+
+  // Segmenti confermati per intero: spazio restituito a Coffee
+  while(old / JOURNAL_SEG_RECORDS < head_seq / JOURNAL_SEG_RECORDS) {
+    segment_name(name, old);
+    cfs_remove(name);
+    old = (old / JOURNAL_SEG_RECORDS + 1) * JOURNAL_SEG_RECORDS;
+  }
+  save_head();
+
+  // Velocita' del recupero: record confermati al minuto dal primo ack
+  if(catchup_start == 0) {
+    catchup_start = now;
+    catchup_acked = 0;
+  }
+  catchup_acked += n;
+  if(now != catchup_start) {
+    stats.rate = (uint16_t)(catchup_acked * 60 * CLOCK_SECOND / (now - catchup_start));
+  }
+  if(head_seq == tail_seq) {
+    LOG_INFO("Journal svuotato: %lu record recuperati a %u record/min\n",
+             (unsigned long)catchup_acked, stats.rate);
+    catchup_start = 0;
+  }
+}
+
+const journal_stats_t *
+journal_stats(void)
+{
+  return &stats;
+}
+
+#else /* JOURNAL */
+
+static const journal_stats_t no_stats;
+
+void journal_init(uint8_t record_size) {}
+int journal_append(const void *record) { return JOURNAL_ERR_IO; }
+uint32_t journal_depth(void) { return 0; }
+uint8_t journal_peek(void *records, uint8_t max) { return 0; }
+void journal_ack(uint8_t n) {}
+const journal_stats_t *journal_stats(void) { return &no_stats; }
+
+#endif /* JOURNAL */
@@ -0,0 +1,74 @@
+/*
+ * Journal append-only su CFS (Coffee) per i record che il nodo non riesce a
+ * consegnare: sopravvive ai riavvii e ha un ingombro limitato.
+ *
+ * I record (dimensione fissa, scelta con journal_init()) hanno un numero di
+ * sequenza crescente e un crc16, e sono scritti in JOURNAL_SEGMENTS file da
+ * JOURNAL_SEG_RECORDS record usati a rotazione: quando il segmento da
+ * riusare contiene ancora record non confermati, questi vengono scartati
+ * (prima i piu' vecchi) e contati in evicted. Un segmento confermato per
+ * intero viene cancellato.
+ *
+ * La rilettura procede in ordine con journal_peek() e journal_ack(): il
+ * primo record non confermato e' salvato su flash a ogni conferma, quindi
+ * dopo un riavvio si riparte al piu' dall'ultimo blocco non confermato.
+ */
+#ifndef JOURNAL_H_
+#define JOURNAL_H_
+
+#include "contiki.h"
+#include <stdint.h>
+
+/* Si abilita con make JOURNAL=1 (aggiunge il modulo os/storage/cfs) */
+#ifdef JOURNAL_CONF_ENABLED
+#define JOURNAL JOURNAL_CONF_ENABLED
+#else
+#define JOURNAL 0
+#endif
+
+#ifdef JOURNAL_CONF_SEGMENTS
+#define JOURNAL_SEGMENTS JOURNAL_CONF_SEGMENTS
+#else
+#define JOURNAL_SEGMENTS 4
+#endif
+#ifdef JOURNAL_CONF_SEG_RECORDS
+#define JOURNAL_SEG_RECORDS JOURNAL_CONF_SEG_RECORDS
+#else
+#define JOURNAL_SEG_RECORDS 64
+#endif
+#ifdef JOURNAL_CONF_RECORD_MAX
+#define JOURNAL_RECORD_MAX JOURNAL_CONF_RECORD_MAX
+#else
+#define JOURNAL_RECORD_MAX 32
+#endif
+
+#define JOURNAL_OK         0
+#define JOURNAL_ERR_IO   -20 /* errore di scrittura/lettura CFS */
+#define JOURNAL_ERR_SIZE -21 /* record oltre JOURNAL_RECORD_MAX */
+
+typedef struct journal_stats {
+  uint32_t appended;     /* record scritti */
+  uint32_t replayed;     /* record confermati dopo la rilettura */
+  uint32_t evicted;      /* record scartati a journal pieno */
+  uint16_t errors;       /* errori CFS e record corrotti saltati */
+  uint16_t rate;         /* record/min confermati nell'ultimo recupero */
+} journal_stats_t;
+
+/* Ricostruisce lo stato dai segmenti presenti su flash */
+void journal_init(uint8_t record_size);
+
+int journal_append(const void *record);
+
+/* Record non ancora confermati */
+uint32_t journal_depth(void);
+
+/* Copia in records (spazio per max record) i piu' vecchi non confermati,
+ * senza consumarli. Ritorna quanti ne ha copiati */
+uint8_t journal_peek(void *records, uint8_t max);
+
+/* Conferma i primi n record restituiti da journal_peek() */
+void journal_ack(uint8_t n);
+
+const journal_stats_t *journal_stats(void);
+
+#endif /* JOURNAL_H_ */
@@ -0,0 +1,485 @@
+#include "node_runtime.h"
+#include "tsch_app.h"
+#include "coap-blocking-api.h"
+#include "msg_codec.h"
+#include "net/netstack.h"
+#include "net/routing/routing.h"
+#include "net/ipv6/uiplib.h"
+#include "os/dev/leds.h"
+#include "lib/random.h"
+#include "lib/crc16.h"
+#include "sys/log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if NODE_RUNTIME_STORE
+#include "cfs/cfs.h"
+#endif
+
+#define LOG_MODULE "Runtime"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+#define PEER_FILE "rtpeer"
+
+/* Destinazione salvata: chiave = crc16 del path, per scartare un elenco cambiato */
+typedef struct saved_peer {
+  coap_endpoint_t ep;
+  uint16_t key;
+  uint16_t format;
+} saved_peer_t;
+
+process_event_t ev_runtime_registered;
+process_event_t ev_runtime_ready;
+process_event_t ev_runtime_changed;
+
+PROCESS(node_runtime_process, "Node runtime");
+
+static const char *registration;
+static node_runtime_peer_t *peers;
+static uint8_t peer_count;
+static struct process *owner;
+static coap_endpoint_t server_ep;
+static coap_message_t request[1];
+static struct etimer timer;
+static struct etimer refresh_timer;   /* prossimo rinnovo della registrazione */
+static uint16_t backoff;              /* secondi, prossima attesa dopo un fallimento */
+static uint8_t done;                  /* esito dell'ultima richiesta, dai callback */
+static uint8_t save;                  /* la lookup ha cambiato almeno una destinazione */
+static uint8_t absent;                /* la lookup ha risposto 4.04 */
+static uint8_t ready;
+static uint8_t refused;               /* register di fila senza conferma, 5.03 esclusi */
+static unsigned long epoch_base;      /* epoch del server meno clock_seconds(), 0 = non sincronizzato */
+static char query[NODE_RUNTIME_QUERY_SIZE];
+static char answer[NODE_RUNTIME_ANSWER_SIZE];
+static int16_t answer_len;            /* -1 = risposta oltre answer */
+
+static uint16_t
+peer_key(const node_runtime_peer_t *p)
+{
+  return crc16_data((const unsigned char *)p->path, strlen(p->path), 0);
+}
+
+static int
+all_known(void)
+{
+  uint8_t i;
+
+  for(i = 0; i < peer_count; i++) {
+    if(peers[i].state == NODE_RUNTIME_PEER_NONE) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void
+set_ready(void)
+{
+  ready = 1;
+  process_post(owner, ev_runtime_ready, NULL);
+}
+
+static void
+load_peers(void)
+{
+  saved_peer_t saved[NODE_RUNTIME_PEERS_MAX];
+  uint8_t i;
+
+  if(!node_runtime_load(PEER_FILE, saved, peer_count * sizeof(saved_peer_t))) {
+    return;
+  }
+  for(i = 0; i < peer_count; i++) {
+    if(saved[i].key == peer_key(&peers[i])) {
+      coap_endpoint_copy(peers[i].ep, &saved[i].ep);
+      if(peers[i].format != NULL) {
+        *peers[i].format = saved[i].format;
+      }
+      peers[i].state = NODE_RUNTIME_PEER_SAVED;
+#if TSCH_APP
+      tsch_app_set_peer(i, &peers[i].ep->ipaddr);
+#endif
+    }
+  }
+}
+
+static void
+save_peers(void)
+{
+  saved_peer_t saved[NODE_RUNTIME_PEERS_MAX];
+  uint8_t i;
+
+  memset(saved, 0, sizeof(saved));
+  for(i = 0; i < peer_count; i++) {
+    if(peers[i].state != NODE_RUNTIME_PEER_NONE) {
+      coap_endpoint_copy(&saved[i].ep, peers[i].ep);
+      saved[i].key = peer_key(&peers[i]);
+      saved[i].format = peers[i].format != NULL ? *peers[i].format : APPLICATION_JSON;
+    }
+  }
+  node_runtime_save(PEER_FILE, saved, peer_count * sizeof(saved_peer_t));
+}
+
+// Attesa prima del prossimo tentativo: backoff con jitter fino a +50%, poi raddoppia
+static void
+backoff_start(void)
+{
+  clock_time_t t = (clock_time_t)backoff * CLOCK_SECOND;
+
+  t += random_rand() % (t / 2 + 1);
+  etimer_set(&timer, t);
+  LOG_INFO("Nuovo tentativo tra %lu ms\n", (unsigned long)(t * 1000 / CLOCK_SECOND));
+  backoff = backoff * 2 < NODE_RUNTIME_BACKOFF_MAX ? backoff * 2 : NODE_RUNTIME_BACKOFF_MAX;
+}
+
+static int
+response_ok(coap_message_t *response, const char *what)
+{
+  if(response == NULL) {
+    LOG_WARN("%s: timeout dal server\n", what);
+    return 0;
+  }
+  if(response->code >= 128) {
+    LOG_WARN("%s: codice %u.%02u\n", what, response->code >> 5, response->code & 0x1F);
+    return 0;
+  }
+  return 1;
+}
+
+static void
+register_handler(coap_message_t *response)
+{
+  done = response_ok(response, "Register");
+  // 5.03: il root attende ancora la risposta del server, non e' un rifiuto
+  if(done) {
+    refused = 0;
+  } else if(response == NULL || response->code != SERVICE_UNAVAILABLE_5_03) {
+    refused++;
+  }
+}
+
+// Orario del server con cui marcare le misure (t)
+static void
+time_handler(coap_message_t *response)
+{
+  const uint8_t *chunk;
+  char ts[16];
+  msg_timestamp_t m;
+  int len;
+
+  if(!response_ok(response, "Orario")) {
+    return;
+  }
+  len = coap_get_payload(response, &chunk);
+  if(len > 0 && msg_timestamp_decode(chunk, len, &m) == MSG_OK && msg_str_copy(&m.timestamp, ts, sizeof(ts))) {
+    epoch_base = strtoul(ts, NULL, 10) - clock_seconds();
+    done = 1;
+    LOG_INFO("Orario sincronizzato: %s\n", ts);
+  } else {
+    LOG_WARN("Payload inatteso nella register: %.*s\n", len, (char *)chunk);
+  }
+}
+
+// Risposta della lookup, anche a blocchi (Block2): si ricompone in answer
+static void
+lookup_handler(coap_message_t *response)
+{
+  const uint8_t *chunk;
+  int len;
+
+  absent = response != NULL && response->code == NOT_FOUND_4_04;
+  if(!response_ok(response, "Lookup") || answer_len < 0) {
+    done = 0;
+    return;
+  }
+  len = coap_get_payload(response, &chunk);
+  if(len > (int)sizeof(answer) - answer_len) {
+    LOG_WARN("Risposta della lookup oltre %u byte\n", (unsigned)sizeof(answer));
+    answer_len = -1;
+    done = 0;
+    return;
+  }
+  memcpy(answer + answer_len, chunk, len);
+  answer_len += len;
+  done = 1;
+}
+
+// IP del nodo con la risorsa di p ({"ip","ct"}): aggiorna p sul posto
+static void
+lookup_apply(node_runtime_peer_t *p, const uint8_t *buf, int len)
+{
+  char ip[UIPLIB_IPV6_MAX_STR_LEN];
+  char uri[UIPLIB_IPV6_MAX_STR_LEN + 12];
+  coap_endpoint_t ep;
+  unsigned int format;
+  msg_lookup_t m;
+  uint8_t changed;
+
+  if(msg_lookup_decode(buf, len, &m) != MSG_OK || m.ip.len == 0 || !msg_str_copy(&m.ip, ip, sizeof(ip))) {
+    LOG_WARN("%s non registrata, %s\n", p->path,
+             p->state == NODE_RUNTIME_PEER_NONE ? "nuova lookup al prossimo rinnovo" : "resta la destinazione nota");
+    return;
+  }
+  snprintf(uri, sizeof(uri), "coap://[%s]", ip);
+  if(!coap_endpoint_parse(uri, strlen(uri), &ep)) {
+    LOG_WARN("IP non valido per %s: %s\n", p->path, ip);
+    return;
+  }
+  format = (MSG_SENML && (m.present & MSG_LOOKUP_CT) && m.ct == MSG_CT_SENML_CBOR) ? MSG_CT_SENML_CBOR
+                                                                                   : APPLICATION_JSON;
+  changed = p->state == NODE_RUNTIME_PEER_NONE || !coap_endpoint_cmp(&ep, p->ep) ||
+            (p->format != NULL && *p->format != format);
+  coap_endpoint_copy(p->ep, &ep);
+  if(p->format != NULL) {
+    *p->format = format;
+  }
+  p->state = NODE_RUNTIME_PEER_OK;
+#if TSCH_APP
+  tsch_app_set_peer(p - peers, &ep.ipaddr);
+#endif
+  LOG_INFO("%s su [%s]%s\n", p->path, ip, changed ? "" : " (invariato)");
+  if(changed) {
+    save = 1;
+    if(ready) {
+      process_post(owner, ev_runtime_changed, p);
+    }
+  }
+}
+
+// Risposta completa: {"ip","ct"} per una sola destinazione, altrimenti una voce per
+// path, {"/a":{"ip","ct"},"/b":null}. Le destinazioni null restano come sono
+static void
+lookup_parse(void)
+{
+  const uint8_t *buf = (const uint8_t *)answer;
+  const char *key, *value;
+  msg_scan_t s;
+  uint8_t key_len, i;
+
+  if(peer_count == 1) {
+    lookup_apply(&peers[0], buf, answer_len);
+    return;
+  }
+  if(msg_scan_begin(&s, buf, answer_len) < 0) {
+    LOG_WARN("Risposta della lookup non valida: %.*s\n", answer_len, answer);
+    return;
+  }
+  while(msg_scan_key(&s, &key, &key_len) > 0) {
+    value = s.p;
+    if(msg_scan_skip(&s) < 0) {
+      LOG_WARN("Risposta della lookup non valida: %.*s\n", answer_len, answer);
+      return;
+    }
+    for(i = 0; i < peer_count; i++) {
+      if(strlen(peers[i].path) == key_len && memcmp(peers[i].path, key, key_len) == 0) {
+        lookup_apply(&peers[i], (const uint8_t *)value, s.p - value);
+      }
+    }
+  }
+}
+
+// Query di tutte le destinazioni: res=/a,/b,/c
+static void
+lookup_query(void)
+{
+  uint8_t i;
+  int len = snprintf(query, sizeof(query), "res=");
+
+  for(i = 0; i < peer_count; i++) {
+    if(len + strlen(peers[i].path) + 1 >= sizeof(query)) {
+      LOG_ERR("Query della lookup oltre %u byte: %s esclusa\n", (unsigned)sizeof(query), peers[i].path);
+      continue;
+    }
+    len += snprintf(query + len, sizeof(query) - len, "%s%s", query[len - 1] == '=' ? "" : ",", peers[i].path);
+  }
+}
+
+void
+node_runtime_start(const char *reg, node_runtime_peer_t *p, uint8_t n)
+{
+  registration = reg;
+  peers = p;
+  peer_count = n < NODE_RUNTIME_PEERS_MAX ? n : NODE_RUNTIME_PEERS_MAX;
+  owner = PROCESS_CURRENT();
+  ev_runtime_registered = process_alloc_event();
+  ev_runtime_ready = process_alloc_event();
+  ev_runtime_changed = process_alloc_event();
+  process_start(&node_runtime_process, NULL);
+}
+
+int
+node_runtime_ready(void)
+{
+  return ready;
+}
+
+uint32_t
+node_runtime_epoch(void)
+{
+  return epoch_base ? epoch_base + clock_seconds() : 0;
+}
+
+int
+node_runtime_load(const char *name, void *data, uint16_t size)
+{
+#if NODE_RUNTIME_STORE
+  uint16_t crc;
+  int fd = cfs_open(name, CFS_READ);
+  int ok;
+
+  if(fd < 0) {
+    return 0;
+  }
+  ok = cfs_read(fd, data, size) == size && cfs_read(fd, &crc, sizeof(crc)) == sizeof(crc) &&
+       crc == crc16_data((const unsigned char *)data, size, 0);
+  cfs_close(fd);
+  if(!ok) {
+    LOG_WARN("%s su flash non valido, ignorato\n", name);
+  }
+  return ok;
+#else
+  return 0;
+#endif
+}
+
+int
+node_runtime_save(const char *name, const void *data, uint16_t size)
+{
+#if NODE_RUNTIME_STORE
+  uint16_t crc = crc16_data((const unsigned char *)data, size, 0);
+  int fd = cfs_open(name, CFS_WRITE);
+  int ok;
+
+  if(fd < 0) {
+    LOG_WARN("%s: apertura su flash fallita\n", name);
+    return 0;
+  }
+  ok = cfs_write(fd, data, size) == size && cfs_write(fd, &crc, sizeof(crc)) == sizeof(crc);
+  cfs_close(fd);
+  if(!ok) {
+    LOG_WARN("%s: scrittura su flash fallita\n", name);
+  }
+  return ok;
+#else
+  return 0;
+#endif
+}
+
+PROCESS_THREAD(node_runtime_process, ev, data)
+{
+  static uip_ipaddr_t root;
+  static uint8_t i, tries, refresh;
+  char ipstr[UIPLIB_IPV6_MAX_STR_LEN];
+#if NODE_RUNTIME_VIA_ROOT
+  char uri[UIPLIB_IPV6_MAX_STR_LEN + 12];
+#endif
+
+  PROCESS_BEGIN();
+
+  coap_endpoint_parse(NODE_RUNTIME_SERVER, strlen(NODE_RUNTIME_SERVER), &server_ep);
+  lookup_query();
+
+  // Destinazioni salvate prima del riavvio: l'applicazione parte subito, la riconvalida segue
+  load_peers();
+  if(all_known()) {
+    if(peer_count > 0) {
+      LOG_INFO("Destinazioni lette dalla flash, riconvalida in background\n");
+    }
+    set_ready();
+  }
+
+  // Ricerca del nodo root
+  etimer_set(&timer, CLOCK_SECOND);
+  while(!NETSTACK_ROUTING.node_is_reachable() || !NETSTACK_ROUTING.get_root_ipaddr(&root)) {
+    LOG_INFO("In attesa del root...\n");
+    leds_toggle(LEDS_RED);
+    PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&timer));
+    etimer_reset(&timer);
+  }
+  leds_off(LEDS_RED);
+  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &root);
+  LOG_INFO("Root trovato: [%s]\n", ipstr);
+#if NODE_RUNTIME_VIA_ROOT
+  // Register, orario e lookup alla cache del border router
+  snprintf(uri, sizeof(uri), "coap://[%s]", ipstr);
+  coap_endpoint_parse(uri, strlen(uri), &server_ep);
+#endif
+
+  // Registrazione, rinnovata ogni NODE_RUNTIME_REFRESH secondi: il server scade le
+  // registrazioni non rinnovate. Dopo ogni registrazione l'orario, se manca, e le lookup
+  for(refresh = 0;; refresh = 1) {
+    backoff = NODE_RUNTIME_BACKOFF_MIN;
+    for(done = 0; !done;) {
+      coap_init_message(request, COAP_TYPE_CON, COAP_POST, coap_get_mid());
+      coap_set_header_uri_path(request, "register");
+      coap_set_payload(request, (uint8_t *)registration, strlen(registration));
+      COAP_BLOCKING_REQUEST(&server_ep, request, register_handler);
+      if(!done) {
+#if NODE_RUNTIME_VIA_ROOT
+        if(refused == NODE_RUNTIME_ROOT_TRIES) {
+          LOG_WARN("Il root non conferma la registrazione, richieste al server\n");
+          coap_endpoint_parse(NODE_RUNTIME_SERVER, strlen(NODE_RUNTIME_SERVER), &server_ep);
+        }
+#endif
+        backoff_start();
+        PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&timer));
+      }
+    }
+    if(!refresh) {
+      LOG_INFO("Registrazione completata\n");
+      process_post(owner, ev_runtime_registered, NULL);
+    }
+    // Il prossimo rinnovo non aspetta le lookup: quelle ancora in corso si interrompono
+    etimer_set(&refresh_timer, NODE_RUNTIME_REFRESH * CLOCK_SECOND);
+
+    // Orario: pochi tentativi, la cache del root lo ha solo dopo la sua sincronizzazione
+    backoff = NODE_RUNTIME_BACKOFF_MIN;
+    for(i = 0; !epoch_base && i < NODE_RUNTIME_TIME_TRIES; i++) {
+      if(i > 0) {
+        backoff_start();
+        PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&timer));
+      }
+      coap_init_message(request, COAP_TYPE_CON, COAP_GET, coap_get_mid());
+      coap_set_header_uri_path(request, "register");
+      COAP_BLOCKING_REQUEST(&server_ep, request, time_handler);
+    }
+
+    // Lookup a ogni giro, anche delle destinazioni salvate, che restano valide nel frattempo:
+    // una sola richiesta per tutte (res=/a,/b,/c). Al primo avvio si ritenta fino al rinnovo,
+    // poi al massimo NODE_RUNTIME_LOOKUP_TRIES volte; un 4.04 (nessuna registrata) chiude i
+    // tentativi come una risposta
+    backoff = NODE_RUNTIME_BACKOFF_MIN;
+    for(done = absent = tries = 0;
+        peer_count > 0 && !done && !absent && (!ready || tries < NODE_RUNTIME_LOOKUP_TRIES) &&
+        !etimer_expired(&refresh_timer);
+        tries++) {
+      if(tries > 0) {
+        backoff_start();
+        PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&timer));
+      }
+      coap_init_message(request, COAP_TYPE_CON, COAP_GET, coap_get_mid());
+      coap_set_header_uri_path(request, "lookup");
+      coap_set_header_uri_query(request, query);
+      answer_len = 0;
+      COAP_BLOCKING_REQUEST(&server_ep, request, lookup_handler);
+    }
+    save = 0;
+    if(done) {
+      lookup_parse();
+    } else if(peer_count > 0) {
+      LOG_WARN("Lookup %s, %s\n", absent ? "senza risultati" : "fallita",
+               all_known() ? "restano le destinazioni note" : "nuovo tentativo al prossimo rinnovo");
+    }
+    if(save) {
+      save_peers();
+    }
+    // Prima risposta: le destinazioni non trovate restano NODE_RUNTIME_PEER_NONE e arrivano
+    // con ev_runtime_changed quando un giro successivo le trova
+    if(!ready && (done || absent || all_known())) {
+      set_ready();
+    }
+
+    PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&refresh_timer));
+  }
+
+  PROCESS_END();
+}
@@ -0,0 +1,142 @@
+/*
+ * Avvio comune dei nodi: attesa del root RPL, POST /register, orario del
+ * server (GET /register) e una GET /lookup?res=/a,/b,... per tutte le risorse
+ * remote, con la risposta a blocchi se serve. La registrazione
+ * si rinnova ogni NODE_RUNTIME_REFRESH secondi, perche' il server la fa
+ * scadere dopo il suo lifetime.
+ *
+ * La sequenza gira in node_runtime_process, senza bloccare il processo
+ * dell'applicazione, che riceve gli eventi ev_runtime_*. Register e lookup
+ * falliti si ritentano con backoff esponenziale (da NODE_RUNTIME_BACKOFF_MIN
+ * a NODE_RUNTIME_BACKOFF_MAX secondi, con jitter), senza attese attive. La
+ * lookup si ripete dopo ogni rinnovo, con al piu' NODE_RUNTIME_LOOKUP_TRIES
+ * tentativi: una destinazione assente (null o 4.04) o irraggiungibile non
+ * ferma i rinnovi, e quella gia' nota resta valida.
+ *
+ * Con NODE_RUNTIME_STORE gli esiti delle lookup sono salvati su CFS: dopo un
+ * riavvio le destinazioni note sono subito valide (ev_runtime_ready prima
+ * ancora del root) e vengono riconvalidate in background. Una destinazione
+ * cambiata nel frattempo si aggiorna sul posto e arriva ev_runtime_changed.
+ * node_runtime_load()/node_runtime_save() salvano allo stesso modo la
+ * configurazione dell'applicazione (es. le soglie dell'edge).
+ *
+ * Con NODE_RUNTIME_VIA_ROOT register, orario e lookup vanno al root RPL, che
+ * li serve dalla sua cache (border_router/resources/res_cache.h) senza
+ * attraversare lo SLIP; un 5.03 del root (risposta non ancora in cache o
+ * register in attesa del server) si ritenta con lo stesso backoff. Se il
+ * root non conferma NODE_RUNTIME_ROOT_TRIES register di fila (border router
+ * senza cache, server irraggiungibile o registrazione rifiutata) il nodo
+ * torna a NODE_RUNTIME_SERVER.
+ */
+#ifndef NODE_RUNTIME_H_
+#define NODE_RUNTIME_H_
+
+#include "contiki.h"
+#include "coap-engine.h"
+#include <stdint.h>
+
+/* Salvataggio su CFS, attivo di default (make NODE_STORE=0 lo toglie con il modulo cfs) */
+#ifdef NODE_RUNTIME_CONF_STORE
+#define NODE_RUNTIME_STORE NODE_RUNTIME_CONF_STORE
+#else
+#define NODE_RUNTIME_STORE 0
+#endif
+
+#ifdef NODE_RUNTIME_CONF_SERVER
+#define NODE_RUNTIME_SERVER NODE_RUNTIME_CONF_SERVER
+#else
+#define NODE_RUNTIME_SERVER "coap://[fd00::1]:5683"
+#endif
+
+/* Richieste al root RPL invece che al server */
+#ifdef NODE_RUNTIME_CONF_VIA_ROOT
+#define NODE_RUNTIME_VIA_ROOT NODE_RUNTIME_CONF_VIA_ROOT
+#else
+#define NODE_RUNTIME_VIA_ROOT 1
+#endif
+#ifdef NODE_RUNTIME_CONF_ROOT_TRIES
+#define NODE_RUNTIME_ROOT_TRIES NODE_RUNTIME_CONF_ROOT_TRIES
+#else
+#define NODE_RUNTIME_ROOT_TRIES 3
+#endif
+
+/* Tentativi per l'orario a ogni giro: senza orario il nodo usa clock_seconds() */
+#define NODE_RUNTIME_TIME_TRIES 3
+
+/* Tentativi della lookup a ogni giro dopo il primo */
+#ifdef NODE_RUNTIME_CONF_LOOKUP_TRIES
+#define NODE_RUNTIME_LOOKUP_TRIES NODE_RUNTIME_CONF_LOOKUP_TRIES
+#else
+#define NODE_RUNTIME_LOOKUP_TRIES 4
+#endif
+
+/* Query "res=/a,/b,..." e risposta ricomposta della lookup: bastano per le cinque
+ * destinazioni dell'edge (63 e circa 240 byte con indirizzi lunghi) */
+#ifdef NODE_RUNTIME_CONF_QUERY_SIZE
+#define NODE_RUNTIME_QUERY_SIZE NODE_RUNTIME_CONF_QUERY_SIZE
+#else
+#define NODE_RUNTIME_QUERY_SIZE 80
+#endif
+#ifdef NODE_RUNTIME_CONF_ANSWER_SIZE
+#define NODE_RUNTIME_ANSWER_SIZE NODE_RUNTIME_CONF_ANSWER_SIZE
+#else
+#define NODE_RUNTIME_ANSWER_SIZE 256
+#endif
+
+/* Attesa tra due tentativi falliti, in secondi: raddoppia fino al massimo */
+#ifdef NODE_RUNTIME_CONF_BACKOFF_MIN
+#define NODE_RUNTIME_BACKOFF_MIN NODE_RUNTIME_CONF_BACKOFF_MIN
+#else
+#define NODE_RUNTIME_BACKOFF_MIN 1
+#endif
+#ifdef NODE_RUNTIME_CONF_BACKOFF_MAX
+#define NODE_RUNTIME_BACKOFF_MAX NODE_RUNTIME_CONF_BACKOFF_MAX
+#else
+#define NODE_RUNTIME_BACKOFF_MAX 64
+#endif
+
+/* Rinnovo della registrazione, in secondi: meno del lifetime del server (600 s) */
+#ifdef NODE_RUNTIME_CONF_REFRESH
+#define NODE_RUNTIME_REFRESH NODE_RUNTIME_CONF_REFRESH
+#else
+#define NODE_RUNTIME_REFRESH 300
+#endif
+
+#define NODE_RUNTIME_PEERS_MAX 6
+
+/* Stato di una destinazione */
+#define NODE_RUNTIME_PEER_NONE  0 /* sconosciuta */
+#define NODE_RUNTIME_PEER_SAVED 1 /* letta dalla flash, da riconvalidare */
+#define NODE_RUNTIME_PEER_OK    2 /* confermata dalla lookup */
+
+/* Risorsa remota cercata con /lookup */
+typedef struct node_runtime_peer {
+  const char *path;          /* es. "/res_data" */
+  coap_endpoint_t *ep;       /* aggiornato dalla lookup */
+  unsigned int *format;      /* Content-Format verso la risorsa, NULL se solo JSON */
+  uint8_t state;
+} node_runtime_peer_t;
+
+/* Al processo che ha chiamato node_runtime_start() */
+extern process_event_t ev_runtime_registered; /* register confermata */
+extern process_event_t ev_runtime_ready;      /* destinazioni note o primo giro di lookup concluso (una volta) */
+extern process_event_t ev_runtime_changed;    /* data: node_runtime_peer_t cambiato */
+
+PROCESS_NAME(node_runtime_process);
+
+/* Avvia la sequenza. registration (payload della POST /register) e peers
+ * devono restare validi: il runtime li usa anche per le riconvalide */
+void node_runtime_start(const char *registration, node_runtime_peer_t *peers, uint8_t n);
+
+/* 1 dopo ev_runtime_ready. Una destinazione non ancora trovata resta
+ * NODE_RUNTIME_PEER_NONE: l'applicazione controlla state prima di usarla */
+int node_runtime_ready(void);
+
+/* Orario del server (epoch) piu' il tempo trascorso, 0 se non sincronizzato */
+uint32_t node_runtime_epoch(void);
+
+/* Dati dell'applicazione su CFS con crc16. load ritorna 1 se letti e validi */
+int node_runtime_load(const char *name, void *data, uint16_t size);
+int node_runtime_save(const char *name, const void *data, uint16_t size);
+
+#endif /* NODE_RUNTIME_H_ */
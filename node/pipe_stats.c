@@ -0,0 +1,84 @@
+#include "pipe_stats.h"
+#include "sys/energest.h"
+#include <stdio.h>
+
+static pipe_stat_t stats[PIPE_STAGES];
+
+static const char *const names[PIPE_STAGES] = {
+  "parse", "pair", "infer", "decide", "actuate", "uplink", "loop"
+};
+
+/* Estremi superiori dei bucket in us; l'ultimo bucket non ha limite */
+static const uint32_t bounds[PIPE_STATS_BUCKETS - 1] = {
+  100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000,
+  100000, 200000, 500000, 1000000, 2000000, 5000000
+};
+
+#define TICKS_TO_US(t) ((uint32_t)((uint64_t)(t) * 1000000 / RTIMER_SECOND))
+
+void
+pipe_stats_add(uint8_t stage, rtimer_clock_t ticks)
+{
+  pipe_stat_t *s;
+  uint32_t us = TICKS_TO_US(ticks);
+  uint8_t b = 0;
+
+  if(stage >= PIPE_STAGES) {
+    return;
+  }
+  s = &stats[stage];
+  while(b < PIPE_STATS_BUCKETS - 1 && us > bounds[b]) {
+    b++;
+  }
+  if(s->hist[b] < UINT16_MAX) {
+    s->hist[b]++;
+  }
+  s->count++;
+  s->sum += us;
+  if(us > s->max) {
+    s->max = us;
+  }
+}
+
+const pipe_stat_t *
+pipe_stats_get(uint8_t stage)
+{
+  return stage < PIPE_STAGES ? &stats[stage] : NULL;
+}
+
+#define APPEND(...) do { \
+    if(len < size) { \
+      len += snprintf(buf + len, size - len, __VA_ARGS__); \
+    } \
+  } while(0)
+
+/* {"ub":[...],"<stadio>":[count,sum,max,[hist]],...,"e":[cpu,lpm,deep_lpm,listen,tx]}
+ * con i tempi Energest in ms dall'avvio */
+int
+pipe_stats_json(char *buf, int size)
+{
+  int len = 0;
+  uint8_t i, b;
+
+  APPEND("{\"ub\":[");
+  for(b = 0; b < PIPE_STATS_BUCKETS - 1; b++) {
+    APPEND(b ? ",%lu" : "%lu", (unsigned long)bounds[b]);
+  }
+  APPEND("]");
+  for(i = 0; i < PIPE_STAGES; i++) {
+    APPEND(",\"%s\":[%lu,%lu,%lu,[", names[i], (unsigned long)stats[i].count,
+           (unsigned long)stats[i].sum, (unsigned long)stats[i].max);
+    for(b = 0; b < PIPE_STATS_BUCKETS; b++) {
+      APPEND(b ? ",%u" : "%u", stats[i].hist[b]);
+    }
+    APPEND("]]");
+  }
+#if ENERGEST_CONF_ON
+  energest_flush();
+#define E_MS(type) ((unsigned long)(energest_type_time(type) * 1000 / ENERGEST_SECOND))
+  APPEND(",\"e\":[%lu,%lu,%lu,%lu,%lu]", E_MS(ENERGEST_TYPE_CPU), E_MS(ENERGEST_TYPE_LPM),
+         E_MS(ENERGEST_TYPE_DEEP_LPM), E_MS(ENERGEST_TYPE_LISTEN), E_MS(ENERGEST_TYPE_TRANSMIT));
+#endif
+  APPEND("}");
+  return len < size ? len : size - 1;
+}
@@ -0,0 +1,59 @@
+/*
+ * Latenza per stadio della pipeline dell'edge, dal PUT di un sensore al
+ * PUT agli attuatori e all'invio al server, e consumo da Energest.
+ *
+ * Ogni stadio ha conteggio, somma, massimo e un istogramma a bucket fissi
+ * (serie 1-2-5 da 100 us a 5 s, l'ultimo bucket raccoglie il resto): il
+ * server ricava i percentili dalla differenza tra due letture successive.
+ * I contatori sono cumulativi dall'avvio e serviti in JSON da /res_stats
+ * (edge/resources/res_stats.c).
+ *
+ * Si abilita con PIPE_STATS_CONF_ENABLED: senza, PIPE_STATS_ADD non genera
+ * codice.
+ */
+#ifndef PIPE_STATS_H_
+#define PIPE_STATS_H_
+
+#include "contiki.h"
+#include "sys/rtimer.h"
+#include <stdint.h>
+
+#ifdef PIPE_STATS_CONF_ENABLED
+#define PIPE_STATS PIPE_STATS_CONF_ENABLED
+#else
+#define PIPE_STATS 0
+#endif
+
+#define PIPE_STATS_BUCKETS 16
+
+/* Stadi, in ordine di pipeline */
+#define PIPE_PARSE   0 /* PUT handler di /res_roof e /res_power: parsing e join */
+#define PIPE_PAIR    1 /* prima lettura dello slot -> slot completo (o grace scaduta) */
+#define PIPE_INFER   2 /* richiesta -> risultato dell'inferenza, con le attese tra le slice */
+#define PIPE_DECIDE  3 /* risultato -> decisione e PUT agli attuatori accodati */
+#define PIPE_ACTUATE 4 /* PUT agli attuatori accodato -> conferma */
+#define PIPE_UPLINK  5 /* invio al server accodato -> risposta */
+#define PIPE_LOOP    6 /* prima lettura dello slot -> attuatore confermato */
+#define PIPE_STAGES  7
+
+typedef struct pipe_stat {
+  uint32_t count;
+  uint32_t sum;          /* us */
+  uint32_t max;          /* us */
+  uint16_t hist[PIPE_STATS_BUCKETS];
+} pipe_stat_t;
+
+void pipe_stats_add(uint8_t stage, rtimer_clock_t ticks);
+
+const pipe_stat_t *pipe_stats_get(uint8_t stage);
+
+/* JSON di tutti gli stadi e dei tempi Energest, ritorna la lunghezza scritta */
+int pipe_stats_json(char *buf, int size);
+
+#if PIPE_STATS
+#define PIPE_STATS_ADD(stage, ticks) pipe_stats_add((stage), (ticks))
+#else
+#define PIPE_STATS_ADD(stage, ticks)
+#endif
+
+#endif /* PIPE_STATS_H_ */
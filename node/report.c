@@ -0,0 +1,92 @@
+#include "report.h"
+#include "sys/log.h"
+
+#define LOG_MODULE "Report"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+/* Media mobile con peso 1/4 al nuovo campione; sopra FAST si torna a un passo,
+ * sotto SLOW il periodo raddoppia */
+#define ACTIVITY_FAST 256
+#define ACTIVITY_SLOW 128
+
+void
+report_init(report_t *r, const int32_t *deadband, uint8_t n)
+{
+  r->deadband = deadband;
+  r->n = n < REPORT_MAX_VALUES ? n : REPORT_MAX_VALUES;
+  r->steps = 1;
+  r->started = 0;
+  r->activity = ACTIVITY_FAST;
+  r->day_steps = r->day_samples = r->day_sent = 0;
+  r->days = r->samples = r->sent = 0;
+}
+
+static void
+day_account(report_t *r, uint8_t steps, int send)
+{
+  r->samples++;
+  r->sent += send;
+  r->day_samples++;
+  r->day_sent += send;
+  r->day_steps += steps;
+  if(r->day_steps >= REPORT_DAY_STEPS) {
+    r->days++;
+    LOG_INFO("Giorno simulato %lu: %u campioni, %u inviati contro %u a periodo fisso (-%u%%)\n",
+             (unsigned long)r->days, r->day_samples, r->day_sent, r->day_steps,
+             (unsigned)(100 - r->day_sent * 100 / r->day_steps));
+    r->day_steps = r->day_samples = r->day_sent = 0;
+  }
+}
+
+int
+report_sample(report_t *r, const int32_t *values, uint8_t steps)
+{
+  uint32_t change = 0, moved = 0, d;
+  int send;
+  uint8_t i;
+
+  for(i = 0; i < r->n; i++) {
+    if(r->started && r->deadband[i] > 0) {
+      // Variazione per passo dal campione precedente e distanza dall'ultimo invio, in deadband x 256
+      d = (uint32_t)(values[i] > r->prev[i] ? values[i] - r->prev[i] : r->prev[i] - values[i]) * 256 / r->deadband[i];
+      d /= steps ? steps : 1;
+      if(d > change) {
+        change = d;
+      }
+      d = (uint32_t)(values[i] > r->last_sent[i] ? values[i] - r->last_sent[i] : r->last_sent[i] - values[i]);
+      if(d > (uint32_t)r->deadband[i]) {
+        moved = 1;
+      }
+    }
+    r->prev[i] = values[i];
+  }
+
+  send = !REPORT_ENABLED || !r->started || moved ||
+         clock_time() - r->last_time >= (clock_time_t)REPORT_MAX_SILENCE * CLOCK_SECOND;
+  if(r->started) {
+    r->activity = (uint16_t)((3 * (uint32_t)r->activity + (change > 0xffff ? 0xffff : change)) / 4);
+  }
+  r->started = 1;
+  if(send) {
+    for(i = 0; i < r->n; i++) {
+      r->last_sent[i] = values[i];
+    }
+    r->last_time = clock_time();
+  }
+
+  if(REPORT_ENABLED) {
+    if(r->activity >= ACTIVITY_FAST) {
+      r->steps = 1;
+    } else if(r->activity < ACTIVITY_SLOW && r->steps < REPORT_MAX_STEPS) {
+      r->steps = r->steps * 2 > REPORT_MAX_STEPS ? REPORT_MAX_STEPS : r->steps * 2;
+    }
+  }
+  day_account(r, steps, send);
+  return send;
+}
+
+uint8_t
+report_steps(const report_t *r)
+{
+  return r->steps;
+}
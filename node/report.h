@@ -0,0 +1,69 @@
+/*
+ * Invio a deadband e campionamento adattivo sui nodi sensore.
+ *
+ * Un campione viene inviato solo se almeno un valore si e' spostato di
+ * piu' della sua deadband dall'ultimo inviato, oppure dopo
+ * REPORT_MAX_SILENCE secondi senza invii (heartbeat: l'edge considera
+ * valido l'ultimo valore per tutto questo tempo).
+ *
+ * Il periodo di campionamento e' un multiplo del passo base del nodo (15 s,
+ * un'ora simulata sul roof): una media mobile della variazione per passo,
+ * in unita' di deadband, lo raddoppia fino a REPORT_MAX_STEPS passi quando
+ * i valori sono fermi e lo riporta a un passo appena si muovono.
+ *
+ * Ogni REPORT_DAY_STEPS passi (un giorno simulato) il nodo logga campioni
+ * presi e messaggi inviati rispetto all'invio a periodo fisso.
+ */
+#ifndef REPORT_H_
+#define REPORT_H_
+
+#include "contiki.h"
+#include <stdint.h>
+
+#ifdef REPORT_CONF_ENABLED
+#define REPORT_ENABLED REPORT_CONF_ENABLED
+#else
+#define REPORT_ENABLED 0
+#endif
+
+/* Silenzio massimo (s) tra due invii */
+#ifdef REPORT_CONF_MAX_SILENCE
+#define REPORT_MAX_SILENCE REPORT_CONF_MAX_SILENCE
+#else
+#define REPORT_MAX_SILENCE 120
+#endif
+
+/* Periodo massimo di campionamento, in passi base */
+#ifdef REPORT_CONF_MAX_STEPS
+#define REPORT_MAX_STEPS REPORT_CONF_MAX_STEPS
+#else
+#define REPORT_MAX_STEPS 4
+#endif
+
+#define REPORT_DAY_STEPS 24
+#define REPORT_MAX_VALUES 4
+
+typedef struct report {
+  const int32_t *deadband;   /* soglia di ogni valore */
+  uint8_t n;
+  uint8_t steps;             /* periodo corrente in passi base */
+  uint8_t started;
+  int32_t last_sent[REPORT_MAX_VALUES];
+  int32_t prev[REPORT_MAX_VALUES];
+  uint16_t activity;         /* media mobile della variazione per passo, deadband x 256 */
+  clock_time_t last_time;    /* ultimo invio */
+  /* Giorno simulato in corso e totali */
+  uint16_t day_steps, day_samples, day_sent;
+  uint32_t days, samples, sent;
+} report_t;
+
+void report_init(report_t *r, const int32_t *deadband, uint8_t n);
+
+/* Campione preso dopo steps passi base: ritorna 1 se va inviato (sempre
+ * senza REPORT_ENABLED) e aggiorna il periodo */
+int report_sample(report_t *r, const int32_t *values, uint8_t steps);
+
+/* Passi base fino al prossimo campione */
+uint8_t report_steps(const report_t *r);
+
+#endif /* REPORT_H_ */
@@ -0,0 +1,185 @@
+#include "sample_join.h"
+
+#define GRACE_TICKS ((clock_time_t)SAMPLE_JOIN_GRACE * CLOCK_SECOND)
+
+typedef struct entry {
+  uint32_t ts;           /* istante di misura (epoch) */
+  clock_time_t arrived;
+  uint8_t pending;
+} entry_t;
+
+static entry_t window[SAMPLE_JOIN_SOURCES][SAMPLE_JOIN_WINDOW];
+static uint16_t last_seq[SAMPLE_JOIN_SOURCES];
+static uint8_t seen[SAMPLE_JOIN_SOURCES];
+static uint32_t fired_ts;  /* lettura piu' recente dell'ultimo slot partito */
+static uint8_t fired;
+static sample_join_stats_t stats;
+
+static uint32_t
+distance(uint32_t a, uint32_t b)
+{
+  return a > b ? a - b : b - a;
+}
+
+int
+sample_join_add(uint8_t src, uint16_t seq, uint32_t ts)
+{
+  entry_t *w = window[src];
+  int i, slot = -1;
+
+  if(seen[src] && seq == last_seq[src]) {
+    stats.duplicates[src]++;
+    return SAMPLE_JOIN_DUPLICATE;
+  }
+  if(seen[src] && (int16_t)(seq - last_seq[src]) > 1) {
+    stats.lost[src] += (uint16_t)(seq - last_seq[src] - 1);
+  }
+  seen[src] = 1;
+  last_seq[src] = seq;
+  stats.received[src]++;
+
+  if(fired && ts <= fired_ts) {
+    stats.late[src]++;
+    return SAMPLE_JOIN_LATE;
+  }
+
+  // Posto libero, altrimenti si sacrifica la lettura piu' vecchia della sorgente
+  for(i = 0; i < SAMPLE_JOIN_WINDOW; i++) {
+    if(!w[i].pending) {
+      slot = i;
+      break;
+    }
+    if(slot < 0 || w[i].ts < w[slot].ts) {
+      slot = i;
+    }
+  }
+  if(w[slot].pending) {
+    stats.late[src]++;
+  }
+  w[slot].ts = ts;
+  w[slot].arrived = clock_time();
+  w[slot].pending = 1;
+  return slot;
+}
+
+// Lettura in attesa di src piu' vicina a ts, entro la tolleranza
+static int
+closest(uint8_t src, uint32_t ts)
+{
+  int i, best = -1;
+
+  for(i = 0; i < SAMPLE_JOIN_WINDOW; i++) {
+    const entry_t *e = &window[src][i];
+    if(e->pending && distance(e->ts, ts) <= SAMPLE_JOIN_TOLERANCE &&
+       (best < 0 || distance(e->ts, ts) < distance(window[src][best].ts, ts))) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+// Consuma le letture dello slot e quelle piu' vecchie, ormai inutili
+static void
+fire(const int8_t idx[SAMPLE_JOIN_SOURCES], uint32_t *ts)
+{
+  clock_time_t now = clock_time();
+  uint8_t s;
+  int i;
+
+  *ts = 0;
+  for(s = 0; s < SAMPLE_JOIN_SOURCES; s++) {
+    if(idx[s] >= 0) {
+      const entry_t *e = &window[s][idx[s]];
+      if(e->ts > *ts) {
+        *ts = e->ts;
+      }
+      if(now - e->arrived > stats.wait_max) {
+        stats.wait_max = now - e->arrived;
+      }
+    }
+  }
+  for(s = 0; s < SAMPLE_JOIN_SOURCES; s++) {
+    for(i = 0; i < SAMPLE_JOIN_WINDOW; i++) {
+      if(window[s][i].pending && window[s][i].ts <= *ts) {
+        window[s][i].pending = 0;
+      }
+    }
+  }
+  fired_ts = *ts;
+  fired = 1;
+}
+
+int
+sample_join_poll(int8_t idx[SAMPLE_JOIN_SOURCES], uint32_t *ts)
+{
+  const entry_t *anchor;
+  uint32_t after = 0;
+  uint8_t s, a, n;
+  int i, ai;
+
+  // Letture in attesa in ordine di misura: la piu' vecchia che completa uno slot
+  // lo fa partire, oppure la prima con la grace scaduta parte da sola
+  for(;;) {
+    anchor = NULL;
+    a = 0;
+    ai = -1;
+    for(s = 0; s < SAMPLE_JOIN_SOURCES; s++) {
+      for(i = 0; i < SAMPLE_JOIN_WINDOW; i++) {
+        const entry_t *e = &window[s][i];
+        if(e->pending && e->ts >= after && (anchor == NULL || e->ts < anchor->ts)) {
+          anchor = e;
+          a = s;
+          ai = i;
+        }
+      }
+    }
+    if(anchor == NULL) {
+      return SAMPLE_JOIN_NONE;
+    }
+
+    n = 0;
+    for(s = 0; s < SAMPLE_JOIN_SOURCES; s++) {
+      idx[s] = s == a ? ai : closest(s, anchor->ts);
+      n += idx[s] >= 0;
+    }
+    if(n == SAMPLE_JOIN_SOURCES) {
+      fire(idx, ts);
+      stats.complete++;
+      return SAMPLE_JOIN_COMPLETE;
+    }
+    if(clock_time() - anchor->arrived >= GRACE_TICKS) {
+      fire(idx, ts);
+      stats.partial++;
+      return SAMPLE_JOIN_PARTIAL;
+    }
+    after = anchor->ts + 1;
+  }
+}
+
+clock_time_t
+sample_join_next(void)
+{
+  clock_time_t now = clock_time(), next = 0, left;
+  uint8_t s;
+  int i;
+
+  for(s = 0; s < SAMPLE_JOIN_SOURCES; s++) {
+    for(i = 0; i < SAMPLE_JOIN_WINDOW; i++) {
+      const entry_t *e = &window[s][i];
+      if(!e->pending) {
+        continue;
+      }
+      left = now - e->arrived >= GRACE_TICKS ? 1 : GRACE_TICKS - (now - e->arrived);
+      if(next == 0 || left < next) {
+        next = left;
+      }
+    }
+  }
+  return next;
+}
+
+const sample_join_stats_t *
+sample_join_stats(void)
+{
+  return &stats;
+}
@@ -0,0 +1,83 @@
+/*
+ * Allineamento dei campioni di piu' sorgenti (es. roof e power) per slot
+ * temporale, al posto di un flag per sorgente e di un timer fisso.
+ *
+ * Ogni lettura porta il numero di sequenza e l'istante di misura (epoch) del
+ * sensore. Per ogni sorgente si tiene una finestra di SAMPLE_JOIN_WINDOW
+ * letture in attesa: uno slot e' completo quando ogni sorgente ha una lettura
+ * entro SAMPLE_JOIN_TOLERANCE secondi da quella piu' vecchia, e la decisione
+ * parte subito. Se manca qualcuno, lo slot parte incompleto
+ * SAMPLE_JOIN_GRACE secondi dopo l'arrivo della sua prima lettura.
+ *
+ * Il modulo gestisce solo i metadati: il chiamante salva il campione
+ * nell'indice restituito da sample_join_add() e con sample_join_poll()
+ * ottiene gli indici delle letture di ogni slot pronto.
+ * Buchi nella sequenza, duplicati e letture arrivate dopo la decisione del
+ * loro slot sono contati per sorgente.
+ */
+#ifndef SAMPLE_JOIN_H_
+#define SAMPLE_JOIN_H_
+
+#include "contiki.h"
+#include <stdint.h>
+
+#ifdef SAMPLE_JOIN_CONF_SOURCES
+#define SAMPLE_JOIN_SOURCES SAMPLE_JOIN_CONF_SOURCES
+#else
+#define SAMPLE_JOIN_SOURCES 2
+#endif
+
+/* Letture in attesa per sorgente */
+#ifdef SAMPLE_JOIN_CONF_WINDOW
+#define SAMPLE_JOIN_WINDOW SAMPLE_JOIN_CONF_WINDOW
+#else
+#define SAMPLE_JOIN_WINDOW 4
+#endif
+
+/* Distanza massima (s) tra le letture di uno slot: meta' del periodo dei sensori */
+#ifdef SAMPLE_JOIN_CONF_TOLERANCE
+#define SAMPLE_JOIN_TOLERANCE SAMPLE_JOIN_CONF_TOLERANCE
+#else
+#define SAMPLE_JOIN_TOLERANCE 7
+#endif
+
+/* Attesa (s) delle letture mancanti dopo la prima dello slot */
+#ifdef SAMPLE_JOIN_CONF_GRACE
+#define SAMPLE_JOIN_GRACE SAMPLE_JOIN_CONF_GRACE
+#else
+#define SAMPLE_JOIN_GRACE 5
+#endif
+
+#define SAMPLE_JOIN_DUPLICATE -1 /* stessa sequenza dell'ultima lettura */
+#define SAMPLE_JOIN_LATE      -2 /* il suo slot e' gia' partito */
+
+#define SAMPLE_JOIN_NONE     0
+#define SAMPLE_JOIN_COMPLETE 1
+#define SAMPLE_JOIN_PARTIAL  2
+
+typedef struct sample_join_stats {
+  uint16_t received[SAMPLE_JOIN_SOURCES];
+  uint16_t lost[SAMPLE_JOIN_SOURCES];       /* buchi nella sequenza */
+  uint16_t late[SAMPLE_JOIN_SOURCES];
+  uint16_t duplicates[SAMPLE_JOIN_SOURCES];
+  uint16_t complete;                        /* slot completi */
+  uint16_t partial;                         /* slot partiti a grace scaduta */
+  uint32_t wait_max;                        /* tick di clock dalla prima lettura alla decisione */
+} sample_join_stats_t;
+
+/* Nuova lettura di src. Ritorna l'indice nella finestra in cui il chiamante
+ * salva il campione, o SAMPLE_JOIN_DUPLICATE / SAMPLE_JOIN_LATE */
+int sample_join_add(uint8_t src, uint16_t seq, uint32_t ts);
+
+/* Prossimo slot pronto: idx riceve per ogni sorgente l'indice della lettura
+ * (-1 se manca) e ts l'istante di misura piu' recente dello slot. Gli slot
+ * piu' vecchi di uno completo vengono scartati. Ritorna SAMPLE_JOIN_NONE,
+ * SAMPLE_JOIN_COMPLETE o SAMPLE_JOIN_PARTIAL */
+int sample_join_poll(int8_t idx[SAMPLE_JOIN_SOURCES], uint32_t *ts);
+
+/* Tick di clock alla prossima grace in scadenza, 0 se nulla e' in attesa */
+clock_time_t sample_join_next(void);
+
+const sample_join_stats_t *sample_join_stats(void);
+
+#endif /* SAMPLE_JOIN_H_ */
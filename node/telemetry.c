@@ -0,0 +1,165 @@
+#include "telemetry.h"
+#include "coap-callback-api.h"
+#include "sys/energest.h"
+#include "net/ipv6/uip.h"
+#include "sys/log.h"
+#include <string.h>
+
+#define LOG_MODULE "Telemetry"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+#define TICKS_TO_MS(t) ((unsigned long)((t) * 1000 / ENERGEST_SECOND))
+
+static telemetry_stats_t stats;
+static uint8_t heartbeat_lost; // ultimo CON senza risposta: si resta CON
+static uint32_t last_sent, last_received;
+static uint8_t started;
+
+/* Stati Energest, nell'ordine delle correnti */
+#define STATE_CPU    0
+#define STATE_LPM    1
+#define STATE_DEEP   2
+#define STATE_LISTEN 3
+#define STATE_TX     4
+#define STATES       5
+static const uint32_t current_ua[STATES] = {
+  TELEMETRY_UA_CPU, TELEMETRY_UA_LPM, TELEMETRY_UA_DEEP_LPM, TELEMETRY_UA_LISTEN, TELEMETRY_UA_TX
+};
+static uint64_t last[STATES];
+
+static coap_callback_request_state_t con_state;
+static void (*con_handler)(coap_message_t *);
+static uint8_t con_busy;
+
+static void
+log_mean(const char *name, const telemetry_mode_stats_t *m)
+{
+  if(m->samples > 0) {
+    LOG_INFO("Media %s su %lu campioni: radio accesa %lu ms (tx %lu ms), cpu %lu ms, energia %lu uJ, "
+             "UDP %lu.%02lu inviati %lu.%02lu ricevuti\n",
+             name, (unsigned long)m->samples, TICKS_TO_MS(m->radio_on / m->samples), TICKS_TO_MS(m->radio_tx / m->samples),
+             TICKS_TO_MS(m->cpu / m->samples), (unsigned long)(m->energy / m->samples),
+             (unsigned long)(m->sent / m->samples), (unsigned long)(m->sent * 100 / m->samples % 100),
+             (unsigned long)(m->received / m->samples), (unsigned long)(m->received * 100 / m->samples % 100));
+  }
+}
+
+int
+telemetry_confirmable(uint16_t seq)
+{
+  return !TELEMETRY_NON || heartbeat_lost || seq % TELEMETRY_HEARTBEAT == 0;
+}
+
+void
+telemetry_con_done(coap_message_t *response)
+{
+  if(response == NULL) {
+    if(!heartbeat_lost) {
+      LOG_WARN("Edge senza risposta: campioni CON fino al prossimo ACK\n");
+    }
+    stats.heartbeat_failed++;
+    heartbeat_lost = 1;
+  } else {
+    heartbeat_lost = 0;
+  }
+}
+
+// Callback dell'API coap-callback-api: FINISHED chiude la transazione, il timeout senza risposta
+static void
+con_callback(coap_callback_request_state_t *state)
+{
+  switch(state->state.status) {
+  case COAP_REQUEST_STATUS_MORE:
+    return;
+  case COAP_REQUEST_STATUS_RESPONSE:
+    con_handler(state->state.response);
+    return;
+  case COAP_REQUEST_STATUS_FINISHED:
+    break;
+  default:
+    con_handler(NULL);
+    break;
+  }
+  con_busy = 0;
+}
+
+int
+telemetry_send_con(coap_endpoint_t *ep, coap_message_t *message, void (*handler)(coap_message_t *))
+{
+  if(con_busy) {
+    return 0;
+  }
+  message->type = COAP_TYPE_CON;
+  con_handler = handler;
+  con_busy = coap_send_request(&con_state, ep, message, con_callback) ? 1 : 0;
+  return con_busy;
+}
+
+int
+telemetry_send_non(const coap_endpoint_t *ep, coap_message_t *message)
+{
+  static uint8_t buf[COAP_MAX_PACKET_SIZE];
+  size_t len;
+
+  message->type = COAP_TYPE_NON;
+  len = coap_serialize_message(message, buf);
+  return len > 0 && coap_sendto(ep, buf, len) > 0;
+}
+
+void
+telemetry_sample_end(uint8_t confirmable)
+{
+  telemetry_mode_stats_t *m = &stats.mode[confirmable ? 1 : 0];
+  uint64_t now[STATES] = { 0 };
+  uint64_t d[STATES];
+  uint64_t energy = 0;
+  uint32_t sent = 0, received = 0;
+  uint8_t i;
+
+#if ENERGEST_CONF_ON
+  energest_flush();
+  now[STATE_CPU] = energest_type_time(ENERGEST_TYPE_CPU);
+  now[STATE_LPM] = energest_type_time(ENERGEST_TYPE_LPM);
+  now[STATE_DEEP] = energest_type_time(ENERGEST_TYPE_DEEP_LPM);
+  now[STATE_LISTEN] = energest_type_time(ENERGEST_TYPE_LISTEN);
+  now[STATE_TX] = energest_type_time(ENERGEST_TYPE_TRANSMIT);
+#endif
+#if UIP_STATISTICS
+  sent = uip_stat.udp.sent;
+  received = uip_stat.udp.recv;
+#endif
+
+  // Il primo campione fa solo da riferimento
+  if(started) {
+    // tick * uA * mV / (ENERGEST_SECOND * 1000) = uJ
+    for(i = 0; i < STATES; i++) {
+      d[i] = now[i] - last[i];
+      energy += d[i] * current_ua[i];
+    }
+    energy = energy * TELEMETRY_MV / ((uint64_t)ENERGEST_SECOND * 1000);
+    m->samples++;
+    m->radio_on += d[STATE_LISTEN] + d[STATE_TX];
+    m->radio_tx += d[STATE_TX];
+    m->cpu += d[STATE_CPU];
+    m->energy += energy;
+    m->sent += sent - last_sent;
+    m->received += received - last_received;
+    LOG_INFO("Campione %s: radio accesa %lu ms (tx %lu ms), cpu %lu ms, lpm %lu ms, lpm profondo %lu ms, "
+             "energia %lu uJ, UDP %lu inviati %lu ricevuti\n",
+             confirmable ? "CON" : "NON", TICKS_TO_MS(d[STATE_LISTEN] + d[STATE_TX]), TICKS_TO_MS(d[STATE_TX]),
+             TICKS_TO_MS(d[STATE_CPU]), TICKS_TO_MS(d[STATE_LPM]), TICKS_TO_MS(d[STATE_DEEP]),
+             (unsigned long)energy, (unsigned long)(sent - last_sent), (unsigned long)(received - last_received));
+    log_mean("CON", &stats.mode[1]);
+    log_mean("NON", &stats.mode[0]);
+  }
+  started = 1;
+  memcpy(last, now, sizeof(last));
+  last_sent = sent;
+  last_received = received;
+}
+
+const telemetry_stats_t *
+telemetry_stats(void)
+{
+  return &stats;
+}
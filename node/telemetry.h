@@ -0,0 +1,118 @@
+/*
+ * Invio della telemetria dai sensori all'edge.
+ *
+ * Di default ogni campione e' un PUT CON: ACK, eventuali ritrasmissioni e
+ * processo fermo fino alla risposta. Con TELEMETRY_CONF_NON i campioni
+ * partono NON, senza transazione ne' attesa, e uno ogni
+ * TELEMETRY_HEARTBEAT resta CON come heartbeat: se fallisce, i campioni
+ * successivi restano CON finche' l'edge non torna a rispondere. Le perdite
+ * le conta l'edge dai buchi nel numero di sequenza (seq) dei campioni.
+ *
+ * I CON partono con telemetry_send_con(), senza bloccare il processo: la
+ * risposta arriva al gestore e il nodo torna subito in LPM fino al
+ * prossimo campione.
+ *
+ * A ogni campione telemetry_sample_end() registra, dal campione precedente,
+ * il tempo con la radio accesa e in trasmissione, il tempo di CPU e in
+ * LPM/LPM profondo e l'energia che ne risulta con le correnti
+ * TELEMETRY_UA_* (Energest, con ENERGEST_CONF_ON), e i datagrammi UDP
+ * inviati e ricevuti (uip_stat, con UIP_CONF_STATISTICS), con le medie
+ * separate per CON e NON.
+ *
+ * Con make LOWPOWER=1 (TELEMETRY_LOWPOWER) roof e power usano il profilo a
+ * basso consumo dei loro project-conf.h: TSCH, campioni NON e LED spenti
+ * tra un campione e l'altro.
+ */
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include "contiki.h"
+#include "coap-engine.h"
+#include <stdint.h>
+
+#ifdef TELEMETRY_CONF_NON
+#define TELEMETRY_NON TELEMETRY_CONF_NON
+#else
+#define TELEMETRY_NON 0
+#endif
+
+/* Campioni tra due heartbeat CON in modalita' NON */
+#ifdef TELEMETRY_CONF_HEARTBEAT
+#define TELEMETRY_HEARTBEAT TELEMETRY_CONF_HEARTBEAT
+#else
+#define TELEMETRY_HEARTBEAT 8
+#endif
+
+#ifdef TELEMETRY_CONF_LOWPOWER
+#define TELEMETRY_LOWPOWER TELEMETRY_CONF_LOWPOWER
+#else
+#define TELEMETRY_LOWPOWER 0
+#endif
+
+/* Correnti per stato in uA e tensione in mV per l'energia per campione.
+ * Di default quelle di un Tmote Sky (MSP430 e CC2420) */
+#ifdef TELEMETRY_CONF_UA_CPU
+#define TELEMETRY_UA_CPU TELEMETRY_CONF_UA_CPU
+#else
+#define TELEMETRY_UA_CPU 1800
+#endif
+#ifdef TELEMETRY_CONF_UA_LPM
+#define TELEMETRY_UA_LPM TELEMETRY_CONF_UA_LPM
+#else
+#define TELEMETRY_UA_LPM 55
+#endif
+#ifdef TELEMETRY_CONF_UA_DEEP_LPM
+#define TELEMETRY_UA_DEEP_LPM TELEMETRY_CONF_UA_DEEP_LPM
+#else
+#define TELEMETRY_UA_DEEP_LPM 5
+#endif
+#ifdef TELEMETRY_CONF_UA_LISTEN
+#define TELEMETRY_UA_LISTEN TELEMETRY_CONF_UA_LISTEN
+#else
+#define TELEMETRY_UA_LISTEN 20000
+#endif
+#ifdef TELEMETRY_CONF_UA_TX
+#define TELEMETRY_UA_TX TELEMETRY_CONF_UA_TX
+#else
+#define TELEMETRY_UA_TX 17700
+#endif
+#ifdef TELEMETRY_CONF_MV
+#define TELEMETRY_MV TELEMETRY_CONF_MV
+#else
+#define TELEMETRY_MV 3000
+#endif
+
+typedef struct telemetry_mode_stats {
+  uint32_t samples;
+  uint64_t radio_on;     /* tick Energest in LISTEN + TRANSMIT */
+  uint64_t radio_tx;     /* tick Energest in TRANSMIT */
+  uint64_t cpu;          /* tick Energest in CPU */
+  uint64_t energy;       /* uJ */
+  uint32_t sent;         /* datagrammi UDP */
+  uint32_t received;
+} telemetry_mode_stats_t;
+
+typedef struct telemetry_stats {
+  telemetry_mode_stats_t mode[2]; /* 0 = NON, 1 = CON */
+  uint16_t heartbeat_failed;
+} telemetry_stats_t;
+
+/* 1 se il campione seq va inviato CON */
+int telemetry_confirmable(uint16_t seq);
+
+/* Esito di un PUT CON (response NULL per timeout), dal response handler */
+void telemetry_con_done(coap_message_t *response);
+
+/* Invia message come CON senza bloccare: handler riceve la risposta o NULL
+ * per timeout. Ritorna 0 se il CON precedente e' ancora in corso */
+int telemetry_send_con(coap_endpoint_t *ep, coap_message_t *message, void (*handler)(coap_message_t *));
+
+/* Invia message come NON, senza transazione. Ritorna 1 se inviato */
+int telemetry_send_non(const coap_endpoint_t *ep, coap_message_t *message);
+
+/* Fine del campione inviato CON (confirmable 1) o NON: costo dal campione precedente */
+void telemetry_sample_end(uint8_t confirmable);
+
+const telemetry_stats_t *telemetry_stats(void);
+
+#endif /* TELEMETRY_H_ */
@@ -0,0 +1,8 @@
+#ifndef CFS_COFFEE_H_
+#define CFS_COFFEE_H_
+
+#include "cfs/cfs.h"
+
+int cfs_coffee_reserve(const char *name, cfs_offset_t size);
+
+#endif /* CFS_COFFEE_H_ */
@@ -0,0 +1,26 @@
+/* API CFS di Contiki-NG, implementata in RAM da stub/cfs_ram.c */
+#ifndef CFS_H_
+#define CFS_H_
+
+typedef long cfs_offset_t;
+
+#define CFS_READ   1
+#define CFS_WRITE  2
+#define CFS_APPEND 4
+
+#define CFS_SEEK_SET 0
+#define CFS_SEEK_CUR 1
+#define CFS_SEEK_END 2
+
+int cfs_open(const char *name, int flags);
+void cfs_close(int fd);
+int cfs_read(int fd, void *buf, unsigned int len);
+int cfs_write(int fd, const void *buf, unsigned int len);
+cfs_offset_t cfs_seek(int fd, cfs_offset_t offset, int whence);
+int cfs_remove(const char *name);
+
+/* Solo per i test: file presenti e byte del file invertito */
+int cfs_ram_files(void);
+int cfs_ram_corrupt(const char *name, cfs_offset_t offset);
+
+#endif /* CFS_H_ */
@@ -0,0 +1,187 @@
+// === CFS in RAM per i test di node/, con la semantica di Coffee ===
+// CFS_WRITE senza CFS_APPEND tronca il file; cfs_coffee_reserve() crea un
+// file vuoto. Include il crc16 di os/lib/crc16.c.
+#include <string.h>
+#include "cfs/cfs.h"
+#include "cfs/cfs-coffee.h"
+#include "lib/crc16.h"
+
+#define FILES    16
+#define FDS      4
+#define FILE_MAX 4096
+
+struct ram_file {
+  char name[16];
+  unsigned char data[FILE_MAX];
+  cfs_offset_t end;
+  int used;
+};
+
+struct ram_fd {
+  struct ram_file *f;
+  cfs_offset_t offset;
+  int used;
+};
+
+static struct ram_file files[FILES];
+static struct ram_fd fds[FDS];
+
+static struct ram_file *
+find(const char *name, int create)
+{
+  int i;
+
+  for(i = 0; i < FILES; i++) {
+    if(files[i].used && strcmp(files[i].name, name) == 0) {
+      return &files[i];
+    }
+  }
+  for(i = 0; create && i < FILES; i++) {
+    if(!files[i].used) {
+      files[i].used = 1;
+      strncpy(files[i].name, name, sizeof(files[i].name) - 1);
+      files[i].end = 0;
+      return &files[i];
+    }
+  }
+  return NULL;
+}
+
+int
+cfs_open(const char *name, int flags)
+{
+  struct ram_file *f = find(name, flags & CFS_WRITE);
+  int i;
+
+  if(f == NULL) {
+    return -1;
+  }
+  for(i = 0; i < FDS; i++) {
+    if(!fds[i].used) {
+      if((flags & CFS_WRITE) && !(flags & CFS_APPEND)) {
+        f->end = 0;
+      }
+      fds[i].used = 1;
+      fds[i].f = f;
+      fds[i].offset = (flags & CFS_APPEND) ? f->end : 0;
+      return i;
+    }
+  }
+  return -1;
+}
+
+void
+cfs_close(int fd)
+{
+  fds[fd].used = 0;
+}
+
+int
+cfs_read(int fd, void *buf, unsigned int len)
+{
+  struct ram_fd *d = &fds[fd];
+
+  if(d->offset + (cfs_offset_t)len > d->f->end) {
+    len = d->offset < d->f->end ? d->f->end - d->offset : 0;
+  }
+  memcpy(buf, d->f->data + d->offset, len);
+  d->offset += len;
+  return len;
+}
+
+int
+cfs_write(int fd, const void *buf, unsigned int len)
+{
+  struct ram_fd *d = &fds[fd];
+
+  if(d->offset + (cfs_offset_t)len > FILE_MAX) {
+    return -1;
+  }
+  memcpy(d->f->data + d->offset, buf, len);
+  d->offset += len;
+  if(d->offset > d->f->end) {
+    d->f->end = d->offset;
+  }
+  return len;
+}
+
+cfs_offset_t
+cfs_seek(int fd, cfs_offset_t offset, int whence)
+{
+  struct ram_fd *d = &fds[fd];
+
+  if(whence == CFS_SEEK_END) {
+    offset += d->f->end;
+  } else if(whence == CFS_SEEK_CUR) {
+    offset += d->offset;
+  }
+  if(offset < 0 || offset > FILE_MAX) {
+    return -1;
+  }
+  d->offset = offset;
+  return offset;
+}
+
+int
+cfs_remove(const char *name)
+{
+  struct ram_file *f = find(name, 0);
+
+  if(f == NULL) {
+    return -1;
+  }
+  f->used = 0;
+  return 0;
+}
+
+int
+cfs_coffee_reserve(const char *name, cfs_offset_t size)
+{
+  return size <= FILE_MAX && find(name, 1) != NULL ? 0 : -1;
+}
+
+int
+cfs_ram_files(void)
+{
+  int i, n = 0;
+
+  for(i = 0; i < FILES; i++) {
+    n += files[i].used;
+  }
+  return n;
+}
+
+int
+cfs_ram_corrupt(const char *name, cfs_offset_t offset)
+{
+  struct ram_file *f = find(name, 0);
+
+  if(f == NULL || offset >= f->end) {
+    return -1;
+  }
+  f->data[offset] ^= 0xff;
+  return 0;
+}
+
+unsigned short
+crc16_add(unsigned char b, unsigned short acc)
+{
+  acc ^= b;
+  acc = (acc >> 8) | (acc << 8);
+  acc ^= (acc & 0xff00) << 4;
+  acc ^= (acc >> 8) >> 4;
+  acc ^= (acc & 0xff00) >> 5;
+  return acc;
+}
+
+unsigned short
+crc16_data(const unsigned char *data, int len, unsigned short acc)
+{
+  int i;
+
+  for(i = 0; i < len; ++i) {
+    acc = crc16_add(*data, acc);
+    ++data;
+  }
+  return acc;
+}
@@ -0,0 +1,59 @@
+// === Orologio e ctimer finti per i test di node/ ===
+#include "contiki.h"
+#include "sys/ctimer.h"
+
+clock_time_t test_clock;
+
+static struct ctimer *last;
+
+clock_time_t
+clock_time(void)
+{
+  return test_clock;
+}
+
+unsigned long
+clock_seconds(void)
+{
+  return test_clock / CLOCK_SECOND;
+}
+
+rtimer_clock_t
+rtimer_arch_now(void)
+{
+  return (rtimer_clock_t)((uint64_t)test_clock * RTIMER_SECOND / CLOCK_SECOND);
+}
+
+void
+ctimer_set(struct ctimer *c, clock_time_t t, void (*f)(void *), void *ptr)
+{
+  c->expire = test_clock + t;
+  c->f = f;
+  c->ptr = ptr;
+  c->armed = 1;
+  last = c;
+}
+
+void
+ctimer_stop(struct ctimer *c)
+{
+  c->armed = 0;
+}
+
+int
+ctimer_expired(struct ctimer *c)
+{
+  return !c->armed || test_clock >= c->expire;
+}
+
+int
+ctimer_fire(void)
+{
+  if(last == NULL || !last->armed) {
+    return 0;
+  }
+  last->armed = 0;
+  test_clock = last->expire > test_clock ? last->expire : test_clock;
+  last->f(last->ptr);
+  return 1;
+}
@@ -0,0 +1,31 @@
+/* API a callback di Contiki-NG: coap_send_request() la implementa il test */
+#ifndef COAP_CALLBACK_API_H_
+#define COAP_CALLBACK_API_H_
+
+#include "coap-engine.h"
+
+typedef enum {
+  COAP_REQUEST_STATUS_RESPONSE,
+  COAP_REQUEST_STATUS_MORE,
+  COAP_REQUEST_STATUS_FINISHED,
+  COAP_REQUEST_STATUS_TIMEOUT,
+  COAP_REQUEST_STATUS_BLOCK_ERROR
+} coap_request_status_t;
+
+typedef struct coap_request_state {
+  coap_message_t *response;
+  coap_request_status_t status;
+} coap_request_state_t;
+
+typedef struct coap_callback_request_state coap_callback_request_state_t;
+
+struct coap_callback_request_state {
+  coap_request_state_t state;
+  void (*callback)(coap_callback_request_state_t *state);
+};
+
+int coap_send_request(coap_callback_request_state_t *state, coap_endpoint_t *endpoint,
+                      coap_message_t *request,
+                      void (*callback)(coap_callback_request_state_t *state));
+
+#endif /* COAP_CALLBACK_API_H_ */
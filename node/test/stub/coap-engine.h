@@ -0,0 +1,45 @@
+/* Quel che serve del motore CoAP di Contiki-NG: i messaggi restano opachi,
+ * il test vede solo percorso, payload e Block1 impostati (test_queue.c) */
+#ifndef COAP_ENGINE_H_
+#define COAP_ENGINE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define COAP_MAX_OPEN_TRANSACTIONS 4
+
+typedef enum { COAP_TYPE_CON, COAP_TYPE_NON, COAP_TYPE_ACK, COAP_TYPE_RST } coap_message_type_t;
+typedef enum { COAP_GET = 1, COAP_POST, COAP_PUT, COAP_DELETE } coap_method_t;
+
+enum {
+  CHANGED_2_04 = 68,
+  CONTINUE_2_31 = 95,
+  BAD_REQUEST_4_00 = 128,
+  SERVICE_UNAVAILABLE_5_03 = 163
+};
+
+enum { TEXT_PLAIN = 0, APPLICATION_JSON = 50 };
+
+typedef struct coap_message {
+  uint8_t code;
+  const char *path;
+  const uint8_t *payload;
+  size_t len;
+  uint32_t block_num;
+  uint8_t block_more;
+  uint16_t block_size;
+  uint8_t block1;
+} coap_message_t;
+
+typedef struct coap_endpoint {
+  int id;
+} coap_endpoint_t;
+
+void coap_init_message(coap_message_t *m, coap_message_type_t type, uint8_t code, uint16_t mid);
+uint16_t coap_get_mid(void);
+int coap_set_header_uri_path(coap_message_t *m, const char *path);
+int coap_set_header_content_format(coap_message_t *m, unsigned int format);
+int coap_set_header_block1(coap_message_t *m, uint32_t num, uint8_t more, uint16_t size);
+int coap_set_payload(coap_message_t *m, const void *payload, size_t len);
+
+#endif /* COAP_ENGINE_H_ */
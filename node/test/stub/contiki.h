@@ -0,0 +1,10 @@
+/* contiki.h minimo per i test di node/ sull'host */
+#ifndef CONTIKI_H_
+#define CONTIKI_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sys/clock.h"
+#include "sys/rtimer.h"
+
+#endif /* CONTIKI_H_ */
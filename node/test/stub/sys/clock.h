@@ -0,0 +1,14 @@
+/* Orologio finto dei test: il test sposta test_clock a mano (stub/clock.c) */
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+typedef unsigned long clock_time_t;
+
+#define CLOCK_SECOND 128
+
+extern clock_time_t test_clock;
+
+clock_time_t clock_time(void);
+unsigned long clock_seconds(void);
+
+#endif /* CLOCK_H_ */
@@ -0,0 +1,21 @@
+/* ctimer senza scheduler: il test chiama ctimer_fire() quando vuole la scadenza */
+#ifndef CTIMER_H_
+#define CTIMER_H_
+
+#include "sys/clock.h"
+
+struct ctimer {
+  clock_time_t expire;
+  void (*f)(void *);
+  void *ptr;
+  int armed;
+};
+
+void ctimer_set(struct ctimer *c, clock_time_t t, void (*f)(void *), void *ptr);
+void ctimer_stop(struct ctimer *c);
+int ctimer_expired(struct ctimer *c);
+
+/* Esegue la callback dell'ultimo ctimer armato, se c'e'. Ritorna 1 se l'ha eseguita */
+int ctimer_fire(void);
+
+#endif /* CTIMER_H_ */
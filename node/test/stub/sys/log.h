@@ -0,0 +1,22 @@
+/* Log di Contiki-NG su stdout, con il modulo come prefisso */
+#ifndef LOG_H_
+#define LOG_H_
+
+#include <stdio.h>
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERR  1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DBG  4
+
+#define LOG_PRINT_(level, ...) do { \
+    if(LOG_LEVEL >= (level)) { printf("[%s] ", LOG_MODULE); printf(__VA_ARGS__); } \
+  } while(0)
+
+#define LOG_ERR(...)  LOG_PRINT_(LOG_LEVEL_ERR, __VA_ARGS__)
+#define LOG_WARN(...) LOG_PRINT_(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_INFO(...) LOG_PRINT_(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DBG(...)  LOG_PRINT_(LOG_LEVEL_DBG, __VA_ARGS__)
+
+#endif /* LOG_H_ */
@@ -0,0 +1,14 @@
+/* rtimer che segue test_clock (stub/clock.c) */
+#ifndef RTIMER_H_
+#define RTIMER_H_
+
+#include <stdint.h>
+
+typedef uint32_t rtimer_clock_t;
+
+#define RTIMER_SECOND 32768
+
+rtimer_clock_t rtimer_arch_now(void);
+#define RTIMER_NOW() rtimer_arch_now()
+
+#endif /* RTIMER_H_ */
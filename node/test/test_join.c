@@ -0,0 +1,108 @@
+// === Allineamento dei campioni per slot (node/sample_join.c) ===
+// Due sorgenti, roof e power, con il periodo dei sensori (15 s): letture in
+// fase, sfasate oltre la tolleranza, perse, duplicate, in ritardo, piu' slot
+// pronti insieme e finestra piena. Il tempo dell'edge (test_clock) e quello
+// di misura (ts) avanzano insieme, con i ritardi di rete scelti dal test.
+#include <stdio.h>
+#include "sample_join.h"
+
+#define ROOF  0
+#define POWER 1
+
+static uint16_t seq[SAMPLE_JOIN_SOURCES];
+static int errors;
+
+static void
+check(int cond, const char *what)
+{
+  if(!cond) {
+    printf("ERRORE: %s\n", what);
+    errors++;
+  }
+}
+
+// Lettura di src misurata a ts e arrivata all'edge al secondo now
+static int
+add(uint8_t src, uint32_t ts, uint32_t now)
+{
+  test_clock = (clock_time_t)now * CLOCK_SECOND;
+  return sample_join_add(src, seq[src]++, ts);
+}
+
+// Slot pronto al secondo now: ritorna l'esito e in ts l'istante dello slot
+static int
+poll(uint32_t now, int8_t idx[SAMPLE_JOIN_SOURCES], uint32_t *ts)
+{
+  test_clock = (clock_time_t)now * CLOCK_SECOND;
+  return sample_join_poll(idx, ts);
+}
+
+int
+main(void)
+{
+  const sample_join_stats_t *s = sample_join_stats();
+  int8_t idx[SAMPLE_JOIN_SOURCES];
+  uint32_t ts;
+  int r, p;
+
+  // In fase: lo slot parte all'arrivo della seconda lettura
+  r = add(ROOF, 1000, 1);
+  check(poll(1, idx, &ts) == SAMPLE_JOIN_NONE, "slot partito senza power");
+  check(sample_join_next() == SAMPLE_JOIN_GRACE * CLOCK_SECOND, "scadenza della grace");
+  p = add(POWER, 1003, 4);
+  check(poll(4, idx, &ts) == SAMPLE_JOIN_COMPLETE && idx[ROOF] == r && idx[POWER] == p && ts == 1003,
+        "slot in fase non completo");
+  check(poll(4, idx, &ts) == SAMPLE_JOIN_NONE && sample_join_next() == 0,
+        "letture dello slot non consumate");
+
+  // Sfasate oltre la tolleranza: roof parte da solo a grace scaduta
+  add(ROOF, 1015, 16);
+  check(poll(20, idx, &ts) == SAMPLE_JOIN_NONE, "slot partito prima della grace");
+  check(poll(21, idx, &ts) == SAMPLE_JOIN_PARTIAL && idx[POWER] == -1 && ts == 1015,
+        "slot incompleto a grace scaduta");
+  add(POWER, 1025, 26);
+  add(ROOF, 1030, 31);
+  check(poll(31, idx, &ts) == SAMPLE_JOIN_COMPLETE && ts == 1030, "slot sfasato entro la tolleranza");
+
+  // Power perso (buco nella sequenza), la lettura dopo arriva a slot partito
+  // e la sua ritrasmissione e' un duplicato
+  add(ROOF, 1045, 46);
+  check(poll(51, idx, &ts) == SAMPLE_JOIN_PARTIAL && ts == 1045, "slot senza power");
+  seq[POWER]++;
+  check(add(POWER, 1044, 52) == SAMPLE_JOIN_LATE, "lettura in ritardo accettata");
+  check(s->lost[POWER] == 1, "buco nella sequenza non contato");
+  seq[POWER]--;
+  check(add(POWER, 1044, 53) == SAMPLE_JOIN_DUPLICATE, "duplicato accettato");
+
+  // Due slot pronti insieme (l'edge non ha fatto poll) partono in ordine di misura
+  add(ROOF, 1089, 90);
+  add(POWER, 1090, 91);
+  add(ROOF, 1100, 101);
+  add(POWER, 1101, 102);
+  check(poll(102, idx, &ts) == SAMPLE_JOIN_COMPLETE && ts == 1090, "primo slot pronto");
+  check(poll(102, idx, &ts) == SAMPLE_JOIN_COMPLETE && ts == 1101, "secondo slot pronto");
+
+  // Una lettura rimasta sola piu' vecchia di uno slot completo viene scartata
+  add(ROOF, 1115, 130);
+  add(ROOF, 1130, 131);
+  add(POWER, 1131, 132);
+  check(poll(132, idx, &ts) == SAMPLE_JOIN_COMPLETE && ts == 1131, "slot completo dopo una lettura sola");
+  check(poll(140, idx, &ts) == SAMPLE_JOIN_NONE, "lettura piu' vecchia di uno slot completo non scartata");
+
+  // Finestra piena: la lettura piu' vecchia della sorgente si sacrifica
+  for(r = 0; r <= SAMPLE_JOIN_WINDOW; r++) {
+    add(ROOF, 1145 + 15 * r, 146);
+  }
+  check(s->late[ROOF] == 1, "lettura sacrificata a finestra piena non contata");
+  check(poll(146, idx, &ts) == SAMPLE_JOIN_NONE, "slot partito con la finestra piena");
+  check(poll(151, idx, &ts) == SAMPLE_JOIN_PARTIAL && ts == 1160,
+        "la lettura sacrificata non e' la piu' vecchia");
+
+  // La lettura di roof a 1089 ha atteso 12 s il poll
+  check(s->wait_max == 12 * CLOCK_SECOND, "attesa massima");
+  printf("Allineamento: completi %u, incompleti %u, persi %u/%u, in ritardo %u/%u, duplicati %u/%u, "
+         "attesa max %lu tick: %s\n", s->complete, s->partial, s->lost[ROOF], s->lost[POWER],
+         s->late[ROOF], s->late[POWER], s->duplicates[ROOF], s->duplicates[POWER],
+         (unsigned long)s->wait_max, errors ? "ERRORI" : "ok");
+  return errors != 0;
+}
@@ -0,0 +1,134 @@
+// === Journal su CFS (node/journal.c) con un CFS in RAM ===
+// Ogni record porta il suo numero d'ordine: la rilettura deve restituirli
+// tutti, in ordine e senza doppioni, attraverso la rotazione dei segmenti,
+// lo scarto a journal pieno, i riavvii (journal_init() sugli stessi file) e
+// un record corrotto in testa, che si salta una volta sola.
+#include <stdio.h>
+#include <string.h>
+#include "journal.h"
+#include "cfs/cfs.h"
+
+#define CAPACITY (JOURNAL_SEGMENTS * JOURNAL_SEG_RECORDS)
+#define ENTRY_SIZE (8 + sizeof(record_t)) /* intestazione seq + crc + riservato */
+
+typedef struct record {
+  uint32_t v;
+  uint8_t pad[20];
+} record_t;
+
+static int errors;
+
+static void
+check(int cond, const char *what)
+{
+  if(!cond) {
+    printf("ERRORE: %s\n", what);
+    errors++;
+  }
+}
+
+static void
+append_range(uint32_t from, uint32_t to)
+{
+  record_t r;
+
+  memset(&r, 0, sizeof(r));
+  for(r.v = from; r.v < to; r.v++) {
+    r.pad[0] = (uint8_t)r.v;
+    if(journal_append(&r) != JOURNAL_OK) {
+      check(0, "journal_append fallito");
+      return;
+    }
+  }
+}
+
+static uint32_t
+peek_first(void)
+{
+  record_t r;
+
+  return journal_peek(&r, 1) == 1 ? r.v : 0xffffffff;
+}
+
+// Rilegge a blocchi di 8, un blocco ogni 2 s, con un riavvio quando si
+// raggiunge reboot_at. Ritorna il valore atteso dopo l'ultimo record letto
+static uint32_t
+replay(uint32_t expect, uint32_t reboot_at)
+{
+  record_t r[8];
+  uint8_t n, i;
+
+  while((n = journal_peek(r, 8)) > 0) {
+    for(i = 0; i < n; i++, expect++) {
+      if(r[i].v != expect || r[i].pad[0] != (uint8_t)expect) {
+        printf("ERRORE: letto %lu al posto di %lu\n", (unsigned long)r[i].v, (unsigned long)expect);
+        errors++;
+        return expect;
+      }
+    }
+    test_clock += 2 * CLOCK_SECOND;
+    journal_ack(n);
+    if(expect == reboot_at) {
+      journal_init(sizeof(record_t));
+    }
+  }
+  return expect;
+}
+
+int
+main(void)
+{
+  static uint8_t big[JOURNAL_RECORD_MAX + 1];
+  const journal_stats_t *s = journal_stats();
+  uint32_t expect;
+  char name[4] = "jr0";
+
+  test_clock = CLOCK_SECOND;
+  journal_init(sizeof(record_t));
+  check(journal_depth() == 0, "journal nuovo non vuoto");
+
+  // Oltre la capienza: il segmento piu' vecchio si riusa e i suoi record si scartano
+  append_range(0, CAPACITY + 44);
+  check(s->evicted == JOURNAL_SEG_RECORDS, "record scartati a journal pieno");
+  check(journal_depth() == CAPACITY + 44 - JOURNAL_SEG_RECORDS, "profondita' dopo lo scarto");
+  check(peek_first() == JOURNAL_SEG_RECORDS, "testa dopo lo scarto");
+
+  // Riavvio: stato ricostruito dai segmenti e dalla testa salvata
+  journal_init(sizeof(record_t));
+  check(journal_depth() == CAPACITY + 44 - JOURNAL_SEG_RECORDS, "profondita' dopo il riavvio");
+  check(peek_first() == JOURNAL_SEG_RECORDS, "testa dopo il riavvio");
+
+  // Rilettura con un riavvio a meta': si riparte dall'ultimo blocco confermato
+  expect = replay(JOURNAL_SEG_RECORDS, 200);
+  check(expect == CAPACITY + 44 && journal_depth() == 0, "rilettura incompleta");
+  check(s->replayed == CAPACITY + 44 - JOURNAL_SEG_RECORDS, "record confermati");
+  // 8 record ogni 2 s, contati dal primo ack
+  check(s->rate >= 8 * 30 && s->rate < 8 * 33, "velocita' del recupero");
+  // Restano la testa salvata e il segmento in scrittura
+  check(cfs_ram_files() == 2, "segmenti confermati non cancellati");
+
+  // Journal vuoto: si riprende a meta' del segmento cancellato, anche dopo un riavvio
+  append_range(1000, 1010);
+  journal_init(sizeof(record_t));
+  check(journal_depth() == 10 && peek_first() == 1000, "ripresa a meta' segmento");
+
+  // Record corrotto in testa: si salta, e la testa nuova sopravvive al riavvio
+  name[2] = '0' + ((CAPACITY + 44) / JOURNAL_SEG_RECORDS) % JOURNAL_SEGMENTS;
+  cfs_ram_corrupt(name, ((CAPACITY + 44) % JOURNAL_SEG_RECORDS) * ENTRY_SIZE + 8);
+  check(peek_first() == 1001 && s->errors == 1, "record corrotto in testa non saltato");
+  journal_init(sizeof(record_t));
+  check(journal_depth() == 9 && peek_first() == 1001 && s->errors == 1,
+        "record corrotto riletto dopo il riavvio");
+  expect = replay(1001, 0);
+  check(expect == 1010, "rilettura dopo il record corrotto");
+
+  append_range(2000, 2001);
+  check(peek_first() == 2000, "append dopo il recupero");
+  journal_init(sizeof(big));
+  check(journal_append(big) == JOURNAL_ERR_SIZE, "record oltre JOURNAL_RECORD_MAX accettato");
+
+  printf("Journal: scritti %lu, confermati %lu, scartati %lu, errori %u, %u record/min: %s\n",
+         (unsigned long)s->appended, (unsigned long)s->replayed, (unsigned long)s->evicted,
+         s->errors, s->rate, errors ? "ERRORI" : "ok");
+  return errors != 0;
+}
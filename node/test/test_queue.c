@@ -0,0 +1,222 @@
+// === Coda CoAP in uscita (node/coap_queue.c) con un motore CoAP finto ===
+// Il motore tiene le richieste inviate in una lista e il test decide quando
+// rispondere, andare in timeout o rifiutare l'invio (transazioni esaurite).
+// Si verificano l'ordine di priorita', il limite di richieste in volo, la
+// sostituzione dei comandi, lo scarto a coda piena, i tentativi dopo un
+// invio rifiutato, i timeout e i blocchi Block1.
+#include <stdio.h>
+#include <string.h>
+#include "coap_queue.h"
+#include "sys/ctimer.h"
+
+#define FLIGHT_MAX 8
+
+static coap_callback_request_state_t *flight[FLIGHT_MAX];
+static int n_flight, refuse;
+static char sent_log[256];
+static char done_log[256];
+static int errors;
+
+static void
+check(int cond, const char *what)
+{
+  if(!cond) {
+    printf("ERRORE: %s\n", what);
+    errors++;
+  }
+}
+
+// --- Motore CoAP finto ---
+
+void
+coap_init_message(coap_message_t *m, coap_message_type_t type, uint8_t code, uint16_t mid)
+{
+  memset(m, 0, sizeof(*m));
+  m->code = code;
+}
+
+uint16_t
+coap_get_mid(void)
+{
+  return 0;
+}
+
+int
+coap_set_header_uri_path(coap_message_t *m, const char *path)
+{
+  m->path = path;
+  return 1;
+}
+
+int
+coap_set_header_content_format(coap_message_t *m, unsigned int format)
+{
+  return 1;
+}
+
+int
+coap_set_header_block1(coap_message_t *m, uint32_t num, uint8_t more, uint16_t size)
+{
+  m->block1 = 1;
+  m->block_num = num;
+  m->block_more = more;
+  m->block_size = size;
+  return 1;
+}
+
+int
+coap_set_payload(coap_message_t *m, const void *payload, size_t len)
+{
+  m->payload = payload;
+  m->len = len;
+  return 1;
+}
+
+int
+coap_send_request(coap_callback_request_state_t *state, coap_endpoint_t *endpoint,
+                  coap_message_t *request,
+                  void (*callback)(coap_callback_request_state_t *state))
+{
+  if(refuse > 0) {
+    refuse--;
+    return 0;
+  }
+  state->callback = callback;
+  flight[n_flight++] = state;
+  strcat(sent_log, request->path);
+  strcat(sent_log, " ");
+  return 1;
+}
+
+static coap_message_t *
+request_of(int i)
+{
+  return ((coap_queue_item_t *)flight[i])->request;
+}
+
+// Chiude la transazione i: risposta con code, o timeout se code e' 0
+static void
+finish(int i, uint8_t code)
+{
+  coap_callback_request_state_t *s = flight[i];
+  coap_message_t response;
+
+  memmove(&flight[i], &flight[i + 1], (n_flight - i - 1) * sizeof(flight[0]));
+  n_flight--;
+  if(code == 0) {
+    s->state.response = NULL;
+    s->state.status = COAP_REQUEST_STATUS_TIMEOUT;
+    s->callback(s);
+    return;
+  }
+  memset(&response, 0, sizeof(response));
+  response.code = code;
+  s->state.response = &response;
+  s->state.status = COAP_REQUEST_STATUS_RESPONSE;
+  s->callback(s);
+  s->state.response = NULL;
+  s->state.status = COAP_REQUEST_STATUS_FINISHED;
+  s->callback(s);
+}
+
+static int idle_in_done;
+
+static void
+done(coap_queue_item_t *item, coap_message_t *response)
+{
+  char entry[48];
+
+  snprintf(entry, sizeof(entry), "%s:%s ", item->path, response == NULL ? "-" : "ok");
+  strcat(done_log, entry);
+  idle_in_done = coap_queue_idle();
+}
+
+static int
+send(coap_endpoint_t *ep, const char *path, uint8_t value, uint8_t prio, uint8_t flags)
+{
+  test_clock++;
+  return coap_queue_send(ep, prio == COAP_QUEUE_PRIO_ACTUATOR ? COAP_PUT : COAP_POST, path,
+                         APPLICATION_JSON, &value, 1, prio, flags, RTIMER_NOW(), done, NULL);
+}
+
+static void
+reset_logs(void)
+{
+  sent_log[0] = done_log[0] = '\0';
+}
+
+int
+main(void)
+{
+  static const uint8_t big[150] = { 0 };
+  coap_endpoint_t server = { 1 }, furnace = { 2 }, alarm = { 3 };
+  const coap_queue_stats_t *s = coap_queue_stats();
+  int inflight_max = COAP_QUEUE_MAX_INFLIGHT;
+
+  // Le prime COAP_QUEUE_MAX_INFLIGHT partono subito, le altre attendono
+  send(&server, "res_data", 1, COAP_QUEUE_PRIO_TELEMETRY, 0);
+  send(&server, "res_prediction", 1, COAP_QUEUE_PRIO_TELEMETRY, 0);
+  send(&server, "res_data", 2, COAP_QUEUE_PRIO_TELEMETRY, 0);
+  send(&server, "res_prediction", 2, COAP_QUEUE_PRIO_TELEMETRY, 0);
+  check(s->inflight == inflight_max && n_flight == inflight_max, "richieste in volo oltre il limite");
+  check(strcmp(sent_log, "res_data res_prediction res_data ") == 0, "ordine di invio della telemetria");
+
+  // Un comando accodato dopo la telemetria parte prima; il secondo per la
+  // stessa risorsa sostituisce il primo mantenendo il posto
+  send(&furnace, "res_furnace", 1, COAP_QUEUE_PRIO_ACTUATOR, COAP_QUEUE_REPLACE);
+  send(&furnace, "res_furnace", 0, COAP_QUEUE_PRIO_ACTUATOR, COAP_QUEUE_REPLACE);
+  check(s->replaced == 1, "comando non sostituito");
+  send(&alarm, "res_alarm", 1, COAP_QUEUE_PRIO_ACTUATOR, COAP_QUEUE_REPLACE);
+  reset_logs();
+  finish(0, CHANGED_2_04);
+  check(strcmp(sent_log, "res_furnace ") == 0, "il comando non passa davanti alla telemetria");
+  check(request_of(n_flight - 1)->payload[0] == 0, "il comando inviato non e' l'ultimo stato");
+
+  // Coda piena (3 in volo, 3 in attesa): la telemetria nuova scarta la piu'
+  // vecchia in attesa, che finisce senza risposta
+  send(&server, "res_data", 3, COAP_QUEUE_PRIO_TELEMETRY, 0);
+  send(&server, "res_prediction", 3, COAP_QUEUE_PRIO_TELEMETRY, 0);
+  check(s->dropped == 1 && strstr(done_log, "res_prediction:-") != NULL,
+        "telemetria in attesa non scartata a coda piena");
+
+  // I comandi scartano la telemetria in attesa; con solo comandi in attesa
+  // la telemetria nuova e' rifiutata
+  send(&furnace, "res_furnace", 1, COAP_QUEUE_PRIO_ACTUATOR, 0);
+  send(&furnace, "res_furnace", 0, COAP_QUEUE_PRIO_ACTUATOR, 0);
+  check(s->dropped == 3, "comando rifiutato con telemetria in attesa");
+  check(send(&server, "res_data", 4, COAP_QUEUE_PRIO_TELEMETRY, 0) == 0 && s->dropped == 4,
+        "telemetria accodata al posto di un comando");
+
+  // Invio rifiutato dal motore: la coda riprova allo scadere del ctimer
+  reset_logs();
+  refuse = 1;
+  finish(0, CHANGED_2_04);
+  check(sent_log[0] == '\0' && s->inflight == inflight_max - 1, "invio rifiutato contato in volo");
+  check(ctimer_fire() && s->inflight == inflight_max, "nessun nuovo tentativo dopo il rifiuto");
+
+  // Timeout: done senza risposta, la coda si svuota
+  finish(0, 0);
+  check(s->timeouts == 1, "timeout non contato");
+  while(n_flight > 0) {
+    finish(0, CHANGED_2_04);
+  }
+  check(coap_queue_idle() && idle_in_done, "coda non vuota dentro l'ultimo done");
+  check(s->inflight == 0 && s->inflight_max == inflight_max, "contatori delle richieste in volo");
+  check(s->lat[COAP_QUEUE_PRIO_ACTUATOR].wait_max > 0, "attesa in coda dei comandi non misurata");
+  check(s->sent == s->ok + s->timeouts, "richieste inviate e chiuse non tornano");
+
+  // Block1: 150 byte a blocchi da 64, il chiamante accoda il successivo su 2.31
+  check(coap_queue_send_block(&server, COAP_POST, "res_bulk", APPLICATION_JSON, big, sizeof(big),
+                              2, 64, COAP_QUEUE_PRIO_TELEMETRY, 0, done, NULL), "blocco non accodato");
+  check(request_of(0)->block1 && request_of(0)->block_num == 2 && !request_of(0)->block_more &&
+        request_of(0)->len == 150 - 128, "ultimo blocco Block1");
+  check(!coap_queue_send_block(&server, COAP_POST, "res_bulk", APPLICATION_JSON, big, sizeof(big),
+                               3, 64, COAP_QUEUE_PRIO_TELEMETRY, 0, done, NULL), "blocco oltre la fine");
+  finish(0, CHANGED_2_04);
+
+  printf("Coda CoAP: inviate %u, ok %u, timeout %u, scartate %u, sostituite %u, "
+         "attesa max dei comandi %lu tick rtimer: %s\n",
+         s->sent, s->ok, s->timeouts, s->dropped, s->replaced,
+         (unsigned long)s->lat[COAP_QUEUE_PRIO_ACTUATOR].wait_max, errors ? "ERRORI" : "ok");
+  return errors != 0;
+}
@@ -0,0 +1,97 @@
+// === Invio a deadband e campionamento adattivo (node/report.c) ===
+// I quattro valori del roof (produzione, temperatura, umidita', produzione
+// prevista) con le deadband di roof/project-conf.h. Ogni campione arriva
+// dopo report_steps() passi da 15 s.
+#include <stdio.h>
+#include "report.h"
+
+#define STEP_SECONDS 15
+
+enum { SOLAR, TEMP, HUMID, NEXT_SOLAR };
+
+static const int32_t deadband[REPORT_MAX_VALUES] = { 100, 3, 15, 100 };
+static report_t report;
+static uint32_t total_steps;
+static int errors;
+
+static void
+check(int cond, const char *what)
+{
+  if(!cond) {
+    printf("ERRORE: %s\n", what);
+    errors++;
+  }
+}
+
+// Campione dopo il periodo corrente: ritorna 1 se va inviato
+static int
+sample(const int32_t *values)
+{
+  uint8_t steps = report_steps(&report);
+
+  test_clock += (clock_time_t)steps * STEP_SECONDS * CLOCK_SECOND;
+  total_steps += steps;
+  return report_sample(&report, values, steps);
+}
+
+int
+main(void)
+{
+  static const int32_t hour_deadband[2] = { 400, 0 };
+  int32_t v[REPORT_MAX_VALUES] = { 1200, 20, 60, 1250 };
+  int32_t power[2] = { 3000, 9 };
+  report_t hourly;
+  clock_time_t last_sent;
+  int sent, i;
+
+  // Un valore senza deadband (l'ora) non fa partire invii
+  report_init(&hourly, hour_deadband, 2);
+  check(report_sample(&hourly, power, 1), "primo campione non inviato");
+  power[1] = 10;
+  check(!report_sample(&hourly, power, 1), "invio per un valore senza deadband");
+
+  report_init(&report, deadband, REPORT_MAX_VALUES);
+  check(sample(v), "primo campione non inviato");
+
+  // Piccoli spostamenti non si inviano finche' la somma non supera la deadband
+  v[SOLAR] += 60;
+  check(!sample(v), "spostamento sotto la deadband inviato");
+  v[SOLAR] += 60;
+  check(sample(v), "deriva oltre la deadband dall'ultimo invio non inviata");
+
+  // Basta un valore qualsiasi, anche la sola previsione
+  v[NEXT_SOLAR] += 101;
+  check(sample(v), "previsione oltre la deadband non inviata");
+  v[HUMID] += 15;
+  check(!sample(v), "spostamento pari alla deadband inviato");
+
+  // Valori fermi: il periodo raddoppia fino a REPORT_MAX_STEPS passi, e dopo
+  // REPORT_MAX_SILENCE secondi parte comunque un heartbeat
+  last_sent = test_clock;
+  for(i = 0, sent = 0; i < 12; i++) {
+    if(sample(v)) {
+      check(test_clock - last_sent >= (clock_time_t)REPORT_MAX_SILENCE * CLOCK_SECOND,
+            "invio senza variazioni prima del silenzio massimo");
+      last_sent = test_clock;
+      sent++;
+    }
+  }
+  check(report_steps(&report) == REPORT_MAX_STEPS, "periodo non allungato a valori fermi");
+  check(sent >= 1 && test_clock - last_sent < (clock_time_t)REPORT_MAX_SILENCE * CLOCK_SECOND,
+        "heartbeat mancante");
+
+  // Un piccolo movimento si invia ma non basta alla media mobile; un salto
+  // di molte deadband riporta subito a un passo
+  v[TEMP] += 4;
+  check(sample(v) && report_steps(&report) == REPORT_MAX_STEPS,
+        "periodo accorciato da un solo movimento piccolo");
+  v[SOLAR] += 2000;
+  check(sample(v) && report_steps(&report) == 1, "periodo non accorciato a un salto");
+
+  // Giorni simulati: REPORT_DAY_STEPS passi, anche con il periodo lungo
+  check(report.days == total_steps / REPORT_DAY_STEPS, "giorni simulati contati male");
+  printf("Report: %lu campioni, %lu inviati, %lu giorni simulati, periodo %u passi: %s\n",
+         (unsigned long)report.samples, (unsigned long)report.sent, (unsigned long)report.days,
+         report_steps(&report), errors ? "ERRORI" : "ok");
+  return errors != 0;
+}
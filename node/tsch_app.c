@@ -0,0 +1,100 @@
+#include "tsch_app.h"
+
+#if TSCH_APP
+#include "orchestra.h"
+#include "net/packetbuf.h"
+#include "net/ipv6/uip-ds6.h"
+#include "net/ipv6/uiplib.h"
+#include "sys/log.h"
+
+#define LOG_MODULE "TschApp"
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+// Cella di trasmissione verso un pari applicativo
+typedef struct app_peer {
+  linkaddr_t addr;
+  struct tsch_link *link;
+} app_peer_t;
+
+static uint16_t slotframe_handle;
+static struct tsch_slotframe *sf_app;
+static app_peer_t peers[TSCH_APP_PEERS_MAX];
+
+static uint16_t
+cell_of(const linkaddr_t *addr)
+{
+  return ORCHESTRA_LINKADDR_HASH(addr) % TSCH_APP_PERIOD;
+}
+
+static void
+init(uint16_t sf_handle)
+{
+  slotframe_handle = sf_handle;
+  sf_app = tsch_schedule_add_slotframe(slotframe_handle, TSCH_APP_PERIOD);
+#if TSCH_APP_RX
+  // Cella di ricezione del nodo: telemetria o comandi dai suoi pari
+  tsch_schedule_add_link(sf_app, LINK_OPTION_RX, LINK_TYPE_NORMAL, &tsch_broadcast_address,
+                         cell_of(&linkaddr_node_addr), TSCH_APP_CHANNEL_OFFSET, 1);
+#endif
+}
+
+// Frame dati verso un pari con cella: slotframe applicativo, altrimenti le regole seguenti
+static int
+select_packet(uint16_t *slotframe, uint16_t *timeslot, uint16_t *channel_offset)
+{
+  const linkaddr_t *dest = packetbuf_addr(PACKETBUF_ADDR_RECEIVER);
+  uint8_t i;
+
+  if(packetbuf_attr(PACKETBUF_ATTR_FRAME_TYPE) != FRAME802154_DATAFRAME) {
+    return 0;
+  }
+  for(i = 0; i < TSCH_APP_PEERS_MAX; i++) {
+    if(peers[i].link != NULL && linkaddr_cmp(dest, &peers[i].addr)) {
+      if(slotframe != NULL) {
+        *slotframe = slotframe_handle;
+      }
+      if(timeslot != NULL) {
+        *timeslot = peers[i].link->timeslot;
+      }
+      if(channel_offset != NULL) {
+        *channel_offset = TSCH_APP_CHANNEL_OFFSET;
+      }
+      return 1;
+    }
+  }
+  return 0;
+}
+
+struct orchestra_rule tsch_app_rule = {
+  .init = init,
+  .select_packet = select_packet,
+  .name = "app cells",
+};
+
+void
+tsch_app_set_peer(uint8_t n, const uip_ipaddr_t *ip)
+{
+  char ipstr[UIPLIB_IPV6_MAX_STR_LEN];
+  uip_lladdr_t lladdr;
+  app_peer_t *p;
+
+  if(n >= TSCH_APP_PEERS_MAX || sf_app == NULL) {
+    return;
+  }
+  p = &peers[n];
+  // Indirizzo MAC dall'IID: vale per i nodi della rete, configurati con SLAAC
+  uip_ds6_set_lladdr_from_iid(&lladdr, ip);
+  if(p->link != NULL) {
+    if(linkaddr_cmp(&p->addr, (const linkaddr_t *)&lladdr)) {
+      return;
+    }
+    tsch_schedule_remove_link(sf_app, p->link);
+  }
+  linkaddr_copy(&p->addr, (const linkaddr_t *)&lladdr);
+  p->link = tsch_schedule_add_link(sf_app, LINK_OPTION_TX | LINK_OPTION_SHARED, LINK_TYPE_NORMAL,
+                                   &p->addr, cell_of(&p->addr), TSCH_APP_CHANNEL_OFFSET, 0);
+  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), ip);
+  LOG_INFO("Cella %u verso [%s]\n", cell_of(&p->addr), ipstr);
+}
+
+#endif /* TSCH_APP */
@@ -0,0 +1,60 @@
+/*
+ * Profilo TSCH con uno schedule Orchestra che conosce il traffico
+ * dell'applicazione (make TSCH=1 su tutti i nodi e sul border router).
+ *
+ * Slotframe, dal piu' prioritario:
+ *  - EB di Orchestra (eb_per_time_source), per la sincronizzazione;
+ *  - applicativo (tsch_app_rule), TSCH_APP_PERIOD slot: ogni nodo ascolta
+ *    in una sua cella (hash dell'indirizzo MAC) e trasmette nella cella del
+ *    destinatario i frame verso i pari applicativi trovati con la lookup
+ *    (sensori -> edge, edge -> furnace e alarm). Le celle sono condivise tra
+ *    i mittenti dello stesso destinatario, con il backoff di TSCH;
+ *  - comune di Orchestra (default_common), condiviso: register, lookup,
+ *    orario, RPL e tutto il resto del traffico.
+ *
+ * Le celle servono i pari a un salto: verso un pari lontano il frame va al
+ * genitore RPL e passa nello slotframe comune. Lo schedule e' descritto in
+ * node/tsch_app_conf.h, incluso dai project-conf.h dei nodi.
+ */
+#ifndef TSCH_APP_H_
+#define TSCH_APP_H_
+
+#include "contiki.h"
+#include "net/ipv6/uip.h"
+#include <stdint.h>
+
+#ifdef TSCH_APP_CONF_ENABLED
+#define TSCH_APP TSCH_APP_CONF_ENABLED
+#else
+#define TSCH_APP 0
+#endif
+
+/* Lunghezza dello slotframe applicativo: attesa massima per salto di
+ * TSCH_APP_PERIOD slot da 10 ms. Primo, per non allinearsi con gli altri */
+#ifdef TSCH_APP_CONF_PERIOD
+#define TSCH_APP_PERIOD TSCH_APP_CONF_PERIOD
+#else
+#define TSCH_APP_PERIOD 7
+#endif
+
+#ifdef TSCH_APP_CONF_CHANNEL_OFFSET
+#define TSCH_APP_CHANNEL_OFFSET TSCH_APP_CONF_CHANNEL_OFFSET
+#else
+#define TSCH_APP_CHANNEL_OFFSET 2
+#endif
+
+/* Cella di ricezione applicativa del nodo: 0 per i sensori a basso consumo,
+ * che ricevono solo ACK e risposte (nello slotframe comune) */
+#ifdef TSCH_APP_CONF_RX
+#define TSCH_APP_RX TSCH_APP_CONF_RX
+#else
+#define TSCH_APP_RX 1
+#endif
+
+#define TSCH_APP_PEERS_MAX 6
+
+/* Pari applicativo n (indice della destinazione di node_runtime) all'indirizzo
+ * ip: la cella di trasmissione segue il pari quando cambia */
+void tsch_app_set_peer(uint8_t n, const uip_ipaddr_t *ip);
+
+#endif /* TSCH_APP_H_ */
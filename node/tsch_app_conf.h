@@ -0,0 +1,37 @@
+/*
+ * Configurazione del profilo TSCH (node/tsch_app.h), inclusa dai
+ * project-conf.h dei nodi e del border router. Attiva solo con make TSCH=1,
+ * che sceglie il MAC TSCH e aggiunge il modulo Orchestra.
+ */
+#ifndef TSCH_APP_CONF_H_
+#define TSCH_APP_CONF_H_
+
+#if TSCH_APP_CONF_ENABLED
+
+/* Si parte subito, senza NETSTACK_MAC.on() nell'applicazione */
+#define TSCH_CONF_AUTOSTART 1
+
+/* Schedule tutto da Orchestra, che sceglie la cella di ogni frame */
+#define TSCH_SCHEDULE_CONF_WITH_6TISCH_MINIMAL 0
+#define TSCH_CONF_WITH_LINK_SELECTOR 1
+
+/* Slotframe EB e comune di Orchestra: periodi primi tra loro e con quello
+ * applicativo. Il comune porta register, lookup e RPL */
+#define ORCHESTRA_CONF_EBSF_PERIOD 397
+#define ORCHESTRA_CONF_COMMON_SHARED_PERIOD 31
+
+/* Il border router non ha pari applicativi e non include la regola */
+#ifndef ORCHESTRA_CONF_RULES
+#ifndef __ASSEMBLER__
+extern struct orchestra_rule tsch_app_rule;
+#endif
+#define ORCHESTRA_CONF_RULES { &eb_per_time_source, &tsch_app_rule, &default_common }
+#endif
+
+/* Code per vicino: i PUT dei sensori e i comandi attendono la cella */
+#define TSCH_CONF_MAX_INCOMING_PACKETS 4
+#define QUEUEBUF_CONF_NUM 8
+
+#endif /* TSCH_APP_CONF_ENABLED */
+
+#endif /* TSCH_APP_CONF_H_ */
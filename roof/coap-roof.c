@@ -1,30 +1,88 @@
 #include "contiki.h"
 #include "coap-engine.h"
-#include "coap-blocking-api.h"
-#include "net/netstack.h"
-#include "net/routing/routing.h"
 #include "sys/log.h"
 #include "sys/etimer.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include "os/dev/leds.h"
+#include "prediction_engine.h"
+#include "mlp_backend.h"
+#include "mlp_prof.h"
+// prediction_step(layer, ...): un layer per chiamata, come sull'edge (profilabile per layer)
+#if PREDICTION_FUSED
+// nextSolar viene calcolato dall'edge con il modello fuso
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_Q8
+#include "mlp_q8_memo.h"
+#include "model_store.h"
+#include "prediction_next_solar_q8.h"
+#if MLP_Q8_MEMO
+static mlp_q8_memo_t solar_memo; // ingresso, layer 0 e risultato della previsione precedente
+#define prediction_step(l, f, n, out, len) mlp_q8_memo_step(model_store_net(&prediction_next_solar_q8), &solar_memo, (l), (f), (n), (out), (len))
+#define MEMO_LOG_EVERY 20
+#else
+#define prediction_step(l, f, n, out, len) mlp_q8_step(model_store_net(&prediction_next_solar_q8), (l), (f), (n), (out), (len))
+#endif
+#if MODEL_STORE
+#define MODEL_PATH "model/next_solar"
+extern coap_resource_t res_model;
+#endif
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_GEN
+#include "prediction_next_solar_gen.h"
+#define prediction_step prediction_next_solar_gen_step
+#elif PREDICTION_ENGINE == PREDICTION_ENGINE_CSR
+#include "prediction_next_solar_csr.h"
+#define prediction_step(l, f, n, out, len) mlp_csr_step(&prediction_next_solar_csr, (l), (f), (n), (out), (len))
+#else
 #include "prediction_next_solar.h"
-#include "net/ipv6/uiplib.h"
+#include "eml_net_step.h"
+#define prediction_step(l, f, n, out, len) eml_net_step(&prediction_next_solar, (l), (f), (n), (out), (len))
+#endif
+#include "msg_codec.h"
+#include "node_runtime.h"
+#include "telemetry.h"
+#include "report.h"
 
 #define LOG_MODULE "RoofNode"
 #define LOG_LEVEL LOG_LEVEL_INFO
 
-#define SERVER_EP "coap://[fd00::1]"
-#define LOOKUP_PATH "lookup?res=/res_roof"
 #define FEATURE_COUNT 5
 
-static coap_endpoint_t server_ep, target_ep;
+// Passo della simulazione (un'ora simulata) e deadband dell'invio a variazione (node/report.h)
+#define SAMPLE_STEP (CLOCK_SECOND * 15)
+#ifdef ROOF_CONF_DEADBAND_SOLAR
+#define ROOF_DEADBAND_SOLAR ROOF_CONF_DEADBAND_SOLAR
+#else
+#define ROOF_DEADBAND_SOLAR 100
+#endif
+#ifdef ROOF_CONF_DEADBAND_TEMP
+#define ROOF_DEADBAND_TEMP ROOF_CONF_DEADBAND_TEMP
+#else
+#define ROOF_DEADBAND_TEMP 3
+#endif
+#ifdef ROOF_CONF_DEADBAND_HUMID
+#define ROOF_DEADBAND_HUMID ROOF_CONF_DEADBAND_HUMID
+#else
+#define ROOF_DEADBAND_HUMID 15
+#endif
+#ifdef ROOF_CONF_DEADBAND_NEXT_SOLAR
+#define ROOF_DEADBAND_NEXT_SOLAR ROOF_CONF_DEADBAND_NEXT_SOLAR
+#else
+#define ROOF_DEADBAND_NEXT_SOLAR ROOF_DEADBAND_SOLAR
+#endif
+
+static coap_endpoint_t target_ep; // nodo Edge, dalla lookup di /res_roof (node/node_runtime.h)
 static coap_message_t request[1];
-static struct etimer periodic_timer, wait_timer;
-static char target_ip[64] = "";  // ip nodo Edge sarà messo qui
+static struct etimer periodic_timer;
+// Content-Format verso l'edge: SenML-CBOR se la lookup lo annuncia e MSG_SENML e' attivo
+static unsigned int edge_format = APPLICATION_JSON;
+static node_runtime_peer_t edge_peer = { "/res_roof", &target_ep, &edge_format, 0 };
 static char json_buf[128];
-int attempts = 0;
+static uint16_t sample_seq = 0;      // numero di sequenza delle misure, per i buchi visti dall'edge
+#if MLP_PROF && !PREDICTION_FUSED
+static mlp_prof_t prof_solar; // tempi per layer, serviti su /res_prof
+extern coap_resource_t res_prof;
+#endif
 
 PROCESS(roof_node_process, "Roof Sensor Node");
 AUTOSTART_PROCESSES(&roof_node_process);
@@ -34,6 +92,7 @@ void response_handler(coap_message_t *response){
 
    if (response == NULL) {
     LOG_INFO("Timeout dal server\n");
+    telemetry_con_done(NULL);
     return;
   }
 
@@ -41,138 +100,124 @@ void response_handler(coap_message_t *response){
   uint8_t class = response->code >> 5;
   uint8_t detail = response->code & 0x1F;
   LOG_INFO("Codice risposta: %u.%02u\n", class, detail);
-}
+  telemetry_con_done(response);
 
-// Handler per gestire la risposta dal root server contenente IP del nodo con la risorsa richiesta
-void handle_lookup_response(coap_message_t *response) {
-  const uint8_t *chunk;
-  if (response == NULL) {
-    LOG_INFO("Timeout dal server\n");
-    return;
-  }
-
-  // Stampo codice risposta
-  LOG_INFO("Codice risposta: %u.%02u\n",
-           (response->code >> 5), response->code & 0x1F);
-
-  // Errore client o server
-  if (response->code >= 128) {
-    LOG_WARN("Errore dal server: codice %u\n", response->code);
-    return;
-  }
-  
-  int len = coap_get_payload(response, &chunk);
-  LOG_INFO("Risposta: %.*s\n", len, (char *)chunk);
-
-  if (strstr((char *)chunk, "fd00::") != NULL) {
-    sscanf((char *)chunk, "{\"ip\" : \"%[^\"]", target_ip); // Estrae l'IP dal JSON
-    LOG_INFO("Nodo target: [%s]\n", target_ip);
-  } else {
-    LOG_WARN("IP non trovato nella risposta\n");
+  // L'edge rifiuta il SenML-CBOR (4.xx/5.xx): dal prossimo invio JSON
+  if(edge_format == MSG_CT_SENML_CBOR && class >= 4) {
+    LOG_WARN("SenML-CBOR rifiutato, torno al JSON\n");
+    edge_format = APPLICATION_JSON;
   }
 }
 
+#if !PREDICTION_FUSED
 // Funzione per avviare la regressione del modello di previsione
 int predict_next_solar(int solar, int mese, int ora, int temperature, int humidity) {
   float solarkw = (float)solar / 1000; // Converti da W in kW
   // Il modello si aspetta valori Float
   float inputs[FEATURE_COUNT] = {solarkw, (float)mese, (float)ora, (float)temperature, (float)humidity};
-  float result = prediction_next_solar_regress1(inputs, FEATURE_COUNT);
+  float result = 0.0f;
+  uint8_t layer = 0;
+  int32_t more;
+
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 && MODEL_STORE
+  // Nuovo modello ricevuto su /model/next_solar: lo scambio avviene tra due previsioni
+  if(model_store_swap_pending() && model_store_activate() == MODEL_STORE_OK) {
+#if MLP_Q8_MEMO
+    mlp_q8_memo_invalidate(&solar_memo);
+#endif
+  }
+#endif
+  do {
+    MLP_PROF_START(&prof_solar);
+    more = prediction_step(layer, inputs, FEATURE_COUNT, &result, 1);
+    MLP_PROF_END(&prof_solar, layer, more);
+    layer++;
+  } while(more > 0);
+  if(more < 0) {
+    LOG_WARN("Modello non compatibile con %d ingressi\n", FEATURE_COUNT);
+    return 0;
+  }
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 && MLP_Q8_MEMO
+  if(solar_memo.stats.calls % MEMO_LOG_EVERY == 0) {
+    LOG_INFO("Memo MLP: %lu previsioni, hit %lu%% (%lu ingresso, %lu layer 0), %lu incrementali, %lu kMAC e %lu ms risparmiati\n",
+             (unsigned long)solar_memo.stats.calls, (unsigned long)mlp_q8_memo_hit_rate(&solar_memo.stats),
+             (unsigned long)solar_memo.stats.hits, (unsigned long)solar_memo.stats.l0_hits,
+             (unsigned long)solar_memo.stats.incremental, (unsigned long)(solar_memo.stats.macs_saved / 1000),
+             (unsigned long)mlp_q8_memo_ms_saved(&solar_memo.stats));
+  }
+#endif
   result = result * 100;
   return result > 0 ? (int)result : 0;
 }
+#endif
 
 PROCESS_THREAD(roof_node_process, ev, data)
 {
   static int solar = 0, temperature = 18, humidity = 60;
   static int mese = 5, ora = 16, oraPM = 4;
-
-  static uip_ipaddr_t dest_ipaddr;
-  char ipstr[64]; // temp per ip root e server
-  char endpoint[128]; // indirizzo server root
+  static uint8_t con;
+  static report_t report;
+  // ora e mese non contano: l'edge li fa avanzare da solo tra un invio e l'altro.
+  // La previsione invece conta: una svolta prevista va all'edge anche a valori misurati fermi
+  static const int32_t deadband[] = { ROOF_DEADBAND_SOLAR, ROOF_DEADBAND_TEMP, ROOF_DEADBAND_HUMID,
+                                      ROOF_DEADBAND_NEXT_SOLAR };
+  static int32_t values[4];
+  static int next_solar;
+  static uint8_t steps, i;
 
   PROCESS_BEGIN();
 
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_FLOAT && !PREDICTION_FUSED
   printf("%p\n", eml_net_activation_function_strs); // This is needed to avoid compiler error (warnings == errors)
   printf("%p\n", eml_error_str); // This is needed to avoid compiler error (warnings == errors)
+#endif
+
+#if (PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 || PREDICTION_ENGINE == PREDICTION_ENGINE_FLOAT) && !PREDICTION_FUSED
+  LOG_INFO("Backend MLP: %s\n", mlp_backend_name());
+#if MLP_SELFTEST
+  LOG_INFO("Selftest backend MLP: %d errori\n", mlp_backend_selftest());
+#endif
+#endif
 
   leds_single_on(LEDS_YELLOW);
 
-  // Ricerca nodo ROOT
-  etimer_set(&wait_timer, CLOCK_SECOND);
-  while(!NETSTACK_ROUTING.node_is_reachable() ||
-      !NETSTACK_ROUTING.get_root_ipaddr(&dest_ipaddr)) {
-  LOG_INFO("In attesa del root...\n");
-  leds_toggle(LEDS_RED);
-  PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&wait_timer));
-  etimer_reset(&wait_timer);
+#if MLP_PROF && !PREDICTION_FUSED
+  mlp_prof_register(&prof_solar, "next_solar");
+  coap_activate_resource(&res_prof, "res_prof");
+#endif
+
+  // === REGISTRAZIONE E LOOKUP (node/node_runtime.h) ===
+  // Root, registrazione, orario e lookup dell'edge in node_runtime_process: dopo un
+  // riavvio l'edge salvato su flash e' subito valido e la lookup lo riconvalida
+#if PREDICTION_ENGINE == PREDICTION_ENGINE_Q8 && !PREDICTION_FUSED && MODEL_STORE
+  // Modello aggiornabile via CoAP block-wise, slot A/B su CFS
+  model_store_init(FEATURE_COUNT, 1);
+  coap_activate_resource(&res_model, MODEL_PATH);
+  node_runtime_start("{\"id\":\"nodoRoof\", \"resources\":[\"/" MODEL_PATH "\"]}", &edge_peer, 1);
+#else
+  node_runtime_start("{\"id\":\"nodoRoof\", \"resources\":[\"\"]}", &edge_peer, 1);
+#endif
+  // Senza edge registrato la lookup lo ritenta a ogni rinnovo (ev_runtime_changed)
+  while(!node_runtime_ready() || edge_peer.state == NODE_RUNTIME_PEER_NONE) {
+    PROCESS_WAIT_EVENT();
   }
-  
-  leds_off(LEDS_RED);
-
-  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &dest_ipaddr);
-  snprintf(endpoint, sizeof(endpoint), "coap://[%s]:5683", ipstr);
-  LOG_INFO("Root trovato: %s\n", endpoint);
-
-  coap_endpoint_parse(SERVER_EP, strlen(SERVER_EP), &server_ep);
-
-  // === 1. REGISTRAZIONE ===
-  snprintf(json_buf, sizeof(json_buf),
-           "{\"id\":\"nodoRoof\", \"resources\":[\"\"]}");
-  
-  coap_init_message(request, COAP_TYPE_CON, COAP_POST, coap_get_mid());
-  coap_set_header_uri_path(request, "register");
-  coap_set_payload(request, (uint8_t *)json_buf, strlen(json_buf));
-
-  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &server_ep.ipaddr);
-  LOG_INFO("-> Invio a CoAP server IP: [%s], porta: %u\n", ipstr, uip_ntohs(server_ep.port));
-
-  COAP_BLOCKING_REQUEST(&server_ep, request, response_handler);
-
-  LOG_INFO("Registrazione completata\n");
-
+#if TELEMETRY_LOWPOWER
+  leds_off(LEDS_ALL); // basso consumo: LED spenti tra un campione e l'altro
+#else
   leds_on(LEDS_GREEN);
+#endif
 
-  // === 2. LOOKUP ===
-  attempts = 1;
-  memset(target_ip, 0, sizeof(target_ip));  // reset del buffer
-
-  while (strlen(target_ip) == 0) {
-    coap_init_message(request, COAP_TYPE_CON, COAP_GET, coap_get_mid());
-    coap_set_header_uri_path(request, "lookup");
-    coap_set_header_uri_query(request, "res=/res_roof");
-    LOG_INFO("Tentativo %d: richiesta IP nodo con /res_roof...\n", attempts);
-
-    COAP_BLOCKING_REQUEST(&server_ep, request, handle_lookup_response);
-
-    if (strlen(target_ip) == 0) {
-      clock_wait(CLOCK_SECOND / 2);  // attesa 500 ms prima di ritentare
-      attempts++;
-    }
-  }
-
-  if (strlen(target_ip) > 0) {
-    LOG_INFO("Lookup riuscito: %s\n", target_ip);
-  } else {
-    LOG_WARN("Lookup fallito\n");
-    PROCESS_EXIT();
-  }
-
-  // Inizializzo target_ep (edge)
-  char endpoint_uri[128];
-  snprintf(endpoint_uri, sizeof(endpoint_uri), "coap://[%s]", target_ip);
-  coap_endpoint_parse(endpoint_uri, strlen(endpoint_uri), &target_ep);
-
-  uiplib_ipaddr_snprint(ipstr, sizeof(ipstr), &target_ep.ipaddr);
-  LOG_INFO("-> Inizializzato target a NodoEdge IP: [%s], porta: %u\n", ipstr, uip_ntohs(target_ep.port));
-
-  // === 3. SEND PERIODICAMENTE DATI ===
-  etimer_set(&periodic_timer, CLOCK_SECOND * 15); // Genero dati ogni 15 secondi
+  // === SEND PERIODICAMENTE DATI ===
+  // Genero dati ogni 15 secondi, o ogni report_steps() passi quando i valori sono fermi (es. di notte)
+  report_init(&report, deadband, 4);
+  steps = report_steps(&report);
+  etimer_set(&periodic_timer, SAMPLE_STEP * steps);
 
   while (1) {
     PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&periodic_timer));
 
-      // Generazione dati da mandare in maniera simulata
+    // Generazione dati da mandare in maniera simulata, un'ora ogni 15 secondi trascorsi
+    for (i = 0; i < steps; i++) {
       ora++; if(ora > 23) {
           ora = 0;
         }
@@ -198,31 +243,69 @@ PROCESS_THREAD(roof_node_process, ev, data)
       humidity += (rand() % 21) - 10;
       if (humidity > 90) humidity = 90;
       if (humidity < 30) humidity = 30;
-      
-      
-      
-      // Chiamo la funzione di previsione
-      int next_solar = predict_next_solar(solar, mese, ora, temperature, humidity);
+    }
+
+      // Previsione a ogni campione: e' uno dei valori della deadband
+#if PREDICTION_FUSED
+      next_solar = 0; // previsto dall'edge con il modello fuso
+#else
+      next_solar = predict_next_solar(solar, mese, ora, temperature, humidity);
+#endif
+
+      // Invio solo oltre la deadband o allo scadere del silenzio massimo
+      values[0] = solar;
+      values[1] = temperature;
+      values[2] = humidity;
+      values[3] = next_solar;
+      if (!report_sample(&report, values, steps)) {
+        LOG_DBG("Solar %d, temp %d, umid %d, previsto %d entro la deadband, non inviato\n",
+                solar, temperature, humidity, next_solar);
+        steps = report_steps(&report);
+        etimer_reset_with_new_interval(&periodic_timer, SAMPLE_STEP * steps);
+        continue;
+      }
+
       //next_solar = next_solar*100;
       LOG_INFO("NextSolar previsto è: %d\n", next_solar);
 
-      // Preparo il JSON da inviare e invio messaggio al nodo Edge
-      snprintf(json_buf, sizeof(json_buf),
-               "{\"solar\": %d, \"mese\": %d, \"ora\": %d, \"temp\": %d, \"humid\": %d, \"nextSolar\": %d}",
-               solar, mese, oraPM, temperature, humidity, next_solar);
+      // Preparo il JSON da inviare (msg/messages.json) e invio messaggio al nodo Edge:
+      // CON, oppure NON con un heartbeat CON (node/telemetry.h)
+      con = telemetry_confirmable(sample_seq);
+      msg_roof_t m = { solar, mese, oraPM, temperature, humidity, next_solar,
+                       sample_seq++, node_runtime_epoch(), 0 };
+      int payload_len = edge_format == MSG_CT_SENML_CBOR ? msg_roof_encode_senml(&m, json_buf, sizeof(json_buf))
+                                                       : msg_roof_encode(&m, json_buf, sizeof(json_buf));
+      if(payload_len < 0) {
+        payload_len = 0;
+      }
 
-      coap_init_message(request, COAP_TYPE_CON, COAP_PUT, coap_get_mid());
+      coap_init_message(request, con ? COAP_TYPE_CON : COAP_TYPE_NON, COAP_PUT, coap_get_mid());
       coap_set_header_uri_path(request, "res_roof");
-      coap_set_payload(request, (uint8_t *)json_buf, strlen(json_buf));
-      LOG_INFO("Invio PUT a /res_roof su Edge: %s\n", json_buf);
+      coap_set_header_content_format(request, edge_format);
+      coap_set_payload(request, (uint8_t *)json_buf, payload_len);
+      if(edge_format == MSG_CT_SENML_CBOR) {
+        LOG_INFO("Invio PUT a /res_roof su Edge: SenML-CBOR, %d byte\n", payload_len);
+      } else {
+        LOG_INFO("Invio PUT a /res_roof su Edge: %s\n", json_buf);
+      }
 
       leds_off(LEDS_GREEN);
       leds_on(LEDS_BLUE); // LED BLUE acceso durante l'invio
-      COAP_BLOCKING_REQUEST(&target_ep, request, response_handler);
-      clock_wait(CLOCK_SECOND);
+      // CON senza bloccare il processo: la risposta arriva a response_handler
+      if(con && !telemetry_send_con(&target_ep, request, response_handler)) {
+        LOG_WARN("CON precedente ancora senza risposta, campione inviato NON\n");
+        con = 0;
+      }
+      if(!con && !telemetry_send_non(&target_ep, request)) {
+        LOG_WARN("Invio NON fallito\n");
+      }
       leds_off(LEDS_BLUE);  // Spegnimento LED dopo invio
+#if !TELEMETRY_LOWPOWER
       leds_on(LEDS_GREEN);
-    etimer_reset(&periodic_timer);
+#endif
+      telemetry_sample_end(con);
+    steps = report_steps(&report);
+    etimer_reset_with_new_interval(&periodic_timer, SAMPLE_STEP * steps);
   }
 
   PROCESS_END();
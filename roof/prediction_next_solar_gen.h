@@ -0,0 +1,286 @@
+/* Generato da tools/eml_codegen.py a partire da roof/prediction_next_solar.h */
+#include <stdint.h>
+#include <math.h>
+static const float prediction_next_solar_gen_layer_0_biases[48] = { -0.110244f, 0.055756f, -0.008991f, -0.049019f, -0.037053f, -0.099181f, -0.091229f, -0.182685f, -0.013450f, -0.013384f, -0.049736f, -0.043259f, -0.048001f, -0.054790f, -0.026402f, 0.065253f, -0.100832f, 0.108689f, -0.061630f, 0.073065f, 0.062779f, 0.072204f, -0.118517f, -0.036899f, 0.104378f, 0.095867f, 0.058710f, -0.031282f, -0.041363f, 0.023232f, -0.046401f, -0.119210f, -0.065736f, -0.087607f, -0.057653f, -0.092553f, 0.027102f, 0.020805f, 0.011455f, 0.104275f, 0.041639f, 0.028842f, 0.045131f, -0.118696f, -0.006059f, -0.029363f, -0.013475f, 0.018713f };
+static const float prediction_next_solar_gen_layer_0_weights[240] = { -0.009436f, 0.300643f, 0.348032f, 0.057338f, -0.215075f, 0.242707f, 0.245166f, -0.444913f, -0.379393f, -0.297502f, 0.146469f, 0.200961f, 0.461177f, -0.083264f, -0.225855f, -0.356243f, 0.029775f, 0.198303f, 0.243103f, 0.029984f, 0.078396f, -0.253778f, 0.218959f, 0.010876f, -0.334929f, -0.158376f, -0.025441f, 0.337156f, -0.083952f, 0.124517f, -0.023305f, -0.069113f, -0.048972f, -0.194385f, -0.181380f, -0.451828f, 0.017217f, 0.123625f, -0.014123f, 0.014169f, -0.448587f, 0.049263f, -0.454682f, 0.058045f, -0.180462f, -0.087884f, -0.083952f, 0.372943f, 0.138675f, 0.265009f, -0.180933f, 0.031027f, 0.341227f, -0.324412f, 0.160158f, -0.072301f, -0.294069f, -0.362705f, 0.038006f, -0.186453f, -0.177707f, -0.119361f, -0.596897f, 0.118486f, -0.018452f, 0.152908f, 0.094429f, 0.255363f, -0.001127f, 0.088028f, 0.050201f, -0.159531f, -0.429150f, -0.098976f, -0.095455f, -0.145966f, 0.190176f, -0.818681f, 0.135006f, 0.103348f, -0.407038f, 0.202529f, -0.151665f, -0.206775f, 0.055353f, 0.363580f, 0.114349f, -0.316293f, -0.254801f, 0.092043f, -0.146704f, -0.081082f, 0.203376f, -0.030968f, -0.287613f, 0.323889f, -0.268395f, -0.382508f, 0.095642f, 0.057674f, 0.236984f, -0.047684f, -0.165312f, 0.000350f, -0.220100f, 0.161441f, 0.159203f, -0.329269f, -0.155334f, 0.259142f, -0.126579f, 0.288867f, 0.272927f, -0.054902f, -0.198225f, -0.034616f, 0.054689f, 0.288443f, 0.222134f, -0.035890f, 0.050777f, -0.013273f, -0.262216f, -0.098480f, 0.058690f, 0.158410f, 0.036871f, -0.111777f, 0.304029f, -0.235224f, 0.157793f, -0.037009f, -0.216401f, 0.219701f, 0.197144f, -0.061876f, -0.274200f, -0.036088f, -0.054139f, 0.084581f, -0.279388f, 0.060773f, 0.144973f, -0.088505f, -0.066808f, 0.311159f, 0.127512f, -0.111615f, 0.251158f, 0.206566f, -0.297438f, 0.123980f, -0.235638f, -0.073057f, -0.112042f, -0.367116f, -0.047374f, -0.436582f, -0.192229f, -0.252502f, -0.080903f, -0.309887f, 0.104596f, 0.275236f, 0.061845f, -0.256923f, -0.018423f, 0.162167f, -0.156549f, -0.236619f, -0.249171f, -0.141149f, 0.331003f, 0.102606f, 0.290314f, 0.052298f, 0.047138f, 0.030095f, 0.253537f, 0.063861f, 0.080603f, -0.111751f, -0.216279f, 0.073093f, 0.228348f, -0.080091f, 0.236133f, -0.316463f, 0.096287f, -0.129213f, 0.208731f, 0.035469f, -0.284998f, 0.195849f, -0.007453f, -0.068494f, -0.112063f, -0.068084f, 0.353642f, -0.118517f, 0.206514f, -0.046205f, -0.044219f, 0.174289f, -0.035307f, 0.287356f, 0.151291f, 0.366165f, 0.069438f, -0.040552f, 0.083421f, 0.015231f, -0.005125f, -0.136548f, -0.000215f, 0.179685f, 0.155985f, 0.302915f, -0.193950f, -0.036441f, 0.230176f, 0.072312f, -0.352282f, 0.271271f, -0.323472f, 0.271282f, -0.039172f, 0.283503f, 0.046857f, 0.211499f, -0.081884f, -0.017987f, 0.391381f, -0.055446f, -0.017947f, -0.101784f, -0.003851f, -0.944702f, 0.021132f, 0.012668f };
+static const float prediction_next_solar_gen_layer_1_biases[80] = { 0.072572f, 0.046952f, -0.059055f, 0.104916f, -0.083345f, 0.000259f, 0.025036f, -0.053588f, 0.081800f, -0.031407f, -0.052533f, -0.097580f, 0.080175f, 0.037009f, -0.108742f, 0.087371f, -0.029938f, 0.037588f, 0.077469f, -0.021911f, 0.015093f, 0.120190f, 0.005668f, 0.100689f, -0.134711f, 0.087829f, 0.024860f, 0.126986f, -0.059734f, -0.046132f, 0.124308f, -0.027684f, -0.102780f, -0.049206f, -0.096913f, -0.068399f, -0.066256f, -0.098816f, -0.147093f, -0.002101f, 0.015644f, 0.107394f, -0.046091f, 0.037738f, 0.078338f, -0.018331f, -0.154834f, 0.102657f, -0.066748f, 0.079221f, 0.070732f, -0.049063f, -0.145819f, 0.075217f, 0.105198f, -0.065460f, 0.094182f, -0.045798f, -0.066922f, 0.010895f, -0.072544f, 0.064216f, 0.100249f, 0.077112f, 0.093329f, -0.056737f, 0.083585f, -0.077584f, 0.075206f, -0.007011f, 0.104788f, 0.172791f, 0.072293f, 0.035912f, 0.129426f, -0.008975f, -0.206051f, -0.029082f, 0.051632f, 0.073283f };
+static const float prediction_next_solar_gen_layer_1_weights[3840] = { 0.094454f, -0.231665f, -0.029354f, 0.071765f, -0.007124f, -0.158149f, 0.210501f, 0.136626f, 0.135558f, -0.320619f, 0.140674f, 0.180192f, 0.125327f, -0.139396f, -0.104843f, 0.039107f, 0.306084f, -0.113702f, 0.140772f, 0.268332f, 0.065324f, -0.179657f, -0.178144f, -0.189869f, 0.010570f, 0.149189f, 0.134392f, -0.129845f, 0.087172f, -0.112355f, 0.060246f, -0.039043f, 0.136678f, 0.127374f, 0.061171f, -0.146739f, -0.166961f, 0.049045f, -0.161120f, -0.176442f, -0.005068f, 0.064994f, 0.111545f, -0.243986f, 0.154729f, 0.016868f, 0.169498f, 0.209542f, 0.116342f, 0.030016f, 0.128895f, -0.202348f, -0.263755f, -0.097744f, 0.001655f, 0.050155f, 0.299121f, -0.283223f, -0.106352f, -0.297928f, 0.138696f, -0.236947f, 0.164877f, -0.014936f, 0.175660f, -0.065665f, 0.123954f, -0.018694f, -0.060614f, 0.354175f, 0.133268f, -0.170762f, 0.263800f, 0.070797f, -0.104482f, -0.131226f, 0.302890f, -0.376798f, 0.136921f, -0.103415f, -0.095172f, 0.207882f, -0.010760f, -0.380486f, -0.455089f, -0.111352f, 0.105920f, 0.055069f, -0.195237f, -0.247435f, -0.005529f, -0.103611f, -0.083850f, -0.476251f, -0.193341f, 0.052151f, -0.186728f, -0.163105f, 0.194482f, 0.192565f, -0.118488f, 0.184941f, 0.111904f, -0.074229f, -0.267764f, 0.093887f, 0.016221f, -0.151085f, -0.251877f, 0.093552f, -0.184517f, -0.099108f, 0.029446f, 0.057250f, -0.097652f, -0.096476f, 0.029968f, 0.173809f, -0.098226f, -0.185058f, 0.018948f, -0.149465f, 0.069153f, -0.112600f, -0.159021f, -0.094549f, -0.193147f, 0.165672f, -0.130757f, 0.042472f, 0.065778f, 0.083036f, 0.171465f, -0.099914f, -0.005791f, -0.344139f, -0.107462f, 0.066159f, -0.117808f, 0.097692f, -0.078354f, 0.119675f, 0.034853f, -0.008951f, 0.015153f, -0.005114f, -0.001192f, -0.298172f, 0.143919f, 0.170829f, -0.098074f, -0.453079f, -0.280749f, -0.126755f, 0.049191f, 0.197889f, -0.171226f, -0.065212f, -0.003064f, -0.087379f, 0.336594f, 0.241807f, -0.169679f, 0.153782f, -0.039450f, 0.100723f, -0.256071f, -0.067995f, 0.133386f, -0.042819f, 0.242099f, 0.017696f, 0.147420f, -0.160882f, -0.035517f, -0.111643f, 0.008112f, 0.030643f, -0.104101f, -0.168283f, -0.119047f, -0.057184f, 0.142832f, 0.036736f, -0.150316f, -0.180788f, 0.188196f, 0.064785f, 0.043860f, 0.031254f, -0.190778f, -0.535195f, -0.123427f, -0.244515f, -0.064254f, 0.126227f, -0.245219f, 0.062250f, -0.218289f, 0.680454f, 0.198771f, -0.144500f, 0.277795f, -0.201118f, 0.178094f, 0.117291f, -0.113626f, -0.152188f, 0.209148f, -0.159187f, -0.013120f, -0.093931f, -0.152540f, 0.209416f, -0.050124f, 0.212408f, 0.005827f, 0.052759f, -0.223325f, 0.024005f, 0.180708f, 0.151456f, 0.041005f, 0.225779f, -0.247175f, -0.143065f, 0.084187f, 0.167464f, -0.024058f, 0.081391f, -0.071089f, 0.026702f, -0.081295f, -0.156433f, -0.021489f, -0.192704f, -0.145317f, -0.113011f, -0.059258f, -0.005498f, -0.180072f, 0.128101f, 0.123495f, -0.088713f, 0.002858f, 0.015727f, -0.003595f, 0.067392f, -0.244158f, 0.034680f, -0.205853f, -0.032975f, -0.097492f, 0.166955f, -0.146370f, 0.036615f, -0.108902f, 0.053637f, 0.015656f, -0.177063f, 0.093495f, -0.035693f, -0.000045f, -0.052305f, 0.025847f, -0.093882f, -0.128129f, 0.117724f, 0.096110f, -0.030073f, -0.087544f, -0.048386f, 0.120912f, -0.171712f, 0.011473f, -0.114094f, -0.090215f, 0.184697f, 0.144055f, 0.148141f, 0.180681f, 0.155123f, 0.136149f, 0.035338f, 0.065464f, 0.088211f, 0.094102f, 0.055657f, -0.143092f, 0.064924f, 0.003004f, -0.148960f, 0.250563f, 0.017032f, 0.160985f, -0.216636f, -0.086346f, 0.084049f, 0.019232f, 0.210785f, 0.211334f, 0.182544f, 0.254486f, -0.172288f, -0.258811f, 0.001726f, -0.153499f, 0.076335f, -0.096199f, 0.126532f, -0.440060f, -0.252909f, -0.197458f, -0.146050f, 0.053746f, 0.162459f, 0.152963f, -0.001230f, -0.327691f, 0.011417f, -0.224533f, 0.103827f, 0.007915f, -0.290121f, 0.106729f, -0.353411f, -0.169622f, -0.014623f, -0.069166f, -0.192810f, 0.130910f, 0.242004f, 0.273411f, -0.051326f, -0.144847f, 0.112055f, -0.198299f, 0.102812f, -0.084558f, 0.016628f, -0.057986f, 0.129192f, -0.003716f, -0.031632f, -0.180402f, -0.130510f, -0.184944f, 0.155706f, -0.008949f, -0.117791f, -0.021034f, 0.112028f, -0.204917f, -0.225275f, -0.103930f, -0.128231f, 0.209762f, -0.051776f, -0.113300f, -0.069398f, -0.039583f, -0.213675f, 0.056517f, -0.104986f, -0.144178f, -0.031971f, -0.025944f, -0.011242f, -0.260675f, -0.129513f, 0.154186f, -0.029981f, -0.136398f, -0.006142f, 0.114891f, -0.057481f, -0.133579f, -0.102902f, -0.078327f, -0.202420f, -0.042527f, -0.040213f, -0.185204f, -0.162223f, 0.191218f, -0.034908f, 0.151219f, -0.294433f, -0.120498f, 0.148099f, -0.021139f, -0.237993f, -0.079962f, -0.039908f, 0.149070f, 0.083498f, 0.046980f, -0.076777f, 0.284189f, 0.183085f, -0.120555f, 0.000869f, -0.127467f, 0.189121f, 0.144929f, 0.007137f, -0.225091f, -0.209219f, -0.050464f, 0.137067f, -0.039564f, 0.087030f, 0.078556f, 0.051966f, 0.233300f, -0.200391f, -0.111004f, 0.125572f, -0.104173f, 0.006672f, -0.218834f, 0.065590f, 0.137147f, 0.011790f, -0.142621f, 0.033069f, -0.085785f, 0.146400f, 0.194872f, -0.032706f, -0.068427f, -0.179098f, -0.070549f, -0.033546f, 0.126901f, 0.002885f, 0.104179f, -0.105840f, -0.227085f, -0.158234f, -0.018969f, 0.047044f, 0.091240f, 0.102110f, -0.188695f, 0.012540f, 0.092240f, 0.164748f, -0.191194f, -0.225995f, 0.040355f, -0.236153f, -0.147082f, 0.053307f, -0.212491f, 0.119303f, -0.086114f, -0.032505f, -0.190911f, -0.226136f, 0.072647f, -0.080599f, 0.001731f, 0.120778f, -0.049178f, -0.109372f, -0.205927f, 0.047990f, -0.177018f, -0.256075f, 0.109636f, -0.166228f, 0.003051f, -0.074348f, 0.039883f, -0.028112f, -0.156504f, -0.154136f, -0.002898f, -0.194720f, -0.278842f, 0.139983f, -0.139812f, -0.029299f, 0.270280f, 0.025815f, 0.075251f, 0.436782f, 0.246972f, 0.061491f, 0.166273f, -0.183960f, 0.122377f, -0.024120f, -0.016526f, 0.211838f, 0.089003f, -0.141374f, 0.081768f, 0.058239f, 0.087571f, 0.000912f, -0.056741f, 0.040373f, -0.219726f, -0.226581f, -0.040472f, 0.065010f, -0.029131f, -0.175790f, -0.214958f, -0.126112f, 0.231148f, 0.018406f, 0.292399f, -0.051455f, 0.133833f, 0.188528f, -0.497677f, -0.121560f, 0.099370f, 0.006989f, 0.104488f, -0.010133f, -0.275975f, 0.021078f, -0.004092f, 0.026504f, 0.017210f, 0.086391f, -0.325794f, -0.076170f, 0.005336f, 0.018992f, -0.000762f, 0.503609f, 0.116483f, 0.018532f, -0.112270f, 0.043383f, 0.300385f, 0.132910f, 0.118053f, 0.301623f, 0.224098f, -0.051274f, 0.019357f, 0.261226f, -0.068918f, 0.246897f, -0.066388f, 0.035359f, 0.147961f, 0.155843f, -0.098879f, 0.007147f, 0.198939f, -0.038812f, 0.070103f, -0.008710f, -0.189033f, -0.135874f, 0.049343f, 0.091146f, 0.262849f, -0.120000f, 0.111111f, -0.173699f, -0.083567f, -0.172230f, -0.078963f, -0.263801f, 0.117139f, -0.226194f, -0.212655f, 0.099626f, -0.037719f, 0.079435f, -0.062603f, 0.120260f, -0.025463f, -0.003587f, -0.134588f, -0.051317f, -0.112576f, 0.011010f, -0.124152f, 0.046767f, 0.123468f, -0.080461f, 0.051630f, 0.153704f, 0.027928f, -0.060749f, 0.164515f, 0.132588f, 0.109101f, -0.132855f, -0.076992f, -0.026935f, -0.041409f, 0.019741f, -0.024038f, -0.029280f, -0.073648f, 0.073563f, -0.263982f, -0.152260f, -0.346575f, -0.223876f, -0.093608f, -0.043983f, 0.142209f, -0.220822f, 0.023486f, 0.070030f, -0.002670f, -0.109004f, -0.043270f, 0.084046f, 0.136770f, -0.157939f, -0.332267f, 0.192654f, 0.127234f, 0.109861f, 0.113983f, -0.051887f, 0.083582f, 0.151308f, 0.034536f, -0.349236f, 0.045262f, -0.179787f, 0.014730f, -0.052486f, 0.072975f, -0.196886f, 0.183709f, 0.100476f, -0.029298f, 0.051519f, 0.000709f, -0.076276f, 0.117159f, 0.005934f, 0.039849f, -0.009986f, -0.009311f, -0.005449f, -0.048165f, 0.041837f, -0.012277f, 0.134576f, 0.003047f, -0.195364f, -0.159369f, -0.211115f, 0.140009f, -0.181956f, -0.172622f, -0.050767f, -0.070539f, 0.140043f, 0.081168f, -0.089259f, -0.242624f, 0.125628f, 0.002004f, 0.090049f, -0.250880f, -0.286243f, 0.185655f, 0.007274f, -0.075454f, 0.147490f, -0.179164f, -0.101166f, 0.033593f, 0.650441f, 0.336818f, 0.050077f, 0.116071f, 0.030691f, 0.014879f, -0.383763f, 0.162663f, -0.004341f, 0.051329f, -0.069093f, -0.036787f, -0.312097f, -0.271057f, -0.034674f, 0.102694f, 0.194762f, 0.061877f, -0.124692f, -0.049588f, 0.168010f, -0.003556f, -0.230485f, 0.214332f, 0.336781f, -0.046461f, -0.116259f, 0.148888f, 0.268671f, 0.171721f, -0.035218f, -0.012558f, -0.096432f, -0.086623f, -0.111453f, -0.226228f, 0.039434f, -0.119034f, 0.070805f, -0.090505f, 0.124540f, -0.197325f, 0.128189f, -0.137115f, 0.131822f, -0.015798f, -0.053479f, 0.128047f, -0.230399f, -0.014836f, -0.176558f, -0.037000f, 0.160939f, -0.217715f, -0.012340f, 0.048353f, 0.132411f, -0.126792f, 0.112878f, -0.166386f, 0.146752f, 0.071140f, -0.002441f, -0.101030f, -0.179757f, 0.229103f, -0.103108f, 0.173303f, 0.149286f, -0.092602f, 0.116138f, -0.058385f, -0.176876f, -0.096371f, 0.036636f, 0.019571f, 0.058156f, -0.001703f, 0.246184f, 0.176316f, 0.130900f, 0.133882f, 0.205078f, 0.045981f, 0.072465f, 0.202792f, -0.205443f, -0.230176f, -0.036292f, -0.131084f, 0.073587f, -0.212586f, -0.197033f, -0.165532f, -0.059975f, -0.238279f, 0.097118f, 0.089157f, -0.023489f, -0.208542f, 0.122671f, 0.225503f, -0.177125f, -0.183458f, 0.144770f, 0.138590f, 0.039060f, 0.020459f, 0.073217f, -0.041770f, 0.274299f, 0.056449f, 0.054909f, 0.124635f, -0.157061f, -0.009542f, 0.136741f, 0.035384f, 0.101050f, 0.085627f, 0.033306f, 0.069347f, -0.217951f, -0.226179f, -0.267440f, 0.083665f, 0.283977f, 0.023723f, 0.102364f, 0.031186f, -0.353594f, -0.066725f, -0.307494f, 0.007352f, -0.116466f, -0.134318f, 0.356579f, -0.138274f, 0.171478f, 0.035594f, 0.090721f, 0.105508f, 0.192966f, 0.097717f, -0.195837f, -0.008588f, 0.020059f, 0.047805f, -0.017295f, -0.061011f, -0.047590f, 0.220298f, -0.010042f, -0.107743f, -0.090759f, -0.015579f, 0.024323f, -0.024225f, 0.089010f, -0.151506f, 0.035716f, 0.192322f, 0.176746f, 0.106475f, 0.162547f, -0.028369f, 0.153548f, -0.153365f, 0.032895f, -0.132656f, -0.212399f, -0.169510f, 0.097140f, -0.092058f, -0.038237f, 0.041257f, -0.090539f, 0.202102f, 0.010492f, -0.157444f, 0.105653f, -0.158849f, -0.031811f, -0.013381f, -0.216100f, -0.206008f, 0.168788f, -0.283610f, 0.060936f, -0.113762f, -0.264491f, -0.129879f, -0.154618f, -0.074027f, 0.012688f, 0.081737f, -0.078632f, -0.043643f, -0.154287f, 0.105774f, -0.066234f, -0.043144f, 0.214170f, 0.066432f, -0.086698f, 0.088663f, 0.044180f, 0.109124f, -0.256564f, -0.141857f, -0.143633f, 0.171481f, 0.050220f, -0.126697f, -0.095800f, 0.138539f, 0.190935f, -0.125476f, 0.141493f, 0.041793f, 0.098782f, -0.015712f, -0.090335f, 0.021462f, 0.013147f, 0.185546f, 0.064339f, -0.038656f, 0.022889f, 0.149415f, -0.092115f, -0.407452f, -0.190550f, 0.151801f, 0.059182f, -0.031695f, 0.194234f, -0.138357f, -0.097372f, 0.121901f, -0.115718f, -0.146382f, -0.099468f, 0.087538f, 0.087107f, -0.084010f, -0.093772f, -0.024728f, -0.016096f, -0.220170f, 0.091185f, -0.048129f, -0.123114f, 0.085411f, 0.031942f, 0.014535f, 0.141267f, -0.026933f, -0.065595f, -0.107033f, -0.069219f, -0.263027f, 0.000275f, 0.059220f, -0.023571f, 0.014354f, -0.062200f, -0.148389f, 0.165108f, 0.078038f, 0.177437f, -0.085831f, -0.064001f, -0.118495f, -0.257122f, 0.006873f, -0.011731f, 0.197434f, -0.000482f, -0.132204f, -0.162321f, -0.019800f, -0.130624f, 0.170203f, -0.077306f, -0.290886f, -0.304356f, -0.213193f, 0.327009f, 0.005259f, -0.133259f, 0.029510f, 0.049968f, 0.143821f, -0.215432f, -0.079826f, 0.096120f, -0.032439f, 0.065145f, -0.145050f, 0.186804f, -0.200567f, 0.074635f, 0.038361f, -0.076438f, 0.324612f, 0.215762f, 0.228294f, 0.133705f, 0.003461f, -0.179862f, 0.250619f, -0.177570f, -0.114325f, -0.416021f, -0.139749f, -0.001871f, 0.307501f, 0.246444f, -0.108203f, -0.082072f, 0.053757f, 0.055361f, -0.036426f, -0.432927f, 0.003869f, -0.288913f, 0.034235f, 0.529966f, -0.222290f, -0.139184f, 0.089557f, 0.005881f, -0.206032f, 0.101845f, -0.121536f, -0.290677f, -0.132215f, -0.060730f, -0.240819f, 0.091560f, -0.197201f, 0.116514f, -0.035197f, -0.066797f, 0.101166f, -0.117175f, 0.057587f, 0.182015f, 0.188607f, -0.223871f, -0.179071f, -0.040013f, 0.322277f, 0.008491f, 0.040580f, -0.193016f, -0.163152f, -0.167008f, 0.227032f, 0.269963f, 0.093822f, -0.198426f, -0.130356f, 0.224678f, 0.209143f, 0.017036f, -0.136246f, 0.146837f, 0.186506f, -0.018241f, 0.047142f, 0.051679f, 0.054719f, 0.187711f, -0.033939f, 0.334284f, -0.026487f, -0.230026f, 0.007056f, -0.408639f, 0.100768f, 0.007463f, 0.110371f, -0.132705f, -0.386932f, 0.067996f, -0.024139f, 0.111405f, 0.025767f, 0.085751f, 0.098558f, 0.129910f, 0.115293f, 0.037964f, -0.056900f, 0.039222f, 0.103723f, 0.156259f, 0.116503f, -0.249987f, 0.008179f, -0.050340f, -0.181991f, -0.244239f, 0.196886f, -0.036056f, -0.147303f, 0.041863f, 0.254342f, -0.123057f, -0.156692f, -0.001217f, -0.109987f, 0.077970f, 0.031160f, -0.131118f, 0.034917f, 0.165864f, 0.067661f, 0.098097f, 0.139309f, 0.075178f, 0.144539f, -0.053454f, 0.031049f, -0.002196f, -0.113636f, 0.058814f, -0.133486f, -0.269950f, 0.179979f, -0.102915f, -0.101329f, -0.102151f, 0.163716f, -0.237229f, -0.061452f, -0.183176f, 0.075709f, 0.236145f, 0.104943f, 0.082669f, -0.212422f, 0.226871f, -0.100700f, 0.050918f, -0.090439f, -0.138399f, 0.146763f, -0.136933f, -0.225435f, 0.058028f, -0.043604f, 0.000380f, 0.036700f, -0.306997f, -0.166873f, 0.187856f, -0.002524f, -0.050613f, 0.195461f, 0.257010f, -0.050651f, 0.031623f, 0.104832f, 0.083601f, -0.185277f, -0.074305f, -0.002610f, -0.205261f, -0.330205f, -0.127229f, 0.254133f, 0.011869f, 0.059863f, -0.258867f, -0.041829f, 0.225771f, -0.183584f, 0.173551f, -0.097811f, 0.143391f, 0.120219f, 0.216363f, 0.277836f, 0.071907f, 0.010198f, -0.064808f, 0.242498f, 0.074384f, -0.030262f, -0.163626f, 0.191083f, 0.156855f, 0.146223f, 0.147621f, -0.052971f, 0.012921f, 0.008863f, 0.128526f, 0.061306f, 0.025778f, 0.015939f, 0.201351f, 0.044460f, 0.211207f, 0.042756f, -0.211342f, 0.065497f, 0.015139f, 0.024005f, -0.020144f, -0.110145f, 0.101231f, 0.063216f, -0.171483f, 0.175461f, -0.105927f, -0.049810f, 0.029006f, -0.149369f, 0.220038f, -0.050725f, 0.069766f, 0.186579f, 0.107027f, -0.165302f, -0.443645f, -0.095451f, -0.232946f, -0.035625f, 0.029894f, -0.285487f, 0.032745f, 0.060450f, 0.216004f, -0.109168f, 0.145078f, 0.015408f, 0.117679f, 0.207012f, 0.274577f, -0.093682f, 0.049357f, 0.124366f, 0.024975f, -0.116154f, -0.129473f, -0.140100f, 0.223242f, 0.366826f, 0.108334f, -0.046711f, 0.071427f, -0.375619f, -0.123904f, -0.047331f, 0.010120f, 0.132812f, 0.050825f, 0.019828f, -0.104209f, -0.125916f, -0.115603f, 0.013748f, -0.214253f, -0.311379f, -0.496349f, -0.212958f, -0.184253f, -0.108206f, -0.251010f, -0.333426f, 0.061701f, -0.025901f, -0.247880f, -0.526733f, -0.021114f, 0.066797f, -0.057858f, -0.362468f, -0.095535f, 0.257526f, 0.159493f, 0.164479f, 0.131727f, 0.037793f, -0.176347f, -0.075172f, 0.158517f, -0.197070f, -0.394942f, 0.160152f, -0.007635f, 0.130671f, -0.088469f, -0.101604f, 0.054034f, 0.218855f, -0.623571f, 0.162962f, -0.008725f, 0.196778f, -0.251387f, 0.147940f, 0.314014f, -0.132497f, -0.087572f, -0.267723f, 0.003190f, 0.173435f, -0.170699f, -0.196038f, 0.080381f, -0.037513f, -0.032334f, -0.042574f, -0.092912f, -0.156027f, -0.245502f, 0.164699f, -0.192612f, -0.078695f, -0.446423f, -0.013788f, -0.062315f, 0.238724f, -0.111844f, 0.010219f, 0.125273f, 0.294999f, -0.015173f, -0.233126f, -0.009511f, -0.126411f, 0.168294f, 0.074052f, -0.112891f, -0.144329f, 0.173706f, 0.097883f, 0.094323f, 0.096513f, -0.013852f, -0.117778f, 0.123355f, -0.225912f, -0.084254f, -0.043616f, -0.039353f, -0.228072f, 0.192239f, 0.100259f, -0.051664f, -0.149433f, -0.094984f, -0.056009f, -0.065141f, 0.236129f, 0.015888f, 0.052600f, -0.169997f, 0.122473f, 0.021646f, -0.003927f, -0.189121f, 0.049436f, 0.200417f, 0.254932f, 0.213564f, -0.095071f, 0.230192f, 0.134029f, 0.181390f, 0.231399f, -0.232026f, -0.072024f, -0.076541f, -0.250774f, -0.165199f, 0.139564f, -0.201231f, 0.013811f, -0.038148f, 0.201508f, 0.043280f, 0.092824f, -0.126398f, -0.170075f, 0.076701f, 0.016659f, 0.008935f, 0.253423f, 0.016906f, 0.073912f, -0.033370f, 0.224358f, -0.130599f, 0.199842f, -0.076808f, 0.092793f, 0.165260f, -0.087903f, 0.023263f, -0.190635f, -0.042634f, 0.192446f, -0.126786f, -0.063321f, 0.147584f, 0.227447f, 0.186450f, 0.126406f, 0.166279f, 0.114394f, -0.056352f, -0.066745f, -0.198674f, -0.204735f, 0.075860f, -0.165018f, -0.113033f, -0.139619f, -0.057017f, 0.130202f, -0.095362f, -0.120110f, -0.078503f, -0.147300f, -0.223522f, -0.011320f, 0.073513f, -0.051573f, -0.111033f, 0.106958f, -0.257846f, -0.218406f, -0.155110f, 0.014534f, -0.068045f, 0.149871f, -0.136952f, -0.084786f, 0.236826f, -0.220765f, -0.073366f, -0.000113f, -0.009006f, -0.078190f, -0.130151f, -0.012327f, -0.177628f, -0.214605f, -0.229643f, -0.152625f, 0.092221f, -0.024406f, 0.119850f, 0.005958f, -0.137368f, 0.008535f, 0.174103f, -0.219972f, -0.032442f, -0.088024f, 0.154803f, -0.157791f, -0.274636f, -0.024927f, 0.190239f, -0.059908f, 0.141338f, -0.069842f, 0.006775f, 0.285561f, -0.082860f, 0.184456f, 0.087379f, -0.201648f, 0.073428f, -0.037780f, -0.180451f, -0.216605f, -0.178652f, -0.010987f, 0.161081f, 0.120437f, -0.084994f, -0.088647f, 0.160362f, 0.240710f, -0.082228f, -0.125363f, 0.091522f, -0.157441f, -0.227163f, 0.078393f, 0.074951f, -0.118002f, 0.085574f, -0.148411f, 0.179481f, 0.117327f, 0.008746f, -0.012414f, 0.087655f, -0.229447f, -0.296758f, -0.034454f, 0.133178f, 0.158294f, -0.164832f, 0.213045f, 0.063677f, -0.004247f, -0.243829f, 0.024877f, 0.090581f, -0.139082f, 0.129356f, 0.005633f, -0.190714f, 0.050824f, -0.112800f, -0.048832f, 0.100893f, 0.000066f, -0.039790f, 0.031992f, 0.155201f, -0.024731f, 0.129754f, 0.027385f, 0.032632f, 0.026667f, -0.089987f, -0.097065f, -0.013028f, -0.119132f, -0.149180f, 0.248226f, -0.003424f, 0.216407f, 0.192258f, 0.179757f, -0.041383f, -0.102616f, -0.119916f, -0.059758f, 0.135179f, -0.033591f, 0.184981f, -0.025971f, 0.191345f, -0.210990f, -0.116512f, 0.020594f, -0.072697f, 0.180806f, 0.204460f, 0.182097f, 0.028130f, -0.076808f, -0.014433f, -0.148378f, 0.223537f, 0.064296f, -0.179940f, -0.037049f, -0.108780f, 0.155917f, -0.409164f, -0.081443f, 0.052289f, 0.242189f, -0.177657f, 0.108189f, 0.096319f, 0.265026f, -0.089884f, 0.038683f, -0.180972f, -0.164611f, 0.078301f, -0.054233f, -0.134995f, -0.240879f, -0.129090f, 0.376604f, -0.148075f, 0.224856f, -0.156082f, 0.048691f, 0.052191f, 0.133698f, 0.023869f, -0.072324f, -0.024329f, -0.130658f, 0.058078f, 0.058312f, 0.073973f, 0.176096f, -0.433795f, -0.233533f, 0.238606f, -0.230163f, -0.181310f, -0.058507f, -0.338848f, 0.006178f, -0.070755f, 0.234004f, -0.159464f, -0.080232f, 0.224140f, 0.375089f, -0.252341f, 0.304142f, 0.423279f, 0.018356f, -0.004383f, -0.093172f, 0.127604f, -0.040429f, 0.060779f, 0.157689f, -0.237854f, -0.030681f, 0.090916f, 0.041523f, -0.149669f, 0.001876f, 0.065236f, 0.050883f, -0.056823f, -0.090481f, 0.007536f, -0.064351f, 0.103771f, 0.336248f, 0.144980f, 0.102622f, -0.221009f, -0.101182f, -0.430839f, -0.185448f, 0.051976f, 0.242656f, -0.219364f, 0.004957f, 0.243167f, 0.209360f, 0.101046f, -0.163617f, 0.093583f, 0.104173f, -0.017765f, 0.115235f, -0.090570f, 0.234950f, -0.241440f, 0.131756f, -0.434771f, -0.043486f, 0.096335f, -0.219571f, -0.100422f, 0.128739f, -0.037482f, 0.014097f, -0.102355f, -0.062057f, -0.061942f, 0.000871f, -0.084228f, -0.018730f, 0.017483f, -0.058654f, -0.042560f, -0.251765f, -0.224186f, 0.119136f, -0.037393f, 0.191825f, 0.050411f, 0.151300f, -0.027538f, -0.201960f, -0.084657f, -0.174386f, 0.104225f, 0.119226f, -0.017552f, 0.191142f, 0.066824f, 0.142427f, -0.007031f, 0.049535f, -0.047855f, -0.253767f, -0.130042f, -0.103990f, -0.187312f, -0.106059f, 0.142695f, -0.080606f, 0.242459f, 0.256591f, -0.203451f, 0.148051f, 0.109057f, 0.326545f, -0.210811f, 0.033834f, 0.386042f, 0.402073f, -0.050358f, 0.082100f, 0.101392f, -0.164892f, -0.013152f, -0.156714f, -0.056205f, 0.070569f, -0.125567f, -0.033620f, -0.138541f, 0.219911f, 0.122049f, -0.049557f, -0.116464f, 0.092052f, -0.112219f, -0.075318f, 0.042290f, -0.006737f, -0.141828f, 0.267948f, 0.165151f, -0.008564f, -0.286590f, 0.067748f, 0.194661f, -0.043063f, -0.023373f, -0.121087f, 0.556464f, -0.125009f, 0.096822f, 0.015490f, -0.020269f, 0.164838f, -0.238073f, 0.097399f, 0.112394f, 0.254518f, 0.134549f, -0.290572f, -0.155645f, 0.006788f, -0.086240f, 0.241057f, -0.041825f, -0.185686f, -0.010579f, 0.109081f, -0.051703f, 0.020926f, -0.276132f, 0.025352f, -0.327984f, 0.130836f, -0.348707f, -0.081010f, -0.053511f, -0.235633f, -0.406269f, -0.209401f, -0.001308f, 0.042945f, 0.111331f, -0.063363f, -0.069483f, -0.299096f, -0.087593f, -0.327318f, -0.350645f, 0.151436f, 0.122152f, 0.013157f, -0.168190f, -0.067595f, 0.060751f, -0.120171f, 0.070783f, 0.108738f, -0.069886f, 0.150785f, 0.030701f, 0.048761f, 0.039831f, -0.174667f, 0.198136f, -0.048576f, -0.025221f, -0.079846f, 0.071922f, -0.008346f, 0.160508f, -0.083776f, 0.047795f, 0.068908f, 0.051365f, 0.094463f, -0.106180f, -0.083908f, -0.130036f, -0.072970f, -0.027925f, -0.042018f, -0.036057f, -0.061563f, 0.112805f, -0.250251f, 0.023977f, -0.146811f, 0.003587f, -0.086061f, -0.171262f, -0.080336f, 0.098753f, -0.000400f, 0.163048f, 0.052034f, 0.098306f, -0.086492f, 0.293838f, 0.135540f, 0.207788f, -0.063505f, 0.121489f, -0.189990f, 0.132610f, -0.124361f, 0.000331f, -0.063490f, 0.192385f, 0.042449f, 0.256164f, 0.018365f, 0.473958f, 0.269023f, 0.195997f, 0.096333f, 0.264745f, 0.279241f, -0.123753f, 0.158288f, 0.035758f, 0.310784f, -0.094653f, -0.086174f, -0.023897f, 0.034181f, -0.070969f, 0.175948f, -0.128401f, -0.285318f, -0.009279f, 0.003669f, -0.204344f, -0.034790f, 0.155869f, 0.195285f, 0.070184f, -0.236807f, -0.018076f, 0.195010f, 0.123166f, 0.080561f, -0.158566f, 0.096460f, -0.154627f, -0.172599f, -0.042402f, -0.225715f, -0.018701f, 0.152138f, -0.067512f, 0.107002f, 0.286904f, 0.106642f, 0.025030f, -0.162013f, -0.144860f, -0.151792f, -0.117370f, -0.107341f, -0.173784f, 0.081209f, -0.063615f, 0.176034f, 0.096038f, -0.012511f, 0.040975f, 0.151988f, 0.242095f, -0.109009f, 0.255143f, -0.166793f, -0.022663f, -0.181787f, -0.047822f, 0.034814f, -0.358953f, 0.015833f, -0.346567f, -0.187666f, -0.049663f, -0.161575f, 0.150456f, 0.061373f, -0.057620f, -0.047454f, 0.061411f, -0.110166f, -0.234618f, -0.186371f, 0.286279f, -0.033388f, -0.226601f, -0.307866f, -0.117725f, 0.110119f, 0.204395f, -0.031909f, 0.174333f, 0.033911f, -0.083783f, 0.041707f, -0.050287f, -0.150710f, 0.280933f, 0.014882f, -0.045499f, 0.063673f, -0.158494f, 0.209249f, -0.101376f, 0.042046f, -0.144503f, -0.274752f, -0.231587f, 0.185729f, 0.181221f, -0.034474f, 0.214933f, -0.044883f, 0.060592f, -0.168271f, 0.003799f, 0.133759f, -0.153023f, 0.088955f, -0.117873f, -0.018395f, 0.117747f, 0.076048f, -0.122571f, 0.156051f, -0.202543f, -0.239259f, -0.026139f, -0.232612f, 0.155589f, -0.166220f, 0.227830f, 0.021448f, 0.141523f, -0.214955f, -0.008349f, 0.061247f, -0.000282f, 0.100711f, 0.100668f, -0.385339f, -0.384993f, -0.154904f, 0.211369f, -0.075825f, -0.103673f, -0.023944f, -0.121427f, -0.011624f, 0.029765f, -0.152306f, -0.193918f, 0.145853f, -0.102226f, -0.313765f, 0.180870f, 0.158131f, -0.059703f, -0.061437f, 0.033968f, -0.004269f, -0.055060f, 0.127289f, -0.040262f, 0.018585f, -0.123098f, -0.091429f, 0.133424f, -0.035475f, -0.068341f, 0.094444f, -0.027998f, 0.253292f, -0.029958f, -0.342630f, -0.000027f, -0.298859f, 0.031450f, 0.226477f, 0.090057f, -0.054642f, 0.028825f, 0.039926f, -0.061461f, 0.170208f, -0.053444f, 0.016508f, 0.080147f, -0.358770f, -0.280338f, -0.023733f, -0.107115f, -0.100700f, -0.140313f, -0.080461f, 0.188763f, 0.139798f, 0.096930f, 0.165858f, -0.147131f, -0.104437f, 0.145212f, 0.009520f, -0.192732f, -0.101073f, -0.173711f, 0.139962f, 0.166831f, 0.218573f, -0.032781f, -0.192045f, -0.115183f, 0.150693f, 0.184165f, 0.165204f, 0.112431f, 0.166416f, 0.135019f, -0.111278f, 0.055362f, 0.086330f, 0.009823f, 0.008686f, 0.196956f, 0.143758f, -0.170120f, 0.066482f, -0.151545f, -0.069530f, 0.013719f, 0.010355f, 0.190353f, 0.120665f, 0.202439f, 0.048017f, 0.085312f, -0.134189f, -0.058908f, 0.056289f, 0.027606f, 0.049402f, -0.291995f, -0.147521f, 0.100830f, 0.158214f, 0.079118f, 0.127747f, -0.313869f, -0.095541f, -0.077915f, -0.015783f, 0.101696f, -0.042040f, -0.037627f, -0.076441f, 0.201559f, -0.128206f, -0.048773f, 0.119190f, 0.154376f, 0.170350f, -0.093175f, 0.033218f, 0.052359f, -0.096961f, 0.021191f, -0.074987f, 0.136628f, -0.082542f, -0.026856f, 0.135666f, -0.261487f, -0.331375f, -0.130972f, -0.067742f, -0.194974f, 0.181765f, -0.166696f, -0.221410f, 0.087401f, -0.101229f, 0.086108f, 0.036653f, 0.131148f, -0.054168f, -0.266025f, -0.207620f, -0.037660f, -0.035581f, -0.102421f, -0.165019f, -0.138684f, -0.047261f, 0.124316f, -0.021776f, -0.059817f, -0.256887f, 0.094786f, -0.147542f, 0.058066f, -0.020293f, 0.176847f, 0.251789f, -0.132952f, 0.169870f, -0.032829f, 0.195002f, 0.149206f, -0.171010f, -0.089326f, 0.011384f, 0.049010f, 0.030357f, -0.004703f, -0.120051f, -0.008119f, 0.282347f, -0.027621f, -0.307559f, 0.158819f, -0.034124f, 0.075389f, 0.169653f, -0.048770f, -0.078821f, -0.221270f, 0.136696f, 0.135075f, 0.090852f, 0.143893f, 0.136824f, -0.118395f, -0.233913f, -0.010960f, -0.133434f, 0.162522f, -0.003916f, -0.001690f, -0.197910f, 0.075134f, -0.046750f, -0.013193f, -0.117703f, -0.102179f, -0.038017f, 0.039673f, -0.243011f, 0.083965f, -0.076022f, -0.077970f, 0.203100f, 0.004417f, -0.043970f, -0.059906f, 0.164371f, -0.025041f, -0.026593f, -0.023810f, 0.024240f, -0.026478f, -0.061534f, -0.009635f, -0.216687f, 0.164249f, -0.040412f, 0.041145f, -0.035509f, 0.080290f, 0.056399f, 0.080430f, -0.212877f, 0.013519f, 0.121282f, 0.187615f, 0.192613f, 0.130143f, -0.170571f, 0.112287f, 0.021266f, -0.090820f, -0.082420f, 0.094771f, 0.175704f, -0.083551f, 0.041885f, 0.029061f, -0.017587f, 0.101723f, -0.200509f, -0.083633f, -0.074965f, -0.078605f, 0.251738f, -0.213972f, -0.244304f, 0.150630f, -0.391277f, -0.234578f, -0.067185f, 0.129521f, 0.254695f, -0.234124f, -0.207638f, 0.013081f, 0.104627f, -0.273484f, -0.036410f, 0.035005f, -0.110356f, -0.101702f, -0.221720f, -0.164799f, -0.026216f, -0.015635f, 0.079659f, 0.039363f, -0.024441f, -0.148633f, 0.166294f, -0.084310f, -0.087505f, 0.085251f, 0.027872f, -0.096689f, 0.164392f, 0.164190f, -0.101811f, -0.014534f, 0.225161f, -0.011344f, -0.096293f, 0.135718f, -0.002623f, -0.041585f, -0.061834f, -0.100057f, -0.137806f, -0.047739f, -0.254562f, -0.208097f, -0.250353f, 0.059731f, -0.065011f, 0.080384f, 0.130737f, 0.050940f, 0.045730f, 0.263643f, -0.432590f, -0.067945f, -0.087435f, 0.073489f, 0.106107f, -0.015257f, 0.009447f, -0.110300f, -0.029940f, -0.002842f, -0.199566f, 0.187318f, -0.014008f, -0.194271f, -0.168817f, -0.260754f, 0.110484f, 0.105602f, 0.033351f, 0.195415f, -0.015099f, 0.000413f, 0.164027f, 0.236064f, 0.053918f, -0.100733f, -0.129431f, 0.062433f, 0.019827f, -0.147699f, 0.119943f, -0.113822f, -0.015577f, 0.234572f, 0.037704f, 0.148533f, -0.074595f, 0.358131f, 0.142343f, 0.019269f, 0.132988f, 0.303520f, -0.170363f, 0.183170f, 0.050796f, -0.278196f, -0.026288f, -0.088419f, 0.187571f, -0.316654f, -0.234750f, 0.222909f, 0.004207f, -0.060844f, -0.155652f, 0.197962f, -0.192431f, -0.233428f, 0.144615f, 0.021093f, -0.273163f, -0.027759f, -0.196123f, 0.062198f, 0.046644f, 0.111298f, -0.230629f, -0.213811f, -0.203586f, -0.026982f, 0.014334f, -0.085741f, -0.206493f, 0.161656f, -0.006161f, -0.213071f, -0.169306f, -0.359943f, -0.156778f, -0.047050f, 0.001760f, 0.222709f, 0.206591f, 0.067479f, -0.140425f, 0.039597f, 0.000494f, -0.230665f, -0.345093f, 0.305608f, -0.243169f, -0.062308f, 0.089047f, 0.043348f, 0.018794f, -0.072655f, 0.057708f, 0.173073f, -0.118028f, 0.015397f, -0.066276f, 0.099851f, 0.000341f, 0.043808f, -0.200419f, -0.086583f, 0.002635f, 0.027712f, 0.096432f, 0.009458f, -0.107500f, 0.189448f, -0.138508f, -0.011409f, 0.063067f, -0.272256f, -0.128182f, -0.161822f, 0.006283f, -0.076989f, -0.228777f, -0.082233f, -0.071440f, 0.102116f, 0.088951f, -0.185714f, -0.009430f, 0.164842f, -0.108608f, -0.216381f, -0.204016f, -0.093166f, 0.078876f, -0.230213f, 0.251046f, -0.053362f, 0.105620f, -0.034899f, -0.132352f, 0.039794f, 0.020467f, 0.120597f, 0.088108f, 0.142355f, -0.184826f, -0.078714f, -0.038057f, 0.149445f, 0.175956f, -0.035918f, -0.028899f, -0.026191f, 0.002988f, 0.181993f, 0.132793f, 0.084984f, 0.206185f, 0.108682f, -0.207883f, -0.040471f, -0.079845f, -0.201423f, 0.195002f, -0.014805f, -0.113615f, -0.019901f, 0.219746f, 0.076151f, -0.140267f, -0.086191f, 0.166560f, 0.215008f, -0.173558f, -0.136227f, -0.036176f, 0.038654f, -0.142140f, 0.118488f, -0.069072f, -0.136992f, -0.020697f, 0.273570f, 0.065130f, 0.079654f, -0.135105f, -0.048338f, -0.152032f, -0.185021f, -0.006329f, 0.024995f, 0.348058f, -0.166587f, 0.210006f, -0.139774f, -0.009915f, 0.061234f, -0.122839f, -0.017009f, 0.046397f, -0.044948f, 0.115815f, -0.355180f, 0.019704f, -0.083852f, 0.368068f, 0.098707f, -0.144017f, -0.033558f, 0.085982f, -0.027969f, -0.013698f, 0.193811f, -0.190625f, -0.433235f, 0.046427f, -0.067981f, 0.059540f, -0.066769f, -0.082584f, 0.133988f, -0.130205f, 0.230140f, 0.120298f, 0.044269f, 0.037072f, -0.119598f, -0.006823f, 0.051501f, -0.036891f, 0.066919f, 0.087028f, 0.185806f, 0.174955f, 0.028385f, 0.127219f, 0.038359f, -0.011921f, 0.214495f, 0.018194f, 0.128623f, 0.111688f, 0.039091f, -0.214506f, -0.002114f, -0.222144f, -0.076923f, -0.225005f, -0.050808f, -0.051130f, -0.003511f, -0.214292f, 0.145085f, 0.007457f, -0.214946f, -0.229947f, 0.043394f, -0.150716f, -0.140815f, -0.233470f, 0.046384f, -0.218589f, 0.087921f, 0.056487f, 0.130708f, -0.151961f, -0.169924f, 0.169239f, -0.002957f, -0.143877f, 0.229014f, -0.210268f, -0.148795f, 0.177343f, 0.045255f, 0.174538f, 0.093143f, 0.213158f, -0.337055f, -0.045984f, 0.168854f, 0.161072f, 0.005566f, -0.304214f, -0.121518f, 0.161608f, 0.085559f, -0.318502f, 0.086370f, -0.257500f, 0.245145f, -0.022044f, -0.093979f, -0.296110f, 0.157076f, -0.170848f, -0.009030f, 0.035277f, -0.229432f, 0.116298f, 0.146607f, -0.274259f, -0.105255f, -0.090437f, 0.084592f, -0.179739f, 0.132604f, 0.224207f, -0.139881f, 0.123284f, 0.075589f, 0.161082f, 0.133700f, 0.133490f, -0.190625f, -0.194412f, 0.170131f, -0.167990f, -0.150155f, 0.116336f, 0.203957f, -0.133760f, -0.182338f, 0.055076f, -0.155960f, -0.091625f, -0.425464f, -0.232866f, -0.095214f, 0.053043f, 0.182533f, -0.247732f, -0.042956f, 0.029378f, 0.121533f, 0.044857f, 0.179729f, 0.134696f, 0.168436f, 0.074369f, 0.070319f, -0.058366f, 0.048824f, 0.005547f, 0.240550f, -0.065470f, 0.232338f, -0.125789f, -0.102394f, 0.270930f, -0.121458f, -0.257261f, -0.171479f, -0.262050f, 0.193631f, -0.084451f, -0.106350f, 0.006509f, 0.000371f, -0.063708f, 0.141800f, -0.105568f, -0.057756f, 0.007241f, 0.144863f, -0.048077f, -0.289664f, 0.297159f, -0.104356f, 0.247685f, 0.172999f, -0.050741f, 0.093661f, 0.110532f, 0.424583f, 0.053482f, 0.009301f, -0.038577f, 0.213242f, -0.042303f, -0.077334f, -0.192371f, -0.226529f, 0.185807f, -0.050200f, -0.070391f, 0.098849f, 0.057433f, 0.046982f, 0.001359f, 0.220271f, 0.070588f, -0.107792f, 0.035434f, -0.158969f, -0.023989f, 0.157348f, 0.118303f, 0.038491f, 0.090389f, 0.275136f, 0.110934f, -0.189886f, 0.065540f, -0.001085f, -0.281416f, 0.098346f, -0.221060f, -0.210790f, -0.220435f, -0.204456f, -0.162675f, -0.074042f, 0.130486f, 0.040397f, 0.062042f, 0.075747f, -0.186122f, -0.123328f, 0.082297f, 0.165955f, 0.011031f, -0.307752f, 0.049416f, 0.147639f, -0.069860f, -0.032506f, -0.365650f, -0.169333f, -0.162293f, -0.239255f, -0.039449f, 0.052248f, 0.179168f, 0.239698f, 0.180341f, -0.035741f, -0.289129f, 0.098535f, 0.042335f, -0.016172f, 0.121235f, 0.171493f, 0.029211f, 0.169034f, -0.014526f, -0.078925f, -0.064287f, 0.053373f, -0.079551f, 0.032952f, 0.042538f, 0.181020f, -0.089534f, -0.271807f, -0.064537f, 0.180794f, -0.043993f, 0.019324f, -0.138780f, -0.020590f, -0.232194f, 0.000819f, -0.211123f, -0.178460f, 0.000395f, 0.060143f, 0.024916f, 0.198452f, -0.132007f, 0.264821f, 0.089905f, -0.157179f, 0.153955f, -0.057521f, 0.202001f, -0.014907f, 0.190242f, -0.453626f, -0.003214f, 0.072313f, 0.230817f, 0.141970f, 0.058183f, 0.170802f, 0.176389f, -0.223115f, 0.260551f, -0.079753f, -0.044910f, 0.256944f, -0.253744f, -0.219630f, 0.034355f, 0.064785f, 0.014895f, 0.212469f, 0.040459f, -0.047735f, 0.176560f, -0.117925f, -0.161044f, 0.040177f, 0.117845f, 0.024620f, 0.074081f, 0.039654f, 0.159616f, 0.186141f, -0.170601f, 0.123641f, -0.058897f, -0.026219f, -0.015784f, -0.058094f, -0.099731f, 0.090923f, 0.205306f, 0.190702f, 0.090959f, 0.197753f, -0.084596f, 0.276767f, 0.213365f, 0.186819f, -0.002556f, 0.111451f, 0.278341f, -0.136374f, -0.051647f, -0.204447f, -0.092744f, 0.145987f, 0.074185f, 0.136687f, 0.138810f, -0.170073f, 0.122066f, -0.188146f, 0.004798f, -0.174494f, 0.207207f, 0.142283f, 0.153859f, -0.110049f, 0.103942f, -0.182095f, -0.119200f, -0.150388f, -0.140728f, 0.217819f, -0.212754f, -0.247615f, -0.003619f, -0.306014f, 0.202281f, -0.117142f, 0.194967f, 0.011174f, -0.100281f, -0.052685f, -0.177178f, 0.025049f, -0.050135f, -0.080498f, 0.256021f, 0.683639f, 0.106960f, -0.224579f, 0.179705f, 0.170294f, 0.312091f, -0.358404f, 0.069747f, 0.081192f, 0.166856f, -0.296529f, -0.003448f, -0.049960f, -0.188067f, 0.039930f, 0.213279f, -0.155342f, -0.142513f, -0.061544f, 0.151569f, -0.054655f, 0.192686f, 0.233561f, -0.040347f, 0.140422f, -0.149306f, 0.093239f, -0.179707f, -0.050699f, 0.188162f, -0.039087f, -0.041160f, -0.042436f, 0.065129f, -0.294561f, 0.190840f, -0.066017f, 0.179315f, -0.173675f, -0.009740f, 0.363411f, -0.065500f, -0.186955f, 0.083245f, 0.175497f, 0.176486f, -0.024111f, -0.134695f, 0.658251f, 0.057592f, -0.068158f, 0.191364f, 0.191909f, -0.096105f, 0.153795f, -0.136251f, -0.060922f, 0.123982f, -0.189512f, 0.014683f, -0.038077f, 0.034873f, 0.153700f, 0.323927f, 0.281145f, -0.200667f, -0.117623f, -0.118348f, 0.152328f, 0.112995f, -0.022593f, 0.044424f, 0.267996f, 0.151651f, -0.177951f, 0.032684f, -0.134593f, 0.098511f, -0.135847f, 0.011055f, -0.087225f, 0.206892f, 0.127390f, 0.016664f, 0.125599f, -0.064534f, 0.051724f, 0.345549f, -0.085671f, -0.063159f, -0.139039f, -0.048563f, 0.063221f, 0.013319f, -0.077748f, 0.180687f, 0.492241f, 0.251459f, -0.029550f, 0.068755f, 0.074542f, 0.156300f, -0.137180f, -0.090176f, -0.046634f, 0.314927f, 0.099685f, -0.004573f, 0.021823f, 0.008096f, -0.018280f, 0.044872f, -0.028058f, 0.198254f, 0.136566f, -0.080970f, -0.065317f, -0.058746f, -0.077956f, 0.008957f, 0.290828f, 0.305484f, 0.024633f, 0.103745f, -0.042056f, -0.048433f, 0.069007f, 0.014371f, 0.169636f, -0.052864f, -0.233398f, 0.024807f, -0.361726f, -0.171676f, -0.116972f, 0.166944f, 0.189495f, 0.057090f, 0.088458f, -0.044509f, -0.051725f, 0.095425f, -0.243633f, -0.101341f, -0.225538f, -0.249486f, -0.032073f, 0.087648f, 0.158826f, -0.230873f, 0.025334f, -0.068669f, -0.075054f, -0.001340f, 0.152303f, 0.143992f, 0.116335f, -0.113903f, 0.003893f, -0.045325f, 0.035075f, 0.045902f, 0.222006f, 0.155822f, 0.052742f, -0.105516f, -0.090872f, -0.147776f, -0.091747f, 0.037297f, -0.156136f, -0.166671f, -0.183280f, -0.137079f, 0.125996f, -0.009203f, -0.012728f, 0.242127f, -0.117662f, 0.094920f, 0.186111f, 0.205685f, 0.164989f, -0.058705f, -0.330662f, -0.091041f, 0.174694f, 0.154487f, -0.485412f, 0.044405f, -0.040880f, 0.039941f, -0.184976f, -0.256717f, -0.104430f, -0.258207f, 0.223158f, 0.238880f, 0.197781f, 0.217267f, -0.335654f, 0.093833f, -0.151252f, -0.001499f, 0.267889f, 0.154138f, -0.170951f, -0.119099f, -0.250707f, 0.025753f, 0.111675f, -0.106752f, -0.109525f, -0.042431f, -0.013520f, -0.326760f, -0.075819f, -0.088976f, 0.063499f, -0.439788f, -0.001493f, 0.191153f, -0.219680f, 0.165463f, -0.090973f, 0.121927f, -0.061074f, 0.056523f, -0.140391f, 0.098451f, -0.059465f, -0.030214f, 0.178280f, -0.190877f, 0.128931f, -0.345304f, 0.014922f, -0.178645f, 0.086224f, 0.295498f, -0.197836f, -0.175196f, -0.141513f, -0.048297f, 0.059315f, -0.236711f, 0.193155f, 0.162038f, 0.062779f, -0.099993f, -0.018826f, -0.301295f, -0.071119f, 0.014500f, -0.105981f, -0.189126f, -0.187496f, 0.120726f, -0.119527f, 0.054384f, 0.120369f, -0.094457f, -0.023496f, 0.163465f, 0.192712f, -0.048715f, -0.069948f, 0.177297f, -0.158946f, 0.234761f, -0.158802f, 0.124235f, 0.234506f, 0.226963f, -0.189207f, 0.052876f, -0.217580f, 0.159309f, 0.151480f, -0.305632f, -0.023872f, -0.272053f, 0.004134f, 0.031900f, 0.191386f, 0.067115f, 0.055508f, 0.070404f, 0.077041f, 0.068145f, -0.122760f, -0.248795f, -0.133539f, -0.121742f, -0.196762f, 0.040116f, 0.135931f, 0.081974f, 0.134607f, 0.226044f, 0.101733f, 0.152017f, -0.108461f, 0.098446f, -0.359474f, 0.095953f, -0.305296f, -0.208474f, 0.204489f, 0.016488f, -0.371132f, -0.127487f, 0.024801f, -0.120930f, 0.185774f, -0.288841f, 0.123653f, -0.114699f, -0.173342f, -0.005543f, -0.271819f, -0.199813f, -0.028117f, 0.083390f, -0.018637f, -0.054424f, 0.033953f, -0.074568f, 0.112782f, -0.282332f, -0.102682f, -0.002414f, -0.331655f, 0.163891f, -0.071136f, 0.028090f, -0.750209f, -0.362574f, -0.455895f, 0.117534f, 0.303968f, -0.049428f, -0.343202f, -0.087677f, -0.148172f, 0.200346f, -0.087478f, 0.220418f, -0.138079f, 0.191983f, -0.151845f, -0.531768f, -0.362484f, -0.187747f, -0.027168f, 0.074742f, -0.084565f, -0.131026f, -0.256397f, -0.306296f, 0.130769f, 0.049294f, 0.063471f, -0.636881f, -0.187266f, -0.260053f, -0.219784f, -0.125278f, 0.027432f, -0.072602f, -0.101534f, -0.040844f, -0.161025f, -0.051679f, -0.270359f, 0.100874f, 0.254933f, 0.202768f, -0.199100f, -0.106375f, 0.009270f, 0.178921f, 0.105413f, 0.085521f, 0.198184f, 0.093680f, 0.287111f, 0.064014f, 0.015502f, -0.024583f, -0.145338f, 0.161944f, 0.000473f, 0.134991f, -0.055204f, 0.096319f, -0.032079f, -0.185239f, -0.164151f, 0.296344f, 0.052666f, -0.106669f, 0.020065f, -0.088088f, 0.234663f, 0.012361f, -0.046836f, -0.003942f, 0.149325f, 0.220393f, 0.175261f, 0.043030f, 0.182284f, -0.147723f, -0.123421f, 0.155593f, 0.036265f, 0.073365f, 0.182780f, -0.128136f, 0.165048f, -0.137200f, 0.091187f, 0.089878f, 0.078565f, -0.250982f, 0.232800f, 0.025242f, 0.088548f, 0.106779f, 0.097994f, -0.111977f, -0.126512f, -0.130366f, -0.069541f, -0.144460f, 0.141846f, 0.104273f, -0.055637f, 0.217339f, -0.103560f, 0.099746f, 0.071395f, -0.173038f, -0.044351f, -0.031010f, 0.122401f, 0.110523f, 0.141801f, 0.186257f, 0.187035f, -0.065246f, -0.045507f, -0.208906f, 0.070677f, 0.110854f, 0.132155f, 0.040544f, -0.130578f, -0.045236f, -0.092585f, 0.170435f, 0.145040f, -0.060564f, 0.123314f, 0.085137f, 0.035170f, -0.039136f, -0.183738f, 0.140833f, 0.007057f, -0.312667f, -0.352401f, -0.212906f, 0.028915f, -0.147200f, -0.279879f, 0.147428f, -0.192628f, -0.073854f, -0.186711f, -0.233234f, 0.083468f, 0.035491f, 0.235918f, -0.038934f, -0.215538f, 0.033384f, -0.328183f, 0.215902f, 0.050389f, -0.230769f, 0.072217f, 0.097491f, -0.072683f, 0.123373f, -0.116001f, -0.039419f, -0.016956f, -0.027147f, -0.162962f, -0.227236f, -0.095398f, 0.104254f, -0.151394f, -0.025575f, -0.092562f, -0.094199f, 0.050860f, -0.064395f, 0.094463f, 0.145578f, 0.180698f, -0.010145f, -0.219115f, -0.173157f, -0.253509f, -0.030291f, 0.072023f, -0.108015f, -0.165073f, -0.220462f, 0.106933f, -0.199428f, -0.095642f, 0.039286f, -0.122397f, 0.027330f, -0.405550f, -0.086219f, -0.121430f, 0.057422f, -0.165957f, 0.125022f, 0.205149f, 0.130446f, 0.022043f, -0.183007f, 0.194375f, 0.090716f, 0.185497f, 0.137883f, 0.089835f, -0.114944f, 0.174107f, 0.072018f, 0.102684f, 0.225297f, -0.042461f, 0.175521f, -0.089089f, -0.139520f, -0.018220f, -0.031774f, -0.069523f, -0.176411f, 0.013634f, 0.172525f, 0.033444f, -0.128377f, 0.157756f, 0.193740f, -0.025926f, -0.193974f, 0.175211f, 0.247765f, 0.042183f, -0.290684f, -0.147364f, -0.221433f, 0.211822f, 0.015740f, -0.195822f, -0.077341f, 0.091552f, -0.003749f, -0.249871f, -0.171060f, 0.108775f, -0.054125f, 0.167272f, -0.219477f, -0.119914f, 0.059318f, 0.000074f, -0.129024f, -0.144136f, -0.006845f, -0.022071f, 0.224270f, -0.062936f, -0.024721f, -0.031604f, 0.059598f, 0.183131f, 0.292545f, 0.077692f, -0.086533f, 0.158102f, 0.140554f, 0.014956f, 0.055612f, -0.035100f, 0.102376f, -0.147469f, -0.121221f, 0.170281f, 0.156251f, -0.197867f, -0.194472f, -0.029405f, 0.190024f, 0.020925f, -0.018524f, -0.169587f, -0.099648f, -0.245701f, -0.204552f, 0.004613f, -0.034164f, -0.032418f, 0.099748f, -0.155643f, 0.025036f, -0.146147f, -0.095472f, -0.174686f, -0.096994f, 0.174472f, -0.298533f, 0.077699f, -0.096680f, 0.089139f, 0.051120f, -0.026242f, -0.140263f, 0.112893f, 0.015623f, 0.158489f, 0.082519f, -0.093396f, 0.015402f, 0.068315f, -0.023041f, 0.087284f, -0.086810f, 0.242167f, 0.104729f, -0.131359f, -0.269590f, 0.144720f, 0.024135f, 0.153939f, -0.001524f, 0.023558f, 0.034277f, -0.082195f, -0.128206f, -0.041368f, -0.246945f, 0.125332f, -0.086192f, -0.157798f, -0.040774f, -0.041456f, -0.293381f, 0.040570f, -0.260531f, -0.237881f, 0.127016f, -0.140539f, -0.179442f, -0.056291f, 0.002791f, -0.236965f, -0.037263f, 0.264410f, 0.174587f, -0.111308f, 0.093589f, -0.513513f, -0.250240f, 0.187320f, -0.187317f, 0.076082f, 0.121529f, 0.098887f, -0.248226f, -0.346932f, 0.201096f, -0.062803f, -0.073340f, -0.062722f, 0.103870f, -0.126691f, 0.209599f, -0.076916f, 0.063516f, -0.300490f, -0.371967f, -0.124543f, 0.193561f, -0.229396f, -0.189792f, 0.188721f, 0.011766f, -0.183583f, -0.249740f, -0.149894f, 0.089323f, -0.080184f, -0.243374f, 0.012343f, -0.098421f, 0.276005f, -0.044409f, 0.010051f, 0.015164f, -0.224470f, 0.156904f, -0.267649f, 0.054599f, -0.013482f, -0.151944f, -0.092068f, -0.271571f, -0.147987f, 0.036143f, -0.135045f, -0.202263f, 0.244945f, -0.103605f, 0.249744f, -0.134748f, 0.140337f, -0.186904f, -0.165270f, 0.124763f, 0.226443f, 0.133974f, 0.105226f, -0.088314f, 0.190071f, 0.156952f, -0.131433f, 0.088704f, -0.015768f, -0.126226f, 0.145285f, 0.012859f, 0.082829f, 0.144827f, 0.194270f, -0.021346f, -0.201213f, 0.126105f, 0.113911f, -0.082476f, -0.040015f, -0.107587f, -0.247540f, 0.120755f, -0.261591f, -0.313432f, 0.241245f, 0.203435f, 0.153915f, -0.099392f, 0.404776f, -0.028390f, -0.215979f, -0.119641f, -0.051320f, -0.056514f, -0.057082f, -0.112996f, -0.189384f, 0.048639f, -0.282233f, -0.116108f, 0.006474f, -0.226819f, -0.159294f, 0.077125f, 0.100168f, -0.205928f, -0.243560f, 0.033716f, 0.151631f, -0.070151f, -0.364241f, -0.036574f, 0.100248f, 0.078760f, 0.246868f, 0.157267f, -0.028289f, 0.044207f, -0.169104f, -0.249148f, 0.122281f, -0.431874f, -0.399936f, -0.246086f, -0.347780f, -0.145021f, -0.187225f, 0.298243f, 0.092794f, 0.280768f, 0.037999f, 0.036377f, 0.054357f, 0.035794f, -0.054536f, 0.148842f, -0.038460f, -0.010676f, 0.039612f, 0.144282f, -0.298860f, 0.092256f, 0.034668f, -0.023390f, -0.472719f, -0.272826f, 0.131449f, 0.149878f, -0.203465f, -0.116276f, 0.034232f, 0.318261f, 0.092205f, -0.117146f, -0.184927f, -0.093371f, 0.173808f, 0.025470f, 0.097312f, -0.184397f, -0.055146f, 0.190319f, -0.155833f, -0.200662f, 0.167456f, 0.021107f, -0.261553f, -0.070388f, -0.008887f, -0.001481f, 0.033042f, 0.024068f, 0.240749f, -0.197926f, 0.117919f, 0.111916f, -0.022851f, -0.027010f, -0.087526f, 0.137131f, -0.101474f, 0.008088f, -0.423919f, -0.154829f, -0.027670f, 0.075869f, 0.019365f, -0.056671f, 0.130986f, -0.179529f, -0.153297f, -0.056486f, 0.084986f, -0.041713f, 0.028873f, -0.043179f, 0.060416f, 0.125775f, -0.119576f, 0.124880f, -0.100905f, -0.357907f, -0.166758f, -0.114369f, -0.189651f, -0.191391f, 0.191797f, -0.025003f, -0.031447f, 0.090899f, -0.124208f, -0.091502f, 0.182777f, -0.180272f, 0.044880f, -0.000063f, -0.094639f, 0.113398f, 0.165785f, 0.070483f, 0.177113f, 0.149798f, 0.189051f, -0.018842f, 0.047735f, 0.055404f, -0.061970f, -0.202998f, -0.331873f, 0.174037f, -0.075278f, 0.205013f, -0.035880f, -0.132064f, -0.025313f, -0.039747f, 0.154147f, -0.138997f, -0.126545f, -0.038673f, -0.011770f, 0.098075f, 0.182174f, -0.001475f, -0.110439f, 0.230211f, 0.063639f, -0.099252f, -0.069343f, 0.190622f, -0.116677f, 0.136190f, 0.101347f, -0.135913f, 0.208523f, -0.060426f, 0.052920f, -0.276483f, 0.075738f, 0.045919f, 0.058926f, 0.193209f, -0.081673f, -0.021902f, -0.023073f, -0.059992f, -0.099475f, 0.114105f, -0.167868f, 0.172689f, 0.146568f, -0.257817f, 0.113462f, 0.112120f, 0.086798f, -0.112396f, -0.029161f, -0.103877f, -0.162803f, 0.152481f, -0.191838f, -0.111367f, 0.164264f, -0.038889f, 0.133647f, -0.164536f, -0.119180f, -0.053697f, -0.057456f, 0.134293f, -0.202601f, 0.124475f, 0.100118f, 0.053272f, -0.041382f, -0.037183f, -0.196848f, -0.218063f, 0.094104f, 0.055760f, 0.155033f, 0.171782f, 0.143165f, 0.028495f, -0.231739f, 0.089477f, 0.178843f, -0.118049f, -0.203309f, -0.117516f, -0.226510f, 0.045383f, -0.205368f, -0.102138f, -0.013036f, -0.001756f, -0.018734f, 0.129844f, 0.180433f, -0.272831f, -0.030974f };
+static const float prediction_next_solar_gen_layer_2_biases[80] = { -0.016361f, -0.060709f, 0.044248f, 0.034830f, -0.146739f, 0.093705f, -0.134938f, -0.087292f, -0.041934f, 0.145253f, 0.120933f, 0.064601f, 0.053539f, 0.048723f, 0.077373f, 0.033220f, 0.117058f, -0.107356f, 0.108742f, 0.092870f, 0.111567f, 0.027914f, 0.074331f, 0.059912f, 0.075292f, -0.059045f, -0.089207f, 0.073871f, 0.102705f, 0.109955f, -0.050586f, 0.059048f, -0.162003f, -0.095713f, 0.115377f, 0.088115f, 0.121320f, -0.112893f, 0.109272f, -0.044961f, -0.035170f, 0.041339f, 0.093126f, 0.017585f, 0.133274f, 0.044995f, 0.105559f, 0.098765f, -0.148157f, 0.127077f, -0.098665f, -0.004064f, -0.082815f, -0.045344f, 0.108802f, -0.054583f, 0.048329f, 0.073576f, 0.079727f, -0.009208f, 0.087400f, 0.105428f, 0.065482f, 0.074689f, 0.113488f, 0.011986f, -0.067642f, -0.008767f, 0.067984f, -0.099007f, 0.090747f, 0.028205f, 0.020092f, 0.090899f, 0.078829f, 0.081920f, 0.125366f, 0.097613f, 0.091442f, 0.081162f };
+static const float prediction_next_solar_gen_layer_2_weights[6400] = { 0.182518f, -0.229419f, -0.134122f, 0.027722f, 0.207061f, -0.083109f, -0.244015f, 0.074684f, 0.127670f, 0.026995f, -0.050285f, 0.195501f, 0.308015f, 0.132134f, 0.326759f, -0.089127f, 0.414895f, -0.091291f, -0.047254f, 0.209960f, 0.484050f, 0.178646f, -0.053866f, 0.019942f, 0.267408f, 0.180365f, -0.091919f, -0.076662f, 0.041465f, -0.051895f, -0.214778f, 0.150329f, -0.095708f, 0.347276f, -0.026637f, 0.414084f, -0.246791f, 0.189619f, 0.230476f, 0.025286f, -0.081708f, 0.018710f, 0.152939f, 0.141199f, 0.112898f, 0.019546f, 0.241958f, -0.202140f, 0.365149f, -0.040817f, 0.125226f, 0.287547f, 0.082883f, -0.146159f, -0.141010f, 0.207188f, -0.210687f, -0.147406f, -0.153045f, 0.126719f, 0.219605f, 0.300762f, -0.089008f, 0.102155f, 0.247861f, -0.001488f, -0.100628f, -0.045259f, -0.094620f, -0.028530f, 0.023530f, -0.082840f, -0.018280f, -0.028964f, -0.011001f, 0.071900f, 0.224465f, 0.113793f, 0.026379f, -0.003608f, -0.113932f, -0.182851f, 0.143428f, 0.110286f, 0.026385f, 0.080387f, 0.024805f, 0.080047f, 0.087462f, -0.008127f, 0.218160f, -0.195613f, -0.066602f, 0.056579f, 0.135037f, -0.139370f, -0.031063f, 0.202910f, -0.118240f, 0.048379f, -0.105455f, -0.094065f, 0.176087f, -0.245490f, 0.028762f, -0.014167f, -0.344889f, 0.087584f, 0.234197f, -0.025513f, -0.001552f, -0.008877f, 0.248682f, -0.290907f, -0.054094f, -0.223294f, -0.030000f, 0.202075f, -0.079715f, 0.267058f, -0.137484f, 0.082965f, -0.030856f, 0.162921f, -0.123318f, 0.170718f, 0.022464f, -0.073796f, 0.129189f, -0.065346f, -0.153398f, 0.001054f, 0.108824f, 0.094138f, 0.055218f, -0.034094f, -0.018298f, 0.068238f, 0.233712f, -0.068661f, -0.053338f, 0.056527f, 0.156406f, -0.103887f, -0.265428f, 0.176653f, -0.360411f, 0.080038f, 0.026608f, -0.010389f, 0.035701f, -0.018465f, 0.181826f, -0.129340f, -0.177595f, 0.265272f, -0.064997f, -0.057871f, -0.070065f, 0.105181f, 0.152507f, -0.093134f, 0.223145f, -0.256172f, 0.098898f, 0.038351f, -0.183025f, -0.172851f, -0.071545f, -0.024214f, -0.217838f, 0.274261f, -0.250867f, 0.151573f, 0.374246f, 0.110822f, 0.217340f, -0.083482f, -0.077537f, -0.098716f, 0.261629f, -0.342727f, -0.143503f, 0.088416f, 0.150136f, -0.128173f, 0.165609f, -0.040115f, 0.033681f, -0.024503f, -0.057390f, -0.023817f, -0.220533f, 0.334290f, -0.266272f, 0.081182f, -0.095387f, -0.129022f, 0.408172f, -0.078291f, -0.075504f, -0.178843f, -0.092990f, -0.353848f, 0.188620f, -0.102708f, -0.191700f, 0.054492f, 0.224071f, 0.284141f, -0.125856f, 0.025742f, 0.033929f, -0.205822f, -0.005771f, 0.333255f, 0.129010f, 0.075487f, 0.072398f, 0.165050f, 0.340629f, 0.181395f, 0.035838f, -0.078017f, 0.083017f, -0.072177f, -0.096502f, -0.051286f, 0.143142f, -0.156368f, -0.178841f, 0.089135f, 0.052629f, -0.245175f, -0.078672f, 0.443680f, -0.271125f, -0.013350f, 0.050407f, 0.157961f, -0.212643f, -0.131607f, -0.108224f, -0.119423f, 0.127865f, 0.005082f, 0.024899f, 0.183662f, -0.110703f, 0.024951f, -0.115549f, -0.198398f, -0.051376f, 0.147828f, -0.304932f, 0.011700f, -0.194101f, -0.038581f, -0.238595f, -0.114124f, -0.054330f, 0.068712f, 0.101882f, -0.170853f, -0.057521f, -0.162241f, 0.054978f, 0.204500f, 0.140675f, -0.106998f, -0.048599f, -0.042349f, -0.007717f, -0.177087f, 0.174486f, -0.122858f, -0.201083f, -0.097612f, 0.021828f, -0.206985f, -0.069358f, 0.148198f, 0.117553f, 0.061010f, -0.008910f, 0.127486f, -0.006034f, -0.174166f, 0.063260f, -0.226629f, 0.028633f, 0.120826f, 0.127676f, -0.155705f, -0.152447f, -0.002704f, -0.028575f, 0.025684f, 0.124508f, -0.234882f, -0.246136f, -0.166833f, 0.164991f, -0.232887f, 0.009484f, 0.039031f, 0.222176f, 0.155759f, 0.058116f, 0.112712f, -0.090150f, 0.059313f, -0.090359f, -0.150229f, 0.186650f, -0.234663f, -0.000099f, 0.024581f, 0.026263f, -0.193896f, 0.020889f, 0.001841f, 0.089559f, 0.138106f, 0.030433f, 0.210214f, 0.184194f, 0.171833f, 0.071618f, 0.147451f, 0.077054f, -0.083877f, -0.097909f, -0.004637f, 0.341449f, 0.136103f, -0.100718f, 0.048329f, -0.097322f, 0.050469f, 0.190966f, -0.151086f, -0.027160f, 0.013183f, 0.153703f, -0.094997f, -0.162605f, -0.158003f, -0.041500f, 0.119889f, 0.033009f, 0.209139f, 0.217821f, 0.219744f, 0.154460f, 0.256500f, 0.221993f, 0.149937f, 0.147987f, 0.147928f, -0.000222f, -0.153039f, 0.085120f, -0.090378f, -0.165200f, 0.070555f, 0.071718f, -0.011769f, 0.214297f, 0.095356f, 0.141036f, -0.210565f, -0.136131f, -0.171497f, -0.153983f, -0.059881f, -0.058881f, -0.038925f, 0.037280f, 0.114076f, 0.107771f, 0.258859f, 0.024528f, 0.054588f, 0.081901f, 0.239450f, -0.452059f, 0.185045f, 0.042076f, -0.130089f, 0.055401f, -0.160403f, -0.082859f, -0.045313f, -0.137359f, 0.484749f, 0.259353f, 0.021898f, -0.181893f, -0.126286f, -0.141881f, 0.148733f, -0.040429f, 0.071443f, 0.016829f, 0.037681f, 0.162516f, 0.016168f, -0.056885f, 0.017638f, -0.041731f, -0.001001f, 0.146026f, -0.111376f, -0.143303f, 0.009462f, -0.137019f, 0.013358f, 0.055899f, -0.120739f, -0.051818f, -0.090265f, 0.136677f, 0.135862f, -0.092621f, -0.053679f, 0.343060f, -0.114361f, -0.077791f, 0.060299f, -0.061953f, 0.110580f, 0.118873f, -0.023147f, -0.260594f, -0.297306f, -0.071265f, 0.010482f, 0.079176f, -0.086130f, -0.135551f, -0.056014f, 0.024949f, 0.144633f, 0.117502f, 0.121977f, -0.176141f, 0.126289f, -0.171767f, 0.172082f, 0.060332f, -0.164981f, 0.038659f, 0.163619f, 0.199141f, -0.063409f, 0.063171f, 0.154155f, -0.089580f, -0.151048f, 0.013636f, -0.182584f, -0.070193f, 0.195994f, -0.004164f, -0.075816f, 0.197025f, -0.135099f, -0.097579f, 0.068388f, 0.145371f, 0.077130f, -0.013505f, 0.178224f, -0.022719f, -0.282239f, 0.032605f, -0.067408f, 0.146588f, 0.036467f, 0.088400f, -0.163913f, 0.153451f, 0.214509f, 0.019554f, -0.107983f, -0.056720f, -0.183062f, 0.016035f, -0.073039f, 0.301772f, 0.062658f, -0.056488f, 0.056179f, 0.097878f, -0.130527f, 0.049361f, 0.056490f, -0.121495f, 0.010755f, 0.000470f, 0.181242f, -0.099019f, -0.167860f, 0.166568f, 0.073201f, 0.021711f, 0.044622f, 0.122200f, -0.022740f, 0.102651f, 0.178373f, 0.071153f, -0.041933f, -0.142099f, 0.295601f, -0.048290f, 0.203697f, -0.024920f, 0.244986f, -0.032193f, 0.090764f, 0.234822f, 0.056646f, 0.012294f, -0.013977f, -0.040802f, -0.190501f, 0.062883f, 0.011402f, -0.028711f, 0.103252f, 0.148286f, 0.025532f, 0.127817f, 0.050185f, -0.164706f, 0.185978f, 0.051319f, 0.141739f, 0.073866f, -0.013549f, 0.028032f, 0.019117f, -0.266003f, -0.050854f, -0.066165f, 0.165419f, -0.100370f, -0.089722f, -0.158612f, -0.116867f, -0.099100f, 0.136638f, 0.037514f, 0.152795f, 0.262828f, -0.099031f, 0.081770f, -0.090351f, 0.203327f, 0.097446f, 0.002414f, 0.033932f, 0.084142f, -0.050991f, -0.068045f, 0.195249f, 0.124966f, -0.047290f, -0.045503f, 0.098305f, -0.051415f, -0.092380f, 0.227298f, -0.125686f, 0.016231f, 0.142480f, 0.087285f, -0.049698f, 0.061691f, 0.053999f, -0.036702f, -0.165227f, 0.186064f, -0.043190f, -0.292674f, 0.081683f, 0.046562f, -0.073707f, 0.099899f, 0.226520f, -0.087726f, -0.122488f, 0.118741f, -0.063997f, -0.066988f, 0.221618f, 0.064100f, 0.102869f, -0.092409f, 0.170263f, -0.025962f, 0.171048f, 0.069043f, 0.053572f, -0.098286f, -0.148357f, 0.155265f, 0.164146f, -0.087370f, 0.157754f, 0.084302f, 0.035140f, -0.169400f, -0.162387f, 0.173037f, 0.145759f, 0.131175f, 0.186649f, 0.208166f, -0.029171f, -0.065358f, 0.091287f, 0.046295f, 0.220334f, -0.174865f, 0.008531f, 0.102205f, -0.075197f, -0.049717f, 0.085100f, 0.096273f, 0.143382f, -0.147375f, 0.171307f, 0.218438f, 0.128085f, -0.088144f, -0.084847f, 0.115676f, 0.107240f, 0.138805f, -0.120014f, -0.077943f, -0.212163f, -0.247677f, -0.059384f, -0.123847f, -0.095046f, -0.012670f, -0.203912f, -0.183907f, -0.139794f, -0.162568f, 0.011423f, 0.121472f, 0.152873f, -0.070421f, 0.024017f, 0.110735f, -0.198295f, 0.116505f, 0.092251f, -0.194989f, 0.116615f, 0.107959f, -0.126925f, 0.004548f, 0.180284f, 0.121065f, 0.060789f, -0.200564f, -0.170162f, 0.002454f, 0.191380f, 0.145717f, -0.128709f, -0.151753f, -0.087285f, -0.083149f, -0.117905f, -0.163561f, -0.073007f, -0.186671f, 0.139691f, 0.015623f, 0.010242f, 0.143330f, 0.146761f, -0.087449f, 0.078111f, 0.152516f, 0.005806f, -0.184772f, 0.025231f, -0.160451f, -0.115563f, 0.042740f, -0.123625f, 0.033907f, -0.056748f, 0.048450f, -0.128105f, -0.071243f, 0.090071f, 0.158652f, -0.060660f, -0.039768f, -0.137869f, 0.012765f, -0.217185f, -0.060403f, -0.021256f, 0.065179f, 0.138909f, 0.011662f, 0.063836f, -0.172974f, -0.121419f, 0.147594f, -0.034636f, 0.113748f, 0.112084f, 0.026969f, 0.054630f, -0.142664f, -0.128251f, 0.227940f, 0.059353f, 0.150991f, -0.097635f, -0.022673f, 0.104723f, -0.321068f, -0.020324f, 0.004574f, -0.026095f, 0.033254f, -0.117275f, -0.270262f, -0.046671f, 0.109173f, 0.127064f, 0.107569f, 0.129734f, 0.388554f, -0.121219f, 0.144651f, -0.139250f, 0.035712f, 0.149911f, -0.080407f, -0.088920f, -0.250078f, 0.135579f, -0.095219f, 0.104539f, 0.114469f, -0.065446f, -0.047776f, 0.020875f, -0.131093f, -0.011815f, -0.118401f, 0.180786f, -0.059816f, -0.031168f, -0.073220f, 0.056759f, -0.058735f, -0.021329f, 0.184691f, -0.069690f, 0.136897f, 0.033313f, -0.100858f, -0.167630f, -0.090545f, -0.189534f, -0.161125f, -0.023977f, -0.036884f, 0.125013f, 0.112142f, -0.152677f, 0.278134f, -0.110825f, 0.145473f, 0.222600f, 0.086299f, 0.015065f, 0.159982f, 0.157161f, -0.109835f, -0.290207f, 0.013326f, 0.170122f, -0.066847f, -0.022092f, 0.154780f, 0.231537f, -0.102859f, 0.183354f, 0.109349f, 0.121200f, -0.085708f, 0.096154f, -0.074204f, 0.098275f, -0.193464f, -0.181755f, -0.023888f, -0.166072f, -0.147076f, 0.196882f, -0.113745f, -0.137991f, 0.094792f, -0.137581f, -0.230019f, -0.123801f, -0.042308f, 0.067043f, -0.030833f, 0.129903f, 0.058009f, -0.112679f, -0.072291f, 0.205098f, 0.056904f, -0.076959f, -0.149995f, -0.433190f, 0.161756f, -0.066763f, 0.088443f, -0.142860f, -0.219802f, 0.138146f, 0.238794f, -0.037950f, -0.091543f, 0.205089f, -0.112923f, 0.152354f, -0.119743f, 0.002236f, -0.468160f, 0.107690f, 0.111270f, -0.126075f, -0.102277f, -0.140234f, 0.213570f, 0.024785f, 0.149064f, 0.131871f, -0.056320f, -0.101230f, 0.060603f, -0.210322f, 0.116484f, 0.192917f, 0.181161f, -0.162090f, 0.327630f, -0.062783f, -0.026120f, 0.204648f, 0.230542f, -0.035521f, 0.150270f, 0.360445f, -0.007542f, -0.144825f, 0.032385f, -0.038426f, 0.185034f, -0.039456f, -0.062148f, 0.172376f, 0.079991f, 0.211824f, 0.118893f, 0.008043f, 0.025653f, 0.186032f, -0.164626f, 0.147697f, -0.037012f, -0.053436f, 0.066877f, 0.095869f, -0.414221f, 0.011404f, 0.070745f, 0.064233f, -0.126091f, 0.036170f, -0.088315f, 0.152948f, -0.080135f, -0.009150f, -0.106306f, 0.201052f, 0.192819f, -0.087564f, 0.158841f, 0.112647f, -0.059655f, 0.163157f, -0.038251f, -0.206730f, -0.180397f, -0.094513f, -0.235931f, -0.119093f, -0.152928f, -0.038824f, 0.085051f, 0.012673f, 0.044965f, 0.123817f, 0.018135f, 0.069904f, 0.128868f, -0.068338f, -0.248015f, 0.165597f, 0.151235f, -0.079242f, 0.123176f, 0.075389f, 0.065262f, -0.031782f, 0.012829f, -0.159614f, 0.088238f, -0.301953f, 0.157865f, -0.143555f, -0.155786f, 0.214664f, 0.220736f, -0.068177f, 0.244189f, 0.150870f, 0.137141f, 0.142053f, -0.121996f, 0.057784f, 0.045783f, 0.473410f, -0.130509f, -0.473276f, -0.220402f, 0.073453f, -0.121471f, 0.027542f, 0.101192f, -0.005532f, 0.166192f, -0.178546f, -0.215894f, -0.133390f, -0.291018f, 0.060278f, 0.014375f, -0.103321f, -0.164389f, 0.200355f, 0.118467f, 0.111815f, -0.218495f, -0.000203f, 0.093188f, -0.206342f, 0.139919f, -0.438289f, -0.000681f, 0.325102f, -0.225355f, 0.054793f, -0.116763f, 0.109216f, -0.064318f, 0.212373f, -0.235705f, 0.166967f, 0.182306f, 0.132187f, -0.327380f, 0.141398f, -0.070578f, 0.238160f, -0.505630f, -0.407642f, 0.067300f, -0.571694f, -0.398894f, -0.130636f, -0.026938f, -0.015936f, 0.208301f, -0.202581f, 0.226056f, -0.191725f, -0.011140f, 0.139402f, 0.103320f, -0.142515f, -0.323043f, -0.191901f, 0.016696f, 0.116334f, -0.118176f, 0.117328f, 0.173371f, 0.212456f, -0.357221f, 0.240671f, -0.099054f, 0.114668f, -0.145782f, -0.544078f, 0.036961f, -0.008822f, -0.085418f, -0.035552f, 0.089909f, 0.069690f, 0.009396f, 0.108377f, -0.090184f, -0.368812f, -0.089356f, -0.325190f, 0.093163f, 0.007662f, 0.000672f, 0.242805f, -0.137385f, -0.005081f, -0.032275f, -0.243394f, -0.205212f, -0.061483f, -0.203261f, 0.082891f, 0.045767f, 0.077039f, -0.225154f, -0.199585f, 0.297378f, 0.106791f, 0.043146f, -0.225952f, 0.041445f, 0.119279f, -0.194888f, -0.111186f, -0.065551f, -0.018327f, -0.087274f, -0.209989f, -0.156798f, 0.031295f, -0.058959f, 0.272020f, 0.070219f, -0.245041f, 0.139674f, -0.272433f, 0.023559f, -0.172617f, 0.137246f, 0.049776f, 0.082208f, -0.029144f, 0.227547f, 0.019806f, -0.014525f, -0.227528f, -0.152587f, -0.132964f, -0.070403f, 0.225904f, -0.029415f, 0.119308f, -0.086509f, 0.229309f, -0.055854f, 0.096426f, -0.092986f, 0.032753f, -0.115280f, -0.267235f, -0.139681f, 0.311457f, 0.182291f, -0.043393f, 0.079403f, 0.043268f, -0.145469f, 0.076064f, 0.042797f, 0.035813f, 0.025172f, -0.038733f, -0.049370f, -0.109937f, -0.022046f, -0.138616f, 0.035221f, -0.128935f, -0.043814f, -0.083898f, -0.111673f, -0.027982f, -0.004964f, 0.384415f, -0.220469f, 0.179056f, -0.223445f, -0.231875f, 0.005135f, 0.118184f, 0.124114f, 0.074341f, 0.185558f, -0.091139f, -0.126521f, 0.092723f, -0.028389f, 0.092648f, -0.364280f, 0.119829f, 0.073495f, -0.012929f, -0.039716f, -0.028277f, -0.113816f, 0.083137f, 0.090656f, 0.152006f, -0.097335f, 0.140461f, -0.098586f, -0.263729f, 0.044281f, -0.180417f, -0.108832f, -0.431838f, 0.057155f, -0.361849f, -0.181961f, -0.307670f, -0.150431f, 0.230067f, 0.196610f, 0.078204f, -0.103293f, 0.074666f, -0.014301f, -0.233103f, 0.010752f, 0.122965f, -0.431919f, -0.065186f, -0.042456f, -0.123097f, -0.150446f, -0.207998f, -0.048733f, -0.001513f, -0.216577f, -0.070169f, 0.270101f, -0.177545f, -0.348186f, -0.140584f, -0.094757f, -0.117378f, -0.004968f, 0.232183f, 0.012699f, -0.035538f, 0.002922f, -0.022426f, -0.021751f, 0.022886f, -0.007375f, 0.146491f, 0.199662f, -0.144757f, -0.138478f, -0.291854f, 0.180340f, -0.204912f, -0.117687f, 0.066940f, 0.249588f, 0.063915f, 0.450631f, -0.012806f, -0.185812f, 0.182978f, 0.004897f, 0.109465f, 0.007438f, -0.086685f, -0.412626f, -0.149662f, -0.071275f, -0.181645f, 0.052026f, -0.186669f, 0.095569f, 0.074149f, -0.554153f, 0.053698f, -0.186820f, -0.131322f, 0.233688f, -0.000950f, 0.223242f, -0.228011f, 0.030297f, 0.217525f, 0.236397f, -0.064505f, -0.131103f, -0.280321f, -0.036367f, -0.134882f, -0.011785f, -0.085430f, 0.338558f, 0.195172f, -0.009086f, -0.077281f, -0.155151f, -0.068009f, 0.160487f, -0.040260f, 0.009864f, 0.150557f, 0.138116f, 0.042924f, 0.159002f, -0.195366f, -0.076572f, 0.078630f, -0.097486f, 0.001545f, 0.041532f, 0.002803f, 0.249965f, -0.181361f, 0.043960f, 0.085671f, -0.020572f, -0.183502f, -0.256414f, -0.045218f, -0.239290f, -0.002795f, -0.008665f, -0.160035f, -0.218803f, 0.004075f, -0.059603f, 0.065600f, 0.142304f, -0.387851f, -0.293120f, -0.179108f, 0.029705f, -0.093715f, 0.117539f, 0.123682f, 0.181879f, -0.095327f, 0.026340f, 0.014533f, -0.031722f, 0.165628f, 0.029945f, -0.110982f, -0.156519f, 0.057412f, 0.089180f, -0.150446f, -0.295609f, 0.158426f, -0.073202f, 0.183046f, -0.138265f, -0.176847f, -0.043880f, 0.045882f, 0.110532f, -0.010023f, 0.168419f, 0.037767f, 0.001887f, -0.060232f, 0.072564f, -0.039233f, 0.202151f, 0.150449f, 0.019252f, -0.111966f, -0.019819f, -0.028583f, -0.123320f, 0.106113f, -0.185331f, 0.166057f, -0.050459f, -0.015498f, 0.162498f, 0.154345f, -0.018564f, 0.152842f, -0.090797f, 0.056227f, 0.004829f, -0.117089f, 0.121855f, -0.215689f, 0.033018f, -0.047180f, 0.210636f, -0.125596f, 0.119242f, 0.144488f, 0.085865f, -0.052375f, -0.017252f, -0.073851f, -0.068025f, 0.041593f, -0.030486f, -0.128443f, 0.171612f, -0.221298f, 0.058014f, -0.069863f, -0.002022f, 0.068475f, 0.169293f, 0.298191f, -0.070171f, -0.308374f, -0.157090f, 0.093270f, 0.024685f, 0.040119f, -0.029095f, 0.075054f, -0.122059f, 0.056233f, -0.087994f, -0.006753f, -0.057622f, 0.103196f, 0.033961f, 0.008479f, -0.046895f, 0.192067f, -0.059492f, 0.022158f, -0.111193f, -0.084782f, 0.022197f, 0.005138f, 0.107066f, -0.187614f, 0.074950f, -0.302627f, -0.150317f, 0.062748f, 0.099522f, 0.042010f, 0.206164f, -0.036479f, -0.339388f, -0.090536f, -0.008622f, -0.188392f, -0.076413f, 0.342014f, 0.167487f, -0.012160f, 0.140076f, -0.135546f, -0.056397f, -0.017236f, -0.217335f, 0.066311f, -0.004292f, -0.190371f, 0.204790f, -0.005782f, -0.071494f, 0.004244f, -0.326197f, -0.195018f, 0.189513f, 0.327792f, 0.041561f, 0.014040f, -0.047440f, -0.157317f, 0.075390f, -0.226097f, 0.160407f, -0.179099f, -0.269792f, -0.137251f, -0.123601f, -0.149954f, 0.237918f, 0.153933f, 0.149550f, -0.236139f, 0.114544f, 0.017009f, 0.094170f, -0.045795f, -0.045261f, -0.011987f, 0.051311f, -0.213576f, -0.027076f, -0.150594f, -0.104580f, -0.049795f, 0.173124f, 0.190077f, -0.093814f, -0.066769f, 0.316044f, 0.059840f, 0.150869f, -0.171453f, 0.124954f, -0.204379f, 0.117341f, 0.177934f, -0.151843f, -0.100821f, -0.206550f, -0.089549f, -0.149605f, 0.175896f, -0.038748f, 0.006879f, -0.312280f, 0.143884f, -0.200426f, 0.018378f, 0.110463f, -0.011156f, 0.135389f, -0.071251f, -0.028301f, 0.044986f, 0.051053f, 0.110125f, 0.135579f, -0.008545f, -0.126737f, 0.030953f, -0.012935f, -0.078131f, -0.110915f, -0.079886f, 0.143691f, -0.035700f, -0.133095f, -0.108652f, 0.110252f, -0.087436f, 0.053538f, -0.079650f, 0.130991f, -0.009654f, 0.105766f, 0.258201f, 0.159355f, 0.194534f, 0.105618f, -0.096225f, 0.117490f, 0.121107f, -0.089162f, -0.320073f, -0.188109f, -0.262188f, -0.021523f, 0.066768f, 0.066318f, 0.010496f, 0.060065f, -0.108350f, -0.085494f, -0.102579f, -0.048199f, 0.025468f, 0.082453f, 0.339638f, 0.050444f, -0.148239f, -0.054833f, 0.208846f, 0.064020f, -0.133346f, -0.201465f, -0.019286f, 0.170223f, -0.087397f, -0.115809f, -0.019002f, 0.196605f, -0.133184f, 0.198542f, 0.132878f, -0.076056f, -0.194044f, -0.076366f, 0.084176f, -0.312083f, 0.190998f, -0.206695f, 0.194836f, -0.014854f, 0.103991f, -0.357369f, 0.191223f, 0.079893f, 0.161618f, -0.023708f, -0.107606f, 0.045004f, -0.124731f, 0.126740f, -0.046969f, 0.022616f, -0.028266f, -0.201738f, -0.256155f, 0.061671f, -0.361984f, 0.075733f, -0.006612f, -0.229244f, -0.150299f, 0.251675f, 0.162407f, 0.181223f, -0.031706f, -0.083603f, 0.164288f, -0.108607f, 0.208177f, -0.048891f, 0.077871f, -0.112342f, -0.007491f, -0.178071f, 0.069838f, 0.159413f, -0.066583f, 0.091453f, -0.092136f, 0.089553f, -0.246387f, -0.105080f, -0.088579f, 0.092478f, 0.247804f, 0.101926f, 0.112299f, 0.171505f, -0.046211f, 0.178520f, 0.089364f, 0.158644f, 0.001572f, 0.092213f, 0.324747f, 0.172367f, -0.116537f, -0.122697f, 0.186232f, -0.037286f, 0.178548f, 0.047905f, 0.167672f, -0.135252f, 0.101991f, -0.011455f, -0.125871f, -0.011104f, 0.175168f, -0.070269f, -0.116401f, -0.148055f, -0.154582f, 0.191270f, 0.079028f, -0.152183f, 0.001225f, -0.181157f, 0.093808f, 0.169748f, -0.004552f, -0.027950f, 0.114668f, -0.041953f, 0.145009f, -0.037068f, 0.194087f, 0.013254f, -0.054208f, 0.097617f, -0.098950f, 0.110382f, 0.194253f, 0.086728f, -0.074011f, -0.172694f, -0.202752f, -0.269374f, 0.159093f, -0.203782f, 0.017521f, 0.096749f, 0.200737f, 0.047433f, -0.073257f, 0.202366f, 0.131376f, -0.148140f, -0.118341f, -0.228099f, -0.124942f, 0.193623f, 0.155580f, -0.083826f, -0.019278f, -0.047298f, 0.144839f, 0.111931f, -0.040225f, -0.108726f, -0.295017f, -0.076629f, 0.018914f, 0.215834f, 0.210679f, 0.165996f, -0.140957f, 0.196856f, 0.120467f, 0.086021f, 0.029897f, -0.033180f, 0.106311f, -0.065234f, 0.294294f, -0.115405f, -0.074704f, -0.130792f, -0.138396f, 0.069787f, 0.097922f, 0.058747f, 0.098220f, -0.206000f, 0.111448f, 0.084432f, 0.103009f, -0.033575f, -0.162751f, -0.094250f, -0.179908f, -0.125108f, -0.046846f, 0.185462f, 0.133014f, -0.257995f, -0.075050f, -0.202004f, 0.091571f, -0.066022f, 0.028136f, -0.262394f, -0.200409f, -0.213030f, 0.232690f, -0.039227f, 0.014601f, -0.053792f, 0.043351f, -0.275935f, 0.148331f, -0.086830f, -0.033485f, -0.216207f, -0.220159f, -0.090528f, 0.176486f, 0.120194f, -0.166142f, -0.100748f, 0.161756f, -0.098057f, 0.139267f, -0.099184f, -0.143242f, 0.016881f, 0.031777f, -0.232593f, 0.222715f, -0.161916f, 0.161580f, 0.142184f, 0.025124f, -0.048427f, -0.187621f, 0.081824f, -0.210303f, -0.128312f, 0.035878f, -0.188118f, -0.001123f, -0.335589f, -0.287944f, 0.056955f, 0.157024f, 0.116151f, 0.042180f, -0.012263f, -0.048652f, 0.017385f, 0.128205f, -0.203830f, 0.005880f, -0.017963f, 0.311538f, -0.069773f, 0.060171f, -0.268760f, -0.126731f, -0.133847f, 0.014018f, 0.178553f, 0.003960f, -0.077711f, 0.028692f, 0.062463f, -0.223460f, 0.178960f, -0.114651f, -0.148381f, -0.027881f, -0.040522f, -0.037381f, 0.169634f, -0.065257f, -0.186709f, 0.073557f, -0.242951f, -0.031147f, 0.236213f, -0.069919f, -0.263070f, -0.003286f, 0.027110f, -0.046810f, 0.051861f, 0.159295f, 0.223690f, 0.114485f, -0.131739f, -0.004738f, -0.000163f, 0.051626f, 0.205865f, -0.315580f, -0.131481f, -0.317958f, -0.261903f, -0.428670f, -0.262660f, 0.231722f, 0.269910f, 0.010996f, 0.051258f, -0.247229f, -0.020136f, -0.056812f, -0.085071f, -0.086410f, -0.259861f, 0.175557f, 0.107508f, -0.120873f, -0.116456f, 0.092637f, -0.066636f, 0.031443f, 0.117553f, 0.185532f, -0.217394f, -0.257665f, -0.262897f, -0.111580f, 0.083985f, -0.025016f, 0.079161f, 0.081036f, 0.184867f, -0.037567f, -0.051848f, 0.187925f, -0.033315f, 0.254071f, -0.050063f, 0.200216f, -0.013989f, -0.281711f, -0.125455f, -0.283800f, -0.134460f, 0.173903f, 0.058262f, 0.065501f, 0.109179f, 0.158449f, -0.264141f, 0.148492f, -0.030311f, 0.059839f, 0.005597f, -0.171356f, 0.085110f, 0.095410f, -0.097901f, 0.089204f, -0.120633f, 0.113923f, -0.123783f, 0.115494f, 0.070065f, 0.205705f, -0.042604f, -0.010132f, -0.025391f, 0.018726f, 0.012773f, -0.077642f, 0.100359f, 0.127058f, -0.226462f, -0.027456f, -0.019168f, 0.154510f, 0.122560f, -0.324421f, -0.000251f, -0.383526f, 0.017972f, -0.025213f, -0.237199f, -0.043678f, 0.174921f, -0.031073f, -0.045353f, -0.073881f, 0.012357f, -0.153797f, -0.197250f, -0.114482f, -0.087787f, -0.009783f, 0.131839f, -0.214623f, -0.135602f, -0.025585f, 0.048782f, -0.170997f, -0.108895f, 0.019743f, -0.032197f, -0.228051f, -0.230863f, -0.038841f, -0.088144f, -0.107531f, -0.079193f, -0.069838f, 0.380802f, 0.043238f, -0.010479f, -0.075019f, 0.017824f, 0.093665f, -0.125680f, 0.177186f, 0.060833f, -0.261412f, -0.097393f, 0.017883f, -0.184379f, -0.039118f, 0.211971f, 0.134031f, 0.085042f, -0.076123f, 0.098408f, -0.113816f, 0.080366f, -0.124444f, 0.078977f, 0.011414f, -0.006911f, -0.139051f, -0.175289f, -0.064044f, -0.100678f, 0.146087f, 0.035844f, 0.036272f, -0.068602f, -0.096493f, -0.041273f, -0.083334f, -0.208474f, 0.083379f, -0.016299f, 0.080987f, 0.131202f, 0.093247f, 0.129963f, -0.067906f, 0.152166f, 0.034733f, 0.159052f, -0.037230f, 0.060798f, 0.127202f, -0.106381f, -0.188708f, 0.155282f, 0.123466f, 0.110931f, -0.099251f, -0.072968f, 0.059901f, -0.074156f, -0.042920f, -0.038588f, 0.126478f, -0.155273f, 0.025738f, 0.118699f, -0.075754f, 0.127374f, -0.045240f, -0.099332f, 0.079984f, -0.072973f, -0.155061f, 0.002346f, -0.259981f, -0.236122f, -0.095547f, -0.045596f, -0.015679f, 0.240944f, -0.133636f, 0.305407f, -0.172209f, 0.037117f, 0.189298f, 0.094884f, 0.201156f, 0.104381f, 0.132603f, 0.131050f, 0.047767f, -0.017872f, -0.034907f, -0.040838f, 0.007597f, -0.164459f, 0.039741f, 0.161125f, 0.011176f, 0.140878f, -0.124080f, 0.146989f, 0.171615f, -0.044911f, -0.073269f, -0.001281f, 0.026896f, 0.112210f, -0.136155f, -0.070482f, -0.125440f, -0.070417f, 0.013023f, 0.010883f, -0.063852f, -0.022654f, -0.217710f, -0.165082f, 0.125399f, -0.126974f, 0.084173f, -0.124178f, -0.015961f, -0.034021f, 0.026262f, -0.213808f, -0.224889f, -0.106944f, -0.193542f, -0.074644f, -0.002366f, -0.053388f, 0.003824f, 0.113155f, -0.134326f, -0.163435f, 0.134481f, -0.166848f, -0.083579f, -0.184858f, 0.103159f, -0.186871f, -0.007006f, 0.134186f, -0.101434f, 0.174552f, -0.136310f, -0.115468f, 0.067107f, -0.100734f, -0.052199f, -0.034547f, 0.023380f, -0.139397f, -0.038259f, -0.110180f, -0.073688f, 0.139321f, -0.115965f, -0.020723f, 0.028177f, -0.038240f, 0.011310f, 0.077829f, 0.099500f, -0.119236f, 0.163521f, 0.035723f, -0.082524f, -0.205500f, 0.155639f, -0.101098f, -0.125683f, -0.174039f, -0.199450f, 0.075806f, -0.037256f, 0.156191f, -0.102975f, 0.191647f, -0.157666f, -0.131310f, -0.126697f, -0.114022f, 0.048267f, 0.081665f, 0.222814f, 0.192659f, -0.027854f, 0.345706f, -0.152524f, 0.432267f, 0.017520f, -0.018343f, -0.177452f, 0.271549f, 0.146883f, 0.098018f, 0.091539f, 0.047570f, -0.071074f, -0.076432f, -0.145170f, 0.247524f, 0.009179f, 0.160586f, 0.139098f, -0.080477f, 0.585679f, 0.192109f, 0.431328f, 0.062934f, -0.000760f, 0.165180f, 0.184060f, -0.121443f, -0.038346f, -0.131766f, 0.136919f, -0.021467f, 0.069660f, 0.025392f, -0.125077f, 0.284888f, -0.028696f, 0.149873f, 0.068262f, -0.085246f, -0.039474f, -0.050194f, -0.083541f, 0.044921f, 0.213296f, -0.105483f, 0.228507f, 0.083161f, 0.076906f, 0.076794f, 0.176500f, -0.020338f, -0.160391f, -0.303192f, 0.133223f, -0.079585f, 0.025001f, 0.047369f, 0.218925f, -0.113437f, -0.233176f, 0.069054f, 0.263066f, 0.248304f, -0.029336f, -0.058553f, 0.212374f, -0.025096f, 0.094453f, -0.147575f, 0.066937f, -0.160749f, -0.037717f, -0.130246f, 0.171080f, -0.034970f, -0.116762f, -0.004765f, -0.349786f, 0.149942f, 0.151370f, -0.414125f, 0.223400f, -0.368568f, -0.152262f, 0.149575f, 0.123996f, -0.192026f, -0.283200f, 0.055221f, 0.173182f, 0.197646f, 0.157323f, -0.011341f, -0.350733f, 0.110164f, -0.008689f, 0.173914f, -0.162161f, -0.327895f, -0.415561f, 0.230036f, -0.359613f, -0.087005f, -0.280593f, -0.413215f, 0.046357f, 0.203091f, 0.095909f, -0.066810f, -0.122609f, 0.132363f, 0.071591f, -0.008110f, 0.181688f, -0.415173f, -0.262355f, 0.040186f, -0.209257f, 0.137672f, -0.196073f, -0.067853f, 0.072060f, -0.262595f, -0.408593f, -0.086776f, -0.160523f, -0.384718f, 0.185294f, -0.141702f, -0.071668f, 0.104314f, -0.311496f, -0.160892f, -0.084421f, 0.184544f, 0.010127f, -0.003979f, -0.071152f, 0.110283f, -0.336820f, -0.019204f, -0.063699f, -0.213852f, -0.073178f, -0.006121f, -0.256333f, 0.114526f, 0.004676f, 0.129825f, -0.099715f, -0.009478f, 0.015846f, 0.165042f, -0.019526f, 0.105437f, -0.158788f, -0.040581f, 0.161198f, 0.102761f, 0.081417f, 0.153043f, 0.169761f, -0.170282f, 0.047566f, -0.011807f, 0.114438f, -0.040463f, -0.049335f, 0.080950f, -0.033365f, 0.025519f, 0.047568f, 0.161177f, 0.187806f, -0.115710f, 0.055561f, -0.024981f, -0.166906f, 0.051905f, -0.537499f, -0.046270f, -0.387271f, -0.268359f, 0.172218f, -0.174049f, -0.134230f, -0.013820f, 0.010867f, 0.105318f, 0.017505f, -0.153554f, -0.154971f, -0.041993f, 0.162334f, -0.056504f, -0.049630f, 0.023087f, 0.173796f, 0.003206f, -0.095767f, 0.014095f, -0.124684f, 0.031465f, -0.071396f, -0.259893f, -0.113329f, -0.048277f, -0.238243f, 0.168876f, 0.125054f, 0.312636f, -0.133265f, 0.087270f, 0.121040f, 0.101799f, 0.070561f, -0.008746f, -0.043873f, 0.101968f, 0.353148f, 0.022582f, 0.022870f, -0.142375f, -0.033811f, 0.145504f, 0.036619f, -0.099775f, 0.083929f, -0.154210f, 0.193036f, -0.262647f, 0.080293f, 0.215388f, 0.097768f, 0.137281f, 0.128428f, -0.262531f, -0.076228f, -0.037532f, 0.046878f, -0.294910f, 0.055418f, -0.266482f, -0.108040f, -0.179917f, 0.006182f, -0.200224f, 0.095068f, 0.071439f, -0.036065f, 0.109616f, 0.109898f, -0.008469f, 0.011937f, -0.189544f, -0.020539f, 0.135062f, 0.160250f, 0.062768f, -0.162364f, -0.053949f, -0.276550f, -0.031708f, 0.029237f, 0.039315f, 0.025589f, 0.262596f, -0.093103f, 0.058058f, 0.226198f, -0.010587f, -0.144092f, -0.011978f, -0.114109f, -0.238668f, 0.012130f, -0.082635f, -0.129406f, 0.143837f, 0.140339f, 0.059208f, -0.203013f, 0.196752f, 0.002050f, 0.044519f, -0.331845f, 0.050230f, -0.227373f, 0.186914f, -0.064553f, 0.230623f, -0.113833f, 0.301065f, -0.102330f, -0.169196f, 0.160491f, 0.040413f, 0.195256f, -0.109204f, 0.315274f, -0.053829f, 0.015183f, 0.130540f, 0.186140f, 0.189653f, 0.134768f, -0.204464f, -0.121949f, -0.044818f, -0.128997f, 0.174666f, 0.129761f, -0.189766f, -0.141807f, -0.063411f, 0.065737f, -0.115182f, -0.056303f, -0.087484f, -0.046083f, 0.075163f, -0.101113f, -0.116526f, -0.040326f, -0.103213f, 0.072000f, -0.122673f, 0.125303f, -0.016318f, -0.136011f, -0.175379f, -0.098120f, 0.055480f, 0.136662f, 0.104692f, -0.052131f, -0.111120f, 0.120318f, -0.186442f, -0.062458f, 0.043949f, 0.120640f, -0.198469f, -0.084268f, -0.076574f, 0.105698f, 0.137737f, -0.082701f, -0.100876f, 0.112708f, -0.161203f, -0.132180f, -0.147010f, 0.074138f, 0.187164f, -0.002328f, 0.100056f, 0.006860f, -0.023148f, 0.102020f, -0.054766f, -0.020512f, 0.053276f, -0.034392f, -0.082781f, -0.152806f, -0.111216f, -0.162111f, -0.082002f, -0.205948f, -0.323577f, 0.055277f, 0.121645f, 0.013154f, -0.169018f, -0.096760f, -0.085005f, -0.046763f, 0.093295f, 0.018422f, -0.226314f, 0.143348f, -0.206787f, -0.050157f, 0.072676f, 0.119933f, 0.029197f, 0.147869f, -0.078633f, -0.132114f, -0.167088f, -0.229913f, 0.099753f, -0.186146f, -0.002412f, 0.179189f, 0.075331f, 0.017129f, -0.116040f, -0.235984f, 0.004463f, -0.012912f, -0.140113f, 0.000548f, 0.088952f, -0.018875f, -0.221603f, 0.178998f, -0.134990f, -0.000324f, -0.202340f, -0.059983f, -0.252762f, 0.099569f, -0.190004f, -0.148240f, 0.175425f, -0.089434f, -0.344366f, 0.197597f, -0.192391f, 0.161177f, -0.365866f, -0.144195f, -0.093930f, -0.205767f, -0.245700f, -0.048573f, 0.197961f, 0.148759f, 0.108442f, -0.201919f, 0.149628f, -0.313844f, -0.258687f, 0.024295f, 0.056075f, -0.045431f, 0.084237f, -0.195740f, -0.089836f, -0.148069f, -0.025568f, -0.035187f, 0.179515f, 0.237740f, -0.226850f, 0.053609f, -0.057517f, 0.124780f, -0.030249f, -0.134544f, 0.091056f, 0.150165f, 0.136468f, 0.001427f, -0.168780f, 0.110456f, -0.117480f, 0.475758f, 0.013271f, 0.226665f, -0.091582f, -0.054528f, 0.190592f, -0.018042f, -0.293374f, 0.100784f, -0.159961f, -0.162457f, 0.057433f, 0.006021f, -0.041202f, -0.026867f, 0.031048f, 0.017600f, -0.109639f, 0.169660f, -0.150183f, -0.280643f, 0.167345f, -0.123178f, 0.279613f, -0.064970f, -0.038116f, -0.060516f, 0.186829f, -0.211842f, -0.060650f, -0.168082f, -0.114407f, -0.027788f, 0.070479f, -0.181233f, -0.224929f, -0.175868f, 0.045612f, 0.031306f, 0.086171f, 0.336306f, -0.119585f, 0.289003f, 0.060590f, -0.073827f, 0.117111f, 0.027333f, -0.171304f, 0.141871f, 0.012843f, 0.042726f, 0.121414f, 0.145283f, 0.118876f, 0.129140f, -0.378651f, -0.181286f, 0.139585f, 0.139811f, 0.238548f, -0.154748f, 0.050721f, -0.018274f, 0.129485f, -0.006768f, -0.108775f, -0.171579f, -0.115062f, 0.115078f, -0.133282f, 0.533517f, -0.377787f, 0.066003f, -0.167575f, -0.185459f, -0.157521f, -0.050680f, -0.215599f, 0.072040f, 0.150877f, 0.128342f, -0.133800f, -0.280543f, -0.008519f, -0.172703f, -0.057165f, 0.089412f, 0.067073f, -0.001259f, 0.120424f, 0.121769f, 0.020416f, 0.019600f, -0.183582f, -0.170642f, 0.057351f, -0.029215f, 0.071101f, 0.204214f, -0.187348f, 0.094952f, -0.013950f, -0.065842f, -0.004035f, 0.058122f, 0.032255f, 0.005823f, 0.417374f, -0.199819f, 0.180423f, 0.147975f, -0.137771f, -0.059735f, 0.011103f, -0.104907f, 0.133295f, 0.093553f, 0.048541f, -0.135438f, 0.149331f, 0.173692f, 0.118355f, -0.116747f, 0.324494f, 0.130442f, -0.041322f, -0.079858f, 0.217274f, -0.121556f, -0.133892f, 0.070749f, 0.018514f, -0.052128f, 0.204701f, 0.009574f, 0.114459f, 0.124431f, -0.028286f, 0.277631f, -0.019672f, -0.117449f, 0.143283f, 0.195806f, 0.082921f, -0.059754f, -0.020046f, 0.020706f, 0.079480f, -0.123566f, 0.060252f, 0.114268f, -0.026406f, 0.113335f, -0.305891f, -0.030894f, 0.118837f, -0.051242f, -0.129142f, -0.165659f, -0.054474f, -0.003422f, 0.007733f, 0.141672f, 0.304376f, -0.083312f, -0.063428f, 0.061228f, -0.119109f, -0.041550f, -0.124875f, 0.216776f, 0.072682f, 0.180547f, 0.132692f, -0.180484f, 0.165177f, 0.052667f, 0.018490f, 0.071556f, -0.064934f, -0.084929f, -0.349667f, 0.071535f, -0.137324f, 0.113143f, -0.083038f, -0.149172f, -0.437050f, 0.060182f, 0.182253f, 0.195846f, 0.092858f, 0.083665f, 0.276798f, 0.083389f, 0.078440f, 0.106757f, -0.116583f, -0.125599f, 0.050776f, -0.498433f, -0.179864f, -0.343341f, -0.046459f, 0.181497f, -0.210624f, 0.039934f, -0.051501f, 0.161848f, -0.023032f, -0.060325f, -0.079020f, -0.045058f, -0.159582f, 0.205649f, 0.025906f, -0.017232f, 0.017248f, 0.018685f, -0.071911f, 0.208141f, 0.121455f, -0.065808f, -0.154402f, -0.035661f, -0.024721f, -0.311452f, -0.065735f, -0.302013f, 0.088342f, -0.044009f, 0.196513f, -0.021143f, 0.316905f, -0.041748f, 0.080144f, 0.263373f, 0.205440f, 0.170308f, 0.202117f, 0.247560f, 0.167668f, -0.109713f, -0.224691f, -0.053084f, 0.177279f, 0.001903f, 0.134112f, -0.024490f, -0.075657f, 0.191193f, 0.054386f, 0.148503f, -0.009241f, 0.188844f, 0.014693f, 0.071492f, 0.023755f, 0.138085f, 0.080692f, 0.033821f, 0.150027f, -0.142813f, 0.043032f, -0.125149f, -0.113502f, 0.139368f, -0.032600f, -0.058277f, -0.075246f, 0.132149f, -0.206946f, 0.085466f, 0.184273f, 0.116724f, 0.110893f, 0.183811f, -0.114553f, -0.096552f, -0.192218f, 0.035810f, -0.015307f, -0.126039f, -0.036186f, -0.051631f, -0.117497f, 0.088405f, 0.059872f, -0.013944f, -0.205954f, 0.159502f, -0.102361f, -0.041184f, -0.226275f, 0.190182f, -0.265232f, 0.186068f, -0.103733f, -0.098117f, 0.163261f, 0.089242f, 0.080575f, -0.129066f, 0.000908f, 0.001307f, -0.295511f, -0.206502f, -0.033675f, -0.075882f, 0.084555f, -0.074424f, 0.123818f, 0.077761f, 0.280429f, -0.194675f, -0.096678f, -0.156760f, -0.095144f, 0.005133f, 0.153736f, 0.293406f, 0.136992f, -0.118506f, -0.155852f, 0.141659f, -0.114967f, 0.119107f, -0.130842f, 0.288727f, 0.139526f, 0.186525f, -0.037602f, -0.025527f, 0.162113f, -0.183214f, 0.177223f, -0.160226f, -0.264611f, -0.020002f, 0.089778f, 0.146577f, -0.256262f, 0.194212f, -0.072592f, 0.180212f, 0.033629f, -0.158027f, -0.118210f, -0.079588f, 0.037984f, 0.043607f, 0.006437f, -0.000491f, 0.190134f, 0.052388f, -0.151628f, 0.082258f, 0.123957f, 0.067717f, 0.045387f, -0.232751f, 0.171657f, -0.088548f, -0.282969f, 0.115777f, -0.199206f, 0.149428f, 0.145419f, 0.183331f, -0.058701f, 0.151054f, -0.110836f, -0.062049f, 0.088120f, 0.198548f, -0.058103f, -0.155051f, -0.002775f, 0.123638f, -0.104438f, -0.134170f, -0.019192f, -0.018355f, 0.115349f, -0.136920f, -0.148380f, -0.140997f, 0.105071f, -0.148697f, -0.157935f, -0.131461f, 0.270855f, 0.018608f, 0.074667f, -0.130592f, 0.055178f, 0.163058f, 0.014038f, 0.013465f, 0.019382f, 0.067523f, -0.016717f, -0.257301f, -0.067442f, 0.116508f, -0.000125f, 0.022829f, -0.101403f, -0.051851f, 0.017594f, -0.191977f, 0.098750f, -0.029899f, 0.149799f, -0.139453f, 0.190067f, -0.049906f, -0.037233f, 0.031603f, -0.065057f, 0.001689f, 0.372462f, -0.063162f, 0.021404f, -0.063461f, -0.085524f, 0.159391f, 0.175551f, -0.031953f, 0.214759f, 0.034657f, 0.231848f, -0.264823f, -0.095777f, 0.067914f, 0.166081f, -0.007465f, 0.192078f, -0.117617f, -0.077660f, 0.082485f, 0.044963f, 0.107288f, 0.049822f, 0.043967f, 0.157009f, -0.082661f, 0.260650f, 0.111927f, 0.202494f, -0.144169f, -0.089350f, 0.101232f, 0.070156f, 0.154471f, 0.126386f, -0.044158f, 0.057762f, -0.007492f, 0.069200f, -0.041370f, 0.027925f, -0.052857f, 0.020433f, 0.217687f, 0.017616f, 0.260267f, 0.250226f, 0.015721f, -0.159018f, 0.105896f, 0.031418f, -0.025511f, -0.145599f, 0.183795f, -0.181508f, 0.066949f, 0.055606f, -0.257004f, -0.066299f, 0.227488f, -0.288415f, 0.133320f, 0.162820f, -0.073594f, -0.108895f, -0.065831f, 0.194254f, 0.067309f, 0.001216f, 0.123244f, -0.080475f, 0.147766f, 0.062922f, 0.184188f, -0.102272f, 0.145890f, -0.191911f, -0.009087f, -0.008049f, -0.068064f, -0.173209f, 0.163280f, -0.209831f, 0.137360f, -0.107856f, 0.187048f, -0.358170f, 0.052872f, -0.009975f, -0.009536f, -0.131165f, 0.213433f, 0.315979f, 0.183559f, -0.157837f, 0.074802f, 0.097848f, 0.172306f, -0.162437f, -0.347271f, 0.144778f, -0.107882f, -0.149542f, -0.191648f, -0.277244f, 0.169399f, 0.019930f, 0.176947f, -0.044308f, -0.059543f, 0.137653f, 0.082739f, -0.181775f, 0.124095f, -0.191744f, 0.060621f, 0.206924f, 0.141220f, -0.113013f, 0.027531f, 0.178208f, -0.188093f, -0.072831f, -0.034689f, -0.067263f, -0.240910f, -0.203050f, -0.142678f, 0.157213f, 0.053625f, 0.184978f, -0.106307f, 0.193842f, -0.197851f, 0.072808f, 0.083907f, -0.007834f, 0.216596f, 0.083875f, 0.274469f, 0.251438f, -0.130482f, -0.101960f, -0.046205f, 0.078392f, -0.075606f, -0.071407f, -0.111862f, -0.193397f, -0.114206f, 0.108785f, -0.130804f, -0.065591f, -0.065634f, 0.032493f, 0.038181f, -0.153169f, -0.158238f, 0.087906f, 0.128424f, 0.043092f, -0.162444f, 0.041709f, 0.175600f, -0.083440f, 0.193470f, 0.125837f, -0.171774f, -0.012872f, -0.145842f, -0.169299f, -0.068296f, 0.116815f, -0.040174f, 0.085052f, 0.094271f, -0.172943f, -0.133288f, 0.013216f, -0.079056f, 0.131298f, 0.095030f, -0.140180f, -0.075822f, -0.044590f, 0.121472f, -0.081946f, 0.137831f, -0.121449f, -0.131849f, -0.252855f, -0.101325f, 0.119128f, 0.151375f, -0.176785f, 0.042922f, -0.065424f, 0.040538f, -0.104997f, 0.136993f, 0.037359f, 0.150651f, -0.195324f, -0.203439f, 0.055698f, -0.033247f, -0.216255f, -0.056805f, -0.014104f, -0.103845f, -0.006100f, 0.154778f, -0.166410f, 0.029633f, -0.145050f, -0.108067f, -0.200157f, -0.135930f, -0.221633f, -0.164628f, -0.196174f, -0.130433f, -0.095970f, -0.067177f, 0.047592f, -0.093519f, -0.132587f, 0.004883f, -0.007506f, 0.020892f, 0.164565f, 0.072444f, 0.130775f, -0.032183f, 0.043749f, -0.102415f, -0.010129f, -0.049694f, 0.109466f, 0.000168f, 0.083574f, -0.176602f, 0.128825f, -0.100270f, 0.060094f, -0.017003f, -0.044892f, -0.044695f, -0.136226f, 0.107340f, -0.139860f, -0.099362f, -0.203796f, -0.060384f, 0.106510f, 0.114351f, 0.046108f, 0.074263f, 0.048919f, 0.005661f, 0.183417f, -0.046261f, 0.104816f, -0.096789f, -0.122257f, -0.056030f, -0.157004f, -0.049129f, -0.088705f, -0.077197f, 0.089918f, 0.035620f, 0.132101f, -0.135635f, -0.125892f, 0.032301f, -0.065478f, 0.146577f, -0.166547f, -0.145791f, -0.052227f, 0.065766f, 0.012496f, -0.119604f, -0.123188f, 0.034850f, -0.009436f, -0.173058f, -0.025371f, -0.153782f, 0.095127f, -0.092005f, 0.101178f, -0.187062f, -0.178280f, -0.004455f, 0.147215f, 0.172696f, -0.081714f, -0.090159f, -0.118828f, -0.007415f, -0.130207f, 0.072137f, -0.017888f, 0.016105f, -0.094031f, 0.111537f, -0.246289f, 0.219266f, -0.006957f, 0.031765f, 0.116340f, 0.032956f, 0.003864f, 0.066040f, -0.093406f, 0.108813f, 0.002445f, 0.004041f, -0.241347f, -0.027536f, -0.000510f, 0.104677f, -0.054695f, -0.019582f, -0.088558f, 0.057812f, 0.074471f, 0.163685f, -0.162355f, -0.163045f, -0.217279f, 0.133145f, -0.353367f, -0.143107f, -0.138837f, -0.014329f, -0.153432f, 0.044035f, 0.107493f, -0.041579f, -0.045770f, -0.289515f, 0.096547f, 0.253469f, 0.192930f, 0.152634f, -0.025265f, 0.046001f, 0.031451f, -0.073162f, -0.205672f, -0.031154f, -0.158830f, 0.070172f, 0.201937f, -0.023081f, -0.113960f, -0.244954f, -0.052878f, -0.039098f, -0.092011f, 0.134364f, 0.178595f, -0.009614f, -0.276633f, 0.217035f, -0.029492f, 0.111954f, 0.183751f, -0.204156f, 0.069943f, -0.053317f, -0.129688f, 0.195072f, -0.072397f, -0.094851f, -0.025248f, 0.376067f, 0.167743f, 0.095420f, 0.006811f, -0.339877f, -0.140977f, 0.030084f, 0.046987f, 0.066064f, -0.065750f, 0.118112f, 0.197952f, 0.082149f, 0.128346f, -0.173517f, 0.054294f, 0.093575f, -0.170962f, 0.093083f, 0.169327f, 0.094009f, -0.026755f, -0.141118f, -0.313789f, 0.094243f, 0.049082f, 0.099395f, -0.206898f, 0.110994f, 0.177310f, 0.020062f, 0.217480f, 0.188222f, 0.213808f, 0.151281f, -0.144171f, -0.076320f, -0.092062f, -0.147867f, 0.119081f, -0.436657f, 0.041708f, -0.120511f, 0.022080f, -0.080048f, -0.199765f, 0.074993f, 0.204199f, 0.124010f, -0.098596f, 0.003896f, 0.164859f, 0.056623f, -0.177483f, -0.075330f, -0.134033f, -0.122814f, 0.029984f, -0.029510f, 0.169458f, 0.153016f, 0.233151f, -0.059240f, -0.110149f, 0.028296f, -0.091739f, 0.030612f, 0.004681f, 0.097166f, 0.162754f, -0.111938f, 0.222264f, 0.057279f, 0.074347f, 0.061778f, -0.030249f, 0.135276f, -0.094895f, 0.230405f, 0.132384f, 0.247761f, 0.191155f, -0.011418f, -0.040462f, 0.022522f, 0.175242f, 0.162657f, 0.133458f, -0.154823f, 0.147139f, 0.166818f, -0.030718f, 0.015484f, 0.079948f, -0.175409f, -0.044833f, -0.022910f, 0.211318f, 0.101943f, -0.010019f, -0.136223f, -0.344766f, 0.055471f, -0.120907f, -0.209130f, 0.098377f, 0.115368f, 0.024481f, -0.053712f, -0.032312f, -0.015930f, 0.059851f, -0.079806f, 0.159529f, 0.127338f, 0.029577f, -0.030521f, -0.173079f, 0.007592f, 0.006119f, -0.106661f, -0.255378f, 0.236089f, -0.194491f, 0.084259f, 0.074949f, -0.046248f, -0.006557f, 0.109628f, 0.061625f, 0.035194f, -0.090878f, -0.212546f, -0.064185f, 0.128266f, -0.205835f, 0.189069f, 0.093584f, 0.068018f, -0.019977f, 0.074295f, -0.015567f, -0.059882f, -0.075380f, 0.114049f, -0.025109f, 0.198605f, -0.004397f, -0.191096f, -0.191186f, -0.084466f, 0.183306f, 0.214758f, 0.029146f, 0.076556f, -0.061259f, 0.142012f, 0.038860f, -0.023030f, 0.025374f, 0.254107f, 0.116689f, -0.094962f, 0.122528f, 0.071484f, 0.077278f, -0.194078f, 0.035950f, 0.248007f, -0.047907f, -0.003913f, -0.183337f, -0.027939f, -0.166443f, -0.223614f, 0.177064f, 0.106503f, -0.094164f, 0.069483f, -0.037480f, 0.053418f, -0.127049f, -0.092861f, 0.094967f, -0.047037f, -0.043665f, 0.044501f, -0.138665f, 0.145809f, 0.065965f, 0.257523f, 0.202939f, -0.108456f, 0.093277f, -0.049794f, 0.108593f, -0.149570f, 0.128394f, 0.195913f, -0.139982f, -0.131833f, 0.102028f, -0.236388f, -0.300924f, -0.148174f, -0.172602f, -0.081963f, -0.032773f, -0.014311f, -0.013053f, 0.122687f, -0.080443f, -0.090117f, 0.077739f, -0.092866f, -0.153085f, -0.101416f, 0.030308f, 0.132172f, -0.040136f, 0.031143f, 0.051896f, -0.047439f, -0.038678f, 0.046207f, 0.153088f, 0.090960f, -0.178147f, -0.048137f, -0.001135f, -0.148075f, 0.259295f, -0.221955f, 0.133108f, -0.143691f, 0.070065f, 0.236519f, 0.054277f, -0.091755f, -0.093747f, 0.080108f, 0.142731f, -0.249483f, 0.063745f, 0.040674f, -0.027853f, -0.078798f, -0.065404f, -0.020271f, 0.072238f, 0.008255f, 0.075975f, 0.091560f, -0.062763f, 0.063853f, 0.123375f, -0.032424f, 0.168652f, 0.099362f, 0.171117f, -0.165942f, -0.283125f, 0.013804f, 0.030101f, 0.044098f, 0.001216f, 0.085109f, -0.198938f, -0.139551f, 0.164308f, 0.219846f, -0.071159f, 0.045292f, 0.107599f, -0.102022f, 0.151640f, -0.122601f, 0.051651f, 0.084060f, 0.080997f, -0.081153f, -0.232422f, -0.153940f, -0.226221f, 0.092648f, 0.026016f, 0.044135f, 0.107399f, -0.037421f, -0.227402f, 0.142856f, 0.155780f, 0.155028f, 0.244016f, 0.048477f, 0.121648f, -0.042478f, -0.095468f, 0.048045f, -0.008759f, -0.146935f, 0.126228f, 0.203747f, -0.078167f, -0.010166f, -0.105063f, -0.361431f, -0.060068f, -0.012344f, -0.032615f, 0.193916f, 0.144004f, 0.119524f, 0.221450f, -0.109501f, -0.125379f, 0.037867f, -0.114796f, -0.089507f, -0.208553f, 0.084269f, -0.023057f, -0.233143f, 0.154031f, -0.055240f, -0.038428f, 0.099143f, -0.189899f, 0.081423f, -0.092219f, 0.237919f, 0.096310f, -0.049873f, 0.110484f, 0.009779f, 0.178895f, -0.116186f, -0.157435f, 0.139955f, -0.069433f, -0.012807f, -0.161831f, 0.026124f, -0.383177f, 0.109426f, -0.039002f, -0.067760f, -0.339572f, 0.041524f, 0.037485f, -0.052220f, 0.034437f, 0.195448f, 0.343927f, 0.183339f, -0.135477f, -0.019394f, 0.242720f, 0.126368f, -0.174735f, -0.313218f, -0.041073f, -0.345448f, -0.122210f, 0.051188f, -0.147594f, 0.131755f, 0.060650f, 0.109035f, -0.050073f, -0.065376f, 0.205638f, 0.078670f, 0.046753f, 0.200328f, -0.196972f, 0.095506f, 0.218660f, -0.006631f, -0.066318f, 0.084260f, 0.081647f, 0.084720f, 0.152162f, 0.141052f, 0.042177f, -0.305956f, -0.176689f, -0.267685f, 0.172453f, 0.249183f, 0.234987f, 0.132277f, 0.358690f, 0.142582f, 0.041012f, -0.068140f, 0.143909f, 0.060647f, -0.094022f, 0.339505f, 0.145988f, -0.204201f, -0.143190f, -0.075888f, -0.047739f, -0.133587f, 0.109141f, 0.132351f, 0.155069f, 0.224645f, -0.071172f, 0.002411f, 0.218932f, -0.081208f, 0.029576f, 0.169093f, -0.025171f, -0.136193f, -0.065924f, 0.061312f, -0.158488f, -0.060206f, -0.171506f, -0.047732f, -0.055755f, 0.185463f, -0.085546f, -0.108245f, -0.064031f, 0.030289f, 0.108799f, -0.003041f, -0.030246f, -0.155004f, -0.075881f, 0.205240f, 0.019973f, 0.191873f, -0.170577f, -0.100584f, -0.086933f, -0.326103f, -0.224743f, 0.009245f, -0.305397f, -0.036504f, -0.092976f, -0.011321f, 0.167523f, -0.116021f, 0.049967f, 0.071824f, 0.127530f, -0.123925f, 0.002892f, -0.096407f, 0.103212f, -0.177897f, 0.120787f, -0.033413f, 0.172877f, 0.041543f, 0.217293f, -0.082135f, 0.134277f, -0.177878f, -0.219050f, -0.227181f, 0.072488f, 0.018188f, -0.028516f, 0.039659f, 0.154984f, -0.083671f, 0.126981f, 0.111527f, 0.213560f, 0.099150f, -0.099827f, 0.276399f, 0.021427f, -0.239711f, -0.138403f, 0.092353f, -0.115456f, 0.097920f, -0.014151f, -0.240494f, 0.020906f, 0.036252f, -0.080254f, -0.047223f, -0.069626f, 0.022813f, 0.065642f, -0.074018f, 0.081636f, -0.077147f, -0.088238f, -0.165005f, 0.175638f, -0.117821f, -0.127845f, 0.009567f, 0.041576f, 0.077852f, -0.189285f, -0.071207f, 0.180789f, -0.062088f, 0.137847f, -0.223709f, 0.003398f, 0.159235f, 0.185072f, 0.151174f, -0.013545f, 0.130668f, 0.075743f, -0.143496f, -0.008682f, -0.115636f, 0.267808f, -0.076605f, -0.129656f, -0.089261f, -0.033593f, 0.135505f, 0.131657f, -0.103338f, 0.095084f, 0.185114f, -0.040104f, -0.010784f, 0.082122f, -0.081839f, -0.188010f, 0.074975f, 0.097798f, -0.062040f, -0.097009f, -0.098198f, -0.098588f, -0.136968f, -0.222434f, -0.100406f, 0.146021f, -0.158564f, 0.119940f, -0.032225f, -0.057525f, 0.206859f, -0.359812f, 0.080513f, -0.010706f, 0.111339f, 0.036823f, -0.034714f, 0.119672f, 0.162921f, -0.027826f, 0.049466f, 0.154579f, 0.090141f, -0.046151f, 0.115707f, 0.135553f, 0.060186f, -0.250875f, -0.091839f, 0.217069f, 0.132965f, 0.127015f, 0.162702f, 0.143821f, -0.088788f, -0.069687f, -0.073865f, -0.004493f, 0.060330f, -0.019578f, -0.019790f, -0.151707f, -0.127063f, -0.017607f, 0.113086f, -0.062476f, 0.129893f, -0.144576f, 0.062736f, 0.203620f, 0.119235f, 0.156584f, -0.184546f, 0.091127f, 0.085420f, 0.127706f, 0.034368f, -0.082801f, -0.101956f, -0.082385f, -0.066701f, -0.138705f, -0.221612f, 0.004025f, -0.025112f, -0.023109f, -0.065026f, 0.071355f, 0.047742f, -0.039115f, -0.188875f, -0.079374f, -0.055477f, 0.104771f, 0.033017f, 0.041381f, -0.195357f, -0.042020f, -0.241582f, 0.056908f, -0.002907f, 0.130894f, 0.012001f, 0.075670f, -0.249277f, 0.093746f, 0.208414f, -0.052377f, -0.164544f, -0.018588f, 0.020815f, -0.093011f, -0.040810f, 0.114124f, -0.082172f, 0.079012f, 0.174006f, -0.113064f, 0.246360f, -0.163504f, -0.083178f, -0.264043f, 0.149822f, -0.195187f, -0.025487f, 0.047297f, -0.107320f, -0.152898f, -0.009109f, 0.267335f, 0.175059f, -0.172829f, -0.104336f, 0.074995f, -0.045958f, 0.143306f, 0.024131f, 0.212884f, -0.061763f, 0.414673f, -0.127966f, 0.019431f, 0.099516f, -0.105011f, -0.059935f, 0.097540f, 0.122076f, 0.169883f, -0.112947f, 0.113621f, 0.079616f, -0.171744f, -0.183375f, -0.068378f, -0.151601f, -0.210256f, 0.008307f, 0.133179f, 0.345484f, 0.069996f, 0.371998f, 0.114155f, -0.105237f, 0.206282f, -0.007076f, 0.135097f, -0.072063f, 0.171257f, 0.086515f, 0.138395f, -0.065107f, -0.076711f, -0.106585f, 0.358293f, -0.073071f, 0.036838f, 0.223874f, 0.192974f, -0.153102f, -0.180535f, 0.090914f, -0.143395f, 0.178006f, 0.132354f, 0.225217f, 0.249315f, 0.252782f, -0.063274f, -0.159383f, 0.090339f, -0.102747f, -0.232195f, 0.003425f, 0.188076f, -0.076973f, 0.037223f, 0.050505f, 0.041755f, 0.109114f, 0.061524f, 0.179374f, 0.286883f, 0.056441f, 0.094375f, -0.112396f, -0.124389f, 0.088110f, -0.155464f, -0.032612f, 0.056117f, 0.156337f, -0.149273f, -0.063041f, -0.008481f, -0.098077f, 0.042273f, -0.033923f, -0.044465f, -0.002543f, -0.154208f, -0.100059f, 0.039394f, 0.135496f, 0.136735f, 0.065286f, 0.000779f, -0.100842f, -0.060410f, -0.200025f, -0.203174f, 0.131596f, -0.015904f, 0.150146f, -0.118242f, -0.022066f, -0.085096f, -0.105354f, -0.188122f, -0.055217f, -0.118633f, 0.052260f, 0.033540f, 0.141650f, -0.013713f, -0.022751f, -0.163877f, -0.093636f, 0.045973f, -0.191615f, 0.143824f, -0.147721f, 0.083665f, -0.017254f, 0.038822f, -0.029490f, -0.120582f, 0.008922f, -0.055473f, -0.111598f, -0.188223f, -0.165122f, 0.172709f, 0.145743f, 0.148716f, -0.171833f, -0.163018f, 0.026808f, -0.023988f, -0.055953f, 0.072173f, -0.182905f, 0.031620f, -0.065913f, -0.032022f, 0.148383f, 0.005532f, -0.119974f, -0.150919f, -0.174835f, 0.096468f, 0.117337f, 0.065290f, 0.143667f, -0.003684f, 0.086594f, -0.153105f, 0.103500f, 0.147513f, 0.127229f, -0.092054f, 0.031980f, 0.077640f, -0.000743f, 0.159414f, -0.144608f, 0.071045f, -0.036523f, -0.018931f, 0.084300f, -0.115534f, -0.073268f, 0.073162f, 0.002939f, -0.143473f, 0.032887f, 0.036890f, -0.248426f, -0.092698f, -0.054049f, 0.114197f, -0.122851f, 0.093275f, -0.279941f, 0.039692f, 0.140266f, -0.167734f, 0.205626f, 0.303748f, -0.096494f, -0.133990f, -0.151561f, 0.127224f, 0.003423f, -0.195262f, -0.080304f, -0.103935f, -0.030559f, -0.113703f, 0.099352f, -0.207153f, 0.198387f, 0.248025f, 0.154643f, 0.197742f, 0.190876f, -0.047688f, -0.040288f, 0.133252f, 0.013900f, 0.142142f, 0.130174f, 0.137281f, -0.073953f, -0.267758f, -0.268261f, -0.056296f, 0.153098f, 0.075749f, -0.192912f, -0.085912f, -0.094863f, -0.017181f, -0.074652f, -0.161287f, -0.067731f, 0.079945f, -0.119803f, -0.018629f, -0.059177f, -0.097446f, -0.153882f, 0.244583f, -0.115886f, -0.238474f, -0.189978f, -0.156449f, -0.110441f, -0.081205f, 0.094105f, -0.062313f, -0.166098f, 0.095660f, 0.186210f, -0.092104f, 0.054019f, -0.170255f, 0.080841f, 0.014066f, -0.075172f, -0.098759f, -0.014060f, 0.103250f, -0.051114f, 0.122184f, 0.092954f, -0.075012f, 0.053001f, 0.065182f, 0.179353f, -0.192229f, -0.159199f, -0.248407f, 0.151112f, 0.165876f, 0.119282f, -0.077651f, -0.078576f, -0.027457f, 0.142449f, 0.058657f, -0.033266f, -0.028281f, -0.188104f, -0.121181f, 0.077979f, 0.122338f, 0.027866f, 0.115580f, -0.166612f, -0.126346f, -0.055541f, 0.086499f, -0.208577f, -0.179658f, 0.051360f, 0.126578f, 0.007801f, -0.221449f, 0.007961f, 0.110687f, -0.124349f, -0.024279f, -0.152748f, -0.062077f, -0.161037f, -0.011029f, 0.057217f, -0.169801f, 0.151511f, 0.161559f, -0.066487f, -0.011072f, 0.128649f, -0.180304f, -0.155474f, -0.195957f, 0.052791f, 0.060804f, 0.169138f, -0.150582f, -0.065973f, -0.182802f, 0.148417f, -0.068991f, 0.023428f, -0.175924f, 0.166188f, 0.160286f, 0.081307f, 0.378902f, 0.015419f, -0.094089f, 0.190001f, 0.122306f, 0.001499f, -0.096826f, 0.034625f, -0.078102f, -0.004335f, 0.213463f, -0.106309f, 0.117293f, 0.057580f, -0.073878f, 0.084269f, -0.076350f, -0.025911f, 0.129714f, 0.223900f, 0.073080f, 0.089728f, 0.322336f, 0.016434f, 0.103926f, 0.020713f, 0.006741f, 0.055848f, -0.221173f, -0.123057f, 0.130295f, -0.052598f, 0.018214f, 0.103704f, 0.045084f, -0.144668f, 0.088300f, 0.070055f, 0.101267f, 0.039349f, -0.099149f, -0.019846f, -0.105881f, 0.043185f, -0.069768f, 0.000400f, 0.127301f, -0.114433f, 0.089322f, -0.110780f, 0.225110f, 0.126031f, -0.144028f, -0.151232f, -0.115171f, -0.170969f, 0.006083f, -0.194831f, 0.085979f, 0.049701f, 0.269811f, 0.018140f, 0.130949f, -0.135492f, 0.023630f, 0.044344f, -0.129301f, 0.047677f, 0.088845f, 0.152812f, 0.188813f, -0.007890f, -0.151088f, 0.115338f, 0.085681f, 0.025552f, -0.141519f, -0.010730f, 0.121009f, 0.026901f, -0.145490f, -0.167819f, -0.078529f, 0.099994f, -0.185036f, -0.119180f, 0.130331f, -0.190195f, -0.121283f, 0.120283f, 0.153165f, -0.073504f, 0.057545f, -0.144712f, 0.033182f, -0.080318f, -0.122791f, -0.167604f, -0.126462f, -0.074199f, -0.093469f, -0.032029f, 0.088884f, 0.041868f, -0.030838f, 0.019385f, 0.180302f, -0.005867f, 0.129190f, 0.153293f, 0.046588f, -0.075346f, 0.123710f, -0.097693f, -0.039728f, -0.110125f, 0.092752f, -0.151184f, -0.214865f, -0.167923f, -0.115183f, -0.122692f, -0.110042f, 0.063785f, 0.094341f, -0.178351f, -0.121737f, -0.120109f, 0.105265f, -0.193392f, -0.157659f, -0.199340f, -0.146430f, 0.092815f, 0.038043f, 0.009589f, -0.187512f, -0.243504f, -0.248201f, -0.142925f, 0.110065f, 0.146739f, -0.038682f, -0.039876f, -0.102449f, 0.021333f, 0.082351f, -0.011666f, -0.020129f, -0.183817f, 0.115480f, 0.127473f, -0.031744f, 0.103804f, -0.160949f, -0.211750f, -0.057810f, 0.093593f, 0.033453f, 0.042678f, 0.124655f, 0.024624f, -0.213117f, 0.045014f, -0.011500f, -0.180153f, -0.242766f, 0.229509f, -0.054919f, -0.207885f, 0.261561f, 0.033384f, 0.175052f, 0.120935f, 0.029708f, 0.155341f, 0.217145f, 0.049597f, 0.012394f, 0.115272f, -0.076554f, -0.250090f, 0.216879f, -0.041920f, 0.097798f, 0.080253f, 0.144319f, -0.123436f, 0.070697f, 0.187920f, 0.056801f, 0.361891f, -0.014209f, -0.079295f, 0.270346f, -0.205657f, 0.080382f, 0.152192f, -0.254069f, -0.183876f, 0.202297f, -0.024134f, 0.069840f, -0.144215f, -0.006261f, -0.006075f, 0.094885f, 0.199614f, -0.007552f, -0.026277f, -0.097174f, 0.180112f, 0.046842f, -0.040247f, 0.148455f, -0.025088f, -0.005879f, 0.137336f, -0.136830f, -0.420853f, 0.227323f, 0.035500f, -0.357674f, -0.312952f, 0.102781f, 0.083393f, -0.050869f, -0.012234f, 0.188227f, -0.300718f, 0.020763f, 0.184717f, -0.369280f, -0.271288f, 0.094857f, 0.021109f, -0.084357f, 0.179666f, -0.111065f, 0.092600f, 0.151505f, -0.053545f, 0.033087f, -0.142301f, 0.138542f, 0.133344f, -0.178350f, -0.180854f, -0.108426f, -0.156935f, 0.036711f, 0.018609f, -0.168839f, 0.011307f, -0.107954f, 0.034072f, -0.090556f, 0.012722f, -0.078895f, 0.089483f, -0.026979f, 0.133039f, -0.013821f, 0.148817f, -0.019554f, 0.118163f, -0.020279f, -0.057695f, -0.192379f, 0.086689f, 0.001412f, -0.009201f, 0.010850f, -0.169353f, 0.038386f, -0.161901f, 0.013837f, -0.214147f, 0.000561f, -0.160666f, 0.129729f, 0.064187f, -0.241211f, -0.002870f, 0.241044f, -0.061994f, 0.151528f, -0.332600f, -0.110739f, 0.070842f, 0.174830f, -0.142148f, -0.052020f, 0.012023f, -0.063836f, -0.126635f, -0.103081f, -0.079444f, 0.100430f, 0.060049f, 0.087549f, -0.061721f, -0.084396f, 0.104083f, 0.102821f, -0.044050f, -0.000144f, 0.119937f, 0.009882f, 0.038696f, 0.037804f, 0.204700f, -0.024827f, -0.087246f, 0.106310f, -0.103458f, -0.136546f, -0.036720f, -0.079670f, 0.019665f, -0.004774f, -0.190324f, 0.009977f, -0.194808f, 0.156223f, 0.088959f, -0.218745f, -0.097812f, -0.193295f, -0.122323f, -0.208909f, 0.186477f, -0.251483f, 0.093037f, 0.000414f, 0.163634f, -0.378895f, -0.179171f, -0.063555f, 0.244218f, -0.002074f, 0.035556f, 0.130328f, 0.069973f, -0.049903f, 0.181404f, 0.017103f, 0.072085f, 0.119431f, -0.460043f, 0.172280f, -0.085160f, -0.230244f, -0.200407f, 0.046826f, 0.040146f, 0.068869f, 0.139901f, 0.102492f, 0.050679f, 0.023989f, -0.029762f, -0.138349f, 0.090011f, -0.003792f, 0.151598f, 0.177987f, -0.290801f, 0.171000f, -0.040688f, 0.233309f, -0.133682f, -0.138722f, -0.024877f, 0.026416f, -0.071211f, 0.058271f, -0.252643f, 0.157909f, -0.041596f, 0.114704f, -0.064127f, 0.147801f, 0.049496f, 0.043282f, 0.220954f, 0.157721f, 0.021815f, -0.090820f, 0.438733f, -0.072071f, -0.177141f, -0.066975f, 0.042603f, -0.014601f, 0.004044f, -0.050785f, -0.083270f, -0.007601f, -0.095670f, 0.041433f, 0.159177f, -0.093751f, 0.154976f, -0.083766f, -0.027930f, 0.184699f, 0.025775f, -0.027932f, -0.105283f, 0.018288f, -0.077404f, -0.194447f, -0.066819f, -0.100575f, 0.094690f, 0.161549f, 0.033293f, -0.169962f, -0.028058f, -0.057813f, -0.156994f, -0.145970f, 0.139999f, -0.174455f, -0.192935f, 0.029634f, -0.100998f, -0.192843f, 0.118317f, -0.008556f, -0.103710f, 0.130319f, 0.115762f, -0.082518f, 0.117005f, -0.065660f, 0.046505f, -0.022640f, -0.193450f, -0.011232f, 0.028289f, 0.027078f, 0.075860f, 0.146653f, -0.015931f, -0.153884f, -0.176542f, 0.063899f, -0.056434f, -0.170696f, 0.001040f, 0.135540f, -0.106625f, 0.104992f, -0.016973f, 0.058743f, -0.140862f, 0.131931f, 0.179359f, 0.068509f, -0.195889f, 0.038416f, -0.129501f, -0.066132f, 0.106132f, -0.144930f, 0.078877f, 0.092563f, 0.179055f, -0.003658f, -0.006671f, 0.150340f, -0.134781f, -0.031729f, -0.039748f, -0.037816f, 0.155261f, -0.106132f, 0.171419f, 0.193174f, 0.089238f, 0.095429f, -0.041659f, 0.134616f, -0.129370f, -0.140445f, -0.172945f, -0.161070f, 0.010483f, -0.115236f, -0.107369f, -0.293363f, -0.124770f, -0.098307f, 0.014514f, -0.074378f, -0.072270f, 0.122246f, -0.087828f, 0.111112f, 0.127362f, 0.015715f, 0.161369f, 0.070143f, 0.049582f, -0.068490f, 0.044563f, -0.074859f, 0.031309f, -0.034183f, -0.039086f, 0.076110f, 0.071248f, -0.096945f, 0.127369f, -0.032125f, 0.130394f, -0.088449f, 0.099579f, -0.055611f, -0.213070f, -0.137698f, 0.107924f, 0.105857f, -0.121033f, 0.093309f, -0.203500f, 0.101919f, -0.178311f, 0.188774f, 0.014985f, -0.010957f, -0.192178f, 0.052859f, -0.249450f, -0.076420f, 0.100584f, 0.113170f, -0.015603f, 0.130124f, -0.157567f, 0.111883f, 0.087173f, -0.069363f, -0.029943f, -0.094186f, 0.187719f, -0.200754f, 0.372237f, -0.035268f, -0.197408f, -0.190824f, -0.082127f, -0.175118f, 0.124549f, 0.156585f, 0.259119f, 0.116527f, -0.063534f, -0.194560f, 0.110274f, -0.070256f, -0.026524f, 0.207099f, 0.126908f, -0.206344f, 0.156008f, 0.079070f, 0.006097f, -0.072574f, 0.136295f, 0.016139f, 0.062087f, 0.057383f, -0.106875f, 0.096614f, -0.057401f, 0.010824f, 0.258971f, 0.122804f, -0.034763f, 0.219258f, 0.113292f, 0.090175f, -0.015357f, 0.216200f, -0.033348f, -0.004498f, -0.122670f, -0.084481f, -0.124631f, 0.046533f, -0.102342f, -0.217340f, -0.169292f, 0.024197f, 0.100120f, -0.155548f, 0.208551f, 0.022439f, -0.024776f, -0.120033f, 0.197909f, -0.212536f, -0.041795f, 0.126901f, -0.045620f, -0.012677f, -0.029989f, 0.041058f, -0.116743f, 0.060056f, 0.177213f, -0.119102f, -0.138801f, -0.207338f, -0.206323f, 0.009269f, -0.108714f, 0.241169f, 0.143368f, 0.343430f, -0.156904f, -0.029411f, 0.019636f, 0.191872f, -0.049491f, 0.175657f, 0.220254f, 0.068297f, -0.070663f, -0.206749f, 0.207367f, -0.142751f, -0.037543f, 0.068025f, 0.155747f, -0.041597f, 0.102525f, -0.229202f, 0.138718f, 0.045787f, -0.215567f, -0.001469f, -0.136873f, -0.213971f, 0.003123f, -0.090586f, 0.080762f, -0.136122f, 0.007167f, 0.046572f, -0.041616f, -0.005990f, -0.127115f, -0.005591f, 0.041246f, 0.129547f, 0.211396f, -0.134862f, -0.131662f, 0.202282f, -0.022718f, 0.071220f, -0.039057f, 0.099941f, -0.056474f, 0.034728f, -0.226904f, -0.230765f, -0.149530f, -0.256137f, 0.039751f, -0.172271f, -0.083673f, -0.093692f, -0.169957f, 0.095393f, -0.099303f, 0.102016f, -0.089648f, -0.189545f, 0.048801f, -0.199945f, -0.172423f, 0.091762f, -0.122672f, -0.110106f, -0.018319f, -0.056257f, -0.074543f, -0.025341f, -0.009415f, 0.003415f, -0.038580f, -0.285016f, -0.118888f, 0.035304f, 0.117886f, -0.157560f, -0.100716f, 0.289757f, 0.065190f, 0.084554f, 0.233877f, 0.140916f, 0.146876f, -0.191804f, 0.116783f, 0.073618f, -0.286589f, -0.273579f, 0.029133f, -0.113453f, -0.165170f, 0.171404f, 0.199617f, 0.121323f, -0.013249f, 0.293561f, -0.112327f, -0.178007f, -0.174536f, 0.091930f, -0.060799f, -0.224872f, 0.153074f, -0.102065f, -0.031554f, -0.286653f, -0.221266f, 0.291273f, -0.055958f, 0.127750f, -0.176151f, 0.233666f, 0.057626f, -0.075659f, 0.347692f, 0.055736f, 0.093981f, -0.019645f, -0.077809f, -0.126758f, -0.039475f, 0.090530f, 0.128990f, 0.120488f, 0.475722f, 0.008254f, 0.040904f, 0.093062f, -0.183622f, 0.038446f, -0.006336f, -0.091325f, -0.073192f, -0.212216f, 0.148151f, 0.193880f, 0.081002f, -0.161206f, 0.020077f, 0.175368f, 0.013120f, 0.120752f, 0.070884f, -0.190627f, -0.078620f, 0.121110f, 0.072814f, -0.093091f, -0.075416f, 0.056410f, -0.059226f, -0.026522f, 0.068946f, 0.102828f, 0.103030f, 0.127352f, -0.120215f, -0.048990f, -0.092330f, 0.071316f, 0.198644f, 0.056764f, -0.103968f, 0.030198f, -0.022012f, 0.038793f, -0.186663f, 0.045405f, 0.056703f, 0.172091f, 0.047509f, 0.018616f, 0.204952f, -0.119174f, 0.069595f, -0.005300f, -0.022759f, -0.013434f, -0.132207f, 0.097902f, 0.151689f, -0.217951f, -0.096574f, -0.124282f, 0.002400f, -0.390171f, 0.228202f, -0.306546f, 0.008727f, 0.117503f, -0.157773f, -0.241210f, -0.036786f, 0.107777f, 0.180151f, -0.120536f, 0.072735f, 0.369788f, 0.201156f, -0.089735f, -0.060415f, 0.151802f, -0.098374f, 0.087981f, -0.484355f, 0.100813f, -0.136903f, -0.119965f, 0.163470f, -0.211204f, 0.036853f, 0.055441f, -0.118343f, -0.052330f, 0.101171f, -0.077958f, 0.165912f, -0.165644f, 0.028969f, -0.161008f, 0.004646f, -0.035620f, -0.013572f, -0.044047f, 0.069287f, -0.005217f, 0.010153f, 0.018792f, 0.012496f, 0.120618f, -0.280550f, 0.027348f, -0.254585f, 0.032953f, -0.053301f, 0.126206f, -0.000015f, 0.116357f, -0.063860f, -0.051484f, 0.189670f, 0.149090f, 0.213832f, 0.138389f, 0.368200f, 0.228210f, -0.373245f, -0.034591f, -0.010690f, -0.048294f, 0.192454f, 0.154345f, 0.121426f, -0.033891f, 0.048236f, 0.118775f, -0.007758f, -0.067789f, -0.136939f, -0.128815f, 0.111267f, 0.034039f, 0.195254f, -0.087832f, 0.037677f, 0.262576f, 0.164374f, 0.195202f, -0.137841f, 0.145895f, -0.000014f, 0.307049f, -0.144086f, -0.197671f, 0.281534f, -0.104076f, 0.135808f, 0.055958f, 0.197649f, 0.172439f, -0.149962f, -0.027878f, -0.203660f, -0.144904f, 0.444733f, -0.056806f, 0.256126f, -0.162735f, 0.101731f, 0.016484f, -0.208178f, -0.114909f, 0.087690f, 0.039247f, -0.178231f, 0.063432f, 0.109306f, -0.166767f, -0.125505f, 0.326649f, 0.127339f, 0.036100f, 0.017013f, -0.020525f, -0.214019f, -0.117321f, 0.228323f, 0.092153f, 0.034373f, 0.177084f, 0.035173f, 0.077747f, 0.154059f, 0.134338f, -0.094696f, -0.107092f, -0.166891f, -0.080877f, 0.071633f, -0.011242f, -0.365532f, -0.192558f, 0.020575f, -0.076132f, 0.054023f, -0.085391f, 0.219030f, -0.136354f, 0.200344f, 0.123886f, 0.080593f, 0.166871f, -0.084662f, 0.014857f, -0.137726f, 0.192669f, -0.010647f, 0.037727f, 0.119142f, 0.042186f, -0.150119f, 0.252386f, -0.152228f, -0.020003f, -0.050218f, -0.044567f, -0.114883f, -0.038323f, 0.133807f, -0.119841f, 0.186009f, -0.230523f, 0.172722f, 0.234044f, -0.231873f, -0.126954f, -0.050388f, -0.368028f, -0.024510f, 0.209310f, 0.053042f, 0.120192f, 0.081021f, 0.157598f, 0.128559f, -0.104053f, -0.192462f, 0.108674f, 0.056935f, 0.281608f, 0.131488f, -0.028435f, 0.149684f, -0.020115f, 0.159517f, -0.010038f, -0.119204f, 0.016729f, 0.143564f, 0.214011f, 0.119187f, 0.078380f, 0.250186f, 0.035195f, 0.080527f, 0.038951f, -0.072504f, -0.125769f, 0.210568f, 0.089254f, -0.012490f, 0.244918f, -0.034652f, 0.223710f, 0.041326f, -0.280042f, -0.091963f, -0.152415f, 0.167036f, -0.143155f, -0.077804f, -0.137956f, -0.077638f, 0.060856f, 0.037829f, -0.115632f, -0.198287f, 0.069219f, 0.050738f, -0.113577f, 0.040483f, 0.076201f, -0.194358f, -0.083544f, 0.038252f, -0.138629f, -0.060906f, -0.016049f, 0.069536f, 0.067994f, -0.031990f, -0.040634f, 0.122643f, -0.090500f, 0.109298f, 0.145572f, 0.096150f, -0.127042f, -0.187007f, 0.181268f, 0.066153f, -0.180358f, -0.012707f, 0.002698f, -0.182679f, -0.086646f, -0.106390f, -0.158293f, -0.175225f, 0.010976f, 0.144643f, -0.097487f, -0.187369f, 0.161799f, -0.007113f, 0.118185f, -0.152887f, -0.121721f, -0.174559f, -0.139412f, -0.036039f, 0.080071f, -0.104112f, 0.040376f, 0.130084f, -0.087202f, 0.164244f, -0.130099f, -0.077680f, -0.194328f, 0.111987f, -0.147260f, -0.193001f, -0.044763f, 0.046223f, 0.106701f, -0.144932f, -0.152972f, 0.128705f, 0.024735f, -0.047208f, -0.023590f, 0.094404f, 0.015746f, 0.016304f, 0.033715f, 0.127478f, -0.145931f, -0.176225f, -0.151057f, -0.153835f, -0.017493f, -0.114290f, -0.153121f, -0.143836f, -0.141683f, -0.173205f, 0.146387f, 0.091009f, -0.128455f, -0.051619f, 0.127975f, -0.111298f, -0.180449f, 0.111588f, 0.161725f, -0.228507f, 0.214568f, 0.166881f, -0.194454f, -0.072569f, -0.210636f, -0.163428f, -0.143471f, 0.151920f, -0.121151f, 0.025214f, -0.042155f, -0.021861f, 0.038243f, -0.145300f, -0.017415f, 0.121476f, 0.157865f, 0.047185f, -0.084175f, 0.185861f, 0.023991f, -0.170107f, -0.104079f, 0.160566f, 0.154108f, 0.071862f, 0.025865f, -0.038900f, 0.032547f, -0.121623f, -0.266522f, -0.075989f, -0.194857f, 0.187770f, 0.019777f, -0.163414f, 0.150068f, 0.090203f, -0.093515f, -0.105840f, -0.281199f, -0.181867f, -0.221127f, 0.131653f, 0.209559f, -0.236672f, 0.044723f, 0.102514f, 0.038285f, -0.092834f, 0.122901f, 0.146402f, 0.027508f, 0.063049f, 0.070311f, -0.136404f, -0.005328f, 0.011950f, 0.129482f, -0.097107f, 0.220528f, 0.018763f, -0.025099f, 0.042560f, 0.061185f, 0.117896f, -0.059716f, 0.309214f, 0.054927f, 0.062768f, -0.108279f, -0.084832f, 0.133195f, 0.074598f, 0.022247f, -0.250293f, 0.056488f, 0.072133f, -0.383975f, 0.143078f, 0.028569f, 0.081696f, -0.120626f, 0.141452f, 0.024588f, -0.165528f, -0.088781f, -0.015265f, -0.097761f, 0.029604f, 0.055184f, 0.201100f, 0.107501f, -0.071642f, -0.031858f, -0.084784f, 0.151367f, -0.156256f, 0.006851f, -0.040639f, -0.279425f, -0.142109f, 0.072547f, 0.027640f, 0.157198f, 0.082764f, 0.119253f, -0.067381f, -0.050536f, -0.204916f, -0.084188f, 0.160817f, 0.062293f, -0.144685f, 0.208471f, 0.123376f, 0.062764f, 0.036034f, 0.159601f, 0.003801f, 0.286229f, -0.129478f, -0.116820f, 0.092041f, 0.011611f, 0.026917f, 0.075335f, 0.002812f, 0.177184f, 0.056536f, -0.050230f, 0.081014f, -0.175654f, -0.305794f, 0.059311f, -0.104489f, 0.049639f, -0.087330f, -0.119152f, -0.075014f, -0.346646f, 0.240332f, 0.165630f, -0.029496f, -0.168083f, -0.071277f, 0.114279f, -0.137793f, 0.033875f, -0.268410f, -0.004038f, 0.139644f, -0.112920f, -0.062342f, -0.137011f, -0.215194f, 0.157779f, 0.052070f, 0.048031f, 0.000101f, -0.032993f, -0.118889f, 0.157696f, -0.145576f, 0.057407f, -0.160456f, -0.014456f, -0.092762f, 0.060544f, 0.046069f, -0.144792f, 0.014737f, -0.090128f, -0.056293f, -0.052915f, 0.003468f, 0.127721f, -0.134099f, -0.175665f, 0.004230f, -0.077410f, 0.250909f, 0.009637f, -0.187468f, 0.124203f, 0.165374f, 0.018808f, -0.419314f, 0.073641f, -0.279830f, -0.000728f, 0.214721f, -0.156334f, 0.105312f, -0.014233f, -0.206740f, -0.054408f, 0.103649f, 0.144145f, 0.200800f, 0.164936f, 0.051875f, 0.089342f, 0.159627f, -0.124038f, -0.093138f, 0.133768f, 0.221493f, -0.137459f, -0.001610f, 0.128082f, 0.008460f, 0.110811f, -0.274781f, -0.144052f, 0.035963f, -0.090892f, 0.089995f, -0.180659f, -0.010494f, 0.173678f, 0.062939f, 0.065021f, 0.172858f, 0.010868f, 0.087228f, -0.187712f, 0.012152f, -0.038217f, -0.333570f, 0.172046f, 0.045252f, -0.121818f, 0.147920f, -0.021820f, 0.174713f, -0.213395f, 0.055885f, 0.240577f, -0.106448f, 0.101692f, 0.021820f, -0.095406f, 0.137974f, 0.019767f, -0.241980f, -0.071561f, -0.207592f, 0.170057f, 0.011895f, -0.085217f, 0.034423f, 0.034002f, -0.109476f, 0.301348f, 0.084269f, -0.258033f, -0.057280f, 0.004535f, -0.071567f, -0.191698f, -0.061477f, -0.201679f, 0.095491f, -0.207086f, -0.294793f, -0.037251f, 0.097500f, -0.027191f, -0.038018f, 0.103084f, 0.024169f, 0.000568f, -0.112207f, 0.112662f, 0.001925f, 0.113128f, -0.158937f, -0.003000f, 0.048499f, -0.164338f, 0.071120f, -0.034447f, 0.098795f, 0.065197f, -0.212677f, 0.171066f, -0.150728f, 0.110970f, 0.207196f, 0.071491f, 0.068110f, 0.077811f, 0.305154f, 0.092297f, 0.257967f, 0.001263f, -0.049769f, 0.103647f, 0.026212f, -0.056381f, 0.019759f, 0.265646f, 0.017518f, -0.101044f, 0.263756f, -0.219351f, 0.070421f, 0.145660f, 0.319304f, -0.004669f, -0.011980f, -0.114536f, -0.154786f, 0.065386f, -0.113788f, 0.039986f, -0.147641f, 0.479183f, -0.004673f, -0.085886f, 0.172033f, 0.112916f, 0.080888f, -0.000354f, 0.157512f, -0.156872f, 0.019095f, -0.039981f, 0.102429f, 0.277938f, -0.051249f, 0.119806f, -0.165766f, 0.235509f, 0.187898f, -0.052478f, 0.098546f, -0.016431f, -0.093670f, 0.125389f, -0.029375f, 0.105122f, -0.073335f, 0.123755f, 0.179271f, 0.026066f, 0.306352f, -0.116944f, 0.315411f, -0.050138f, 0.178250f, 0.282203f, -0.115587f, -0.139359f, 0.096325f, -0.180753f, -0.033181f, -0.115002f, -0.099390f, -0.123086f, 0.221843f, 0.406260f, 0.092179f, -0.137324f, 0.160431f, -0.027405f, -0.108836f, -0.122837f, 0.099360f, -0.152160f, 0.026056f, 0.146559f, 0.150921f, 0.036987f, 0.141836f, 0.046408f, 0.128736f, 0.087917f, -0.127028f, -0.536398f, -0.068656f, -0.036122f, -0.040206f, 0.046535f, -0.066635f, -0.106765f, -0.187346f, 0.003065f, 0.381499f, -0.029883f, 0.144180f, -0.046478f, -0.027603f, -0.001766f, 0.285689f, 0.198952f, 0.198136f, 0.022319f, -0.053091f, -0.009340f, 0.165172f, 0.093138f, -0.048854f, -0.046245f, -0.041894f, 0.160949f, -0.019902f, -0.360032f, 0.183322f, -0.230981f, 0.112747f, -0.002223f, -0.126880f, -0.374776f, -0.048701f, 0.011497f, 0.045399f, -0.121008f, -0.030585f, 0.067508f, 0.112617f, 0.048317f, 0.006615f, -0.026777f, -0.055677f, -0.252567f, -0.334361f, 0.201267f, -0.341467f, -0.050596f, 0.176722f, -0.227876f, 0.064612f, -0.106739f, -0.144462f, 0.091003f, -0.164800f, 0.116401f, -0.083852f, 0.011773f, 0.185860f, -0.155279f, 0.177574f, -0.073950f, -0.084956f, 0.035961f, 0.096226f, 0.103302f, 0.153748f, 0.120094f, 0.043790f, -0.234998f, -0.166827f, -0.100719f, -0.073073f, -0.101256f, -0.100640f, 0.252113f, -0.106509f, 0.280102f, -0.054684f, 0.183843f, 0.030422f, 0.176100f, -0.105488f, -0.053534f, 0.108415f, 0.099122f, -0.169533f, -0.134357f, -0.045929f, -0.102728f, 0.105615f, -0.147011f, 0.050854f, -0.058554f, 0.060916f, -0.191201f, -0.014203f, 0.223494f, -0.147602f, -0.152256f, 0.070519f, 0.034646f, 0.158076f, 0.036962f, 0.194346f, -0.165353f, 0.181566f, -0.254341f, -0.086650f, 0.182073f, 0.199422f, -0.350372f, -0.073006f, 0.139926f, 0.142291f, -0.111609f, -0.019995f, 0.088162f, 0.126425f, 0.026295f, -0.105581f, 0.161682f, 0.191785f, -0.192304f, -0.545559f, 0.056180f, -0.120196f, -0.114106f, 0.087416f, -0.036196f, -0.005678f, 0.168891f, -0.016097f, 0.125687f, -0.070210f, 0.117607f, 0.189832f, -0.166458f, 0.051268f, -0.372734f, 0.064275f, 0.088794f, -0.115634f, 0.126375f, 0.197330f, -0.125006f, -0.061706f, 0.044344f, -0.061268f, 0.004181f, -0.288259f, 0.043826f, -0.343673f, 0.198252f, 0.150468f, 0.248957f, 0.090664f, 0.331994f, -0.080788f, 0.082892f, 0.023370f, -0.037127f, -0.124516f, 0.026794f, 0.348846f, 0.230646f, -0.332907f, 0.128305f, 0.005622f, -0.104998f, 0.136166f, 0.206088f, 0.012085f, 0.153110f, -0.112004f, -0.031279f, -0.226805f, 0.031786f, 0.008750f, -0.120064f, -0.088363f, -0.074520f, 0.205346f, -0.168064f, -0.204606f, 0.192905f, -0.085978f, 0.233355f, 0.068875f, -0.045049f, -0.035486f, 0.315795f, -0.140126f, -0.191188f, 0.191846f, -0.033251f, 0.176752f, -0.029504f, 0.119843f, -0.127699f, -0.112444f, 0.281047f, -0.126093f, 0.047612f, 0.564639f, -0.087262f, 0.117230f, -0.090184f, 0.180231f, 0.312872f, -0.456505f, -0.057765f, 0.186493f, 0.045198f, -0.189786f, 0.118463f, -0.157178f, -0.175972f, -0.003151f, 0.059059f, 0.227835f, -0.024735f, 0.113426f, 0.042432f, -0.044222f, -0.071503f, 0.295892f, 0.082008f, 0.013155f, 0.311716f, 0.127644f, 0.075552f, 0.114878f, -0.150716f, -0.042174f, 0.037228f, -0.083175f, 0.057534f, -0.001306f, 0.089054f, -0.200025f, -0.074222f, 0.135015f, 0.211951f, -0.250455f, -0.084356f, 0.169962f, 0.013929f, -0.033089f, 0.055297f, -0.143847f, 0.080310f, 0.012095f, 0.084585f, -0.074620f, -0.145038f, -0.021568f, -0.021220f, -0.019735f, 0.052860f, -0.134231f, -0.014568f, -0.118497f, 0.186295f, 0.077199f, -0.223931f, 0.182905f, 0.070811f, 0.060107f, 0.067586f, -0.013005f, -0.219540f, 0.194289f, -0.146904f, 0.045336f, -0.103884f, -0.120078f, 0.084094f, 0.022723f, -0.068992f, 0.188178f, 0.211522f, -0.003799f, -0.120654f, -0.045434f, -0.112681f, -0.178961f, -0.198011f, -0.096935f, -0.014860f, 0.046545f, 0.053316f, 0.138063f, 0.032598f, 0.049088f, 0.091936f, -0.135890f, 0.024410f, 0.236340f, -0.362773f, 0.162841f, -0.069111f, 0.117092f, 0.114951f, 0.206234f, 0.141936f, -0.153264f, -0.069455f, 0.082589f, -0.070133f, -0.150553f, -0.182957f, -0.244371f, 0.086943f, 0.047202f, 0.283927f, -0.027876f, 0.021206f, -0.155114f, -0.092811f, -0.051236f, 0.084364f, 0.040812f, -0.076133f, 0.070508f, 0.231633f, -0.260902f, -0.148535f, -0.018289f, 0.075733f, -0.164277f, 0.088977f, -0.097520f, 0.040884f, -0.076983f, -0.260052f, -0.040741f, -0.053191f, -0.092749f, -0.022092f, -0.024731f, -0.161858f, -0.060385f, -0.152263f, 0.189793f, -0.240957f, -0.022484f, -0.345780f, 0.043932f, -0.169254f, 0.103484f, -0.085450f, -0.104803f, 0.010064f, 0.124882f, 0.089483f, 0.187481f, 0.273622f, 0.039600f, 0.032387f, 0.137941f, -0.117760f, -0.129546f, -0.094159f, -0.490389f, 0.142952f, -0.325251f, -0.196347f, 0.072720f, -0.387997f, -0.058241f, 0.131325f, 0.056290f, -0.061536f, -0.070119f, 0.055597f, -0.118235f, -0.066135f, -0.037861f, -0.274145f, 0.114223f, 0.095504f, -0.243570f, 0.089824f, 0.154620f, 0.062927f, -0.148429f, -0.091360f, 0.140132f, -0.222786f, -0.332628f, 0.093721f, -0.282068f, 0.193048f, 0.241950f, 0.196521f, 0.094687f, 0.133534f, 0.017040f, 0.187891f, -0.069162f, -0.011344f, 0.034381f, -0.072651f, 0.369553f, 0.186686f, -0.201265f, 0.060042f, -0.086636f, 0.170147f, 0.106406f, -0.063806f, 0.193023f, -0.070570f, -0.042789f, -0.066049f, 0.183552f, 0.185653f, -0.129072f, -0.146225f, -0.173821f, 0.092964f, -0.195715f, 0.126930f, -0.072572f, -0.136266f, 0.039409f, -0.335846f, 0.196003f, -0.184450f, 0.191956f, -0.285439f, 0.096342f, 0.045367f, 0.053754f, 0.103562f, 0.158926f, 0.074322f, -0.160133f, 0.015690f, 0.012273f, 0.113450f, 0.105356f, -0.085585f, -0.161254f, 0.158633f, -0.142213f, -0.266380f, 0.178541f, -0.358602f, 0.135997f, -0.063993f, -0.150197f, -0.024738f, 0.094986f, -0.060704f, -0.163893f, -0.150899f, 0.029895f, -0.075815f, 0.132437f, -0.047624f, -0.178889f, -0.137104f, -0.016563f, 0.088280f, -0.168695f, 0.085035f, 0.163662f, -0.053400f, 0.023892f, -0.102124f, -0.254974f, 0.110965f, 0.188480f, 0.241406f, 0.048177f, 0.302330f, -0.089374f, 0.134054f, -0.075890f, 0.216421f, -0.017407f, -0.107857f, 0.439262f, 0.148753f, -0.068813f, -0.184508f, -0.046008f, 0.105989f, 0.120855f, -0.069382f, 0.237963f, 0.189638f, 0.053208f, 0.168884f, -0.117676f, 0.151942f, -0.089520f, 0.060707f, 0.112626f, -0.195131f, -0.131064f, -0.180159f, -0.049317f, -0.225589f, -0.001338f, -0.378196f, -0.028122f, 0.110557f, 0.184134f, -0.225437f, 0.147426f, 0.198121f, 0.146587f, 0.206090f, -0.011530f, 0.132105f, 0.006083f, -0.059817f, 0.066456f, -0.007979f, -0.176710f, 0.070064f, -0.129876f, 0.024480f, -0.081777f, -0.193915f, 0.077296f, -0.020887f, 0.158131f, 0.104493f, 0.033852f, 0.061682f, 0.095477f, -0.009287f, 0.036993f, -0.210917f, 0.222795f, 0.102135f, -0.116093f, 0.086077f, -0.253207f, 0.180149f, -0.069357f, 0.227071f, 0.102839f, -0.032779f, 0.164780f, -0.067183f, -0.113318f, 0.038060f, -0.271527f, -0.134840f, -0.128732f, 0.103381f, -0.051823f, 0.310343f, -0.194040f, -0.096213f, 0.084424f, 0.053573f, 0.205131f, -0.032125f, 0.199467f, 0.018273f, 0.094493f, -0.031224f, -0.023456f, 0.184903f, -0.180740f };
+static const float prediction_next_solar_gen_layer_3_biases[32] = { 0.093262f, 0.134676f, 0.102731f, 0.103082f, 0.145923f, 0.085213f, 0.146564f, -0.172329f, 0.104080f, 0.102202f, 0.000000f, 0.094537f, 0.041350f, 0.129278f, 0.149228f, 0.090839f, 0.104465f, -0.040133f, 0.114787f, -0.154748f, -0.027117f, -0.004228f, 0.123599f, -0.082723f, 0.099073f, -0.051558f, 0.142781f, 0.088869f, -0.056737f, -0.073391f, 0.111268f, 0.065389f };
+static const float prediction_next_solar_gen_layer_3_weights[2560] = { -0.394112f, -0.188281f, -0.082553f, 0.040563f, -0.070935f, 0.217847f, 0.175065f, -0.238375f, 0.000093f, 0.015452f, 0.145028f, -0.199595f, -0.156496f, -0.101947f, 0.191948f, -0.148730f, 0.215479f, 0.139867f, 0.077241f, 0.177751f, -0.146060f, -0.115406f, 0.198295f, 0.051214f, 0.001135f, 0.084588f, 0.081325f, 0.418680f, 0.086496f, -0.012342f, 0.059505f, 0.042116f, 0.056572f, -0.163122f, -0.128858f, 0.046485f, -0.050805f, -0.241223f, 0.260079f, 0.066761f, 0.243761f, -0.156842f, 0.179455f, -0.007749f, -0.059134f, 0.147882f, 0.211844f, -0.124477f, -0.133531f, -0.012286f, -0.063174f, -0.120489f, -0.134208f, 0.056972f, 0.069251f, -0.007803f, 0.021307f, -0.102614f, -0.072790f, -0.215463f, -0.155177f, 0.153701f, -0.097388f, -0.191476f, -0.178705f, -0.051806f, -0.099906f, -0.156984f, -0.121478f, -0.172983f, -0.136416f, 0.112793f, -0.141591f, -0.160977f, 0.172120f, -0.181171f, -0.008807f, -0.002499f, 0.172790f, 0.082595f, -0.102271f, -0.221265f, -0.142143f, -0.037546f, -0.339023f, 0.140366f, -0.134143f, -0.177985f, -0.198333f, 0.182744f, 0.122635f, 0.239623f, 0.238418f, 0.137797f, 0.178765f, 0.050269f, 0.210658f, -0.193564f, 0.222236f, 0.057486f, 0.050418f, 0.263577f, 0.298886f, 0.070263f, 0.038876f, 0.188570f, -0.075730f, 0.094745f, 0.160024f, 0.042924f, -0.181831f, 0.165223f, -0.146677f, -0.123198f, 0.107348f, -0.002011f, -0.120870f, -0.191359f, -0.143446f, 0.181087f, -0.191232f, 0.048476f, 0.022712f, 0.210788f, 0.042892f, 0.098744f, -0.121420f, 0.111606f, -0.204324f, 0.070840f, -0.141813f, 0.052594f, -0.241066f, 0.066917f, 0.046311f, 0.037733f, 0.077215f, 0.189553f, -0.086163f, 0.206713f, 0.060359f, 0.134657f, 0.113119f, 0.218469f, 0.075213f, -0.037994f, 0.182650f, 0.242342f, 0.178107f, -0.008797f, 0.193483f, -0.027638f, 0.052678f, 0.186419f, 0.231741f, 0.027493f, 0.222679f, -0.028507f, -0.134222f, 0.165567f, -0.196300f, -0.015783f, -0.512726f, -0.226352f, -0.356320f, 0.034332f, 0.128523f, 0.073092f, 0.146845f, -0.224850f, 0.064398f, 0.092688f, 0.021412f, 0.034963f, 0.136953f, -0.143263f, 0.068333f, -0.202988f, 0.008930f, -0.072667f, 0.203639f, -0.071934f, 0.274186f, -0.059707f, 0.106606f, 0.086836f, -0.188425f, 0.428353f, 0.234210f, -0.078602f, 0.170666f, -0.084282f, -0.167306f, -0.107383f, 0.150776f, -0.148476f, 0.089247f, -0.038376f, 0.185269f, 0.067909f, 0.080604f, -0.126692f, 0.230069f, 0.017906f, -0.105507f, -0.098761f, 0.171050f, 0.117372f, -0.062520f, -0.119039f, -0.137150f, -0.017761f, -0.074920f, 0.176185f, 0.047690f, 0.121147f, -0.231257f, 0.103992f, -0.173274f, 0.199310f, 0.088878f, 0.044744f, -0.118503f, -0.008504f, 0.231239f, -0.248629f, -0.277708f, -0.089589f, -0.125776f, -0.174491f, -0.133182f, -0.034493f, -0.138705f, 0.150480f, -0.056159f, -0.202217f, 0.193971f, 0.260766f, 0.186318f, 0.193412f, -0.039895f, -0.079500f, 0.093054f, 0.018438f, -0.060289f, 0.071397f, -0.207980f, 0.009736f, 0.084076f, -0.128723f, 0.040530f, 0.085174f, -0.415199f, -0.048125f, 0.036152f, 0.116414f, -0.019565f, 0.083954f, -0.235378f, 0.114820f, 0.091826f, -0.010426f, 0.105912f, -0.141141f, -0.084177f, 0.021763f, -0.160480f, 0.084718f, 0.068201f, -0.032081f, -0.130139f, -0.298615f, -0.290000f, -0.049944f, -0.092149f, 0.082598f, 0.222985f, -0.003265f, -0.121748f, -0.066622f, -0.194990f, 0.100973f, 0.108545f, 0.035592f, 0.035189f, 0.098857f, -0.014590f, -0.123861f, -0.281759f, 0.170767f, 0.193591f, 0.140772f, 0.129333f, -0.056056f, -0.210514f, -0.135480f, -0.159149f, -0.074144f, 0.165501f, -0.120473f, 0.179465f, 0.122770f, 0.048278f, -0.226744f, -0.197837f, 0.158089f, -0.227891f, 0.018125f, 0.108580f, -0.213708f, -0.222363f, 0.243265f, 0.226727f, 0.097949f, -0.139609f, -0.254494f, -0.171638f, -0.117619f, 0.183895f, 0.192840f, 0.025967f, -0.003034f, -0.150950f, 0.067157f, -0.248750f, -0.177332f, -0.152398f, -0.056164f, 0.029944f, 0.055586f, -0.083311f, 0.012137f, 0.275312f, -0.231594f, 0.412557f, 0.137549f, -0.190081f, -0.496221f, 0.083736f, 0.119889f, 0.183071f, 0.061751f, 0.021872f, 0.126443f, 0.202804f, -0.154703f, -0.171103f, 0.270934f, -0.184940f, -0.180355f, 0.141561f, -0.170227f, -0.243306f, 0.099744f, 0.078349f, 0.099825f, 0.186057f, -0.281972f, -0.140642f, 0.086937f, 0.016768f, -0.122198f, -0.091079f, 0.031920f, 0.209953f, -0.082253f, 0.237033f, 0.199716f, -0.021263f, 0.217972f, 0.104930f, 0.047714f, 0.163080f, 0.008153f, 0.034486f, 0.127613f, 0.136921f, -0.029043f, -0.200641f, -0.030333f, -0.115311f, -0.051960f, 0.169446f, -0.126525f, 0.112541f, -0.008225f, -0.062648f, -0.015031f, -0.153523f, 0.053138f, 0.133344f, 0.174786f, -0.036299f, -0.058639f, 0.095118f, 0.209041f, 0.211831f, -0.057077f, 0.051689f, -0.057800f, 0.291068f, -0.082409f, 0.156141f, -0.188648f, 0.198035f, -0.058836f, 0.019100f, -0.010066f, 0.188008f, -0.046779f, 0.149629f, 0.096736f, 0.148005f, 0.218785f, -0.235056f, 0.162636f, -0.012753f, 0.280101f, 0.092672f, -0.086754f, -0.073745f, -0.155271f, 0.176341f, -0.132641f, 0.310271f, -0.216452f, 0.247407f, -0.319876f, -0.024657f, -0.064020f, -0.109337f, -0.436398f, 0.156590f, 0.077921f, -0.108660f, 0.155985f, 0.038232f, 0.137749f, 0.099297f, -0.042444f, -0.055916f, 0.029477f, -0.050275f, 0.013720f, -0.037948f, -0.285307f, -0.220898f, 0.013740f, 0.155972f, -0.020122f, 0.316820f, 0.182527f, -0.072364f, -0.100361f, 0.095148f, 0.012576f, 0.391168f, 0.191774f, -0.052784f, -0.042540f, 0.001438f, -0.006476f, -0.096317f, 0.243063f, -0.129356f, 0.427964f, -0.210141f, 0.223436f, 0.163073f, -0.290054f, -0.193955f, 0.175721f, 0.219445f, 0.112036f, -0.217403f, 0.211052f, 0.286149f, -0.209085f, -0.232525f, -0.097242f, 0.228405f, -0.050961f, -0.071510f, -0.017564f, -0.252663f, 0.069924f, -0.248885f, 0.036488f, 0.188689f, 0.141579f, 0.037656f, -0.126457f, -0.109365f, -0.197957f, 0.330181f, 0.313266f, 0.095092f, -0.247376f, 0.141685f, 0.075328f, 0.122110f, 0.157218f, 0.268538f, -0.212560f, 0.045146f, 0.178883f, -0.023589f, 0.071484f, 0.229450f, 0.039683f, -0.053827f, -0.061996f, -0.018694f, -0.037607f, 0.290589f, -0.186837f, 0.157796f, -0.326386f, 0.093652f, -0.082276f, -0.126452f, -0.059629f, 0.106036f, -0.167602f, 0.078726f, 0.080733f, 0.047101f, -0.059265f, -0.143124f, 0.091590f, 0.221445f, -0.037288f, -0.189045f, -0.217634f, 0.053182f, -0.133734f, -0.112713f, -0.168084f, -0.057717f, -0.039367f, 0.017645f, 0.054887f, 0.143525f, -0.183497f, 0.262005f, 0.090202f, 0.083167f, 0.163919f, -0.107043f, -0.183938f, -0.028981f, -0.057180f, 0.132155f, -0.167329f, 0.145020f, -0.100294f, 0.166008f, 0.049871f, -0.089683f, -0.211940f, 0.043244f, -0.014690f, 0.014030f, -0.083909f, 0.312586f, 0.220129f, 0.083236f, 0.086037f, 0.037609f, -0.240404f, 0.243912f, 0.103790f, 0.018076f, -0.139042f, -0.249357f, -0.285843f, -0.240188f, -0.758888f, 0.080909f, 0.167582f, -0.201691f, -0.177724f, -0.224078f, -0.205302f, -0.041166f, -0.136433f, 0.117837f, -0.085540f, 0.043156f, 0.003800f, 0.120261f, 0.256741f, -0.417970f, 0.167420f, 0.207732f, -0.161504f, -0.047737f, 0.154257f, -0.195374f, 0.110611f, 0.064083f, 0.291825f, -0.153240f, 0.223517f, -0.385483f, 0.121566f, -0.005900f, -0.084198f, 0.231102f, -0.335586f, 0.066374f, -0.131032f, 0.120890f, 0.117963f, -0.262351f, 0.224810f, -0.209510f, -0.142276f, -0.222310f, 0.200436f, -0.069413f, -0.113237f, -0.185158f, -0.240008f, -0.071977f, 0.053757f, 0.235577f, 0.219676f, 0.161182f, 0.170319f, 0.055542f, 0.185331f, -0.060678f, 0.187669f, -0.028154f, 0.116602f, 0.047708f, 0.157974f, 0.261161f, -0.278177f, -0.321806f, -0.154661f, -0.231392f, -0.172752f, -0.283503f, 0.145927f, 0.052225f, 0.054000f, -0.083712f, -0.154746f, 0.212457f, -0.168146f, -0.071601f, -0.092234f, 0.397686f, -0.203038f, -0.125454f, 0.111052f, -0.215187f, -0.089249f, 0.140685f, 0.269878f, -0.042918f, 0.199563f, -0.139236f, -0.056659f, -0.109210f, 0.074254f, 0.065342f, 0.044629f, 0.241234f, -0.010602f, 0.246655f, 0.148289f, 0.133341f, -0.070188f, 0.030227f, -0.300352f, 0.053534f, -0.058437f, 0.138466f, -0.089367f, -0.011253f, -0.043190f, 0.201595f, -0.212813f, 0.182273f, -0.136747f, -0.123179f, -0.089347f, 0.006953f, -0.062092f, 0.075838f, -0.015109f, 0.178352f, -0.065968f, -0.196524f, -0.043423f, -0.018875f, 0.214996f, -0.215197f, 0.173941f, -0.190059f, 0.214487f, 0.016993f, -0.358188f, -0.189312f, -0.205836f, 0.219796f, -0.064220f, 0.107494f, 0.091921f, 0.039261f, 0.037659f, 0.185386f, -0.267549f, 0.184133f, 0.154488f, 0.184516f, 0.077344f, -0.342284f, -0.161108f, -0.209018f, 0.092587f, -0.272438f, -0.133038f, 0.140894f, -0.227801f, 0.103227f, -0.000607f, -0.128914f, 0.178772f, -0.134788f, 0.178211f, 0.286835f, 0.003940f, -0.099912f, -0.233017f, 0.147659f, 0.193898f, 0.051154f, -0.127970f, -0.057671f, -0.150988f, 0.219307f, 0.126949f, -0.083938f, 0.089759f, -0.015558f, 0.127203f, -0.195372f, 0.118527f, 0.277591f, 0.200200f, 0.044918f, 0.188182f, 0.129692f, -0.145355f, -0.093956f, 0.004505f, 0.043401f, 0.091496f, 0.050247f, -0.193615f, 0.115890f, 0.009396f, 0.256452f, 0.218330f, -0.070372f, 0.159277f, -0.032692f, -0.143897f, -0.042782f, 0.191331f, 0.070867f, -0.062814f, -0.290382f, 0.095200f, 0.208149f, 0.183334f, -0.072266f, 0.181728f, 0.160481f, -0.149733f, -0.175584f, -0.254287f, -0.058124f, 0.131364f, 0.181916f, 0.244989f, -0.229562f, -0.070951f, -0.015369f, -0.145293f, -0.094118f, -0.048526f, -0.141678f, -0.165524f, 0.053789f, 0.002171f, -0.124481f, -0.170797f, -0.225988f, -0.130530f, -0.132929f, 0.054529f, -0.045569f, -0.079691f, -0.056651f, -0.170131f, -0.005413f, -0.214374f, -0.048711f, 0.109933f, 0.036595f, -0.210815f, -0.006382f, -0.054457f, -0.112810f, 0.001719f, -0.080509f, -0.033540f, 0.127268f, 0.167265f, 0.064207f, -0.103194f, -0.141244f, 0.066669f, -0.062462f, 0.194938f, 0.164943f, 0.094800f, 0.142707f, -0.138462f, -0.228265f, -0.199367f, 0.096152f, -0.227327f, 0.044984f, 0.017394f, -0.138573f, -0.140695f, 0.177253f, -0.207910f, 0.058305f, -0.147211f, -0.197202f, -0.073084f, 0.144887f, -0.075417f, -0.168694f, 0.186144f, -0.128799f, 0.195377f, 0.049015f, 0.100651f, -0.129707f, -0.214047f, -0.043975f, 0.017749f, 0.100971f, 0.033231f, -0.113224f, -0.132602f, -0.144427f, 0.072446f, -0.127841f, -0.220729f, -0.209989f, 0.219014f, 0.068000f, 0.048054f, -0.045056f, -0.188439f, 0.052517f, -0.126318f, -0.041798f, -0.098852f, 0.161420f, -0.220526f, -0.207384f, -0.269492f, -0.261164f, 0.144305f, -0.101252f, -0.108725f, -0.203120f, -0.082956f, -0.191475f, 0.050547f, 0.142855f, -0.183648f, 0.228266f, 0.059980f, 0.215349f, 0.229827f, 0.023523f, -0.247264f, -0.208786f, 0.123373f, -0.013833f, 0.092083f, 0.181906f, -0.177328f, 0.068558f, -0.102729f, 0.155476f, 0.338794f, 0.184868f, -0.200841f, 0.013461f, 0.279489f, -0.073545f, -0.050215f, 0.097299f, -0.127550f, -0.060837f, -0.188711f, 0.252543f, 0.209715f, 0.143300f, -0.060714f, 0.120120f, -0.063165f, -0.094319f, 0.198841f, 0.120828f, 0.174302f, -0.174601f, -0.084710f, -0.006393f, 0.022060f, 0.137943f, -0.093333f, 0.203573f, 0.175100f, 0.203871f, -0.215931f, -0.041872f, 0.031448f, -0.090298f, 0.179547f, -0.210139f, 0.181629f, -0.076985f, 0.090047f, -0.205914f, -0.167669f, 0.079321f, 0.267431f, -0.156296f, -0.223085f, -0.066952f, 0.216673f, 0.117362f, -0.064361f, 0.187464f, 0.242656f, -0.159907f, 0.137802f, -0.061423f, -0.321971f, -0.181372f, -0.156189f, -0.377171f, -0.202560f, -0.023111f, -0.370974f, -0.233999f, -0.167881f, 0.240243f, -0.129887f, -0.119708f, 0.167444f, 0.393254f, -0.022192f, -0.139550f, 0.097420f, -0.007591f, 0.198564f, 0.074550f, 0.118846f, -0.111832f, 0.020602f, -0.169947f, 0.088498f, -0.420150f, 0.103652f, -0.230700f, -0.010042f, 0.081717f, -0.011366f, -0.042127f, -0.198222f, 0.040081f, -0.146606f, 0.133770f, -0.065798f, -0.099850f, -0.173701f, -0.129687f, 0.228415f, -0.035229f, 0.001529f, 0.116105f, 0.141530f, 0.143790f, 0.029810f, -0.142964f, 0.067087f, 0.120141f, 0.089918f, -0.281923f, -0.013050f, -0.051419f, -0.113237f, 0.189964f, -0.131256f, 0.047420f, -0.095483f, 0.103096f, -0.166822f, 0.021215f, -0.143914f, -0.082235f, 0.032965f, -0.263591f, -0.174201f, -0.170619f, -0.154501f, -0.255415f, 0.291069f, -0.128152f, 0.086287f, -0.216812f, -0.026392f, 0.167938f, 0.134324f, 0.061463f, 0.195578f, -0.262147f, -0.249705f, -0.597393f, -0.163964f, -0.111305f, -0.132142f, 0.021595f, 0.049195f, -0.155480f, -0.043686f, 0.166320f, 0.088607f, -0.002043f, 0.222098f, 0.437968f, 0.065971f, 0.115751f, -0.037387f, -0.171270f, 0.070591f, 0.140222f, -0.133537f, 0.161298f, 0.231882f, -0.083865f, -0.225224f, -0.115085f, 0.424841f, -0.054370f, 0.242125f, 0.034692f, 0.224361f, -0.195630f, -0.150513f, 0.143810f, 0.180084f, 0.262172f, -0.101527f, 0.079765f, 0.041500f, -0.191554f, 0.136060f, -0.038181f, 0.138824f, 0.203879f, -0.156416f, -0.139403f, -0.119030f, 0.148633f, 0.104612f, -0.210055f, -0.080099f, -0.076086f, -0.099352f, -0.028409f, -0.189106f, -0.107320f, 0.220952f, 0.023492f, -0.163405f, 0.165885f, -0.069166f, 0.180443f, 0.100540f, 0.159106f, -0.234459f, 0.125473f, -0.102584f, -0.009134f, -0.103757f, -0.113761f, -0.028698f, -0.179405f, -0.092920f, 0.079158f, -0.248772f, 0.103303f, 0.173837f, 0.239885f, 0.052524f, -0.120864f, 0.174759f, -0.108196f, 0.062535f, -0.284271f, 0.245894f, -0.056298f, -0.044714f, 0.163008f, 0.168205f, 0.042094f, 0.269640f, 0.239940f, -0.172580f, 0.022908f, 0.178505f, 0.187526f, -0.235579f, 0.244770f, 0.094271f, 0.194148f, 0.227341f, -0.083613f, 0.059809f, -0.027539f, -0.154777f, 0.021317f, 0.155774f, 0.029677f, 0.274563f, -0.016288f, 0.019949f, 0.239804f, -0.126666f, 0.077309f, 0.098903f, 0.080001f, -0.281838f, 0.127122f, -0.005179f, 0.050299f, 0.325984f, 0.226826f, 0.209255f, -0.032192f, 0.104410f, 0.269311f, 0.220925f, -0.006516f, 0.186646f, -0.219643f, 0.101150f, 0.172175f, -0.120827f, -0.111093f, 0.189083f, 0.151772f, -0.192272f, 0.088516f, 0.218174f, 0.141539f, 0.020324f, -0.187786f, 0.010710f, 0.143610f, -0.096403f, -0.010890f, -0.123020f, 0.044532f, 0.034430f, 0.216518f, -0.238380f, 0.292659f, 0.184588f, -0.127710f, -0.066986f, 0.121861f, 0.109854f, 0.269408f, 0.167147f, -0.171510f, 0.111616f, -0.484255f, 0.074610f, 0.101479f, -0.114731f, -0.102917f, -0.073488f, 0.221532f, 0.074196f, -0.152500f, -0.136406f, 0.066220f, 0.085676f, 0.154502f, 0.000711f, 0.158644f, -0.283646f, -0.164857f, 0.145491f, 0.181231f, -0.054154f, -0.025244f, -0.127464f, -0.098441f, 0.216126f, -0.000194f, 0.003847f, -0.253704f, -0.054696f, -0.009667f, 0.182175f, -0.143963f, -0.237237f, 0.143146f, 0.134072f, 0.216423f, 0.100217f, 0.200913f, -0.050964f, 0.005770f, 0.227888f, -0.190584f, 0.117872f, 0.040379f, 0.199584f, 0.088173f, 0.084705f, -0.263928f, -0.188840f, -0.202128f, 0.116208f, -0.073455f, 0.144891f, -0.186531f, -0.033675f, -0.216311f, -0.118006f, 0.132274f, 0.201055f, -0.095360f, 0.054090f, 0.132672f, -0.222986f, 0.241850f, -0.270266f, 0.095639f, -0.000785f, -0.054676f, -0.057513f, 0.130201f, 0.136634f, 0.040544f, 0.018199f, 0.212149f, -0.201479f, 0.214794f, 0.141006f, 0.027800f, 0.170219f, -0.068143f, 0.087576f, -0.555726f, 0.222476f, -0.253692f, -0.164153f, -0.140783f, -0.037200f, -0.062684f, 0.041226f, 0.218664f, -0.090863f, -0.232030f, -0.123569f, 0.011621f, 0.113660f, 0.188407f, -0.302114f, 0.229939f, 0.086848f, -0.185158f, -0.098040f, 0.172322f, 0.193286f, 0.119151f, -0.055742f, -0.239579f, 0.289076f, -0.092969f, -0.016968f, -0.185346f, -0.016493f, 0.238239f, -0.054943f, 0.152478f, -0.028094f, 0.156131f, -0.027095f, 0.094786f, 0.255084f, -0.157505f, -0.031286f, 0.061841f, 0.033855f, -0.177959f, 0.027173f, 0.235482f, 0.100664f, 0.064747f, -0.096059f, -0.289013f, 0.109689f, 0.176990f, -0.081495f, 0.028461f, 0.038699f, 0.047765f, 0.090880f, 0.211363f, 0.165778f, -0.195250f, 0.103166f, -0.043489f, 0.113512f, 0.061103f, -0.255119f, -0.191515f, -0.065488f, 0.094125f, -0.090239f, -0.069859f, 0.024412f, -0.102450f, 0.150347f, 0.195066f, -0.398497f, 0.065261f, 0.099491f, 0.172985f, 0.164919f, 0.196320f, -0.080003f, -0.218978f, -0.147519f, 0.115625f, 0.163708f, -0.220937f, -0.190884f, 0.161904f, 0.003795f, 0.184373f, -0.124133f, 0.105276f, 0.225266f, -0.241342f, 0.131469f, -0.241478f, 0.141733f, 0.142375f, 0.000772f, -0.184594f, -0.094732f, 0.037260f, 0.173527f, 0.009258f, 0.032048f, -0.150243f, 0.052327f, -0.041679f, -0.124748f, 0.119489f, 0.019477f, -0.113581f, -0.035976f, -0.019411f, -0.173925f, -0.024305f, -0.035190f, -0.248855f, 0.049762f, -0.085447f, 0.039212f, -0.204927f, -0.246287f, 0.148600f, 0.034499f, -0.137160f, 0.192895f, 0.172826f, 0.056980f, -0.169665f, 0.048450f, -0.124698f, 0.002156f, -0.108203f, 0.200998f, -0.154704f, -0.062826f, -0.101281f, 0.125673f, -0.070509f, -0.147145f, 0.216560f, 0.015319f, 0.027240f, -0.216136f, -0.106438f, 0.005147f, 0.138314f, 0.008059f, 0.047542f, 0.071932f, 0.206612f, 0.023729f, 0.033813f, 0.110981f, -0.185124f, 0.202877f, -0.115525f, -0.060304f, -0.034513f, -0.243689f, -0.399234f, 0.168235f, -0.371072f, 0.157378f, 0.030177f, -0.173095f, 0.076654f, 0.128521f, 0.276399f, -0.041853f, 0.056425f, 0.075596f, 0.402252f, -0.193217f, 0.077693f, 0.065904f, 0.117738f, 0.222159f, 0.124762f, 0.209987f, 0.044396f, -0.026144f, 0.033883f, -0.200068f, -0.115603f, 0.235843f, 0.175509f, 0.146556f, 0.122325f, 0.238651f, -0.187797f, 0.012120f, -0.112038f, 0.033995f, 0.124204f, -0.277516f, 0.028167f, 0.028683f, 0.210706f, 0.244149f, 0.166904f, -0.140073f, 0.066300f, -0.034184f, 0.226662f, -0.118745f, 0.150813f, -0.128389f, -0.073186f, 0.152777f, 0.055808f, 0.110847f, 0.090095f, 0.052883f, -0.092600f, 0.102852f, 0.148693f, 0.000627f, 0.078518f, -0.116663f, 0.242057f, -0.134925f, -0.142003f, -0.104745f, -0.184248f, 0.180076f, -0.033271f, -0.085316f, 0.163323f, -0.023339f, 0.133528f, -0.127572f, 0.230124f, -0.293712f, 0.135826f, 0.157862f, 0.187850f, -0.094291f, 0.139534f, 0.011866f, 0.247174f, 0.041469f, -0.030420f, 0.124928f, 0.209382f, 0.291068f, -0.149046f, 0.029825f, -0.064331f, -0.028628f, -0.322904f, 0.041762f, -0.025142f, 0.040191f, -0.116657f, 0.320011f, -0.011373f, 0.139941f, -0.054257f, 0.037101f, 0.067406f, 0.109402f, -0.066577f, -0.157775f, 0.027980f, 0.100324f, -0.239053f, -0.250949f, -0.188621f, 0.026447f, 0.314917f, -0.155961f, -0.048824f, -0.264607f, 0.036537f, -0.103030f, 0.101853f, 0.176628f, 0.149748f, -0.057056f, -0.016751f, -0.057975f, -0.212991f, -0.130071f, -0.047344f, 0.064578f, 0.161266f, 0.204481f, 0.239547f, -0.221338f, 0.040393f, -0.131475f, -0.147066f, -0.126829f, 0.073505f, -0.228817f, 0.188243f, -0.146752f, 0.166176f, -0.188097f, 0.188607f, -0.191831f, -0.004389f, -0.020931f, 0.286967f, 0.037337f, -0.009984f, 0.233558f, -0.076913f, 0.047194f, -0.143974f, -0.091525f, 0.207775f, 0.142393f, -0.040735f, -0.121390f, 0.070332f, 0.189770f, 0.077824f, -0.135462f, 0.051498f, -0.196226f, -0.239463f, -0.153279f, -0.187511f, -0.119727f, 0.150860f, -0.100219f, -0.012850f, 0.124069f, -0.212884f, -0.069196f, -0.012668f, -0.070367f, 0.177672f, -0.034077f, 0.094389f, 0.206137f, 0.185876f, 0.086292f, 0.007577f, -0.019080f, -0.015803f, 0.182371f, 0.043400f, -0.172733f, 0.130670f, -0.032249f, -0.104801f, -0.138552f, 0.063103f, 0.096926f, 0.142347f, -0.033507f, 0.160772f, -0.087778f, -0.256055f, 0.106374f, -0.007462f, -0.199807f, -0.163381f, -0.088047f, 0.064332f, -0.217952f, 0.125023f, -0.169446f, 0.003446f, -0.221776f, 0.035084f, -0.218203f, 0.008737f, -0.112268f, 0.060439f, -0.072064f, 0.091783f, -0.056860f, 0.200878f, -0.103790f, -0.240182f, 0.052117f, 0.091553f, -0.004962f, -0.093634f, -0.160924f, -0.074803f, 0.028314f, -0.200933f, -0.071672f, 0.091276f, 0.034870f, -0.312500f, -0.053076f, -0.213601f, -0.036938f, -0.267032f, 0.174350f, -0.117892f, -0.212946f, -0.041354f, -0.120675f, 0.320125f, 0.047703f, -0.033667f, -0.157422f, -0.117592f, 0.069053f, -0.261768f, -0.332903f, 0.012776f, -0.224851f, -0.206618f, 0.015621f, -0.126097f, -0.115418f, 0.175322f, 0.408307f, -0.192346f, 0.174241f, 0.031813f, 0.150935f, -0.030364f, -0.221963f, -0.258402f, -0.227251f, 0.155729f, -0.194483f, 0.237586f, -0.226761f, 0.067875f, 0.243804f, 0.695741f, -0.231836f, -0.069915f, -0.012808f, -0.183863f, 0.300019f, 0.022734f, -0.052611f, 0.133163f, -0.068040f, 0.282005f, 0.107120f, 0.103181f, -0.271673f, -0.077607f, -0.141489f, -0.296243f, 0.203511f, 0.004146f, 0.060110f, -0.085150f, 0.000549f, 0.070705f, 0.182138f, -0.032066f, -0.171060f, -0.180454f, -0.211651f, -0.231152f, -0.169220f, -0.241998f, -0.290261f, -0.064877f, 0.044114f, -0.094731f, -0.122452f, 0.029751f, -0.223813f, -0.063085f, 0.071513f, 0.203104f, 0.159466f, -0.138541f, -0.021848f, -0.295603f, -0.039982f, 0.257567f, -0.209506f, 0.020628f, -0.250063f, -0.083955f, -0.067841f, -0.147813f, 0.115577f, -0.156712f, -0.106931f, 0.133310f, 0.179204f, 0.065905f, -0.192276f, 0.196364f, 0.081872f, 0.014541f, 0.148008f, 0.183566f, -0.317955f, -0.058547f, 0.157344f, 0.015369f, 0.180707f, 0.262092f, 0.075659f, 0.134820f, 0.195607f, 0.093605f, 0.256146f, -0.035735f, 0.078750f, 0.125197f, 0.220887f, -0.212328f, -0.155422f, 0.265756f, -0.172524f, -0.155592f, -0.109133f, 0.178655f, -0.116334f, 0.186956f, 0.115185f, -0.094388f, 0.051027f, 0.210693f, 0.100564f, 0.166166f, 0.207985f, 0.037902f, -0.025807f, -0.180641f, 0.111870f, -0.095567f, 0.061739f, 0.144017f, -0.019961f, 0.285121f, 0.028429f, 0.191491f, 0.204385f, -0.095359f, 0.089611f, -0.085723f, -0.087516f, -0.003171f, -0.154095f, -0.048723f, 0.176276f, -0.178644f, 0.078832f, -0.178628f, 0.159687f, -0.189341f, 0.082023f, 0.113895f, -0.033542f, 0.132102f, 0.062757f, 0.231406f, -0.196278f, 0.142066f, -0.095174f, -0.060366f, -0.226212f, 0.173832f, -0.087724f, 0.200003f, 0.324077f, 0.072080f, 0.145252f, -0.136417f, 0.197359f, -0.193340f, -0.375135f, -0.241172f, 0.004902f, 0.002264f, 0.013243f, 0.027106f, 0.049057f, -0.019593f, -0.187919f, -0.048066f, 0.177665f, 0.226388f, 0.108224f, 0.235448f, -0.263378f, 0.076950f, -0.075014f, 0.187464f, 0.239352f, -0.155558f, 0.071511f, -0.056633f, 0.105166f, 0.050211f, 0.298545f, -0.010288f, 0.137931f, -0.128986f, 0.234031f, -0.067141f, 0.186182f, -0.029849f, 0.192154f, 0.154962f, -0.157342f, 0.192531f, -0.045216f, -0.115582f, -0.148011f, 0.034337f, -0.148541f, -0.038799f, -0.090813f, -0.143367f, 0.113906f, -0.157474f, -0.010633f, -0.204496f, -0.080959f, -0.214951f, 0.145489f, -0.069867f, 0.238840f, 0.189421f, -0.047590f, 0.089127f, 0.039024f, -0.038551f, -0.257338f, 0.019592f, -0.084959f, 0.044210f, 0.281463f, 0.126742f, 0.001737f, -0.111340f, -0.206709f, -0.272459f, 0.011514f, -0.381306f, 0.212561f, -0.026167f, 0.032157f, -0.049472f, 0.110803f, 0.074975f, 0.013609f, 0.165635f, -0.010116f, -0.171120f, -0.164132f, 0.244912f, -0.158347f, -0.166414f, -0.320895f, -0.138764f, 0.190222f, -0.103342f, -0.095199f, 0.381187f, -0.191357f, 0.075674f, -0.096410f, -0.200156f, 0.451802f, 0.217917f, -0.117311f, -0.169965f, 0.203626f, 0.180098f, -0.078760f, 0.109968f, 0.180729f, 0.097682f, -0.113986f, 0.215993f, 0.117264f, -0.178452f, 0.275658f, -0.149294f, -0.203404f, 0.100297f, -0.020008f, 0.232369f, 0.062008f, 0.031229f, -0.217330f, -0.180871f, 0.043324f, -0.226403f, -0.178417f, -0.083091f, 0.064184f, -0.054637f, 0.103803f, 0.224556f, 0.032224f, 0.043386f, 0.124582f, 0.176316f, -0.224789f, -0.008068f, -0.097451f, -0.109195f, 0.125997f, 0.197085f, 0.033519f, 0.217091f, -0.045357f, 0.127551f, 0.163020f, -0.054576f, -0.365439f, 0.048053f, -0.103496f, -0.010710f, 0.102262f, -0.172688f, 0.128177f, 0.160626f, -0.032941f, 0.078916f, 0.220423f, 0.048323f, 0.358472f, 0.005525f, 0.004967f, 0.095606f, 0.030319f, -0.398028f, -0.141884f, 0.145627f, -0.301079f, -0.106135f, 0.126707f, -0.055536f, -0.101782f, 0.191716f, 0.028380f, -0.112312f, 0.064858f, -0.072897f, -0.132858f, 0.253255f, 0.159092f, 0.022693f, 0.197320f, 0.032585f, 0.207427f, -0.024284f, 0.133509f, -0.126573f, -0.183717f, -0.115908f, -0.097091f, -0.281759f, -0.164648f, -0.043336f, -0.051088f, 0.022824f, -0.152359f, -0.116576f, -0.034015f, 0.008179f, -0.241141f, 0.194302f, 0.122021f, 0.159685f, -0.155903f, 0.260580f, 0.161965f, 0.059550f, 0.092746f, 0.103500f, -0.069381f, 0.075741f, 0.151752f, -0.188738f, 0.014851f, 0.087960f, -0.208827f, -0.183777f, 0.142524f, -0.149776f, 0.150840f, 0.155525f, 0.131128f, -0.087142f, 0.024945f, -0.130629f, -0.106411f, 0.154477f, 0.041737f, 0.030560f, -0.066452f, 0.106137f, -0.087307f, 0.081430f, -0.215494f, -0.029407f, -0.171227f, -0.059367f, -0.196496f, -0.172774f, -0.051709f, -0.075657f, 0.202000f, 0.058695f, 0.212126f, 0.241562f, 0.078561f, 0.008695f, 0.242559f, 0.246305f, -0.107834f, -0.198427f, 0.210918f, 0.163714f, 0.126966f, 0.186834f, -0.230387f, -0.181120f, -0.144485f, 0.142263f, 0.028440f, 0.036069f, -0.005816f, -0.029142f, 0.188452f, -0.139090f, -0.161304f, 0.088322f, 0.108320f, 0.058087f, -0.118730f, -0.118341f, -0.046885f, -0.061868f, -0.108773f, -0.133189f, -0.097084f, 0.023804f, 0.052458f, -0.087800f, -0.037079f, -0.073588f, 0.194724f, 0.021888f, 0.062860f, -0.089251f, -0.081680f, 0.129590f, 0.164937f, -0.049438f, -0.131037f, 0.196305f, 0.130240f, 0.067760f, 0.099253f, 0.109854f, 0.062029f, 0.185721f, -0.112293f, -0.000931f, 0.023837f, 0.105510f, 0.201115f, -0.146809f, 0.090618f, -0.186943f, 0.053492f, 0.055589f, -0.128750f, 0.259035f, 0.017780f, 0.230079f, -0.177382f, -0.257578f, -0.288614f, -0.268614f, 0.136777f, -0.132988f, 0.193161f, -0.023284f, 0.176695f, 0.132174f, 0.068925f, -0.161529f, 0.216296f, -0.156849f, -0.114990f, 0.156573f, -0.079545f, -0.015081f, -0.234448f, 0.141649f, 0.178916f, -0.205867f, 0.035484f, 0.119930f, 0.155432f, 0.189226f, -0.212907f, -0.288258f, 0.366588f, -0.114205f, 0.142201f, 0.039895f, 0.276298f, 0.175267f, 0.112814f, -0.183706f, -0.000719f, -0.143337f, -0.314203f, 0.021571f, -0.057495f, -0.003840f, 0.166459f, -0.042425f, -0.103150f, 0.146781f, 0.034482f, 0.251022f, 0.224387f, -0.111791f, 0.183285f, -0.173564f, -0.092458f, -0.222133f, 0.165284f, 0.209186f, 0.225382f, -0.172295f, -0.154945f, -0.105466f, 0.086410f, -0.128161f, 0.046604f, 0.048055f, 0.070602f, 0.091468f, -0.186595f, 0.137538f, 0.102009f, 0.219443f, 0.192099f, -0.060506f, -0.002644f, -0.194852f, 0.094945f, -0.175976f, -0.050674f, 0.001365f, 0.202239f, -0.054217f, -0.106940f, -0.167560f, -0.222847f, -0.199171f, 0.093258f, -0.004125f, -0.016678f, 0.067253f, 0.176293f, -0.013554f, -0.159642f, -0.203767f, 0.095654f, 0.089656f, -0.120522f, 0.126257f, 0.252378f, -0.001103f, -0.135665f, -0.113632f, 0.061966f, 0.116046f, -0.006661f, 0.138574f, -0.160358f, -0.192922f, 0.130410f, -0.183505f, 0.006236f, 0.047478f, -0.012223f, 0.107042f, -0.013115f, 0.123142f, -0.015787f, -0.012530f, 0.059860f, -0.103950f, 0.009203f, 0.026718f, -0.153909f, 0.043461f, 0.279724f, 0.114634f, 0.179902f, -0.049557f, -0.078573f, -0.204983f, -0.000509f, 0.144098f, -0.031966f, 0.038849f, -0.025701f, -0.146539f, -0.079536f, -0.210236f, 0.027498f, -0.130075f, 0.147554f, 0.023611f, -0.223524f, -0.012697f, -0.187994f, -0.061377f, 0.120692f, -0.098558f, 0.082690f, -0.020035f, 0.017278f, 0.150880f, -0.247939f, -0.000448f, 0.157989f, -0.326444f, -0.210455f, 0.034687f, 0.030051f, -0.009896f, -0.019352f, -0.022183f, 0.058100f, -0.013562f, -0.067055f, 0.336583f, -0.217563f, 0.346249f, -0.166055f, 0.321422f, 0.248027f, -0.158964f, 0.103121f, -0.122100f, 0.204281f, -0.408494f, 0.108702f, -0.265155f, -0.125412f, 0.092991f, 0.314648f, 0.205668f, -0.042673f, -0.004291f, -0.181922f, -0.193550f, 0.000706f, -0.131890f, -0.108644f, 0.174773f, -0.121082f, 0.201191f, -0.016531f, -0.037044f, 0.039755f, 0.150555f, 0.169772f, -0.187633f, -0.160415f, -0.209610f, 0.339370f, -0.094623f, 0.025717f, -0.020833f, -0.058503f, 0.078872f, -0.043044f, -0.132200f, 0.022710f, -0.022932f, 0.170990f, -0.092584f, 0.184528f, 0.211384f, -0.002145f, -0.068870f, -0.174468f, -0.203817f, -0.178204f, 0.013848f, 0.057563f, -0.074871f, -0.178236f, 0.034302f, -0.195329f, -0.208676f, -0.116655f, 0.096780f, -0.002952f, -0.137781f, 0.144948f, 0.092239f, -0.052650f, -0.059206f, 0.221368f, -0.203495f, -0.086728f, 0.062333f, -0.025523f, -0.054307f, 0.192480f, 0.212138f, -0.143302f, 0.071787f, 0.137107f, -0.220027f, -0.139975f, -0.363249f, 0.105362f, -0.063331f, -0.137231f, -0.084676f, -0.168731f, -0.089071f, 0.227537f, 0.111613f, 0.184145f, 0.005441f, -0.135073f, -0.040032f, 0.059318f, 0.036696f, 0.125768f, 0.215353f, 0.150156f, 0.197984f, -0.002682f, 0.079195f, 0.216902f, 0.048925f, 0.224776f, -0.218011f, 0.117801f, 0.128990f, 0.249674f, -0.126115f, 0.065938f, 0.120822f, 0.069731f, 0.046102f, -0.153848f, 0.138189f, 0.034982f, 0.076247f, -0.030119f, 0.132209f, -0.014210f, 0.106189f, -0.205023f, 0.204382f, 0.056405f, -0.137235f, -0.084561f, 0.204523f, 0.004286f, -0.074714f, 0.053548f, 0.005211f, -0.078732f, -0.168869f, 0.019763f, -0.071256f, 0.098145f, 0.201863f, -0.016011f, -0.040820f, 0.172103f, -0.023593f, 0.006074f, 0.000598f, 0.094231f, -0.129993f, 0.019686f, 0.031884f, -0.109471f, 0.032709f, -0.152045f, 0.174222f, -0.144181f, 0.013185f, -0.098724f, -0.059690f, 0.098577f, -0.113196f, -0.104584f, -0.223465f, -0.009632f, -0.048469f, -0.156441f, -0.257847f, -0.253273f, 0.041049f, -0.158937f, 0.151048f, 0.128653f, 0.126083f, 0.026491f, 0.004374f, 0.133317f, 0.031102f, 0.035572f, -0.147382f, -0.068665f, 0.057643f, 0.277369f, 0.008396f, -0.084111f, 0.192857f, 0.151117f, -0.440794f, 0.301572f, -0.081505f, -0.035694f, -0.143246f, 0.171186f, -0.103699f, -0.002082f, -0.195457f, -0.024653f, 0.095644f, -0.055008f, 0.274794f, 0.077902f, 0.075457f, 0.152448f, 0.136668f, 0.049238f, -0.049523f, 0.032531f, -0.065104f, -0.159208f, -0.104415f, -0.000594f, 0.113174f, 0.049642f, 0.110433f, 0.102570f, -0.130350f, -0.026275f, -0.158529f, 0.227813f, 0.247021f, -0.018728f, 0.171511f, -0.061620f, 0.025931f, 0.163844f, -0.176427f, 0.104827f, -0.360774f, -0.191364f, 0.156159f, -0.380291f, -0.284992f, 0.080909f, -0.231011f, 0.073723f, -0.192059f, -0.012896f, 0.043465f, -0.171478f, 0.116966f, 0.037298f };
+static const float prediction_next_solar_gen_layer_4_biases[80] = { -0.076676f, -0.072064f, -0.034724f, 0.129978f, 0.135907f, -0.002719f, 0.181693f, 0.052326f, -0.015792f, 0.116110f, 0.062532f, 0.141777f, -0.000481f, 0.149216f, -0.023773f, 0.213418f, -0.061858f, 0.167493f, 0.119940f, -0.035416f, 0.105143f, -0.016086f, 0.091106f, 0.161518f, 0.141032f, -0.010498f, 0.008306f, -0.066699f, 0.137166f, 0.086469f, 0.112918f, -0.000203f, 0.115575f, -0.040763f, -0.018370f, -0.130035f, -0.059074f, -0.047857f, 0.023081f, -0.026439f, 0.168893f, 0.129783f, 0.143362f, 0.143939f, 0.144219f, -0.066461f, 0.045786f, -0.033473f, 0.134890f, 0.135171f, -0.134691f, 0.158960f, -0.024394f, 0.151457f, 0.147502f, -0.139134f, -0.162147f, -0.011141f, -0.050353f, 0.233314f, 0.082968f, -0.073038f, -0.121853f, 0.091092f, -0.028050f, 0.114130f, 0.145511f, -0.031530f, 0.115476f, 0.160361f, -0.033736f, 0.043606f, 0.141711f, 0.152459f, 0.128300f, 0.165571f, 0.152696f, -0.160707f, 0.123226f, 0.130308f };
+static const float prediction_next_solar_gen_layer_4_weights[2560] = { 0.263117f, 0.036433f, -0.043603f, 0.117555f, -0.249161f, -0.041340f, 0.110320f, 0.138124f, 0.239843f, 0.077021f, -0.022414f, -0.172285f, 0.246581f, -0.067183f, 0.008084f, -0.211005f, -0.078436f, -0.162096f, 0.035896f, -0.254618f, -0.208772f, -0.070339f, -0.099119f, -0.259977f, -0.048355f, 0.088640f, 0.101797f, -0.118720f, 0.095374f, 0.097319f, 0.051196f, 0.140372f, -0.170689f, -0.204461f, -0.073479f, -0.004086f, -0.319970f, 0.086851f, -0.224485f, 0.077467f, -0.288841f, 0.153639f, 0.164490f, -0.309387f, -0.131284f, -0.202413f, 0.255040f, 0.229962f, 0.011456f, 0.032521f, 0.186108f, -0.077473f, -0.110394f, -0.183956f, 0.004735f, 0.195178f, 0.062947f, 0.014870f, -0.285622f, 0.028048f, 0.104925f, 0.076175f, -0.109835f, 0.196898f, 0.053555f, -0.234125f, 0.036898f, -0.331882f, -0.102921f, 0.098468f, 0.121217f, -0.127055f, -0.096656f, -0.137026f, -0.186548f, -0.147632f, -0.073295f, 0.080383f, -0.057876f, -0.160943f, -0.063367f, -0.130156f, 0.021076f, -0.333969f, -0.080220f, -0.150442f, 0.140458f, -0.123649f, 0.018592f, -0.100017f, 0.007876f, -0.192623f, 0.008067f, -0.349672f, -0.006262f, -0.230020f, 0.094765f, -0.173152f, -0.074056f, 0.151222f, 0.104809f, -0.133041f, 0.181988f, -0.051397f, 0.162086f, -0.191326f, 0.168178f, -0.185260f, -0.097550f, 0.052362f, 0.064657f, -0.121154f, 0.066536f, 0.285026f, -0.049161f, -0.100026f, 0.149474f, -0.119693f, 0.101936f, -0.200815f, 0.241065f, 0.005901f, 0.057775f, 0.175655f, -0.206830f, -0.084059f, 0.185928f, 0.281776f, 0.037966f, -0.108299f, -0.040758f, -0.130270f, 0.202953f, -0.271647f, 0.187340f, -0.275022f, 0.267797f, 0.105903f, 0.144090f, -0.069535f, 0.242984f, 0.060513f, 0.233825f, 0.160777f, 0.073518f, 0.076726f, 0.123096f, 0.049688f, -0.045908f, -0.189620f, 0.106117f, 0.218555f, 0.052013f, 0.114586f, 0.061697f, -0.177593f, 0.181150f, 0.080163f, 0.192468f, 0.225192f, -0.019759f, 0.126181f, -0.034007f, 0.054384f, 0.193951f, 0.205971f, 0.175882f, 0.456257f, -0.060824f, -0.220465f, -0.150785f, 0.154418f, 0.113349f, 0.086034f, -0.220071f, -0.049618f, -0.190661f, 0.171975f, -0.115946f, -0.128424f, -0.147587f, -0.022769f, 0.163423f, -0.005462f, -0.224001f, 0.229730f, 0.136707f, -0.320189f, 0.263691f, 0.316812f, -0.125062f, 0.073730f, -0.018265f, -0.131181f, -0.082344f, -0.117779f, -0.127827f, 0.042164f, 0.224859f, -0.130572f, -0.065334f, 0.222039f, -0.208091f, 0.093178f, 0.080094f, 0.102888f, 0.037795f, -0.071520f, 0.182043f, -0.240653f, 0.036124f, -0.087175f, 0.013929f, -0.519755f, 0.149745f, 0.058675f, 0.099730f, 0.037443f, 0.214105f, -0.153089f, -0.037466f, 0.087343f, 0.083685f, 0.178050f, 0.023095f, 0.084999f, -0.215121f, 0.184227f, 0.210732f, -0.044176f, 0.053851f, -0.154209f, 0.042920f, 0.211358f, -0.163711f, -0.258870f, 0.037780f, -0.144222f, 0.099336f, -0.226434f, -0.105403f, 0.102029f, 0.052771f, -0.170090f, -0.205722f, 0.191290f, 0.176526f, -0.254167f, -0.181372f, 0.189888f, -0.073112f, -0.155720f, -0.252884f, -0.090478f, -0.225955f, -0.095576f, 0.052677f, -0.044751f, -0.072572f, 0.130865f, 0.098143f, -0.191558f, -0.133139f, -0.004817f, -0.123534f, 0.196119f, -0.222041f, -0.013966f, -0.122164f, -0.235140f, 0.021815f, -0.062977f, -0.110717f, -0.097239f, 0.010489f, -0.100381f, -0.154548f, -0.088083f, 0.166707f, 0.057035f, -0.040529f, -0.231888f, -0.096280f, 0.086103f, 0.201457f, -0.135798f, -0.104754f, 0.204926f, -0.085651f, 0.068130f, 0.248206f, -0.197717f, 0.100297f, -0.432071f, 0.208418f, 0.110617f, -0.018155f, -0.096837f, -0.147751f, 0.097822f, 0.002185f, -0.009813f, -0.128933f, 0.092582f, 0.161031f, -0.163656f, -0.112111f, -0.099883f, 0.217741f, 0.128691f, -0.049803f, -0.237744f, 0.075194f, -0.202307f, -0.105703f, 0.106979f, -0.034956f, -0.131290f, 0.198854f, 0.143871f, 0.109661f, 0.167411f, 0.010213f, 0.069898f, 0.191113f, -0.425058f, 0.093898f, 0.116358f, -0.174602f, -0.088545f, -0.218586f, 0.169508f, -0.157506f, 0.154456f, 0.063493f, -0.090016f, -0.138024f, -0.174147f, 0.114770f, 0.040814f, 0.068996f, 0.029044f, 0.026228f, -0.272602f, 0.181918f, -0.035502f, 0.077558f, 0.173463f, -0.197779f, -0.114651f, 0.151669f, 0.133380f, 0.161232f, 0.044203f, 0.085898f, -0.026169f, 0.170733f, -0.534935f, -0.162632f, 0.115545f, 0.008097f, 0.163978f, 0.177441f, 0.004098f, 0.098232f, -0.003723f, 0.149786f, 0.088898f, 0.107069f, -0.183154f, -0.088626f, -0.167779f, -0.074819f, -0.253340f, 0.078028f, -0.049179f, -0.125285f, -0.101530f, 0.008082f, 0.086282f, 0.239459f, -0.142661f, -0.056117f, 0.205294f, -0.064409f, -0.059037f, -0.206760f, -0.031424f, -0.072630f, -0.201907f, -0.024800f, -0.083734f, -0.057997f, 0.055309f, -0.179340f, 0.032508f, 0.141889f, -0.005483f, -0.041351f, -0.083802f, -0.052431f, 0.168059f, 0.212183f, 0.058029f, 0.127588f, 0.015404f, 0.033119f, 0.103783f, 0.185435f, -0.026135f, -0.117483f, 0.145407f, 0.198479f, -0.143684f, -0.151885f, -0.157860f, -0.123991f, 0.224886f, 0.026329f, 0.161817f, -0.043371f, -0.016974f, 0.093526f, 0.125469f, 0.275120f, 0.157385f, 0.172605f, 0.007553f, 0.009751f, 0.257847f, -0.084917f, -0.073360f, 0.245101f, 0.252197f, 0.016132f, 0.156907f, 0.015507f, -0.153220f, 0.138181f, -0.078484f, 0.258176f, -0.021595f, -0.106655f, -0.022630f, -0.078068f, -0.125565f, -0.188365f, -0.013387f, -0.145103f, 0.008006f, -0.166446f, -0.057512f, -0.184918f, -0.009564f, 0.030984f, -0.158710f, 0.003630f, -0.099144f, 0.206194f, -0.164049f, -0.097280f, -0.079333f, 0.068602f, 0.201256f, 0.162516f, 0.057321f, -0.114474f, -0.207015f, 0.052910f, 0.003374f, -0.152736f, -0.229406f, 0.036265f, 0.219382f, -0.161409f, -0.198072f, -0.211459f, 0.079563f, -0.196463f, 0.033821f, -0.095258f, -0.049002f, -0.224915f, -0.362392f, -0.006372f, 0.004650f, 0.287095f, -0.070927f, -0.178553f, -0.186850f, 0.089577f, -0.088274f, -0.284923f, -0.078687f, 0.317587f, -0.081000f, -0.145041f, 0.190075f, 0.082393f, -0.105023f, 0.226695f, -0.127062f, -0.196720f, 0.184924f, 0.138474f, 0.154203f, 0.087279f, -0.037848f, 0.030928f, 0.171573f, 0.037005f, 0.153337f, -0.197255f, 0.025823f, 0.052463f, -0.156617f, -0.068133f, -0.294936f, -0.077704f, 0.125099f, 0.111225f, -0.027681f, -0.124272f, -0.033571f, 0.200333f, -0.166435f, 0.004672f, 0.171350f, -0.185125f, 0.113650f, 0.026620f, 0.136488f, 0.022311f, -0.287657f, -0.280934f, 0.159963f, 0.163118f, 0.094219f, -0.143246f, 0.152384f, 0.112826f, 0.188800f, -0.121373f, -0.028094f, 0.009413f, 0.235276f, 0.155768f, -0.174897f, 0.231719f, -0.144757f, 0.134098f, 0.054537f, -0.145093f, 0.005926f, -0.133528f, 0.083095f, 0.017185f, -0.028141f, 0.089830f, 0.153742f, 0.021077f, 0.207585f, 0.150436f, 0.206889f, 0.092843f, -0.004231f, -0.130649f, -0.050996f, 0.060790f, 0.173428f, 0.250620f, 0.023945f, -0.116383f, 0.053707f, 0.120293f, 0.018146f, -0.030651f, -0.097111f, 0.125321f, -0.003362f, -0.122676f, -0.169900f, -0.028193f, -0.006225f, 0.074859f, 0.208531f, 0.181767f, 0.137702f, 0.054463f, 0.091527f, 0.094571f, 0.036292f, 0.186419f, -0.122250f, -0.132456f, 0.005302f, -0.107380f, -0.348489f, 0.098024f, 0.073921f, 0.107439f, -0.063682f, -0.090883f, -0.026705f, 0.091658f, -0.217551f, 0.001208f, 0.150763f, -0.211827f, -0.227438f, 0.026849f, 0.111905f, 0.127336f, -0.293799f, 0.189819f, -0.025099f, -0.117574f, 0.084001f, -0.022233f, 0.085910f, 0.067139f, -0.043963f, -0.039855f, 0.044108f, -0.076099f, -0.075922f, -0.105518f, 0.160343f, 0.070054f, 0.053555f, -0.114405f, 0.089850f, 0.076021f, 0.072006f, 0.019901f, 0.045853f, 0.047244f, -0.180430f, -0.231823f, 0.098900f, -0.048630f, 0.203502f, 0.035560f, 0.202750f, -0.060587f, -0.466647f, -0.118745f, 0.035027f, 0.108638f, 0.102094f, -0.146103f, -0.054080f, 0.187450f, -0.096095f, 0.009090f, 0.119117f, -0.005578f, 0.057541f, 0.148336f, -0.147927f, -0.014369f, 0.042644f, 0.107794f, -0.071730f, 0.203241f, -0.164499f, 0.123652f, -0.208879f, 0.165787f, -0.283184f, 0.201568f, 0.249721f, -0.059501f, -0.159058f, -0.232334f, -0.008112f, -0.138339f, 0.022557f, -0.024287f, -0.065441f, -0.010637f, -0.031228f, 0.228298f, 0.146793f, -0.213819f, -0.030031f, -0.221608f, 0.093862f, 0.110260f, 0.076682f, 0.159144f, -0.233586f, -0.063533f, -0.041233f, 0.162406f, -0.093438f, 0.034912f, -0.168772f, -0.075673f, 0.019860f, 0.104322f, -0.238864f, 0.075999f, -0.158458f, -0.045865f, 0.040494f, 0.023555f, -0.125185f, -0.043718f, -0.224661f, 0.052305f, -0.066802f, -0.086485f, 0.166997f, 0.031362f, 0.143247f, 0.200456f, 0.083640f, 0.214886f, 0.051539f, -0.026783f, 0.084397f, -0.058578f, 0.076161f, -0.233375f, -0.185256f, 0.171880f, -0.011064f, 0.127416f, -0.184105f, -0.031802f, 0.096365f, -0.179640f, 0.015598f, 0.205769f, -0.011161f, 0.202907f, 0.161102f, 0.176082f, 0.163134f, -0.187395f, -0.008451f, -0.073764f, -0.180928f, -0.044987f, -0.017675f, -0.105542f, -0.136888f, 0.149264f, 0.115329f, 0.002366f, 0.101234f, 0.098525f, 0.054799f, -0.175612f, 0.089317f, 0.079004f, -0.266481f, 0.201965f, -0.023374f, 0.254385f, 0.129336f, 0.143006f, 0.035730f, -0.061154f, -0.089286f, 0.009517f, 0.149240f, 0.220047f, 0.148049f, 0.125463f, -0.178170f, 0.189694f, -0.532302f, 0.029052f, -0.028954f, 0.246304f, -0.186617f, -0.088875f, 0.138697f, -0.046205f, 0.098547f, 0.133917f, -0.141414f, 0.036764f, 0.107708f, 0.034431f, -0.035600f, -0.153384f, -0.047870f, -0.066341f, -0.070906f, 0.096190f, -0.003068f, 0.030234f, -0.053267f, -0.150368f, -0.255713f, 0.087982f, -0.116837f, 0.006575f, -0.080880f, -0.076625f, 0.129707f, 0.040731f, -0.119033f, -0.192267f, 0.146446f, -0.007502f, -0.100955f, 0.198003f, -0.151641f, -0.040031f, -0.237050f, -0.183539f, 0.026992f, 0.068415f, -0.165791f, 0.167040f, 0.043867f, -0.036486f, 0.121690f, -0.140755f, 0.054319f, 0.176259f, 0.010693f, -0.194493f, 0.122919f, 0.007305f, -0.213830f, 0.045293f, -0.049350f, -0.233238f, -0.019146f, -0.007827f, -0.002820f, -0.191607f, -0.197647f, -0.282782f, 0.392481f, -0.223427f, -0.175194f, 0.057392f, -0.038203f, 0.001272f, 0.093420f, 0.187257f, 0.126120f, -0.103023f, 0.036461f, 0.031411f, -0.025544f, 0.202723f, -0.100443f, -0.200028f, -0.041889f, -0.250396f, 0.001017f, -0.225988f, -0.000676f, -0.028076f, 0.040957f, 0.082341f, -0.035442f, 0.158207f, -0.190268f, 0.125806f, 0.337582f, -0.324779f, 0.096884f, 0.002091f, 0.107671f, -0.031925f, 0.218069f, 0.186669f, 0.040216f, -0.124141f, 0.230856f, -0.251287f, -0.119957f, -0.027391f, -0.008524f, -0.161468f, 0.118922f, -0.092175f, -0.045467f, -0.184952f, 0.152642f, 0.169898f, -0.091448f, -0.189378f, 0.000754f, 0.166413f, 0.022518f, 0.038716f, 0.058794f, 0.062006f, 0.014690f, -0.076649f, 0.078758f, 0.072469f, -0.353627f, 0.245234f, -0.052663f, 0.222858f, -0.184279f, -0.105814f, -0.013252f, 0.147985f, -0.184535f, -0.021201f, -0.147450f, -0.002661f, -0.186767f, -0.104960f, -0.031071f, 0.195000f, -0.276379f, 0.266348f, -0.179197f, 0.245719f, -0.246651f, 0.255118f, 0.223334f, -0.001783f, -0.218308f, 0.131176f, 0.159112f, 0.070522f, 0.137356f, 0.173585f, -0.093605f, -0.139469f, -0.263833f, 0.154660f, 0.103521f, -0.157895f, -0.244204f, 0.181483f, -0.178682f, 0.054608f, 0.022240f, -0.050812f, 0.033698f, -0.203242f, -0.070035f, 0.151821f, 0.082050f, 0.057589f, 0.023905f, 0.155902f, 0.021807f, 0.075689f, -0.208606f, -0.122131f, -0.010680f, -0.010534f, -0.258709f, 0.204152f, 0.035002f, -0.160921f, 0.211800f, 0.175002f, -0.104758f, 0.126966f, -0.236157f, -0.114809f, -0.216700f, -0.102552f, -0.100829f, -0.186688f, 0.181863f, 0.199101f, 0.035631f, 0.222509f, 0.023737f, 0.140610f, -0.182526f, -0.207992f, -0.048016f, 0.098287f, -0.245447f, -0.083141f, -0.006331f, 0.159491f, -0.336408f, 0.114396f, 0.024450f, -0.204015f, -0.139646f, -0.115535f, 0.135811f, -0.066143f, -0.294668f, 0.050749f, -0.235204f, -0.109204f, -0.158015f, 0.092279f, 0.150178f, -0.047904f, 0.133874f, -0.190673f, 0.204943f, -0.124535f, -0.050997f, -0.079911f, -0.110658f, -0.112618f, -0.173370f, -0.065781f, 0.093922f, 0.195170f, -0.041275f, -0.257217f, -0.143017f, 0.112748f, 0.345509f, 0.198370f, -0.194064f, 0.197946f, -0.030867f, -0.077694f, -0.130687f, -0.070117f, -0.134286f, 0.126370f, 0.155330f, 0.076291f, -0.476823f, -0.078929f, 0.240918f, 0.247696f, -0.003489f, -0.133626f, 0.240401f, 0.099912f, 0.263865f, 0.026058f, -0.157776f, 0.169095f, 0.041499f, 0.148094f, -0.182160f, 0.007011f, -0.151168f, -0.063800f, -0.205909f, 0.023885f, 0.012049f, -0.092995f, -0.026656f, 0.184687f, -0.201966f, 0.092682f, 0.058960f, -0.045937f, -0.093643f, 0.155628f, -0.115573f, -0.035478f, -0.067861f, -0.116071f, 0.396360f, 0.098510f, 0.201511f, 0.015769f, -0.103274f, 0.145867f, 0.017839f, -0.151932f, 0.174689f, 0.231984f, 0.174687f, -0.166465f, 0.120305f, -0.093215f, -0.216916f, -0.131999f, 0.100910f, -0.204402f, -0.162076f, -0.020226f, -0.086346f, 0.082038f, 0.051953f, 0.025062f, 0.243540f, 0.184140f, -0.162906f, -0.150104f, -0.169767f, -0.012603f, -0.007443f, -0.136549f, -0.042611f, -0.097633f, 0.015237f, 0.140363f, 0.120211f, 0.106670f, -0.242158f, 0.092433f, 0.073959f, 0.153585f, 0.219681f, -0.241682f, -0.127956f, 0.019501f, -0.217410f, -0.003172f, -0.031678f, -0.232474f, 0.053166f, 0.062764f, -0.158539f, 0.134163f, -0.035697f, -0.032048f, 0.153997f, 0.087271f, -0.327804f, 0.010806f, 0.023835f, -0.113764f, 0.216406f, -0.182510f, 0.287778f, 0.117046f, 0.204436f, 0.194517f, -0.123736f, 0.153142f, -0.192741f, -0.307511f, 0.042194f, 0.020423f, 0.009645f, 0.136585f, -0.048938f, -0.018622f, 0.111483f, -0.077207f, -0.039686f, -0.091297f, -0.253847f, -0.123455f, 0.141177f, 0.008247f, 0.323734f, -0.020132f, -0.045092f, 0.060399f, 0.033433f, -0.108877f, 0.183470f, -0.024670f, -0.003489f, -0.127106f, 0.209809f, 0.150802f, -0.105785f, 0.135310f, -0.132961f, 0.086177f, 0.047273f, -0.032919f, 0.022360f, 0.149429f, -0.202663f, 0.073708f, 0.266820f, 0.059529f, 0.202721f, -0.222098f, 0.220253f, -0.088259f, 0.090162f, -0.006900f, -0.251202f, 0.090266f, 0.045994f, -0.121314f, 0.008917f, -0.157820f, 0.045980f, -0.178052f, -0.246078f, -0.246041f, -0.266850f, -0.410474f, 0.606765f, -0.007315f, -0.050524f, 0.031137f, -0.045374f, 0.066408f, -0.049079f, 0.077351f, 0.122197f, 0.029558f, -0.096051f, -0.059259f, 0.253255f, -0.041812f, -0.122007f, -0.144500f, 0.213202f, -0.070149f, -0.086036f, -0.012262f, -0.132901f, -0.253899f, 0.095648f, 0.045242f, 0.072356f, 0.160334f, -0.023991f, -0.140587f, -0.185315f, -0.306845f, 0.162874f, -0.293732f, 0.302047f, -0.111158f, 0.143159f, -0.184987f, -0.189610f, -0.021162f, -0.189791f, 0.067946f, 0.108204f, 0.082189f, 0.198428f, -0.263174f, -0.065363f, 0.097083f, -0.348237f, -0.132073f, -0.142043f, -0.124529f, -0.244163f, 0.127096f, -0.016819f, 0.095321f, 0.063185f, -0.237281f, 0.253670f, -0.030016f, -0.055939f, 0.187062f, 0.100842f, 0.024919f, 0.070588f, -0.235460f, -0.076695f, 0.127100f, -0.009465f, 0.032491f, 0.139566f, -0.132356f, -0.176427f, -0.238751f, 0.077973f, -0.132526f, 0.127703f, -0.078699f, -0.266131f, -0.191799f, -0.200510f, -0.228489f, -0.127279f, -0.124028f, 0.051486f, 0.084001f, 0.207075f, 0.004367f, -0.265981f, 0.161907f, 0.094097f, 0.106659f, 0.142819f, 0.235167f, 0.024233f, 0.154015f, -0.144685f, 0.176675f, -0.183799f, 0.091645f, 0.230703f, 0.104303f, -0.077502f, 0.147164f, 0.196112f, -0.016492f, 0.263543f, -0.027487f, -0.116210f, 0.119925f, -0.055152f, -0.153229f, -0.063440f, 0.031384f, 0.248438f, 0.106792f, -0.056031f, 0.094328f, 0.140473f, 0.184817f, 0.150101f, 0.251865f, 0.241338f, -0.013901f, 0.126814f, 0.089172f, 0.037596f, 0.123934f, 0.094368f, -0.102107f, -0.227543f, -0.155011f, 0.198406f, -0.041215f, 0.248395f, 0.171792f, 0.147955f, 0.226670f, 0.005199f, -0.210445f, 0.182117f, 0.070653f, 0.033240f, 0.070745f, 0.070322f, -0.101260f, -0.021763f, 0.228838f, 0.076690f, 0.022974f, -0.000882f, -0.022642f, 0.157543f, 0.077936f, 0.187961f, -0.197423f, -0.195849f, 0.192945f, 0.184556f, -0.145132f, -0.506456f, 0.008774f, -0.116988f, 0.014424f, -0.160912f, 0.086418f, 0.094591f, 0.154419f, 0.072490f, 0.211036f, 0.267976f, -0.160630f, -0.072546f, 0.255957f, -0.119084f, -0.061671f, -0.335585f, 0.159468f, 0.054767f, -0.020580f, 0.028298f, 0.105490f, -0.013511f, 0.209837f, -0.191674f, 0.100017f, 0.178052f, 0.132965f, 0.128623f, 0.084643f, 0.034523f, -0.153929f, -0.378759f, 0.232520f, 0.192193f, 0.092055f, -0.029933f, 0.167984f, -0.069414f, -0.025370f, 0.235180f, 0.187012f, 0.083193f, 0.237222f, -0.064588f, 0.135089f, -0.000444f, 0.078905f, -0.347511f, -0.147306f, -0.041585f, 0.134256f, -0.234704f, -0.184661f, 0.106382f, -0.207080f, -0.246198f, -0.135708f, 0.208939f, 0.101257f, 0.204408f, 0.129617f, -0.206333f, -0.074497f, 0.045633f, -0.109615f, -0.042743f, 0.059595f, -0.093966f, -0.062739f, 0.260991f, 0.086208f, -0.089335f, 0.227527f, -0.015614f, 0.172443f, -0.072882f, 0.248110f, -0.018295f, -0.201457f, -0.019523f, -0.119260f, -0.041407f, 0.265048f, -0.000118f, -0.025955f, 0.036204f, -0.042674f, -0.256223f, -0.060411f, 0.250010f, 0.123971f, -0.040186f, 0.169075f, 0.277150f, -0.052027f, 0.134766f, -0.115377f, 0.365656f, 0.190933f, -0.030216f, -0.229762f, -0.217883f, 0.155973f, 0.179626f, -0.145340f, -0.122341f, -0.092945f, 0.205454f, -0.139122f, -0.022579f, -0.110129f, 0.220341f, -0.180247f, 0.122540f, 0.179981f, 0.236395f, 0.099536f, 0.029470f, 0.116022f, 0.279277f, -0.204768f, 0.178575f, 0.039854f, -0.098790f, -0.202359f, 0.257502f, -0.066670f, -0.119513f, 0.060415f, 0.041949f, -0.249059f, -0.160290f, -0.052165f, -0.008400f, -0.265763f, -0.048601f, 0.189692f, -0.019735f, -0.160235f, 0.116771f, -0.106316f, -0.053637f, 0.082348f, -0.115828f, 0.182176f, -0.241827f, 0.145503f, 0.171890f, 0.021306f, -0.113193f, 0.247707f, 0.124766f, -0.117360f, 0.009121f, -0.244490f, -0.129099f, 0.095031f, -0.170160f, -0.159880f, 0.013362f, 0.093454f, 0.438024f, -0.103115f, -0.089810f, 0.040686f, 0.125924f, 0.072913f, 0.197900f, -0.147240f, 0.342370f, 0.174679f, 0.115569f, 0.032600f, 0.150023f, -0.106682f, 0.236848f, -0.336750f, 0.223324f, -0.181552f, 0.112592f, -0.473647f, 0.057077f, -0.071664f, -0.073052f, 0.022246f, 0.156779f, 0.174379f, 0.071394f, 0.237055f, 0.098868f, -0.090328f, -0.004219f, 0.000153f, 0.010121f, 0.037713f, -0.204598f, -0.119695f, 0.113689f, 0.168044f, 0.108543f, -0.122128f, 0.150935f, 0.031366f, 0.098460f, 0.050271f, 0.136139f, 0.037542f, -0.187055f, 0.206891f, 0.079272f, 0.001251f, -0.277995f, -0.113632f, 0.045806f, -0.018168f, -0.319132f, -0.107879f, -0.021871f, 0.170756f, 0.070917f, 0.126421f, -0.038176f, 0.005116f, -0.528625f, 0.063363f, -0.226326f, 0.103085f, 0.066022f, -0.026612f, 0.090598f, -0.107154f, 0.140637f, 0.086527f, 0.128098f, 0.070721f, 0.144976f, 0.110875f, 0.066393f, 0.153662f, -0.178194f, -0.003031f, -0.134456f, 0.190371f, -0.156040f, 0.261597f, -0.032678f, -0.193521f, -0.064955f, 0.208381f, 0.102097f, 0.159011f, -0.205194f, 0.198242f, -0.114054f, -0.405844f, 0.150377f, -0.166369f, 0.220442f, 0.165934f, -0.065951f, -0.182663f, -0.238893f, 0.035862f, -0.007027f, -0.278519f, 0.118994f, -0.014429f, -0.242237f, 0.079762f, -0.194257f, -0.031805f, 0.008927f, -0.057657f, 0.269856f, 0.021718f, -0.147062f, -0.018605f, 0.094578f, 0.019764f, 0.210017f, -0.129903f, -0.028773f, -0.326439f, -0.030547f, -0.242940f, -0.297299f, 0.082689f, 0.163231f, -0.040046f, -0.439038f, -0.366110f, -0.168418f, -0.178909f, -0.025986f, -0.113768f, -0.251638f, 0.112132f, -0.180170f, -0.423337f, -0.211417f, -0.301835f, -0.160646f, -0.252786f, -0.360767f, 0.054176f, 0.205938f, -0.408709f, 0.164073f, 0.015251f, 0.040509f, 0.013170f, 0.006662f, 0.025173f, 0.232758f, -0.039548f, -0.064325f, 0.041261f, 0.258454f, -0.015433f, 0.150192f, -0.048310f, 0.009264f, -0.033622f, -0.056281f, 0.105366f, 0.280008f, 0.092950f, -0.072373f, -0.189010f, -0.160775f, 0.080728f, 0.032183f, 0.085879f, 0.115182f, -0.155507f, -0.165598f, -0.015255f, 0.122609f, -0.067065f, 0.176052f, 0.240213f, -0.201045f, -0.071756f, 0.064561f, -0.061197f, 0.077350f, -0.146973f, 0.122449f, 0.246174f, 0.129349f, 0.180541f, -0.056203f, 0.242816f, 0.192542f, -0.087746f, 0.094166f, -0.174418f, -0.005743f, 0.291050f, 0.114138f, 0.264702f, 0.136623f, 0.215806f, 0.187508f, -0.128693f, -0.145470f, 0.052748f, -0.230158f, 0.249699f, -0.120389f, 0.140543f, 0.174700f, 0.084493f, 0.006575f, -0.167943f, -0.173181f, 0.205599f, 0.231414f, 0.012362f, -0.126344f, -0.156371f, -0.172297f, 0.205008f, -0.135948f, 0.173869f, -0.184647f, -0.092189f, 0.205041f, -0.003543f, -0.102792f, -0.102094f, 0.181800f, 0.099938f, -0.038968f, 0.218953f, -0.086783f, 0.019388f, 0.221514f, -0.137833f, 0.123108f, 0.081346f, 0.216829f, -0.041950f, -0.105810f, -0.115587f, 0.208203f, -0.127842f, -0.150340f, 0.068622f, 0.131160f, 0.047267f, 0.106762f, -0.131458f, 0.020923f, 0.041277f, 0.001488f, 0.004703f, -0.160768f, 0.051393f, -0.045898f, 0.032183f, 0.036624f, 0.184556f, 0.086284f, -0.114460f, -0.126190f, -0.200173f, 0.173067f, -0.047105f, -0.050475f, 0.049612f, 0.029548f, -0.045902f, 0.125826f, 0.098720f, 0.174381f, -0.144730f, -0.124638f, 0.311958f, 0.070576f, -0.136876f, 0.182829f, 0.182004f, -0.162605f, 0.092999f, 0.130293f, -0.026071f, 0.166457f, 0.009894f, -0.020748f, -0.090573f, -0.190727f, -0.085168f, -0.233573f, -0.121968f, 0.057444f, 0.020943f, -0.107697f, -0.069301f, 0.130660f, 0.017056f, 0.135571f, 0.054618f, -0.045463f, -0.179036f, -0.331638f, 0.074408f, -0.045446f, -0.188030f, 0.048253f, -0.010176f, 0.243545f, 0.152018f, 0.365567f, 0.021818f, 0.162703f, -0.196959f, -0.142518f, -0.012232f, 0.007876f, 0.052933f, 0.050395f, 0.015708f, -0.131346f, 0.179334f, -0.153702f, -0.160837f, 0.055318f, -0.175991f, -0.017253f, 0.102529f, -0.103320f, 0.108128f, -0.213937f, 0.222568f, -0.116927f, -0.048361f, -0.106209f, 0.176275f, -0.104918f, -0.202799f, 0.097381f, -0.189773f, 0.165025f, -0.036945f, 0.054691f, -0.186453f, -0.131824f, -0.189679f, 0.112412f, 0.085396f, -0.013842f, -0.131798f, 0.120934f, -0.033884f, -0.150105f, 0.181287f, -0.146646f, 0.073932f, 0.081515f, -0.225845f, -0.206106f, -0.041143f, -0.184802f, -0.172964f, 0.048984f, -0.070285f, 0.059994f, -0.187228f, 0.025549f, -0.144897f, -0.187635f, -0.068293f, 0.208153f, -0.100682f, -0.242613f, 0.094496f, -0.201698f, -0.092700f, -0.182927f, -0.144740f, -0.022304f, 0.075803f, 0.069173f, 0.095837f, -0.408155f, -0.263815f, -0.092600f, -0.206717f, 0.253077f, -0.096461f, -0.314696f, -0.148438f, 0.117426f, -0.333724f, -0.146372f, -0.235135f, -0.048825f, 0.100157f, -0.201631f, -0.054034f, 0.326968f, 0.046633f, 0.031334f, -0.145093f, -0.277480f, -0.174489f, 0.125894f, 0.041640f, -0.033579f, 0.011869f, -0.086307f, -0.032102f, 0.215649f, -0.180140f, -0.092496f, -0.054786f, -0.127821f, -0.011285f, -0.017938f, 0.130296f, -0.068358f, -0.171689f, 0.014256f, -0.022083f, -0.278467f, 0.092575f, -0.163553f, -0.013803f, -0.067245f, -0.094358f, 0.299614f, 0.088606f, -0.179627f, 0.111286f, -0.057240f, 0.284715f, -0.204534f, 0.110172f, 0.143812f, -0.066294f, 0.176294f, -0.228359f, 0.095259f, -0.153354f, 0.028742f, -0.140265f, -0.293678f, -0.277048f, 0.288297f, -0.182340f, -0.217783f, 0.197974f, -0.049953f, -0.089967f, -0.039101f, 0.103104f, 0.157980f, 0.100014f, 0.093138f, 0.049200f, 0.046072f, 0.170496f, -0.182679f, -0.006599f, 0.248496f, -0.238200f, 0.037407f, -0.142756f, 0.007961f, -0.065536f, 0.194870f, -0.048594f, -0.043329f, -0.084951f, -0.018708f, 0.081189f, 0.272236f, -0.238041f, -0.005950f, -0.307864f, 0.415219f, -0.129997f, 0.079446f, 0.108644f, -0.022594f, 0.090857f, -0.066381f, 0.215423f, -0.011487f, 0.198763f, -0.214471f, -0.186077f, 0.074104f, -0.081310f, -0.014087f, 0.002983f, 0.259820f, -0.224009f, 0.160997f, -0.013356f, -0.193378f, 0.169334f, 0.014998f, -0.000389f, 0.331995f, 0.027449f, 0.154272f, 0.245743f, 0.210798f, -0.172630f, -0.302514f, 0.201671f, 0.174905f, 0.069157f, -0.004983f, 0.029976f, -0.194998f, 0.204889f, -0.023103f, -0.090143f, 0.048447f, 0.158888f, 0.094001f, 0.137678f, -0.080402f, -0.088213f, -0.194390f, -0.115643f, -0.178134f, -0.188286f, 0.142219f, -0.193565f, -0.111291f, 0.038265f, -0.260629f, 0.042338f, -0.024973f, -0.106825f, -0.099632f, -0.044412f, -0.019328f, 0.072104f, 0.159054f, 0.222368f, -0.124068f, 0.103007f, 0.024822f, 0.152777f, 0.230198f, -0.082855f, -0.113505f, -0.026087f, 0.106755f, -0.118558f, -0.064496f, 0.007455f, 0.129278f, -0.135833f, -0.333440f, -0.007156f, -0.042173f, -0.032768f, -0.129810f, -0.108752f, 0.011804f, 0.224733f, 0.110581f, -0.055516f, 0.112369f, 0.064591f, 0.240315f, 0.044374f, 0.076644f, -0.143382f, -0.230059f, 0.003813f, -0.022684f, 0.100783f, 0.197061f, -0.140547f, -0.061831f, 0.150767f, -0.157820f, 0.155755f, -0.060187f, -0.063889f, -0.137402f, -0.058511f, -0.119120f, -0.080714f, -0.245341f, 0.079292f, 0.193390f, 0.180004f, -0.277074f, 0.165322f, 0.039194f, -0.013123f, -0.007117f, -0.002892f, 0.144741f, -0.104403f, 0.204595f, -0.173576f, 0.080877f, 0.159447f, -0.191883f, 0.096025f, -0.024279f, 0.178960f, 0.138395f, 0.108235f, 0.229448f, 0.266503f, 0.266587f, 0.195754f, 0.207101f, -0.023163f, 0.041659f, 0.062876f, -0.127932f, 0.126885f, -0.251226f, -0.147497f, -0.106149f, -0.063013f, 0.182301f, 0.016893f, -0.182269f, 0.207711f, 0.104616f, 0.155322f, 0.013496f, -0.101570f, 0.100096f, 0.076665f, -0.167991f, 0.143036f, -0.185541f, -0.045241f, 0.028466f, -0.198732f, -0.072913f, -0.006728f, 0.025726f, -0.063284f, 0.143426f, -0.105750f, -0.259842f, -0.148874f, -0.022968f, -0.151354f, -0.179414f, 0.176428f, -0.032942f, -0.084268f, 0.029653f, -0.214372f, 0.079414f, 0.157686f, -0.178022f, 0.099364f, -0.130694f, 0.084185f, -0.229081f, 0.104552f, 0.151013f, 0.169841f, -0.075010f, -0.128181f, -0.399410f, 0.138361f, -0.217064f, 0.006595f, 0.074638f, -0.087500f, 0.150009f, 0.149424f, 0.169482f, 0.213295f, 0.034357f, 0.053484f, -0.001888f, 0.003088f, -0.182943f, 0.131663f, -0.083189f, -0.025854f, -0.186710f, 0.104109f, -0.194978f, 0.073184f, 0.017304f, 0.092722f, -0.124167f, 0.174428f, -0.128256f, 0.053541f, 0.139506f, 0.076891f, 0.073440f, 0.196321f, 0.010313f, 0.175066f, 0.015554f, 0.265206f, 0.202260f, 0.141582f, -0.103109f, 0.074260f, 0.101789f, 0.202600f, -0.086144f, 0.184029f, -0.223792f, -0.167532f, 0.071570f, -0.086421f, -0.239371f, 0.236611f, 0.111223f, -0.071138f, 0.144267f, 0.208152f, 0.024459f, -0.091995f, -0.246489f, 0.034518f, -0.001190f, 0.101915f, 0.045612f, -0.052723f, -0.132673f, -0.107554f, -0.150654f, 0.083233f, -0.218797f, -0.126884f, -0.158603f, -0.014381f, 0.154718f, -0.149603f, 0.123299f, 0.072646f, -0.016437f, -0.109618f, -0.014120f, -0.139857f, -0.015500f, 0.127415f, -0.182792f, 0.000952f, -0.066180f, 0.043866f, 0.157968f, -0.243707f, -0.167342f, 0.027309f, -0.147099f, 0.126491f, -0.026389f, 0.129580f, 0.146588f, 0.064758f, -0.169503f, -0.075147f, -0.281758f, -0.030366f, -0.169999f, -0.125730f, 0.036342f, -0.049286f, -0.211618f, 0.201750f, -0.057370f, -0.131659f, 0.158740f, -0.068618f, -0.158007f, 0.083443f, 0.075150f, 0.031409f, -0.199675f, -0.157149f, 0.056396f, -0.176912f, 0.015535f, 0.180197f, -0.214905f, -0.058536f, -0.250587f, -0.043978f, 0.088537f, 0.003480f, 0.165442f, 0.270428f, -0.077304f, 0.078168f, -0.467471f, 0.257707f, -0.192216f, 0.218315f, 0.131964f, 0.123224f, -0.049099f, 0.103700f, -0.144029f, 0.101723f, -0.057153f, -0.120050f, -0.220274f, 0.257518f, -0.145374f, -0.188805f, -0.303914f, 0.252527f, 0.151526f, 0.150184f, 0.014026f, -0.132842f, 0.010892f, -0.157221f, -0.267163f, -0.079343f, -0.035168f, -0.061523f, 0.186722f, 0.251532f, 0.089284f, -0.026959f, 0.060778f, 0.110787f, -0.144733f, 0.231507f, -0.003641f, -0.095688f, 0.075871f, -0.151539f, 0.177706f, 0.127115f, 0.122862f, 0.270370f, -0.181105f, 0.244423f, 0.139947f, 0.062806f, 0.049238f, 0.213663f, 0.236145f, -0.134351f, -0.183353f, -0.164801f, 0.228149f, 0.189771f, -0.210106f, -0.166529f, 0.204227f, 0.228669f, 0.243149f, 0.026875f, 0.011347f, -0.063936f, -0.251546f, 0.240626f, -0.182309f, -0.079419f, 0.247953f, 0.113801f, -0.083024f, 0.278430f, 0.148318f, 0.091220f, -0.143912f, 0.144459f, 0.170589f, 0.229873f, -0.123407f, -0.057166f, -0.244555f, 0.045707f, -0.052130f, 0.030544f, -0.231558f, 0.077027f, 0.094075f, 0.222882f, -0.166957f, -0.042084f, -0.041635f, 0.133755f, 0.243112f, -0.059841f, -0.053197f, -0.169110f, 0.008980f, 0.048530f, 0.174844f, 0.292190f, 0.044063f, -0.011102f, 0.027320f, 0.021184f, 0.262403f, 0.100161f, -0.087319f, -0.055947f, 0.138774f, 0.234786f, -0.091383f, -0.055913f, -0.319676f, 0.238532f, -0.150820f, 0.006997f, -0.094986f, 0.241578f, -0.072788f, 0.025693f, 0.083379f, -0.161569f, 0.322078f, 0.005652f, 0.226294f, -0.002783f, -0.030297f, 0.143545f, -0.192746f, 0.064693f, -0.106558f, -0.101332f, -0.194046f, 0.059569f, 0.187723f, -0.094320f, 0.220331f, 0.206269f, 0.077518f, 0.130429f, -0.015422f, -0.117891f, -0.020901f, -0.148736f, 0.070558f, -0.127705f, 0.263472f, 0.180971f, -0.240432f, 0.065023f, 0.182469f, -0.121954f, -0.050106f, 0.164907f, 0.219445f, -0.202031f, 0.186422f, 0.085139f, -0.011949f, 0.084169f, 0.099043f, -0.016388f, 0.062111f, -0.262879f, 0.172175f, -0.127093f, -0.138954f, 0.000118f, -0.168088f, 0.034798f, -0.170883f, -0.063958f, 0.009748f, 0.176424f, 0.097364f, -0.227357f, 0.061252f, -0.197869f, -0.138729f, 0.197592f, -0.134498f, 0.197380f, -0.241908f, 0.156377f, 0.131619f, 0.166509f, 0.182288f, 0.089871f, -0.008398f, -0.167646f, 0.169715f, -0.218479f, -0.347814f, -0.023190f, -0.249083f, -0.169057f, -0.166518f, 0.015747f, 0.239144f, 0.277844f, 0.210373f, 0.225369f, 0.206495f, 0.208229f, 0.041696f, 0.063650f, 0.139748f, 0.080010f, -0.312307f, -0.063144f, -0.128431f, 0.019706f, -0.233931f, -0.074832f, 0.013366f, 0.204655f, -0.078713f, 0.012580f, 0.094523f, 0.010100f, -0.029479f, -0.152880f, -0.147743f, 0.130466f, -0.536117f, 0.069924f, -0.114723f, 0.175694f, 0.177217f, -0.203559f, -0.005017f, -0.146861f, -0.166247f, -0.055560f, 0.057946f, 0.254413f, -0.001607f, 0.147503f, -0.023194f, 0.061303f, 0.041903f, 0.140996f, -0.191610f, -0.104910f, -0.227555f, 0.234713f, 0.051163f, 0.199751f, 0.012908f, -0.010940f, 0.287779f };
+static const float prediction_next_solar_gen_layer_5_biases[48] = { 0.036849f, 0.136350f, 0.103285f, 0.193166f, -0.021501f, 0.209401f, -0.029749f, -0.023361f, 0.164801f, 0.144316f, 0.238010f, 0.131636f, -0.036266f, -0.032910f, -0.020940f, 0.063051f, 0.136235f, -0.031703f, 0.192773f, 0.175209f, 0.173260f, 0.119900f, 0.205541f, -0.031242f, 0.116444f, 0.026885f, 0.190483f, -0.012622f, -0.000835f, 0.180185f, -0.027955f, -0.028474f, -0.018167f, 0.177133f, -0.045067f, -0.017457f, 0.223711f, 0.029330f, 0.126202f, -0.036817f, 0.188802f, -0.019803f, 0.147934f, 0.138203f, 0.349390f, -0.031842f, 0.141490f, 0.137909f };
+static const float prediction_next_solar_gen_layer_5_weights[3840] = { -0.235885f, 0.083144f, 0.218125f, -0.038499f, 0.061521f, 0.124734f, 0.055264f, 0.153792f, -0.041859f, -0.158419f, 0.133223f, -0.104124f, -0.198370f, 0.123222f, -0.033321f, -0.120236f, -0.049787f, 0.184728f, 0.193336f, 0.035035f, -0.152408f, -0.145500f, 0.148099f, -0.178946f, 0.003723f, 0.201242f, 0.356786f, 0.004072f, -0.067582f, 0.064952f, 0.172062f, -0.066949f, 0.133224f, 0.254537f, -0.144156f, -0.140418f, 0.124101f, 0.552598f, 0.215458f, -0.106679f, -0.164809f, 0.070830f, -0.084956f, -0.038283f, 0.091141f, 0.079843f, -0.173854f, 0.116008f, -0.051316f, 0.076517f, -0.030606f, -0.084437f, 0.272365f, 0.107506f, 0.195600f, -0.283880f, 0.063712f, 0.070639f, -0.183753f, 0.289084f, 0.068323f, 0.311230f, -0.005495f, 0.071133f, -0.066214f, 0.117987f, -0.044400f, 0.125437f, 0.160247f, -0.106218f, 0.176441f, 0.011007f, -0.132996f, -0.172323f, -0.134140f, -0.162468f, 0.024754f, -0.128655f, -0.213164f, -0.211455f, 0.001386f, -0.146173f, 0.173790f, 0.141877f, 0.137075f, -0.198554f, -0.042131f, -0.148712f, -0.166276f, 0.215451f, 0.085847f, 0.087149f, -0.012424f, 0.083233f, -0.141936f, 0.306407f, 0.056548f, -0.156434f, 0.012053f, 0.047963f, -0.067866f, -0.124516f, 0.228403f, -0.138979f, -0.059205f, -0.042004f, -0.122949f, -0.174454f, 0.083570f, 0.017546f, 0.047990f, 0.246585f, 0.183962f, 0.099174f, -0.161431f, 0.068264f, 0.130493f, -0.346020f, -0.059430f, 0.025814f, -0.057956f, -0.054698f, -0.038758f, 0.162142f, 0.090847f, -0.273478f, -0.086461f, -0.023112f, 0.184533f, -0.051946f, -0.101442f, 0.211388f, -0.218947f, 0.079911f, -0.021350f, -0.140457f, -0.149271f, -0.132068f, -0.129588f, 0.197274f, -0.100870f, -0.055550f, -0.263807f, 0.185435f, 0.168824f, 0.231154f, 0.227251f, 0.171956f, 0.163320f, -0.007205f, -0.057891f, -0.054261f, 0.181273f, -0.032126f, 0.245031f, -0.044017f, 0.229405f, -0.132106f, 0.106091f, 0.129305f, 0.119443f, 0.117931f, 0.092459f, -0.204427f, 0.029481f, 0.025033f, -0.117946f, 0.127214f, -0.054310f, -0.080225f, 0.057255f, -0.197930f, 0.165283f, -0.027149f, 0.145015f, -0.142940f, 0.028396f, -0.066915f, -0.027342f, -0.117952f, 0.100311f, 0.081774f, -0.138242f, -0.124522f, -0.143197f, -0.107194f, 0.124373f, 0.090900f, -0.230321f, -0.156082f, -0.078682f, 0.151003f, 0.014737f, -0.243583f, 0.019848f, 0.005196f, -0.074374f, -0.156730f, 0.045969f, 0.078066f, 0.027358f, 0.005412f, 0.071094f, 0.091244f, 0.132049f, 0.114001f, 0.035522f, -0.264580f, 0.094646f, 0.089138f, -0.441228f, -0.153003f, -0.081767f, -0.180521f, 0.213599f, -0.066210f, 0.129400f, 0.067168f, 0.013925f, 0.060915f, 0.011807f, -0.135786f, 0.222372f, 0.118549f, 0.026093f, 0.041312f, -0.032523f, -0.060988f, -0.149158f, -0.030263f, -0.110286f, -0.112532f, 0.208880f, -0.159181f, -0.114307f, 0.003417f, 0.121858f, 0.148398f, -0.061446f, 0.182901f, -0.080081f, 0.123063f, 0.303952f, -0.190074f, 0.096960f, 0.029822f, 0.354630f, -0.279268f, -0.118040f, -0.258573f, -0.187625f, -0.125768f, 0.082854f, -0.097698f, -0.084513f, -0.007032f, 0.128226f, -0.125641f, -0.113247f, -0.063456f, -0.000257f, 0.130087f, -0.085649f, 0.226635f, 0.161157f, -0.165171f, 0.077048f, -0.055145f, -0.253266f, 0.198154f, 0.143521f, 0.110147f, -0.330837f, 0.019681f, 0.067991f, -0.372393f, -0.277604f, -0.039790f, 0.125572f, -0.209179f, 0.146165f, -0.015135f, -0.087647f, -0.177016f, 0.039397f, 0.050741f, 0.132537f, -0.340601f, 0.107104f, 0.072414f, -0.403235f, 0.279589f, 0.064447f, -0.050269f, -0.122995f, 0.099569f, -0.055552f, 0.169510f, 0.077934f, 0.199732f, 0.085779f, -0.365903f, 0.139816f, -0.061241f, 0.051344f, -0.115460f, -0.164422f, -0.115113f, -0.278439f, 0.176334f, 0.146924f, -0.105467f, 0.091026f, -0.062736f, -0.232223f, -0.110494f, 0.283218f, -0.084228f, -0.111949f, -0.013455f, 0.162526f, -0.090357f, 0.027561f, 0.140380f, -0.155633f, 0.065240f, 0.035808f, 0.015218f, -0.047469f, 0.127741f, 0.035416f, -0.036478f, -0.072858f, -0.172000f, 0.079059f, -0.145209f, -0.064209f, 0.000107f, 0.178444f, -0.194533f, 0.182133f, -0.156472f, 0.064180f, 0.078792f, 0.130691f, 0.105594f, 0.071521f, 0.193936f, -0.185154f, -0.048231f, -0.217545f, -0.205988f, 0.089917f, -0.138131f, -0.129250f, -0.153762f, -0.013141f, 0.061826f, -0.105647f, -0.105973f, 0.047591f, -0.005272f, -0.064720f, -0.152466f, -0.046074f, -0.011829f, -0.075862f, -0.210162f, 0.133697f, 0.068111f, 0.130565f, -0.203386f, 0.076848f, 0.025019f, -0.058562f, -0.082486f, 0.036557f, 0.183869f, 0.007938f, 0.203055f, -0.151122f, 0.149247f, -0.082148f, 0.038658f, -0.271915f, 0.012764f, 0.174076f, -0.133826f, -0.095054f, -0.028961f, 0.127581f, 0.007818f, -0.205773f, -0.186700f, 0.105645f, -0.012480f, -0.109228f, 0.045957f, -0.086484f, 0.126380f, 0.079407f, -0.338203f, 0.174319f, 0.122571f, -0.094811f, -0.005962f, 0.220709f, -0.179071f, -0.136083f, 0.030096f, 0.290685f, -0.096935f, 0.050484f, 0.134109f, -0.214773f, 0.200538f, -0.015907f, 0.084131f, -0.088703f, 0.018753f, 0.212206f, 0.103585f, -0.051590f, 0.057597f, 0.305993f, -0.071806f, -0.033703f, -0.006462f, 0.049259f, -0.090566f, 0.130330f, 0.140820f, 0.107516f, -0.081230f, 0.210037f, -0.060631f, -0.142410f, -0.198425f, 0.040785f, 0.009093f, 0.134700f, 0.229083f, 0.014800f, 0.108175f, 0.157317f, -0.201081f, -0.198806f, -0.133374f, 0.144027f, -0.040897f, -0.308898f, 0.006418f, 0.025534f, -0.044508f, 0.165150f, 0.155100f, -0.113184f, 0.096143f, -0.130514f, -0.091160f, 0.052840f, -0.088522f, -0.215861f, -0.141784f, 0.007568f, 0.024281f, 0.075969f, 0.155099f, 0.136279f, 0.175484f, 0.091083f, 0.150788f, 0.250969f, 0.279003f, 0.297444f, 0.310331f, 0.053420f, 0.220878f, 0.113148f, -0.011561f, 0.137617f, 0.101892f, -0.200262f, -0.161436f, 0.163633f, -0.204613f, -0.177705f, -0.125319f, 0.040611f, 0.024649f, -0.157691f, -0.014167f, 0.113188f, -0.037312f, -0.168152f, 0.162095f, 0.007142f, 0.002740f, -0.204119f, -0.116619f, -0.203954f, 0.169457f, 0.163239f, -0.187190f, -0.086452f, -0.094486f, 0.094849f, -0.046479f, -0.037783f, 0.126396f, 0.161667f, -0.124311f, -0.009543f, 0.052045f, -0.195993f, 0.094716f, -0.191893f, -0.006804f, 0.215127f, -0.142174f, 0.152618f, -0.139703f, 0.045375f, 0.009528f, -0.161188f, 0.070489f, -0.004029f, -0.091923f, -0.096735f, -0.003810f, -0.168487f, -0.129376f, 0.053239f, -0.092138f, -0.105853f, -0.152598f, 0.051731f, -0.018691f, -0.121578f, 0.177288f, -0.087805f, 0.091943f, -0.041261f, -0.108681f, -0.059570f, -0.144467f, 0.013545f, -0.172414f, -0.081878f, -0.098727f, -0.155814f, 0.032970f, -0.171818f, 0.096495f, -0.217967f, 0.080167f, -0.080568f, -0.081931f, -0.182765f, -0.126035f, 0.132711f, -0.168729f, -0.220457f, 0.143056f, -0.092016f, -0.090877f, -0.313926f, -0.052683f, -0.049483f, 0.074113f, -0.123503f, -0.036073f, -0.148675f, -0.215464f, -0.039476f, -0.010980f, 0.161591f, -0.193053f, -0.145573f, -0.158807f, -0.012086f, -0.056211f, -0.060033f, 0.056313f, -0.199496f, -0.087060f, 0.176458f, -0.110379f, 0.000404f, 0.092472f, 0.197475f, -0.017035f, -0.223255f, -0.152261f, -0.075473f, -0.238744f, -0.062421f, 0.103799f, 0.144076f, 0.140743f, -0.117741f, -0.174300f, -0.088504f, 0.059541f, 0.088451f, -0.079817f, 0.113255f, 0.228167f, -0.230843f, -0.038890f, 0.168586f, -0.027781f, 0.107679f, 0.015224f, -0.144449f, -0.034577f, -0.120897f, -0.038854f, 0.147540f, -0.023986f, -0.210654f, 0.038310f, -0.013424f, 0.197748f, 0.096203f, 0.053833f, -0.105741f, -0.087620f, -0.163886f, 0.140497f, 0.051570f, 0.167651f, -0.170462f, 0.188636f, -0.082528f, 0.018333f, 0.137858f, 0.049345f, -0.027759f, -0.024587f, 0.176769f, 0.012935f, 0.092131f, 0.277182f, 0.181638f, 0.184024f, -0.165678f, 0.189361f, -0.043783f, -0.106099f, -0.211091f, -0.237620f, -0.056105f, 0.072918f, 0.049538f, 0.054546f, -0.021858f, -0.187636f, -0.093989f, 0.062249f, -0.086350f, -0.179148f, -0.164459f, -0.073321f, 0.018452f, 0.192797f, -0.290745f, 0.089173f, 0.097734f, -0.225543f, 0.184809f, -0.130854f, 0.127556f, 0.139208f, 0.099685f, -0.076742f, -0.416572f, 0.249721f, 0.208755f, 0.219634f, 0.028993f, -0.168682f, -0.219305f, 0.044078f, -0.083071f, 0.065686f, 0.003108f, 0.038706f, -0.227055f, -0.060012f, 0.271073f, 0.052751f, 0.035725f, -0.163873f, -0.172297f, -0.233930f, -0.056481f, -0.069316f, -0.102769f, -0.055857f, 0.177559f, 0.189499f, 0.155207f, -0.143380f, 0.123101f, 0.169836f, 0.236140f, -0.091425f, 0.045227f, -0.001935f, -0.139849f, -0.159775f, -0.192781f, 0.255758f, 0.222879f, -0.005968f, -0.131557f, -0.227623f, -0.217919f, 0.086622f, 0.099069f, -0.152980f, 0.074019f, 0.003283f, 0.089775f, -0.272679f, -0.127948f, 0.107370f, -0.136336f, -0.160594f, 0.102263f, 0.098471f, 0.121826f, 0.127708f, -0.016057f, -0.025135f, -0.371777f, -0.014014f, 0.074231f, -0.086840f, 0.273286f, 0.115547f, -0.008433f, 0.184103f, -0.020717f, -0.128711f, -0.247985f, -0.099382f, -0.029035f, 0.195963f, 0.065832f, 0.244206f, 0.152169f, -0.003841f, -0.014258f, -0.051468f, 0.038777f, -0.577115f, 0.093646f, -0.125384f, -0.127268f, 0.107702f, -0.136422f, 0.167502f, 0.062842f, -0.227616f, -0.028358f, -0.188415f, -0.118954f, 0.245021f, 0.027965f, 0.034098f, -0.016289f, 0.205297f, 0.009734f, 0.133307f, 0.066644f, 0.182027f, -0.022190f, 0.207642f, -0.223565f, -0.099109f, -0.303651f, -0.149065f, -0.047175f, 0.238887f, 0.126959f, 0.191379f, -0.138280f, -0.119518f, -0.140192f, -0.067453f, 0.119775f, 0.209719f, 0.190749f, -0.057801f, 0.071989f, -0.068620f, -0.077398f, 0.084569f, 0.123075f, -0.254618f, -0.146083f, 0.178845f, -0.084071f, -0.300742f, -0.030475f, 0.099672f, -0.064167f, 0.205882f, -0.000993f, 0.141253f, 0.120945f, 0.047530f, -0.014403f, 0.234656f, -0.412457f, 0.247617f, 0.101521f, 0.064669f, 0.142212f, 0.132307f, 0.248878f, 0.178140f, 0.227490f, -0.056586f, 0.079159f, -0.208731f, 0.047930f, 0.113935f, 0.071238f, -0.042953f, 0.220585f, -0.167884f, 0.188681f, -0.201872f, 0.074280f, -0.413750f, -0.103245f, -0.083947f, 0.204398f, 0.117012f, 0.313296f, 0.181540f, 0.100459f, 0.029532f, -0.045407f, -0.252001f, 0.198796f, 0.262682f, -0.162567f, 0.274812f, 0.167991f, 0.081790f, 0.047578f, 0.066880f, -0.048177f, -0.086196f, 0.171212f, -0.092769f, -0.201028f, -0.344714f, -0.255973f, 0.199202f, 0.230043f, 0.080361f, 0.127820f, 0.154148f, -0.094106f, 0.031945f, 0.154327f, -0.012151f, 0.180478f, 0.114540f, -0.067491f, 0.112205f, -0.045801f, 0.102330f, 0.032867f, -0.027450f, -0.217913f, 0.000990f, -0.146474f, 0.117745f, 0.161915f, -0.094366f, -0.074065f, -0.078652f, -0.043170f, 0.125571f, -0.183786f, -0.204971f, 0.123608f, -0.130583f, 0.169447f, -0.026940f, -0.245849f, 0.164545f, -0.125455f, -0.213685f, 0.208108f, 0.108223f, -0.117749f, 0.158181f, 0.041661f, 0.023808f, -0.090601f, -0.303523f, -0.206738f, 0.122374f, -0.055320f, 0.292290f, 0.008012f, -0.270949f, 0.107302f, -0.222470f, -0.225090f, -0.178140f, 0.099476f, -0.154917f, 0.234251f, 0.082513f, 0.122272f, -0.001806f, 0.055148f, -0.074693f, 0.027468f, -0.334131f, 0.125719f, 0.010384f, -0.053093f, 0.351456f, 0.174155f, 0.036108f, 0.181976f, -0.126319f, -0.142688f, 0.104326f, 0.137291f, 0.311523f, 0.084084f, -0.219538f, -0.248359f, -0.074619f, 0.036909f, -0.016907f, -0.167839f, -0.109554f, -0.034688f, 0.115676f, 0.056218f, 0.064766f, 0.075912f, 0.119212f, 0.086164f, 0.170016f, 0.232783f, -0.139878f, -0.013006f, 0.000059f, -0.001236f, 0.128752f, -0.169343f, 0.060294f, -0.060704f, -0.043413f, 0.075346f, 0.082580f, -0.072298f, 0.084352f, -0.172717f, 0.007954f, 0.043588f, 0.046206f, -0.096304f, 0.079856f, -0.121092f, -0.069860f, -0.006365f, -0.088366f, 0.029397f, -0.178470f, -0.134464f, 0.136522f, -0.085423f, 0.085205f, -0.042279f, -0.079212f, 0.188284f, -0.043103f, -0.047775f, -0.168786f, -0.148386f, 0.051572f, 0.106576f, -0.170047f, 0.011871f, 0.200561f, -0.153683f, 0.063174f, 0.178903f, 0.008679f, 0.084238f, -0.195152f, -0.017687f, -0.203886f, -0.038867f, -0.117131f, 0.032970f, 0.135783f, -0.108932f, -0.078966f, 0.071341f, 0.010357f, 0.007886f, 0.086052f, 0.064488f, -0.104064f, 0.099674f, -0.016092f, -0.015948f, 0.177877f, 0.087884f, 0.150473f, 0.160390f, -0.005765f, -0.216846f, -0.059224f, -0.158753f, 0.038450f, 0.190399f, -0.195811f, -0.034980f, -0.119221f, 0.142720f, -0.123968f, -0.218237f, -0.042656f, -0.103761f, -0.040972f, 0.035623f, 0.150313f, -0.119162f, -0.059649f, -0.171941f, 0.006727f, 0.103455f, 0.063580f, 0.090199f, 0.000265f, -0.124173f, -0.140940f, -0.105032f, -0.237991f, 0.098501f, 0.053515f, 0.102244f, -0.120585f, -0.176073f, -0.097804f, 0.193253f, 0.076768f, -0.063566f, -0.094782f, -0.003418f, -0.000229f, -0.028442f, 0.037511f, 0.057405f, 0.144242f, -0.134697f, 0.042667f, 0.059450f, -0.095378f, -0.065684f, -0.274549f, -0.006584f, -0.074370f, -0.034775f, 0.047424f, 0.178690f, -0.074387f, -0.216633f, -0.171744f, -0.116306f, 0.064296f, 0.002436f, -0.035487f, 0.109826f, -0.179382f, -0.080428f, 0.033676f, 0.036551f, -0.226246f, -0.141929f, -0.183530f, 0.020941f, 0.120474f, 0.159518f, 0.030869f, -0.079675f, 0.100138f, -0.190529f, -0.043678f, -0.230392f, -0.035467f, 0.139512f, -0.107178f, 0.023942f, 0.144384f, 0.108563f, -0.039399f, -0.078427f, -0.082771f, -0.134985f, 0.085012f, 0.137761f, -0.219592f, 0.011952f, -0.156232f, 0.090740f, -0.128185f, 0.000230f, -0.200321f, -0.212843f, -0.082255f, 0.008415f, 0.005079f, -0.008835f, -0.215904f, -0.071260f, 0.118367f, 0.006994f, 0.083436f, -0.017897f, 0.092414f, 0.129757f, -0.128012f, 0.110870f, -0.132108f, -0.187772f, -0.073569f, 0.170452f, 0.123511f, -0.016887f, -0.093804f, 0.141526f, -0.037855f, 0.106103f, 0.170381f, 0.009253f, -0.154395f, -0.063268f, 0.132093f, 0.041095f, -0.219386f, 0.076238f, -0.201054f, -0.016754f, -0.018909f, -0.155661f, -0.123819f, 0.104877f, 0.144518f, -0.188354f, -0.169768f, -0.213692f, -0.089642f, 0.052483f, -0.095540f, -0.114579f, -0.060494f, 0.170172f, 0.142885f, 0.093575f, 0.134643f, 0.111467f, 0.055950f, 0.062380f, -0.037223f, 0.202829f, 0.019842f, -0.095391f, -0.127180f, -0.156507f, -0.173750f, -0.050821f, 0.014173f, -0.242628f, 0.070277f, 0.071947f, -0.169947f, 0.004469f, -0.077311f, 0.122404f, 0.121996f, -0.127992f, -0.143520f, -0.225479f, 0.019546f, 0.053918f, 0.128761f, 0.107710f, 0.035009f, -0.274035f, -0.137189f, 0.015509f, 0.102607f, -0.081756f, 0.180182f, -0.190659f, -0.083507f, -0.169540f, 0.158259f, 0.145815f, 0.067495f, 0.060015f, -0.177574f, -0.131819f, -0.080733f, -0.103376f, 0.172754f, 0.000840f, -0.005812f, -0.158345f, -0.049213f, 0.078712f, 0.146811f, 0.010305f, -0.159754f, -0.076105f, -0.265356f, -0.159897f, 0.201895f, -0.132717f, -0.142151f, -0.019186f, 0.495660f, 0.372234f, 0.014984f, -0.177851f, -0.214546f, -0.194759f, 0.092826f, -0.143770f, 0.092047f, -0.165591f, 0.364673f, 0.166268f, -0.116313f, 0.117882f, -0.013617f, 0.165040f, 0.045295f, 0.133315f, 0.038875f, -0.035158f, 0.182178f, -0.048628f, -0.048633f, -0.081685f, 0.245400f, 0.277142f, 0.045923f, -0.021690f, -0.042731f, 0.054006f, 0.039000f, -0.130941f, 0.131973f, 0.184160f, -0.149200f, -0.236452f, 0.020858f, 0.106963f, 0.101639f, -0.165937f, 0.039234f, -0.141117f, 0.016546f, -0.182665f, 0.041123f, -0.049602f, -0.080938f, 0.257805f, -0.075954f, 0.027335f, -0.149389f, -0.072275f, -0.143750f, -0.153991f, 0.125273f, -0.161712f, 0.211528f, 0.173087f, 0.108165f, -0.097406f, 0.150621f, 0.027958f, 0.012855f, -0.019792f, -0.194779f, -0.148691f, 0.152561f, -0.142787f, 0.068748f, 0.049093f, -0.111070f, -0.074796f, 0.001523f, 0.003290f, -0.061362f, 0.169284f, -0.188319f, -0.018882f, -0.146923f, -0.026197f, -0.433282f, 0.028762f, 0.184657f, 0.130610f, 0.147899f, 0.150500f, 0.226043f, 0.153365f, 0.037203f, 0.175402f, -0.374213f, 0.206979f, 0.210364f, -0.141357f, -0.030090f, -0.177012f, -0.104748f, 0.089524f, -0.108293f, -0.056397f, 0.006966f, 0.121276f, 0.231659f, -0.092773f, -0.370246f, -0.045056f, 0.049259f, 0.123696f, 0.101590f, 0.188580f, -0.053839f, 0.127293f, 0.202603f, 0.192683f, 0.061422f, -0.111882f, -0.024440f, -0.117083f, 0.069093f, 0.062607f, -0.087103f, 0.074503f, -0.022526f, 0.110173f, 0.126021f, -0.073443f, -0.005937f, 0.014057f, -0.087375f, -0.025748f, -0.077027f, -0.032114f, -0.128967f, 0.073886f, -0.024716f, -0.082594f, -0.253061f, -0.190091f, -0.002083f, 0.178479f, 0.070037f, 0.103616f, -0.055589f, -0.112873f, -0.041416f, -0.037309f, -0.214092f, 0.089862f, -0.104392f, 0.301300f, -0.169272f, -0.016607f, 0.072246f, -0.148445f, -0.188034f, -0.024240f, 0.038819f, 0.184194f, -0.216875f, 0.136491f, 0.172889f, -0.211795f, 0.190005f, -0.065365f, 0.094981f, -0.121992f, -0.051221f, -0.083392f, -0.267874f, 0.176186f, 0.249290f, 0.089179f, 0.102418f, 0.074151f, -0.125459f, -0.120251f, 0.174261f, -0.160700f, 0.078138f, 0.151433f, -0.168315f, -0.089275f, -0.279949f, -0.007249f, 0.114320f, 0.089555f, 0.000638f, -0.031169f, -0.055855f, -0.024207f, -0.163795f, -0.074502f, 0.017793f, -0.131933f, 0.175511f, 0.123813f, -0.221040f, -0.053360f, 0.057757f, 0.034319f, 0.121710f, 0.171908f, -0.037213f, -0.054635f, -0.309645f, 0.196465f, 0.187006f, 0.067413f, -0.102550f, 0.047369f, -0.041186f, 0.045754f, 0.189583f, 0.251051f, 0.184487f, -0.060596f, 0.260227f, 0.023032f, -0.048856f, -0.280878f, 0.129707f, 0.170302f, -0.076079f, 0.283463f, -0.054308f, 0.057767f, -0.127112f, 0.265049f, -0.068575f, -0.200330f, -0.229081f, -0.001878f, -0.112726f, -0.047022f, 0.259850f, 0.213074f, -0.179348f, -0.071650f, -0.098197f, -0.330803f, -0.355929f, 0.050357f, 0.043159f, 0.290173f, -0.009714f, 0.199430f, -0.007133f, 0.044648f, 0.012145f, -0.060335f, -0.237709f, 0.174921f, 0.220856f, -0.214061f, 0.179798f, 0.200015f, 0.083235f, 0.218061f, -0.032202f, -0.020959f, -0.109142f, -0.208846f, 0.280920f, -0.154738f, -0.529854f, -0.290065f, -0.111734f, 0.094731f, 0.271108f, 0.059564f, -0.168924f, -0.101468f, -0.107708f, 0.168492f, -0.020302f, 0.072694f, -0.099900f, 0.163600f, 0.280666f, -0.104988f, 0.224256f, -0.053513f, 0.022648f, -0.044283f, -0.205555f, 0.246261f, 0.050591f, 0.156703f, 0.234244f, 0.158256f, 0.109417f, 0.069702f, -0.034750f, -0.185854f, -0.287769f, 0.076424f, -0.016424f, 0.110003f, -0.032511f, -0.162031f, -0.123637f, -0.158070f, -0.200639f, -0.300271f, 0.006231f, 0.177028f, -0.135472f, -0.067706f, -0.062334f, 0.152818f, 0.038968f, -0.217901f, -0.229029f, -0.212042f, 0.132727f, 0.024816f, -0.035044f, -0.065602f, -0.154583f, 0.042291f, -0.108603f, -0.230511f, -0.059797f, -0.073126f, 0.128106f, -0.289502f, 0.008910f, -0.138186f, -0.142192f, -0.154372f, -0.067013f, -0.016726f, -0.018951f, -0.539488f, 0.320130f, 0.047197f, 0.193525f, -0.108511f, 0.016198f, 0.017275f, 0.075003f, -0.113669f, -0.041570f, -0.051356f, -0.068312f, 0.025767f, -0.176197f, 0.172554f, -0.167489f, 0.091117f, 0.086670f, -0.125265f, -0.014208f, 0.089918f, 0.317624f, -0.160054f, 0.002632f, -0.098910f, -0.045746f, 0.085423f, 0.000310f, -0.200896f, -0.047329f, 0.119653f, -0.183937f, 0.056298f, 0.226032f, -0.064165f, -0.071606f, 0.111575f, -0.252266f, -0.115544f, 0.222494f, 0.058946f, 0.129353f, 0.107510f, -0.101912f, 0.179289f, 0.055888f, -0.160478f, -0.084300f, 0.192543f, 0.073604f, 0.006956f, 0.023845f, 0.022389f, 0.250029f, 0.175448f, 0.160325f, -0.328688f, -0.122085f, 0.045329f, -0.072805f, -0.134232f, -0.109649f, -0.135676f, 0.057674f, -0.138676f, -0.070580f, -0.131676f, -0.374716f, -0.043563f, -0.073781f, 0.155004f, 0.165601f, -0.106443f, 0.279440f, 0.005874f, -0.139684f, -0.091638f, -0.132259f, 0.025332f, 0.201794f, 0.101079f, 0.222413f, -0.092363f, 0.231995f, -0.078177f, -0.245456f, -0.058131f, 0.067591f, -0.033919f, 0.036189f, -0.002981f, -0.438391f, -0.402534f, 0.178244f, 0.012411f, 0.230308f, 0.234658f, 0.176906f, 0.162563f, -0.043052f, -0.194898f, -0.130862f, -0.064538f, 0.112488f, -0.030822f, 0.106810f, 0.225116f, 0.075789f, -0.136359f, 0.113929f, 0.085870f, -0.137458f, 0.160157f, -0.108396f, 0.192994f, -0.199661f, 0.077336f, 0.014251f, -0.149673f, 0.220725f, -0.048090f, 0.011160f, 0.220229f, -0.133740f, 0.039015f, 0.078915f, -0.153344f, -0.117237f, 0.050575f, -0.137333f, 0.023652f, 0.066992f, 0.149444f, -0.166259f, 0.185059f, 0.061403f, -0.354654f, 0.026558f, 0.031980f, -0.136663f, 0.192401f, 0.182767f, 0.142388f, -0.154718f, -0.164659f, -0.072249f, -0.225006f, -0.108386f, 0.251639f, -0.055242f, -0.061928f, -0.077132f, 0.178143f, -0.145045f, 0.120896f, -0.312950f, -0.189435f, -0.222032f, -0.112363f, -0.149932f, -0.124594f, 0.179395f, -0.135938f, 0.104965f, -0.030820f, -0.105940f, -0.224376f, -0.047341f, -0.061955f, 0.342160f, -0.125981f, -0.163217f, -0.155859f, 0.161295f, -0.040385f, 0.144009f, 0.219032f, -0.107489f, 0.046554f, 0.040140f, -0.122228f, 0.223849f, 0.103246f, -0.004450f, 0.171969f, 0.227889f, 0.150708f, -0.124357f, 0.114047f, 0.063750f, 0.169690f, -0.265676f, -0.128743f, 0.132993f, 0.158611f, -0.247840f, -0.117048f, 0.087258f, 0.173204f, -0.051105f, -0.123965f, -0.082389f, 0.157942f, 0.010978f, -0.187664f, 0.202787f, -0.062336f, 0.212861f, -0.043289f, 0.048868f, -0.050537f, 0.038018f, -0.039694f, 0.269579f, 0.119431f, -0.043854f, 0.020516f, -0.010870f, -0.010271f, 0.171568f, 0.133789f, 0.262034f, 0.104057f, 0.013744f, -0.052946f, -0.238081f, -0.173907f, -0.400057f, -0.092732f, 0.137322f, 0.177092f, 0.063500f, 0.195324f, 0.096644f, 0.053128f, 0.070990f, 0.130440f, -0.015275f, 0.218603f, 0.294390f, -0.010561f, 0.087293f, 0.130156f, -0.021977f, 0.258560f, 0.116514f, -0.043982f, 0.046634f, -0.138393f, -0.086076f, 0.161525f, -0.263066f, -0.102733f, -0.031755f, 0.257009f, 0.032863f, -0.038790f, -0.078607f, 0.108946f, 0.236934f, -0.008535f, 0.105282f, 0.275853f, 0.016690f, 0.053594f, 0.302563f, 0.218801f, -0.076337f, 0.239393f, -0.008899f, -0.156782f, 0.154378f, -0.002255f, 0.200475f, -0.029960f, 0.229196f, 0.098774f, -0.278306f, 0.031803f, -0.014027f, -0.154835f, -0.003380f, 0.151185f, -0.106112f, -0.106880f, 0.056016f, -0.123142f, 0.008910f, 0.053733f, -0.003476f, -0.197531f, 0.183038f, -0.179908f, -0.049605f, -0.185644f, -0.147983f, 0.051888f, -0.212830f, 0.142720f, 0.084624f, 0.142906f, 0.013872f, -0.064190f, 0.071851f, 0.199246f, 0.166071f, -0.193827f, 0.043125f, -0.209834f, 0.184259f, 0.075870f, -0.092509f, 0.124899f, -0.024782f, -0.044466f, -0.227534f, 0.129043f, -0.150384f, 0.086132f, 0.188596f, -0.270120f, 0.025366f, -0.109772f, -0.096395f, -0.144209f, -0.116322f, 0.138203f, 0.000830f, -0.122669f, -0.252131f, 0.245762f, -0.100557f, 0.130269f, -0.168076f, 0.164710f, -0.174882f, 0.154435f, 0.118239f, -0.025999f, -0.143027f, -0.143583f, -0.217511f, 0.133373f, 0.173030f, -0.191641f, -0.148839f, -0.138527f, -0.049665f, -0.173096f, -0.067785f, -0.068908f, 0.202929f, -0.009621f, -0.146233f, -0.265132f, 0.022153f, -0.244613f, -0.165010f, 0.169921f, -0.194077f, 0.104892f, 0.033277f, -0.016997f, -0.036807f, -0.212835f, -0.019858f, 0.076891f, -0.015342f, -0.143712f, 0.161543f, -0.140957f, 0.068048f, -0.126735f, -0.161127f, 0.173124f, 0.015444f, -0.243296f, -0.098199f, 0.109644f, -0.094267f, 0.145873f, -0.224302f, 0.103576f, 0.027126f, -0.154886f, 0.089226f, -0.155429f, 0.361024f, 0.162030f, -0.018237f, -0.100355f, 0.007735f, 0.161680f, 0.134585f, 0.038899f, 0.101393f, -0.324357f, 0.135160f, -0.274459f, -0.188866f, 0.046280f, 0.163892f, -0.126626f, -0.081481f, -0.166205f, -0.387454f, -0.360354f, -0.128011f, -0.136958f, 0.177740f, 0.189617f, 0.006176f, -0.016971f, -0.140095f, -0.054211f, 0.185865f, 0.008835f, -0.008150f, -0.243627f, -0.052243f, 0.195371f, -0.128192f, -0.069228f, 0.085136f, 0.153953f, -0.217925f, -0.030406f, -0.221280f, -0.073121f, 0.041357f, 0.093756f, 0.090798f, 0.040325f, -0.000935f, -0.078544f, -0.017122f, -0.163498f, 0.191463f, 0.070137f, 0.072019f, -0.043835f, 0.156211f, 0.182726f, -0.049331f, -0.123591f, 0.203258f, -0.051865f, -0.081134f, -0.164688f, -0.051101f, 0.147006f, 0.176491f, -0.228027f, -0.110038f, -0.128242f, 0.027623f, 0.022120f, 0.242223f, -0.024193f, -0.148219f, 0.104585f, -0.094672f, 0.144199f, 0.104644f, -0.214387f, 0.196873f, -0.211603f, 0.107325f, 0.182551f, 0.180847f, -0.101257f, -0.032759f, -0.263197f, 0.140358f, -0.187707f, -0.077253f, -0.016876f, 0.286295f, -0.108032f, 0.093293f, 0.161142f, 0.019252f, 0.010270f, 0.030693f, -0.025064f, -0.187512f, -0.221165f, 0.030988f, -0.192491f, 0.285433f, 0.176767f, -0.146396f, -0.222429f, -0.242146f, 0.079795f, -0.057342f, -0.019256f, -0.024386f, 0.021775f, 0.181205f, -0.232317f, -0.136774f, -0.124363f, 0.072699f, -0.182817f, -0.148303f, 0.135717f, -0.270638f, -0.196593f, 0.165126f, 0.208419f, -0.158352f, 0.258533f, -0.100268f, 0.028645f, 0.038973f, 0.256851f, 0.005559f, -0.025882f, -0.128346f, 0.251720f, 0.256144f, -0.181993f, -0.075391f, -0.151307f, -0.035886f, -0.201545f, -0.071029f, 0.239748f, 0.019678f, -0.082675f, 0.138709f, 0.068387f, 0.083729f, 0.208035f, 0.033208f, 0.017685f, 0.132605f, 0.269909f, 0.076246f, 0.030054f, 0.325960f, 0.154114f, -0.168753f, 0.136822f, 0.115700f, -0.107322f, -0.339531f, 0.059631f, -0.070372f, 0.184478f, 0.156788f, 0.238304f, 0.241056f, 0.121293f, -0.171730f, -0.050961f, -0.404044f, 0.142708f, -0.047343f, 0.037405f, -0.028117f, -0.103896f, -0.109626f, -0.088682f, -0.115922f, -0.233031f, -0.034533f, -0.081475f, 0.014744f, 0.120693f, -0.208290f, -0.261406f, 0.201700f, -0.101078f, 0.102294f, 0.129137f, -0.150771f, 0.137099f, 0.185903f, -0.060544f, -0.039863f, 0.160383f, 0.279706f, 0.040157f, -0.100057f, 0.110376f, 0.001312f, 0.184828f, 0.113645f, 0.165007f, -0.134835f, -0.177848f, 0.048945f, 0.086275f, -0.178793f, 0.097371f, 0.172148f, -0.025819f, 0.133757f, -0.203888f, -0.002325f, -0.051805f, -0.045804f, -0.080066f, 0.111359f, 0.184467f, 0.087227f, -0.060987f, -0.115196f, 0.089712f, 0.214454f, -0.001018f, 0.120809f, -0.032686f, -0.091194f, 0.057539f, -0.062502f, 0.036211f, -0.218318f, 0.007830f, 0.001901f, 0.098080f, -0.215244f, -0.105926f, -0.182440f, 0.068013f, 0.034011f, -0.161461f, 0.140777f, -0.164058f, 0.049174f, -0.130055f, 0.090362f, 0.110800f, 0.001899f, -0.208115f, -0.211519f, 0.204598f, -0.097780f, -0.114326f, 0.096740f, -0.203080f, -0.016731f, -0.058517f, -0.071062f, 0.178415f, -0.080434f, 0.056851f, -0.119662f, -0.067733f, 0.013519f, -0.038172f, 0.186520f, 0.068424f, -0.074473f, -0.135605f, -0.166689f, 0.168411f, -0.005538f, -0.179235f, 0.103944f, -0.209712f, -0.046734f, 0.081737f, -0.137509f, -0.103513f, -0.012043f, -0.159123f, -0.133585f, 0.157918f, 0.183916f, 0.035210f, 0.075572f, -0.205469f, -0.024891f, 0.118957f, -0.003529f, 0.120756f, 0.209204f, -0.148295f, 0.161806f, -0.016049f, -0.200769f, -0.055615f, -0.144887f, -0.066718f, -0.161058f, -0.165323f, -0.039294f, -0.167823f, -0.212660f, -0.096493f, -0.167813f, -0.106581f, -0.150360f, -0.216036f, -0.047104f, 0.139378f, 0.159394f, 0.190144f, 0.027734f, -0.094772f, -0.236510f, -0.114112f, -0.022685f, -0.246395f, -0.112736f, 0.050265f, 0.076360f, -0.214005f, 0.102752f, 0.065930f, 0.014840f, -0.111560f, -0.127090f, 0.003967f, -0.297363f, -0.171008f, -0.023758f, 0.139951f, -0.133902f, 0.079728f, -0.051526f, 0.172884f, -0.021099f, -0.135186f, 0.164082f, 0.045215f, 0.155479f, -0.175996f, 0.008498f, -0.016547f, 0.022906f, 0.034293f, -0.030510f, -0.205690f, -0.107733f, -0.042174f, -0.210456f, -0.131736f, 0.048017f, -0.129435f, -0.068323f, -0.131140f, -0.036442f, 0.165362f, 0.075251f, -0.035735f, 0.083295f, 0.151743f, -0.308620f, -0.116425f, -0.111775f, 0.019956f, 0.079966f, 0.179989f, -0.273674f, -0.070521f, 0.151854f, -0.103166f, 0.025761f, 0.136925f, 0.160051f, -0.075567f, 0.001616f, -0.341361f, 0.279820f, 0.097436f, 0.090983f, -0.045484f, 0.118928f, 0.223877f, 0.044782f, -0.016416f, -0.025356f, -0.338820f, 0.050545f, -0.056596f, -0.103344f, 0.086140f, 0.043778f, 0.225035f, -0.016150f, 0.212521f, 0.006608f, -0.266077f, -0.274408f, -0.112974f, -0.031558f, 0.233689f, 0.258621f, 0.225449f, 0.020733f, -0.096134f, -0.157352f, -0.130412f, -0.326547f, -0.112844f, -0.132292f, -0.213480f, 0.075846f, 0.039459f, 0.283161f, 0.252234f, -0.276733f, 0.113929f, -0.105285f, -0.038187f, 0.055269f, -0.291564f, -0.236674f, -0.329116f, 0.191404f, 0.264293f, -0.033970f, -0.049300f, 0.012003f, 0.033432f, 0.188703f, -0.028078f, 0.097617f, -0.026533f, 0.164555f, 0.122845f, -0.086474f, -0.105876f, -0.065356f, 0.078819f, 0.046434f, 0.131087f, -0.082325f, -0.178569f, 0.052748f, -0.189563f, 0.018305f, 0.056835f, -0.188397f, 0.011413f, 0.145256f, 0.093846f, 0.022542f, 0.153084f, 0.174340f, 0.094743f, -0.201651f, 0.103298f, -0.083339f, -0.103283f, -0.013565f, -0.074336f, -0.195315f, -0.032499f, -0.029950f, 0.086919f, 0.142162f, 0.136092f, -0.124660f, 0.113481f, 0.051039f, -0.133743f, 0.044527f, -0.149383f, -0.007361f, -0.140337f, 0.007746f, -0.217855f, 0.147617f, -0.075733f, -0.141606f, 0.165720f, 0.117071f, -0.118553f, -0.125038f, -0.121742f, -0.059947f, 0.103640f, -0.189606f, 0.019459f, -0.158475f, 0.048642f, 0.029853f, 0.055464f, -0.121007f, -0.169074f, 0.100320f, 0.035510f, -0.006720f, 0.120416f, -0.348907f, 0.251607f, 0.048159f, -0.133066f, 0.091848f, 0.060665f, 0.096398f, 0.121710f, 0.089165f, -0.091650f, 0.026598f, -0.044763f, -0.184903f, 0.167607f, -0.115525f, 0.043935f, 0.014958f, 0.031081f, -0.001958f, 0.104978f, -0.131442f, -0.153945f, -0.038805f, -0.133510f, -0.011264f, -0.009096f, -0.051138f, 0.179996f, -0.116969f, 0.016287f, -0.056722f, 0.148171f, 0.151972f, 0.008141f, -0.140698f, 0.075247f, -0.081193f, -0.110470f, -0.191144f, -0.198990f, 0.091884f, -0.162933f, -0.198237f, -0.105942f, 0.108942f, 0.169344f, -0.074444f, 0.197283f, 0.023773f, 0.044835f, -0.080307f, -0.125148f, 0.125059f, 0.039874f, -0.101110f, 0.134981f, 0.067162f, 0.186309f, 0.180230f, 0.020472f, -0.112084f, 0.069018f, 0.010349f, -0.137625f, -0.142318f, -0.044608f, 0.089349f, 0.087951f, -0.174539f, 0.175683f, 0.001233f, -0.074489f, -0.192419f, 0.142637f, -0.050557f, -0.220511f, -0.246467f, -0.080457f, -0.136248f, -0.175957f, -0.201838f, -0.065265f, -0.057963f, -0.220841f, 0.145942f, 0.181732f, -0.034858f, 0.112374f, -0.154728f, -0.158352f, -0.203944f, -0.080086f, 0.123311f, 0.034163f, 0.016746f, 0.076732f, 0.029842f, 0.019468f, 0.081552f, -0.040443f, -0.169935f, 0.173561f, -0.154741f, 0.032335f, 0.153437f, 0.019567f, 0.188473f, 0.183561f, 0.017405f, 0.159972f, 0.147368f, 0.184905f, -0.165317f, 0.090288f, 0.103042f, 0.172339f, -0.089001f, 0.136274f, -0.214651f, -0.004358f, 0.035905f, 0.135023f, 0.040607f, -0.078084f, -0.077411f, 0.139669f, 0.069524f, 0.177174f, -0.086979f, 0.171589f, -0.200564f, -0.159161f, -0.068132f, -0.008301f, 0.030834f, 0.117136f, 0.085927f, 0.166271f, -0.225231f, 0.189533f, -0.162981f, 0.022150f, -0.044082f, -0.068966f, 0.015930f, -0.116404f, -0.178926f, -0.009231f, -0.105755f, -0.005780f, -0.112813f, 0.008441f, 0.022323f, -0.123714f, -0.107805f, -0.147658f, -0.062643f, 0.090228f, -0.195468f, 0.089629f, -0.103756f, -0.180355f, -0.209719f, -0.176128f, 0.084813f, -0.242659f, -0.093263f, -0.030183f, 0.059054f, -0.084872f, -0.177352f, -0.015043f, 0.054233f, -0.077924f, -0.018315f, -0.151086f, 0.001983f, 0.021498f, -0.150266f, 0.030984f, 0.081948f, -0.040176f, -0.119810f, 0.056332f, 0.167896f, 0.110721f, -0.080490f, -0.026207f, 0.047454f, 0.215156f, 0.195018f, -0.138199f, -0.090349f, -0.188285f, 0.159463f, 0.132551f, 0.173014f, -0.072606f, 0.193142f, 0.195151f, 0.062525f, -0.087877f, 0.182012f, -0.088011f, -0.150147f, -0.121457f, 0.049186f, -0.268189f, -0.180290f, 0.174486f, -0.000369f, 0.126993f, 0.071611f, -0.151702f, -0.160634f, 0.053566f, -0.055705f, 0.002870f, -0.237687f, -0.169992f, 0.194573f, 0.007385f, 0.063428f, 0.242703f, -0.139747f, 0.149449f, -0.024614f, 0.002692f, -0.302849f, -0.024129f, -0.011323f, -0.086644f, 0.284610f, 0.002616f, 0.265216f, 0.252519f, -0.085032f, -0.177950f, -0.026199f, -0.125241f, 0.128672f, 0.120845f, -0.328971f, -0.423131f, -0.011481f, -0.041481f, -0.144903f, -0.123374f, 0.219615f, 0.034216f, 0.181601f, 0.105192f, -0.067623f, 0.226608f, -0.121317f, 0.191840f, 0.036132f, 0.170121f, 0.094847f, 0.231996f, 0.176192f, 0.182535f, 0.076911f, 0.195535f, 0.128313f, -0.125044f, 0.243510f, 0.041065f, -0.177149f, -0.024159f, 0.080122f, -0.130054f, 0.102089f, 0.117466f, 0.085968f, -0.146574f, -0.167636f, 0.183532f, -0.060877f, -0.124989f, 0.143538f, 0.035041f, -0.070289f, -0.063018f, 0.092127f, -0.185442f, 0.111263f, 0.131159f, -0.149281f, -0.156015f, 0.063415f, -0.031153f, 0.104071f, -0.170652f, 0.096980f, -0.018986f, -0.220335f, -0.074668f, -0.017184f, 0.091609f, -0.122975f, 0.055372f, 0.163465f, 0.028025f, -0.142593f, -0.143950f, -0.130473f, -0.169503f, 0.188977f, 0.091623f, 0.194425f, -0.220400f, -0.295600f, -0.028339f, -0.046844f, 0.072582f, 0.170655f, -0.055733f, -0.211302f, -0.096724f, -0.361793f, 0.290164f, -0.178121f, -0.135604f, -0.212518f, 0.160167f, 0.181581f, -0.125544f, 0.053085f, 0.190431f, -0.127764f, -0.100446f, -0.073554f, -0.216032f, -0.094805f, 0.009869f, 0.018684f, 0.122760f, -0.010646f, 0.128313f, -0.094969f, -0.087069f, 0.173479f, 0.117288f, 0.072486f, -0.015572f, 0.012820f, -0.088206f, 0.042822f, -0.149177f, 0.073333f, 0.035829f, -0.128013f, 0.096854f, 0.104425f, -0.164352f, -0.107739f, 0.039635f, -0.214199f, 0.077633f, -0.030116f, 0.185205f, 0.057681f, -0.164846f, -0.211417f, 0.140232f, 0.001414f, -0.187694f, -0.101315f, 0.147633f, 0.117689f, 0.019597f, -0.098373f, -0.025560f, 0.035788f, -0.120907f, -0.108787f, 0.038583f, -0.144703f, 0.153412f, 0.008887f, 0.141201f, -0.031744f, 0.041903f, 0.063498f, -0.132577f, 0.030600f, 0.052710f, -0.068865f, 0.019916f, -0.171610f, -0.041770f, -0.081810f, -0.098864f, 0.013598f, -0.018070f, 0.143693f, -0.280796f, -0.161124f, 0.032724f, -0.081663f, 0.079999f, 0.125616f, 0.141678f, -0.133487f, 0.022319f, -0.007702f, 0.126539f, -0.070836f, -0.197303f, -0.210373f, -0.038574f, 0.002107f, 0.140631f, -0.106813f, 0.138172f, 0.035631f, 0.102254f, -0.096152f, 0.033631f, 0.020193f, -0.168928f, -0.133195f, -0.011954f, -0.218717f, 0.165339f, -0.096654f, 0.213601f, -0.205441f, 0.144913f, 0.064711f, -0.193680f, 0.108654f, -0.082226f, -0.285880f, 0.094702f, 0.261671f, -0.161549f, -0.086648f, 0.148697f, -0.070546f, 0.027206f, 0.022196f, -0.034746f, 0.195749f, -0.153877f, -0.057409f, 0.123714f, -0.407320f, -0.295367f, -0.149490f, -0.127945f, 0.133721f, -0.332794f, -0.074564f, -0.123337f, -0.006887f, -0.147636f, -0.188811f, 0.274820f, 0.216782f, -0.140661f, 0.099634f, 0.056496f, 0.007583f, -0.066248f, -0.140992f, 0.163292f, -0.432011f, -0.313854f, -0.170208f, -0.255764f, 0.156458f, -0.098750f, -0.136862f, -0.029706f, -0.171931f, -0.073004f, 0.073543f, 0.149740f, 0.187044f, 0.104474f, -0.401795f, -0.299035f, -0.248860f, -0.011751f, -0.106355f, 0.093445f, -0.135703f, 0.068317f, 0.176585f, -0.058283f, 0.076904f, -0.210908f, -0.036992f, -0.184257f, 0.153066f, 0.184226f, -0.000719f, -0.086087f, -0.014719f, -0.097776f, 0.043513f, 0.031709f, -0.038191f, 0.214012f, 0.012491f, -0.074500f, -0.210351f, -0.189790f, -0.267587f, -0.210736f, -0.071406f, 0.019171f, 0.210872f, 0.147240f, 0.105210f, 0.021827f, 0.054834f, 0.048404f, -0.123063f, -0.013917f, -0.112389f, -0.173380f, -0.181502f, -0.089466f, 0.184279f, 0.223809f, -0.256027f, -0.067157f, -0.304399f, -0.191719f, 0.046075f, -0.006592f, 0.130842f, -0.195169f, -0.171827f, -0.122509f, 0.078931f, 0.061068f, 0.190991f, 0.149193f, -0.221268f, -0.239344f, 0.097892f, -0.098968f, -0.226544f, 0.020509f, 0.168902f, -0.016856f, 0.096364f, 0.132448f, -0.007646f, 0.153019f, 0.027776f, -0.163967f, -0.001660f, -0.016197f, 0.040906f, -0.029823f, -0.136930f, -0.041305f, 0.177982f, -0.069431f, -0.210527f, -0.217864f, -0.117347f, 0.022581f, 0.052651f, -0.229612f, -0.068874f, 0.029110f, -0.190200f, -0.274651f, -0.221968f, 0.026622f, -0.207333f, -0.074722f, -0.312427f, -0.137890f, -0.028266f, -0.046234f, -0.143846f, -0.106829f, 0.207096f, 0.168959f, -0.010825f, -0.045107f, -0.184959f, -0.071825f, 0.165032f, 0.080089f, -0.058972f, -0.040284f, 0.201849f, -0.219765f, 0.099149f, -0.258376f, -0.018108f, 0.210595f, 0.162655f, -0.092511f, -0.060633f, -0.106003f, 0.202439f, 0.222941f, -0.184905f, -0.048499f, 0.025944f, 0.124487f, 0.030641f, 0.212779f, -0.152597f, -0.044464f, -0.197236f, 0.133777f, -0.068688f, -0.047133f, -0.333646f, 0.127295f, 0.103887f, 0.041026f, -0.102064f, 0.012502f, -0.075355f, 0.074103f, -0.401311f, 0.053018f, -0.027082f, 0.013096f, 0.160870f, 0.101575f, 0.002578f, -0.101195f, 0.154806f, 0.085114f, -0.048988f, -0.035815f, -0.008307f, -0.073727f, 0.300399f, -0.383171f, -0.264279f, -0.233092f, 0.028073f, -0.217751f, 0.192492f, -0.121648f, 0.137452f, 0.030356f, 0.027069f, 0.159775f, 0.119777f, 0.142258f, 0.204499f, 0.150085f, 0.058589f, -0.180616f, 0.063818f, 0.212433f, -0.186121f, -0.209576f, 0.034180f, -0.051109f, -0.089956f, 0.098583f, 0.003200f, 0.075270f, -0.113543f, -0.024089f, 0.057176f, -0.206659f, 0.109292f, -0.167810f, 0.092157f, -0.071943f, 0.007900f, -0.228128f, -0.158993f, -0.086668f, 0.169610f, -0.178118f, 0.096781f, 0.164694f, -0.113419f, -0.180135f, 0.069918f, -0.063662f, -0.096173f, 0.184670f, -0.215639f, 0.162378f, -0.079443f, -0.102448f, -0.216136f, -0.087185f, 0.124697f, -0.025667f, 0.159493f, -0.013033f, 0.053567f, 0.015951f, -0.161267f, -0.157264f, 0.127986f, 0.087950f, 0.044105f, -0.228865f, -0.215396f, -0.177000f, 0.127977f, 0.072170f, 0.118646f, -0.053964f, -0.104682f, -0.181880f, -0.203363f, 0.103087f, 0.086423f, 0.196660f, -0.259126f, -0.040704f, 0.091802f, 0.068063f, 0.194629f, -0.068129f, -0.067654f, 0.169155f, -0.093920f, 0.003736f, -0.054273f, -0.146987f, -0.065160f, -0.180703f, -0.002683f, 0.005949f, -0.188738f, -0.134071f, -0.133648f, 0.012895f, -0.199699f, -0.141257f, -0.029644f, -0.092455f, 0.086534f, 0.111098f, -0.147387f, 0.187304f, 0.129607f, -0.007896f, -0.041159f, 0.040211f, 0.214818f, -0.071916f, -0.080083f, -0.027333f, 0.044181f, -0.119507f, 0.162792f, 0.085509f, 0.029411f, 0.124687f, 0.058271f, -0.088919f, 0.237160f, 0.229406f, 0.065284f, 0.043653f, -0.114790f, 0.156104f, 0.108394f, 0.026418f, 0.147197f, 0.142283f, 0.010251f, -0.021369f, -0.160150f, -0.040403f, -0.310052f, -0.088788f, 0.032833f, 0.232728f, 0.104268f, 0.032088f, -0.003991f, -0.019337f, -0.179725f, 0.052926f, -0.045329f, 0.105115f, -0.050138f, -0.086495f, 0.147196f, 0.068902f, 0.155607f, 0.034038f, -0.103501f, -0.224100f, -0.054017f, 0.153373f, 0.197042f, -0.304391f, -0.366588f, 0.001887f, -0.163318f, -0.050637f, -0.134684f, 0.200967f, 0.029061f, -0.080095f, 0.084547f, -0.071907f, 0.011730f, 0.150668f, 0.242595f, -0.057443f, 0.248246f, 0.038777f, 0.016270f, -0.051631f, 0.091463f, 0.091699f, 0.020769f, 0.229420f, 0.119603f, 0.185222f, 0.092879f, 0.186071f, 0.090579f, 0.075295f, -0.127267f, 0.156790f, -0.094327f, 0.129230f, 0.056991f, -0.198041f, -0.165735f, 0.014007f, 0.127419f, -0.131136f, -0.041462f, -0.036319f, 0.112957f, -0.114207f, 0.107577f, -0.255727f, -0.215017f, -0.079577f, 0.018798f, -0.013936f, -0.141416f, -0.220113f, -0.158345f, 0.006081f, -0.097019f, 0.181414f, 0.031455f, -0.178092f, -0.228463f, 0.093761f, -0.082279f, 0.058381f, -0.190563f, 0.140446f, -0.125539f, -0.087422f, -0.033261f, 0.197430f, -0.020781f, 0.108238f, -0.106721f, -0.150005f, -0.248296f, -0.046378f, 0.037378f, -0.150324f, 0.059553f, -0.034512f, -0.040528f, -0.195528f, -0.241589f, -0.121112f, -0.170487f, 0.092766f, -0.009655f, -0.071129f, 0.136747f, -0.129666f, 0.201940f, 0.085778f, 0.112619f, -0.145016f, -0.097412f, -0.224227f, -0.161891f, -0.130508f, 0.161277f, -0.069509f, -0.110713f, -0.069932f, 0.027090f, 0.136938f, -0.206163f, -0.037474f, 0.164083f, 0.251389f, 0.118106f, 0.045539f, -0.216215f, 0.024943f, 0.027865f, -0.078067f, -0.052123f, -0.089320f, 0.140938f, -0.012542f, 0.046914f, -0.304645f, 0.239730f, -0.061347f, 0.220850f, -0.074264f, -0.109970f, 0.025457f, -0.084331f, 0.153597f, 0.017964f, -0.280058f, -0.192029f, 0.160369f, 0.041739f, -0.157599f, 0.263834f, 0.052032f, 0.068723f, 0.227674f, 0.127834f, -0.003398f, -0.038832f, -0.095723f, -0.199843f, 0.190451f, -0.097247f, -0.008452f, 0.208438f, 0.157446f, -0.205153f, 0.268077f, -0.259005f, 0.066473f, 0.243977f, -0.131181f, 0.227206f, -0.064846f, 0.207781f, -0.123433f, 0.038548f, 0.038520f, 0.181101f, -0.074568f, 0.385088f, -0.286404f, -0.123718f, -0.317582f, -0.196649f, -0.130841f, -0.135744f, 0.220511f, -0.171414f, 0.066411f, 0.181904f, -0.132210f, 0.012630f, 0.017490f, 0.219494f, 0.061815f, 0.071736f, 0.122313f, -0.164221f, -0.043507f, -0.002524f, 0.157484f, -0.066191f, 0.139836f, 0.056006f, 0.170674f, -0.229717f, 0.184285f, -0.152010f, 0.012326f, -0.108612f, 0.155920f, 0.016956f, 0.170629f, 0.154376f, -0.101606f, 0.214253f, -0.119825f, 0.198033f, -0.020949f, 0.101315f, -0.077735f, -0.005196f, 0.223933f, 0.032855f, 0.091496f, 0.107920f, -0.127971f, -0.111978f, 0.224973f, -0.165637f, 0.094879f, 0.258657f, 0.064788f, 0.091453f, -0.194966f, -0.047310f, -0.147944f, -0.377878f, -0.011409f, -0.136364f, 0.026669f, -0.071078f, 0.101227f, 0.065192f, 0.027136f, -0.313170f, -0.173971f, -0.322957f, 0.021097f, 0.277044f, -0.206880f, 0.338239f, 0.013432f, 0.039634f, 0.210687f, -0.010979f, -0.047907f, -0.116825f, 0.175895f, 0.071445f, -0.117032f, -0.426035f, 0.055831f, 0.061531f, -0.135158f, -0.062787f, -0.071816f, -0.152165f, 0.196782f, 0.005367f, 0.104747f, -0.001499f, 0.173620f, -0.027110f, 0.100853f, 0.041983f, 0.192939f, 0.215443f, 0.178210f, 0.220742f, -0.034350f, -0.204870f, -0.079248f, 0.047110f, 0.147893f, -0.101117f, 0.312643f, -0.263091f, -0.054110f, -0.055095f, 0.293160f, 0.212227f, 0.068060f, 0.253654f, 0.070717f, 0.295149f, -0.151703f, 0.175965f, 0.012358f, 0.133075f, 0.050522f, 0.182359f, 0.349045f, -0.006165f, -0.041733f, -0.186402f, -0.312150f, -0.325368f, 0.070247f, 0.273495f, 0.059258f, 0.268906f, 0.144136f, 0.039847f, -0.087525f, 0.039867f, -0.098144f, -0.418597f, 0.077142f, 0.090949f, 0.127463f, 0.028489f, 0.067457f, 0.255727f, 0.187012f, 0.044108f, -0.221739f, -0.245113f, -0.099507f, 0.310565f, -0.487383f, 0.172858f, 0.070780f, -0.086320f, 0.132689f, -0.072329f, 0.118801f, 0.080913f, 0.099721f, -0.033654f, -0.046951f, -0.392861f, -0.064884f, -0.118467f, 0.268575f, 0.268420f, 0.128939f, -0.091320f, 0.125243f, 0.173330f, -0.233786f, -0.001763f, -0.057592f, 0.045618f, 0.002344f, 0.176455f, 0.068935f, 0.134109f, 0.063861f, -0.020308f, 0.029829f, -0.009038f, -0.121881f, -0.223564f, -0.161558f, -0.123994f, 0.139732f, -0.097937f, -0.116813f, -0.211809f, 0.098959f, -0.033996f, -0.155060f, -0.045930f, 0.129211f, -0.418247f, -0.223285f, 0.049053f, -0.074353f, 0.018133f, 0.012336f, -0.168521f, 0.034613f, -0.141851f, -0.275188f, 0.030202f, -0.201537f, -0.203706f, -0.223758f, -0.233238f, -0.173840f, -0.143946f, 0.076833f, 0.054250f, -0.056666f, -0.242171f, -0.240010f, -0.015491f, 0.181505f, 0.099661f, 0.102107f, 0.102459f, 0.070799f, -0.213889f, -0.056041f, 0.193044f, 0.034783f, -0.064252f, 0.215490f, 0.001385f, -0.200118f, -0.136475f, -0.006175f, -0.181605f, -0.125487f, 0.145728f, 0.060220f, -0.168682f, 0.139131f, -0.167567f, 0.119707f, -0.050011f, 0.132701f, -0.217303f, 0.110570f, 0.074662f, 0.060247f, 0.163705f, 0.199868f, -0.122025f, 0.145439f, -0.153494f, -0.142885f, 0.130333f, -0.045021f, 0.172790f, -0.087061f, 0.006683f, 0.172385f, 0.098629f, 0.047497f, -0.124478f, 0.197369f, 0.221632f, 0.080362f, -0.213392f, -0.011843f, -0.171364f, 0.152150f, 0.091861f, 0.160713f, 0.107917f, 0.117124f, 0.257489f, -0.083070f, -0.073190f, -0.259336f, 0.135523f, -0.148790f, 0.051891f, 0.163035f, -0.177223f, 0.210404f, 0.141284f, 0.180880f, 0.186959f, -0.196974f, -0.380544f, 0.252493f, 0.230338f, -0.117647f, 0.339870f, -0.124217f, 0.070164f, -0.044507f, 0.021463f, -0.220176f, -0.394362f, 0.055806f, -0.010584f, 0.030192f, 0.056284f, -0.026055f, -0.086679f, 0.156777f, -0.368240f, 0.162095f, -0.100006f, 0.160226f, -0.068953f, 0.059397f, 0.110195f, 0.090508f, -0.129461f, 0.086829f, 0.002632f, 0.052174f, 0.031754f, 0.071399f, 0.237230f, -0.039526f, -0.281826f, -0.128110f, 0.123482f, -0.065977f, 0.195952f, 0.135108f, -0.141165f, -0.054219f, -0.136100f, 0.137955f, -0.132269f, 0.048122f, 0.266617f, 0.249155f, 0.207196f, 0.130471f, 0.067103f, -0.070356f, 0.240164f, -0.018311f, -0.099601f, -0.003922f, -0.185643f, -0.131111f, -0.210084f, 0.149288f, -0.217967f, 0.073061f, -0.052539f, -0.070229f, 0.201632f, -0.070066f, 0.108014f, 0.098211f, 0.087122f, 0.050861f, -0.026916f, -0.097843f, -0.148896f, 0.074503f, -0.141050f, -0.050629f, 0.003224f, -0.166491f, -0.151176f, -0.024146f, -0.183713f, -0.045691f, -0.114072f, 0.202933f, 0.350035f, 0.074821f, 0.064636f, 0.035271f, -0.114477f, 0.144399f, -0.195092f, -0.023225f, 0.275811f, -0.156605f, -0.113581f, 0.258887f, 0.077250f, 0.071655f, -0.195224f, -0.011816f, 0.055276f, 0.110747f, 0.200705f, -0.086795f, 0.301943f, -0.202109f, 0.189064f, 0.063306f, -0.030154f, -0.186485f, -0.054574f, 0.002068f, 0.077493f, -0.026607f, -0.365867f, -0.005153f, 0.038466f, -0.124723f, -0.073760f, 0.078492f, -0.167389f, 0.236543f, 0.163661f, -0.157264f, -0.056237f, 0.138561f, 0.142999f, 0.194667f, 0.215889f, -0.002255f, -0.051959f, 0.043139f, -0.020555f };
+static const float prediction_next_solar_gen_layer_6_biases[1] = { 0.543377f };
+static const float prediction_next_solar_gen_layer_6_weights[48] = { -0.048457f, 0.273554f, 0.035675f, 0.229310f, 0.006834f, 0.137414f, -0.021163f, -0.210891f, -0.097998f, 0.236734f, 0.133630f, 0.287153f, -0.238859f, -0.204829f, -0.132413f, -0.052161f, 0.208091f, -0.016817f, 0.132757f, 0.376064f, 0.167076f, 0.309272f, 0.135345f, -0.158703f, -0.197327f, -0.097418f, 0.167913f, -0.260583f, -0.085506f, 0.176192f, -0.105742f, -0.049273f, 0.246105f, 0.212439f, -0.293511f, -0.304092f, 0.358514f, 0.095576f, 0.318257f, -0.011293f, 0.192036f, -0.288281f, 0.161702f, 0.198337f, 0.154132f, -0.234966f, 0.173679f, 0.249884f };
+static float prediction_next_solar_gen_buf1[80];
+static float prediction_next_solar_gen_buf2[80];
+
+static void
+prediction_next_solar_gen_layer_0(const float *in, float *out)
+{
+  const float *w = prediction_next_solar_gen_layer_0_weights;
+  int o;
+
+  for(o = 0; o < 48; o++, w += 5) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4];
+    sum = sum + prediction_next_solar_gen_layer_0_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_solar_gen_layer_1(const float *in, float *out)
+{
+  const float *w = prediction_next_solar_gen_layer_1_weights;
+  int o;
+
+  for(o = 0; o < 80; o++, w += 48) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum = sum + prediction_next_solar_gen_layer_1_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_solar_gen_layer_2(const float *in, float *out)
+{
+  const float *w = prediction_next_solar_gen_layer_2_weights;
+  int o;
+
+  for(o = 0; o < 80; o++, w += 80) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum += w[48] * in[48]; sum += w[49] * in[49]; sum += w[50] * in[50]; sum += w[51] * in[51];
+    sum += w[52] * in[52]; sum += w[53] * in[53]; sum += w[54] * in[54]; sum += w[55] * in[55];
+    sum += w[56] * in[56]; sum += w[57] * in[57]; sum += w[58] * in[58]; sum += w[59] * in[59];
+    sum += w[60] * in[60]; sum += w[61] * in[61]; sum += w[62] * in[62]; sum += w[63] * in[63];
+    sum += w[64] * in[64]; sum += w[65] * in[65]; sum += w[66] * in[66]; sum += w[67] * in[67];
+    sum += w[68] * in[68]; sum += w[69] * in[69]; sum += w[70] * in[70]; sum += w[71] * in[71];
+    sum += w[72] * in[72]; sum += w[73] * in[73]; sum += w[74] * in[74]; sum += w[75] * in[75];
+    sum += w[76] * in[76]; sum += w[77] * in[77]; sum += w[78] * in[78]; sum += w[79] * in[79];
+    sum = sum + prediction_next_solar_gen_layer_2_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_solar_gen_layer_3(const float *in, float *out)
+{
+  const float *w = prediction_next_solar_gen_layer_3_weights;
+  int o;
+
+  for(o = 0; o < 32; o++, w += 80) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum += w[48] * in[48]; sum += w[49] * in[49]; sum += w[50] * in[50]; sum += w[51] * in[51];
+    sum += w[52] * in[52]; sum += w[53] * in[53]; sum += w[54] * in[54]; sum += w[55] * in[55];
+    sum += w[56] * in[56]; sum += w[57] * in[57]; sum += w[58] * in[58]; sum += w[59] * in[59];
+    sum += w[60] * in[60]; sum += w[61] * in[61]; sum += w[62] * in[62]; sum += w[63] * in[63];
+    sum += w[64] * in[64]; sum += w[65] * in[65]; sum += w[66] * in[66]; sum += w[67] * in[67];
+    sum += w[68] * in[68]; sum += w[69] * in[69]; sum += w[70] * in[70]; sum += w[71] * in[71];
+    sum += w[72] * in[72]; sum += w[73] * in[73]; sum += w[74] * in[74]; sum += w[75] * in[75];
+    sum += w[76] * in[76]; sum += w[77] * in[77]; sum += w[78] * in[78]; sum += w[79] * in[79];
+    sum = sum + prediction_next_solar_gen_layer_3_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_solar_gen_layer_4(const float *in, float *out)
+{
+  const float *w = prediction_next_solar_gen_layer_4_weights;
+  int o;
+
+  for(o = 0; o < 80; o++, w += 32) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum = sum + prediction_next_solar_gen_layer_4_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_solar_gen_layer_5(const float *in, float *out)
+{
+  const float *w = prediction_next_solar_gen_layer_5_weights;
+  int o;
+
+  for(o = 0; o < 48; o++, w += 80) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum += w[48] * in[48]; sum += w[49] * in[49]; sum += w[50] * in[50]; sum += w[51] * in[51];
+    sum += w[52] * in[52]; sum += w[53] * in[53]; sum += w[54] * in[54]; sum += w[55] * in[55];
+    sum += w[56] * in[56]; sum += w[57] * in[57]; sum += w[58] * in[58]; sum += w[59] * in[59];
+    sum += w[60] * in[60]; sum += w[61] * in[61]; sum += w[62] * in[62]; sum += w[63] * in[63];
+    sum += w[64] * in[64]; sum += w[65] * in[65]; sum += w[66] * in[66]; sum += w[67] * in[67];
+    sum += w[68] * in[68]; sum += w[69] * in[69]; sum += w[70] * in[70]; sum += w[71] * in[71];
+    sum += w[72] * in[72]; sum += w[73] * in[73]; sum += w[74] * in[74]; sum += w[75] * in[75];
+    sum += w[76] * in[76]; sum += w[77] * in[77]; sum += w[78] * in[78]; sum += w[79] * in[79];
+    sum = sum + prediction_next_solar_gen_layer_5_biases[o];
+    if(sum < 0.0f) sum = 0.0f;
+    out[o] = sum;
+  }
+}
+
+static void
+prediction_next_solar_gen_layer_6(const float *in, float *out)
+{
+  const float *w = prediction_next_solar_gen_layer_6_weights;
+  int o;
+
+  for(o = 0; o < 1; o++, w += 48) {
+    float sum = 0.0f;
+    sum += w[0] * in[0]; sum += w[1] * in[1]; sum += w[2] * in[2]; sum += w[3] * in[3];
+    sum += w[4] * in[4]; sum += w[5] * in[5]; sum += w[6] * in[6]; sum += w[7] * in[7];
+    sum += w[8] * in[8]; sum += w[9] * in[9]; sum += w[10] * in[10]; sum += w[11] * in[11];
+    sum += w[12] * in[12]; sum += w[13] * in[13]; sum += w[14] * in[14]; sum += w[15] * in[15];
+    sum += w[16] * in[16]; sum += w[17] * in[17]; sum += w[18] * in[18]; sum += w[19] * in[19];
+    sum += w[20] * in[20]; sum += w[21] * in[21]; sum += w[22] * in[22]; sum += w[23] * in[23];
+    sum += w[24] * in[24]; sum += w[25] * in[25]; sum += w[26] * in[26]; sum += w[27] * in[27];
+    sum += w[28] * in[28]; sum += w[29] * in[29]; sum += w[30] * in[30]; sum += w[31] * in[31];
+    sum += w[32] * in[32]; sum += w[33] * in[33]; sum += w[34] * in[34]; sum += w[35] * in[35];
+    sum += w[36] * in[36]; sum += w[37] * in[37]; sum += w[38] * in[38]; sum += w[39] * in[39];
+    sum += w[40] * in[40]; sum += w[41] * in[41]; sum += w[42] * in[42]; sum += w[43] * in[43];
+    sum += w[44] * in[44]; sum += w[45] * in[45]; sum += w[46] * in[46]; sum += w[47] * in[47];
+    sum = sum + prediction_next_solar_gen_layer_6_biases[o];
+    out[o] = sum;
+  }
+}
+
+int32_t
+prediction_next_solar_gen_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+{
+  int32_t i;
+
+  if(n_features != 5 || out_length < 1) {
+    return -1;
+  }
+  prediction_next_solar_gen_layer_0(features, prediction_next_solar_gen_buf1);
+  prediction_next_solar_gen_layer_1(prediction_next_solar_gen_buf1, prediction_next_solar_gen_buf2);
+  prediction_next_solar_gen_layer_2(prediction_next_solar_gen_buf2, prediction_next_solar_gen_buf1);
+  prediction_next_solar_gen_layer_3(prediction_next_solar_gen_buf1, prediction_next_solar_gen_buf2);
+  prediction_next_solar_gen_layer_4(prediction_next_solar_gen_buf2, prediction_next_solar_gen_buf1);
+  prediction_next_solar_gen_layer_5(prediction_next_solar_gen_buf1, prediction_next_solar_gen_buf2);
+  prediction_next_solar_gen_layer_6(prediction_next_solar_gen_buf2, prediction_next_solar_gen_buf1);
+  for(i = 0; i < 1; i++) {
+    out[i] = prediction_next_solar_gen_buf1[i];
+  }
+  return 0;
+}
+
+int32_t
+prediction_next_solar_gen_step(uint8_t layer, const float *features, int32_t n_features, float *out, int32_t out_length)
+{
+  int32_t i;
+
+  switch(layer) {
+  case 0:
+    if(n_features != 5 || out_length < 1) {
+      return -1;
+    }
+    prediction_next_solar_gen_layer_0(features, prediction_next_solar_gen_buf1);
+    return 1;
+  case 1:
+    prediction_next_solar_gen_layer_1(prediction_next_solar_gen_buf1, prediction_next_solar_gen_buf2);
+    return 1;
+  case 2:
+    prediction_next_solar_gen_layer_2(prediction_next_solar_gen_buf2, prediction_next_solar_gen_buf1);
+    return 1;
+  case 3:
+    prediction_next_solar_gen_layer_3(prediction_next_solar_gen_buf1, prediction_next_solar_gen_buf2);
+    return 1;
+  case 4:
+    prediction_next_solar_gen_layer_4(prediction_next_solar_gen_buf2, prediction_next_solar_gen_buf1);
+    return 1;
+  case 5:
+    prediction_next_solar_gen_layer_5(prediction_next_solar_gen_buf1, prediction_next_solar_gen_buf2);
+    return 1;
+  case 6:
+    prediction_next_solar_gen_layer_6(prediction_next_solar_gen_buf2, prediction_next_solar_gen_buf1);
+    break;
+  default:
+    return -1;
+  }
+  for(i = 0; i < 1; i++) {
+    out[i] = prediction_next_solar_gen_buf1[i];
+  }
+  return 0;
+}
+
+float
+prediction_next_solar_gen_regress1(const float *features, int32_t n_features)
+{
+  if(n_features != 5) {
+    return NAN;
+  }
+  prediction_next_solar_gen_layer_0(features, prediction_next_solar_gen_buf1);
+  prediction_next_solar_gen_layer_1(prediction_next_solar_gen_buf1, prediction_next_solar_gen_buf2);
+  prediction_next_solar_gen_layer_2(prediction_next_solar_gen_buf2, prediction_next_solar_gen_buf1);
+  prediction_next_solar_gen_layer_3(prediction_next_solar_gen_buf1, prediction_next_solar_gen_buf2);
+  prediction_next_solar_gen_layer_4(prediction_next_solar_gen_buf2, prediction_next_solar_gen_buf1);
+  prediction_next_solar_gen_layer_5(prediction_next_solar_gen_buf1, prediction_next_solar_gen_buf2);
+  prediction_next_solar_gen_layer_6(prediction_next_solar_gen_buf2, prediction_next_solar_gen_buf1);
+  return prediction_next_solar_gen_buf1[0];
+}
@@ -0,0 +1,39 @@
+#include "mlp_q8.h"
+static const int32_t prediction_next_solar_q8_layer_0_biases[48] = { -59, 30, -5, -26, -20, -53, -49, -98, -7, -7, -27, -23, -26, -29, -14, 35, -54, 58, -33, 39, 34, 39, -63, -20, 56, 51, 31, -17, -22, 12, -25, -64, -35, -47, -31, -50, 15, 11, 6, 56, 22, 15, 24, -64, -3, -16, -7, 10 };
+static const int8_t prediction_next_solar_q8_layer_0_weights[240] = { 0, 15, 34, 7, -82, 10, 12, -43, -45, -113, 6, 10, 45, -10, -86, -15, 2, 19, 29, 11, 3, -13, 21, 1, -127, -7, -1, 33, -10, 47, -1, -3, -5, -23, -69, -19, 1, 12, -2, 5, -19, 2, -44, 7, -68, -4, -4, 36, 16, 100, -8, 2, 33, -38, 61, -3, -15, -35, 4, -71, -7, -6, -58, 14, -7, 6, 5, 25, 0, 33, 2, -8, -42, -12, -36, -6, 10, -79, 16, 39, -17, 10, -15, -24, 21, 15, 6, -31, -30, 35, -6, -4, 20, -4, -109, 14, -14, -37, 11, 22, 10, -2, -16, 0, -83, 7, 8, -32, -18, 98, -5, 15, 26, -6, -75, -1, 3, 28, 26, -14, 2, -1, -25, -12, 22, 7, 2, -11, 36, -89, 7, -2, -21, 26, 75, -3, -14, -3, -6, 32, -12, 3, 14, -10, -25, 13, 6, -11, 30, 78, -13, 6, -23, -9, -42, -15, -2, -42, -23, -96, -3, -16, 10, 32, 23, -11, -1, 16, -18, -90, -10, -7, 32, 12, 110, 2, 2, 3, 30, 24, 3, -6, -21, 9, 87, -3, 12, -31, 11, -49, 9, 2, -28, 23, -3, -3, -6, -7, 42, -45, 9, -2, -4, 21, -13, 12, 8, 35, 8, -15, 4, 1, 0, -16, 0, 8, 8, 29, -23, -14, 10, 4, -34, 32, -123, 11, -2, 27, 6, 80, -3, -1, 38, -7, -7, -4, 0, -92, 2, 5 };
+static const int32_t prediction_next_solar_q8_layer_1_biases[80] = { 45, 29, -36, 64, -51, 0, 15, -33, 50, -19, -32, -60, 49, 23, -67, 54, -18, 23, 48, -13, 9, 74, 3, 62, -83, 54, 15, 78, -37, -28, 76, -17, -63, -30, -59, -42, -41, -61, -90, -1, 10, 66, -28, 23, 48, -11, -95, 63, -41, 49, 43, -30, -89, 46, 65, -40, 58, -28, -41, 7, -45, 39, 62, 47, 57, -35, 51, -48, 46, -4, 64, 106, 44, 22, 79, -6, -126, -18, 32, 45 };
+static const int8_t prediction_next_solar_q8_layer_1_weights[3840] = { 16, -39, -5, 12, -1, -27, 36, 23, 23, -54, 24, 31, 21, -24, -18, 7, 52, -19, 24, 45, 11, -30, -30, -32, 2, 25, 23, -22, 15, -19, 10, -7, 23, 22, 10, -25, -28, 8, -27, -30, -1, 11, 19, -41, 26, 3, 29, 35, 20, 5, 22, -34, -45, -17, 0, 8, 51, -48, -18, -50, 23, -40, 28, -3, 30, -11, 21, -3, -10, 60, 23, -29, 45, 12, -18, -22, 51, -64, 23, -18, -16, 35, -2, -64, -77, -19, 18, 9, -33, -42, -1, -18, -14, -81, -33, 9, -32, -28, 33, 33, -20, 31, 19, -13, -45, 16, 3, -26, -43, 16, -31, -17, 5, 10, -17, -16, 5, 29, -17, -31, 3, -25, 12, -19, -27, -16, -33, 28, -22, 7, 11, 14, 29, -17, -1, -58, -18, 11, -20, 17, -13, 20, 6, -2, 3, -1, 0, -50, 24, 29, -17, -77, -48, -21, 8, 33, -29, -11, -1, -15, 57, 41, -29, 26, -7, 17, -43, -12, 23, -7, 41, 3, 25, -27, -6, -19, 1, 5, -18, -28, -20, -10, 24, 6, -25, -31, 32, 11, 7, 5, -32, -91, -21, -41, -11, 21, -42, 11, -37, 115, 34, -24, 47, -34, 30, 20, -19, -26, 35, -27, -2, -16, -26, 35, -8, 36, 1, 9, -38, 4, 31, 26, 7, 38, -42, -24, 14, 28, -4, 14, -12, 5, -14, -26, -4, -33, -25, -19, -10, -1, -30, 22, 21, -15, 0, 3, -1, 11, -41, 6, -35, -6, -17, 28, -25, 6, -18, 9, 3, -30, 16, -6, 0, -9, 4, -16, -22, 20, 16, -5, -15, -8, 20, -29, 2, -19, -15, 31, 24, 25, 31, 26, 23, 6, 11, 15, 16, 9, -24, 11, 1, -25, 42, 3, 27, -37, -15, 14, 3, 36, 36, 31, 43, -29, -44, 0, -26, 13, -16, 21, -74, -43, -33, -25, 9, 28, 26, 0, -55, 2, -38, 18, 1, -49, 18, -60, -29, -2, -12, -33, 22, 41, 46, -9, -25, 19, -34, 17, -14, 3, -10, 22, -1, -5, -31, -22, -31, 26, -2, -20, -4, 19, -35, -38, -18, -22, 36, -9, -19, -12, -7, -36, 10, -18, -24, -5, -4, -2, -44, -22, 26, -5, -23, -1, 19, -10, -23, -17, -13, -34, -7, -7, -31, -27, 32, -6, 26, -50, -20, 25, -4, -40, -14, -7, 25, 14, 8, -13, 48, 31, -20, 0, -22, 32, 25, 1, -38, -35, -9, 23, -7, 15, 13, 9, 39, -34, -19, 21, -18, 1, -37, 11, 23, 2, -24, 6, -15, 25, 33, -6, -12, -30, -12, -6, 21, 0, 18, -18, -38, -27, -3, 8, 15, 17, -32, 2, 16, 28, -32, -38, 7, -40, -25, 9, -36, 20, -15, -6, -32, -38, 12, -14, 0, 20, -8, -19, -35, 8, -30, -43, 19, -28, 1, -13, 7, -5, -26, -26, 0, -33, -47, 24, -24, -5, 46, 4, 13, 74, 42, 10, 28, -31, 21, -4, -3, 36, 15, -24, 14, 10, 15, 0, -10, 7, -37, -38, -7, 11, -5, -30, -36, -21, 39, 3, 49, -9, 23, 32, -84, -21, 17, 1, 18, -2, -47, 4, -1, 4, 3, 15, -55, -13, 1, 3, 0, 85, 20, 3, -19, 7, 51, 22, 20, 51, 38, -9, 3, 44, -12, 42, -11, 6, 25, 26, -17, 1, 34, -7, 12, -1, -32, -23, 8, 15, 44, -20, 19, -29, -14, -29, -13, -45, 20, -38, -36, 17, -6, 13, -11, 20, -4, -1, -23, -9, -19, 2, -21, 8, 21, -14, 9, 26, 5, -10, 28, 22, 18, -22, -13, -5, -7, 3, -4, -5, -12, 12, -45, -26, -59, -38, -16, -7, 24, -37, 4, 12, 0, -18, -7, 14, 23, -27, -56, 33, 22, 19, 19, -9, 14, 26, 6, -59, 8, -30, 2, -9, 12, -33, 31, 17, -5, 9, 0, -13, 20, 1, 7, -2, -2, -1, -8, 7, -2, 23, 1, -33, -27, -36, 24, -31, -29, -9, -12, 24, 14, -15, -41, 21, 0, 15, -42, -48, 31, 1, -13, 25, -30, -17, 6, 110, 57, 8, 20, 5, 3, -65, 28, -1, 9, -12, -6, -53, -46, -6, 17, 33, 10, -21, -8, 28, -1, -39, 36, 57, -8, -20, 25, 45, 29, -6, -2, -16, -15, -19, -38, 7, -20, 12, -15, 21, -33, 22, -23, 22, -3, -9, 22, -39, -3, -30, -6, 27, -37, -2, 8, 22, -21, 19, -28, 25, 12, 0, -17, -30, 39, -17, 29, 25, -16, 20, -10, -30, -16, 6, 3, 10, 0, 42, 30, 22, 23, 35, 8, 12, 34, -35, -39, -6, -22, 12, -36, -33, -28, -10, -40, 16, 15, -4, -35, 21, 38, -30, -31, 25, 23, 7, 3, 12, -7, 46, 10, 9, 21, -27, -2, 23, 6, 17, 14, 6, 12, -37, -38, -45, 14, 48, 4, 17, 5, -60, -11, -52, 1, -20, -23, 60, -23, 29, 6, 15, 18, 33, 17, -33, -1, 3, 8, -3, -10, -8, 37, -2, -18, -15, -3, 4, -4, 15, -26, 6, 33, 30, 18, 28, -5, 26, -26, 6, -22, -36, -29, 16, -16, -6, 7, -15, 34, 2, -27, 18, -27, -5, -2, -37, -35, 29, -48, 10, -19, -45, -22, -26, -13, 2, 14, -13, -7, -26, 18, -11, -7, 36, 11, -15, 15, 7, 18, -43, -24, -24, 29, 9, -21, -16, 23, 32, -21, 24, 7, 17, -3, -15, 4, 2, 31, 11, -7, 4, 25, -16, -69, -32, 26, 10, -5, 33, -23, -16, 21, -20, -25, -17, 15, 15, -14, -16, -4, -3, -37, 15, -8, -21, 14, 5, 2, 24, -5, -11, -18, -12, -45, 0, 10, -4, 2, -11, -25, 28, 13, 30, -15, -11, -20, -44, 1, -2, 33, 0, -22, -27, -3, -22, 29, -13, -49, -52, -36, 55, 1, -23, 5, 8, 24, -36, -14, 16, -5, 11, -25, 32, -34, 13, 6, -13, 55, 37, 39, 23, 1, -30, 42, -30, -19, -70, -24, 0, 52, 42, -18, -14, 9, 9, -6, -73, 1, -49, 6, 90, -38, -24, 15, 1, -35, 17, -21, -49, -22, -10, -41, 15, -33, 20, -6, -11, 17, -20, 10, 31, 32, -38, -30, -7, 55, 1, 7, -33, -28, -28, 38, 46, 16, -34, -22, 38, 35, 3, -23, 25, 32, -3, 8, 9, 9, 32, -6, 57, -4, -39, 1, -69, 17, 1, 19, -22, -66, 12, -4, 19, 4, 15, 17, 22, 20, 6, -10, 7, 18, 26, 20, -42, 1, -9, -31, -41, 33, -6, -25, 7, 43, -21, -27, 0, -19, 13, 5, -22, 6, 28, 11, 17, 24, 13, 24, -9, 5, 0, -19, 10, -23, -46, 30, -17, -17, -17, 28, -40, -10, -31, 13, 40, 18, 14, -36, 38, -17, 9, -15, -23, 25, -23, -38, 10, -7, 0, 6, -52, -28, 32, 0, -9, 33, 44, -9, 5, 18, 14, -31, -13, 0, -35, -56, -22, 43, 2, 10, -44, -7, 38, -31, 29, -17, 24, 20, 37, 47, 12, 2, -11, 41, 13, -5, -28, 32, 27, 25, 25, -9, 2, 2, 22, 10, 4, 3, 34, 8, 36, 7, -36, 11, 3, 4, -3, -19, 17, 11, -29, 30, -18, -8, 5, -25, 37, -9, 12, 32, 18, -28, -75, -16, -39, -6, 5, -48, 6, 10, 37, -18, 25, 3, 20, 35, 46, -16, 8, 21, 4, -20, -22, -24, 38, 62, 18, -8, 12, -64, -21, -8, 2, 22, 9, 3, -18, -21, -20, 2, -36, -53, -84, -36, -31, -18, -42, -56, 10, -4, -42, -89, -4, 11, -10, -61, -16, 44, 27, 28, 22, 6, -30, -13, 27, -33, -67, 27, -1, 22, -15, -17, 9, 37, -106, 28, -1, 33, -43, 25, 53, -22, -15, -45, 1, 29, -29, -33, 14, -6, -5, -7, -16, -26, -42, 28, -33, -13, -76, -2, -11, 40, -19, 2, 21, 50, -3, -39, -2, -21, 28, 13, -19, -24, 29, 17, 16, 16, -2, -20, 21, -38, -14, -7, -7, -39, 33, 17, -9, -25, -16, -9, -11, 40, 3, 9, -29, 21, 4, -1, -32, 8, 34, 43, 36, -16, 39, 23, 31, 39, -39, -12, -13, -42, -28, 24, -34, 2, -6, 34, 7, 16, -21, -29, 13, 3, 2, 43, 3, 13, -6, 38, -22, 34, -13, 16, 28, -15, 4, -32, -7, 33, -21, -11, 25, 39, 32, 21, 28, 19, -10, -11, -34, -35, 13, -28, -19, -24, -10, 22, -16, -20, -13, -25, -38, -2, 12, -9, -19, 18, -44, -37, -26, 2, -12, 25, -23, -14, 40, -37, -12, 0, -2, -13, -22, -2, -30, -36, -39, -26, 16, -4, 20, 1, -23, 1, 29, -37, -5, -15, 26, -27, -46, -4, 32, -10, 24, -12, 1, 48, -14, 31, 15, -34, 12, -6, -31, -37, -30, -2, 27, 20, -14, -15, 27, 41, -14, -21, 15, -27, -38, 13, 13, -20, 14, -25, 30, 20, 1, -2, 15, -39, -50, -6, 23, 27, -28, 36, 11, -1, -41, 4, 15, -24, 22, 1, -32, 9, -19, -8, 17, 0, -7, 5, 26, -4, 22, 5, 6, 5, -15, -16, -2, -20, -25, 42, -1, 37, 33, 30, -7, -17, -20, -10, 23, -6, 31, -4, 32, -36, -20, 3, -12, 31, 35, 31, 5, -13, -2, -25, 38, 11, -30, -6, -18, 26, -69, -14, 9, 41, -30, 18, 16, 45, -15, 7, -31, -28, 13, -9, -23, -41, -22, 64, -25, 38, -26, 8, 9, 23, 4, -12, -4, -22, 10, 10, 13, 30, -73, -40, 40, -39, -31, -10, -57, 1, -12, 40, -27, -14, 38, 63, -43, 51, 72, 3, -1, -16, 22, -7, 10, 27, -40, -5, 15, 7, -25, 0, 11, 9, -10, -15, 1, -11, 18, 57, 25, 17, -37, -17, -73, -31, 9, 41, -37, 1, 41, 35, 17, -28, 16, 18, -3, 20, -15, 40, -41, 22, -74, -7, 16, -37, -17, 22, -6, 2, -17, -11, -10, 0, -14, -3, 3, -10, -7, -43, -38, 20, -6, 32, 9, 26, -5, -34, -14, -30, 18, 20, -3, 32, 11, 24, -1, 8, -8, -43, -22, -18, -32, -18, 24, -14, 41, 43, -34, 25, 18, 55, -36, 6, 65, 68, -9, 14, 17, -28, -2, -27, -10, 12, -21, -6, -23, 37, 21, -8, -20, 16, -19, -13, 7, -1, -24, 45, 28, -1, -49, 11, 33, -7, -4, -20, 94, -21, 16, 3, -3, 28, -40, 16, 19, 43, 23, -49, -26, 1, -15, 41, -7, -31, -2, 18, -9, 4, -47, 4, -56, 22, -59, -14, -9, -40, -69, -35, 0, 7, 19, -11, -12, -51, -15, -55, -59, 26, 21, 2, -28, -11, 10, -20, 12, 18, -12, 26, 5, 8, 7, -30, 34, -8, -4, -14, 12, -1, 27, -14, 8, 12, 9, 16, -18, -14, -22, -12, -5, -7, -6, -10, 19, -42, 4, -25, 1, -15, -29, -14, 17, 0, 28, 9, 17, -15, 50, 23, 35, -11, 21, -32, 22, -21, 0, -11, 33, 7, 43, 3, 80, 46, 33, 16, 45, 47, -21, 27, 6, 53, -16, -15, -4, 6, -12, 30, -22, -48, -2, 1, -35, -6, 26, 33, 12, -40, -3, 33, 21, 14, -27, 16, -26, -29, -7, -38, -3, 26, -11, 18, 49, 18, 4, -27, -25, -26, -20, -18, -29, 14, -11, 30, 16, -2, 7, 26, 41, -18, 43, -28, -4, -31, -8, 6, -61, 3, -59, -32, -8, -27, 25, 10, -10, -8, 10, -19, -40, -32, 48, -6, -38, -52, -20, 19, 35, -5, 30, 6, -14, 7, -9, -26, 48, 3, -8, 11, -27, 35, -17, 7, -24, -47, -39, 31, 31, -6, 36, -8, 10, -28, 1, 23, -26, 15, -20, -3, 20, 13, -21, 26, -34, -41, -4, -39, 26, -28, 39, 4, 24, -36, -1, 10, 0, 17, 17, -65, -65, -26, 36, -13, -18, -4, -21, -2, 5, -26, -33, 25, -17, -53, 31, 27, -10, -10, 6, -1, -9, 22, -7, 3, -21, -15, 23, -6, -12, 16, -5, 43, -5, -58, 0, -51, 5, 38, 15, -9, 5, 7, -10, 29, -9, 3, 14, -61, -47, -4, -18, -17, -24, -14, 32, 24, 16, 28, -25, -18, 25, 2, -33, -17, -29, 24, 28, 37, -6, -33, -19, 26, 31, 28, 19, 28, 23, -19, 9, 15, 2, 1, 33, 24, -29, 11, -26, -12, 2, 2, 32, 20, 34, 8, 14, -23, -10, 10, 5, 8, -49, -25, 17, 27, 13, 22, -53, -16, -13, -3, 17, -7, -6, -13, 34, -22, -8, 20, 26, 29, -16, 6, 9, -16, 4, -13, 23, -14, -5, 23, -44, -56, -22, -11, -33, 31, -28, -37, 15, -17, 15, 6, 22, -9, -45, -35, -6, -6, -17, -28, -23, -8, 21, -4, -10, -43, 16, -25, 10, -3, 30, 43, -23, 29, -6, 33, 25, -29, -15, 2, 8, 5, -1, -20, -1, 48, -5, -52, 27, -6, 13, 29, -8, -13, -37, 23, 23, 15, 24, 23, -20, -40, -2, -23, 28, -1, 0, -34, 13, -8, -2, -20, -17, -6, 7, -41, 14, -13, -13, 34, 1, -7, -10, 28, -4, -5, -4, 4, -4, -10, -2, -37, 28, -7, 7, -6, 14, 10, 14, -36, 2, 21, 32, 33, 22, -29, 19, 4, -15, -14, 16, 30, -14, 7, 5, -3, 17, -34, -14, -13, -13, 43, -36, -41, 25, -66, -40, -11, 22, 43, -40, -35, 2, 18, -46, -6, 6, -19, -17, -38, -28, -4, -3, 13, 7, -4, -25, 28, -14, -15, 14, 5, -16, 28, 28, -17, -2, 38, -2, -16, 23, 0, -7, -10, -17, -23, -8, -43, -35, -42, 10, -11, 14, 22, 9, 8, 45, -73, -12, -15, 12, 18, -3, 2, -19, -5, 0, -34, 32, -2, -33, -29, -44, 19, 18, 6, 33, -3, 0, 28, 40, 9, -17, -22, 11, 3, -25, 20, -19, -3, 40, 6, 25, -13, 61, 24, 3, 23, 51, -29, 31, 9, -47, -4, -15, 32, -54, -40, 38, 1, -10, -26, 34, -33, -40, 24, 4, -46, -5, -33, 11, 8, 19, -39, -36, -34, -5, 2, -15, -35, 27, -1, -36, -29, -61, -27, -8, 0, 38, 35, 11, -24, 7, 0, -39, -58, 52, -41, -11, 15, 7, 3, -12, 10, 29, -20, 3, -11, 17, 0, 7, -34, -15, 0, 5, 16, 2, -18, 32, -23, -2, 11, -46, -22, -27, 1, -13, -39, -14, -12, 17, 15, -31, -2, 28, -18, -37, -35, -16, 13, -39, 42, -9, 18, -6, -22, 7, 3, 20, 15, 24, -31, -13, -6, 25, 30, -6, -5, -4, 1, 31, 22, 14, 35, 18, -35, -7, -14, -34, 33, -3, -19, -3, 37, 13, -24, -15, 28, 36, -29, -23, -6, 7, -24, 20, -12, -23, -4, 46, 11, 13, -23, -8, -26, -31, -1, 4, 59, -28, 36, -24, -2, 10, -21, -3, 8, -8, 20, -60, 3, -14, 62, 17, -24, -6, 15, -5, -2, 33, -32, -73, 8, -12, 10, -11, -14, 23, -22, 39, 20, 7, 6, -20, -1, 9, -6, 11, 15, 31, 30, 5, 22, 6, -2, 36, 3, 22, 19, 7, -36, 0, -38, -13, -38, -9, -9, -1, -36, 25, 1, -36, -39, 7, -26, -24, -40, 8, -37, 15, 10, 22, -26, -29, 29, -1, -24, 39, -36, -25, 30, 8, 30, 16, 36, -57, -8, 29, 27, 1, -51, -21, 27, 14, -54, 15, -44, 41, -4, -16, -50, 27, -29, -2, 6, -39, 20, 25, -46, -18, -15, 14, -30, 22, 38, -24, 21, 13, 27, 23, 23, -32, -33, 29, -28, -25, 20, 35, -23, -31, 9, -26, -16, -72, -39, -16, 9, 31, -42, -7, 5, 21, 8, 30, 23, 29, 13, 12, -10, 8, 1, 41, -11, 39, -21, -17, 46, -21, -44, -29, -44, 33, -14, -18, 1, 0, -11, 24, -18, -10, 1, 25, -8, -49, 50, -18, 42, 29, -9, 16, 19, 72, 9, 2, -7, 36, -7, -13, -33, -38, 31, -8, -12, 17, 10, 8, 0, 37, 12, -18, 6, -27, -4, 27, 20, 7, 15, 47, 19, -32, 11, 0, -48, 17, -37, -36, -37, -35, -28, -13, 22, 7, 11, 13, -32, -21, 14, 28, 2, -52, 8, 25, -12, -6, -62, -29, -27, -41, -7, 9, 30, 41, 31, -6, -49, 17, 7, -3, 21, 29, 5, 29, -2, -13, -11, 9, -13, 6, 7, 31, -15, -46, -11, 31, -7, 3, -23, -3, -39, 0, -36, -30, 0, 10, 4, 34, -22, 45, 15, -27, 26, -10, 34, -3, 32, -77, -1, 12, 39, 24, 10, 29, 30, -38, 44, -14, -8, 43, -43, -37, 6, 11, 3, 36, 7, -8, 30, -20, -27, 7, 20, 4, 13, 7, 27, 32, -29, 21, -10, -4, -3, -10, -17, 15, 35, 32, 15, 33, -14, 47, 36, 32, 0, 19, 47, -23, -9, -35, -16, 25, 13, 23, 23, -29, 21, -32, 1, -30, 35, 24, 26, -19, 18, -31, -20, -25, -24, 37, -36, -42, -1, -52, 34, -20, 33, 2, -17, -9, -30, 4, -8, -14, 43, 116, 18, -38, 30, 29, 53, -61, 12, 14, 28, -50, -1, -8, -32, 7, 36, -26, -24, -10, 26, -9, 33, 40, -7, 24, -25, 16, -30, -9, 32, -7, -7, -7, 11, -50, 32, -11, 30, -29, -2, 62, -11, -32, 14, 30, 30, -4, -23, 111, 10, -12, 32, 32, -16, 26, -23, -10, 21, -32, 2, -6, 6, 26, 55, 48, -34, -20, -20, 26, 19, -4, 8, 45, 26, -30, 6, -23, 17, -23, 2, -15, 35, 22, 3, 21, -11, 9, 58, -15, -11, -24, -8, 11, 2, -13, 31, 83, 43, -5, 12, 13, 26, -23, -15, -8, 53, 17, -1, 4, 1, -3, 8, -5, 34, 23, -14, -11, -10, -13, 2, 49, 52, 4, 18, -7, -8, 12, 2, 29, -9, -40, 4, -61, -29, -20, 28, 32, 10, 15, -8, -9, 16, -41, -17, -38, -42, -5, 15, 27, -39, 4, -12, -13, 0, 26, 24, 20, -19, 1, -8, 6, 8, 38, 26, 9, -18, -15, -25, -16, 6, -26, -28, -31, -23, 21, -2, -2, 41, -20, 16, 32, 35, 28, -10, -56, -15, 30, 26, -82, 8, -7, 7, -31, -43, -18, -44, 38, 40, 33, 37, -57, 16, -26, 0, 45, 26, -29, -20, -42, 4, 19, -18, -19, -7, -2, -55, -13, -15, 11, -74, 0, 32, -37, 28, -15, 21, -10, 10, -24, 17, -10, -5, 30, -32, 22, -58, 3, -30, 15, 50, -33, -30, -24, -8, 10, -40, 33, 27, 11, -17, -3, -51, -12, 2, -18, -32, -32, 20, -20, 9, 20, -16, -4, 28, 33, -8, -12, 30, -27, 40, -27, 21, 40, 38, -32, 9, -37, 27, 26, -52, -4, -46, 1, 5, 32, 11, 9, 12, 13, 12, -21, -42, -23, -21, -33, 7, 23, 14, 23, 38, 17, 26, -18, 17, -61, 16, -52, -35, 35, 3, -63, -22, 4, -20, 31, -49, 21, -19, -29, -1, -46, -34, -5, 14, -3, -9, 6, -13, 19, -48, -17, 0, -56, 28, -12, 5, -127, -61, -77, 20, 51, -8, -58, -15, -25, 34, -15, 37, -23, 33, -26, -90, -61, -32, -5, 13, -14, -22, -43, -52, 22, 8, 11, -108, -32, -44, -37, -21, 5, -12, -17, -7, -27, -9, -46, 17, 43, 34, -34, -18, 2, 30, 18, 14, 34, 16, 49, 11, 3, -4, -25, 27, 0, 23, -9, 16, -5, -31, -28, 50, 9, -18, 3, -15, 40, 2, -8, -1, 25, 37, 30, 7, 31, -25, -21, 26, 6, 12, 31, -22, 28, -23, 15, 15, 13, -42, 39, 4, 15, 18, 17, -19, -21, -22, -12, -24, 24, 18, -9, 37, -18, 17, 12, -29, -8, -5, 21, 19, 24, 32, 32, -11, -8, -35, 12, 19, 22, 7, -22, -8, -16, 29, 25, -10, 21, 14, 6, -7, -31, 24, 1, -53, -60, -36, 5, -25, -47, 25, -33, -13, -32, -39, 14, 6, 40, -7, -36, 6, -56, 37, 9, -39, 12, 17, -12, 21, -20, -7, -3, -5, -28, -38, -16, 18, -26, -4, -16, -16, 9, -11, 16, 25, 31, -2, -37, -29, -43, -5, 12, -18, -28, -37, 18, -34, -16, 7, -21, 5, -69, -15, -21, 10, -28, 21, 35, 22, 4, -31, 33, 15, 31, 23, 15, -19, 29, 12, 17, 38, -7, 30, -15, -24, -3, -5, -12, -30, 2, 29, 6, -22, 27, 33, -4, -33, 30, 42, 7, -49, -25, -37, 36, 3, -33, -13, 15, -1, -42, -29, 18, -9, 28, -37, -20, 10, 0, -22, -24, -1, -4, 38, -11, -4, -5, 10, 31, 50, 13, -15, 27, 24, 3, 9, -6, 17, -25, -21, 29, 26, -33, -33, -5, 32, 4, -3, -29, -17, -42, -35, 1, -6, -5, 17, -26, 4, -25, -16, -30, -16, 30, -51, 13, -16, 15, 9, -4, -24, 19, 3, 27, 14, -16, 3, 12, -4, 15, -15, 41, 18, -22, -46, 24, 4, 26, 0, 4, 6, -14, -22, -7, -42, 21, -15, -27, -7, -7, -50, 7, -44, -40, 22, -24, -30, -10, 0, -40, -6, 45, 30, -19, 16, -87, -42, 32, -32, 13, 21, 17, -42, -59, 34, -11, -12, -11, 18, -21, 35, -13, 11, -51, -63, -21, 33, -39, -32, 32, 2, -31, -42, -25, 15, -14, -41, 2, -17, 47, -8, 2, 3, -38, 27, -45, 9, -2, -26, -16, -46, -25, 6, -23, -34, 41, -18, 42, -23, 24, -32, -28, 21, 38, 23, 18, -15, 32, 27, -22, 15, -3, -21, 25, 2, 14, 25, 33, -4, -34, 21, 19, -14, -7, -18, -42, 20, -44, -53, 41, 34, 26, -17, 69, -5, -37, -20, -9, -10, -10, -19, -32, 8, -48, -20, 1, -38, -27, 13, 17, -35, -41, 6, 26, -12, -62, -6, 17, 13, 42, 27, -5, 7, -29, -42, 21, -73, -68, -42, -59, -25, -32, 50, 16, 48, 6, 6, 9, 6, -9, 25, -7, -2, 7, 24, -51, 16, 6, -4, -80, -46, 22, 25, -34, -20, 6, 54, 16, -20, -31, -16, 29, 4, 16, -31, -9, 32, -26, -34, 28, 4, -44, -12, -2, 0, 6, 4, 41, -34, 20, 19, -4, -5, -15, 23, -17, 1, -72, -26, -5, 13, 3, -10, 22, -30, -26, -10, 14, -7, 5, -7, 10, 21, -20, 21, -17, -61, -28, -19, -32, -32, 32, -4, -5, 15, -21, -15, 31, -31, 8, 0, -16, 19, 28, 12, 30, 25, 32, -3, 8, 9, -10, -34, -56, 29, -13, 35, -6, -22, -4, -7, 26, -24, -21, -7, -2, 17, 31, 0, -19, 39, 11, -17, -12, 32, -20, 23, 17, -23, 35, -10, 9, -47, 13, 8, 10, 33, -14, -4, -4, -10, -17, 19, -28, 29, 25, -44, 19, 19, 15, -19, -5, -18, -28, 26, -32, -19, 28, -7, 23, -28, -20, -9, -10, 23, -34, 21, 17, 9, -7, -6, -33, -37, 16, 9, 26, 29, 24, 5, -39, 15, 30, -20, -34, -20, -38, 8, -35, -17, -2, 0, -3, 22, 31, -46, -5 };
+static const int32_t prediction_next_solar_q8_layer_2_biases[80] = { -15, -54, 40, 31, -131, 84, -121, -78, -38, 130, 108, 58, 48, 44, 69, 30, 105, -96, 97, 83, 100, 25, 67, 54, 67, -53, -80, 66, 92, 98, -45, 53, -145, -86, 103, 79, 109, -101, 98, -40, -32, 37, 83, 16, 119, 40, 95, 88, -133, 114, -88, -4, -74, -41, 97, -49, 43, 66, 71, -8, 78, 94, 59, 67, 102, 11, -61, -8, 61, -89, 81, 25, 18, 81, 71, 73, 112, 87, 82, 73 };
+static const int8_t prediction_next_solar_q8_layer_2_weights[6400] = { 40, -50, -29, 6, 45, -18, -53, 16, 28, 6, -11, 42, 67, 29, 71, -19, 90, -20, -10, 46, 105, 39, -12, 4, 58, 39, -20, -17, 9, -11, -47, 33, -21, 75, -6, 90, -54, 41, 50, 5, -18, 4, 33, 31, 24, 4, 52, -44, 79, -9, 27, 62, 18, -32, -31, 45, -46, -32, -33, 27, 48, 65, -19, 22, 54, 0, -22, -10, -21, -6, 5, -18, -4, -6, -2, 16, 49, 25, 6, -1, -25, -40, 31, 24, 6, 17, 5, 17, 19, -2, 47, -42, -14, 12, 29, -30, -7, 44, -26, 10, -23, -20, 38, -53, 6, -3, -75, 19, 51, -6, 0, -2, 54, -63, -12, -48, -7, 44, -17, 58, -30, 18, -7, 35, -27, 37, 5, -16, 28, -14, -33, 0, 24, 20, 12, -7, -4, 15, 51, -15, -12, 12, 34, -23, -58, 38, -78, 17, 6, -2, 8, -4, 39, -28, -39, 58, -14, -13, -15, 23, 33, -20, 48, -56, 21, 8, -40, -37, -16, -5, -47, 59, -54, 33, 81, 24, 47, -18, -17, -21, 57, -74, -31, 19, 33, -28, 36, -9, 7, -5, -12, -5, -48, 72, -58, 18, -21, -28, 89, -17, -16, -39, -20, -77, 41, -22, -42, 12, 49, 62, -27, 6, 7, -45, -1, 72, 28, 16, 16, 36, 74, 39, 8, -17, 18, -16, -21, -11, 31, -34, -39, 19, 11, -53, -17, 96, -59, -3, 11, 34, -46, -29, -23, -26, 28, 1, 5, 40, -24, 5, -25, -43, -11, 32, -66, 3, -42, -8, -52, -25, -12, 15, 22, -37, -12, -35, 12, 44, 31, -23, -11, -9, -2, -38, 38, -27, -44, -21, 5, -45, -15, 32, 25, 13, -2, 28, -1, -38, 14, -49, 6, 26, 28, -34, -33, -1, -6, 6, 27, -51, -53, -36, 36, -50, 2, 8, 48, 34, 13, 24, -20, 13, -20, -33, 40, -51, 0, 5, 6, -42, 5, 0, 19, 30, 7, 46, 40, 37, 16, 32, 17, -18, -21, -1, 74, 30, -22, 10, -21, 11, 41, -33, -6, 3, 33, -21, -35, -34, -9, 26, 7, 45, 47, 48, 33, 56, 48, 33, 32, 32, 0, -33, 18, -20, -36, 15, 16, -3, 46, 21, 31, -46, -30, -37, -33, -13, -13, -8, 8, 25, 23, 56, 5, 12, 18, 52, -98, 40, 9, -28, 12, -35, -18, -10, -30, 105, 56, 5, -39, -27, -31, 32, -9, 15, 4, 8, 35, 4, -12, 4, -9, 0, 32, -24, -31, 2, -30, 3, 12, -26, -11, -20, 30, 29, -20, -12, 74, -25, -17, 13, -13, 24, 26, -5, -57, -64, -15, 2, 17, -19, -29, -12, 5, 31, 25, 26, -38, 27, -37, 37, 13, -36, 8, 35, 43, -14, 14, 33, -19, -33, 3, -40, -15, 42, -1, -16, 43, -29, -21, 15, 32, 17, -3, 39, -5, -61, 7, -15, 32, 8, 19, -36, 33, 47, 4, -23, -12, -40, 3, -16, 65, 14, -12, 12, 21, -28, 11, 12, -26, 2, 0, 39, -21, -36, 36, 16, 5, 10, 26, -5, 22, 39, 15, -9, -31, 64, -10, 44, -5, 53, -7, 20, 51, 12, 3, -3, -9, -41, 14, 2, -6, 22, 32, 6, 28, 11, -36, 40, 11, 31, 16, -3, 6, 4, -58, -11, -14, 36, -22, -19, -34, -25, -21, 30, 8, 33, 57, -21, 18, -20, 44, 21, 1, 7, 18, -11, -15, 42, 27, -10, -10, 21, -11, -20, 49, -27, 4, 31, 19, -11, 13, 12, -8, -36, 40, -9, -63, 18, 10, -16, 22, 49, -19, -27, 26, -14, -15, 48, 14, 22, -20, 37, -6, 37, 15, 12, -21, -32, 34, 36, -19, 34, 18, 8, -37, -35, 38, 32, 28, 40, 45, -6, -14, 20, 10, 48, -38, 2, 22, -16, -11, 18, 21, 31, -32, 37, 47, 28, -19, -18, 25, 23, 30, -26, -17, -46, -54, -13, -27, -21, -3, -44, -40, -30, -35, 2, 26, 33, -15, 5, 24, -43, 25, 20, -42, 25, 23, -28, 1, 39, 26, 13, -43, -37, 1, 41, 32, -28, -33, -19, -18, -26, -35, -16, -40, 30, 3, 2, 31, 32, -19, 17, 33, 1, -40, 5, -35, -25, 9, -27, 7, -12, 11, -28, -15, 20, 34, -13, -9, -30, 3, -47, -13, -5, 14, 30, 3, 14, -38, -26, 32, -8, 25, 24, 6, 12, -31, -28, 49, 13, 33, -21, -5, 23, -70, -4, 1, -6, 7, -25, -59, -10, 24, 28, 23, 28, 84, -26, 31, -30, 8, 33, -17, -19, -54, 29, -21, 23, 25, -14, -10, 5, -28, -3, -26, 39, -13, -7, -16, 12, -13, -5, 40, -15, 30, 7, -22, -36, -20, -41, -35, -5, -8, 27, 24, -33, 60, -24, 32, 48, 19, 3, 35, 34, -24, -63, 3, 37, -14, -5, 34, 50, -22, 40, 24, 26, -19, 21, -16, 21, -42, -39, -5, -36, -32, 43, -25, -30, 21, -30, -50, -27, -9, 15, -7, 28, 13, -24, -16, 44, 12, -17, -33, -94, 35, -14, 19, -31, -48, 30, 52, -8, -20, 44, -24, 33, -26, 0, -102, 23, 24, -27, -22, -30, 46, 5, 32, 29, -12, -22, 13, -46, 25, 42, 39, -35, 71, -14, -6, 44, 50, -8, 33, 78, -2, -31, 7, -8, 40, -9, -13, 37, 17, 46, 26, 2, 6, 40, -36, 32, -8, -12, 15, 21, -90, 2, 15, 14, -27, 8, -19, 33, -17, -2, -23, 44, 42, -19, 34, 24, -13, 35, -8, -45, -39, -20, -51, -26, -33, -8, 18, 3, 10, 27, 4, 15, 28, -15, -54, 36, 33, -17, 27, 16, 14, -7, 3, -35, 19, -65, 34, -31, -34, 47, 48, -15, 53, 33, 30, 31, -26, 13, 10, 103, -28, -103, -48, 16, -26, 6, 22, -1, 36, -39, -47, -29, -63, 13, 3, -22, -36, 43, 26, 24, -47, 0, 20, -45, 30, -95, 0, 70, -49, 12, -25, 24, -14, 46, -51, 36, 40, 29, -71, 31, -15, 52, -110, -88, 15, -124, -86, -28, -6, -3, 45, -44, 49, -42, -2, 30, 22, -31, -70, -42, 4, 25, -26, 25, 38, 46, -77, 52, -21, 25, -32, -118, 8, -2, -19, -8, 19, 15, 2, 24, -20, -80, -19, -71, 20, 2, 0, 53, -30, -1, -7, -53, -44, -13, -44, 18, 10, 17, -49, -43, 64, 23, 9, -49, 9, 26, -42, -24, -14, -4, -19, -46, -34, 7, -13, 59, 15, -53, 30, -59, 5, -37, 30, 11, 18, -6, 49, 4, -3, -49, -33, -29, -15, 49, -6, 26, -19, 50, -12, 21, -20, 7, -25, -58, -30, 68, 40, -9, 17, 9, -32, 16, 9, 8, 5, -8, -11, -24, -5, -30, 8, -28, -10, -18, -24, -6, -1, 83, -48, 39, -48, -50, 1, 26, 27, 16, 40, -20, -27, 20, -6, 20, -79, 26, 16, -3, -9, -6, -25, 18, 20, 33, -21, 30, -21, -57, 10, -39, -24, -94, 12, -78, -39, -67, -33, 50, 43, 17, -22, 16, -3, -51, 2, 27, -94, -14, -9, -27, -33, -45, -11, 0, -47, -15, 59, -38, -76, -30, -21, -25, -1, 50, 3, -8, 1, -5, -5, 5, -2, 32, 43, -31, -30, -63, 39, -44, -26, 15, 54, 14, 98, -3, -40, 40, 1, 24, 2, -19, -89, -32, -15, -39, 11, -40, 21, 16, -120, 12, -41, -28, 51, 0, 48, -49, 7, 47, 51, -14, -28, -61, -8, -29, -3, -19, 73, 42, -2, -17, -34, -15, 35, -9, 2, 33, 30, 9, 34, -42, -17, 17, -21, 0, 9, 1, 54, -39, 10, 19, -4, -40, -56, -10, -52, -1, -2, -35, -47, 1, -13, 14, 31, -84, -64, -39, 6, -20, 25, 27, 39, -21, 6, 3, -7, 36, 6, -24, -34, 12, 19, -33, -64, 34, -16, 40, -30, -38, -10, 10, 24, -2, 37, 8, 0, -13, 16, -9, 44, 33, 4, -24, -4, -6, -27, 23, -40, 36, -11, -3, 35, 33, -4, 33, -20, 12, 1, -25, 26, -47, 7, -10, 46, -27, 26, 31, 19, -11, -4, -16, -15, 9, -7, -28, 37, -48, 13, -15, 0, 15, 37, 65, -15, -67, -34, 20, 5, 9, -6, 16, -26, 12, -19, -1, -12, 22, 7, 2, -10, 42, -13, 5, -24, -18, 5, 1, 23, -41, 16, -66, -33, 14, 22, 9, 45, -8, -74, -20, -2, -41, -17, 74, 36, -3, 30, -29, -12, -4, -47, 14, -1, -41, 44, -1, -16, 1, -71, -42, 41, 71, 9, 3, -10, -34, 16, -49, 35, -39, -59, -30, -27, -33, 52, 33, 32, -51, 25, 4, 20, -10, -10, -3, 11, -46, -6, -33, -23, -11, 38, 41, -20, -14, 69, 13, 33, -37, 27, -44, 25, 39, -33, -22, -45, -19, -32, 38, -8, 1, -68, 31, -43, 4, 24, -2, 29, -15, -6, 10, 11, 24, 29, -2, -27, 7, -3, -17, -24, -17, 31, -8, -29, -24, 24, -19, 12, -17, 28, -2, 23, 56, 35, 42, 23, -21, 25, 26, -19, -69, -41, -57, -5, 14, 14, 2, 13, -23, -19, -22, -10, 6, 18, 74, 11, -32, -12, 45, 14, -29, -44, -4, 37, -19, -25, -4, 43, -29, 43, 29, -16, -42, -17, 18, -68, 41, -45, 42, -3, 23, -77, 41, 17, 35, -5, -23, 10, -27, 27, -10, 5, -6, -44, -56, 13, -78, 16, -1, -50, -33, 55, 35, 39, -7, -18, 36, -24, 45, -11, 17, -24, -2, -39, 15, 35, -14, 20, -20, 19, -53, -23, -19, 20, 54, 22, 24, 37, -10, 39, 19, 34, 0, 20, 70, 37, -25, -27, 40, -8, 39, 10, 36, -29, 22, -2, -27, -2, 38, -15, -25, -32, -34, 41, 17, -33, 0, -39, 20, 37, -1, -6, 25, -9, 31, -8, 42, 3, -12, 21, -21, 24, 42, 19, -16, -37, -44, -58, 34, -44, 4, 21, 44, 10, -16, 44, 28, -32, -26, -49, -27, 42, 34, -18, -4, -10, 31, 24, -9, -24, -64, -17, 4, 47, 46, 36, -31, 43, 26, 19, 6, -7, 23, -14, 64, -25, -16, -28, -30, 15, 21, 13, 21, -45, 24, 18, 22, -7, -35, -20, -39, -27, -10, 40, 29, -56, -16, -44, 20, -14, 6, -57, -43, -46, 50, -9, 3, -12, 9, -60, 32, -19, -7, -47, -48, -20, 38, 26, -36, -22, 35, -21, 30, -22, -31, 4, 7, -50, 48, -35, 35, 31, 5, -11, -41, 18, -46, -28, 8, -41, 0, -73, -62, 12, 34, 25, 9, -3, -11, 4, 28, -44, 1, -4, 68, -15, 13, -58, -27, -29, 3, 39, 1, -17, 6, 14, -48, 39, -25, -32, -6, -9, -8, 37, -14, -40, 16, -53, -7, 51, -15, -57, -1, 6, -10, 11, 35, 49, 25, -29, -1, 0, 11, 45, -68, -29, -69, -57, -93, -57, 50, 59, 2, 11, -54, -4, -12, -18, -19, -56, 38, 23, -26, -25, 20, -14, 7, 25, 40, -47, -56, -57, -24, 18, -5, 17, 18, 40, -8, -11, 41, -7, 55, -11, 43, -3, -61, -27, -62, -29, 38, 13, 14, 24, 34, -57, 32, -7, 13, 1, -37, 18, 21, -21, 19, -26, 25, -27, 25, 15, 45, -9, -2, -6, 4, 3, -17, 22, 28, -49, -6, -4, 34, 27, -70, 0, -83, 4, -5, -51, -9, 38, -7, -10, -16, 3, -33, -43, -25, -19, -2, 29, -47, -29, -6, 11, -37, -24, 4, -7, -49, -50, -8, -19, -23, -17, -15, 83, 9, -2, -16, 4, 20, -27, 38, 13, -57, -21, 4, -40, -8, 46, 29, 18, -17, 21, -25, 17, -27, 17, 2, -1, -30, -38, -14, -22, 32, 8, 8, -15, -21, -9, -18, -45, 18, -4, 18, 28, 20, 28, -15, 33, 8, 34, -8, 13, 28, -23, -41, 34, 27, 24, -22, -16, 13, -16, -9, -8, 27, -34, 6, 26, -16, 28, -10, -22, 17, -16, -34, 1, -56, -51, -21, -10, -3, 52, -29, 66, -37, 8, 41, 21, 44, 23, 29, 28, 10, -4, -8, -9, 2, -36, 9, 35, 2, 31, -27, 32, 37, -10, -16, 0, 6, 24, -30, -15, -27, -15, 3, 2, -14, -5, -47, -36, 27, -28, 18, -27, -3, -7, 6, -46, -49, -23, -42, -16, -1, -12, 1, 25, -29, -35, 29, -36, -18, -40, 22, -41, -2, 29, -22, 38, -30, -25, 15, -22, -11, -7, 5, -30, -8, -24, -16, 30, -25, -4, 6, -8, 2, 17, 22, -26, 35, 8, -18, -45, 34, -22, -27, -38, -43, 16, -8, 34, -22, 42, -34, -28, -27, -25, 10, 18, 48, 42, -6, 75, -33, 94, 4, -4, -38, 59, 32, 21, 20, 10, -15, -17, -31, 54, 2, 35, 30, -17, 127, 42, 94, 14, 0, 36, 40, -26, -8, -29, 30, -5, 15, 6, -27, 62, -6, 32, 15, -18, -9, -11, -18, 10, 46, -23, 50, 18, 17, 17, 38, -4, -35, -66, 29, -17, 5, 10, 47, -25, -51, 15, 57, 54, -6, -13, 46, -5, 20, -32, 15, -35, -8, -28, 37, -8, -25, -1, -76, 33, 33, -90, 48, -80, -33, 32, 27, -42, -61, 12, 38, 43, 34, -2, -76, 24, -2, 38, -35, -71, -90, 50, -78, -19, -61, -90, 10, 44, 21, -14, -27, 29, 16, -2, 39, -90, -57, 9, -45, 30, -43, -15, 16, -57, -89, -19, -35, -83, 40, -31, -16, 23, -68, -35, -18, 40, 2, -1, -15, 24, -73, -4, -14, -46, -16, -1, -56, 25, 1, 28, -22, -2, 3, 36, -4, 23, -34, -9, 35, 22, 18, 33, 37, -37, 10, -3, 25, -9, -11, 18, -7, 6, 10, 35, 41, -25, 12, -5, -36, 11, -117, -10, -84, -58, 37, -38, -29, -3, 2, 23, 4, -33, -34, -9, 35, -12, -11, 5, 38, 1, -21, 3, -27, 7, -15, -56, -25, -10, -52, 37, 27, 68, -29, 19, 26, 22, 15, -2, -10, 22, 77, 5, 5, -31, -7, 32, 8, -22, 18, -33, 42, -57, 17, 47, 21, 30, 28, -57, -17, -8, 10, -64, 12, -58, -23, -39, 1, -43, 21, 15, -8, 24, 24, -2, 3, -41, -4, 29, 35, 14, -35, -12, -60, -7, 6, 9, 6, 57, -20, 13, 49, -2, -31, -3, -25, -52, 3, -18, -28, 31, 30, 13, -44, 43, 0, 10, -72, 11, -49, 41, -14, 50, -25, 65, -22, -37, 35, 9, 42, -24, 68, -12, 3, 28, 40, 41, 29, -44, -26, -10, -28, 38, 28, -41, -31, -14, 14, -25, -12, -19, -10, 16, -22, -25, -9, -22, 16, -27, 27, -4, -29, -38, -21, 12, 30, 23, -11, -24, 26, -40, -14, 10, 26, -43, -18, -17, 23, 30, -18, -22, 24, -35, -29, -32, 16, 41, -1, 22, 1, -5, 22, -12, -4, 12, -7, -18, -33, -24, -35, -18, -45, -70, 12, 26, 3, -37, -21, -18, -10, 20, 4, -49, 31, -45, -11, 16, 26, 6, 32, -17, -29, -36, -50, 22, -40, -1, 39, 16, 4, -25, -51, 1, -3, -30, 0, 19, -4, -48, 39, -29, 0, -44, -13, -55, 22, -41, -32, 38, -19, -75, 43, -42, 35, -79, -31, -20, -45, -53, -11, 43, 32, 24, -44, 32, -68, -56, 5, 12, -10, 18, -42, -19, -32, -6, -8, 39, 52, -49, 12, -12, 27, -7, -29, 20, 33, 30, 0, -37, 24, -25, 103, 3, 49, -20, -12, 41, -4, -64, 22, -35, -35, 12, 1, -9, -6, 7, 4, -24, 37, -33, -61, 36, -27, 61, -14, -8, -13, 41, -46, -13, -36, -25, -6, 15, -39, -49, -38, 10, 7, 19, 73, -26, 63, 13, -16, 25, 6, -37, 31, 3, 9, 26, 32, 26, 28, -82, -39, 30, 30, 52, -34, 11, -4, 28, -1, -24, -37, -25, 25, -29, 116, -82, 14, -36, -40, -34, -11, -47, 16, 33, 28, -29, -61, -2, -37, -12, 19, 15, 0, 26, 26, 4, 4, -40, -37, 12, -6, 15, 44, -41, 21, -3, -14, -1, 13, 7, 1, 91, -43, 39, 32, -30, -13, 2, -23, 29, 20, 11, -29, 32, 38, 26, -25, 70, 28, -9, -17, 47, -26, -29, 15, 4, -11, 44, 2, 25, 27, -6, 60, -4, -25, 31, 42, 18, -13, -4, 4, 17, -27, 13, 25, -6, 25, -66, -7, 26, -11, -28, -36, -12, -1, 2, 31, 66, -18, -14, 13, -26, -9, -27, 47, 16, 39, 29, -39, 36, 11, 4, 16, -14, -18, -76, 16, -30, 25, -18, -32, -95, 13, 40, 42, 20, 18, 60, 18, 17, 23, -25, -27, 11, -108, -39, -74, -10, 39, -46, 9, -11, 35, -5, -13, -17, -10, -35, 45, 6, -4, 4, 4, -16, 45, 26, -14, -33, -8, -5, -68, -14, -65, 19, -10, 43, -5, 69, -9, 17, 57, 45, 37, 44, 54, 36, -24, -49, -12, 38, 0, 29, -5, -16, 41, 12, 32, -2, 41, 3, 16, 5, 30, 17, 7, 33, -31, 9, -27, -25, 30, -7, -13, -16, 29, -45, 19, 40, 25, 24, 40, -25, -21, -42, 8, -3, -27, -8, -11, -25, 19, 13, -3, -45, 35, -22, -9, -49, 41, -58, 40, -22, -21, 35, 19, 17, -28, 0, 0, -64, -45, -7, -16, 18, -16, 27, 17, 61, -42, -21, -34, -21, 1, 33, 64, 30, -26, -34, 31, -25, 26, -28, 63, 30, 40, -8, -6, 35, -40, 38, -35, -57, -4, 19, 32, -56, 42, -16, 39, 7, -34, -26, -17, 8, 9, 1, 0, 41, 11, -33, 18, 27, 15, 10, -50, 37, -19, -61, 25, -43, 32, 32, 40, -13, 33, -24, -13, 19, 43, -13, -34, -1, 27, -23, -29, -4, -4, 25, -30, -32, -31, 23, -32, -34, -29, 59, 4, 16, -28, 12, 35, 3, 3, 4, 15, -4, -56, -15, 25, 0, 5, -22, -11, 4, -42, 21, -6, 32, -30, 41, -11, -8, 7, -14, 0, 81, -14, 5, -14, -19, 35, 38, -7, 47, 8, 50, -57, -21, 15, 36, -2, 42, -26, -17, 18, 10, 23, 11, 10, 34, -18, 57, 24, 44, -31, -19, 22, 15, 33, 27, -10, 13, -2, 15, -9, 6, -11, 4, 47, 4, 56, 54, 3, -34, 23, 7, -6, -32, 40, -39, 15, 12, -56, -14, 49, -63, 29, 35, -16, -24, -14, 42, 15, 0, 27, -17, 32, 14, 40, -22, 32, -42, -2, -2, -15, -38, 35, -46, 30, -23, 41, -78, 11, -2, -2, -28, 46, 69, 40, -34, 16, 21, 37, -35, -75, 31, -23, -32, -42, -60, 37, 4, 38, -10, -13, 30, 18, -39, 27, -42, 13, 45, 31, -25, 6, 39, -41, -16, -8, -15, -52, -44, -31, 34, 12, 40, -23, 42, -43, 16, 18, -2, 47, 18, 60, 55, -28, -22, -10, 17, -16, -15, -24, -42, -25, 24, -28, -14, -14, 7, 8, -33, -34, 19, 28, 9, -35, 9, 38, -18, 42, 27, -37, -3, -32, -37, -15, 25, -9, 18, 20, -38, -29, 3, -17, 28, 21, -30, -16, -10, 26, -18, 30, -26, -29, -55, -22, 26, 33, -38, 9, -14, 9, -23, 30, 8, 33, -42, -44, 12, -7, -47, -12, -3, -23, -1, 34, -36, 6, -31, -23, -43, -29, -48, -36, -43, -28, -21, -15, 10, -20, -29, 1, -2, 5, 36, 16, 28, -7, 9, -22, -2, -11, 24, 0, 18, -38, 28, -22, 13, -4, -10, -10, -30, 23, -30, -22, -44, -13, 23, 25, 10, 16, 11, 1, 40, -10, 23, -21, -27, -12, -34, -11, -19, -17, 19, 8, 29, -29, -27, 7, -14, 32, -36, -32, -11, 14, 3, -26, -27, 8, -2, -38, -6, -33, 21, -20, 22, -41, -39, -1, 32, 37, -18, -20, -26, -2, -28, 16, -4, 3, -20, 24, -53, 48, -2, 7, 25, 7, 1, 14, -20, 24, 1, 1, -52, -6, 0, 23, -12, -4, -19, 13, 16, 35, -35, -35, -47, 29, -77, -31, -30, -3, -33, 10, 23, -9, -10, -63, 21, 55, 42, 33, -5, 10, 7, -16, -45, -7, -34, 15, 44, -5, -25, -53, -11, -8, -20, 29, 39, -2, -60, 47, -6, 24, 40, -44, 15, -12, -28, 42, -16, -21, -5, 82, 36, 21, 1, -74, -31, 7, 10, 14, -14, 26, 43, 18, 28, -38, 12, 20, -37, 20, 37, 20, -6, -31, -68, 20, 11, 22, -45, 24, 38, 4, 47, 41, 46, 33, -31, -17, -20, -32, 26, -95, 9, -26, 5, -17, -43, 16, 44, 27, -21, 1, 36, 12, -38, -16, -29, -27, 7, -6, 37, 33, 51, -13, -24, 6, -20, 7, 1, 21, 35, -24, 48, 12, 16, 13, -7, 29, -21, 50, 29, 54, 41, -2, -9, 5, 38, 35, 29, -34, 32, 36, -7, 3, 17, -38, -10, -5, 46, 22, -2, -30, -75, 12, -26, -45, 21, 25, 5, -12, -7, -3, 13, -17, 35, 28, 6, -7, -38, 2, 1, -23, -55, 51, -42, 18, 16, -10, -1, 24, 13, 8, -20, -46, -14, 28, -45, 41, 20, 15, -4, 16, -3, -13, -16, 25, -5, 43, -1, -41, -41, -18, 40, 47, 6, 17, -13, 31, 8, -5, 6, 55, 25, -21, 27, 16, 17, -42, 8, 54, -10, -1, -40, -6, -36, -48, 38, 23, -20, 15, -8, 12, -28, -20, 21, -10, -9, 10, -30, 32, 14, 56, 44, -24, 20, -11, 24, -32, 28, 42, -30, -29, 22, -51, -65, -32, -37, -18, -7, -3, -3, 27, -17, -20, 17, -20, -33, -22, 7, 29, -9, 7, 11, -10, -8, 10, 33, 20, -39, -10, 0, -32, 56, -48, 29, -31, 15, 51, 12, -20, -20, 17, 31, -54, 14, 9, -6, -17, -14, -4, 16, 2, 16, 20, -14, 14, 27, -7, 37, 22, 37, -36, -61, 3, 7, 10, 0, 18, -43, -30, 36, 48, -15, 10, 23, -22, 33, -27, 11, 18, 18, -18, -50, -33, -49, 20, 6, 10, 23, -8, -49, 31, 34, 34, 53, 11, 26, -9, -21, 10, -2, -32, 27, 44, -17, -2, -23, -78, -13, -3, -7, 42, 31, 26, 48, -24, -27, 8, -25, -19, -45, 18, -5, -51, 33, -12, -8, 21, -41, 18, -20, 52, 21, -11, 24, 2, 39, -25, -34, 30, -15, -3, -35, 6, -83, 24, -8, -15, -74, 9, 8, -11, 7, 42, 75, 40, -29, -4, 53, 27, -38, -68, -9, -75, -27, 11, -32, 29, 13, 24, -11, -14, 45, 17, 10, 43, -43, 21, 47, -1, -14, 18, 18, 18, 33, 31, 9, -66, -38, -58, 37, 54, 51, 29, 78, 31, 9, -15, 31, 13, -20, 74, 32, -44, -31, -16, -10, -29, 24, 29, 34, 49, -15, 1, 47, -18, 6, 37, -5, -30, -14, 13, -34, -13, -37, -10, -12, 40, -19, -23, -14, 7, 24, -1, -7, -34, -16, 45, 4, 42, -37, -22, -19, -71, -49, 2, -66, -8, -20, -2, 36, -25, 11, 16, 28, -27, 1, -21, 22, -39, 26, -7, 37, 9, 47, -18, 29, -39, -47, -49, 16, 4, -6, 9, 34, -18, 28, 24, 46, 21, -22, 60, 5, -52, -30, 20, -25, 21, -3, -52, 5, 8, -17, -10, -15, 5, 14, -16, 18, -17, -19, -36, 38, -26, -28, 2, 9, 17, -41, -15, 39, -13, 30, -49, 1, 35, 40, 33, -3, 28, 16, -31, -2, -25, 58, -17, -28, -19, -7, 29, 29, -22, 21, 40, -9, -2, 18, -18, -41, 16, 21, -13, -21, -21, -21, -30, -48, -22, 32, -34, 26, -7, -12, 45, -78, 17, -2, 24, 8, -8, 26, 35, -6, 11, 34, 20, -10, 25, 29, 13, -54, -20, 47, 29, 28, 35, 31, -19, -15, -16, -1, 13, -4, -4, -33, -28, -4, 25, -14, 28, -31, 14, 44, 26, 34, -40, 20, 19, 28, 7, -18, -22, -18, -14, -30, -48, 1, -5, -5, -14, 15, 10, -8, -41, -17, -12, 23, 7, 9, -42, -9, -52, 12, -1, 28, 3, 16, -54, 20, 45, -11, -36, -4, 5, -20, -9, 25, -18, 17, 38, -25, 53, -35, -18, -57, 32, -42, -6, 10, -23, -33, -2, 58, 38, -37, -23, 16, -10, 31, 5, 46, -13, 90, -28, 4, 22, -23, -13, 21, 26, 37, -24, 25, 17, -37, -40, -15, -33, -46, 2, 29, 75, 15, 81, 25, -23, 45, -2, 29, -16, 37, 19, 30, -14, -17, -23, 78, -16, 8, 49, 42, -33, -39, 20, -31, 39, 29, 49, 54, 55, -14, -35, 20, -22, -50, 1, 41, -17, 8, 11, 9, 24, 13, 39, 62, 12, 20, -24, -27, 19, -34, -7, 12, 34, -32, -14, -2, -21, 9, -7, -10, -1, -33, -22, 9, 29, 30, 14, 0, -22, -13, -43, -44, 29, -3, 33, -26, -5, -18, -23, -41, -12, -26, 11, 7, 31, -3, -5, -36, -20, 10, -42, 31, -32, 18, -4, 8, -6, -26, 2, -12, -24, -41, -36, 37, 32, 32, -37, -35, 6, -5, -12, 16, -40, 7, -14, -7, 32, 1, -26, -33, -38, 21, 25, 14, 31, -1, 19, -33, 22, 32, 28, -20, 7, 17, 0, 35, -31, 15, -8, -4, 18, -25, -16, 16, 1, -31, 7, 8, -54, -20, -12, 25, -27, 20, -61, 9, 30, -36, 45, 66, -21, -29, -33, 28, 1, -42, -17, -23, -7, -25, 22, -45, 43, 54, 34, 43, 41, -10, -9, 29, 3, 31, 28, 30, -16, -58, -58, -12, 33, 16, -42, -19, -21, -4, -16, -35, -15, 17, -26, -4, -13, -21, -33, 53, -25, -52, -41, -34, -24, -18, 20, -14, -36, 21, 40, -20, 12, -37, 18, 3, -16, -21, -3, 22, -11, 26, 20, -16, 11, 14, 39, -42, -35, -54, 33, 36, 26, -17, -17, -6, 31, 13, -7, -6, -41, -26, 17, 27, 6, 25, -36, -27, -12, 19, -45, -39, 11, 27, 2, -48, 2, 24, -27, -5, -33, -13, -35, -2, 12, -37, 33, 35, -14, -2, 28, -39, -34, -42, 11, 13, 37, -33, -14, -40, 32, -15, 5, -38, 36, 35, 18, 82, 3, -20, 41, 27, 0, -21, 8, -17, -1, 46, -23, 25, 12, -16, 18, -17, -6, 28, 49, 16, 19, 70, 4, 23, 4, 1, 12, -48, -27, 28, -11, 4, 22, 10, -31, 19, 15, 22, 9, -21, -4, -23, 9, -15, 0, 28, -25, 19, -24, 49, 27, -31, -33, -25, -37, 1, -42, 19, 11, 59, 4, 28, -29, 5, 10, -28, 10, 19, 33, 41, -2, -33, 25, 19, 6, -31, -2, 26, 6, -32, -36, -17, 22, -40, -26, 28, -41, -26, 26, 33, -16, 12, -31, 7, -17, -27, -36, -27, -16, -20, -7, 19, 9, -7, 4, 39, -1, 28, 33, 10, -16, 27, -21, -9, -24, 20, -33, -47, -36, -25, -27, -24, 14, 20, -39, -26, -26, 23, -42, -34, -43, -32, 20, 8, 2, -41, -53, -54, -31, 24, 32, -8, -9, -22, 5, 18, -3, -4, -40, 25, 28, -7, 23, -35, -46, -13, 20, 7, 9, 27, 5, -46, 10, -2, -39, -53, 50, -12, -45, 57, 7, 38, 26, 6, 34, 47, 11, 3, 25, -17, -54, 47, -9, 21, 17, 31, -27, 15, 41, 12, 78, -3, -17, 59, -45, 17, 33, -55, -40, 44, -5, 15, -31, -1, -1, 21, 43, -2, -6, -21, 39, 10, -9, 32, -5, -1, 30, -30, -91, 49, 8, -78, -68, 22, 18, -11, -3, 41, -65, 5, 40, -80, -59, 21, 5, -18, 39, -24, 20, 33, -12, 7, -31, 30, 29, -39, -39, -24, -34, 8, 4, -37, 2, -23, 7, -20, 3, -17, 19, -6, 29, -3, 32, -4, 26, -4, -13, -42, 19, 0, -2, 2, -37, 8, -35, 3, -46, 0, -35, 28, 14, -52, -1, 52, -13, 33, -72, -24, 15, 38, -31, -11, 3, -14, -27, -22, -17, 22, 13, 19, -13, -18, 23, 22, -10, 0, 26, 2, 8, 8, 44, -5, -19, 23, -22, -30, -8, -17, 4, -1, -41, 2, -42, 34, 19, -47, -21, -42, -27, -45, 40, -55, 20, 0, 35, -82, -39, -14, 53, 0, 8, 28, 15, -11, 39, 4, 16, 26, -100, 37, -18, -50, -43, 10, 9, 15, 30, 22, 11, 5, -6, -30, 20, -1, 33, 39, -63, 37, -9, 51, -29, -30, -5, 6, -15, 13, -55, 34, -9, 25, -14, 32, 11, 9, 48, 34, 5, -20, 95, -16, -38, -15, 9, -3, 1, -11, -18, -2, -21, 9, 35, -20, 34, -18, -6, 40, 6, -6, -23, 4, -17, -42, -14, -22, 21, 35, 7, -37, -6, -13, -34, -32, 30, -38, -42, 6, -22, -42, 26, -2, -22, 28, 25, -18, 25, -14, 10, -5, -42, -2, 6, 6, 16, 32, -3, -33, -38, 14, -12, -37, 0, 29, -23, 23, -4, 13, -31, 29, 39, 15, -42, 8, -28, -14, 23, -31, 17, 20, 39, -1, -1, 33, -29, -7, -9, -8, 34, -23, 37, 42, 19, 21, -9, 29, -28, -30, -38, -35, 2, -25, -23, -64, -27, -21, 3, -16, -16, 27, -19, 24, 28, 3, 35, 15, 11, -15, 10, -16, 7, -7, -8, 17, 15, -21, 28, -7, 28, -19, 22, -12, -46, -30, 23, 23, -26, 20, -44, 22, -39, 41, 3, -2, -42, 11, -54, -17, 22, 25, -3, 28, -34, 24, 19, -15, -6, -20, 41, -44, 81, -8, -43, -41, -18, -38, 27, 34, 56, 25, -14, -42, 24, -15, -6, 45, 28, -45, 34, 17, 1, -16, 30, 3, 13, 12, -23, 21, -12, 2, 56, 27, -8, 48, 25, 20, -3, 47, -7, -1, -27, -18, -27, 10, -22, -47, -37, 5, 22, -34, 45, 5, -5, -26, 43, -46, -9, 28, -10, -3, -7, 9, -25, 13, 38, -26, -30, -45, -45, 2, -24, 52, 31, 74, -34, -6, 4, 42, -11, 38, 48, 15, -15, -45, 45, -31, -8, 15, 34, -9, 22, -50, 30, 10, -47, 0, -30, -46, 1, -20, 18, -30, 2, 10, -9, -1, -28, -1, 9, 28, 46, -29, -29, 44, -5, 15, -8, 22, -12, 8, -49, -50, -32, -56, 9, -37, -18, -20, -37, 21, -22, 22, -19, -41, 11, -43, -37, 20, -27, -24, -4, -12, -16, -5, -2, 1, -8, -62, -26, 8, 26, -34, -22, 63, 14, 18, 51, 31, 32, -42, 25, 16, -62, -59, 6, -25, -36, 37, 43, 26, -3, 64, -24, -39, -38, 20, -13, -49, 33, -22, -7, -62, -48, 63, -12, 28, -38, 51, 12, -16, 75, 12, 20, -4, -17, -27, -9, 20, 28, 26, 103, 2, 9, 20, -40, 8, -1, -20, -16, -46, 32, 42, 18, -35, 4, 38, 3, 26, 15, -41, -17, 26, 16, -20, -16, 12, -13, -6, 15, 22, 22, 28, -26, -11, -20, 15, 43, 12, -23, 7, -5, 8, -40, 10, 12, 37, 10, 4, 44, -26, 15, -1, -5, -3, -29, 21, 33, -47, -21, -27, 1, -85, 49, -66, 2, 25, -34, -52, -8, 23, 39, -26, 16, 80, 44, -19, -13, 33, -21, 19, -105, 22, -30, -26, 35, -46, 8, 12, -26, -11, 22, -17, 36, -36, 6, -35, 1, -8, -3, -10, 15, -1, 2, 4, 3, 26, -61, 6, -55, 7, -12, 27, 0, 25, -14, -11, 41, 32, 46, 30, 80, 49, -81, -8, -2, -10, 42, 33, 26, -7, 10, 26, -2, -15, -30, -28, 24, 7, 42, -19, 8, 57, 36, 42, -30, 32, 0, 67, -31, -43, 61, -23, 29, 12, 43, 37, -33, -6, -44, -31, 96, -12, 56, -35, 22, 4, -45, -25, 19, 9, -39, 14, 24, -36, -27, 71, 28, 8, 4, -4, -46, -25, 50, 20, 7, 38, 8, 17, 33, 29, -21, -23, -36, -18, 16, -2, -79, -42, 4, -17, 12, -19, 47, -30, 43, 27, 17, 36, -18, 3, -30, 42, -2, 8, 26, 9, -33, 55, -33, -4, -11, -10, -25, -8, 29, -26, 40, -50, 37, 51, -50, -28, -11, -80, -5, 45, 12, 26, 18, 34, 28, -23, -42, 24, 12, 61, 29, -6, 32, -4, 35, -2, -26, 4, 31, 46, 26, 17, 54, 8, 17, 8, -16, -27, 46, 19, -3, 53, -8, 49, 9, -61, -20, -33, 36, -31, -17, -30, -17, 13, 8, -25, -43, 15, 11, -25, 9, 17, -42, -18, 8, -30, -13, -3, 15, 15, -7, -9, 27, -20, 24, 32, 21, -28, -41, 39, 14, -39, -3, 1, -40, -19, -23, -34, -38, 2, 31, -21, -41, 35, -2, 26, -33, -26, -38, -30, -8, 17, -23, 9, 28, -19, 36, -28, -17, -42, 24, -32, -42, -10, 10, 23, -31, -33, 28, 5, -10, -5, 20, 3, 4, 7, 28, -32, -38, -33, -33, -4, -25, -33, -31, -31, -38, 32, 20, -28, -11, 28, -24, -39, 24, 35, -50, 47, 36, -42, -16, -46, -35, -31, 33, -26, 5, -9, -5, 8, -32, -4, 26, 34, 10, -18, 40, 5, -37, -23, 35, 33, 16, 6, -8, 7, -26, -58, -16, -42, 41, 4, -35, 33, 20, -20, -23, -61, -39, -48, 29, 45, -51, 10, 22, 8, -20, 27, 32, 6, 14, 15, -30, -1, 3, 28, -21, 48, 4, -5, 9, 13, 26, -13, 67, 12, 14, -23, -18, 29, 16, 5, -54, 12, 16, -83, 31, 6, 18, -26, 31, 5, -36, -19, -3, -21, 6, 12, 44, 23, -16, -7, -18, 33, -34, 1, -9, -61, -31, 16, 6, 34, 18, 26, -15, -11, -44, -18, 35, 14, -31, 45, 27, 14, 8, 35, 1, 62, -28, -25, 20, 3, 6, 16, 1, 38, 12, -11, 18, -38, -66, 13, -23, 11, -19, -26, -16, -75, 52, 36, -6, -36, -15, 25, -30, 7, -58, -1, 30, -24, -14, -30, -47, 34, 11, 10, 0, -7, -26, 34, -32, 12, -35, -3, -20, 13, 10, -31, 3, -20, -12, -11, 1, 28, -29, -38, 1, -17, 54, 2, -41, 27, 36, 4, -91, 16, -61, 0, 47, -34, 23, -3, -45, -12, 22, 31, 44, 36, 11, 19, 35, -27, -20, 29, 48, -30, 0, 28, 2, 24, -60, -31, 8, -20, 20, -39, -2, 38, 14, 14, 37, 2, 19, -41, 3, -8, -72, 37, 10, -26, 32, -5, 38, -46, 12, 52, -23, 22, 5, -21, 30, 4, -52, -16, -45, 37, 3, -18, 7, 7, -24, 65, 18, -56, -12, 1, -16, -42, -13, -44, 21, -45, -64, -8, 21, -6, -8, 22, 5, 0, -24, 24, 0, 25, -34, -1, 11, -36, 15, -7, 21, 14, -46, 37, -33, 24, 45, 16, 15, 17, 66, 20, 56, 0, -11, 22, 6, -12, 4, 58, 4, -22, 57, -48, 15, 32, 69, -1, -3, -25, -34, 14, -25, 9, -32, 104, -1, -19, 37, 24, 18, 0, 34, -34, 4, -9, 22, 60, -11, 26, -36, 51, 41, -11, 21, -4, -20, 27, -6, 23, -16, 27, 39, 6, 66, -25, 68, -11, 39, 61, -25, -30, 21, -39, -7, -25, -22, -27, 48, 88, 20, -30, 35, -6, -24, -27, 22, -33, 6, 32, 33, 8, 31, 10, 28, 19, -28, -116, -15, -8, -9, 10, -14, -23, -41, 1, 83, -6, 31, -10, -6, 0, 62, 43, 43, 5, -12, -2, 36, 20, -11, -10, -9, 35, -4, -78, 40, -50, 24, 0, -28, -81, -11, 2, 10, -26, -7, 15, 24, 10, 1, -6, -12, -55, -73, 44, -74, -11, 38, -49, 14, -23, -31, 20, -36, 25, -18, 3, 40, -34, 39, -16, -18, 8, 21, 22, 33, 26, 9, -51, -36, -22, -16, -22, -22, 55, -23, 61, -12, 40, 7, 38, -23, -12, 24, 21, -37, -29, -10, -22, 23, -32, 11, -13, 13, -41, -3, 48, -32, -33, 15, 8, 34, 8, 42, -36, 39, -55, -19, 39, 43, -76, -16, 30, 31, -24, -4, 19, 27, 6, -23, 35, 42, -42, -118, 12, -26, -25, 19, -8, -1, 37, -3, 27, -15, 26, 41, -36, 11, -81, 14, 19, -25, 27, 43, -27, -13, 10, -13, 1, -63, 10, -75, 43, 33, 54, 20, 72, -18, 18, 5, -8, -27, 6, 76, 50, -72, 28, 1, -23, 30, 45, 3, 33, -24, -7, -49, 7, 2, -26, -19, -16, 45, -36, -44, 42, -19, 51, 15, -10, -8, 68, -30, -41, 42, -7, 38, -6, 26, -28, -24, 61, -27, 10, 122, -19, 25, -20, 39, 68, -99, -13, 40, 10, -41, 26, -34, -38, -1, 13, 49, -5, 25, 9, -10, -16, 64, 18, 3, 68, 28, 16, 25, -33, -9, 8, -18, 12, 0, 19, -43, -16, 29, 46, -54, -18, 37, 3, -7, 12, -31, 17, 3, 18, -16, -31, -5, -5, -4, 11, -29, -3, -26, 40, 17, -49, 40, 15, 13, 15, -3, -48, 42, -32, 10, -23, -26, 18, 5, -15, 41, 46, -1, -26, -10, -24, -39, -43, -21, -3, 10, 12, 30, 7, 11, 20, -29, 5, 51, -79, 35, -15, 25, 25, 45, 31, -33, -15, 18, -15, -33, -40, -53, 19, 10, 62, -6, 5, -34, -20, -11, 18, 9, -17, 15, 50, -57, -32, -4, 16, -36, 19, -21, 9, -17, -56, -9, -12, -20, -5, -5, -35, -13, -33, 41, -52, -5, -75, 10, -37, 22, -19, -23, 2, 27, 19, 41, 59, 9, 7, 30, -26, -28, -20, -106, 31, -71, -43, 16, -84, -13, 28, 12, -13, -15, 12, -26, -14, -8, -59, 25, 21, -53, 19, 34, 14, -32, -20, 30, -48, -72, 20, -61, 42, 52, 43, 21, 29, 4, 41, -15, -2, 7, -16, 80, 40, -44, 13, -19, 37, 23, -14, 42, -15, -9, -14, 40, 40, -28, -32, -38, 20, -42, 28, -16, -30, 9, -73, 43, -40, 42, -62, 21, 10, 12, 22, 34, 16, -35, 3, 3, 25, 23, -19, -35, 34, -31, -58, 39, -78, 29, -14, -33, -5, 21, -13, -36, -33, 6, -16, 29, -10, -39, -30, -4, 19, -37, 18, 35, -12, 5, -22, -55, 24, 41, 52, 10, 66, -19, 29, -16, 47, -4, -23, 95, 32, -15, -40, -10, 23, 26, -15, 52, 41, 12, 37, -26, 33, -19, 13, 24, -42, -28, -39, -11, -49, 0, -82, -6, 24, 40, -49, 32, 43, 32, 45, -3, 29, 1, -13, 14, -2, -38, 15, -28, 5, -18, -42, 17, -5, 34, 23, 7, 13, 21, -2, 8, -46, 48, 22, -25, 19, -55, 39, -15, 49, 22, -7, 36, -15, -25, 8, -59, -29, -28, 22, -11, 67, -42, -21, 18, 12, 44, -7, 43, 4, 20, -7, -5, 40, -39 };
+static const int32_t prediction_next_solar_q8_layer_3_biases[32] = { 74, 107, 81, 82, 115, 67, 116, -136, 82, 81, 0, 75, 33, 102, 118, 72, 83, -32, 91, -122, -21, -3, 98, -65, 78, -41, 113, 70, -45, -58, 88, 52 };
+static const int8_t prediction_next_solar_q8_layer_3_weights[2560] = { -66, -32, -14, 7, -12, 36, 29, -40, 0, 3, 24, -33, -26, -17, 32, -25, 36, 23, 13, 30, -24, -19, 33, 9, 0, 14, 14, 70, 14, -2, 10, 7, 9, -27, -22, 8, -9, -40, 44, 11, 41, -26, 30, -1, -10, 25, 35, -21, -22, -2, -11, -20, -22, 10, 12, -1, 4, -17, -12, -36, -26, 26, -16, -32, -30, -9, -17, -26, -20, -29, -23, 19, -24, -27, 29, -30, -1, 0, 29, 14, -17, -37, -24, -6, -57, 23, -22, -30, -33, 31, 21, 40, 40, 23, 30, 8, 35, -32, 37, 10, 8, 44, 50, 12, 7, 32, -13, 16, 27, 7, -30, 28, -25, -21, 18, 0, -20, -32, -24, 30, -32, 8, 4, 35, 7, 17, -20, 19, -34, 12, -24, 9, -40, 11, 8, 6, 13, 32, -14, 35, 10, 23, 19, 37, 13, -6, 31, 41, 30, -1, 32, -5, 9, 31, 39, 5, 37, -5, -22, 28, -33, -3, -86, -38, -60, 6, 22, 12, 25, -38, 11, 16, 4, 6, 23, -24, 11, -34, 1, -12, 34, -12, 46, -10, 18, 15, -32, 72, 39, -13, 29, -14, -28, -18, 25, -25, 15, -6, 31, 11, 13, -21, 39, 3, -18, -17, 29, 20, -10, -20, -23, -3, -13, 29, 8, 20, -39, 17, -29, 33, 15, 7, -20, -1, 39, -42, -46, -15, -21, -29, -22, -6, -23, 25, -9, -34, 32, 44, 31, 32, -7, -13, 16, 3, -10, 12, -35, 2, 14, -22, 7, 14, -69, -8, 6, 19, -3, 14, -39, 19, 15, -2, 18, -24, -14, 4, -27, 14, 11, -5, -22, -50, -49, -8, -15, 14, 37, -1, -20, -11, -33, 17, 18, 6, 6, 17, -2, -21, -47, 29, 32, 24, 22, -9, -35, -23, -27, -12, 28, -20, 30, 21, 8, -38, -33, 26, -38, 3, 18, -36, -37, 41, 38, 16, -23, -43, -29, -20, 31, 32, 4, -1, -25, 11, -42, -30, -26, -9, 5, 9, -14, 2, 46, -39, 69, 23, -32, -83, 14, 20, 31, 10, 4, 21, 34, -26, -29, 45, -31, -30, 24, -28, -41, 17, 13, 17, 31, -47, -24, 15, 3, -20, -15, 5, 35, -14, 40, 33, -4, 36, 18, 8, 27, 1, 6, 21, 23, -5, -34, -5, -19, -9, 28, -21, 19, -1, -10, -3, -26, 9, 22, 29, -6, -10, 16, 35, 35, -10, 9, -10, 49, -14, 26, -32, 33, -10, 3, -2, 31, -8, 25, 16, 25, 37, -39, 27, -2, 47, 16, -15, -12, -26, 30, -22, 52, -36, 41, -54, -4, -11, -18, -73, 26, 13, -18, 26, 6, 23, 17, -7, -9, 5, -8, 2, -6, -48, -37, 2, 26, -3, 53, 31, -12, -17, 16, 2, 65, 32, -9, -7, 0, -1, -16, 41, -22, 72, -35, 37, 27, -49, -32, 29, 37, 19, -36, 35, 48, -35, -39, -16, 38, -9, -12, -3, -42, 12, -42, 6, 32, 24, 6, -21, -18, -33, 55, 52, 16, -41, 24, 13, 20, 26, 45, -36, 8, 30, -4, 12, 38, 7, -9, -10, -3, -6, 49, -31, 26, -55, 16, -14, -21, -10, 18, -28, 13, 14, 8, -10, -24, 15, 37, -6, -32, -36, 9, -22, -19, -28, -10, -7, 3, 9, 24, -31, 44, 15, 14, 27, -18, -31, -5, -10, 22, -28, 24, -17, 28, 8, -15, -35, 7, -2, 2, -14, 52, 37, 14, 14, 6, -40, 41, 17, 3, -23, -42, -48, -40, -127, 14, 28, -34, -30, -37, -34, -7, -23, 20, -14, 7, 1, 20, 43, -70, 28, 35, -27, -8, 26, -33, 19, 11, 49, -26, 37, -65, 20, -1, -14, 39, -56, 11, -22, 20, 20, -44, 38, -35, -24, -37, 34, -12, -19, -31, -40, -12, 9, 39, 37, 27, 29, 9, 31, -10, 31, -5, 20, 8, 26, 44, -47, -54, -26, -39, -29, -47, 24, 9, 9, -14, -26, 36, -28, -12, -15, 67, -34, -21, 19, -36, -15, 24, 45, -7, 33, -23, -9, -18, 12, 11, 7, 40, -2, 41, 25, 22, -12, 5, -50, 9, -10, 23, -15, -2, -7, 34, -36, 31, -23, -21, -15, 1, -10, 13, -3, 30, -11, -33, -7, -3, 36, -36, 29, -32, 36, 3, -60, -32, -34, 37, -11, 18, 15, 7, 6, 31, -45, 31, 26, 31, 13, -57, -27, -35, 15, -46, -22, 24, -38, 17, 0, -22, 30, -23, 30, 48, 1, -17, -39, 25, 32, 9, -21, -10, -25, 37, 21, -14, 15, -3, 21, -33, 20, 46, 34, 8, 31, 22, -24, -16, 1, 7, 15, 8, -32, 19, 2, 43, 37, -12, 27, -5, -24, -7, 32, 12, -11, -49, 16, 35, 31, -12, 30, 27, -25, -29, -43, -10, 22, 30, 41, -38, -12, -3, -24, -16, -8, -24, -28, 9, 0, -21, -29, -38, -22, -22, 9, -8, -13, -9, -28, -1, -36, -8, 18, 6, -35, -1, -9, -19, 0, -13, -6, 21, 28, 11, -17, -24, 11, -10, 33, 28, 16, 24, -23, -38, -33, 16, -38, 8, 3, -23, -24, 30, -35, 10, -25, -33, -12, 24, -13, -28, 31, -22, 33, 8, 17, -22, -36, -7, 3, 17, 6, -19, -22, -24, 12, -21, -37, -35, 37, 11, 8, -8, -32, 9, -21, -7, -17, 27, -37, -35, -45, -44, 24, -17, -18, -34, -14, -32, 8, 24, -31, 38, 10, 36, 38, 4, -41, -35, 21, -2, 15, 30, -30, 11, -17, 26, 57, 31, -34, 2, 47, -12, -8, 16, -21, -10, -32, 42, 35, 24, -10, 20, -11, -16, 33, 20, 29, -29, -14, -1, 4, 23, -16, 34, 29, 34, -36, -7, 5, -15, 30, -35, 30, -13, 15, -34, -28, 13, 45, -26, -37, -11, 36, 20, -11, 31, 41, -27, 23, -10, -54, -30, -26, -63, -34, -4, -62, -39, -28, 40, -22, -20, 28, 66, -4, -23, 16, -1, 33, 12, 20, -19, 3, -28, 15, -70, 17, -39, -2, 14, -2, -7, -33, 7, -25, 22, -11, -17, -29, -22, 38, -6, 0, 19, 24, 24, 5, -24, 11, 20, 15, -47, -2, -9, -19, 32, -22, 8, -16, 17, -28, 4, -24, -14, 6, -44, -29, -29, -26, -43, 49, -21, 14, -36, -4, 28, 22, 10, 33, -44, -42, -100, -27, -19, -22, 4, 8, -26, -7, 28, 15, 0, 37, 73, 11, 19, -6, -29, 12, 23, -22, 27, 39, -14, -38, -19, 71, -9, 41, 6, 38, -33, -25, 24, 30, 44, -17, 13, 7, -32, 23, -6, 23, 34, -26, -23, -20, 25, 18, -35, -13, -13, -17, -5, -32, -18, 37, 4, -27, 28, -12, 30, 17, 27, -39, 21, -17, -2, -17, -19, -5, -30, -16, 13, -42, 17, 29, 40, 9, -20, 29, -18, 10, -48, 41, -9, -7, 27, 28, 7, 45, 40, -29, 4, 30, 31, -39, 41, 16, 32, 38, -14, 10, -5, -26, 4, 26, 5, 46, -3, 3, 40, -21, 13, 17, 13, -47, 21, -1, 8, 55, 38, 35, -5, 17, 45, 37, -1, 31, -37, 17, 29, -20, -19, 32, 25, -32, 15, 37, 24, 3, -31, 2, 24, -16, -2, -21, 7, 6, 36, -40, 49, 31, -21, -11, 20, 18, 45, 28, -29, 19, -81, 12, 17, -19, -17, -12, 37, 12, -26, -23, 11, 14, 26, 0, 27, -47, -28, 24, 30, -9, -4, -21, -16, 36, 0, 1, -42, -9, -2, 30, -24, -40, 24, 22, 36, 17, 34, -9, 1, 38, -32, 20, 7, 33, 15, 14, -44, -32, -34, 19, -12, 24, -31, -6, -36, -20, 22, 34, -16, 9, 22, -37, 40, -45, 16, 0, -9, -10, 22, 23, 7, 3, 36, -34, 36, 24, 5, 28, -11, 15, -93, 37, -42, -27, -24, -6, -10, 7, 37, -15, -39, -21, 2, 19, 32, -51, 38, 15, -31, -16, 29, 32, 20, -9, -40, 48, -16, -3, -31, -3, 40, -9, 26, -5, 26, -5, 16, 43, -26, -5, 10, 6, -30, 5, 39, 17, 11, -16, -48, 18, 30, -14, 5, 6, 8, 15, 35, 28, -33, 17, -7, 19, 10, -43, -32, -11, 16, -15, -12, 4, -17, 25, 33, -67, 11, 17, 29, 28, 33, -13, -37, -25, 19, 27, -37, -32, 27, 1, 31, -21, 18, 38, -40, 22, -40, 24, 24, 0, -31, -16, 6, 29, 2, 5, -25, 9, -7, -21, 20, 3, -19, -6, -3, -29, -4, -6, -42, 8, -14, 7, -34, -41, 25, 6, -23, 32, 29, 10, -28, 8, -21, 0, -18, 34, -26, -11, -17, 21, -12, -25, 36, 3, 5, -36, -18, 1, 23, 1, 8, 12, 35, 4, 6, 19, -31, 34, -19, -10, -6, -41, -67, 28, -62, 26, 5, -29, 13, 22, 46, -7, 9, 13, 67, -32, 13, 11, 20, 37, 21, 35, 7, -4, 6, -33, -19, 39, 29, 25, 20, 40, -31, 2, -19, 6, 21, -46, 5, 5, 35, 41, 28, -23, 11, -6, 38, -20, 25, -21, -12, 26, 9, 19, 15, 9, -15, 17, 25, 0, 13, -20, 41, -23, -24, -18, -31, 30, -6, -14, 27, -4, 22, -21, 39, -49, 23, 26, 31, -16, 23, 2, 41, 7, -5, 21, 35, 49, -25, 5, -11, -5, -54, 7, -4, 7, -20, 54, -2, 23, -9, 6, 11, 18, -11, -26, 5, 17, -40, -42, -32, 4, 53, -26, -8, -44, 6, -17, 17, 30, 25, -10, -3, -10, -36, -22, -8, 11, 27, 34, 40, -37, 7, -22, -25, -21, 12, -38, 32, -25, 28, -31, 32, -32, -1, -4, 48, 6, -2, 39, -13, 8, -24, -15, 35, 24, -7, -20, 12, 32, 13, -23, 9, -33, -40, -26, -31, -20, 25, -17, -2, 21, -36, -12, -2, -12, 30, -6, 16, 34, 31, 14, 1, -3, -3, 31, 7, -29, 22, -5, -18, -23, 11, 16, 24, -6, 27, -15, -43, 18, -1, -33, -27, -15, 11, -36, 21, -28, 1, -37, 6, -37, 1, -19, 10, -12, 15, -10, 34, -17, -40, 9, 15, -1, -16, -27, -13, 5, -34, -12, 15, 6, -52, -9, -36, -6, -45, 29, -20, -36, -7, -20, 54, 8, -6, -26, -20, 12, -44, -56, 2, -38, -35, 3, -21, -19, 29, 68, -32, 29, 5, 25, -5, -37, -43, -38, 26, -33, 40, -38, 11, 41, 116, -39, -12, -2, -31, 50, 4, -9, 22, -11, 47, 18, 17, -45, -13, -24, -50, 34, 1, 10, -14, 0, 12, 30, -5, -29, -30, -35, -39, -28, -40, -49, -11, 7, -16, -20, 5, -37, -11, 12, 34, 27, -23, -4, -49, -7, 43, -35, 3, -42, -14, -11, -25, 19, -26, -18, 22, 30, 11, -32, 33, 14, 2, 25, 31, -53, -10, 26, 3, 30, 44, 13, 23, 33, 16, 43, -6, 13, 21, 37, -36, -26, 44, -29, -26, -18, 30, -19, 31, 19, -16, 9, 35, 17, 28, 35, 6, -4, -30, 19, -16, 10, 24, -3, 48, 5, 32, 34, -16, 15, -14, -15, -1, -26, -8, 29, -30, 13, -30, 27, -32, 14, 19, -6, 22, 11, 39, -33, 24, -16, -10, -38, 29, -15, 33, 54, 12, 24, -23, 33, -32, -63, -40, 1, 0, 2, 5, 8, -3, -31, -8, 30, 38, 18, 39, -44, 13, -13, 31, 40, -26, 12, -9, 18, 8, 50, -2, 23, -22, 39, -11, 31, -5, 32, 26, -26, 32, -8, -19, -25, 6, -25, -6, -15, -24, 19, -26, -2, -34, -14, -36, 24, -12, 40, 32, -8, 15, 7, -6, -43, 3, -14, 7, 47, 21, 0, -19, -35, -46, 2, -64, 36, -4, 5, -8, 19, 13, 2, 28, -2, -29, -27, 41, -26, -28, -54, -23, 32, -17, -16, 64, -32, 13, -16, -33, 76, 36, -20, -28, 34, 30, -13, 18, 30, 16, -19, 36, 20, -30, 46, -25, -34, 17, -3, 39, 10, 5, -36, -30, 7, -38, -30, -14, 11, -9, 17, 38, 5, 7, 21, 30, -38, -1, -16, -18, 21, 33, 6, 36, -8, 21, 27, -9, -61, 8, -17, -2, 17, -29, 21, 27, -6, 13, 37, 8, 60, 1, 1, 16, 5, -67, -24, 24, -50, -18, 21, -9, -17, 32, 5, -19, 11, -12, -22, 42, 27, 4, 33, 5, 35, -4, 22, -21, -31, -19, -16, -47, -28, -7, -9, 4, -25, -20, -6, 1, -40, 33, 20, 27, -26, 44, 27, 10, 16, 17, -12, 13, 25, -32, 2, 15, -35, -31, 24, -25, 25, 26, 22, -15, 4, -22, -18, 26, 7, 5, -11, 18, -15, 14, -36, -5, -29, -10, -33, -29, -9, -13, 34, 10, 35, 40, 13, 1, 41, 41, -18, -33, 35, 27, 21, 31, -39, -30, -24, 24, 5, 6, -1, -5, 32, -23, -27, 15, 18, 10, -20, -20, -8, -10, -18, -22, -16, 4, 9, -15, -6, -12, 33, 4, 11, -15, -14, 22, 28, -8, -22, 33, 22, 11, 17, 18, 10, 31, -19, 0, 4, 18, 34, -25, 15, -31, 9, 9, -22, 43, 3, 39, -30, -43, -48, -45, 23, -22, 32, -4, 30, 22, 12, -27, 36, -26, -19, 26, -13, -3, -39, 24, 30, -34, 6, 20, 26, 32, -36, -48, 61, -19, 24, 7, 46, 29, 19, -31, 0, -24, -53, 4, -10, -1, 28, -7, -17, 25, 6, 42, 38, -19, 31, -29, -15, -37, 28, 35, 38, -29, -26, -18, 14, -21, 8, 8, 12, 15, -31, 23, 17, 37, 32, -10, 0, -33, 16, -29, -8, 0, 34, -9, -18, -28, -37, -33, 16, -1, -3, 11, 30, -2, -27, -34, 16, 15, -20, 21, 42, 0, -23, -19, 10, 19, -1, 23, -27, -32, 22, -31, 1, 8, -2, 18, -2, 21, -3, -2, 10, -17, 2, 4, -26, 7, 47, 19, 30, -8, -13, -34, 0, 24, -5, 7, -4, -25, -13, -35, 5, -22, 25, 4, -37, -2, -31, -10, 20, -16, 14, -3, 3, 25, -41, 0, 26, -55, -35, 6, 5, -2, -3, -4, 10, -2, -11, 56, -36, 58, -28, 54, 42, -27, 17, -20, 34, -68, 18, -44, -21, 16, 53, 34, -7, -1, -30, -32, 0, -22, -18, 29, -20, 34, -3, -6, 7, 25, 28, -31, -27, -35, 57, -16, 4, -3, -10, 13, -7, -22, 4, -4, 29, -15, 31, 35, 0, -12, -29, -34, -30, 2, 10, -13, -30, 6, -33, -35, -20, 16, 0, -23, 24, 15, -9, -10, 37, -34, -15, 10, -4, -9, 32, 36, -24, 12, 23, -37, -23, -61, 18, -11, -23, -14, -28, -15, 38, 19, 31, 1, -23, -7, 10, 6, 21, 36, 25, 33, 0, 13, 36, 8, 38, -36, 20, 22, 42, -21, 11, 20, 12, 8, -26, 23, 6, 13, -5, 22, -2, 18, -34, 34, 9, -23, -14, 34, 1, -13, 9, 1, -13, -28, 3, -12, 16, 34, -3, -7, 29, -4, 1, 0, 16, -22, 3, 5, -18, 5, -25, 29, -24, 2, -17, -10, 16, -19, -18, -37, -2, -8, -26, -43, -42, 7, -27, 25, 22, 21, 4, 1, 22, 5, 6, -25, -11, 10, 46, 1, -14, 32, 25, -74, 50, -14, -6, -24, 29, -17, 0, -33, -4, 16, -9, 46, 13, 13, 26, 23, 8, -8, 5, -11, -27, -17, 0, 19, 8, 18, 17, -22, -4, -27, 38, 41, -3, 29, -10, 4, 27, -30, 18, -60, -32, 26, -64, -48, 14, -39, 12, -32, -2, 7, -29, 20, 6 };
+static const int32_t prediction_next_solar_q8_layer_4_biases[80] = { -49, -46, -22, 82, 86, -2, 115, 33, -10, 73, 40, 90, 0, 94, -15, 135, -39, 106, 76, -22, 67, -10, 58, 102, 89, -7, 5, -42, 87, 55, 71, 0, 73, -26, -12, -82, -37, -30, 15, -17, 107, 82, 91, 91, 91, -42, 29, -21, 85, 86, -85, 101, -15, 96, 93, -88, -103, -7, -32, 148, 53, -46, -77, 58, -18, 72, 92, -20, 73, 101, -21, 28, 90, 96, 81, 105, 97, -102, 78, 82 };
+static const int8_t prediction_next_solar_q8_layer_4_weights[2560] = { 55, 8, -9, 25, -52, -9, 23, 29, 50, 16, -5, -36, 52, -14, 2, -44, -16, -34, 8, -53, -44, -15, -21, -54, -10, 19, 21, -25, 20, 20, 11, 29, -36, -43, -15, -1, -67, 18, -47, 16, -60, 32, 34, -65, -27, -42, 53, 48, 2, 7, 39, -16, -23, -39, 1, 41, 13, 3, -60, 6, 22, 16, -23, 41, 11, -49, 8, -69, -22, 21, 25, -27, -20, -29, -39, -31, -15, 17, -12, -34, -13, -27, 4, -70, -17, -31, 29, -26, 4, -21, 2, -40, 2, -73, -1, -48, 20, -36, -16, 32, 22, -28, 38, -11, 34, -40, 35, -39, -20, 11, 14, -25, 14, 60, -10, -21, 31, -25, 21, -42, 50, 1, 12, 37, -43, -18, 39, 59, 8, -23, -9, -27, 42, -57, 39, -58, 56, 22, 30, -15, 51, 13, 49, 34, 15, 16, 26, 10, -10, -40, 22, 46, 11, 24, 13, -37, 38, 17, 40, 47, -4, 26, -7, 11, 41, 43, 37, 95, -13, -46, -32, 32, 24, 18, -46, -10, -40, 36, -24, -27, -31, -5, 34, -1, -47, 48, 29, -67, 55, 66, -26, 15, -4, -27, -17, -25, -27, 9, 47, -27, -14, 46, -44, 20, 17, 22, 8, -15, 38, -50, 8, -18, 3, -109, 31, 12, 21, 8, 45, -32, -8, 18, 18, 37, 5, 18, -45, 39, 44, -9, 11, -32, 9, 44, -34, -54, 8, -30, 21, -47, -22, 21, 11, -36, -43, 40, 37, -53, -38, 40, -15, -33, -53, -19, -47, -20, 11, -9, -15, 27, 21, -40, -28, -1, -26, 41, -46, -3, -26, -49, 5, -13, -23, -20, 2, -21, -32, -18, 35, 12, -8, -49, -20, 18, 42, -28, -22, 43, -18, 14, 52, -41, 21, -90, 44, 23, -4, -20, -31, 20, 0, -2, -27, 19, 34, -34, -23, -21, 46, 27, -10, -50, 16, -42, -22, 22, -7, -27, 42, 30, 23, 35, 2, 15, 40, -89, 20, 24, -37, -19, -46, 35, -33, 32, 13, -19, -29, -36, 24, 9, 14, 6, 5, -57, 38, -7, 16, 36, -41, -24, 32, 28, 34, 9, 18, -5, 36, -112, -34, 24, 2, 34, 37, 1, 21, -1, 31, 19, 22, -38, -19, -35, -16, -53, 16, -10, -26, -21, 2, 18, 50, -30, -12, 43, -13, -12, -43, -7, -15, -42, -5, -18, -12, 12, -38, 7, 30, -1, -9, -18, -11, 35, 44, 12, 27, 3, 7, 22, 39, -5, -25, 30, 42, -30, -32, -33, -26, 47, 6, 34, -9, -4, 20, 26, 58, 33, 36, 2, 2, 54, -18, -15, 51, 53, 3, 33, 3, -32, 29, -16, 54, -5, -22, -5, -16, -26, -39, -3, -30, 2, -35, -12, -39, -2, 6, -33, 1, -21, 43, -34, -20, -17, 14, 42, 34, 12, -24, -43, 11, 1, -32, -48, 8, 46, -34, -41, -44, 17, -41, 7, -20, -10, -47, -76, -1, 1, 60, -15, -37, -39, 19, -18, -60, -16, 66, -17, -30, 40, 17, -22, 47, -27, -41, 39, 29, 32, 18, -8, 6, 36, 8, 32, -41, 5, 11, -33, -14, -62, -16, 26, 23, -6, -26, -7, 42, -35, 1, 36, -39, 24, 6, 29, 5, -60, -59, 33, 34, 20, -30, 32, 24, 40, -25, -6, 2, 49, 33, -37, 49, -30, 28, 11, -30, 1, -28, 17, 4, -6, 19, 32, 4, 43, 31, 43, 19, -1, -27, -11, 13, 36, 52, 5, -24, 11, 25, 4, -6, -20, 26, -1, -26, -36, -6, -1, 16, 44, 38, 29, 11, 19, 20, 8, 39, -26, -28, 1, -22, -73, 21, 15, 22, -13, -19, -6, 19, -46, 0, 32, -44, -48, 6, 23, 27, -61, 40, -5, -25, 18, -5, 18, 14, -9, -8, 9, -16, -16, -22, 34, 15, 11, -24, 19, 16, 15, 4, 10, 10, -38, -49, 21, -10, 43, 7, 42, -13, -98, -25, 7, 23, 21, -31, -11, 39, -20, 2, 25, -1, 12, 31, -31, -3, 9, 23, -15, 43, -34, 26, -44, 35, -59, 42, 52, -12, -33, -49, -2, -29, 5, -5, -14, -2, -7, 48, 31, -45, -6, -46, 20, 23, 16, 33, -49, -13, -9, 34, -20, 7, -35, -16, 4, 22, -50, 16, -33, -10, 8, 5, -26, -9, -47, 11, -14, -18, 35, 7, 30, 42, 18, 45, 11, -6, 18, -12, 16, -49, -39, 36, -2, 27, -39, -7, 20, -38, 3, 43, -2, 42, 34, 37, 34, -39, -2, -15, -38, -9, -4, -22, -29, 31, 24, 0, 21, 21, 11, -37, 19, 17, -56, 42, -5, 53, 27, 30, 7, -13, -19, 2, 31, 46, 31, 26, -37, 40, -111, 6, -6, 52, -39, -19, 29, -10, 21, 28, -30, 8, 23, 7, -7, -32, -10, -14, -15, 20, -1, 6, -11, -31, -54, 18, -24, 1, -17, -16, 27, 9, -25, -40, 31, -2, -21, 41, -32, -8, -50, -38, 6, 14, -35, 35, 9, -8, 25, -29, 11, 37, 2, -41, 26, 2, -45, 9, -10, -49, -4, -2, -1, -40, -41, -59, 82, -47, -37, 12, -8, 0, 20, 39, 26, -22, 8, 7, -5, 42, -21, -42, -9, -52, 0, -47, 0, -6, 9, 17, -7, 33, -40, 26, 71, -68, 20, 0, 23, -7, 46, 39, 8, -26, 48, -53, -25, -6, -2, -34, 25, -19, -10, -39, 32, 36, -19, -40, 0, 35, 5, 8, 12, 13, 3, -16, 16, 15, -74, 51, -11, 47, -39, -22, -3, 31, -39, -4, -31, -1, -39, -22, -7, 41, -58, 56, -38, 51, -52, 53, 47, 0, -46, 27, 33, 15, 29, 36, -20, -29, -55, 32, 22, -33, -51, 38, -37, 11, 5, -11, 7, -43, -15, 32, 17, 12, 5, 33, 5, 16, -44, -26, -2, -2, -54, 43, 7, -34, 44, 37, -22, 27, -49, -24, -45, -21, -21, -39, 38, 42, 7, 47, 5, 29, -38, -44, -10, 21, -51, -17, -1, 33, -70, 24, 5, -43, -29, -24, 28, -14, -62, 11, -49, -23, -33, 19, 31, -10, 28, -40, 43, -26, -11, -17, -23, -24, -36, -14, 20, 41, -9, -54, -30, 24, 72, 42, -41, 41, -6, -16, -27, -15, -28, 26, 33, 16, -100, -17, 50, 52, -1, -28, 50, 21, 55, 5, -33, 35, 9, 31, -38, 1, -32, -13, -43, 5, 3, -19, -6, 39, -42, 19, 12, -10, -20, 33, -24, -7, -14, -24, 83, 21, 42, 3, -22, 31, 4, -32, 37, 49, 37, -35, 25, -20, -45, -28, 21, -43, -34, -4, -18, 17, 11, 5, 51, 39, -34, -31, -36, -3, -2, -29, -9, -20, 3, 29, 25, 22, -51, 19, 15, 32, 46, -51, -27, 4, -46, -1, -7, -49, 11, 13, -33, 28, -7, -7, 32, 18, -69, 2, 5, -24, 45, -38, 60, 24, 43, 41, -26, 32, -40, -64, 9, 4, 2, 29, -10, -4, 23, -16, -8, -19, -53, -26, 30, 2, 68, -4, -9, 13, 7, -23, 38, -5, -1, -27, 44, 32, -22, 28, -28, 18, 10, -7, 5, 31, -42, 15, 56, 12, 42, -46, 46, -18, 19, -1, -53, 19, 10, -25, 2, -33, 10, -37, -52, -51, -56, -86, 127, -2, -11, 7, -9, 14, -10, 16, 26, 6, -20, -12, 53, -9, -26, -30, 45, -15, -18, -3, -28, -53, 20, 9, 15, 34, -5, -29, -39, -64, 34, -61, 63, -23, 30, -39, -40, -4, -40, 14, 23, 17, 42, -55, -14, 20, -73, -28, -30, -26, -51, 27, -4, 20, 13, -50, 53, -6, -12, 39, 21, 5, 15, -49, -16, 27, -2, 7, 29, -28, -37, -50, 16, -28, 27, -16, -56, -40, -42, -48, -27, -26, 11, 18, 43, 1, -56, 34, 20, 22, 30, 49, 5, 32, -30, 37, -38, 19, 48, 22, -16, 31, 41, -3, 55, -6, -24, 25, -12, -32, -13, 7, 52, 22, -12, 20, 29, 39, 31, 53, 51, -3, 27, 19, 8, 26, 20, -21, -48, -32, 42, -9, 52, 36, 31, 47, 1, -44, 38, 15, 7, 15, 15, -21, -5, 48, 16, 5, 0, -5, 33, 16, 39, -41, -41, 40, 39, -30, -106, 2, -24, 3, -34, 18, 20, 32, 15, 44, 56, -34, -15, 54, -25, -13, -70, 33, 11, -4, 6, 22, -3, 44, -40, 21, 37, 28, 27, 18, 7, -32, -79, 49, 40, 19, -6, 35, -15, -5, 49, 39, 17, 50, -14, 28, 0, 17, -73, -31, -9, 28, -49, -39, 22, -43, -52, -28, 44, 21, 43, 27, -43, -16, 10, -23, -9, 12, -20, -13, 55, 18, -19, 48, -3, 36, -15, 52, -4, -42, -4, -25, -9, 55, 0, -5, 8, -9, -54, -13, 52, 26, -8, 35, 58, -11, 28, -24, 77, 40, -6, -48, -46, 33, 38, -30, -26, -19, 43, -29, -5, -23, 46, -38, 26, 38, 49, 21, 6, 24, 58, -43, 37, 8, -21, -42, 54, -14, -25, 13, 9, -52, -34, -11, -2, -56, -10, 40, -4, -34, 24, -22, -11, 17, -24, 38, -51, 30, 36, 4, -24, 52, 26, -25, 2, -51, -27, 20, -36, -33, 3, 20, 92, -22, -19, 9, 26, 15, 41, -31, 72, 37, 24, 7, 31, -22, 50, -70, 47, -38, 24, -99, 12, -15, -15, 5, 33, 36, 15, 50, 21, -19, -1, 0, 2, 8, -43, -25, 24, 35, 23, -26, 32, 7, 21, 11, 28, 8, -39, 43, 17, 0, -58, -24, 10, -4, -67, -23, -5, 36, 15, 26, -8, 1, -111, 13, -47, 22, 14, -6, 19, -22, 29, 18, 27, 15, 30, 23, 14, 32, -37, -1, -28, 40, -33, 55, -7, -41, -14, 44, 21, 33, -43, 41, -24, -85, 31, -35, 46, 35, -14, -38, -50, 8, -1, -58, 25, -3, -51, 17, -41, -7, 2, -12, 56, 5, -31, -4, 20, 4, 44, -27, -6, -68, -6, -51, -62, 17, 34, -8, -92, -77, -35, -37, -5, -24, -53, 23, -38, -89, -44, -63, -34, -53, -76, 11, 43, -86, 34, 3, 8, 3, 1, 5, 49, -8, -13, 9, 54, -3, 31, -10, 2, -7, -12, 22, 59, 19, -15, -40, -34, 17, 7, 18, 24, -33, -35, -3, 26, -14, 37, 50, -42, -15, 14, -13, 16, -31, 26, 52, 27, 38, -12, 51, 40, -18, 20, -37, -1, 61, 24, 55, 29, 45, 39, -27, -30, 11, -48, 52, -25, 29, 37, 18, 1, -35, -36, 43, 48, 3, -26, -33, -36, 43, -28, 36, -39, -19, 43, -1, -22, -21, 38, 21, -8, 46, -18, 4, 46, -29, 26, 17, 45, -9, -22, -24, 44, -27, -31, 14, 27, 10, 22, -28, 4, 9, 0, 1, -34, 11, -10, 7, 8, 39, 18, -24, -26, -42, 36, -10, -11, 10, 6, -10, 26, 21, 36, -30, -26, 65, 15, -29, 38, 38, -34, 19, 27, -5, 35, 2, -4, -19, -40, -18, -49, -26, 12, 4, -23, -15, 27, 4, 28, 11, -10, -37, -69, 16, -10, -39, 10, -2, 51, 32, 77, 5, 34, -41, -30, -3, 2, 11, 11, 3, -27, 38, -32, -34, 12, -37, -4, 21, -22, 23, -45, 47, -24, -10, -22, 37, -22, -42, 20, -40, 35, -8, 11, -39, -28, -40, 24, 18, -3, -28, 25, -7, -31, 38, -31, 15, 17, -47, -43, -9, -39, -36, 10, -15, 13, -39, 5, -30, -39, -14, 44, -21, -51, 20, -42, -19, -38, -30, -5, 16, 14, 20, -85, -55, -19, -43, 53, -20, -66, -31, 25, -70, -31, -49, -10, 21, -42, -11, 68, 10, 7, -30, -58, -37, 26, 9, -7, 2, -18, -7, 45, -38, -19, -11, -27, -2, -4, 27, -14, -36, 3, -5, -58, 19, -34, -3, -14, -20, 63, 19, -38, 23, -12, 60, -43, 23, 30, -14, 37, -48, 20, -32, 6, -29, -61, -58, 60, -38, -46, 41, -10, -19, -8, 22, 33, 21, 19, 10, 10, 36, -38, -1, 52, -50, 8, -30, 2, -14, 41, -10, -9, -18, -4, 17, 57, -50, -1, -64, 87, -27, 17, 23, -5, 19, -14, 45, -2, 42, -45, -39, 16, -17, -3, 1, 54, -47, 34, -3, -40, 35, 3, 0, 69, 6, 32, 51, 44, -36, -63, 42, 37, 14, -1, 6, -41, 43, -5, -19, 10, 33, 20, 29, -17, -18, -41, -24, -37, -39, 30, -41, -23, 8, -55, 9, -5, -22, -21, -9, -4, 15, 33, 47, -26, 22, 5, 32, 48, -17, -24, -5, 22, -25, -13, 2, 27, -28, -70, -1, -9, -7, -27, -23, 2, 47, 23, -12, 24, 14, 50, 9, 16, -30, -48, 1, -5, 21, 41, -29, -13, 32, -33, 33, -13, -13, -29, -12, -25, -17, -51, 17, 40, 38, -58, 35, 8, -3, -1, -1, 30, -22, 43, -36, 17, 33, -40, 20, -5, 37, 29, 23, 48, 56, 56, 41, 43, -5, 9, 13, -27, 27, -53, -31, -22, -13, 38, 4, -38, 43, 22, 33, 3, -21, 21, 16, -35, 30, -39, -9, 6, -42, -15, -1, 5, -13, 30, -22, -54, -31, -5, -32, -38, 37, -7, -18, 6, -45, 17, 33, -37, 21, -27, 18, -48, 22, 32, 36, -16, -27, -84, 29, -45, 1, 16, -18, 31, 31, 35, 45, 7, 11, 0, 1, -38, 28, -17, -5, -39, 22, -41, 15, 4, 19, -26, 37, -27, 11, 29, 16, 15, 41, 2, 37, 3, 56, 42, 30, -22, 16, 21, 42, -18, 39, -47, -35, 15, -18, -50, 50, 23, -15, 30, 44, 5, -19, -52, 7, 0, 21, 10, -11, -28, -23, -32, 17, -46, -27, -33, -3, 32, -31, 26, 15, -3, -23, -3, -29, -3, 27, -38, 0, -14, 9, 33, -51, -35, 6, -31, 26, -6, 27, 31, 14, -35, -16, -59, -6, -36, -26, 8, -10, -44, 42, -12, -28, 33, -14, -33, 17, 16, 7, -42, -33, 12, -37, 3, 38, -45, -12, -52, -9, 19, 1, 35, 57, -16, 16, -98, 54, -40, 46, 28, 26, -10, 22, -30, 21, -12, -25, -46, 54, -30, -40, -64, 53, 32, 31, 3, -28, 2, -33, -56, -17, -7, -13, 39, 53, 19, -6, 13, 23, -30, 48, -1, -20, 16, -32, 37, 27, 26, 57, -38, 51, 29, 13, 10, 45, 49, -28, -38, -34, 48, 40, -44, -35, 43, 48, 51, 6, 2, -13, -53, 50, -38, -17, 52, 24, -17, 58, 31, 19, -30, 30, 36, 48, -26, -12, -51, 10, -11, 6, -48, 16, 20, 47, -35, -9, -9, 28, 51, -13, -11, -35, 2, 10, 37, 61, 9, -2, 6, 4, 55, 21, -18, -12, 29, 49, -19, -12, -67, 50, -32, 1, -20, 51, -15, 5, 17, -34, 67, 1, 47, -1, -6, 30, -40, 14, -22, -21, -41, 12, 39, -20, 46, 43, 16, 27, -3, -25, -4, -31, 15, -27, 55, 38, -50, 14, 38, -26, -10, 35, 46, -42, 39, 18, -3, 18, 21, -3, 13, -55, 36, -27, -29, 0, -35, 7, -36, -13, 2, 37, 20, -48, 13, -41, -29, 41, -28, 41, -51, 33, 28, 35, 38, 19, -2, -35, 36, -46, -73, -5, -52, -35, -35, 3, 50, 58, 44, 47, 43, 44, 9, 13, 29, 17, -65, -13, -27, 4, -49, -16, 3, 43, -16, 3, 20, 2, -6, -32, -31, 27, -112, 15, -24, 37, 37, -43, -1, -31, -35, -12, 12, 53, 0, 31, -5, 13, 9, 30, -40, -22, -48, 49, 11, 42, 3, -2, 60 };
+static const int32_t prediction_next_solar_q8_layer_5_biases[48] = { 35, 131, 99, 186, -21, 202, -29, -23, 159, 139, 229, 127, -35, -32, -20, 61, 131, -31, 186, 169, 167, 115, 198, -30, 112, 26, 183, -12, -1, 174, -27, -27, -17, 171, -43, -17, 215, 28, 122, -35, 182, -19, 142, 133, 337, -31, 136, 133 };
+static const int8_t prediction_next_solar_q8_layer_5_weights[3840] = { -52, 18, 48, -8, 14, 27, 12, 34, -9, -35, 29, -23, -44, 27, -7, -26, -11, 41, 43, 8, -34, -32, 33, -39, 1, 44, 79, 1, -15, 14, 38, -15, 29, 56, -32, -31, 27, 122, 47, -23, -36, 16, -19, -8, 20, 18, -38, 26, -11, 17, -7, -19, 60, 24, 43, -62, 14, 16, -40, 64, 15, 68, -1, 16, -15, 26, -10, 28, 35, -23, 39, 2, -29, -38, -30, -36, 5, -28, -47, -47, 0, -32, 38, 31, 30, -44, -9, -33, -37, 47, 19, 19, -3, 18, -31, 67, 12, -34, 3, 11, -15, -27, 50, -31, -13, -9, -27, -38, 18, 4, 11, 54, 40, 22, -36, 15, 29, -76, -13, 6, -13, -12, -9, 36, 20, -60, -19, -5, 41, -11, -22, 47, -48, 18, -5, -31, -33, -29, -29, 43, -22, -12, -58, 41, 37, 51, 50, 38, 36, -2, -13, -12, 40, -7, 54, -10, 50, -29, 23, 28, 26, 26, 20, -45, 6, 6, -26, 28, -12, -18, 13, -44, 36, -6, 32, -31, 6, -15, -6, -26, 22, 18, -30, -27, -32, -24, 27, 20, -51, -34, -17, 33, 3, -54, 4, 1, -16, -34, 10, 17, 6, 1, 16, 20, 29, 25, 8, -58, 21, 20, -97, -34, -18, -40, 47, -15, 28, 15, 3, 13, 3, -30, 49, 26, 6, 9, -7, -13, -33, -7, -24, -25, 46, -35, -25, 1, 27, 33, -14, 40, -18, 27, 67, -42, 21, 7, 78, -61, -26, -57, -41, -28, 18, -21, -19, -2, 28, -28, -25, -14, 0, 29, -19, 50, 35, -36, 17, -12, -56, 44, 32, 24, -73, 4, 15, -82, -61, -9, 28, -46, 32, -3, -19, -39, 9, 11, 29, -75, 24, 16, -89, 62, 14, -11, -27, 22, -12, 37, 17, 44, 19, -81, 31, -13, 11, -25, -36, -25, -61, 39, 32, -23, 20, -14, -51, -24, 62, -19, -25, -3, 36, -20, 6, 31, -34, 14, 8, 3, -10, 28, 8, -8, -16, -38, 17, -32, -14, 0, 39, -43, 40, -34, 14, 17, 29, 23, 16, 43, -41, -11, -48, -45, 20, -30, -28, -34, -3, 14, -23, -23, 10, -1, -14, -34, -10, -3, -17, -46, 29, 15, 29, -45, 17, 6, -13, -18, 8, 40, 2, 45, -33, 33, -18, 9, -60, 3, 38, -29, -21, -6, 28, 2, -45, -41, 23, -3, -24, 10, -19, 28, 17, -74, 38, 27, -21, -1, 49, -39, -30, 7, 64, -21, 11, 30, -47, 44, -4, 19, -20, 4, 47, 23, -11, 13, 67, -16, -7, -1, 11, -20, 29, 31, 24, -18, 46, -13, -31, -44, 9, 2, 30, 50, 3, 24, 35, -44, -44, -29, 32, -9, -68, 1, 6, -10, 36, 34, -25, 21, -29, -20, 12, -19, -48, -31, 2, 5, 17, 34, 30, 39, 20, 33, 55, 61, 65, 68, 12, 49, 25, -3, 30, 22, -44, -36, 36, -45, -39, -28, 9, 5, -35, -3, 25, -8, -37, 36, 2, 1, -45, -26, -45, 37, 36, -41, -19, -21, 21, -10, -8, 28, 36, -27, -2, 11, -43, 21, -42, -1, 47, -31, 34, -31, 10, 2, -35, 16, -1, -20, -21, -1, -37, -28, 12, -20, -23, -34, 11, -4, -27, 39, -19, 20, -9, -24, -13, -32, 3, -38, -18, -22, -34, 7, -38, 21, -48, 18, -18, -18, -40, -28, 29, -37, -49, 31, -20, -20, -69, -12, -11, 16, -27, -8, -33, -47, -9, -2, 36, -42, -32, -35, -3, -12, -13, 12, -44, -19, 39, -24, 0, 20, 43, -4, -49, -34, -17, -53, -14, 23, 32, 31, -26, -38, -19, 13, 19, -18, 25, 50, -51, -9, 37, -6, 24, 3, -32, -8, -27, -9, 32, -5, -46, 8, -3, 44, 21, 12, -23, -19, -36, 31, 11, 37, -38, 42, -18, 4, 30, 11, -6, -5, 39, 3, 20, 61, 40, 40, -36, 42, -10, -23, -46, -52, -12, 16, 11, 12, -5, -41, -21, 14, -19, -39, -36, -16, 4, 42, -64, 20, 22, -50, 41, -29, 28, 31, 22, -17, -92, 55, 46, 48, 6, -37, -48, 10, -18, 14, 1, 9, -50, -13, 60, 12, 8, -36, -38, -51, -12, -15, -23, -12, 39, 42, 34, -32, 27, 37, 52, -20, 10, 0, -31, -35, -42, 56, 49, -1, -29, -50, -48, 19, 22, -34, 16, 1, 20, -60, -28, 24, -30, -35, 23, 22, 27, 28, -4, -6, -82, -3, 16, -19, 60, 25, -2, 41, -5, -28, -55, -22, -6, 43, 14, 54, 33, -1, -3, -11, 9, -127, 21, -28, -28, 24, -30, 37, 14, -50, -6, -41, -26, 54, 6, 8, -4, 45, 2, 29, 15, 40, -5, 46, -49, -22, -67, -33, -10, 53, 28, 42, -30, -26, -31, -15, 26, 46, 42, -13, 16, -15, -17, 19, 27, -56, -32, 39, -19, -66, -7, 22, -14, 45, 0, 31, 27, 10, -3, 52, -91, 54, 22, 14, 31, 29, 55, 39, 50, -12, 17, -46, 11, 25, 16, -9, 49, -37, 42, -44, 16, -91, -23, -18, 45, 26, 69, 40, 22, 6, -10, -55, 44, 58, -36, 60, 37, 18, 10, 15, -11, -19, 38, -20, -44, -76, -56, 44, 51, 18, 28, 34, -21, 7, 34, -3, 40, 25, -15, 25, -10, 23, 7, -6, -48, 0, -32, 26, 36, -21, -16, -17, -9, 28, -40, -45, 27, -29, 37, -6, -54, 36, -28, -47, 46, 24, -26, 35, 9, 5, -20, -67, -45, 27, -12, 64, 2, -60, 24, -49, -50, -39, 22, -34, 52, 18, 27, 0, 12, -16, 6, -74, 28, 2, -12, 77, 38, 8, 40, -28, -31, 23, 30, 69, 19, -48, -55, -16, 8, -4, -37, -24, -8, 25, 12, 14, 17, 26, 19, 37, 51, -31, -3, 0, 0, 28, -37, 13, -13, -10, 17, 18, -16, 19, -38, 2, 10, 10, -21, 18, -27, -15, -1, -19, 6, -39, -30, 30, -19, 19, -9, -17, 41, -9, -11, -37, -33, 11, 23, -37, 3, 44, -34, 14, 39, 2, 19, -43, -4, -45, -9, -26, 7, 30, -24, -17, 16, 2, 2, 19, 14, -23, 22, -4, -4, 39, 19, 33, 35, -1, -48, -13, -35, 8, 42, -43, -8, -26, 31, -27, -48, -9, -23, -9, 8, 33, -26, -13, -38, 1, 23, 14, 20, 0, -27, -31, -23, -52, 22, 12, 22, -27, -39, -22, 43, 17, -14, -21, -1, 0, -6, 8, 13, 32, -30, 9, 13, -21, -14, -60, -1, -16, -8, 10, 39, -16, -48, -38, -26, 14, 1, -8, 24, -39, -18, 7, 8, -50, -31, -40, 5, 27, 35, 7, -18, 22, -42, -10, -51, -8, 31, -24, 5, 32, 24, -9, -17, -18, -30, 19, 30, -48, 3, -34, 20, -28, 0, -44, -47, -18, 2, 1, -2, -48, -16, 26, 2, 18, -4, 20, 29, -28, 24, -29, -41, -16, 38, 27, -4, -21, 31, -8, 23, 37, 2, -34, -14, 29, 9, -48, 17, -44, -4, -4, -34, -27, 23, 32, -41, -37, -47, -20, 12, -21, -25, -13, 37, 31, 21, 30, 25, 12, 14, -8, 45, 4, -21, -28, -34, -38, -11, 3, -53, 15, 16, -37, 1, -17, 27, 27, -28, -32, -50, 4, 12, 28, 24, 8, -60, -30, 3, 23, -18, 40, -42, -18, -37, 35, 32, 15, 13, -39, -29, -18, -23, 38, 0, -1, -35, -11, 17, 32, 2, -35, -17, -58, -35, 44, -29, -31, -4, 109, 82, 3, -39, -47, -43, 20, -32, 20, -36, 80, 37, -26, 26, -3, 36, 10, 29, 9, -8, 40, -11, -11, -18, 54, 61, 10, -5, -9, 12, 9, -29, 29, 41, -33, -52, 5, 24, 22, -37, 9, -31, 4, -40, 9, -11, -18, 57, -17, 6, -33, -16, -32, -34, 28, -36, 47, 38, 24, -21, 33, 6, 3, -4, -43, -33, 34, -31, 15, 11, -24, -16, 0, 1, -14, 37, -41, -4, -32, -6, -95, 6, 41, 29, 33, 33, 50, 34, 8, 39, -82, 46, 46, -31, -7, -39, -23, 20, -24, -12, 2, 27, 51, -20, -81, -10, 11, 27, 22, 41, -12, 28, 45, 42, 14, -25, -5, -26, 15, 14, -19, 16, -5, 24, 28, -16, -1, 3, -19, -6, -17, -7, -28, 16, -5, -18, -56, -42, 0, 39, 15, 23, -12, -25, -9, -8, -47, 20, -23, 66, -37, -4, 16, -33, -41, -5, 9, 41, -48, 30, 38, -47, 42, -14, 21, -27, -11, -18, -59, 39, 55, 20, 23, 16, -28, -26, 38, -35, 17, 33, -37, -20, -62, -2, 25, 20, 0, -7, -12, -5, -36, -16, 4, -29, 39, 27, -49, -12, 13, 8, 27, 38, -8, -12, -68, 43, 41, 15, -23, 10, -9, 10, 42, 55, 41, -13, 57, 5, -11, -62, 29, 37, -17, 62, -12, 13, -28, 58, -15, -44, -50, 0, -25, -10, 57, 47, -39, -16, -22, -73, -78, 11, 9, 64, -2, 44, -2, 10, 3, -13, -52, 38, 49, -47, 40, 44, 18, 48, -7, -5, -24, -46, 62, -34, -117, -64, -25, 21, 60, 13, -37, -22, -24, 37, -4, 16, -22, 36, 62, -23, 49, -12, 5, -10, -45, 54, 11, 34, 52, 35, 24, 15, -8, -41, -63, 17, -4, 24, -7, -36, -27, -35, -44, -66, 1, 39, -30, -15, -14, 34, 9, -48, -50, -47, 29, 5, -8, -14, -34, 9, -24, -51, -13, -16, 28, -64, 2, -30, -31, -34, -15, -4, -4, -119, 70, 10, 43, -24, 4, 4, 17, -25, -9, -11, -15, 6, -39, 38, -37, 20, 19, -28, -3, 20, 70, -35, 1, -22, -10, 19, 0, -44, -10, 26, -40, 12, 50, -14, -16, 25, -56, -25, 49, 13, 28, 24, -22, 39, 12, -35, -19, 42, 16, 2, 5, 5, 55, 39, 35, -72, -27, 10, -16, -30, -24, -30, 13, -31, -16, -29, -82, -10, -16, 34, 36, -23, 61, 1, -31, -20, -29, 6, 44, 22, 49, -20, 51, -17, -54, -13, 15, -7, 8, -1, -96, -89, 39, 3, 51, 52, 39, 36, -9, -43, -29, -14, 25, -7, 24, 50, 17, -30, 25, 19, -30, 35, -24, 42, -44, 17, 3, -33, 49, -11, 2, 48, -29, 9, 17, -34, -26, 11, -30, 5, 15, 33, -37, 41, 14, -78, 6, 7, -30, 42, 40, 31, -34, -36, -16, -50, -24, 55, -12, -14, -17, 39, -32, 27, -69, -42, -49, -25, -33, -27, 39, -30, 23, -7, -23, -49, -10, -14, 75, -28, -36, -34, 35, -9, 32, 48, -24, 10, 9, -27, 49, 23, -1, 38, 50, 33, -27, 25, 14, 37, -58, -28, 29, 35, -55, -26, 19, 38, -11, -27, -18, 35, 2, -41, 45, -14, 47, -10, 11, -11, 8, -9, 59, 26, -10, 5, -2, -2, 38, 29, 58, 23, 3, -12, -52, -38, -88, -20, 30, 39, 14, 43, 21, 12, 16, 29, -3, 48, 65, -2, 19, 29, -5, 57, 26, -10, 10, -30, -19, 36, -58, -23, -7, 57, 7, -9, -17, 24, 52, -2, 23, 61, 4, 12, 67, 48, -17, 53, -2, -35, 34, 0, 44, -7, 50, 22, -61, 7, -3, -34, -1, 33, -23, -24, 12, -27, 2, 12, -1, -43, 40, -40, -11, -41, -33, 11, -47, 31, 19, 31, 3, -14, 16, 44, 37, -43, 9, -46, 41, 17, -20, 27, -5, -10, -50, 28, -33, 19, 42, -59, 6, -24, -21, -32, -26, 30, 0, -27, -55, 54, -22, 29, -37, 36, -38, 34, 26, -6, -31, -32, -48, 29, 38, -42, -33, -30, -11, -38, -15, -15, 45, -2, -32, -58, 5, -54, -36, 37, -43, 23, 7, -4, -8, -47, -4, 17, -3, -32, 36, -31, 15, -28, -35, 38, 3, -54, -22, 24, -21, 32, -49, 23, 6, -34, 20, -34, 79, 36, -4, -22, 2, 36, 30, 9, 22, -71, 30, -60, -42, 10, 36, -28, -18, -37, -85, -79, -28, -30, 39, 42, 1, -4, -31, -12, 41, 2, -2, -54, -11, 43, -28, -15, 19, 34, -48, -7, -49, -16, 9, 21, 20, 9, 0, -17, -4, -36, 42, 15, 16, -10, 34, 40, -11, -27, 45, -11, -18, -36, -11, 32, 39, -50, -24, -28, 6, 5, 53, -5, -33, 23, -21, 32, 23, -47, 43, -47, 24, 40, 40, -22, -7, -58, 31, -41, -17, -4, 63, -24, 21, 35, 4, 2, 7, -6, -41, -49, 7, -42, 63, 39, -32, -49, -53, 18, -13, -4, -5, 5, 40, -51, -30, -27, 16, -40, -33, 30, -60, -43, 36, 46, -35, 57, -22, 6, 9, 57, 1, -6, -28, 55, 56, -40, -17, -33, -8, -44, -16, 53, 4, -18, 31, 15, 18, 46, 7, 4, 29, 59, 17, 7, 72, 34, -37, 30, 25, -24, -75, 13, -15, 41, 35, 52, 53, 27, -38, -11, -89, 31, -10, 8, -6, -23, -24, -20, -26, -51, -8, -18, 3, 27, -46, -58, 44, -22, 23, 28, -33, 30, 41, -13, -9, 35, 62, 9, -22, 24, 0, 41, 25, 36, -30, -39, 11, 19, -39, 21, 38, -6, 29, -45, -1, -11, -10, -18, 25, 41, 19, -13, -25, 20, 47, 0, 27, -7, -20, 13, -14, 8, -48, 2, 0, 22, -47, -23, -40, 15, 7, -36, 31, -36, 11, -29, 20, 24, 0, -46, -47, 45, -22, -25, 21, -45, -4, -13, -16, 39, -18, 13, -26, -15, 3, -8, 41, 15, -16, -30, -37, 37, -1, -39, 23, -46, -10, 18, -30, -23, -3, -35, -29, 35, 40, 8, 17, -45, -5, 26, -1, 27, 46, -33, 36, -4, -44, -12, -32, -15, -35, -36, -9, -37, -47, -21, -37, -23, -33, -48, -10, 31, 35, 42, 6, -21, -52, -25, -5, -54, -25, 11, 17, -47, 23, 15, 3, -25, -28, 1, -65, -38, -5, 31, -29, 18, -11, 38, -5, -30, 36, 10, 34, -39, 2, -4, 5, 8, -7, -45, -24, -9, -46, -29, 11, -28, -15, -29, -8, 36, 17, -8, 18, 33, -68, -26, -25, 4, 18, 40, -60, -16, 33, -23, 6, 30, 35, -17, 0, -75, 62, 21, 20, -10, 26, 49, 10, -4, -6, -75, 11, -12, -23, 19, 10, 50, -4, 47, 1, -59, -60, -25, -7, 51, 57, 50, 5, -21, -35, -29, -72, -25, -29, -47, 17, 9, 62, 56, -61, 25, -23, -8, 12, -64, -52, -72, 42, 58, -7, -11, 3, 7, 42, -6, 21, -6, 36, 27, -19, -23, -14, 17, 10, 29, -18, -39, 12, -42, 4, 13, -41, 3, 32, 21, 5, 34, 38, 21, -44, 23, -18, -23, -3, -16, -43, -7, -7, 19, 31, 30, -27, 25, 11, -29, 10, -33, -2, -31, 2, -48, 32, -17, -31, 36, 26, -26, -28, -27, -13, 23, -42, 4, -35, 11, 7, 12, -27, -37, 22, 8, -1, 26, -77, 55, 11, -29, 20, 13, 21, 27, 20, -20, 6, -10, -41, 37, -25, 10, 3, 7, 0, 23, -29, -34, -9, -29, -2, -2, -11, 40, -26, 4, -12, 33, 33, 2, -31, 17, -18, -24, -42, -44, 20, -36, -44, -23, 24, 37, -16, 43, 5, 10, -18, -28, 28, 9, -22, 30, 15, 41, 40, 5, -25, 15, 2, -30, -31, -10, 20, 19, -38, 39, 0, -16, -42, 31, -11, -49, -54, -18, -30, -39, -44, -14, -13, -49, 32, 40, -8, 25, -34, -35, -45, -18, 27, 8, 4, 17, 7, 4, 18, -9, -37, 38, -34, 7, 34, 4, 41, 40, 4, 35, 32, 41, -36, 20, 23, 38, -20, 30, -47, -1, 8, 30, 9, -17, -17, 31, 15, 39, -19, 38, -44, -35, -15, -2, 7, 26, 19, 37, -50, 42, -36, 5, -10, -15, 4, -26, -39, -2, -23, -1, -25, 2, 5, -27, -24, -32, -14, 20, -43, 20, -23, -40, -46, -39, 19, -53, -21, -7, 13, -19, -39, -3, 12, -17, -4, -33, 0, 5, -33, 7, 18, -9, -26, 12, 37, 24, -18, -6, 10, 47, 43, -30, -20, -41, 35, 29, 38, -16, 43, 43, 14, -19, 40, -19, -33, -27, 11, -59, -40, 38, 0, 28, 16, -33, -35, 12, -12, 1, -52, -37, 43, 2, 14, 53, -31, 33, -5, 1, -67, -5, -2, -19, 63, 1, 58, 56, -19, -39, -6, -28, 28, 27, -72, -93, -3, -9, -32, -27, 48, 8, 40, 23, -15, 50, -27, 42, 8, 37, 21, 51, 39, 40, 17, 43, 28, -28, 54, 9, -39, -5, 18, -29, 22, 26, 19, -32, -37, 40, -13, -28, 32, 8, -15, -14, 20, -41, 24, 29, -33, -34, 14, -7, 23, -38, 21, -4, -48, -16, -4, 20, -27, 12, 36, 6, -31, -32, -29, -37, 42, 20, 43, -49, -65, -6, -10, 16, 38, -12, -46, -21, -80, 64, -39, -30, -47, 35, 40, -28, 12, 42, -28, -22, -16, -48, -21, 2, 4, 27, -2, 28, -21, -19, 38, 26, 16, -3, 3, -19, 9, -33, 16, 8, -28, 21, 23, -36, -24, 9, -47, 17, -7, 41, 13, -36, -47, 31, 0, -41, -22, 32, 26, 4, -22, -6, 8, -27, -24, 8, -32, 34, 2, 31, -7, 9, 14, -29, 7, 12, -15, 4, -38, -9, -18, -22, 3, -4, 32, -62, -35, 7, -18, 18, 28, 31, -29, 5, -2, 28, -16, -43, -46, -8, 0, 31, -24, 30, 8, 23, -21, 7, 4, -37, -29, -3, -48, 36, -21, 47, -45, 32, 14, -43, 24, -18, -63, 21, 58, -36, -19, 33, -16, 6, 5, -8, 43, -34, -13, 27, -90, -65, -33, -28, 29, -73, -16, -27, -2, -32, -42, 60, 48, -31, 22, 12, 2, -15, -31, 36, -95, -69, -37, -56, 34, -22, -30, -7, -38, -16, 16, 33, 41, 23, -88, -66, -55, -3, -23, 21, -30, 15, 39, -13, 17, -46, -8, -41, 34, 41, 0, -19, -3, -22, 10, 7, -8, 47, 3, -16, -46, -42, -59, -46, -16, 4, 46, 32, 23, 5, 12, 11, -27, -3, -25, -38, -40, -20, 41, 49, -56, -15, -67, -42, 10, -1, 29, -43, -38, -27, 17, 13, 42, 33, -49, -53, 22, -22, -50, 5, 37, -4, 21, 29, -2, 34, 6, -36, 0, -4, 9, -7, -30, -9, 39, -15, -46, -48, -26, 5, 12, -51, -15, 6, -42, -60, -49, 6, -46, -16, -69, -30, -6, -10, -32, -24, 46, 37, -2, -10, -41, -16, 36, 18, -13, -9, 44, -48, 22, -57, -4, 46, 36, -20, -13, -23, 45, 49, -41, -11, 6, 27, 7, 47, -34, -10, -43, 29, -15, -10, -73, 28, 23, 9, -22, 3, -17, 16, -88, 12, -6, 3, 35, 22, 1, -22, 34, 19, -11, -8, -2, -16, 66, -84, -58, -51, 6, -48, 42, -27, 30, 7, 6, 35, 26, 31, 45, 33, 13, -40, 14, 47, -41, -46, 8, -11, -20, 22, 1, 17, -25, -5, 13, -45, 24, -37, 20, -16, 2, -50, -35, -19, 37, -39, 21, 36, -25, -40, 15, -14, -21, 41, -47, 36, -17, -23, -48, -19, 27, -6, 35, -3, 12, 4, -35, -35, 28, 19, 10, -50, -47, -39, 28, 16, 26, -12, -23, -40, -45, 23, 19, 43, -57, -9, 20, 15, 43, -15, -15, 37, -21, 1, -12, -32, -14, -40, -1, 1, -42, -30, -29, 3, -44, -31, -7, -20, 19, 24, -32, 41, 29, -2, -9, 9, 47, -16, -18, -6, 10, -26, 36, 19, 6, 27, 13, -20, 52, 50, 14, 10, -25, 34, 24, 6, 32, 31, 2, -5, -35, -9, -68, -20, 7, 51, 23, 7, -1, -4, -40, 12, -10, 23, -11, -19, 32, 15, 34, 7, -23, -49, -12, 34, 43, -67, -81, 0, -36, -11, -30, 44, 6, -18, 19, -16, 3, 33, 53, -13, 55, 9, 4, -11, 20, 20, 5, 50, 26, 41, 20, 41, 20, 17, -28, 35, -21, 28, 13, -44, -36, 3, 28, -29, -9, -8, 25, -25, 24, -56, -47, -18, 4, -3, -31, -48, -35, 1, -21, 40, 7, -39, -50, 21, -18, 13, -42, 31, -28, -19, -7, 43, -5, 24, -23, -33, -55, -10, 8, -33, 13, -8, -9, -43, -53, -27, -38, 20, -2, -16, 30, -29, 44, 19, 25, -32, -21, -49, -36, -29, 35, -15, -24, -15, 6, 30, -45, -8, 36, 55, 26, 10, -48, 5, 6, -17, -11, -20, 31, -3, 10, -67, 53, -14, 49, -16, -24, 6, -19, 34, 4, -62, -42, 35, 9, -35, 58, 11, 15, 50, 28, -1, -9, -21, -44, 42, -21, -2, 46, 35, -45, 59, -57, 15, 54, -29, 50, -14, 46, -27, 8, 8, 40, -16, 85, -63, -27, -70, -43, -29, -30, 49, -38, 15, 40, -29, 3, 4, 48, 14, 16, 27, -36, -10, -1, 35, -15, 31, 12, 38, -51, 41, -33, 3, -24, 34, 4, 38, 34, -22, 47, -26, 44, -5, 22, -17, -1, 49, 7, 20, 24, -28, -25, 50, -36, 21, 57, 14, 20, -43, -10, -33, -83, -3, -30, 6, -16, 22, 14, 6, -69, -38, -71, 5, 61, -46, 74, 3, 9, 46, -2, -11, -26, 39, 16, -26, -94, 12, 14, -30, -14, -16, -33, 43, 1, 23, 0, 38, -6, 22, 9, 42, 47, 39, 49, -8, -45, -17, 10, 33, -22, 69, -58, -12, -12, 65, 47, 15, 56, 16, 65, -33, 39, 3, 29, 11, 40, 77, -1, -9, -41, -69, -72, 15, 60, 13, 59, 32, 9, -19, 9, -22, -92, 17, 20, 28, 6, 15, 56, 41, 10, -49, -54, -22, 68, -107, 38, 16, -19, 29, -16, 26, 18, 22, -7, -10, -86, -14, -26, 59, 59, 28, -20, 28, 38, -51, 0, -13, 10, 1, 39, 15, 30, 14, -4, 7, -2, -27, -49, -36, -27, 31, -22, -26, -47, 22, -7, -34, -10, 28, -92, -49, 11, -16, 4, 3, -37, 8, -31, -61, 7, -44, -45, -49, -51, -38, -32, 17, 12, -12, -53, -53, -3, 40, 22, 22, 23, 16, -47, -12, 42, 8, -14, 47, 0, -44, -30, -1, -40, -28, 32, 13, -37, 31, -37, 26, -11, 29, -48, 24, 16, 13, 36, 44, -27, 32, -34, -31, 29, -10, 38, -19, 1, 38, 22, 10, -27, 43, 49, 18, -47, -3, -38, 33, 20, 35, 24, 26, 57, -18, -16, -57, 30, -33, 11, 36, -39, 46, 31, 40, 41, -43, -84, 56, 51, -26, 75, -27, 15, -10, 5, -48, -87, 12, -2, 7, 12, -6, -19, 35, -81, 36, -22, 35, -15, 13, 24, 20, -28, 19, 1, 11, 7, 16, 52, -9, -62, -28, 27, -15, 43, 30, -31, -12, -30, 30, -29, 11, 59, 55, 46, 29, 15, -15, 53, -4, -22, -1, -41, -29, -46, 33, -48, 16, -12, -15, 44, -15, 24, 22, 19, 11, -6, -22, -33, 16, -31, -11, 1, -37, -33, -5, -40, -10, -25, 45, 77, 16, 14, 8, -25, 32, -43, -5, 61, -34, -25, 57, 17, 16, -43, -3, 12, 24, 44, -19, 66, -44, 42, 14, -7, -41, -12, 0, 17, -6, -81, -1, 8, -27, -16, 17, -37, 52, 36, -35, -12, 30, 31, 43, 48, 0, -11, 9, -5 };
+static const int32_t prediction_next_solar_q8_layer_6_biases[1] = { 540 };
+static const int8_t prediction_next_solar_q8_layer_6_weights[48] = { -16, 92, 12, 77, 2, 46, -7, -71, -33, 80, 45, 97, -81, -69, -45, -18, 70, -6, 45, 127, 56, 104, 46, -54, -67, -33, 57, -88, -29, 60, -36, -17, 83, 72, -99, -103, 121, 32, 107, -4, 65, -97, 55, 67, 52, -79, 59, 84 };
+static int8_t prediction_next_solar_q8_buf1[80];
+static int8_t prediction_next_solar_q8_buf2[80];
+static const float prediction_next_solar_q8_input_inv_scale[5] = { 12.7012701f, 10.583333f, 5.52173901f, 4.53571415f, 1.41111112f };
+static const mlp_q8_layer_t prediction_next_solar_q8_layers[7] = { 
+{ 48, 5, prediction_next_solar_q8_layer_0_weights, prediction_next_solar_q8_layer_0_biases, 1862146215, 7, MLP_Q8_ACT_RELU }, 
+{ 80, 48, prediction_next_solar_q8_layer_1_weights, prediction_next_solar_q8_layer_1_biases, 1850310344, 7, MLP_Q8_ACT_RELU }, 
+{ 80, 80, prediction_next_solar_q8_layer_2_weights, prediction_next_solar_q8_layer_2_biases, 1450776706, 7, MLP_Q8_ACT_RELU }, 
+{ 32, 80, prediction_next_solar_q8_layer_3_weights, prediction_next_solar_q8_layer_3_biases, 2101286610, 8, MLP_Q8_ACT_RELU }, 
+{ 80, 32, prediction_next_solar_q8_layer_4_weights, prediction_next_solar_q8_layer_4_biases, 1901036743, 7, MLP_Q8_ACT_RELU }, 
+{ 48, 80, prediction_next_solar_q8_layer_5_weights, prediction_next_solar_q8_layer_5_biases, 1678310152, 8, MLP_Q8_ACT_RELU }, 
+{ 1, 48, prediction_next_solar_q8_layer_6_weights, prediction_next_solar_q8_layer_6_biases, 0, 0, MLP_Q8_ACT_IDENTITY } };
+static const mlp_q8_net_t prediction_next_solar_q8 = { 7, prediction_next_solar_q8_layers, 5, prediction_next_solar_q8_input_inv_scale, 0.00100698206f, prediction_next_solar_q8_buf1, prediction_next_solar_q8_buf2, 80 };
+
+static inline int32_t
+prediction_next_solar_q8_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+{
+  return mlp_q8_regress(&prediction_next_solar_q8, features, n_features, out, out_length);
+}
+
+static inline float
+prediction_next_solar_q8_regress1(const float *features, int32_t n_features)
+{
+  return mlp_q8_regress1(&prediction_next_solar_q8, features, n_features);
+}
@@ -54,10 +54,80 @@
 #undef UIP_CONF_BUFFER_SIZE
 #define UIP_CONF_BUFFER_SIZE    240
 
+/* Motore di inferenza per la previsione (ml/prediction_engine.h):
+ * 0 = emlearn float32, 1 = int8 (ml/mlp_q8.c), 2 = kernel specializzato (*_gen.h),
+ * 3 = pesi potati CSR (ml/mlp_csr.c) */
+#define PREDICTION_CONF_ENGINE 0
+
+/* Modello fuso nextSolar + nextPower eseguito dall'edge (prediction_fused.h da
+ * Colab_IOT.py): va impostato uguale su edge e roof, il roof non esegue inferenza */
+#define PREDICTION_CONF_FUSED 0
+
+/* Backend dei layer int8 e float (ml/mlp_backend.h): 0 = C portabile, 1 = Cortex-M DSP,
+ * 2 = x86 SSE4.1/AVX2. Se non definito viene scelto in base al target */
+/* #define MLP_CONF_BACKEND 0 */
+/* Verifica del backend all'avvio con i vettori di test condivisi */
+#define MLP_CONF_SELFTEST 0
+/* Riuso del risultato e del layer 0 tra previsioni successive con il motore int8
+ * (ml/mlp_q8_memo.h): solo le feature cambiate vengono ricalcolate */
+#define MLP_Q8_CONF_MEMO 1
+/* Profilazione per layer dell'inferenza (ml/mlp_prof.h): tick rtimer e CPU di
+ * Energest con min/media/max/p99, serviti in sola lettura su /res_prof */
+#define MLP_PROF_CONF_ENABLED 0
+
+/* Telemetria verso l'edge (node/telemetry.h): 0 = ogni campione CON, 1 = campioni NON
+ * con un heartbeat CON ogni TELEMETRY_CONF_HEARTBEAT campioni. Energest e le
+ * statistiche di uIP misurano radio accesa e datagrammi UDP per campione
+ * (e il tempo CPU della profilazione) */
+#define TELEMETRY_CONF_NON 0
+#define TELEMETRY_CONF_HEARTBEAT 8
+#define ENERGEST_CONF_ON 1
+#define UIP_CONF_STATISTICS 1
+
+/* Invio a deadband con campionamento adattivo (node/report.h): si invia quando
+ * un valore si sposta oltre la sua deadband o dopo REPORT_CONF_MAX_SILENCE
+ * secondi (lo stesso valore dell'edge); a valori fermi il periodo sale fino a
+ * REPORT_CONF_MAX_STEPS passi da 15 s. 0 = ogni 15 s come prima */
+#define REPORT_CONF_ENABLED 1
+#define REPORT_CONF_MAX_SILENCE 120
+#define REPORT_CONF_MAX_STEPS 4
+#define ROOF_CONF_DEADBAND_SOLAR 100 /* W */
+#define ROOF_CONF_DEADBAND_TEMP 3
+#define ROOF_CONF_DEADBAND_HUMID 15
+#define ROOF_CONF_DEADBAND_NEXT_SOLAR 100 /* W, previsione */
+
+/* Invio in SenML-CBOR (msg/msg_cbor.h) alle risorse che lo annunciano nella
+ * lookup, con ritorno al JSON se il destinatario lo rifiuta */
+#define MSG_CONF_SENML 1
+
 /* Abilita block-wise transfer
 #define COAP_OBSERVE_CLIENT 1
 #define COAP_BLOCK_WISE 1
 #define COAP_MAX_CHUNK_SIZE REST_MAX_CHUNK_SIZE
 */
 
+/* Attuazione di gruppo (node/coap_group.h), con make GROUP=1: il nodo inoltra
+ * con MPL i comandi multicast dell'edge verso gli attuatori */
+#if COAP_GROUP_CONF_ENABLED
+#define UIP_MCAST6_CONF_ENGINE UIP_MCAST6_ENGINE_MPL
+#endif
+
+/* Profilo a basso consumo, con make LOWPOWER=1 (TSCH=1 sugli altri nodi):
+ * la radio e' accesa solo nelle celle TSCH e il sensore non ha una cella di
+ * ricezione applicativa (ACK e risposte arrivano nello slotframe comune).
+ * Il nodo e' foglia RPL e non inoltra per gli altri (neanche con GROUP=1),
+ * i campioni partono NON con heartbeat e tra un campione e l'altro la CPU
+ * scende in LPM profondo (PM2 sui cc2538, deep sleep di default sui cc26xx).
+ * Latenza verso l'edge: al piu' 70 ms per salto, ben dentro i 15 s */
+#if TELEMETRY_CONF_LOWPOWER
+#define TSCH_APP_CONF_RX 0
+#define RPL_CONF_LEAF_ONLY 1
+#undef TELEMETRY_CONF_NON
+#define TELEMETRY_CONF_NON 1
+#define LPM_CONF_MAX_PM 2
+#endif
+
+/* Profilo TSCH, con make TSCH=1 (node/tsch_app.h) */
+#include "../node/tsch_app_conf.h"
+
 #endif /* PROJECT_CONF_H_ */
@@ -0,0 +1,165 @@
+# -*- coding: utf-8 -*-
+'''
+Generatore di kernel C specializzati sulla forma di un modello emlearn.
+
+Al posto del ciclo generico di eml_net_regress1 (tabella EmlNetLayer e
+attivazione scelta a runtime) genera un header con una funzione per layer:
+dimensioni costanti, prodotti scalari srotolati su pesi contigui
+[n_outputs][n_inputs], bias e ReLU fusi nel ciclo di uscita.
+
+L'ordine delle somme e' lo stesso di eml_net_forward(), quindi senza
+--scaler il risultato e' identico bit a bit a quello dell'header emlearn.
+Con --scaler (JSON con "mean" e "scale" dello StandardScaler, esportato da
+Colab_IOT.py) la normalizzazione viene inglobata nei pesi del layer 0 e il
+firmware puo' passare le feature grezze.
+
+Uso:
+  python3 tools/eml_codegen.py edge/prediction_next_power.h \\
+      --out edge/prediction_next_power_gen.h
+  python3 tools/eml_codegen.py roof/prediction_next_solar.h \\
+      --scaler prediction_next_solar_scaler.json --out roof/prediction_next_solar_gen.h
+'''
+
+import argparse
+import json
+
+import numpy as np
+
+import emlearn_header as eh
+
+PER_LINE = 4
+
+
+def fold_scaler(model, path):
+    '''Ingloba (x - mean) / scale nei pesi e bias del layer 0.'''
+    with open(path) as f:
+        scaler = json.load(f)
+    mean = np.asarray(scaler['mean'], dtype=np.float64)
+    scale = np.asarray(scaler['scale'], dtype=np.float64)
+    layer = model.layers[0]
+    if mean.size != layer.n_inputs or scale.size != layer.n_inputs:
+        raise ValueError('lo scaler ha %d feature, il modello %d' % (mean.size, layer.n_inputs))
+    w = layer.weights.astype(np.float64) / scale[:, None]
+    b = layer.biases.astype(np.float64) - (mean[:, None] * w).sum(axis=0)
+    layer.weights = w.astype(np.float32)
+    layer.biases = b.astype(np.float32)
+    layer.weights_literals = np.array(['%.9gf' % v for v in layer.weights.ravel()],
+                                      dtype=object).reshape(layer.weights.shape)
+    layer.biases_literals = np.array(['%.9gf' % v for v in layer.biases], dtype=object)
+
+
+def layer_function(name, idx, layer):
+    lines = ['static void',
+             '%s_layer_%d(const float *in, float *out)' % (name, idx),
+             '{',
+             '  const float *w = %s_layer_%d_weights;' % (name, idx),
+             '  int o;',
+             '',
+             '  for(o = 0; o < %d; o++, w += %d) {' % (layer.n_outputs, layer.n_inputs),
+             '    float sum = 0.0f;']
+    terms = ['sum += w[%d] * in[%d];' % (i, i) for i in range(layer.n_inputs)]
+    for i in range(0, len(terms), PER_LINE):
+        lines.append('    ' + ' '.join(terms[i:i + PER_LINE]))
+    lines.append('    sum = sum + %s_layer_%d_biases[o];' % (name, idx))
+    if layer.activation == 'Relu':
+        lines.append('    if(sum < 0.0f) sum = 0.0f;')
+    lines += ['    out[o] = sum;', '  }', '}']
+    return lines
+
+
+def write_header(model, path, name, source):
+    width = max(max(l.n_inputs, l.n_outputs) for l in model.layers)
+    n_out = model.layers[-1].n_outputs
+    lines = ['/* Generato da tools/eml_codegen.py a partire da %s */' % source,
+             '#include <stdint.h>',
+             '#include <math.h>']
+    for idx, l in enumerate(model.layers):
+        lines.append('static const float %s_layer_%d_biases[%d] = { %s };'
+                     % (name, idx, l.n_outputs, ', '.join(l.biases_literals)))
+        lines.append('static const float %s_layer_%d_weights[%d] = { %s };'
+                     % (name, idx, l.weights.size, ', '.join(l.weights_literals.T.ravel())))
+    lines.append('static float %s_buf1[%d];' % (name, width))
+    lines.append('static float %s_buf2[%d];' % (name, width))
+    for idx, l in enumerate(model.layers):
+        lines.append('')
+        lines += layer_function(name, idx, l)
+
+    body = ['  %s_layer_0(features, %s_buf1);' % (name, name)]
+    bufs = ('%s_buf1' % name, '%s_buf2' % name)
+    for idx in range(1, len(model.layers)):
+        body.append('  %s_layer_%d(%s, %s);' % (name, idx, bufs[(idx - 1) % 2], bufs[idx % 2]))
+    result = bufs[(len(model.layers) - 1) % 2]
+
+    lines += ['',
+              'int32_t',
+              '%s_regress(const float *features, int32_t n_features, float *out, int32_t out_length)' % name,
+              '{',
+              '  int32_t i;',
+              '',
+              '  if(n_features != %d || out_length < %d) {' % (model.n_inputs, n_out),
+              '    return -1;',
+              '  }'] + body + [
+              '  for(i = 0; i < %d; i++) {' % n_out,
+              '    out[i] = %s[i];' % result,
+              '  }',
+              '  return 0;',
+              '}']
+    # Un layer per chiamata, per cedere la CPU tra un layer e l'altro (come mlp_q8_step())
+    lines += ['',
+              'int32_t',
+              '%s_step(uint8_t layer, const float *features, int32_t n_features, float *out, int32_t out_length)' % name,
+              '{',
+              '  int32_t i;',
+              '',
+              '  switch(layer) {',
+              '  case 0:',
+              '    if(n_features != %d || out_length < %d) {' % (model.n_inputs, n_out),
+              '      return -1;',
+              '    }',
+              '    %s_layer_0(features, %s_buf1);' % (name, name)]
+    for idx in range(1, len(model.layers)):
+        lines += ['    return 1;',
+                  '  case %d:' % idx,
+                  '    %s_layer_%d(%s, %s);' % (name, idx, bufs[(idx - 1) % 2], bufs[idx % 2])]
+    lines += ['    break;',
+              '  default:',
+              '    return -1;',
+              '  }',
+              '  for(i = 0; i < %d; i++) {' % n_out,
+              '    out[i] = %s[i];' % result,
+              '  }',
+              '  return 0;',
+              '}']
+    if n_out == 1:
+        lines += ['',
+                  'float',
+                  '%s_regress1(const float *features, int32_t n_features)' % name,
+                  '{',
+                  '  if(n_features != %d) {' % model.n_inputs,
+                  '    return NAN;',
+                  '  }'] + body + [
+                  '  return %s[0];' % result,
+                  '}']
+
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('header', help='header emlearn float (method=inline)')
+    parser.add_argument('--out', required=True, help='header specializzato da generare')
+    parser.add_argument('--name', help='prefisso dei simboli (default: <modello>_gen)')
+    parser.add_argument('--scaler', help='JSON {"mean": [...], "scale": [...]} da inglobare nel layer 0')
+    args = parser.parse_args()
+
+    model = eh.load(args.header)
+    if args.scaler:
+        fold_scaler(model, args.scaler)
+    write_header(model, args.out, args.name or model.name + '_gen', args.header)
+    print('Scritto %s (%d layer, %d MAC)' % (args.out, len(model.layers), model.n_macs))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,225 @@
+# -*- coding: utf-8 -*-
+'''
+Conversione di un modello emlearn float32 in un modello int8 per ml/mlp_q8.c
+
+Pesi int8 simmetrici per layer, accumulatori int32, riquantizzazione in
+virgola fissa (moltiplicatore Q31 + shift) tra un layer e l'altro.
+La scala di ogni feature di ingresso viene inglobata nei pesi del layer 0,
+cosi' feature con range molto diversi (mese 1..12, umidita' 30..90)
+non condividono la stessa risoluzione.
+
+Le scale delle attivazioni sono calibrate campionando il dominio degli
+ingressi del firmware (--ranges), poi il modello int8 viene simulato bit a
+bit come in mlp_q8.c e confrontato con il modello float su un secondo
+campione indipendente.
+
+Uso:
+  python3 tools/eml_quantize.py edge/prediction_next_power.h \\
+      --ranges 0:100:0.01,1:12:1,0:23:1,10:28:1,30:90:1 \\
+      --out edge/prediction_next_power_q8.h
+  python3 tools/eml_quantize.py roof/prediction_next_solar.h \\
+      --ranges 0:10:0.001,1:12:1,0:23:1,10:28:1,30:90:1 \\
+      --out roof/prediction_next_solar_q8.h
+'''
+
+import argparse
+import math
+import sys
+
+import numpy as np
+
+import emlearn_header as eh
+
+QMAX = 127
+
+
+class QLayer(object):
+    def __init__(self, n_outputs, n_inputs, weights, biases, multiplier, shift, relu):
+        self.n_outputs = n_outputs
+        self.n_inputs = n_inputs
+        self.weights = weights          # int8 [n_outputs][n_inputs]
+        self.biases = biases            # int32
+        self.multiplier = multiplier    # Q31, 0 per il layer di uscita
+        self.shift = shift
+        self.relu = relu
+
+
+class QModel(object):
+    def __init__(self, name, layers, input_inv_scale, output_scale):
+        self.name = name
+        self.layers = layers
+        self.input_inv_scale = input_inv_scale  # float32 per feature
+        self.output_scale = output_scale        # float32
+
+    @property
+    def flash_bytes(self):
+        # pesi int8 + bias int32 + descrittori layer (circa 16 byte ciascuno)
+        return sum(l.weights.size + 4 * l.biases.size + 16 for l in self.layers) \
+            + 4 * self.input_inv_scale.size
+
+
+def quantize_multiplier(m):
+    '''m -> (moltiplicatore Q31, shift a destra aggiuntivo).'''
+    mant, exp = math.frexp(m)
+    mult = int(round(mant * (1 << 31)))
+    if mult == (1 << 31):
+        mult //= 2
+        exp += 1
+    shift = -exp
+    if not 1 <= 31 + shift <= 62:
+        raise ValueError('moltiplicatore di riquantizzazione fuori range: %g' % m)
+    return mult, shift
+
+
+def quantize(model, calib):
+    ranges_max = np.maximum(np.abs(calib.min(axis=0)), np.abs(calib.max(axis=0)))
+    ranges_max[ranges_max == 0] = 1.0
+    in_scale = ranges_max / QMAX
+    input_inv_scale = (1.0 / in_scale).astype(np.float32)
+    in_scale = 1.0 / input_inv_scale.astype(np.float64)
+
+    acts = model.forward(calib, collect=True)
+
+    layers = []
+    a_in = 1.0  # scala inglobata nei pesi del layer 0
+    output_scale = None
+    for idx, layer in enumerate(model.layers):
+        w = layer.weights.astype(np.float64)
+        if idx == 0:
+            w = w * in_scale[:, None]
+        sw = max(np.abs(w).max(), 1e-12) / QMAX
+        qw = np.clip(np.round(w / sw), -QMAX, QMAX).astype(np.int8)
+
+        bias_scale = sw * a_in
+        qb = np.round(layer.biases.astype(np.float64) / bias_scale)
+        if np.abs(qb).max() >= 2 ** 31:
+            raise ValueError('bias del layer %d fuori range int32' % idx)
+        qb = qb.astype(np.int32)
+
+        last = idx == len(model.layers) - 1
+        if last:
+            mult, shift = 0, 0
+            output_scale = np.float32(bias_scale)
+            a_out = None
+        else:
+            a_out = max(float(acts[idx].max()), 1e-6) / QMAX
+            mult, shift = quantize_multiplier(bias_scale / a_out)
+
+        layers.append(QLayer(layer.n_outputs, layer.n_inputs, np.ascontiguousarray(qw.T),
+                             qb, mult, shift, layer.activation == 'Relu'))
+        a_in = a_out
+
+    return QModel(model.name, layers, input_inv_scale, output_scale)
+
+
+def quantize_input(qmodel, X):
+    '''Come mlp_q8_quantize_input(): arrotondamento float32 lontano da zero.'''
+    v = np.asarray(X, dtype=np.float32) * qmodel.input_inv_scale
+    r = np.where(v >= 0, v + np.float32(0.5), v - np.float32(0.5)).astype(np.float32)
+    return np.clip(np.trunc(r), -QMAX, QMAX).astype(np.int64)
+
+
+def requantize(acc, mult, shift):
+    rs = 31 + shift
+    return (acc * mult + (1 << (rs - 1))) >> rs
+
+
+def simulate(qmodel, X, collect=False):
+    '''Inferenza intera identica a mlp_q8_regress1()/mlp_q8_regress() (X: [n_samples][n_inputs]).'''
+    a = quantize_input(qmodel, X)
+    accs = []
+    for layer in qmodel.layers:
+        acc = a @ layer.weights.T.astype(np.int64) + layer.biases.astype(np.int64)
+        accs.append(acc)
+        if layer.multiplier == 0:
+            out = acc.astype(np.float32) * qmodel.output_scale
+            if out.shape[1] == 1:
+                out = out[:, 0]
+            return (out, accs) if collect else out
+        lo = 0 if layer.relu else -QMAX
+        a = np.clip(requantize(acc, layer.multiplier, layer.shift), lo, QMAX)
+    raise ValueError('modello senza layer di uscita')
+
+
+def write_header(qmodel, path, name):
+    lines = ['#include "mlp_q8.h"']
+    max_width = max(max(l.n_inputs, l.n_outputs) for l in qmodel.layers)
+    for idx, l in enumerate(qmodel.layers):
+        lines.append('static const int32_t %s_layer_%d_biases[%d] = { %s };'
+                     % (name, idx, l.biases.size, eh.format_array(l.biases, '%d')))
+        lines.append('static const int8_t %s_layer_%d_weights[%d] = { %s };'
+                     % (name, idx, l.weights.size, eh.format_array(l.weights.ravel(), '%d')))
+    lines.append('static int8_t %s_buf1[%d];' % (name, max_width))
+    lines.append('static int8_t %s_buf2[%d];' % (name, max_width))
+    lines.append('static const float %s_input_inv_scale[%d] = { %s };'
+                 % (name, qmodel.input_inv_scale.size,
+                    eh.format_array(qmodel.input_inv_scale, '%.9gf')))
+    lines.append('static const mlp_q8_layer_t %s_layers[%d] = { ' % (name, len(qmodel.layers)))
+    rows = []
+    for idx, l in enumerate(qmodel.layers):
+        act = 'MLP_Q8_ACT_RELU' if l.relu else 'MLP_Q8_ACT_IDENTITY'
+        rows.append('{ %d, %d, %s_layer_%d_weights, %s_layer_%d_biases, %d, %d, %s }'
+                    % (l.n_outputs, l.n_inputs, name, idx, name, idx,
+                       l.multiplier, l.shift, act))
+    lines.append(', \n'.join(rows) + ' };')
+    lines.append('static const mlp_q8_net_t %s = { %d, %s_layers, %d, %s_input_inv_scale, %.9gf, %s_buf1, %s_buf2, %d };'
+                 % (name, len(qmodel.layers), name, qmodel.input_inv_scale.size, name,
+                    qmodel.output_scale, name, name, max_width))
+    # static inline: l'header si puo' includere in piu' file e i wrapper non usati non danno warning
+    lines.append('''
+static inline int32_t
+%s_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+{
+  return mlp_q8_regress(&%s, features, n_features, out, out_length);
+}
+
+static inline float
+%s_regress1(const float *features, int32_t n_features)
+{
+  return mlp_q8_regress1(&%s, features, n_features);
+}''' % (name, name, name, name))
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('header', help='header emlearn float (method=inline)')
+    parser.add_argument('--ranges', required=True,
+                        help='dominio degli ingressi lo:hi:passo per ogni feature')
+    parser.add_argument('--out', help='header int8 da generare')
+    parser.add_argument('--name', help='prefisso dei simboli (default: <modello>_q8)')
+    parser.add_argument('--samples', type=int, default=20000)
+    parser.add_argument('--seed', type=int, default=42)
+    args = parser.parse_args()
+
+    model = eh.load(args.header)
+    ranges = eh.parse_ranges(args.ranges)
+    if len(ranges) != model.n_inputs:
+        sys.exit('servono %d range, ricevuti %d' % (model.n_inputs, len(ranges)))
+
+    calib = eh.sample_inputs(ranges, args.samples, args.seed)
+    test = eh.sample_inputs(ranges, args.samples, args.seed + 1)
+
+    qmodel = quantize(model, calib)
+    ref = model.forward(test)
+    out = simulate(qmodel, test)
+    err = np.abs(out.astype(np.float64) - ref.astype(np.float64))
+    span = float(ref.max() - ref.min()) or 1.0
+
+    float_bytes = 4 * model.n_params
+    print('Modello:        %s (%d parametri, %d MAC)' % (model.name, model.n_params, model.n_macs))
+    print('Flash float32:  %d byte' % float_bytes)
+    print('Flash int8:     %d byte (%.1fx)' % (qmodel.flash_bytes, float_bytes / float(qmodel.flash_bytes)))
+    print('Uscita float:   min %.4f max %.4f media %.4f' % (ref.min(), ref.max(), ref.mean()))
+    print('Errore int8:    MAE %.5f  max %.5f  (%.3f%% del range)'
+          % (err.mean(), err.max(), 100.0 * err.mean() / span))
+
+    if args.out:
+        write_header(qmodel, args.out, args.name or model.name + '_q8')
+        print('Scritto', args.out)
+
+
+if __name__ == '__main__':
+    main()
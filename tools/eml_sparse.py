@@ -0,0 +1,159 @@
+# -*- coding: utf-8 -*-
+'''
+Conversione di un modello emlearn in formato sparso CSR per ml/mlp_csr.c
+
+I pesi nulli non vengono memorizzati ne' moltiplicati: ogni riga (neurone
+di uscita) conserva solo i propri pesi non nulli con l'indice di colonna
+(uint8) e un vettore row_ptr (uint16) delimita le righe.
+
+Se il modello arriva dal pruning di Colab_IOT.py i pesi eliminati sono gia'
+zero. In alternativa --sparsity applica qui un pruning per magnitudine
+(senza fine-tuning) ai layer nascosti scelti con --layers, e --max-mae
+cerca la sparsita' piu' alta che resta entro l'errore indicato.
+Il tool riporta MAE, flash e MAC rispetto al modello denso.
+
+Uso:
+  python3 tools/eml_sparse.py edge/prediction_next_power.h \\
+      --ranges 0:100:0.01,1:12:1,0:23:1,10:28:1,30:90:1 \\
+      --max-mae 25 --out edge/prediction_next_power_csr.h
+'''
+
+import argparse
+import sys
+
+import numpy as np
+
+import emlearn_header as eh
+
+SPARSITY_STEPS = [s / 20.0 for s in range(1, 19)]  # 0.05 .. 0.90
+
+
+def prune(model, sparsity, layer_ids):
+    '''Azzera la frazione `sparsity` dei pesi piu' piccoli in ogni layer scelto.'''
+    for idx in layer_ids:
+        layer = model.layers[idx]
+        w = layer.weights.copy()
+        k = int(round(sparsity * w.size))
+        if k > 0:
+            threshold = np.sort(np.abs(w).ravel())[k - 1]
+            w[np.abs(w) <= threshold] = 0.0
+        layer.weights = w
+        layer.weights_literals = np.where(w == 0, '0.0f', layer.weights_literals)
+    return model
+
+
+def stats(model):
+    nnz = sum(int(np.count_nonzero(l.weights)) for l in model.layers)
+    # valore float + indice uint8 per ogni peso, row_ptr uint16, bias float
+    flash = sum(5 * int(np.count_nonzero(l.weights)) + 2 * (l.n_outputs + 1)
+                + 4 * l.n_outputs for l in model.layers)
+    return nnz, flash
+
+
+def evaluate(dense, sparse, X):
+    ref = dense.forward(X).astype(np.float64)
+    out = sparse.forward(X).astype(np.float64)
+    err = np.abs(out - ref)
+    return err.mean(), err.max(), float(ref.max() - ref.min()) or 1.0
+
+
+def write_header(model, path, name, source):
+    width = max(max(l.n_inputs, l.n_outputs) for l in model.layers)
+    lines = ['/* Generato da tools/eml_sparse.py a partire da %s */' % source,
+             '#include "mlp_csr.h"']
+    for idx, l in enumerate(model.layers):
+        wt = l.weights.T               # [n_outputs][n_inputs]
+        lit = l.weights_literals.T
+        row_ptr, cols, vals = [0], [], []
+        for o in range(l.n_outputs):
+            nz = np.nonzero(wt[o])[0]
+            cols += [str(c) for c in nz]
+            vals += list(lit[o][nz])
+            row_ptr.append(len(cols))
+        lines.append('static const float %s_layer_%d_biases[%d] = { %s };'
+                     % (name, idx, l.n_outputs, ', '.join(l.biases_literals)))
+        lines.append('static const uint16_t %s_layer_%d_row_ptr[%d] = { %s };'
+                     % (name, idx, len(row_ptr), ', '.join(str(r) for r in row_ptr)))
+        lines.append('static const uint8_t %s_layer_%d_col_idx[%d] = { %s };'
+                     % (name, idx, max(len(cols), 1), ', '.join(cols) or '0'))
+        lines.append('static const float %s_layer_%d_values[%d] = { %s };'
+                     % (name, idx, max(len(vals), 1), ', '.join(vals) or '0.0f'))
+    lines.append('static float %s_buf1[%d];' % (name, width))
+    lines.append('static float %s_buf2[%d];' % (name, width))
+    lines.append('static const mlp_csr_layer_t %s_layers[%d] = { ' % (name, len(model.layers)))
+    rows = []
+    for idx, l in enumerate(model.layers):
+        act = 'MLP_CSR_ACT_RELU' if l.activation == 'Relu' else 'MLP_CSR_ACT_IDENTITY'
+        rows.append('{ %d, %d, %s_layer_%d_row_ptr, %s_layer_%d_col_idx, %s_layer_%d_values, %s_layer_%d_biases, %s }'
+                    % (l.n_outputs, l.n_inputs, name, idx, name, idx, name, idx, name, idx, act))
+    lines.append(', \n'.join(rows) + ' };')
+    lines.append('static const mlp_csr_net_t %s = { %d, %s_layers, %s_buf1, %s_buf2, %d };'
+                 % (name, len(model.layers), name, name, name, width))
+    lines.append('''
+static inline int32_t
+%s_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+{
+  return mlp_csr_regress(&%s, features, n_features, out, out_length);
+}
+
+static inline float
+%s_regress1(const float *features, int32_t n_features)
+{
+  return mlp_csr_regress1(&%s, features, n_features);
+}''' % (name, name, name, name))
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('header', help='header emlearn float (method=inline)')
+    parser.add_argument('--ranges', required=True,
+                        help='dominio degli ingressi lo:hi:passo per ogni feature')
+    parser.add_argument('--layers', default='1,2,3,4,5',
+                        help='layer da potare (default: i layer nascosti larghi)')
+    parser.add_argument('--sparsity', type=float, default=0.0,
+                        help='frazione di pesi da azzerare nei layer scelti')
+    parser.add_argument('--max-mae', type=float,
+                        help='cerca la sparsita\' massima con MAE entro questo valore')
+    parser.add_argument('--out', help='header CSR da generare')
+    parser.add_argument('--name', help='prefisso dei simboli (default: <modello>_csr)')
+    parser.add_argument('--samples', type=int, default=20000)
+    parser.add_argument('--seed', type=int, default=43)
+    args = parser.parse_args()
+
+    dense = eh.load(args.header)
+    ranges = eh.parse_ranges(args.ranges)
+    if len(ranges) != dense.n_inputs:
+        sys.exit('servono %d range, ricevuti %d' % (dense.n_inputs, len(ranges)))
+    layer_ids = [int(v) for v in args.layers.split(',') if v]
+    X = eh.sample_inputs(ranges, args.samples, args.seed)
+
+    sparsity = args.sparsity
+    if args.max_mae is not None:
+        sparsity = 0.0
+        for s in SPARSITY_STEPS:
+            mae, _, _ = evaluate(dense, prune(eh.load(args.header), s, layer_ids), X)
+            print('  sparsita\' %.2f -> MAE %.5f' % (s, mae))
+            if mae > args.max_mae:
+                break
+            sparsity = s
+
+    model = prune(eh.load(args.header), sparsity, layer_ids)
+    mae, max_err, span = evaluate(dense, model, X)
+    nnz, flash = stats(model)
+
+    print('Modello:        %s, sparsita\' %.2f sui layer %s' % (dense.name, sparsity, args.layers))
+    print('MAC:            %d -> %d (%+.1f%%)' % (dense.n_macs, nnz, 100.0 * (nnz / float(dense.n_macs) - 1)))
+    print('Flash:          %d -> %d byte (%+.1f%%)'
+          % (4 * dense.n_params, flash, 100.0 * (flash / float(4 * dense.n_params) - 1)))
+    print('Errore:         MAE %.5f  max %.5f  (%.3f%% del range)' % (mae, max_err, 100.0 * mae / span))
+
+    if args.out:
+        write_header(model, args.out, args.name or dense.name + '_csr', args.header)
+        print('Scritto', args.out)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,131 @@
+# -*- coding: utf-8 -*-
+'''
+Lettura dei modelli MLP generati da emlearn (method='inline') e
+riferimento float usato dagli strumenti di conversione in tools/.
+
+Il parser legge direttamente gli header .h presenti nei nodi
+(es. edge/prediction_next_power.h), cosi' gli strumenti lavorano sugli
+stessi pesi che finiscono nel firmware.
+'''
+
+import re
+import numpy as np
+
+_ARRAY_RE = re.compile(
+    r'static const float (\w+)_layer_(\d+)_(weights|biases)\[(\d+)\] = \{([^}]*)\};')
+_LAYER_RE = re.compile(
+    r'\{\s*(\d+),\s*(\d+),\s*\w+,\s*\w+,\s*EmlNetActivation(\w+)\s*\}')
+
+
+class Layer(object):
+    def __init__(self, n_outputs, n_inputs, weights, biases, activation,
+                 weights_literals=None, biases_literals=None):
+        self.n_outputs = n_outputs
+        self.n_inputs = n_inputs
+        # Pesi nel layout emlearn/Keras [n_inputs][n_outputs]
+        self.weights = weights
+        self.biases = biases
+        self.activation = activation  # 'Relu' oppure 'Identity'
+        # Letterali C originali (es. "0.065781f"): riscriverli identici
+        # garantisce gli stessi float32 del compilatore
+        self.weights_literals = weights_literals
+        self.biases_literals = biases_literals
+
+
+class Model(object):
+    def __init__(self, name, layers):
+        self.name = name
+        self.layers = layers
+
+    @property
+    def n_inputs(self):
+        return self.layers[0].n_inputs
+
+    @property
+    def n_params(self):
+        return sum(l.weights.size + l.biases.size for l in self.layers)
+
+    @property
+    def n_macs(self):
+        return sum(l.weights.size for l in self.layers)
+
+    def forward(self, X, collect=False):
+        '''Inferenza float32 come eml_net_regress (X: [n_samples][n_inputs]).
+
+        Ritorna un vettore per i modelli a una uscita (eml_net_regress1),
+        altrimenti una matrice [n_samples][n_outputs].
+        '''
+        a = np.asarray(X, dtype=np.float32)
+        acts = []
+        for layer in self.layers:
+            a = a @ layer.weights + layer.biases
+            if layer.activation == 'Relu':
+                a = np.maximum(a, np.float32(0.0))
+            acts.append(a)
+        if collect:
+            return acts
+        return a[:, 0] if a.shape[1] == 1 else a
+
+
+def load(path):
+    '''Carica un header emlearn e ricostruisce la rete.'''
+    with open(path) as f:
+        src = f.read()
+
+    arrays = {}
+    literals = {}
+    name = None
+    for m in _ARRAY_RE.finditer(src):
+        name = m.group(1)
+        tokens = [v.strip() for v in m.group(5).split(',') if v.strip()]
+        values = np.array([float(v.rstrip('f')) for v in tokens], dtype=np.float32)
+        if values.size != int(m.group(4)):
+            raise ValueError('%s: array %s_layer_%s_%s incompleto'
+                             % (path, name, m.group(2), m.group(3)))
+        arrays[(int(m.group(2)), m.group(3))] = values
+        literals[(int(m.group(2)), m.group(3))] = np.array(tokens, dtype=object)
+
+    if name is None:
+        raise ValueError('%s: nessun layer emlearn trovato' % path)
+
+    layers = []
+    for idx, m in enumerate(_LAYER_RE.finditer(src)):
+        n_out, n_in, act = int(m.group(1)), int(m.group(2)), m.group(3)
+        if act not in ('Relu', 'Identity'):
+            raise ValueError('%s: attivazione %s non supportata' % (path, act))
+        w = arrays[(idx, 'weights')].reshape(n_in, n_out)
+        b = arrays[(idx, 'biases')]
+        layers.append(Layer(n_out, n_in, w, b, act,
+                            literals[(idx, 'weights')].reshape(n_in, n_out),
+                            literals[(idx, 'biases')]))
+
+    return Model(name, layers)
+
+
+def parse_ranges(spec):
+    '''"lo:hi:step,..." -> lista di tuple (lo, hi, step) per ogni feature.'''
+    ranges = []
+    for item in spec.split(','):
+        lo, hi, step = (float(v) for v in item.split(':'))
+        ranges.append((lo, hi, step))
+    return ranges
+
+
+def sample_inputs(ranges, n, seed):
+    '''Campiona n vettori di ingresso nel dominio usato dal firmware.
+
+    Ogni feature viene arrotondata al suo passo: mese, ora, temperatura e
+    umidita' arrivano sempre come interi dai sensori.
+    '''
+    rng = np.random.RandomState(seed)
+    cols = []
+    for lo, hi, step in ranges:
+        v = rng.uniform(lo, hi, size=n)
+        if step > 0:
+            v = np.round(v / step) * step
+        cols.append(np.clip(v, lo, hi))
+    return np.stack(cols, axis=1).astype(np.float32)
+
+
+def format_array(values, fmt):
+    return ', '.join(fmt % v for v in values)
@@ -0,0 +1,88 @@
+# -*- coding: utf-8 -*-
+'''
+Confronto tra MAC (CSMA e il profilo TSCH di node/tsch_app.h) a partire da
+due letture di /res_stats dell'edge per ogni prova, all'inizio e alla fine
+della finestra di misura in Cooja (node/pipe_stats.h).
+
+Per ogni prova stampa, sulla finestra tra le due letture:
+  actuate  PUT agli attuatori accodato -> conferma
+  loop     prima lettura dello slot -> attuatore confermato
+con conteggio, media, p99 dall'istogramma e massimo (il massimo e'
+cumulativo dall'avvio dell'edge), e il duty cycle della radio dell'edge:
+(ascolto + trasmissione) / tempo totale di Energest.
+
+Le letture si prendono con:
+  coap-client -m get coap://[<edge>]/res_stats > csma_0.json
+
+Uso:
+  python3 tools/mac_compare.py --run csma csma_0.json csma_1.json \\
+                               --run tsch tsch_0.json tsch_1.json
+'''
+
+import argparse
+import json
+import math
+
+STAGES = ["actuate", "loop"]
+
+
+def hist_percentile(hist, bounds, pct, max_us):
+    total = sum(hist)
+    if total == 0:
+        return 0
+    need = math.ceil(total * pct / 100.0)
+    acc = 0
+    for i, count in enumerate(hist):
+        acc += count
+        if acc >= need:
+            return min(bounds[i], max_us) if i < len(bounds) else max_us
+    return max_us
+
+
+def window(start, end):
+    '''Statistiche della finestra tra due letture cumulative'''
+    out = {}
+    for stage in STAGES:
+        n0, sum0, _, hist0 = start[stage]
+        n1, sum1, max_us, hist1 = end[stage]
+        n = n1 - n0
+        hist = [a - b for a, b in zip(hist1, hist0)]
+        out[stage] = {
+            "n": n,
+            "mean": ((sum1 - sum0) % 2**32) // n if n > 0 else 0,
+            "p99": hist_percentile(hist, end["ub"], 99, max_us),
+            "max": max_us,
+        }
+    if "e" in start and "e" in end:
+        cpu, lpm, deep, listen, tx = [a - b for a, b in zip(end["e"], start["e"])]
+        total = cpu + lpm + deep
+        out["duty"] = 100.0 * (listen + tx) / total if total else 0.0
+        out["tx"] = 100.0 * tx / total if total else 0.0
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Latenza di attuazione e duty cycle per MAC")
+    parser.add_argument("--run", nargs=3, action="append", required=True,
+                        metavar=("NOME", "INIZIO", "FINE"), help="prova e le due letture di /res_stats")
+    args = parser.parse_args()
+
+    print("%-8s %-8s %6s %10s %10s %10s %8s %8s" % ("MAC", "stadio", "n", "media ms", "p99 ms", "max ms",
+                                                 "duty %", "tx %"))
+    for name, first, last in args.run:
+        with open(first) as f:
+            start = json.load(f)
+        with open(last) as f:
+            end = json.load(f)
+        if any(end[s][0] < start[s][0] for s in STAGES):
+            raise SystemExit("%s: contatori azzerati tra le due letture, edge riavviato" % name)
+        w = window(start, end)
+        for stage in STAGES:
+            s = w[stage]
+            print("%-8s %-8s %6d %10.1f %10.1f %10.1f %8s %8s" % (
+                name, stage, s["n"], s["mean"] / 1000.0, s["p99"] / 1000.0, s["max"] / 1000.0,
+                "%.2f" % w["duty"] if "duty" in w else "-", "%.2f" % w["tx"] if "tx" in w else "-"))
+
+
+if __name__ == "__main__":
+    main()
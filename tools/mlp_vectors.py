@@ -0,0 +1,134 @@
+# -*- coding: utf-8 -*-
+'''
+Generatore dei vettori di test condivisi dai backend di ml/mlp_backend.h
+
+Contiene prodotti scalari di lunghezze diverse (code da 1 a 3 elementi dopo
+i blocchi da 4, 8 e 16 usati da DSP, SSE4.1 e AVX2, valori estremi +-127) e
+alcuni layer densi completi con riquantizzazione e attivazione.
+I risultati attesi sono calcolati qui in aritmetica intera esatta, quindi
+ogni backend viene confrontato con lo stesso riferimento.
+
+In coda ci sono i layer float in formato emlearn (mlp_backend_dense_f32),
+con uscite in numero non multiplo di 4 e 8 per le code di SSE e AVX. Gli
+attesi sono sommati in float32 nell'ordine di eml_net_forward(); il
+selftest li confronta con una tolleranza relativa, perche' il compilatore
+puo' fondere moltiplicazione e somma (FMA) sui target con FPU.
+
+Uso:
+  python3 tools/mlp_vectors.py --out ml/mlp_backend_vectors.h
+'''
+
+import argparse
+
+import numpy as np
+
+import eml_quantize as eq
+
+DOT_LENGTHS = [1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 48, 80, 127]
+# (n_outputs, n_inputs, moltiplicatore reale, relu)
+DENSE_CASES = [(48, 5, 0.013, True), (80, 80, 0.0021, True), (7, 33, 0.0007, False)]
+# (n_outputs, n_inputs) dei layer float
+FLOAT_CASES = [(48, 5), (13, 48), (1, 13)]
+
+
+def fmt(values):
+    return ', '.join(str(int(v)) for v in values)
+
+
+def fmt_f32(values):
+    # 9 cifre significative: ogni float32 si rilegge identico
+    return ', '.join('%.9ef' % v for v in values)
+
+
+def dense_f32(w, b, x):
+    '''Stesso ordine di somma di eml_net_forward(), in float32'''
+    n_out = len(b)
+    out = []
+    for o in range(n_out):
+        acc = np.float32(0)
+        for i in range(len(x)):
+            acc = np.float32(acc + np.float32(w[i * n_out + o] * x[i]))
+        out.append(np.float32(acc + b[o]))
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--out', required=True)
+    parser.add_argument('--seed', type=int, default=7)
+    args = parser.parse_args()
+    rng = np.random.RandomState(args.seed)
+
+    dot_w, dot_x, dot_bias, dot_expected = [], [], [], []
+    for i, n in enumerate(DOT_LENGTHS):
+        if i % 4 == 0:
+            # caso estremo: accumulo massimo positivo e negativo
+            w = np.full(n, 127 if i % 8 == 0 else -127)
+            x = np.full(n, 127)
+        else:
+            w = rng.randint(-127, 128, size=n)
+            x = rng.randint(-127, 128, size=n)
+        bias = int(rng.randint(-100000, 100000))
+        dot_w += list(w)
+        dot_x += list(x)
+        dot_bias.append(bias)
+        dot_expected.append(bias + int(np.dot(w.astype(np.int64), x.astype(np.int64))))
+
+    lines = ['/* Generato da tools/mlp_vectors.py: vettori di test per ml/mlp_backend_selftest.c */',
+             '#define MLP_VEC_DOT_CASES %d' % len(DOT_LENGTHS),
+             'static const uint16_t mlp_vec_dot_n[%d] = { %s };' % (len(DOT_LENGTHS), fmt(DOT_LENGTHS)),
+             'static const int8_t mlp_vec_dot_w[%d] = { %s };' % (len(dot_w), fmt(dot_w)),
+             'static const int8_t mlp_vec_dot_x[%d] = { %s };' % (len(dot_x), fmt(dot_x)),
+             'static const int32_t mlp_vec_dot_bias[%d] = { %s };' % (len(dot_bias), fmt(dot_bias)),
+             'static const int32_t mlp_vec_dot_expected[%d] = { %s };'
+             % (len(dot_expected), fmt(dot_expected)),
+             '#define MLP_VEC_DENSE_CASES %d' % len(DENSE_CASES)]
+
+    rows = []
+    for c, (n_out, n_in, m, relu) in enumerate(DENSE_CASES):
+        w = rng.randint(-127, 128, size=(n_out, n_in))
+        x = rng.randint(0 if relu else -127, 128, size=n_in)
+        b = rng.randint(-20000, 20000, size=n_out)
+        mult, shift = eq.quantize_multiplier(m)
+        acc = w.astype(np.int64) @ x.astype(np.int64) + b
+        out = np.clip(eq.requantize(acc, mult, shift), 0 if relu else -eq.QMAX, eq.QMAX)
+        name = 'mlp_vec_dense_%d' % c
+        lines += ['static const int8_t %s_w[%d] = { %s };' % (name, w.size, fmt(w.ravel())),
+                  'static const int32_t %s_b[%d] = { %s };' % (name, n_out, fmt(b)),
+                  'static const int8_t %s_x[%d] = { %s };' % (name, n_in, fmt(x)),
+                  'static const int8_t %s_expected[%d] = { %s };' % (name, n_out, fmt(out))]
+        rows.append('{ %d, %d, %s_w, %s_b, %d, %d, %s }'
+                    % (n_out, n_in, name, name, mult, shift,
+                       'MLP_Q8_ACT_RELU' if relu else 'MLP_Q8_ACT_IDENTITY'))
+    lines.append('static const mlp_q8_layer_t mlp_vec_dense_layers[%d] = { %s };'
+                 % (len(DENSE_CASES), ', '.join(rows)))
+    lines.append('static const int8_t *const mlp_vec_dense_x[%d] = { %s };'
+                 % (len(DENSE_CASES), ', '.join('mlp_vec_dense_%d_x' % c for c in range(len(DENSE_CASES)))))
+    lines.append('static const int8_t *const mlp_vec_dense_expected[%d] = { %s };'
+                 % (len(DENSE_CASES), ', '.join('mlp_vec_dense_%d_expected' % c for c in range(len(DENSE_CASES)))))
+
+    lines.append('#define MLP_VEC_F32_CASES %d' % len(FLOAT_CASES))
+    for c, (n_out, n_in) in enumerate(FLOAT_CASES):
+        w = rng.uniform(-1, 1, size=n_in * n_out).astype(np.float32)
+        b = rng.uniform(-1, 1, size=n_out).astype(np.float32)
+        x = rng.uniform(-4, 4, size=n_in).astype(np.float32)
+        name = 'mlp_vec_f32_%d' % c
+        lines += ['static const float %s_w[%d] = { %s };' % (name, w.size, fmt_f32(w)),
+                  'static const float %s_b[%d] = { %s };' % (name, n_out, fmt_f32(b)),
+                  'static const float %s_x[%d] = { %s };' % (name, n_in, fmt_f32(x)),
+                  'static const float %s_expected[%d] = { %s };' % (name, n_out, fmt_f32(dense_f32(w, b, x)))]
+    lines.append('static const uint16_t mlp_vec_f32_shape[%d][2] = { %s };'
+                 % (len(FLOAT_CASES), ', '.join('{ %d, %d }' % (n_in, n_out) for n_out, n_in in FLOAT_CASES)))
+    for part in ['w', 'b', 'x', 'expected']:
+        lines.append('static const float *const mlp_vec_f32_%s[%d] = { %s };'
+                     % (part, len(FLOAT_CASES), ', '.join('mlp_vec_f32_%d_%s' % (c, part)
+                                                           for c in range(len(FLOAT_CASES)))))
+
+    with open(args.out, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+    print('Scritto', args.out)
+
+
+if __name__ == '__main__':
+    main()
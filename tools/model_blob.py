@@ -0,0 +1,115 @@
+# -*- coding: utf-8 -*-
+'''
+Blob binario di un modello int8 per l'aggiornamento a caldo (ml/model_blob.h).
+
+Quantizza l'header emlearn float come tools/eml_quantize.py e scrive il
+blob con header (topologia, dtype, scale, versione, crc16): il nodo lo
+riceve su /model/<nome> con un PUT block-wise (coapthon_server/client.py,
+comando "Aggiorna modello") e lo attiva senza riavvio.
+
+La versione deve crescere a ogni rilascio: il nodo rifiuta blob con
+versione non successiva a quella attiva.
+
+Uso:
+  python3 tools/model_blob.py edge/prediction_next_power.h \\
+      --ranges 0:100:0.01,1:12:1,0:23:1,10:28:1,30:90:1 --version 2 \\
+      --out next_power_v2.bin
+  python3 tools/model_blob.py --info next_power_v2.bin
+'''
+
+import argparse
+import struct
+import sys
+
+import numpy as np
+
+import emlearn_header as eh
+import eml_quantize as eq
+
+MAGIC = 0x314c444d  # "MDL1"
+FORMAT = 1
+DTYPE_Q8 = 1
+HEADER = struct.Struct('<IHHIIBBBBHHf')
+LAYER = struct.Struct('<HHibBH')
+CRC_OFFSET = 8
+
+
+def crc16(data, acc=0):
+    '''crc16_add() di Contiki (os/lib/crc16.c).'''
+    for b in bytearray(data):
+        acc ^= b
+        acc = ((acc >> 8) | (acc << 8)) & 0xffff
+        acc ^= (acc & 0xff00) << 4
+        acc &= 0xffff
+        acc ^= (acc >> 8) >> 4
+        acc ^= (acc & 0xff00) >> 5
+    return acc
+
+
+def pad4(raw):
+    return raw + b'\0' * (-len(raw) % 4)
+
+
+def pack(qmodel, version):
+    n_inputs = qmodel.layers[0].n_inputs
+    n_outputs = qmodel.layers[-1].n_outputs
+    width = max(max(l.n_inputs, l.n_outputs) for l in qmodel.layers)
+    body = b''.join(LAYER.pack(l.n_outputs, l.n_inputs, l.multiplier, l.shift,
+                               1 if l.relu else 0, 0) for l in qmodel.layers)
+    body += qmodel.input_inv_scale.astype('<f4').tobytes()
+    for l in qmodel.layers:
+        body += l.biases.astype('<i4').tobytes()
+        body += pad4(np.ascontiguousarray(l.weights, dtype=np.int8).tobytes())
+
+    def header(crc):
+        return HEADER.pack(MAGIC, FORMAT, crc, version, len(body), DTYPE_Q8, len(qmodel.layers),
+                           n_inputs, n_outputs, width, 0, float(qmodel.output_scale))
+
+    crc = crc16(header(0)[CRC_OFFSET:] + body)
+    return header(crc) + body
+
+
+def info(path):
+    with open(path, 'rb') as f:
+        blob = f.read()
+    (magic, fmt, crc, version, length, dtype, n_layers,
+     n_inputs, n_outputs, width, _, out_scale) = HEADER.unpack_from(blob)
+    ok = magic == MAGIC and fmt == FORMAT and length == len(blob) - HEADER.size
+    ok = ok and crc16(blob[CRC_OFFSET:]) == crc
+    print('%s: versione %d, dtype %d, %d layer, %d -> %d, larghezza %d, %d byte, crc 0x%04x %s'
+          % (path, version, dtype, n_layers, n_inputs, n_outputs, width, len(blob), crc,
+             'ok' if ok else 'NON VALIDO'))
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('header', nargs='?', help='header emlearn float (method=inline)')
+    parser.add_argument('--ranges', help='dominio degli ingressi lo:hi:passo per ogni feature')
+    parser.add_argument('--version', type=int, help='versione del modello (> di quella sul nodo)')
+    parser.add_argument('--out', help='blob da generare')
+    parser.add_argument('--info', help='stampa e verifica l\'header di un blob')
+    parser.add_argument('--samples', type=int, default=20000)
+    parser.add_argument('--seed', type=int, default=42)
+    args = parser.parse_args()
+
+    if args.info:
+        sys.exit(0 if info(args.info) else 1)
+    if not (args.header and args.ranges and args.version and args.out):
+        parser.error('servono header, --ranges, --version e --out')
+
+    model = eh.load(args.header)
+    ranges = eh.parse_ranges(args.ranges)
+    if len(ranges) != model.n_inputs:
+        sys.exit('servono %d range, ricevuti %d' % (model.n_inputs, len(ranges)))
+    qmodel = eq.quantize(model, eh.sample_inputs(ranges, args.samples, args.seed))
+
+    blob = pack(qmodel, args.version)
+    with open(args.out, 'wb') as f:
+        f.write(blob)
+    info(args.out)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,263 @@
+# -*- coding: utf-8 -*-
+'''
+Generatore dei codec JSON dei messaggi CoAP a partire da msg/messages.json.
+
+Per ogni messaggio dello schema genera una struct con un bit di presenza
+per campo e, secondo "codec", le funzioni:
+  msg_<nome>_decode(payload, len, &m)  parser a passata singola sul payload
+                                       CoAP (senza copie ne' terminatore),
+                                       chiavi in qualsiasi ordine, campi
+                                       obbligatori e domini min/max verificati
+  msg_<nome>_encode(&m, buf, size)     serializzatore senza snprintf
+
+Con "senml" (stessi valori di "codec") genera anche
+  msg_<nome>_decode_senml() / msg_<nome>_encode_senml()
+per il formato binario SenML-CBOR (Content-Format 112): un record
+{n: chiave, v: valore} per ogni intero, e il campo stringa con
+"senml": "bt" (epoch) come base time del primo record.
+
+Le chiavi sono riconosciute con uno switch sulla lunghezza seguito da
+memcmp, cosi' ogni chiave viene confrontata al piu' con quelle della
+stessa lunghezza. Il runtime comune e' in msg/msg_json.c e msg/msg_cbor.c.
+
+Campi: "key" (chiave JSON), "name" (membro C, default la chiave),
+"type" int (default, int32_t) o str (msg_str_t nel payload), "n" (nome
+del record SenML, default la chiave),
+"required" (default true), "min"/"max" per gli interi.
+
+Uso:
+  python3 tools/msg_codegen.py msg/messages.json --out msg/msg_codec
+'''
+
+import argparse
+import json
+import os
+from collections import OrderedDict
+
+C_TYPES = {'int': 'int32_t', 'str': 'msg_str_t'}
+
+
+def load(path):
+    with open(path) as f:
+        schema = json.load(f, object_pairs_hook=OrderedDict)
+    for name, msg in schema.items():
+        if len(msg['fields']) > 16:
+            raise ValueError('%s: al massimo 16 campi per messaggio' % name)
+        for field in msg['fields']:
+            if not field['key'].isidentifier() and 'name' not in field:
+                raise ValueError('%s.%s: serve "name"' % (name, field['key']))
+            field.setdefault('name', field['key'])
+            field.setdefault('n', field['key'])
+            field.setdefault('type', 'int')
+            field.setdefault('required', True)
+            if field['type'] not in C_TYPES:
+                raise ValueError('%s.%s: tipo %s non supportato' % (name, field['key'], field['type']))
+            if msg.get('senml') and field['type'] == 'str' and field.get('senml') != 'bt':
+                raise ValueError('%s.%s: in SenML solo stringhe epoch come base time' % (name, field['key']))
+        if 'decode' in msg.get('senml', []) and any(f['type'] == 'str' for f in msg['fields']):
+            raise ValueError('%s: decode SenML solo per messaggi con interi' % name)
+    return schema
+
+
+def bit(name, field):
+    return 'MSG_%s_%s' % (name.upper(), field['name'].upper())
+
+
+def header(schema, source, guard):
+    lines = ['/* Generato da tools/msg_codegen.py a partire da %s: non modificare */' % source,
+             '#ifndef %s' % guard,
+             '#define %s' % guard,
+             '',
+             '#include "msg_json.h"',
+             '#include "msg_cbor.h"']
+    for name, msg in schema.items():
+        fields = msg['fields']
+        lines += ['', '/* %s */' % msg['doc'], 'typedef struct msg_%s {' % name]
+        for f in fields:
+            lines.append('  %s %s;' % (C_TYPES[f['type']], f['name']))
+        lines += ['  uint16_t present;', '} msg_%s_t;' % name]
+        for i, f in enumerate(fields):
+            lines.append('#define %s 0x%04x' % (bit(name, f), 1 << i))
+        required = sum(1 << i for i, f in enumerate(fields) if f['required'])
+        lines.append('#define MSG_%s_REQUIRED 0x%04x' % (name.upper(), required))
+        if 'decode' in msg['codec']:
+            lines.append('int msg_%s_decode(const uint8_t *buf, uint16_t len, msg_%s_t *m);' % (name, name))
+        if 'encode' in msg['codec']:
+            lines.append('int msg_%s_encode(const msg_%s_t *m, char *buf, uint16_t size);' % (name, name))
+        if 'decode' in msg.get('senml', []):
+            lines.append('int msg_%s_decode_senml(const uint8_t *buf, uint16_t len, msg_%s_t *m);' % (name, name))
+        if 'encode' in msg.get('senml', []):
+            lines.append('int msg_%s_encode_senml(const msg_%s_t *m, char *buf, uint16_t size);' % (name, name))
+    lines += ['', '#endif /* %s */' % guard]
+    return lines
+
+
+def key_switch(name, fields, var, read, other, key='key'):
+    '''Switch sulla lunghezza della chiave e memcmp tra le chiavi della stessa lunghezza.'''
+    by_len = OrderedDict()
+    for f in sorted(fields, key=lambda f: len(f[key])):
+        by_len.setdefault(len(f[key]), []).append(f)
+
+    lines = ['    switch(%s_len) {' % var]
+    for n, group in by_len.items():
+        lines.append('    case %d:' % n)
+        for i, f in enumerate(group):
+            lines += ['      %sif(memcmp(%s, "%s", %d) == 0) {' % ('} else ' if i else '', var, f[key], n),
+                      '        %s' % read(f),
+                      '        m->present |= %s;' % bit(name, f)]
+        if other:
+            lines += ['      } else {', '        %s' % other]
+        lines += ['      }', '      break;']
+    if other:
+        lines += ['    default:', '      %s' % other]
+    lines.append('    }')
+    return lines
+
+
+def checks(name, fields):
+    '''Campi obbligatori e domini min/max, comuni a JSON e SenML.'''
+    lines = ['  if((m->present & MSG_%s_REQUIRED) != MSG_%s_REQUIRED) {' % (name.upper(), name.upper()),
+             '    return MSG_ERR_MISSING;',
+             '  }']
+    for f in fields:
+        conds = []
+        if 'min' in f:
+            conds.append('m->%s < %d' % (f['name'], f['min']))
+        if 'max' in f:
+            conds.append('m->%s > %d' % (f['name'], f['max']))
+        if conds:
+            lines += ['  if((m->present & %s) && (%s)) {' % (bit(name, f), ' || '.join(conds)),
+                      '    return MSG_ERR_RANGE;',
+                      '  }']
+    return lines + ['  return MSG_OK;', '}']
+
+
+def decoder(name, msg):
+    lines = ['',
+             'int',
+             'msg_%s_decode(const uint8_t *buf, uint16_t len, msg_%s_t *m)' % (name, name),
+             '{',
+             '  msg_scan_t s;',
+             '  const char *key;',
+             '  uint8_t key_len;',
+             '  int r;',
+             '',
+             '  m->present = 0;',
+             '  if(msg_scan_begin(&s, buf, len) < 0) {',
+             '    return MSG_ERR_SYNTAX;',
+             '  }',
+             '  while((r = msg_scan_key(&s, &key, &key_len)) > 0) {']
+    lines += key_switch(name, msg['fields'], 'key',
+                        lambda f: 'r = msg_scan_%s(&s, &m->%s);' % (f['type'], f['name']),
+                        'r = msg_scan_skip(&s);')
+    lines += ['    if(r < 0) {',
+              '      return MSG_ERR_SYNTAX;',
+              '    }',
+              '  }',
+              '  if(r < 0) {',
+              '    return MSG_ERR_SYNTAX;',
+              '  }']
+    return lines + checks(name, msg['fields'])
+
+
+def decoder_senml(name, msg):
+    lines = ['',
+             'int',
+             'msg_%s_decode_senml(const uint8_t *buf, uint16_t len, msg_%s_t *m)' % (name, name),
+             '{',
+             '  msg_cbor_t s;',
+             '  const char *rec;',
+             '  uint8_t rec_len;',
+             '  int32_t v;',
+             '  int r;',
+             '',
+             '  m->present = 0;',
+             '  if(msg_senml_begin(&s, buf, len) < 0) {',
+             '    return MSG_ERR_SYNTAX;',
+             '  }',
+             '  while((r = msg_senml_next(&s, &rec, &rec_len, &v)) > 0) {']
+    lines += key_switch(name, msg['fields'], 'rec', lambda f: 'm->%s = v;' % f['name'], None, key='n')
+    lines += ['  }',
+              '  if(r < 0) {',
+              '    return MSG_ERR_SYNTAX;',
+              '  }']
+    return lines + checks(name, msg['fields'])
+
+
+def encoder_senml(name, msg):
+    ints = [f for f in msg['fields'] if f['type'] == 'int']
+    bt = [f for f in msg['fields'] if f.get('senml') == 'bt']
+    lines = ['',
+             'int',
+             'msg_%s_encode_senml(const msg_%s_t *m, char *buf, uint16_t size)' % (name, name),
+             '{',
+             '  msg_writer_t w = { buf, size, 0, 0 };',
+             '',
+             '  msg_senml_open(&w, %d);' % len(ints)]
+    for i, f in enumerate(ints):
+        if i == 0 and bt:
+            lines.append('  msg_senml_int_bt(&w, "%s", %d, m->%s, &m->%s);'
+                         % (f['n'], len(f['n']), f['name'], bt[0]['name']))
+        else:
+            lines.append('  msg_senml_int(&w, "%s", %d, m->%s);' % (f['n'], len(f['n']), f['name']))
+    lines += ['  return msg_senml_end(&w);', '}']
+    return lines
+
+
+def encoder(name, msg):
+    lines = ['',
+             'int',
+             'msg_%s_encode(const msg_%s_t *m, char *buf, uint16_t size)' % (name, name),
+             '{',
+             '  msg_writer_t w = { buf, size, 0, 0 };',
+             '']
+    for i, f in enumerate(msg['fields']):
+        prefix = '%s"%s":' % ('{' if i == 0 else ',', f['key'])
+        literal = prefix.replace('"', '\\"')
+        lines.append('  msg_put_raw(&w, "%s", %d);' % (literal, len(prefix)))
+        if f['type'] == 'str':
+            lines.append('  msg_put_str(&w, m->%s.s, m->%s.len);' % (f['name'], f['name']))
+        else:
+            lines.append('  msg_put_int(&w, m->%s);' % f['name'])
+    lines += ['  msg_put_raw(&w, "}", 1);',
+              '  return msg_writer_end(&w);',
+              '}']
+    return lines
+
+
+def source(schema, source, header_name):
+    lines = ['/* Generato da tools/msg_codegen.py a partire da %s: non modificare */' % source,
+             '#include "%s"' % header_name,
+             '',
+             '#include <string.h>']
+    for name, msg in schema.items():
+        if 'decode' in msg['codec']:
+            lines += decoder(name, msg)
+        if 'encode' in msg['codec']:
+            lines += encoder(name, msg)
+        if 'decode' in msg.get('senml', []):
+            lines += decoder_senml(name, msg)
+        if 'encode' in msg.get('senml', []):
+            lines += encoder_senml(name, msg)
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('schema', help='schema dei messaggi (msg/messages.json)')
+    parser.add_argument('--out', required=True, help='prefisso di .h e .c da generare')
+    args = parser.parse_args()
+
+    schema = load(args.schema)
+    base = os.path.basename(args.out)
+    guard = base.upper() + '_H_'
+    with open(args.out + '.h', 'w') as f:
+        f.write('\n'.join(header(schema, args.schema, guard)) + '\n')
+    with open(args.out + '.c', 'w') as f:
+        f.write('\n'.join(source(schema, args.schema, base + '.h')) + '\n')
+    print('Scritti %s.h e %s.c (%d messaggi)' % (args.out, args.out, len(schema)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,144 @@
+# -*- coding: utf-8 -*-
+'''
+Dimensione sul mezzo radio dei messaggi di msg/messages.json in JSON e in
+SenML-CBOR.
+
+Per ogni messaggio con "senml" costruisce il payload dei due formati con
+valori di esempio (gli stessi byte prodotti da msg/msg_json.c e
+msg/msg_cbor.c) e somma gli header della pila 6LoWPAN:
+  CoAP     header 4 + token + Uri-Path + Content-Format + marker 0xff
+  UDP      header compresso NHC
+  IPv6     IPHC + hop-by-hop RPL (--ip)
+  802.15.4 header MAC + FCS (--mac), frame da 127 byte
+Oltre la capienza di un frame il pacchetto viene frammentato (FRAG1 da 4
+byte, FRAGN da 5, payload dei frammenti multiplo di 8): il tempo in aria e'
+calcolato a 250 kbit/s con 6 byte di preambolo/SFD/PHR per frame.
+
+I messaggi sopra REST_MAX_CHUNK_SIZE (--chunk) vengono segnalati: su
+Contiki richiederebbero il block-wise.
+
+Uso:
+  python3 tools/msg_report.py msg/messages.json
+  python3 tools/msg_report.py msg/messages.json --token 8 --ip 28
+'''
+
+import argparse
+import json
+import struct
+
+FRAME = 127
+PHY = 6
+RATE = 250000.0
+FRAG1 = 4
+FRAGN = 5
+UDP_NHC = 7
+
+# Valori tipici dei campi (chiave JSON), per payload realistici
+SAMPLES = {
+    'ts': '1759823360', 'solar': 812, 'sol': 812, 'mese': 10, 'ora': 14,
+    'temp': 21, 'humid': 63, 'hum': 63, 'nextSolar': 790, 'nSol': 790,
+    'power': 1240, 'pow': 1240, 'nPow': 1180, 'miss': 0, 'seq': 412, 't': 1759823360,
+}
+PATHS = {'roof': 'res_roof', 'power': 'res_power', 'data': 'res_data',
+         'prediction': 'res_prediction'}
+
+
+def cbor_head(major, value):
+    if value < 24:
+        return bytes([major << 5 | value])
+    if value <= 0xff:
+        return bytes([major << 5 | 24, value])
+    if value <= 0xffff:
+        return bytes([major << 5 | 25]) + struct.pack('>H', value)
+    return bytes([major << 5 | 26]) + struct.pack('>I', value)
+
+
+def cbor_int(v):
+    return cbor_head(0, v) if v >= 0 else cbor_head(1, -1 - v)
+
+
+def senml(fields, values):
+    '''Come msg_<nome>_encode_senml(): bt nel primo record, chiavi intere.'''
+    bt = None
+    records = []
+    for f in fields:
+        if f.get('senml') == 'bt':
+            bt = int(values[f['key']])
+            continue
+        n = f.get('n', f['key']).encode('ascii')
+        rec = b''
+        size = 2
+        if bt is not None and not records:
+            rec += cbor_int(-3) + cbor_int(bt)
+            size = 3
+        rec += cbor_int(0) + cbor_head(3, len(n)) + n + cbor_int(2) + cbor_int(values[f['key']])
+        records.append(cbor_head(5, size) + rec)
+    return cbor_head(4, len(records)) + b''.join(records)
+
+
+def compact_json(fields, values):
+    '''Come msg_<nome>_encode(): JSON senza spazi, stringhe tra virgolette.'''
+    parts = []
+    for f in fields:
+        v = values[f['key']]
+        parts.append('"%s":%s' % (f['key'], '"%s"' % v if f.get('type') == 'str' else v))
+    return ('{' + ','.join(parts) + '}').encode('ascii')
+
+
+def option_len(delta, length):
+    ext = lambda x: 0 if x < 13 else (1 if x < 269 else 2)
+    return 1 + ext(delta) + ext(length) + length
+
+
+def coap_overhead(path, ct, token):
+    # Uri-Path (11), Content-Format (12, delta 1)
+    ct_len = 0 if ct == 0 else (1 if ct < 256 else 2)
+    return 4 + token + option_len(11, len(path)) + option_len(1, ct_len) + 1
+
+
+def frames(ip_payload, ip_header, mac):
+    '''Numero di frame 802.15.4 e byte trasmessi per un pacchetto IPv6.'''
+    room = FRAME - mac
+    if ip_header + ip_payload <= room:
+        return 1, FRAME - room + ip_header + ip_payload
+    # FRAG1 porta l'header compresso e un primo blocco multiplo di 8
+    first = (room - FRAG1 - ip_header) // 8 * 8
+    rest = ip_payload - first
+    per = (room - FRAGN) // 8 * 8
+    n = 1 + (rest + per - 1) // per
+    total = mac + FRAG1 + ip_header + first + (n - 1) * (mac + FRAGN) + rest
+    return n, total
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('schema', help='msg/messages.json')
+    parser.add_argument('--token', type=int, default=2, help='byte del token CoAP')
+    parser.add_argument('--ip', type=int, default=20, help='byte di IPHC + header RPL')
+    parser.add_argument('--mac', type=int, default=23, help='byte di header MAC + FCS')
+    parser.add_argument('--chunk', type=int, default=128, help='REST_MAX_CHUNK_SIZE')
+    args = parser.parse_args()
+
+    with open(args.schema) as f:
+        schema = json.load(f)
+
+    print('%-11s %-10s %7s %6s %6s %6s %8s' % ('messaggio', 'formato', 'payload', 'coap',
+                                               'frame', 'byte', 'aria_us'))
+    for name, msg in schema.items():
+        if 'senml' not in msg:
+            continue
+        fields = msg['fields']
+        path = PATHS.get(name, name)
+        for fmt, ct, payload in (('JSON', 50, compact_json(fields, SAMPLES)),
+                                 ('SenML-CBOR', 112, senml(fields, SAMPLES))):
+            coap = coap_overhead(path, ct, args.token) + len(payload)
+            n, total = frames(UDP_NHC + coap, args.ip, args.mac)
+            airtime = (total + n * PHY) * 8 / RATE * 1e6
+            note = '  > REST_MAX_CHUNK_SIZE' if len(payload) > args.chunk else ''
+            print('%-11s %-10s %7d %6d %6d %6d %8.0f%s' % (name, fmt, len(payload), coap,
+                                                         n, total, airtime, note))
+
+
+if __name__ == '__main__':
+    main()